@@ -74,6 +74,7 @@
 
 /* Project Headers */
 #include "health_detect_dss.h"
+#include "dsp_utils.h"
 
 /**************************************************************************
  *************************** Macros ***************************************
@@ -127,6 +128,7 @@ static void HealthDSS_ipcCallback(uint32_t remoteCoreId, uint16_t localClientId,
                                    uint64_t msgValue, int32_t crcStatus, void *arg);
 static int32_t HealthDSS_memPoolAlloc(HealthDSS_MemPool_t *pool, uint32_t size, void **ptr);
 static void HealthDSS_memPoolReset(HealthDSS_MemPool_t *pool);
+static void HealthDSS_applyConfig(const SubFrame_Cfg_t *cfg);
 
 /**************************************************************************
  *************************** Action Functions *****************************
@@ -143,16 +145,14 @@ static void action_configure(void *arg)
     
     if (cfg != NULL)
     {
-        /* Store configuration */
-        memcpy(&gHealthDssMCB.subframeCfg, cfg, sizeof(SubFrame_Cfg_t));
-        
-        /* Update derived parameters */
-        gHealthDssMCB.numChirpsPerFrame = cfg->numChirpsPerFrame;
-        gHealthDssMCB.numRangeBins = cfg->numRangeBins;
-        gHealthDssMCB.numDopplerBins = cfg->numDopplerBins;
-        gHealthDssMCB.numVirtualAntennas = cfg->numRxAntennas * cfg->numTxAntennas;
+        HealthDSS_applyConfig(cfg);
     }
     
+    /* Health features are published with the processing result */
+    memset(&gHealthDssMCB.healthFeatures, 0, sizeof(HealthDetect_Features_t));
+    gHealthDssMCB.result.healthFeatures = &gHealthDssMCB.healthFeatures;
+    gHealthDssMCB.result.healthFeaturesSize = sizeof(HealthDetect_Features_t);
+    
     /* Update state */
     gHealthDssMCB.currentState = HEALTH_DSS_STATE_CONFIGURED;
     gHealthDssMCB.configCount++;
@@ -169,6 +169,8 @@ static void action_configure(void *arg)
 static void action_process(void *arg)
 {
     uint32_t startTime, endTime;
+    VitalSigns_Input_t vitalSignsIn;
+    uint32_t rangeBin, rangeBinMax;
     
     /* Get start time */
     startTime = ClockP_getTimeUsec();
@@ -207,11 +209,52 @@ static void action_process(void *arg)
      * TODO: Convert to Cartesian coordinates
      */
     
-    /* Step 6: Health Feature Extraction (future)
-     * Input: Point cloud, Range-Doppler matrix
+    /* Step 6: Health Feature Extraction
+     * Input: Radar cube, range-major [rangeBin][chirp][virtualAntenna]
      * Output: Breathing rate, heart rate estimates
-     * TODO: Implement vital signs extraction
+     * Vital signs use the first virtual antenna of every chirp, averaged
+     * into one slow-time sample per range bin
      */
+    if ((gHealthDssMCB.vitalSigns.isInitialized) && (gHealthDssMCB.radarCubeAddr != NULL) &&
+        (gHealthDssMCB.numVirtualAntennas > 0U))
+    {
+        vitalSignsIn.radarCube = (const VitalSigns_Cmplx16_t *)gHealthDssMCB.radarCubeAddr;
+        vitalSignsIn.chirpStride = gHealthDssMCB.numVirtualAntennas;
+        vitalSignsIn.rangeBinStride = gHealthDssMCB.numChirpsPerFrame * gHealthDssMCB.numVirtualAntennas;
+        vitalSignsIn.numChirps = (uint16_t)gHealthDssMCB.numChirpsPerFrame;
+        vitalSignsIn.numRangeBins = (uint16_t)gHealthDssMCB.numRangeBins;
+        
+        /* The cube is written by the MSS, only the rows of the tracking window are read */
+        rangeBinMax = gHealthDssMCB.vitalSigns.config.rangeBinMax;
+        if (rangeBinMax >= gHealthDssMCB.numRangeBins)
+        {
+            rangeBinMax = gHealthDssMCB.numRangeBins - 1U;
+        }
+        rangeBin = gHealthDssMCB.vitalSigns.config.rangeBinMin;
+        if (rangeBin <= rangeBinMax)
+        {
+            CacheP_inv((void *)&vitalSignsIn.radarCube[rangeBin * vitalSignsIn.rangeBinStride],
+                       (rangeBinMax - rangeBin + 1U) * vitalSignsIn.rangeBinStride * sizeof(VitalSigns_Cmplx16_t),
+                       CacheP_TYPE_ALL);
+        }
+        
+        gHealthDssMCB.healthFeatures.frameNum = gHealthDssMCB.frameCount;
+        VitalSigns_process(&gHealthDssMCB.vitalSigns, &vitalSignsIn, &gHealthDssMCB.healthFeatures);
+        
+        /* C66x cycles against the frame period */
+        gHealthDssMCB.stats.vitalSignsCycles = gHealthDssMCB.vitalSigns.output.processingCycles;
+        if (gHealthDssMCB.stats.vitalSignsCycles > gHealthDssMCB.stats.maxVitalSignsCycles)
+        {
+            gHealthDssMCB.stats.maxVitalSignsCycles = gHealthDssMCB.stats.vitalSignsCycles;
+        }
+        if ((gHealthDssMCB.stats.frameBudgetCycles > 0U) &&
+            (gHealthDssMCB.stats.vitalSignsCycles > gHealthDssMCB.stats.frameBudgetCycles))
+        {
+            gHealthDssMCB.stats.overBudgetCount++;
+            DebugP_log("DSS: Vital signs %u cycles, frame budget %u cycles\r\n",
+                       gHealthDssMCB.stats.vitalSignsCycles, gHealthDssMCB.stats.frameBudgetCycles);
+        }
+    }
     
     /* ========== End of Pipeline ========== */
     
@@ -364,13 +407,16 @@ int32_t HealthDSS_configure(SubFrame_Cfg_t *cfg)
         return HEALTH_DSS_EINVAL_CFG;
     }
     
-    /* Store configuration */
-    memcpy(&gHealthDssMCB.subframeCfg, cfg, sizeof(SubFrame_Cfg_t));
-    
     /* Reset memory pools for new configuration */
     HealthDSS_memPoolReset(&gHealthDssMCB.l3Pool);
     HealthDSS_memPoolReset(&gHealthDssMCB.l2Pool);
     
+    /* Same derived parameters and vital signs set-up as the IPC configuration */
+    HealthDSS_applyConfig(cfg);
+    memset(&gHealthDssMCB.healthFeatures, 0, sizeof(HealthDetect_Features_t));
+    gHealthDssMCB.result.healthFeatures = &gHealthDssMCB.healthFeatures;
+    gHealthDssMCB.result.healthFeaturesSize = sizeof(HealthDetect_Features_t);
+    
     /* Update state */
     gHealthDssMCB.currentState = HEALTH_DSS_STATE_CONFIGURED;
     
@@ -525,6 +571,44 @@ static int32_t HealthDSS_memPoolAlloc(HealthDSS_MemPool_t *pool, uint32_t size,
     return 0;
 }
 
+/**
+ * @brief Apply a subframe configuration
+ *
+ * Stores the configuration, updates the derived parameters and sets up the
+ * vital signs for the frame rate. Shared by the IPC configuration event and
+ * HealthDSS_configure().
+ */
+static void HealthDSS_applyConfig(const SubFrame_Cfg_t *cfg)
+{
+    VitalSigns_Config_t vitalSignsCfg;
+    
+    /* Store configuration */
+    memcpy(&gHealthDssMCB.subframeCfg, cfg, sizeof(SubFrame_Cfg_t));
+    
+    /* Update derived parameters */
+    gHealthDssMCB.numChirpsPerFrame = cfg->numChirpsPerFrame;
+    gHealthDssMCB.numRangeBins = cfg->numRangeBins;
+    gHealthDssMCB.numDopplerBins = cfg->numDopplerBins;
+    gHealthDssMCB.numVirtualAntennas = cfg->numRxAntennas * cfg->numTxAntennas;
+    gHealthDssMCB.radarCubeAddr = cfg->radarCubeAddr;
+    gHealthDssMCB.radarCubeSize = cfg->radarCubeSize;
+    
+    /* Vital signs run at the frame rate */
+    VitalSigns_getDefaultConfig(&vitalSignsCfg);
+    gHealthDssMCB.stats.frameBudgetCycles = 0U;
+    if (cfg->framePeriodMs > 0.0f)
+    {
+        vitalSignsCfg.frameRate_Hz = 1000.0f / cfg->framePeriodMs;
+        gHealthDssMCB.stats.frameBudgetCycles = (uint32_t)(cfg->framePeriodMs * (float)(DSP_CLOCK_MHZ * 1000U));
+    }
+    gHealthDssMCB.stats.maxVitalSignsCycles = 0U;
+    gHealthDssMCB.stats.overBudgetCount = 0U;
+    if (VitalSigns_init(&gHealthDssMCB.vitalSigns, &vitalSignsCfg) != 0)
+    {
+        DebugP_log("DSS: Vital signs disabled, frame period %.1f ms\r\n", cfg->framePeriodMs);
+    }
+}
+
 /**
  * @brief Reset memory pool
  */
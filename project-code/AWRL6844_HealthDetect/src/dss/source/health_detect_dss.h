@@ -63,6 +63,9 @@
 #include "common/data_path.h"
 #include "common/health_detect_types.h"
 
+/* DSS modules */
+#include "vital_signs.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -169,6 +172,10 @@ typedef struct HealthDSS_Stats_t
     uint32_t    avgProcessingTimeUs;    /**< Average processing time */
     uint32_t    maxProcessingTimeUs;    /**< Maximum processing time */
     uint32_t    overflowCount;          /**< Frame overflow count */
+    uint32_t    overBudgetCount;        /**< Frames whose vital signs exceeded the frame budget */
+    uint32_t    frameBudgetCycles;      /**< DSP cycles of one frame period */
+    uint32_t    vitalSignsCycles;       /**< Vital signs cycles of the last frame */
+    uint32_t    maxVitalSignsCycles;    /**< Maximum vital signs cycles */
     uint32_t    l3MemUsed;              /**< L3 memory used in bytes */
     uint32_t    l2MemUsed;              /**< L2 memory used in bytes */
 } HealthDSS_Stats_t;
@@ -230,6 +237,8 @@ typedef struct HealthDSS_MCB_t
     
     /*--- Processing Results ---*/
     HealthDSS_Result_t  result;             /**< Processing output */
+    HealthDetect_Features_t healthFeatures; /**< Health features of the last frame */
+    VitalSigns_Handle_t vitalSigns;         /**< Breathing and heart rate state */
     HealthDSS_Stats_t   stats;              /**< Processing statistics */
     
     /*--- Synchronization ---*/
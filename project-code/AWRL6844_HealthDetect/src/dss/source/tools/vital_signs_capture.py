@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Radar cube captures for vital_signs_host_check.c
+
+Writes synthetic captures with known breathing and heart rates in the capture format that vital_signs_host_check
+reads, so that recorded captures, converted to the same format, run through the same check.
+
+A seated person at a fractional range bin moves the chest by a breathing displacement with a second harmonic plus a
+smaller heart displacement; the phase of the range bin is 4 pi d / lambda on every chirp and virtual antenna, with a
+per antenna phase offset. Static clutter sits on other range bins and complex Gaussian noise is added to every
+sample. The cases cover breathing rates of 8 to 24 per minute, heart rates of 55 to 110 per minute, 100 ms and 50 ms
+frame periods, and an SNR down to 15 dB on the chest range bin.
+
+Known limit: the heart rate is lost when the second breathing harmonic at the lower edge of the heart band is several
+times the heart displacement (24/min with a 3 mm breathing peak puts 0.75 mm at 0.8 Hz against 0.2 mm of heart, at
+100 ms and 50 ms frames alike); the fast case breathes 1.5 mm.
+
+Usage
+  vital_signs_capture.py --out-dir DIR [--seconds S] [--seed S]
+
+Capture file: little endian
+  char magic[4] "VSCP", uint32 version 1, uint32 number of frames, uint32 number of range bins,
+  uint32 number of chirps, uint32 number of virtual antennas, float frame period in ms, float wavelength in mm,
+  float true breathing rate in breaths/min, float true heart rate in beats/min (0 if unknown),
+  then per frame the radar cube, int16 (imag, real) pairs in [rangeBin][chirp][virtualAntenna] order
+"""
+
+import argparse
+import os
+import struct
+
+import numpy as np
+
+WAVELENGTH_MM = 4.96
+
+# (name, breathing per min, heart per min, frame period ms, chest range bin, breathing mm peak, heart mm peak, SNR dB)
+CASES = [
+    ('rest_100ms', 14.0, 68.0, 100.0, 12.4, 4.0, 0.25, 30.0),
+    ('slow_100ms', 8.0, 55.0, 100.0, 20.0, 5.0, 0.3, 30.0),
+    ('fast_100ms', 24.0, 110.0, 100.0, 8.7, 1.5, 0.2, 30.0),
+    ('rest_50ms', 12.0, 78.0, 50.0, 15.2, 4.0, 0.25, 30.0),
+    ('low_snr_100ms', 16.0, 90.0, 100.0, 25.5, 4.0, 0.3, 15.0),
+]
+
+NUM_RANGE_BINS = 64
+NUM_CHIRPS = 16
+NUM_VIRT_ANT = 4
+AMPLITUDE = 4000.0
+
+
+def write_capture(path, case, seconds, rng):
+    name, breath_bpm, heart_bpm, period_ms, chest_bin, breath_mm, heart_mm, snr_db = case
+    num_frames = int(seconds * 1000.0 / period_ms)
+    t = np.arange(num_frames) * period_ms / 1000.0
+    breath_phase0, heart_phase0 = rng.uniform(0, 2 * np.pi, 2)
+    fb, fh = breath_bpm / 60.0, heart_bpm / 60.0
+    disp = (breath_mm * np.sin(2 * np.pi * fb * t + breath_phase0)
+            + 0.25 * breath_mm * np.sin(4 * np.pi * fb * t + 2 * breath_phase0)
+            + heart_mm * np.sin(2 * np.pi * fh * t + heart_phase0))
+    chest = np.exp(1j * 4 * np.pi * disp / WAVELENGTH_MM)
+
+    # Range response of the chest, a sinc over the neighbouring bins
+    bins = np.arange(NUM_RANGE_BINS)
+    profile = AMPLITUDE * np.sinc(bins - chest_bin)
+    profile[np.abs(bins - chest_bin) > 3] = 0.0
+    clutter = np.zeros(NUM_RANGE_BINS, dtype=complex)
+    for b in rng.choice([b for b in range(2, 45) if abs(b - chest_bin) > 5], 4, replace=False):
+        clutter[b] = 1.5 * AMPLITUDE * np.exp(1j * rng.uniform(0, 2 * np.pi))
+    ant_phase = np.exp(1j * rng.uniform(0, 2 * np.pi, NUM_VIRT_ANT))
+    noise_std = AMPLITUDE / 10 ** (snr_db / 20.0) / np.sqrt(2.0)
+
+    with open(path, 'wb') as f:
+        f.write(b'VSCP')
+        f.write(struct.pack('<5I4f', 1, num_frames, NUM_RANGE_BINS, NUM_CHIRPS, NUM_VIRT_ANT, period_ms, WAVELENGTH_MM,
+                            breath_bpm, heart_bpm))
+        for n in range(num_frames):
+            cube = (profile[:, None, None] * chest[n] + clutter[:, None, None]) * ant_phase[None, None, :]
+            cube = np.broadcast_to(cube, (NUM_RANGE_BINS, NUM_CHIRPS, NUM_VIRT_ANT)).copy()
+            cube += noise_std * (rng.standard_normal(cube.shape) + 1j * rng.standard_normal(cube.shape))
+            iq = np.empty(cube.shape + (2,), dtype='<i2')
+            iq[..., 0] = np.clip(np.round(cube.imag), -32768, 32767)
+            iq[..., 1] = np.clip(np.round(cube.real), -32768, 32767)
+            f.write(iq.tobytes())
+    print('%-14s %4d frames, breathing %4.1f/min, heart %5.1f/min, range bin %4.1f, SNR %2.0f dB'
+          % (name, num_frames, breath_bpm, heart_bpm, chest_bin, snr_db))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--out-dir', required=True, help='directory of the capture files')
+    parser.add_argument('--seconds', type=float, default=90.0, help='capture length')
+    parser.add_argument('--seed', type=int, default=1, help='random seed')
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(args.seed)
+    os.makedirs(args.out_dir, exist_ok=True)
+    for case in CASES:
+        write_capture(os.path.join(args.out_dir, case[0] + '.vscp'), case, args.seconds, rng)
+
+
+if __name__ == '__main__':
+    main()
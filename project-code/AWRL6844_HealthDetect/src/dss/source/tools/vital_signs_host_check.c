@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file vital_signs_host_check.c
+ * @brief Host check of the vital signs module on radar cube captures
+ *
+ * Runs VitalSigns_process() frame by frame on captures in the format of
+ * vital_signs_capture.py, with the strides the DSS uses on the shared radar
+ * cube. For captures with known rates the breathing and heart estimates past
+ * the warm-up must be valid and within tolerance on most frames. The host
+ * time per frame is reported next to the C66x frame budget; the cycles on
+ * the target are in the DSS statistics (maxVitalSignsCycles, overBudgetCount).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "vital_signs.h"
+
+/* C66x clock of dsp_utils.h */
+#define CHECK_DSP_CLOCK_MHZ         (450U)
+
+/* Rate tolerances, per minute */
+#define CHECK_BREATHING_TOL         (1.5f)
+#define CHECK_HEART_TOL             (4.0f)
+
+/* Frames past the warm-up that must be valid and within tolerance */
+#define CHECK_MIN_GOOD_RATIO        (0.9f)
+
+/* Settling of the band-pass filters after the breathing window, seconds */
+#define CHECK_SETTLE_S              (5.0f)
+
+typedef struct Check_Capture_t
+{
+    uint32_t    numFrames;
+    uint32_t    numRangeBins;
+    uint32_t    numChirps;
+    uint32_t    numVirtAnt;
+    float       framePeriodMs;
+    float       wavelength_mm;
+    float       breathingRate;
+    float       heartRate;
+} Check_Capture_t;
+
+/**
+ *  @b Description
+ *  @n
+ *      This function reads the header of a capture.
+ *
+ *  @param[in]  f           Capture file
+ *  @param[out] cap         Capture header
+ *
+ *  @retval
+ *      0 on success, -1 on a bad header
+ */
+static int Check_readHeader(FILE *f, Check_Capture_t *cap)
+{
+    char magic[4];
+    uint32_t u[5];
+    float v[4];
+
+    if ((fread(magic, 1, 4, f) != 4) || (memcmp(magic, "VSCP", 4) != 0) ||
+        (fread(u, sizeof(uint32_t), 5, f) != 5) || (fread(v, sizeof(float), 4, f) != 4) || (u[0] != 1U))
+    {
+        return -1;
+    }
+    cap->numFrames = u[1];
+    cap->numRangeBins = u[2];
+    cap->numChirps = u[3];
+    cap->numVirtAnt = u[4];
+    cap->framePeriodMs = v[0];
+    cap->wavelength_mm = v[1];
+    cap->breathingRate = v[2];
+    cap->heartRate = v[3];
+    if ((cap->numRangeBins == 0U) || (cap->numChirps == 0U) || (cap->numChirps > 0xFFFFU) ||
+        (cap->numVirtAnt == 0U) || (cap->framePeriodMs <= 0.0f))
+    {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs a capture through the vital signs module and checks
+ *      the rates against the ones of the header.
+ *
+ *  @param[in]  path        Capture file
+ *
+ *  @retval
+ *      0 on success, -1 on failure
+ */
+static int Check_capture(const char *path)
+{
+    static VitalSigns_Handle_t handle;
+    Check_Capture_t cap;
+    VitalSigns_Config_t cfg;
+    VitalSigns_Input_t in;
+    HealthDetect_Features_t features;
+    VitalSigns_Cmplx16_t *cube;
+    size_t cubeLen;
+    uint32_t n, warmup, numChecked = 0, numBreathGood = 0, numHeartGood = 0;
+    double sumNs = 0.0, maxNs = 0.0, breathErr = 0.0, heartErr = 0.0;
+    float budgetMs;
+    int fail = 0;
+    FILE *f;
+
+    f = fopen(path, "rb");
+    if ((f == NULL) || (Check_readHeader(f, &cap) != 0))
+    {
+        printf("%s: cannot read the capture\n", path);
+        if (f != NULL)
+        {
+            fclose(f);
+        }
+        return -1;
+    }
+
+    VitalSigns_getDefaultConfig(&cfg);
+    cfg.frameRate_Hz = 1000.0f / cap.framePeriodMs;
+    cfg.wavelength_mm = cap.wavelength_mm;
+    if (VitalSigns_init(&handle, &cfg) != 0)
+    {
+        printf("%s: VitalSigns_init failed at %.1f ms frames\n", path, cap.framePeriodMs);
+        fclose(f);
+        return -1;
+    }
+
+    /* Same strides as action_process() on the shared radar cube */
+    cubeLen = (size_t)cap.numRangeBins * cap.numChirps * cap.numVirtAnt;
+    cube = (VitalSigns_Cmplx16_t *)malloc(cubeLen * sizeof(VitalSigns_Cmplx16_t));
+    in.radarCube = cube;
+    in.chirpStride = cap.numVirtAnt;
+    in.rangeBinStride = cap.numChirps * cap.numVirtAnt;
+    in.numChirps = (uint16_t)cap.numChirps;
+    in.numRangeBins = (uint16_t)cap.numRangeBins;
+
+    warmup = (uint32_t)((cfg.breathing.windowLen_s + CHECK_SETTLE_S) * cfg.frameRate_Hz);
+    for (n = 0; n < cap.numFrames; n++)
+    {
+        if (fread(cube, sizeof(VitalSigns_Cmplx16_t), cubeLen, f) != cubeLen)
+        {
+            printf("%s: capture ends at frame %u of %u\n", path, n, cap.numFrames);
+            fail = 1;
+            break;
+        }
+        if (VitalSigns_process(&handle, &in, &features) != 0)
+        {
+            printf("%s: VitalSigns_process failed at frame %u\n", path, n);
+            fail = 1;
+            break;
+        }
+        /* processingCycles holds ns on the host */
+        sumNs += handle.output.processingCycles;
+        if (handle.output.processingCycles > maxNs)
+        {
+            maxNs = handle.output.processingCycles;
+        }
+        if (n < warmup)
+        {
+            continue;
+        }
+        numChecked++;
+        if (features.breathingFeatures.isValid &&
+            (fabsf(features.breathingFeatures.breathingRate - cap.breathingRate) <= CHECK_BREATHING_TOL))
+        {
+            numBreathGood++;
+        }
+        if (features.heartRateFeatures.isValid &&
+            (fabsf(features.heartRateFeatures.heartRate - cap.heartRate) <= CHECK_HEART_TOL))
+        {
+            numHeartGood++;
+        }
+        breathErr += fabsf(features.breathingFeatures.breathingRate - cap.breathingRate);
+        heartErr += fabsf(features.heartRateFeatures.heartRate - cap.heartRate);
+    }
+    free(cube);
+    fclose(f);
+
+    budgetMs = cap.framePeriodMs;
+    printf("%s: %u frames, tracked bin %u, host %.1f us/frame (max %.1f), frame budget %.0f ms = %u C66x cycles\n",
+           path, n, handle.output.trackedRangeBin, sumNs / 1000.0 / (n > 0U ? n : 1U), maxNs / 1000.0, budgetMs,
+           (uint32_t)(budgetMs * CHECK_DSP_CLOCK_MHZ * 1000.0f));
+
+    if ((cap.breathingRate > 0.0f) && (cap.heartRate > 0.0f))
+    {
+        if (numChecked == 0U)
+        {
+            printf("  capture shorter than the %u frame warm-up\n", warmup);
+            return -1;
+        }
+        printf("  breathing %.1f/min: %u of %u frames within %.1f/min, mean error %.2f/min\n",
+               cap.breathingRate, numBreathGood, numChecked, CHECK_BREATHING_TOL, breathErr / numChecked);
+        printf("  heart %.1f/min: %u of %u frames within %.1f/min, mean error %.2f/min\n",
+               cap.heartRate, numHeartGood, numChecked, CHECK_HEART_TOL, heartErr / numChecked);
+        if ((numBreathGood < CHECK_MIN_GOOD_RATIO * numChecked) || (numHeartGood < CHECK_MIN_GOOD_RATIO * numChecked))
+        {
+            fail = 1;
+        }
+    }
+    else
+    {
+        printf("  no reference rates, last estimate breathing %.1f/min (%s), heart %.1f/min (%s)\n",
+               features.breathingFeatures.breathingRate, features.breathingFeatures.isValid ? "valid" : "invalid",
+               features.heartRateFeatures.heartRate, features.heartRateFeatures.isValid ? "valid" : "invalid");
+    }
+
+    return fail ? -1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    int i, numFail = 0;
+
+    if (argc < 2)
+    {
+        printf("Usage: %s capture.vscp...\n", argv[0]);
+        return 2;
+    }
+    for (i = 1; i < argc; i++)
+    {
+        if (Check_capture(argv[i]) != 0)
+        {
+            numFail++;
+        }
+    }
+    printf("%s: %d of %d captures failed\n", numFail ? "FAIL" : "PASS", numFail, argc - 1);
+    return numFail ? 1 : 0;
+}
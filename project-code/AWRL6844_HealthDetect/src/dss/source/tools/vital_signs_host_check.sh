@@ -0,0 +1,59 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Host check of the vital signs module on radar cube captures
+#
+#   vital_signs_host_check.sh [capture.vscp...]
+#
+# Without arguments: the synthetic captures of vital_signs_capture.py, with known breathing and heart rates. Recorded
+# captures converted to the same format are given as arguments; the rates are checked when the capture header has
+# them. The host time per frame is printed next to the C66x frame budget, the target cycles are in the DSS statistics.
+#
+# Needs a host C compiler (CC, default cc), and python3 with numpy for the synthetic captures.
+# BUILD_DIR defaults to ./vital_signs_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../../.."
+BUILD_DIR=${BUILD_DIR:-./vital_signs_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+$CC -O2 -Wall -Werror -std=gnu99 -I "$TOOLS_DIR/.." -I "$SRC_DIR" \
+    -o "$BUILD_DIR/vital_signs_host_check" "$TOOLS_DIR/vital_signs_host_check.c" "$TOOLS_DIR/../vital_signs.c" -lm
+
+if [ $# -eq 0 ]; then
+    python3 "$TOOLS_DIR/vital_signs_capture.py" --out-dir "$BUILD_DIR/captures"
+    set -- "$BUILD_DIR"/captures/*.vscp
+fi
+"$BUILD_DIR/vital_signs_host_check" "$@"
@@ -0,0 +1,731 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file vital_signs.c
+ * @brief Streaming Vital Signs Module Implementation
+ *
+ * Reference: New functionality for Health Detection project
+ * Adapted for: Health Detection three-layer architecture - DSS Layer
+ *
+ * The rate of a band is the peak of the DFT of its filtered window on a
+ * grid of frequencies. For a grid frequency w the DFT of the window ending
+ * at sample n is kept as
+ *
+ *     X(n) = sum_{m=n-N+1..n} x(m) exp(-jwm)
+ *
+ * so a new frame costs one complex rotation and two multiply-adds per grid
+ * point: X(n) = X(n-1) + x(n) exp(-jwn) - x(n-N) exp(-jw(n-N)). The grid is
+ * not tied to the 1/N bins of an FFT, it zooms on the band with any step.
+ * Rounding errors of the recursion are cleared by recomputing the DFT from
+ * the ring once per window.
+ *
+ * Created: 2026-01-08
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _TMS320C6X
+/* SDK DPL */
+#include <kernel/dpl/DebugP.h>
+#include "dsp_utils.h"
+#else
+#include <stdio.h>
+#include <time.h>
+#endif
+
+/* Module Header */
+#include "vital_signs.h"
+
+/**************************************************************************
+ *************************** Local Definitions ****************************
+ **************************************************************************/
+
+#ifdef _TMS320C6X
+#define VITAL_SIGNS_CYCLES()    DSPUtils_getCycleCount()
+#else
+/* Host build, for recorded captures: the monotonic clock in ns stands in for the cycle counter */
+#define DebugP_log              printf
+#define VITAL_SIGNS_CYCLES()    VitalSigns_hostNs()
+
+static uint32_t VitalSigns_hostNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec);
+}
+#endif
+
+#define PI_F        (3.14159265358979f)
+
+/* Small value to avoid division by zero */
+#define EPSILON     (1e-12f)
+
+/* Q of the two sections of a 4th-order Butterworth filter */
+#define VITAL_SIGNS_BUTTER4_Q0  (0.54119610f)
+#define VITAL_SIGNS_BUTTER4_Q1  (1.30656296f)
+
+/* Band edges must stay below this fraction of the frame rate */
+#define VITAL_SIGNS_MAX_FREQ_RATIO  (0.45f)
+
+/* Minimum window length in frames */
+#define VITAL_SIGNS_MIN_WINDOW      (8U)
+
+/* Breathing harmonics checked against the heart peak */
+#define VITAL_SIGNS_MAX_HARMONIC    (6U)
+
+/**************************************************************************
+ *************************** Local Functions ******************************
+ **************************************************************************/
+
+/**
+ * @brief Design a 2nd-order Butterworth section (bilinear transform)
+ */
+static void VitalSigns_biquadDesign(VitalSigns_Biquad_t *bq, uint8_t isHighPass,
+                                    float f0_Hz, float q, float fs_Hz)
+{
+    float w0 = 2.0f * PI_F * f0_Hz / fs_Hz;
+    float cosW = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+
+    if (isHighPass)
+    {
+        bq->b0 = 0.5f * (1.0f + cosW) / a0;
+        bq->b1 = -(1.0f + cosW) / a0;
+    }
+    else
+    {
+        bq->b0 = 0.5f * (1.0f - cosW) / a0;
+        bq->b1 = (1.0f - cosW) / a0;
+    }
+    bq->b2 = bq->b0;
+    bq->a1 = -2.0f * cosW / a0;
+    bq->a2 = (1.0f - alpha) / a0;
+    bq->z1 = 0.0f;
+    bq->z2 = 0.0f;
+}
+
+/**
+ * @brief Run one sample through a biquad cascade
+ */
+static inline float VitalSigns_cascadeRun(VitalSigns_Biquad_t *bq, float x)
+{
+    uint32_t i;
+    float y;
+
+    for (i = 0; i < VITAL_SIGNS_NUM_BIQUADS; i++)
+    {
+        y = bq[i].b0 * x + bq[i].z1;
+        bq[i].z1 = bq[i].b1 * x - bq[i].a1 * y + bq[i].z2;
+        bq[i].z2 = bq[i].b2 * x - bq[i].a2 * y;
+        x = y;
+    }
+
+    return x;
+}
+
+/**
+ * @brief Clear the history of a band, keeps the design
+ */
+static void VitalSigns_bandReset(VitalSigns_Band_t *band)
+{
+    uint32_t i;
+
+    for (i = 0; i < VITAL_SIGNS_NUM_BIQUADS; i++)
+    {
+        band->biquad[i].z1 = 0.0f;
+        band->biquad[i].z2 = 0.0f;
+    }
+
+    memset(band->ring, 0, sizeof(band->ring));
+    memset(band->accRe, 0, sizeof(band->accRe));
+    memset(band->accIm, 0, sizeof(band->accIm));
+    for (i = 0; i < band->numGrid; i++)
+    {
+        band->rotRe[i] = 1.0f;
+        band->rotIm[i] = 0.0f;
+    }
+
+    band->writeIdx = 0;
+    band->fill = 0;
+    band->energy = 0.0f;
+    band->rateMean = 0.0f;
+    band->rateVar = 0.0f;
+    band->rateInit = 0;
+}
+
+/**
+ * @brief Design the filters and the frequency grid of a band
+ *
+ * @return 0 on success, -2 if the band does not fit the frame rate or limits
+ */
+static int32_t VitalSigns_bandInit(VitalSigns_Band_t *band,
+                                   const VitalSigns_BandConfig_t *cfg, float fs_Hz)
+{
+    uint32_t i;
+    float windowLen;
+    float numGrid;
+    float w;
+
+    if ((cfg->freqLow_Hz <= 0.0f) || (cfg->freqHigh_Hz <= cfg->freqLow_Hz) ||
+        (cfg->freqHigh_Hz >= VITAL_SIGNS_MAX_FREQ_RATIO * fs_Hz) ||
+        (cfg->gridStep_Hz <= 0.0f))
+    {
+        return -2;
+    }
+
+    windowLen = cfg->windowLen_s * fs_Hz + 0.5f;
+    numGrid = (cfg->freqHigh_Hz - cfg->freqLow_Hz) / cfg->gridStep_Hz + 1.5f;
+    if ((windowLen < (float)VITAL_SIGNS_MIN_WINDOW) || (windowLen >= (float)(VITAL_SIGNS_MAX_WINDOW + 1U)) ||
+        (numGrid >= (float)(VITAL_SIGNS_MAX_GRID + 1U)))
+    {
+        return -2;
+    }
+    band->windowLen = (uint16_t)windowLen;
+    band->numGrid = (uint16_t)numGrid;
+
+    VitalSigns_biquadDesign(&band->biquad[0], 1, cfg->freqLow_Hz, VITAL_SIGNS_BUTTER4_Q0, fs_Hz);
+    VitalSigns_biquadDesign(&band->biquad[1], 1, cfg->freqLow_Hz, VITAL_SIGNS_BUTTER4_Q1, fs_Hz);
+    VitalSigns_biquadDesign(&band->biquad[2], 0, cfg->freqHigh_Hz, VITAL_SIGNS_BUTTER4_Q0, fs_Hz);
+    VitalSigns_biquadDesign(&band->biquad[3], 0, cfg->freqHigh_Hz, VITAL_SIGNS_BUTTER4_Q1, fs_Hz);
+
+    for (i = 0; i < band->numGrid; i++)
+    {
+        band->gridFreq_Hz[i] = cfg->freqLow_Hz + (float)i * cfg->gridStep_Hz;
+        w = 2.0f * PI_F * band->gridFreq_Hz[i] / fs_Hz;
+        band->stepRe[i] = cosf(w);
+        band->stepIm[i] = -sinf(w);
+        band->wrapRe[i] = cosf(w * (float)band->windowLen);
+        band->wrapIm[i] = sinf(w * (float)band->windowLen);
+    }
+
+    VitalSigns_bandReset(band);
+
+    return 0;
+}
+
+/**
+ * @brief Recompute the DFT of a full window from the ring
+ *
+ * Called when the ring wraps: the oldest sample is ring[0] and becomes the
+ * time origin, the next sample is at n = N.
+ */
+static void VitalSigns_bandResync(VitalSigns_Band_t *band)
+{
+    uint32_t i, m;
+    float pRe, pIm, tmp, sumRe, sumIm;
+    float energy = 0.0f;
+
+    for (m = 0; m < band->windowLen; m++)
+    {
+        energy += band->ring[m] * band->ring[m];
+    }
+    band->energy = energy;
+
+    for (i = 0; i < band->numGrid; i++)
+    {
+        pRe = 1.0f;
+        pIm = 0.0f;
+        sumRe = 0.0f;
+        sumIm = 0.0f;
+        for (m = 0; m < band->windowLen; m++)
+        {
+            sumRe += band->ring[m] * pRe;
+            sumIm += band->ring[m] * pIm;
+            tmp = pRe * band->stepRe[i] - pIm * band->stepIm[i];
+            pIm = pRe * band->stepIm[i] + pIm * band->stepRe[i];
+            pRe = tmp;
+        }
+        band->accRe[i] = sumRe;
+        band->accIm[i] = sumIm;
+
+        /* exp(-jwN) */
+        band->rotRe[i] = band->wrapRe[i];
+        band->rotIm[i] = -band->wrapIm[i];
+    }
+}
+
+/**
+ * @brief Add one filtered sample to the window of a band
+ */
+static void VitalSigns_bandUpdate(VitalSigns_Band_t *band, float x)
+{
+    uint32_t i;
+    float old, rRe, rIm, oRe, oIm, g;
+
+    /* Zero until the window is full */
+    old = band->ring[band->writeIdx];
+    band->ring[band->writeIdx] = x;
+    band->energy += x * x - old * old;
+
+    for (i = 0; i < band->numGrid; i++)
+    {
+        rRe = band->rotRe[i];
+        rIm = band->rotIm[i];
+
+        /* exp(-jw(n-N)) = exp(-jwn) exp(+jwN) */
+        oRe = rRe * band->wrapRe[i] - rIm * band->wrapIm[i];
+        oIm = rRe * band->wrapIm[i] + rIm * band->wrapRe[i];
+
+        band->accRe[i] += x * rRe - old * oRe;
+        band->accIm[i] += x * rIm - old * oIm;
+
+        /* Next rotation, renormalized to unit magnitude */
+        oRe = rRe * band->stepRe[i] - rIm * band->stepIm[i];
+        oIm = rRe * band->stepIm[i] + rIm * band->stepRe[i];
+        g = 1.5f - 0.5f * (oRe * oRe + oIm * oIm);
+        band->rotRe[i] = oRe * g;
+        band->rotIm[i] = oIm * g;
+    }
+
+    band->writeIdx++;
+    if (band->fill < band->windowLen)
+    {
+        band->fill++;
+    }
+    if (band->writeIdx == band->windowLen)
+    {
+        band->writeIdx = 0;
+        VitalSigns_bandResync(band);
+    }
+}
+
+/**
+ * @brief Find the rate of a band
+ *
+ * Peak of the grid power, refined with a parabola through its neighbours.
+ * Grid points within harmonicTol_Hz of a multiple (2 and up) of
+ * harmonicBase_Hz are skipped, 0 disables the check.
+ *
+ * @return Peak grid index, -1 if the window is empty
+ */
+static int32_t VitalSigns_bandPeak(const VitalSigns_Band_t *band, float gridStep_Hz,
+                                   float harmonicBase_Hz, float harmonicTol_Hz,
+                                   float *freq_Hz, float *peakPow)
+{
+    uint32_t i, h;
+    int32_t peakIdx = -1;
+    float pow, best = 0.0f;
+    float pPrev, pNext, denom, delta;
+
+    for (i = 0; i < band->numGrid; i++)
+    {
+        if (harmonicBase_Hz > 0.0f)
+        {
+            for (h = 2; h <= VITAL_SIGNS_MAX_HARMONIC; h++)
+            {
+                if (fabsf(band->gridFreq_Hz[i] - (float)h * harmonicBase_Hz) < harmonicTol_Hz)
+                {
+                    break;
+                }
+            }
+            if (h <= VITAL_SIGNS_MAX_HARMONIC)
+            {
+                continue;
+            }
+        }
+
+        pow = band->accRe[i] * band->accRe[i] + band->accIm[i] * band->accIm[i];
+        if (pow > best)
+        {
+            best = pow;
+            peakIdx = (int32_t)i;
+        }
+    }
+
+    if (peakIdx < 0)
+    {
+        return -1;
+    }
+
+    *freq_Hz = band->gridFreq_Hz[peakIdx];
+    *peakPow = best;
+    if ((peakIdx > 0) && (peakIdx < (int32_t)band->numGrid - 1))
+    {
+        pPrev = band->accRe[peakIdx - 1] * band->accRe[peakIdx - 1] + band->accIm[peakIdx - 1] * band->accIm[peakIdx - 1];
+        pNext = band->accRe[peakIdx + 1] * band->accRe[peakIdx + 1] + band->accIm[peakIdx + 1] * band->accIm[peakIdx + 1];
+        denom = pPrev - 2.0f * best + pNext;
+        if (denom < -EPSILON)
+        {
+            delta = 0.5f * (pPrev - pNext) / denom;
+            if (delta > 0.5f) delta = 0.5f;
+            if (delta < -0.5f) delta = -0.5f;
+            *freq_Hz += delta * gridStep_Hz;
+        }
+    }
+
+    return peakIdx;
+}
+
+/**
+ * @brief Estimate the rate of a band
+ *
+ * The confidence is the fraction of the window energy in the peak tone,
+ * 2|X|^2 / (N sum x^2), 1 for a pure sinusoid on the grid.
+ *
+ * @return 1 if the estimate is valid
+ */
+static uint8_t VitalSigns_bandEstimate(VitalSigns_Band_t *band, const VitalSigns_BandConfig_t *cfg,
+                                       float rateAlpha, float harmonicBase_Hz, float harmonicTol_Hz,
+                                       float *freq_Hz, float *amplitude, float *confidence)
+{
+    float peakPow = 0.0f;
+    float n = (float)band->fill;
+    float d;
+    uint8_t isValid = 0;
+
+    *freq_Hz = 0.0f;
+    *amplitude = 0.0f;
+    *confidence = 0.0f;
+
+    if ((band->fill == 0) ||
+        (VitalSigns_bandPeak(band, cfg->gridStep_Hz, harmonicBase_Hz, harmonicTol_Hz, freq_Hz, &peakPow) < 0))
+    {
+        return 0;
+    }
+
+    *amplitude = 2.0f * sqrtf(peakPow) / n;
+    *confidence = 2.0f * peakPow / (n * band->energy + EPSILON);
+    if (*confidence > 1.0f)
+    {
+        *confidence = 1.0f;
+    }
+
+    if ((band->fill == band->windowLen) && (*confidence >= cfg->minConfidence))
+    {
+        isValid = 1;
+
+        /* Rate variability, exponentially weighted */
+        if (!band->rateInit)
+        {
+            band->rateMean = *freq_Hz;
+            band->rateVar = 0.0f;
+            band->rateInit = 1;
+        }
+        else
+        {
+            d = *freq_Hz - band->rateMean;
+            band->rateMean += rateAlpha * d;
+            band->rateVar = (1.0f - rateAlpha) * (band->rateVar + rateAlpha * d * d);
+        }
+    }
+
+    return isValid;
+}
+
+/**
+ * @brief Slow-time sample of a range bin, mean over the chirps
+ */
+static void VitalSigns_getSample(const VitalSigns_Input_t *input, uint32_t rangeBin,
+                                 float *re, float *im)
+{
+    const VitalSigns_Cmplx16_t *ptr = &input->radarCube[rangeBin * input->rangeBinStride];
+    int32_t sumRe = 0, sumIm = 0;
+    uint32_t c;
+
+    for (c = 0; c < input->numChirps; c++)
+    {
+        sumRe += ptr->real;
+        sumIm += ptr->imag;
+        ptr += input->chirpStride;
+    }
+
+    *re = (float)sumRe / (float)input->numChirps;
+    *im = (float)sumIm / (float)input->numChirps;
+}
+
+/**
+ * @brief Restart the slow-time history on a new range bin
+ */
+static void VitalSigns_restart(VitalSigns_Handle_t *handle)
+{
+    VitalSigns_bandReset(&handle->breathing);
+    VitalSigns_bandReset(&handle->heart);
+    handle->unwrappedPhase = 0.0f;
+    handle->prevPhase = 0.0f;
+}
+
+/**************************************************************************
+ *************************** API Functions ********************************
+ **************************************************************************/
+
+void VitalSigns_getDefaultConfig(VitalSigns_Config_t *config)
+{
+    if (config == NULL)
+    {
+        return;
+    }
+
+    config->frameRate_Hz = 10.0f;           /* 100ms frame period */
+    config->wavelength_mm = 4.96f;          /* 60.5GHz */
+    config->rangeBinMin = 2;
+    config->rangeBinMax = 40;
+    config->binSwitchRatio = 2.0f;
+    config->scoreAlpha = 0.05f;
+    config->rateAlpha = 0.05f;
+    config->harmonicTol_Hz = 0.05f;
+
+    config->breathing.freqLow_Hz = 0.1f;    /* 6 breaths/min */
+    config->breathing.freqHigh_Hz = 0.5f;   /* 30 breaths/min */
+    config->breathing.gridStep_Hz = 0.01f;
+    config->breathing.windowLen_s = 25.6f;
+    config->breathing.minConfidence = 0.3f;
+
+    config->heart.freqLow_Hz = 0.8f;        /* 48 bpm */
+    config->heart.freqHigh_Hz = 2.0f;       /* 120 bpm */
+    config->heart.gridStep_Hz = 0.02f;
+    config->heart.windowLen_s = 12.8f;
+    config->heart.minConfidence = 0.1f;
+}
+
+int32_t VitalSigns_init(VitalSigns_Handle_t *handle,
+                        const VitalSigns_Config_t *config)
+{
+    int32_t status;
+
+    if (handle == NULL)
+    {
+        return -1;
+    }
+
+    /* Clear handle */
+    memset(handle, 0, sizeof(VitalSigns_Handle_t));
+
+    /* Set configuration */
+    if (config != NULL)
+    {
+        memcpy(&handle->config, config, sizeof(VitalSigns_Config_t));
+    }
+    else
+    {
+        VitalSigns_getDefaultConfig(&handle->config);
+    }
+
+    if ((handle->config.frameRate_Hz <= 0.0f) ||
+        (handle->config.rangeBinMax < handle->config.rangeBinMin) ||
+        ((uint32_t)(handle->config.rangeBinMax - handle->config.rangeBinMin) >= VITAL_SIGNS_MAX_RANGE_BINS))
+    {
+        return -1;
+    }
+
+    status = VitalSigns_bandInit(&handle->breathing, &handle->config.breathing, handle->config.frameRate_Hz);
+    if (status == 0)
+    {
+        status = VitalSigns_bandInit(&handle->heart, &handle->config.heart, handle->config.frameRate_Hz);
+    }
+    if (status != 0)
+    {
+        return status;
+    }
+
+    handle->trackedBin = VITAL_SIGNS_INVALID_BIN;
+    handle->output.trackedRangeBin = VITAL_SIGNS_INVALID_BIN;
+    handle->isInitialized = 1;
+
+    DebugP_log("[VitalSigns] Initialized at %.1f Hz, windows %d/%d frames\r\n",
+               handle->config.frameRate_Hz, handle->breathing.windowLen, handle->heart.windowLen);
+
+    return 0;
+}
+
+int32_t VitalSigns_process(VitalSigns_Handle_t *handle,
+                           const VitalSigns_Input_t *input,
+                           HealthDetect_Features_t *features)
+{
+    VitalSigns_Config_t *cfg;
+    VitalSigns_Output_t *out;
+    uint32_t startCycles;
+    uint32_t r, rMax, bestBin;
+    float re, im, dRe, dIm, bestScore;
+    float trackedRe = 0.0f, trackedIm = 0.0f;
+    float phase, dPhase;
+    float freq, amplitude, confidence, breathFreq;
+
+    if ((handle == NULL) || (!handle->isInitialized) || (input == NULL) ||
+        (input->radarCube == NULL) || (input->numChirps == 0))
+    {
+        return -1;
+    }
+
+    cfg = &handle->config;
+    out = &handle->output;
+
+    if (cfg->rangeBinMin >= input->numRangeBins)
+    {
+        return -2;
+    }
+
+    startCycles = VITAL_SIGNS_CYCLES();
+
+    /* Score the range bins on their slow-time variation */
+    rMax = cfg->rangeBinMax;
+    if (rMax >= input->numRangeBins)
+    {
+        rMax = input->numRangeBins - 1U;
+    }
+    bestBin = cfg->rangeBinMin;
+    bestScore = -1.0f;
+    for (r = cfg->rangeBinMin; r <= rMax; r++)
+    {
+        uint32_t idx = r - cfg->rangeBinMin;
+
+        VitalSigns_getSample(input, r, &re, &im);
+        if (handle->frameCount > 0)
+        {
+            dRe = re - handle->prevRe[idx];
+            dIm = im - handle->prevIm[idx];
+            handle->score[idx] += cfg->scoreAlpha * (dRe * dRe + dIm * dIm - handle->score[idx]);
+        }
+        handle->prevRe[idx] = re;
+        handle->prevIm[idx] = im;
+
+        if (handle->score[idx] > bestScore)
+        {
+            bestScore = handle->score[idx];
+            bestBin = r;
+        }
+        if (r == handle->trackedBin)
+        {
+            trackedRe = re;
+            trackedIm = im;
+        }
+    }
+
+    if (handle->frameCount == 0)
+    {
+        /* No slow-time variation yet */
+        handle->frameCount++;
+        out->processingCycles = VITAL_SIGNS_CYCLES() - startCycles;
+        return 0;
+    }
+
+    /* Move to a new bin only when it clearly dominates the tracked one */
+    if ((handle->trackedBin == VITAL_SIGNS_INVALID_BIN) || (handle->trackedBin > rMax) ||
+        (bestScore > cfg->binSwitchRatio * handle->score[handle->trackedBin - cfg->rangeBinMin]))
+    {
+        handle->trackedBin = (uint16_t)bestBin;
+        trackedRe = handle->prevRe[bestBin - cfg->rangeBinMin];
+        trackedIm = handle->prevIm[bestBin - cfg->rangeBinMin];
+        VitalSigns_restart(handle);
+        handle->prevPhase = atan2f(trackedIm, trackedRe);
+    }
+
+    /* Unwrap the phase against the previous frame */
+    phase = atan2f(trackedIm, trackedRe);
+    dPhase = phase - handle->prevPhase;
+    if (dPhase > PI_F)
+    {
+        dPhase -= 2.0f * PI_F;
+    }
+    else if (dPhase < -PI_F)
+    {
+        dPhase += 2.0f * PI_F;
+    }
+    handle->unwrappedPhase += dPhase;
+    handle->prevPhase = phase;
+
+    /* Band-pass and slide the windows */
+    VitalSigns_bandUpdate(&handle->breathing, VitalSigns_cascadeRun(handle->breathing.biquad, handle->unwrappedPhase));
+    VitalSigns_bandUpdate(&handle->heart, VitalSigns_cascadeRun(handle->heart.biquad, handle->unwrappedPhase));
+
+    /* Breathing */
+    out->breathing.isValid = VitalSigns_bandEstimate(&handle->breathing, &cfg->breathing, cfg->rateAlpha,
+                                                     0.0f, 0.0f, &freq, &amplitude, &confidence);
+    breathFreq = out->breathing.isValid ? freq : 0.0f;
+    out->breathing.breathingRate = freq * 60.0f;
+    /* Peak to peak chest displacement, the phase is 4 pi d / lambda */
+    out->breathing.breathingDepth = amplitude * cfg->wavelength_mm / (2.0f * PI_F);
+    out->breathing.breathingVariability = sqrtf(handle->breathing.rateVar) * 60.0f;
+    out->breathing.peakPower = 0.5f * amplitude * amplitude;
+    out->breathing.confidence = confidence;
+
+    /* Heart rate, away from the breathing harmonics */
+    out->heartRate.isValid = VitalSigns_bandEstimate(&handle->heart, &cfg->heart, cfg->rateAlpha,
+                                                     breathFreq, cfg->harmonicTol_Hz,
+                                                     &freq, &amplitude, &confidence);
+    out->heartRate.heartRate = freq * 60.0f;
+    out->heartRate.heartRateVariability = sqrtf(handle->heart.rateVar) * 60.0f;
+    out->heartRate.peakPower = 0.5f * amplitude * amplitude;
+    out->heartRate.confidence = confidence;
+
+    out->trackedRangeBin = handle->trackedBin;
+    handle->frameCount++;
+    out->processingCycles = VITAL_SIGNS_CYCLES() - startCycles;
+
+    if (features != NULL)
+    {
+        memcpy(&features->breathingFeatures, &out->breathing, sizeof(BreathingFeatures_t));
+        memcpy(&features->heartRateFeatures, &out->heartRate, sizeof(HeartRateFeatures_t));
+    }
+
+    return 0;
+}
+
+int32_t VitalSigns_getOutput(const VitalSigns_Handle_t *handle,
+                             VitalSigns_Output_t *output)
+{
+    if ((handle == NULL) || (output == NULL))
+    {
+        return -1;
+    }
+
+    memcpy(output, &handle->output, sizeof(VitalSigns_Output_t));
+
+    return 0;
+}
+
+int32_t VitalSigns_reset(VitalSigns_Handle_t *handle)
+{
+    if ((handle == NULL) || (!handle->isInitialized))
+    {
+        return -1;
+    }
+
+    VitalSigns_restart(handle);
+    memset(handle->prevRe, 0, sizeof(handle->prevRe));
+    memset(handle->prevIm, 0, sizeof(handle->prevIm));
+    memset(handle->score, 0, sizeof(handle->score));
+    memset(&handle->output, 0, sizeof(VitalSigns_Output_t));
+    handle->trackedBin = VITAL_SIGNS_INVALID_BIN;
+    handle->output.trackedRangeBin = VITAL_SIGNS_INVALID_BIN;
+    handle->frameCount = 0;
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * @file vital_signs.h
+ * @brief Streaming Vital Signs Module Header
+ *
+ * Reference: New functionality for Health Detection project
+ * Adapted for: Health Detection three-layer architecture - DSS Layer
+ *
+ * RTOS: FreeRTOS (L-SDK mandatory)
+ * Note: L-SDK uses FreeRTOS, NOT TI-RTOS/BIOS
+ *
+ * This module estimates breathing and heart rate from the slow-time phase
+ * of one tracked range bin. All the processing is incremental, the cost of
+ * a frame does not depend on the length of the observation window:
+ *
+ *  - Range bin tracking: the bin with the strongest slow-time variation in
+ *    the configured range window is tracked, with hysteresis
+ *  - Phase unwrapping: the phase of the tracked bin is unwrapped against the
+ *    previous frame, one atan2 per frame
+ *  - Band-pass filtering: a 4th-order Butterworth high-pass and low-pass
+ *    biquad cascade per band, breathing (0.1-0.5 Hz) and heart (0.8-2 Hz)
+ *  - Rate estimation: a sliding DFT evaluated on a zoomed frequency grid
+ *    over each band, updated with the new sample and the sample leaving
+ *    the window instead of a full FFT over the history
+ *
+ * The module has no SDK dependency outside of the DSP build, so it can be
+ * compiled on the host and run against recorded captures.
+ *
+ * Created: 2026-01-08
+ */
+
+#ifndef VITAL_SIGNS_H
+#define VITAL_SIGNS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include "common/health_detect_types.h"
+
+/**************************************************************************
+ *************************** Macros ***************************************
+ **************************************************************************/
+
+/** Maximum slow-time window length in frames */
+#define VITAL_SIGNS_MAX_WINDOW              (512U)
+
+/** Maximum number of frequency grid points per band */
+#define VITAL_SIGNS_MAX_GRID                (64U)
+
+/** Maximum number of range bins in the tracking window */
+#define VITAL_SIGNS_MAX_RANGE_BINS          (64U)
+
+/** Number of biquad sections per band (4th-order high-pass + 4th-order low-pass) */
+#define VITAL_SIGNS_NUM_BIQUADS             (4U)
+
+/** Tracked range bin before the first frame */
+#define VITAL_SIGNS_INVALID_BIN             (0xFFFFU)
+
+/**************************************************************************
+ *************************** Type Definitions *****************************
+ **************************************************************************/
+
+/**
+ * @brief Radar cube sample, same layout as the range FFT output (cmplx16ImRe_t)
+ */
+typedef struct VitalSigns_Cmplx16_t
+{
+    int16_t     imag;               /**< Imaginary part */
+    int16_t     real;               /**< Real part */
+} VitalSigns_Cmplx16_t;
+
+/**
+ * @brief Band Configuration
+ */
+typedef struct VitalSigns_BandConfig_t
+{
+    float       freqLow_Hz;             /**< Band-pass lower cut-off */
+    float       freqHigh_Hz;            /**< Band-pass upper cut-off */
+    float       gridStep_Hz;            /**< Frequency grid step of the rate search */
+    float       windowLen_s;            /**< Slow-time window length */
+    float       minConfidence;          /**< Minimum confidence for a valid estimate */
+} VitalSigns_BandConfig_t;
+
+/**
+ * @brief Vital Signs Configuration
+ */
+typedef struct VitalSigns_Config_t
+{
+    float       frameRate_Hz;           /**< Frame rate, slow-time sampling rate */
+    float       wavelength_mm;          /**< Carrier wavelength, for the breathing depth */
+    uint16_t    rangeBinMin;            /**< First range bin of the tracking window */
+    uint16_t    rangeBinMax;            /**< Last range bin of the tracking window */
+    float       binSwitchRatio;         /**< Score ratio for the tracked bin to move */
+    float       scoreAlpha;             /**< Smoothing of the range bin scores */
+    float       rateAlpha;              /**< Smoothing of the rate variability */
+    float       harmonicTol_Hz;         /**< Heart peaks this close to a breathing harmonic are rejected */
+    VitalSigns_BandConfig_t breathing;  /**< Breathing band */
+    VitalSigns_BandConfig_t heart;      /**< Heart band */
+} VitalSigns_Config_t;
+
+/**
+ * @brief Frame Input
+ * Slow-time sample of range bin r: mean over numChirps of
+ * radarCube[r * rangeBinStride + c * chirpStride], c = 0..numChirps-1
+ */
+typedef struct VitalSigns_Input_t
+{
+    const VitalSigns_Cmplx16_t *radarCube;  /**< Radar cube, first virtual antenna */
+    uint32_t    rangeBinStride;         /**< Samples between two range bins */
+    uint32_t    chirpStride;            /**< Samples between two chirps of a range bin */
+    uint16_t    numChirps;              /**< Chirps averaged into one slow-time sample */
+    uint16_t    numRangeBins;           /**< Number of range bins in the cube */
+} VitalSigns_Input_t;
+
+/**
+ * @brief Second-order section, transposed direct form II
+ */
+typedef struct VitalSigns_Biquad_t
+{
+    float       b0, b1, b2;             /**< Numerator */
+    float       a1, a2;                 /**< Denominator, a0 = 1 */
+    float       z1, z2;                 /**< State */
+} VitalSigns_Biquad_t;
+
+/**
+ * @brief Band State
+ * Filtered slow-time ring and sliding DFT of the band
+ */
+typedef struct VitalSigns_Band_t
+{
+    VitalSigns_Biquad_t biquad[VITAL_SIGNS_NUM_BIQUADS]; /**< Band-pass cascade */
+    float       ring[VITAL_SIGNS_MAX_WINDOW];   /**< Filtered samples of the window */
+    uint16_t    windowLen;              /**< Window length in frames */
+    uint16_t    writeIdx;               /**< Ring position of the next sample */
+    uint16_t    fill;                   /**< Number of samples in the window */
+    uint16_t    numGrid;                /**< Number of frequency grid points */
+    float       energy;                 /**< Sum of squares over the window */
+    float       gridFreq_Hz[VITAL_SIGNS_MAX_GRID]; /**< Grid frequencies */
+    float       stepRe[VITAL_SIGNS_MAX_GRID];   /**< exp(-jw), per frame rotation */
+    float       stepIm[VITAL_SIGNS_MAX_GRID];
+    float       wrapRe[VITAL_SIGNS_MAX_GRID];   /**< exp(+jwN), rotation of the leaving sample */
+    float       wrapIm[VITAL_SIGNS_MAX_GRID];
+    float       rotRe[VITAL_SIGNS_MAX_GRID];    /**< exp(-jwn) at the next sample */
+    float       rotIm[VITAL_SIGNS_MAX_GRID];
+    float       accRe[VITAL_SIGNS_MAX_GRID];    /**< DFT of the window */
+    float       accIm[VITAL_SIGNS_MAX_GRID];
+    float       rateMean;               /**< Smoothed rate, Hz */
+    float       rateVar;                /**< Smoothed rate variance, Hz^2 */
+    uint8_t     rateInit;               /**< Rate smoothing initialized */
+} VitalSigns_Band_t;
+
+/**
+ * @brief Vital Signs Output
+ */
+typedef struct VitalSigns_Output_t
+{
+    BreathingFeatures_t breathing;      /**< Breathing estimate */
+    HeartRateFeatures_t heartRate;      /**< Heart rate estimate */
+    uint16_t    trackedRangeBin;        /**< Tracked range bin */
+    uint32_t    processingCycles;       /**< DSP cycles of the last frame, ns on host builds */
+} VitalSigns_Output_t;
+
+/**
+ * @brief Vital Signs Handle (opaque)
+ */
+typedef struct VitalSigns_Handle_t
+{
+    VitalSigns_Config_t config;                 /**< Configuration */
+    VitalSigns_Output_t output;                 /**< Latest output */
+    VitalSigns_Band_t   breathing;              /**< Breathing band state */
+    VitalSigns_Band_t   heart;                  /**< Heart band state */
+    float       prevRe[VITAL_SIGNS_MAX_RANGE_BINS]; /**< Previous slow-time sample per range bin */
+    float       prevIm[VITAL_SIGNS_MAX_RANGE_BINS];
+    float       score[VITAL_SIGNS_MAX_RANGE_BINS];  /**< Smoothed slow-time variation per range bin */
+    uint16_t    trackedBin;                 /**< Tracked range bin */
+    float       prevPhase;                  /**< Wrapped phase of the previous frame */
+    float       unwrappedPhase;             /**< Unwrapped phase, relative to the first frame */
+    uint32_t    frameCount;                 /**< Frame counter */
+    uint8_t     isInitialized;              /**< Initialization flag */
+} VitalSigns_Handle_t;
+
+/**************************************************************************
+ *************************** Function Prototypes **************************
+ **************************************************************************/
+
+/**
+ * @brief Initialize vital signs module
+ *
+ * Designs the band-pass filters and the frequency grids for the configured
+ * frame rate.
+ *
+ * @param[out] handle   Pointer to handle structure
+ * @param[in]  config   Pointer to configuration (NULL for defaults)
+ *
+ * @return 0 on success, -1 on invalid argument, -2 if a band does not fit
+ *         the frame rate or the window and grid limits
+ */
+int32_t VitalSigns_init(VitalSigns_Handle_t *handle,
+                        const VitalSigns_Config_t *config);
+
+/**
+ * @brief Process one frame
+ *
+ * @param[in,out] handle     Vital signs handle
+ * @param[in]     input      Radar cube of the frame
+ * @param[out]    features   Breathing and heart rate features are written (can be NULL)
+ *
+ * @return 0 on success, negative on error
+ */
+int32_t VitalSigns_process(VitalSigns_Handle_t *handle,
+                           const VitalSigns_Input_t *input,
+                           HealthDetect_Features_t *features);
+
+/**
+ * @brief Get latest estimates
+ *
+ * @param[in]  handle   Vital signs handle
+ * @param[out] output   Pointer to output structure
+ *
+ * @return 0 on success, negative on error
+ */
+int32_t VitalSigns_getOutput(const VitalSigns_Handle_t *handle,
+                             VitalSigns_Output_t *output);
+
+/**
+ * @brief Reset slow-time history, filters and range bin tracking
+ *
+ * @param[in,out] handle   Vital signs handle
+ *
+ * @return 0 on success, negative on error
+ */
+int32_t VitalSigns_reset(VitalSigns_Handle_t *handle);
+
+/**
+ * @brief Get default configuration
+ *
+ * @param[out] config   Pointer to configuration structure to fill
+ */
+void VitalSigns_getDefaultConfig(VitalSigns_Config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VITAL_SIGNS_H */
@@ -143,6 +143,68 @@ static void HealthDetect_initDefaultConfig(void)
     gHealthDetectMCB.cliCfg.presenceCfg.snrThreshold_dB = 10.0f;
 }
 
+/**
+ * @brief Build the DSS subframe configuration
+ *
+ * The configuration is written to the shared DPC configuration buffer, where
+ * the DSS reads it on its configuration event: radar cube layout
+ * [rangeBin][chirp][virtualAntenna] in the shared radar cube buffer, and the
+ * frame period that sets the vital signs sampling rate and frame budget.
+ *
+ * @param[in] dpcCfg    DPC configuration
+ * @return 0 on success, -1 if the radar cube does not fit its buffer
+ */
+static int32_t HealthDetect_dssConfig(const DPC_Config_t *dpcCfg)
+{
+    SubFrame_Cfg_t *dssCfg = (SubFrame_Cfg_t *)SHARED_DPC_CONFIG_ADDR;
+    uint32_t cubeSize;
+
+    memset(dssCfg, 0, sizeof(SubFrame_Cfg_t));
+    dssCfg->numTxAntennas = dpcCfg->staticCfg.numTxAntennas;
+    dssCfg->numRxAntennas = dpcCfg->staticCfg.numRxAntennas;
+    dssCfg->numVirtualAntennas = (uint16_t)(dssCfg->numTxAntennas * dssCfg->numRxAntennas);
+    dssCfg->numRangeBins = dpcCfg->staticCfg.numRangeBins;
+    dssCfg->numAdcSamples = dpcCfg->staticCfg.profile.numAdcSamples;
+    dssCfg->numDopplerBins = dpcCfg->staticCfg.numDopplerBins;
+    dssCfg->numChirpsPerFrame = (uint16_t)(dpcCfg->staticCfg.frame.numChirpsPerFrame / dssCfg->numTxAntennas);
+    dssCfg->framePeriodMs = dpcCfg->staticCfg.frame.framePeriodMs;
+    dssCfg->chirpDurationUs = dpcCfg->staticCfg.profile.idleTimeUs + dpcCfg->staticCfg.profile.rampEndTimeUs;
+    dssCfg->staticCfg = dpcCfg->staticCfg;
+    dssCfg->dynamicCfg = dpcCfg->dynamicCfg;
+
+    /* Range FFT output, one cmplx16 sample per range bin, chirp and virtual antenna */
+    cubeSize = (uint32_t)dssCfg->numRangeBins * dssCfg->numChirpsPerFrame * dssCfg->numVirtualAntennas * 4U;
+    if (cubeSize > SHARED_RADAR_CUBE_SIZE)
+    {
+        DebugP_log("Error: Radar cube %u bytes, shared buffer %u bytes\r\n", cubeSize, SHARED_RADAR_CUBE_SIZE);
+        return -1;
+    }
+    dssCfg->radarCubeAddr = (void *)SHARED_RADAR_CUBE_ADDR;
+    dssCfg->radarCubeSize = cubeSize;
+    dssCfg->isValid = 1;
+
+    CacheP_wbInv((void *)dssCfg, sizeof(SubFrame_Cfg_t), CacheP_TYPE_ALL);
+
+    /* TODO: Send the configuration event with SHARED_DPC_CONFIG_ADDR to the DSS via IPC */
+
+    return 0;
+}
+
+/**
+ * @brief Number of enabled channels of a channel mask
+ */
+static uint8_t HealthDetect_numChannels(uint16_t channelEn)
+{
+    uint8_t num = 0;
+
+    while (channelEn != 0U)
+    {
+        num += (uint8_t)(channelEn & 1U);
+        channelEn >>= 1;
+    }
+    return num;
+}
+
 /**
  * @brief Create FreeRTOS tasks
  * @return 0 on success, error code on failure
@@ -348,6 +410,7 @@ int32_t HealthDetect_init(void)
 int32_t HealthDetect_sensorStart(void)
 {
     int32_t status = 0;
+    uint32_t rangeFftSize, dopplerFftSize;
 
     if (gHealthDetectMCB.isSensorStarted)
     {
@@ -374,6 +437,21 @@ int32_t HealthDetect_sensorStart(void)
     dpcCfg.dynamicCfg.cfarRangeCfg = gHealthDetectMCB.cliCfg.cfarRangeCfg;
     dpcCfg.dynamicCfg.cfarDopplerCfg = gHealthDetectMCB.cliCfg.cfarDopplerCfg;
     dpcCfg.dynamicCfg.aoaCfg = gHealthDetectMCB.cliCfg.aoaCfg;
+    dpcCfg.staticCfg.numTxAntennas = HealthDetect_numChannels(gHealthDetectMCB.cliCfg.txChannelEn);
+    dpcCfg.staticCfg.numRxAntennas = HealthDetect_numChannels(gHealthDetectMCB.cliCfg.rxChannelEn);
+    rangeFftSize = 1U;
+    while (rangeFftSize < dpcCfg.staticCfg.profile.numAdcSamples)
+    {
+        rangeFftSize <<= 1;
+    }
+    dpcCfg.staticCfg.numRangeBins = (uint16_t)(rangeFftSize / 2U);  /* Real ADC samples */
+    dopplerFftSize = 1U;
+    while ((dpcCfg.staticCfg.numTxAntennas > 0U) &&
+           (dopplerFftSize * dpcCfg.staticCfg.numTxAntennas < dpcCfg.staticCfg.frame.numChirpsPerFrame))
+    {
+        dopplerFftSize <<= 1;
+    }
+    dpcCfg.staticCfg.numDopplerBins = (uint16_t)dopplerFftSize;
     dpcCfg.isValid = 1;
 
     status = DPC_config(&dpcCfg);
@@ -383,6 +461,13 @@ int32_t HealthDetect_sensorStart(void)
         return status;
     }
 
+    /* Radar cube and frame period for the DSS */
+    if ((dpcCfg.staticCfg.numTxAntennas == 0U) || (HealthDetect_dssConfig(&dpcCfg) != 0))
+    {
+        DebugP_log("Error: DSS configuration failed\r\n");
+        return -1;
+    }
+
     /* Start radar */
     status = RadarControl_start();
     if (status != 0)
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <string.h>
+
+#include <kernel/dpl/HwiP.h>
+#include <common_mss_dss/dpc_trace/dpc_trace.h>
+
+#define DPC_TRACE_RING_INDEX_MASK   (DPC_TRACE_RING_NUM_EVENTS - 1U)
+
+/* Ring of the local core */
+DPC_Trace_Ring * volatile gDpcTraceRing = NULL;
+
+/**
+ *  @b Description
+ *  @n
+ *      Initializes a trace ring. Called by the MSS for all the rings before handing them over.
+ *
+ *  @param[in]  ring        Trace ring
+ *  @param[in]  coreId      Producer core, DPC_TRACE_CORE_xxx
+ *  @param[in]  enabled     0: events are dropped
+ */
+void DPC_Trace_ringInit(DPC_Trace_Ring *ring, uint32_t coreId, uint32_t enabled)
+{
+    memset((void *)ring, 0, sizeof(DPC_Trace_Ring));
+    ring->coreId        = coreId;
+    ring->timerFreqHz   = DPC_TRACE_TIMER_FREQ_HZ;
+    ring->enabled       = enabled;
+    ring->magic         = DPC_TRACE_RING_MAGIC;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Writes an event. Must only be called on the producer core of the ring.
+ *
+ *  @param[in]  ring        Trace ring, the call returns if NULL
+ *  @param[in]  id          DPC_TRACE_ID_xxx
+ *  @param[in]  type        DPC_TRACE_TYPE_xxx
+ *  @param[in]  timeStamp   Frame reference timer
+ *  @param[in]  arg         Event argument
+ */
+void DPC_Trace_write(DPC_Trace_Ring *ring, uint32_t id, uint32_t type, uint32_t timeStamp, uint32_t arg)
+{
+    DPC_Trace_Event *event;
+    uintptr_t key;
+
+    if ((ring == NULL) || (ring->enabled == 0U))
+    {
+        return;
+    }
+
+    key = HwiP_disable();
+
+    event = &ring->event[ring->writeCount & DPC_TRACE_RING_INDEX_MASK];
+    event->timeStamp    = timeStamp;
+    event->id           = (uint16_t) id;
+    event->type         = (uint8_t) type;
+    event->coreId       = (uint8_t) ring->coreId;
+    event->frameNum     = ring->frameNum;
+    event->arg          = arg;
+
+    /* Publish the slot */
+    ring->writeCount    = ring->writeCount + 1U;
+
+    HwiP_restore(key);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Copies the events written since the last read. Runs concurrently with the producer: events overwritten
+ *      before or during the copy are counted as lost.
+ *
+ *  @param[in]      ring        Trace ring
+ *  @param[in,out]  readCount   Reader position, in events since the ring init
+ *  @param[out]     dst         Destination
+ *  @param[in]      maxEvents   Size of the destination, in events
+ *  @param[out]     numLost     Number of events lost since the last read
+ *
+ *  @retval
+ *      Number of events copied
+ */
+uint32_t DPC_Trace_read(DPC_Trace_Ring *ring, uint32_t *readCount, DPC_Trace_Event *dst,
+                        uint32_t maxEvents, uint32_t *numLost)
+{
+    uint32_t writeCount;
+    uint32_t start;
+    uint32_t numEvents;
+    uint32_t numOverwritten;
+    uint32_t idx;
+
+    *numLost = 0;
+    if ((ring == NULL) || (ring->magic != DPC_TRACE_RING_MAGIC))
+    {
+        return 0;
+    }
+
+    writeCount = ring->writeCount;
+    start = *readCount;
+    if ((writeCount - start) > DPC_TRACE_RING_NUM_EVENTS)
+    {
+        *numLost = writeCount - DPC_TRACE_RING_NUM_EVENTS - start;
+        start = writeCount - DPC_TRACE_RING_NUM_EVENTS;
+    }
+
+    numEvents = writeCount - start;
+    if (numEvents > maxEvents)
+    {
+        numEvents = maxEvents;
+    }
+
+    for (idx = 0; idx < numEvents; idx++)
+    {
+        dst[idx] = ring->event[(start + idx) & DPC_TRACE_RING_INDEX_MASK];
+    }
+
+    /* Discard the slots the producer reused during the copy */
+    writeCount = ring->writeCount;
+    if ((writeCount - start) > DPC_TRACE_RING_NUM_EVENTS)
+    {
+        numOverwritten = writeCount - DPC_TRACE_RING_NUM_EVENTS - start;
+        if (numOverwritten > numEvents)
+        {
+            numOverwritten = numEvents;
+        }
+        memmove((void *)&dst[0], (void *)&dst[numOverwritten], (numEvents - numOverwritten) * sizeof(DPC_Trace_Event));
+        numEvents -= numOverwritten;
+        start += numOverwritten;
+        *numLost += numOverwritten;
+    }
+
+    *readCount = start + numEvents;
+    return numEvents;
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * DPC latency tracing
+ *
+ * Every core writes fixed-size begin/end/instant events into its own ring. The rings are allocated by the MSS in
+ * the shared L3 and the DSS ring is handed over to the DSS in DPIF_MSS_DSS_PreStartCfg. Each ring has a single
+ * producer core, so the cores never lock each other: the producer fills the slot and then advances writeCount,
+ * the MSS reader copies the slots and re-reads writeCount to discard the slots overwritten during the copy.
+ * On the producer core the write itself runs with interrupts disabled, so tasks and ISRs can trace on the same ring.
+ *
+ * Events are time stamped with the frame reference timer, which both cores read, so MSS, DSS and HWA (seen through
+ * the MSS DPU calls) activity lands on one time line without any per core clock alignment.
+ *
+ * The MSS drains the rings into the MMWDEMO_OUTPUT_DEBUG_TRACE_EVENTS TLV, tools/dpc_trace/dpc_trace2chrome.py
+ * converts a UART capture into Chrome trace / Perfetto JSON.
+ */
+
+#ifndef DPC_TRACE_H
+#define DPC_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stddef.h>
+
+/**************************************************************************
+ **************************************************************************/
+
+/* Ring header magic word, "DTRC" */
+#define DPC_TRACE_RING_MAGIC                0x43525444U
+
+/* Number of events per ring, power of 2 */
+#define DPC_TRACE_RING_NUM_EVENTS           512U
+
+/* Producer cores */
+#define DPC_TRACE_CORE_MSS                  0U
+#define DPC_TRACE_CORE_DSS                  1U
+#define DPC_TRACE_NUM_CORES                 2U
+
+/* Event types */
+#define DPC_TRACE_TYPE_BEGIN                0U
+#define DPC_TRACE_TYPE_END                  1U
+#define DPC_TRACE_TYPE_INSTANT              2U
+
+/* Time stamp source: frame reference timer, 40 MHz, readable from both cores */
+#define DPC_TRACE_TIMER_ADDR                0x5B000020U
+#define DPC_TRACE_TIMER_FREQ_HZ             40000000U
+#define DPC_TRACE_TIME()                    (*(volatile uint32_t *) DPC_TRACE_TIMER_ADDR)
+
+/* Event identifiers. The host tool names the events from this list, keep them in sync */
+typedef enum DPC_Trace_Id_e
+{
+    /* MSS */
+    DPC_TRACE_ID_FRAME_START = 1,           /* Frame start interrupt, instant */
+    DPC_TRACE_ID_NODE_RANGE_PROC,           /* DPC graph nodes, see dpc_mss.c */
+    DPC_TRACE_ID_NODE_DOA3D,
+    DPC_TRACE_ID_NODE_SNR3D,
+    DPC_TRACE_ID_NODE_RANGE_PROFILE,
+    DPC_TRACE_ID_NODE_IN_DETECT,
+    DPC_TRACE_ID_NODE_DSP,
+    DPC_TRACE_ID_NODE_MACRO_DOPPLER,
+    DPC_TRACE_ID_NODE_CLASSIFIER,
+    DPC_TRACE_ID_NODE_NEXT_FRAME,
+    DPC_TRACE_ID_CLASSIFIER_TASK,           /* Feature extraction and classification of a frame */
+    DPC_TRACE_ID_UART_TX,                   /* TLV transmission of a frame */
+
+    /* DSS */
+    DPC_TRACE_ID_DSS_FRAME = 32,            /* Capon chain of a frame */
+    DPC_TRACE_ID_DSS_DYN_HEATMAP,
+    DPC_TRACE_ID_DSS_DYN_CFAR,
+    DPC_TRACE_ID_DSS_DYN_ANGLE,
+    DPC_TRACE_ID_DSS_STATIC_HEATMAP,
+    DPC_TRACE_ID_DSS_STATIC_CFAR,
+    DPC_TRACE_ID_DSS_STATIC_ANGLE
+} DPC_Trace_Id;
+
+/**************************************************************************
+ **************************  Data Structures ***************************
+ **************************************************************************/
+
+/* Trace event, 16 bytes. Also the payload format of the trace TLV */
+typedef struct DPC_Trace_Event_t
+{
+    uint32_t    timeStamp;      /* Frame reference timer */
+    uint16_t    id;             /* DPC_TRACE_ID_xxx */
+    uint8_t     type;           /* DPC_TRACE_TYPE_xxx */
+    uint8_t     coreId;         /* DPC_TRACE_CORE_xxx */
+    uint32_t    frameNum;       /* Producer frame counter */
+    uint32_t    arg;            /* Event argument */
+} DPC_Trace_Event;
+
+/* Per core trace ring, in shared L3 */
+typedef struct DPC_Trace_Ring_t
+{
+    uint32_t            magic;          /* DPC_TRACE_RING_MAGIC once initialized */
+    uint32_t            coreId;         /* Producer core */
+    uint32_t            timerFreqHz;    /* Time stamp frequency */
+    uint32_t            enabled;        /* Events are dropped when 0 */
+    volatile uint32_t   writeCount;     /* Number of events written since init, written by the producer only */
+    volatile uint32_t   frameNum;       /* Producer frame counter, copied into the events */
+    uint32_t            reserved[2];
+    DPC_Trace_Event     event[DPC_TRACE_RING_NUM_EVENTS];
+} DPC_Trace_Ring;
+
+/**************************************************************************
+ *************************** Extern Definitions ***************************
+ **************************************************************************/
+
+/* Ring of the local core, NULL if tracing is disabled */
+extern DPC_Trace_Ring * volatile gDpcTraceRing;
+
+void DPC_Trace_ringInit(DPC_Trace_Ring *ring, uint32_t coreId, uint32_t enabled);
+
+void DPC_Trace_write(DPC_Trace_Ring *ring, uint32_t id, uint32_t type, uint32_t timeStamp, uint32_t arg);
+
+uint32_t DPC_Trace_read(DPC_Trace_Ring *ring, uint32_t *readCount, DPC_Trace_Event *dst,
+                        uint32_t maxEvents, uint32_t *numLost);
+
+/* Trace macros, on the ring of the local core */
+#define DPC_TRACE_BEGIN(id, arg)    DPC_Trace_write(gDpcTraceRing, (id), DPC_TRACE_TYPE_BEGIN, DPC_TRACE_TIME(), (arg))
+#define DPC_TRACE_END(id, arg)      DPC_Trace_write(gDpcTraceRing, (id), DPC_TRACE_TYPE_END, DPC_TRACE_TIME(), (arg))
+#define DPC_TRACE_INSTANT(id, arg)  DPC_Trace_write(gDpcTraceRing, (id), DPC_TRACE_TYPE_INSTANT, DPC_TRACE_TIME(), (arg))
+
+/* Sets the frame counter copied into the events of the local core */
+#define DPC_TRACE_SET_FRAME(num)    do { if (gDpcTraceRing != NULL) { gDpcTraceRing->frameNum = (num); } } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DPC_TRACE_H */
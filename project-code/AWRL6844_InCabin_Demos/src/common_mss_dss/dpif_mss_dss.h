@@ -55,6 +55,8 @@
 
 #include <common/syscommon.h>
 #include <drivers/hw_include/csl_complex_math_types.h>
+#include <common_mss_dss/dpc_trace/dpc_trace.h>
+#include <common_mss_dss/heatmap_codec/heatmap_codec.h>
 
 
 /* MMWAVE Driver Include Files */
@@ -111,6 +113,7 @@ typedef enum
                                                                1: range-azimuth detection, plus 2D capon angle heatmap, and estimation elevation only, with peak expansion
                                                                2: range-azimuth-elevation detection, plus zoom-in for finer angle estimation. */
         uint8_t dopplerEstMethod; /**< Doppler estimation method, 0-single peak search, 1-CFAR.*/
+        uint8_t steerVecGenMode; /**< steering vectors of detection method 2, 0: stored for all angle bins, 1: generated from the azimuth and elevation tables.*/
     } CLI_RADARDEMO_aoaEst2D_rangeAngleCfg;
 
 
@@ -154,6 +157,7 @@ typedef enum
         float   sideLobThr; /**Sidelobe threshold */
         float   peakExpRelThr; /**peak expansion relative threshold -- only include neighbors with power higher than  peakExpRelThr * peakPower*/
         float   peakExpSNRThr; /**peak expansion SNR threshold -- only expand peak with SNR higher than this threshold */
+        uint8_t coarseSearchStep; /**< coarse grid step of the hierarchical angle search, in search steps: 0 or 1 - dense search (default), 2 or 3 - hierarchical search, larger values are not supported */
     } CLI_RADARDEMO_aoaEst2D_2DAngleCfg;
 
     typedef struct CLI_RADARDEMO_aoaEst2D_2DZoomInCfg_t
@@ -164,6 +168,7 @@ typedef enum
         float   peakExpRelThr; /**peak expansion relative threshold -- only include neighbors with power higher than  peakExpRelThr * peakPower*/
         float   peakExpSNRThr; /**peak expansion SNR threshold -- only expand peak with SNR higher than this threshold */
         uint8_t localMaxCheckFlag; /**Loca max check flag: 0 - no check; 1 - elevation domain only; 2 - both elevation and azimuth */
+        uint8_t coarseSearchStep; /**< coarse grid step of the hierarchical angle search, in zoom-in steps: 0 or 1 - dense search (default), 2 or 3 - hierarchical search, larger values are not supported */
     } CLI_RADARDEMO_aoaEst2D_2DZoomInCfg;
 
     //! \brief   Configuration substructure RADARDEMO_aoaEst2D_staticCfg for RADARDEMO_aoaEst2DCaponBF configuration.
@@ -173,6 +178,8 @@ typedef enum
         uint8_t staticProcEnabled; /**< Enable static scene processing if set to 1 */
         uint8_t staticAzimStepDeciFactor; /**< static azimuth search step decimation factor, over the azimuth search steps in RADARDEMO_aoaEst2D_rangeAngleCfg*/
         uint8_t staticElevStepDeciFactor; /**< static elevation search step decimation factor, over the elevation search steps in RADARDEMO_aoaEst2D_2DAngleCfg*/
+        uint16_t staticRefreshPeriod; /**< frames between two refreshes of the whole static heatmap, 0 or 1 to compute the static heatmap every frame*/
+        float   staticChangeThr; /**< relative change of the static information of a range bin refreshing its static heatmap between two periodic refreshes*/
     } CLI_RADARDEMO_aoaEst2D_staticCfg;
 
     //! \brief   Configuration substructure RADARDEMO_aoaEst2D_staticCfg for RADARDEMO_aoaEst2DCaponBF configuration.
@@ -252,8 +259,14 @@ typedef enum
         uint8_t exportRawCfarDetList;
         uint8_t exportZoomInHeatmap;
 
+        /*! Quantization and budget of the heatmap delta export, exportCoarseHeatmap 2 (8-bit) or 3 (16-bit) */
+        HeatmapCodec_Cfg heatmapExportCfg;
+
         /*! For debugging only, normally set to zero */
         uint8_t disablePointCloudGeneration;
+
+        /*! Trace ring of the DSS in shared L3, NULL if tracing is disabled */
+        DPC_Trace_Ring *traceRing;
     }  DPIF_MSS_DSS_PreStartCfg;
 
 
@@ -266,6 +279,13 @@ typedef enum
         float       *data;
     } DPIF_MSS_DSS_detHeatmap3D;
 
+    // detection heatmap delta export, payload of TLV MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP_DELTA
+    typedef struct DPIF_MSS_DSS_detHeatmapDelta_t
+    {
+        uint32_t    length;
+        uint8_t     *data;
+    } DPIF_MSS_DSS_detHeatmapDelta;
+
     // Raw CFAR detection list structure
     typedef struct DPIF_MSS_DSS_rawCfarDetPoint_t
     {
@@ -300,6 +320,7 @@ typedef enum
         uint32_t staticHeatmpGenCycles;
         uint32_t staticCfarDetectionCycles;
         uint32_t staticAngleEstCycles;
+        uint32_t staticNumRefreshedBins;
     } DPIF_MSS_DSS_radarProcessBenchmarkElem;
 
     typedef struct DPIF_MSS_DSS_radarProcessOutput_t
@@ -307,6 +328,7 @@ typedef enum
         DPIF_MSS_DSS_pointCloud                 pointCloudOut;
         DPIF_MSS_DSS_radarProcessBenchmarkElem  *benchmarkOut;
         DPIF_MSS_DSS_detHeatmap3D               heatMapOut;
+        DPIF_MSS_DSS_detHeatmapDelta            heatMapDeltaOut;
         DPIF_MSS_DSS_rawCfarPointCloud          rawCfarPointCloud;
     } DPIF_MSS_DSS_radarProcessOutput;
 /**
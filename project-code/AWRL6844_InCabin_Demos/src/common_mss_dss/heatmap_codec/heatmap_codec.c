@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <string.h>
+
+#include <common_mss_dss/heatmap_codec/heatmap_codec.h>
+
+/* 10*log10(2) */
+#define HEATMAP_CODEC_DB_PER_LOG2   3.010299957f
+
+/* log2(x) for x > 0, exponent plus a minimax polynomial of the mantissa, error below 1e-3 */
+static float HeatmapCodec_log2(float x)
+{
+    union
+    {
+        float       f;
+        uint32_t    u;
+    } v;
+    int32_t exponent;
+    float   y;
+
+    v.f = x;
+    exponent = (int32_t)((v.u >> 23) & 0xFFU) - 127;
+    v.u = (v.u & 0x007FFFFFU) | 0x3F800000U;
+    y = v.f - 1.0f;
+
+    return (float)exponent + (0.0012496f + y * (1.4139791f + y * (-0.5684509f + y * 0.1541525f)));
+}
+
+/* Quantization level of a linear power */
+static uint32_t HeatmapCodec_quantize(const HeatmapCodec_Encoder *enc, float p)
+{
+    float q;
+
+    /* Also rejects NaN */
+    if (!(p > 0.0f))
+    {
+        return 0;
+    }
+
+    q = HeatmapCodec_log2(p) * enc->log2Scale - enc->offset + 0.5f;
+    if (q <= 0.0f)
+    {
+        return 0;
+    }
+    if (q >= (float)enc->maxQ)
+    {
+        return enc->maxQ;
+    }
+    return (uint32_t)q;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Fills the default configuration.
+ *
+ *  @param[out] cfg             Configuration
+ *  @param[in]  bitsPerSample   8 or 16
+ */
+void HeatmapCodec_getDefaultCfg(HeatmapCodec_Cfg *cfg, uint8_t bitsPerSample)
+{
+    cfg->bitsPerSample      = bitsPerSample;
+    cfg->deadband           = HEATMAP_CODEC_DEFAULT_DEADBAND;
+    cfg->keyFramePeriod     = HEATMAP_CODEC_DEFAULT_KEY_FRAME_PERIOD;
+    cfg->floorDb            = 0.0f;
+    cfg->stepDb             = (bitsPerSample == 16U) ? HEATMAP_CODEC_DEFAULT_STEP_DB_16BIT : HEATMAP_CODEC_DEFAULT_STEP_DB_8BIT;
+    cfg->maxBytesPerFrame   = HEATMAP_CODEC_DEFAULT_MAX_BYTES;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Initializes an encoder. The first encoded frame sends all the tiles.
+ *
+ *  @param[out] enc                 Encoder
+ *  @param[in]  cfg                 Configuration
+ *  @param[in]  numSamples          Samples of the heatmap
+ *  @param[in]  numRangeBins        Heatmap geometry, copied into the frame header
+ *  @param[in]  numAzimuthBins      Heatmap geometry, copied into the frame header
+ *  @param[in]  numElevationBins    Heatmap geometry, copied into the frame header
+ *  @param[in]  ref                 HEATMAP_CODEC_REF_SIZE bytes
+ *  @param[in]  stale               HEATMAP_CODEC_NUM_TILES bytes
+ *  @param[in]  out                 HEATMAP_CODEC_OUT_SIZE bytes, 4-byte aligned
+ *
+ *  @retval
+ *      0 on success, HEATMAP_CODEC_EINVAL otherwise
+ */
+int32_t HeatmapCodec_encoderInit(HeatmapCodec_Encoder *enc, const HeatmapCodec_Cfg *cfg, uint32_t numSamples,
+                                 uint16_t numRangeBins, uint16_t numAzimuthBins, uint16_t numElevationBins,
+                                 void *ref, uint8_t *stale, uint8_t *out)
+{
+    uint32_t maxTileLen;
+
+    if ((enc == NULL) || (cfg == NULL) || (ref == NULL) || (stale == NULL) || (out == NULL) || (numSamples == 0U))
+    {
+        return HEATMAP_CODEC_EINVAL;
+    }
+    if (((cfg->bitsPerSample != 8U) && (cfg->bitsPerSample != 16U)) || !(cfg->stepDb > 0.0f))
+    {
+        return HEATMAP_CODEC_EINVAL;
+    }
+
+    /* One full tile must fit in the budget, and tile indices fit in 16 bits */
+    maxTileLen = (uint32_t)sizeof(HeatmapCodec_TileHeader) + HEATMAP_CODEC_TILE_SIZE * (cfg->bitsPerSample >> 3);
+    if ((cfg->maxBytesPerFrame < maxTileLen) || (HEATMAP_CODEC_NUM_TILES(numSamples) > 0x10000U))
+    {
+        return HEATMAP_CODEC_EINVAL;
+    }
+
+    memset((void *)enc, 0, sizeof(HeatmapCodec_Encoder));
+    enc->cfg                = *cfg;
+    enc->numSamples         = numSamples;
+    enc->numTiles           = HEATMAP_CODEC_NUM_TILES(numSamples);
+    enc->numRangeBins       = numRangeBins;
+    enc->numAzimuthBins     = numAzimuthBins;
+    enc->numElevationBins   = numElevationBins;
+    enc->log2Scale          = HEATMAP_CODEC_DB_PER_LOG2 / cfg->stepDb;
+    enc->offset             = cfg->floorDb / cfg->stepDb;
+    enc->maxQ               = (1U << cfg->bitsPerSample) - 1U;
+    enc->ref                = ref;
+    enc->stale              = stale;
+    enc->out                = out;
+
+    memset((void *)ref, 0, HEATMAP_CODEC_REF_SIZE(cfg->bitsPerSample, numSamples));
+    memset((void *)stale, 1, enc->numTiles);
+
+    return 0;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Encodes a frame into enc->out: the tiles that changed since the decoder last received them, within the
+ *      budget of the frame, starting from the tile the previous frame stopped at.
+ *
+ *  @param[in]  enc         Encoder
+ *  @param[in]  heatmap     Linear power, numSamples samples
+ *
+ *  @retval
+ *      Payload length in bytes
+ */
+uint32_t HeatmapCodec_encode(HeatmapCodec_Encoder *enc, const float *heatmap)
+{
+    HeatmapCodec_FrameHeader *header = (HeatmapCodec_FrameHeader *) enc->out;
+    HeatmapCodec_TileHeader tileHeader;
+    uint16_t qTile[HEATMAP_CODEC_TILE_SIZE];
+    uint32_t bytesPerSample = (uint32_t)enc->cfg.bitsPerSample >> 3;
+    uint32_t deadband = enc->cfg.deadband;
+    uint32_t budgetEnd = (uint32_t)sizeof(HeatmapCodec_FrameHeader) + enc->cfg.maxBytesPerFrame;
+    uint32_t pos = (uint32_t)sizeof(HeatmapCodec_FrameHeader);
+    uint32_t tile = enc->cursor;
+    uint32_t numScanned, numSent, first, num, recordLen, i;
+    uint32_t ref, diff;
+    uint8_t  changed, flags;
+    uint8_t  *dst;
+
+    flags = 0;
+    if ((enc->frameSeq == 0U) ||
+        ((enc->cfg.keyFramePeriod != 0U) && (enc->framesSinceRefresh >= enc->cfg.keyFramePeriod)))
+    {
+        memset((void *)enc->stale, 1, enc->numTiles);
+        enc->framesSinceRefresh = 0;
+        flags |= HEATMAP_CODEC_FLAG_REFRESH;
+    }
+    enc->framesSinceRefresh++;
+
+    numSent = 0;
+    for (numScanned = 0; numScanned < enc->numTiles; numScanned++)
+    {
+        first = tile * HEATMAP_CODEC_TILE_SIZE;
+        num = enc->numSamples - first;
+        if (num > HEATMAP_CODEC_TILE_SIZE)
+        {
+            num = HEATMAP_CODEC_TILE_SIZE;
+        }
+
+        changed = enc->stale[tile];
+        for (i = 0; i < num; i++)
+        {
+            qTile[i] = (uint16_t) HeatmapCodec_quantize(enc, heatmap[first + i]);
+            if (bytesPerSample == 1U)
+            {
+                ref = ((uint8_t *) enc->ref)[first + i];
+            }
+            else
+            {
+                ref = ((uint16_t *) enc->ref)[first + i];
+            }
+            diff = (qTile[i] > ref) ? (qTile[i] - ref) : (ref - qTile[i]);
+            if (diff > deadband)
+            {
+                changed = 1;
+            }
+        }
+
+        if (changed)
+        {
+            recordLen = (uint32_t)sizeof(HeatmapCodec_TileHeader) + ((num * bytesPerSample + 3U) & ~3U);
+            if ((pos + recordLen) > budgetEnd)
+            {
+                /* The next frame resumes at this tile */
+                break;
+            }
+
+            tileHeader.tileIdx = (uint16_t) tile;
+            tileHeader.numSamples = (uint16_t) num;
+            memcpy((void *)&enc->out[pos], (void *)&tileHeader, sizeof(HeatmapCodec_TileHeader));
+            dst = &enc->out[pos + sizeof(HeatmapCodec_TileHeader)];
+            memset((void *)dst, 0, recordLen - sizeof(HeatmapCodec_TileHeader));
+            for (i = 0; i < num; i++)
+            {
+                if (bytesPerSample == 1U)
+                {
+                    dst[i] = (uint8_t) qTile[i];
+                    ((uint8_t *) enc->ref)[first + i] = (uint8_t) qTile[i];
+                }
+                else
+                {
+                    dst[2U * i]      = (uint8_t) (qTile[i] & 0xFFU);
+                    dst[2U * i + 1U] = (uint8_t) (qTile[i] >> 8);
+                    ((uint16_t *) enc->ref)[first + i] = qTile[i];
+                }
+            }
+            enc->stale[tile] = 0;
+            pos += recordLen;
+            numSent++;
+        }
+
+        tile++;
+        if (tile == enc->numTiles)
+        {
+            tile = 0;
+        }
+    }
+    if (numScanned == enc->numTiles)
+    {
+        flags |= HEATMAP_CODEC_FLAG_SCAN_COMPLETE;
+    }
+    enc->cursor = tile;
+
+    header->frameSeq            = enc->frameSeq;
+    header->numSamples          = enc->numSamples;
+    header->numRangeBins        = enc->numRangeBins;
+    header->numAzimuthBins      = enc->numAzimuthBins;
+    header->numElevationBins    = enc->numElevationBins;
+    header->bitsPerSample       = enc->cfg.bitsPerSample;
+    header->flags               = flags;
+    header->floorDb             = enc->cfg.floorDb;
+    header->stepDb              = enc->cfg.stepDb;
+    header->tileSize            = (uint16_t) HEATMAP_CODEC_TILE_SIZE;
+    header->numTiles            = (uint16_t) numSent;
+    header->payloadLength       = pos;
+
+    enc->frameSeq++;
+    return pos;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Initializes a decoder.
+ *
+ *  @param[out] dec         Decoder
+ *  @param[in]  q           Quantized samples, maxSamples
+ *  @param[in]  valid       HEATMAP_CODEC_NUM_TILES(maxSamples) bytes
+ *  @param[in]  maxSamples  Largest heatmap the decoder accepts
+ */
+void HeatmapCodec_decoderInit(HeatmapCodec_Decoder *dec, uint16_t *q, uint8_t *valid, uint32_t maxSamples)
+{
+    memset((void *)dec, 0, sizeof(HeatmapCodec_Decoder));
+    dec->maxSamples = maxSamples;
+    dec->q          = q;
+    dec->valid      = valid;
+    memset((void *)q, 0, maxSamples * sizeof(uint16_t));
+    memset((void *)valid, 0, HEATMAP_CODEC_NUM_TILES(maxSamples));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Applies the tiles of a frame. A new geometry or quantization invalidates all the tiles. A gap in the frame
+ *      sequence also does, the tiles of the lost frames are unknown: they become valid again when they change or
+ *      at the next refresh.
+ *
+ *  @param[in]  dec         Decoder
+ *  @param[in]  payload     TLV payload
+ *  @param[in]  length      TLV length
+ *
+ *  @retval
+ *      Number of tiles applied, HEATMAP_CODEC_EFORMAT or HEATMAP_CODEC_EINVAL on error
+ */
+int32_t HeatmapCodec_decode(HeatmapCodec_Decoder *dec, const uint8_t *payload, uint32_t length)
+{
+    HeatmapCodec_FrameHeader header;
+    HeatmapCodec_TileHeader tileHeader;
+    uint32_t bytesPerSample, pos, recordLen, first, i, t;
+    const uint8_t *src;
+
+    if (length < sizeof(HeatmapCodec_FrameHeader))
+    {
+        return HEATMAP_CODEC_EFORMAT;
+    }
+    memcpy((void *)&header, (const void *)payload, sizeof(HeatmapCodec_FrameHeader));
+    if ((header.payloadLength > length) || (header.tileSize != HEATMAP_CODEC_TILE_SIZE) ||
+        ((header.bitsPerSample != 8U) && (header.bitsPerSample != 16U)))
+    {
+        return HEATMAP_CODEC_EFORMAT;
+    }
+    if (header.numSamples > dec->maxSamples)
+    {
+        return HEATMAP_CODEC_EINVAL;
+    }
+
+    if ((dec->started == 0U) || (header.numSamples != dec->numSamples) ||
+        (header.bitsPerSample != dec->bitsPerSample) || (header.floorDb != dec->floorDb) ||
+        (header.stepDb != dec->stepDb))
+    {
+        memset((void *)dec->valid, 0, HEATMAP_CODEC_NUM_TILES(dec->maxSamples));
+        dec->numSamples     = header.numSamples;
+        dec->bitsPerSample  = header.bitsPerSample;
+        dec->floorDb        = header.floorDb;
+        dec->stepDb         = header.stepDb;
+    }
+    else if (header.frameSeq != (dec->lastFrameSeq + 1U))
+    {
+        dec->numLostFrames += header.frameSeq - dec->lastFrameSeq - 1U;
+        memset((void *)dec->valid, 0, HEATMAP_CODEC_NUM_TILES(dec->maxSamples));
+    }
+    dec->numRangeBins       = header.numRangeBins;
+    dec->numAzimuthBins     = header.numAzimuthBins;
+    dec->numElevationBins   = header.numElevationBins;
+    dec->started            = 1;
+    dec->lastFrameSeq       = header.frameSeq;
+
+    bytesPerSample = (uint32_t)header.bitsPerSample >> 3;
+    pos = (uint32_t)sizeof(HeatmapCodec_FrameHeader);
+    for (t = 0; t < header.numTiles; t++)
+    {
+        if ((pos + sizeof(HeatmapCodec_TileHeader)) > header.payloadLength)
+        {
+            return HEATMAP_CODEC_EFORMAT;
+        }
+        memcpy((void *)&tileHeader, (const void *)&payload[pos], sizeof(HeatmapCodec_TileHeader));
+        first = (uint32_t)tileHeader.tileIdx * HEATMAP_CODEC_TILE_SIZE;
+        recordLen = (uint32_t)sizeof(HeatmapCodec_TileHeader) + ((tileHeader.numSamples * bytesPerSample + 3U) & ~3U);
+        if ((tileHeader.numSamples > HEATMAP_CODEC_TILE_SIZE) || ((first + tileHeader.numSamples) > header.numSamples) ||
+            ((pos + recordLen) > header.payloadLength))
+        {
+            return HEATMAP_CODEC_EFORMAT;
+        }
+
+        src = &payload[pos + sizeof(HeatmapCodec_TileHeader)];
+        for (i = 0; i < tileHeader.numSamples; i++)
+        {
+            if (bytesPerSample == 1U)
+            {
+                dec->q[first + i] = src[i];
+            }
+            else
+            {
+                dec->q[first + i] = (uint16_t) ((uint32_t)src[2U * i] | ((uint32_t)src[2U * i + 1U] << 8));
+            }
+        }
+        dec->valid[tileHeader.tileIdx] = 1;
+        pos += recordLen;
+    }
+
+    return (int32_t)header.numTiles;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Log power of a decoded sample, in dB. Level 0 stands for floorDb and below.
+ *
+ *  @param[in]  dec     Decoder
+ *  @param[in]  idx     Sample index
+ */
+float HeatmapCodec_sampleDb(const HeatmapCodec_Decoder *dec, uint32_t idx)
+{
+    return dec->floorDb + dec->stepDb * (float)dec->q[idx];
+}
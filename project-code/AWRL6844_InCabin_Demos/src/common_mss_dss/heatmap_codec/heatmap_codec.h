@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Capon heatmap delta export
+ *
+ * The float heatmap of TLV MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP is numRangeBins * numAngleBins * 4 bytes per frame,
+ * more than the UART carries at the frame rate. In delta mode the DSS quantizes the heatmap to 8 or 16-bit log
+ * power, q = round((10*log10(p) - floorDb) / stepDb) clipped to [0, 2^bits - 1], and cuts it in tiles of
+ * HEATMAP_CODEC_TILE_SIZE samples, in heatmap memory order.
+ *
+ * The encoder keeps the samples as the decoder holds them. A tile is sent when one of its samples moved by more
+ * than deadband quantization steps from that copy, or when the decoder copy is not valid yet. Sent tiles carry
+ * their absolute samples, so the decoder copy does not drift. The tiles of a frame are limited to
+ * maxBytesPerFrame: the encoder scans the tiles from where the previous frame stopped, and the tiles that do not
+ * fit are sent in the next frames. Every keyFramePeriod frames all the tiles are invalidated and the full heatmap
+ * streams out again over as many frames as the budget needs, which also lets a decoder attached to a running
+ * device converge.
+ *
+ * The decoder error is bounded only after a frame flagged HEATMAP_CODEC_FLAG_SCAN_COMPLETE, which checked all the
+ * tiles against its heatmap: the valid tiles are then within deadband steps of its quantized samples, within
+ * (deadband + 0.5) * stepDb dB of its log power clipped to the quantization range. While the changes exceed the
+ * budget, the tiles the scan has not reached yet hold the samples they were last sent with, and the error is only
+ * bounded by the quantization range: a target that moved away leaves its peak, 100 dB above the floor or more.
+ *
+ * Payload of TLV MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP_DELTA: HeatmapCodec_FrameHeader, then numTiles tiles of
+ * HeatmapCodec_TileHeader followed by numSamples samples of bitsPerSample bits, little endian, padded to 4 bytes.
+ *
+ * The module has no SDK dependency. The decoder side builds on the host, tools/heatmap_codec/heatmap_decode.py
+ * decodes a UART capture.
+ */
+
+#ifndef HEATMAP_CODEC_H
+#define HEATMAP_CODEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stddef.h>
+
+/**************************************************************************
+ ******************************** Macros **********************************
+ **************************************************************************/
+
+/* Samples per tile */
+#define HEATMAP_CODEC_TILE_SIZE             64U
+
+/* Frame header flags */
+#define HEATMAP_CODEC_FLAG_REFRESH          0x01U   /* All the tiles were invalidated at this frame */
+#define HEATMAP_CODEC_FLAG_SCAN_COMPLETE    0x02U   /* All the tiles were checked, the deadband bound holds */
+
+/* Error codes */
+#define HEATMAP_CODEC_EINVAL                (-1)    /* Invalid configuration or argument */
+#define HEATMAP_CODEC_EFORMAT               (-2)    /* Truncated or inconsistent payload */
+
+/* Default configuration, 0.5 dB steps over [0, 127.5] dB in 8 bits */
+#define HEATMAP_CODEC_DEFAULT_STEP_DB_8BIT      0.5f
+#define HEATMAP_CODEC_DEFAULT_STEP_DB_16BIT     0.01f
+#define HEATMAP_CODEC_DEFAULT_DEADBAND          1U
+#define HEATMAP_CODEC_DEFAULT_MAX_BYTES         4096U
+#define HEATMAP_CODEC_DEFAULT_KEY_FRAME_PERIOD  100U
+
+/* Size of the encoder buffers for numSamples samples */
+#define HEATMAP_CODEC_REF_SIZE(bitsPerSample, numSamples)   ((uint32_t)(numSamples) * ((bitsPerSample) >> 3))
+#define HEATMAP_CODEC_NUM_TILES(numSamples)                 (((uint32_t)(numSamples) + HEATMAP_CODEC_TILE_SIZE - 1U) / HEATMAP_CODEC_TILE_SIZE)
+#define HEATMAP_CODEC_OUT_SIZE(maxBytesPerFrame)            ((uint32_t)sizeof(HeatmapCodec_FrameHeader) + (uint32_t)(maxBytesPerFrame))
+
+/**************************************************************************
+ **************************  Data Structures ***************************
+ **************************************************************************/
+
+/* Export configuration */
+typedef struct HeatmapCodec_Cfg_t
+{
+    uint8_t     bitsPerSample;      /* 8 or 16 */
+    uint8_t     deadband;           /* A tile is sent when a sample moved by more than deadband steps */
+    uint16_t    keyFramePeriod;     /* Frames between two refreshes of all the tiles, 0: first frame only */
+    float       floorDb;            /* Log power of quantization level 0 */
+    float       stepDb;             /* Quantization step */
+    uint32_t    maxBytesPerFrame;   /* Tile budget per frame, at least one tile */
+} HeatmapCodec_Cfg;
+
+/* Frame header, 32 bytes, start of the TLV payload */
+typedef struct HeatmapCodec_FrameHeader_t
+{
+    uint32_t    frameSeq;           /* Encoded frame counter, a gap means lost tiles */
+    uint32_t    numSamples;         /* Samples of the heatmap */
+    uint16_t    numRangeBins;
+    uint16_t    numAzimuthBins;
+    uint16_t    numElevationBins;
+    uint8_t     bitsPerSample;
+    uint8_t     flags;              /* HEATMAP_CODEC_FLAG_xxx */
+    float       floorDb;
+    float       stepDb;
+    uint16_t    tileSize;           /* HEATMAP_CODEC_TILE_SIZE */
+    uint16_t    numTiles;           /* Tiles in this payload */
+    uint32_t    payloadLength;      /* Bytes of the payload, header included */
+} HeatmapCodec_FrameHeader;
+
+/* Tile header, followed by the samples */
+typedef struct HeatmapCodec_TileHeader_t
+{
+    uint16_t    tileIdx;            /* First sample is tileIdx * tileSize */
+    uint16_t    numSamples;         /* tileSize, less for the last tile */
+} HeatmapCodec_TileHeader;
+
+/* Encoder state */
+typedef struct HeatmapCodec_Encoder_t
+{
+    HeatmapCodec_Cfg cfg;
+    uint32_t    numSamples;
+    uint32_t    numTiles;
+    uint16_t    numRangeBins;
+    uint16_t    numAzimuthBins;
+    uint16_t    numElevationBins;
+    uint32_t    frameSeq;
+    uint32_t    framesSinceRefresh;
+    uint32_t    cursor;             /* Tile the next scan starts from */
+    float       log2Scale;          /* 10*log10(2) / stepDb */
+    float       offset;             /* floorDb / stepDb */
+    uint32_t    maxQ;               /* 2^bitsPerSample - 1 */
+    void       *ref;                /* Samples as held by the decoder, HEATMAP_CODEC_REF_SIZE bytes */
+    uint8_t    *stale;              /* Per tile, 1 if the decoder copy is not valid, HEATMAP_CODEC_NUM_TILES bytes */
+    uint8_t    *out;                /* Payload, HEATMAP_CODEC_OUT_SIZE bytes, 4-byte aligned */
+} HeatmapCodec_Encoder;
+
+/* Decoder state */
+typedef struct HeatmapCodec_Decoder_t
+{
+    uint32_t    maxSamples;         /* Size of q */
+    uint32_t    numSamples;         /* From the last frame header, 0 before the first frame */
+    uint16_t    numRangeBins;
+    uint16_t    numAzimuthBins;
+    uint16_t    numElevationBins;
+    uint8_t     bitsPerSample;
+    uint8_t     started;            /* A frame was decoded */
+    float       floorDb;
+    float       stepDb;
+    uint32_t    lastFrameSeq;
+    uint32_t    numLostFrames;      /* Frame sequence gaps since init */
+    uint16_t   *q;                  /* Quantized samples, maxSamples */
+    uint8_t    *valid;              /* Per tile, 1 once received since the last refresh or loss */
+} HeatmapCodec_Decoder;
+
+/**************************************************************************
+ *************************** Extern Definitions ***************************
+ **************************************************************************/
+
+void HeatmapCodec_getDefaultCfg(HeatmapCodec_Cfg *cfg, uint8_t bitsPerSample);
+
+int32_t HeatmapCodec_encoderInit(HeatmapCodec_Encoder *enc, const HeatmapCodec_Cfg *cfg, uint32_t numSamples,
+                                 uint16_t numRangeBins, uint16_t numAzimuthBins, uint16_t numElevationBins,
+                                 void *ref, uint8_t *stale, uint8_t *out);
+
+uint32_t HeatmapCodec_encode(HeatmapCodec_Encoder *enc, const float *heatmap);
+
+void HeatmapCodec_decoderInit(HeatmapCodec_Decoder *dec, uint16_t *q, uint8_t *valid, uint32_t maxSamples);
+
+int32_t HeatmapCodec_decode(HeatmapCodec_Decoder *dec, const uint8_t *payload, uint32_t length);
+
+float HeatmapCodec_sampleDb(const HeatmapCodec_Decoder *dec, uint32_t idx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEATMAP_CODEC_H */
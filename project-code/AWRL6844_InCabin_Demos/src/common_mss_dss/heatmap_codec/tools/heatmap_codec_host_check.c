@@ -0,0 +1,498 @@
+/**
+ *   @file  heatmap_codec_host_check.c
+ *
+ *   @brief
+ *      Host check of the Capon heatmap delta export, encoder to decoder round trip.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: heatmap_codec_host_check [number of frames]
+ *
+ *  Encodes synthetic heatmaps, a noise floor with moving targets and samples below the floor and above the top
+ *  of the quantization range, decodes the payloads and compares the decoded log power with the heatmap, in 8 and
+ *  16 bits, for a heatmap size that is not a multiple of the tile size:
+ *  - budget above the full heatmap: every frame is flagged HEATMAP_CODEC_FLAG_SCAN_COMPLETE, and every decoded
+ *    sample is within (deadband + 0.5) * stepDb dB, plus the error of the log2 approximation, of the log power
+ *    clipped to the quantization range
+ *  - budget of a few tiles: the same bound holds after the frames flagged HEATMAP_CODEC_FLAG_SCAN_COMPLETE. The
+ *    error of the other frames is reported, it is not bounded. Once the heatmap stops moving, the scan must
+ *    complete within the frames the budget needs for all the tiles
+ *  - a lost payload: the decoder must count it and invalidate the tiles, the bound holds on the valid tiles, and
+ *    all the tiles are valid again after the next refresh
+ *  - truncated and inconsistent payloads are rejected, as are configurations the encoder cannot serve
+ *  The exit status is 0 if all checks pass.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <common_mss_dss/heatmap_codec/heatmap_codec.h>
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+#define CHECK_DEFAULT_NUM_FRAMES        (300U)
+
+/* 37 full tiles and a last one of 13 samples */
+#define CHECK_NUM_RANGE_BINS            (61U)
+#define CHECK_NUM_ANGLE_BINS            (39U)
+#define CHECK_NUM_SAMPLES               (CHECK_NUM_RANGE_BINS * CHECK_NUM_ANGLE_BINS)
+#define CHECK_NUM_TILES                 HEATMAP_CODEC_NUM_TILES(CHECK_NUM_SAMPLES)
+
+#define CHECK_NUM_TARGETS               (3U)
+
+/* Error of the log2 approximation of the encoder, 1e-3 log2 units, in dB */
+#define CHECK_LOG2_ERR_DB               (0.0031)
+
+/* Budget of the over budget runs, in tiles of 16-bit samples */
+#define CHECK_SMALL_BUDGET_TILES        (6U)
+
+/* Scene: log power of the noise floor per sample and moving targets */
+typedef struct CheckScene_t
+{
+    uint32_t    seed;
+    float       floorDb[CHECK_NUM_SAMPLES];
+    float       targetRange[CHECK_NUM_TARGETS];
+    float       targetAngle[CHECK_NUM_TARGETS];
+    float       targetSpeed[CHECK_NUM_TARGETS];
+    float       targetDb[CHECK_NUM_TARGETS];
+} CheckScene;
+
+/* Encoder, decoder and their buffers */
+typedef struct CheckCodec_t
+{
+    HeatmapCodec_Encoder    enc;
+    HeatmapCodec_Decoder    dec;
+    uint16_t    ref[CHECK_NUM_SAMPLES];
+    uint8_t     stale[CHECK_NUM_TILES];
+    uint32_t    out[(sizeof(HeatmapCodec_FrameHeader) + CHECK_NUM_TILES * (sizeof(HeatmapCodec_TileHeader) + 2U * HEATMAP_CODEC_TILE_SIZE) + 3U) / 4U];
+    uint16_t    q[CHECK_NUM_SAMPLES];
+    uint8_t     valid[CHECK_NUM_TILES];
+} CheckCodec;
+
+/**************************************************************************
+ ************************** Global Variables ******************************
+ **************************************************************************/
+
+static CheckScene gCheckScene;
+static CheckCodec gCheckCodec;
+static float gCheckHeatmap[CHECK_NUM_SAMPLES];
+static uint32_t gCheckNumFrames;
+
+/**************************************************************************
+ ************************** Helpers ***************************************
+ **************************************************************************/
+
+static float Check_rand(uint32_t *seed)
+{
+    *seed = (*seed * 1664525U) + 1013904223U;
+    return (float)(*seed >> 8) / 16777216.0f;
+}
+
+static void Check_sceneInit(CheckScene *scene, uint32_t seed)
+{
+    uint32_t i;
+
+    scene->seed = seed;
+    for (i = 0; i < CHECK_NUM_SAMPLES; i++)
+    {
+        /* A few samples below the floor of the quantization range */
+        scene->floorDb[i] = (Check_rand(&scene->seed) < 0.02f) ? -20.0f : (20.0f + 15.0f * Check_rand(&scene->seed));
+    }
+    for (i = 0; i < CHECK_NUM_TARGETS; i++)
+    {
+        scene->targetRange[i] = (float)CHECK_NUM_RANGE_BINS * Check_rand(&scene->seed);
+        scene->targetAngle[i] = (float)CHECK_NUM_ANGLE_BINS * Check_rand(&scene->seed);
+        scene->targetSpeed[i] = 0.2f + 0.6f * Check_rand(&scene->seed);
+        /* The last target goes above the top of the 8-bit range */
+        scene->targetDb[i] = (i == (CHECK_NUM_TARGETS - 1U)) ? 140.0f : (70.0f + 30.0f * Check_rand(&scene->seed));
+    }
+}
+
+/* Heatmap of a frame, targets moving in range, the noise floor fluctuating by a fraction of dB. moving = 0
+ * freezes the scene. */
+static void Check_sceneFrame(CheckScene *scene, float *heatmap, uint32_t moving)
+{
+    uint32_t r, a, i;
+    float    dr, da, db, fluct;
+
+    for (i = 0; i < CHECK_NUM_TARGETS; i++)
+    {
+        if (moving)
+        {
+            scene->targetRange[i] += scene->targetSpeed[i];
+            if (scene->targetRange[i] >= (float)CHECK_NUM_RANGE_BINS)
+            {
+                scene->targetRange[i] -= (float)CHECK_NUM_RANGE_BINS;
+            }
+        }
+    }
+    for (r = 0; r < CHECK_NUM_RANGE_BINS; r++)
+    {
+        for (a = 0; a < CHECK_NUM_ANGLE_BINS; a++)
+        {
+            i = r * CHECK_NUM_ANGLE_BINS + a;
+            fluct = moving ? (0.4f * (Check_rand(&scene->seed) - 0.5f)) : 0.0f;
+            heatmap[i] = powf(10.0f, 0.1f * (scene->floorDb[i] + fluct));
+        }
+    }
+    for (i = 0; i < CHECK_NUM_TARGETS; i++)
+    {
+        for (r = 0; r < CHECK_NUM_RANGE_BINS; r++)
+        {
+            for (a = 0; a < CHECK_NUM_ANGLE_BINS; a++)
+            {
+                dr = (float)r - scene->targetRange[i];
+                da = (float)a - scene->targetAngle[i];
+                db = scene->targetDb[i] - 6.0f * (dr * dr + 0.25f * da * da);
+                if (db > 0.0f)
+                {
+                    heatmap[r * CHECK_NUM_ANGLE_BINS + a] += powf(10.0f, 0.1f * db);
+                }
+            }
+        }
+    }
+}
+
+static int32_t Check_codecInit(CheckCodec *codec, uint8_t bitsPerSample, uint32_t maxBytesPerFrame, uint16_t keyFramePeriod)
+{
+    HeatmapCodec_Cfg cfg;
+
+    HeatmapCodec_getDefaultCfg(&cfg, bitsPerSample);
+    cfg.maxBytesPerFrame = maxBytesPerFrame;
+    cfg.keyFramePeriod = keyFramePeriod;
+    HeatmapCodec_decoderInit(&codec->dec, codec->q, codec->valid, CHECK_NUM_SAMPLES);
+    return HeatmapCodec_encoderInit(&codec->enc, &cfg, CHECK_NUM_SAMPLES, CHECK_NUM_RANGE_BINS, CHECK_NUM_ANGLE_BINS, 1U,
+                                    codec->ref, codec->stale, (uint8_t *) codec->out);
+}
+
+/* Decoder error bound in dB after a complete scan */
+static double Check_bound(const CheckCodec *codec)
+{
+    return ((double)codec->enc.cfg.deadband + 0.5) * (double)codec->enc.cfg.stepDb + CHECK_LOG2_ERR_DB + 1e-4;
+}
+
+/* Largest error in dB of the decoded samples of the valid tiles against the heatmap log power, clipped to the
+ * quantization range */
+static double Check_error(const CheckCodec *codec, const float *heatmap, uint32_t *numValidTiles)
+{
+    double   lo = (double)codec->enc.cfg.floorDb;
+    double   hi = lo + (double)codec->enc.maxQ * (double)codec->enc.cfg.stepDb;
+    double   maxErr = 0.0, db;
+    uint32_t i;
+
+    *numValidTiles = 0;
+    for (i = 0; i < CHECK_NUM_SAMPLES; i++)
+    {
+        if (codec->dec.valid[i / HEATMAP_CODEC_TILE_SIZE] == 0U)
+        {
+            continue;
+        }
+        db = 10.0 * log10((double)heatmap[i]);
+        db = (db < lo) ? lo : ((db > hi) ? hi : db);
+        db = fabs((double)HeatmapCodec_sampleDb(&codec->dec, i) - db);
+        maxErr = (db > maxErr) ? db : maxErr;
+    }
+    for (i = 0; i < CHECK_NUM_TILES; i++)
+    {
+        *numValidTiles += codec->dec.valid[i];
+    }
+    return maxErr;
+}
+
+/* Encodes a frame of the scene, checks the payload and decodes it unless lost. Returns the number of errors. */
+static uint32_t Check_frame(CheckCodec *codec, uint32_t moving, uint32_t lost, uint8_t *flags, uint32_t *length)
+{
+    const HeatmapCodec_FrameHeader *header = (const HeatmapCodec_FrameHeader *) codec->out;
+    uint32_t numErrors = 0;
+    int32_t  retVal;
+
+    Check_sceneFrame(&gCheckScene, gCheckHeatmap, moving);
+    *length = HeatmapCodec_encode(&codec->enc, gCheckHeatmap);
+    *flags = header->flags;
+    if ((*length > HEATMAP_CODEC_OUT_SIZE(codec->enc.cfg.maxBytesPerFrame)) || (header->payloadLength != *length))
+    {
+        printf("    FAIL: frame %u payload of %u bytes, budget %u\n", header->frameSeq, *length,
+               codec->enc.cfg.maxBytesPerFrame);
+        numErrors++;
+    }
+    if (!lost)
+    {
+        retVal = HeatmapCodec_decode(&codec->dec, (const uint8_t *) codec->out, *length);
+        if (retVal != (int32_t)header->numTiles)
+        {
+            printf("    FAIL: frame %u decode returned %d, %u tiles sent\n", header->frameSeq, retVal, header->numTiles);
+            numErrors++;
+        }
+    }
+    return numErrors;
+}
+
+/* Round trip of a moving scene, then frozen. Returns the number of errors. */
+static uint32_t Check_roundTrip(uint8_t bitsPerSample, uint32_t maxBytesPerFrame)
+{
+    uint32_t tileLen = (uint32_t)sizeof(HeatmapCodec_TileHeader) + HEATMAP_CODEC_TILE_SIZE * (bitsPerSample >> 3);
+    uint32_t numFrameTiles = maxBytesPerFrame / tileLen;
+    uint32_t maxScanFrames = (CHECK_NUM_TILES + numFrameTiles - 1U) / numFrameTiles + 1U;
+    uint32_t numErrors = 0, numComplete = 0, numScanFrames = 0, firstFrozenScan = 0;
+    uint32_t numBytes = 0, frame, length, numValidTiles;
+    double   bound, err, maxErrComplete = 0.0, maxErrOpen = 0.0;
+    uint8_t  flags;
+
+    Check_sceneInit(&gCheckScene, 12345U + bitsPerSample);
+    if (Check_codecInit(&gCheckCodec, bitsPerSample, maxBytesPerFrame, HEATMAP_CODEC_DEFAULT_KEY_FRAME_PERIOD) != 0)
+    {
+        printf("    FAIL: %u-bit encoder init, budget %u\n", bitsPerSample, maxBytesPerFrame);
+        return 1;
+    }
+    bound = Check_bound(&gCheckCodec);
+
+    /* Moving, then frozen for twice the frames a full scan needs */
+    for (frame = 0; frame < (gCheckNumFrames + 2U * maxScanFrames); frame++)
+    {
+        numErrors += Check_frame(&gCheckCodec, frame < gCheckNumFrames, 0, &flags, &length);
+        numBytes += length;
+        if (flags & HEATMAP_CODEC_FLAG_REFRESH)
+        {
+            numScanFrames = 0;
+        }
+        numScanFrames++;
+
+        err = Check_error(&gCheckCodec, gCheckHeatmap, &numValidTiles);
+        if (flags & HEATMAP_CODEC_FLAG_SCAN_COMPLETE)
+        {
+            numComplete++;
+            maxErrComplete = (err > maxErrComplete) ? err : maxErrComplete;
+            if ((err > bound) || (numValidTiles != CHECK_NUM_TILES))
+            {
+                printf("    FAIL: frame %u complete scan, error %.4f dB, bound %.4f dB, %u of %u valid tiles\n", frame,
+                       err, bound, numValidTiles, CHECK_NUM_TILES);
+                numErrors++;
+            }
+            numScanFrames = 0;
+        }
+        else
+        {
+            maxErrOpen = (err > maxErrOpen) ? err : maxErrOpen;
+            if (maxBytesPerFrame >= (CHECK_NUM_TILES * tileLen))
+            {
+                printf("    FAIL: frame %u not a complete scan with a budget of the full heatmap\n", frame);
+                numErrors++;
+            }
+        }
+
+        if (frame >= gCheckNumFrames)
+        {
+            /* Frozen: the scan must complete within the frames of a full scan, counted from the freeze or from a
+               refresh since */
+            if (firstFrozenScan == 0U)
+            {
+                firstFrozenScan = (flags & HEATMAP_CODEC_FLAG_SCAN_COMPLETE) ? (frame - gCheckNumFrames + 1U) : 0U;
+            }
+            if (numScanFrames > maxScanFrames)
+            {
+                printf("    FAIL: frame %u frozen heatmap, no complete scan for %u frames\n", frame, numScanFrames);
+                numErrors++;
+            }
+        }
+        else if (frame == (gCheckNumFrames - 1U))
+        {
+            numScanFrames = 0;
+        }
+    }
+
+    printf("%2u bits, budget %5u bytes: %u of %u frames complete scans, error %.4f dB (bound %.4f dB), "
+           "%.4f dB in the other frames, frozen scene scanned in %u frames, %.1f %% of the float heatmap\n",
+           bitsPerSample, maxBytesPerFrame, numComplete, frame, maxErrComplete, bound, maxErrOpen, firstFrozenScan,
+           100.0 * (double)numBytes / ((double)frame * 4.0 * CHECK_NUM_SAMPLES));
+    return numErrors;
+}
+
+/* A lost payload. Returns the number of errors. */
+static uint32_t Check_loss(uint8_t bitsPerSample)
+{
+    uint32_t budget = CHECK_NUM_TILES * ((uint32_t)sizeof(HeatmapCodec_TileHeader) + 2U * HEATMAP_CODEC_TILE_SIZE);
+    uint32_t numErrors = 0, frame, length, numValidTiles, refreshed = 0;
+    uint32_t lostFrame = 5U;
+    double   bound, err;
+    uint8_t  flags;
+
+    Check_sceneInit(&gCheckScene, 777U + bitsPerSample);
+    (void)Check_codecInit(&gCheckCodec, bitsPerSample, budget, 10U);
+    bound = Check_bound(&gCheckCodec);
+
+    for (frame = 0; frame < 25U; frame++)
+    {
+        numErrors += Check_frame(&gCheckCodec, 1U, frame == lostFrame, &flags, &length);
+        if (frame == lostFrame)
+        {
+            continue;
+        }
+        err = Check_error(&gCheckCodec, gCheckHeatmap, &numValidTiles);
+        if ((flags & HEATMAP_CODEC_FLAG_SCAN_COMPLETE) && (err > bound))
+        {
+            printf("    FAIL: %u-bit frame %u after a loss, error %.4f dB on the valid tiles, bound %.4f dB\n",
+                   bitsPerSample, frame, err, bound);
+            numErrors++;
+        }
+        if ((frame == (lostFrame + 1U)) &&
+            ((gCheckCodec.dec.numLostFrames != 1U) || (numValidTiles != ((HeatmapCodec_FrameHeader *) gCheckCodec.out)->numTiles)))
+        {
+            printf("    FAIL: %u-bit frame after the loss, %u lost frames, %u valid tiles\n", bitsPerSample,
+                   gCheckCodec.dec.numLostFrames, numValidTiles);
+            numErrors++;
+        }
+        if ((frame > lostFrame) && (flags & HEATMAP_CODEC_FLAG_REFRESH))
+        {
+            refreshed = 1;
+        }
+        if (refreshed && (numValidTiles != CHECK_NUM_TILES))
+        {
+            printf("    FAIL: %u-bit frame %u after the refresh, %u of %u valid tiles\n", bitsPerSample, frame,
+                   numValidTiles, CHECK_NUM_TILES);
+            numErrors++;
+        }
+    }
+    if (!refreshed)
+    {
+        printf("    FAIL: %u-bit no refresh after the loss\n", bitsPerSample);
+        numErrors++;
+    }
+    return numErrors;
+}
+
+/* Payloads the decoder must reject and configurations the encoder must reject. Returns the number of errors. */
+static uint32_t Check_malformed(void)
+{
+    static uint8_t payload[sizeof(gCheckCodec.out)];
+    HeatmapCodec_FrameHeader header;
+    HeatmapCodec_TileHeader tileHeader;
+    HeatmapCodec_Cfg cfg;
+    uint32_t numErrors = 0, length, i;
+    int32_t  retVal[9];
+    int32_t  expected[9] = {HEATMAP_CODEC_EFORMAT, HEATMAP_CODEC_EFORMAT, HEATMAP_CODEC_EFORMAT, HEATMAP_CODEC_EFORMAT,
+                            HEATMAP_CODEC_EFORMAT, HEATMAP_CODEC_EFORMAT, HEATMAP_CODEC_EINVAL, HEATMAP_CODEC_EINVAL,
+                            HEATMAP_CODEC_EINVAL};
+
+    Check_sceneInit(&gCheckScene, 99U);
+    (void)Check_codecInit(&gCheckCodec, 8U, 1024U, 0U);
+    Check_sceneFrame(&gCheckScene, gCheckHeatmap, 1U);
+    length = HeatmapCodec_encode(&gCheckCodec.enc, gCheckHeatmap);
+    memcpy(payload, gCheckCodec.out, length);
+    memcpy(&header, payload, sizeof(header));
+
+    /* Shorter than the header, shorter than the payload length */
+    retVal[0] = HeatmapCodec_decode(&gCheckCodec.dec, payload, sizeof(header) - 1U);
+    retVal[1] = HeatmapCodec_decode(&gCheckCodec.dec, payload, length - 1U);
+
+    /* One tile more than the payload holds */
+    header.numTiles++;
+    memcpy(payload, &header, sizeof(header));
+    retVal[2] = HeatmapCodec_decode(&gCheckCodec.dec, payload, length);
+    header.numTiles--;
+
+    /* Tile size and sample size the decoder does not know */
+    header.tileSize = 32U;
+    memcpy(payload, &header, sizeof(header));
+    retVal[3] = HeatmapCodec_decode(&gCheckCodec.dec, payload, length);
+    header.tileSize = HEATMAP_CODEC_TILE_SIZE;
+    header.bitsPerSample = 12U;
+    memcpy(payload, &header, sizeof(header));
+    retVal[4] = HeatmapCodec_decode(&gCheckCodec.dec, payload, length);
+    header.bitsPerSample = 8U;
+    memcpy(payload, &header, sizeof(header));
+
+    /* Tile past the heatmap */
+    memcpy(&tileHeader, &payload[sizeof(header)], sizeof(tileHeader));
+    tileHeader.tileIdx = (uint16_t) CHECK_NUM_TILES;
+    memcpy(&payload[sizeof(header)], &tileHeader, sizeof(tileHeader));
+    retVal[5] = HeatmapCodec_decode(&gCheckCodec.dec, payload, length);
+
+    /* Heatmap larger than the decoder */
+    HeatmapCodec_decoderInit(&gCheckCodec.dec, gCheckCodec.q, gCheckCodec.valid, CHECK_NUM_SAMPLES - 1U);
+    retVal[6] = HeatmapCodec_decode(&gCheckCodec.dec, (const uint8_t *) gCheckCodec.out, length);
+
+    /* Budget below one tile, sample size the encoder does not know */
+    HeatmapCodec_getDefaultCfg(&cfg, 16U);
+    cfg.maxBytesPerFrame = (uint32_t)sizeof(HeatmapCodec_TileHeader) + 2U * HEATMAP_CODEC_TILE_SIZE - 1U;
+    retVal[7] = HeatmapCodec_encoderInit(&gCheckCodec.enc, &cfg, CHECK_NUM_SAMPLES, CHECK_NUM_RANGE_BINS,
+                                         CHECK_NUM_ANGLE_BINS, 1U, gCheckCodec.ref, gCheckCodec.stale,
+                                         (uint8_t *) gCheckCodec.out);
+    HeatmapCodec_getDefaultCfg(&cfg, 12U);
+    retVal[8] = HeatmapCodec_encoderInit(&gCheckCodec.enc, &cfg, CHECK_NUM_SAMPLES, CHECK_NUM_RANGE_BINS,
+                                         CHECK_NUM_ANGLE_BINS, 1U, gCheckCodec.ref, gCheckCodec.stale,
+                                         (uint8_t *) gCheckCodec.out);
+
+    for (i = 0; i < 9U; i++)
+    {
+        if (retVal[i] != expected[i])
+        {
+            printf("    FAIL: malformed case %u returned %d, expected %d\n", i, retVal[i], expected[i]);
+            numErrors++;
+        }
+    }
+    printf("malformed payloads and configurations: %u of 9 rejected\n", 9U - numErrors);
+    return numErrors;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t numErrors = 0;
+    uint32_t smallBudget = CHECK_SMALL_BUDGET_TILES * ((uint32_t)sizeof(HeatmapCodec_TileHeader) + 2U * HEATMAP_CODEC_TILE_SIZE);
+    uint32_t fullBudget = CHECK_NUM_TILES * ((uint32_t)sizeof(HeatmapCodec_TileHeader) + 2U * HEATMAP_CODEC_TILE_SIZE);
+
+    gCheckNumFrames = (argc > 1) ? (uint32_t) strtoul(argv[1], NULL, 0) : CHECK_DEFAULT_NUM_FRAMES;
+
+    numErrors += Check_roundTrip(8U, fullBudget);
+    numErrors += Check_roundTrip(16U, fullBudget);
+    numErrors += Check_roundTrip(8U, smallBudget);
+    numErrors += Check_roundTrip(16U, smallBudget);
+    numErrors += Check_roundTrip(8U, HEATMAP_CODEC_DEFAULT_MAX_BYTES);
+    numErrors += Check_loss(8U);
+    numErrors += Check_loss(16U);
+    numErrors += Check_malformed();
+
+    printf("%s: %u failed checks\n", (numErrors == 0U) ? "PASS" : "FAIL", numErrors);
+    return (numErrors == 0U) ? 0 : 1;
+}
@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <kernel/dpl/ClockP.h>
 #include <kernel/dpl/SemaphoreP.h>
+#include <kernel/dpl/CacheP.h>
 
 #include <drivers/ipc_notify.h>
 #include <drivers/uart.h>
@@ -95,3 +96,96 @@ void MsgIpc_sendMessage(MsgIpc_CtrlObj * obj, uint32_t message, uint32_t arg)
     status = IpcNotify_sendMsg(obj->remoteCoreId, obj->msgChanId, msgValue, 1);
     DebugP_assert(status==SystemP_SUCCESS);
 }
+
+#if defined(_TMS320C6X)
+/* The DSS caches the shared L3 in L1D */
+static void MsgIpc_mboxCacheWb(void *addr, uint32_t size)
+{
+    CacheP_wb(addr, size, CacheP_TYPE_ALL);
+}
+
+static void MsgIpc_mboxCacheInv(void *addr, uint32_t size)
+{
+    CacheP_inv(addr, size, CacheP_TYPE_ALL);
+}
+#endif
+
+static void MsgIpc_mboxDoorbell(void *arg, uint32_t prodIdx)
+{
+    MsgIpc_sendMessage((MsgIpc_CtrlObj *) arg, MSG_IPC_MBOX_DOORBELL, prodIdx);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sets up the mailbox in the IPC window of the shared L3. The owner (MSS) must call it before MsgIpc_Sync(),
+ *      the other core after.
+ *
+ *  @param[in]  obj         Message IPC object, configured
+ *  @param[in]  localId     MSG_MBOX_ID_MSS or MSG_MBOX_ID_DSS
+ *  @param[in]  isOwner     Initializes the shared memory
+ *
+ *  @retval
+ *      0 on success, MSG_MBOX_xxx error code otherwise
+ */
+int32_t MsgIpc_mboxConfig(MsgIpc_CtrlObj * obj, uint32_t localId, bool isOwner)
+{
+    MsgMbox_Cfg cfg;
+
+    memset((void *)&cfg, 0, sizeof(MsgMbox_Cfg));
+    cfg.shm                 = (MsgMbox_Shm *) MSG_MBOX_SHM_ADDR;
+    cfg.bufWindowAddr       = MSG_MBOX_BUF_WINDOW_ADDR;
+    cfg.bufWindowSize       = MSG_MBOX_BUF_WINDOW_SIZE;
+    cfg.localId             = localId;
+    cfg.isOwner             = isOwner;
+    cfg.bufChecksumEnable   = MSG_IPC_MBOX_BUF_CHECKSUM_ENABLE;
+#if defined(_TMS320C6X)
+    cfg.platformCfg.cacheWb     = MsgIpc_mboxCacheWb;
+    cfg.platformCfg.cacheInv    = MsgIpc_mboxCacheInv;
+#else
+    /* The R5F maps the shared L3 non cached (MPU region 0) */
+    cfg.platformCfg.cacheWb     = NULL;
+    cfg.platformCfg.cacheInv    = NULL;
+#endif
+    cfg.platformCfg.doorbell    = MsgIpc_mboxDoorbell;
+    cfg.platformCfg.doorbellArg = (void *) obj;
+
+    return MsgMbox_init(&obj->mbox, &cfg);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Posts a message in the mailbox and rings the doorbell of the remote core.
+ *
+ *  @param[in]  obj         Message IPC object
+ *  @param[in]  message     Message identifier, DPC_xxx_TO_xxx_xxx
+ *  @param[in]  frameNum    Frame number
+ *  @param[in]  buf         Buffers, in the shared L3 and cache line aligned
+ *  @param[in]  numBufs     Number of buffers
+ *
+ *  @retval
+ *      0 on success, MSG_MBOX_xxx error code otherwise
+ */
+int32_t MsgIpc_post(MsgIpc_CtrlObj * obj, uint32_t message, uint32_t frameNum,
+                    const MsgMbox_Buf * buf, uint32_t numBufs)
+{
+    return MsgMbox_send(&obj->mbox, message, frameNum, buf, numBufs);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Takes the next message from the mailbox, called on the doorbell until it returns MSG_MBOX_EEMPTY.
+ *
+ *  @param[in]  obj     Message IPC object
+ *  @param[out] msg     Message
+ *
+ *  @retval
+ *      0 on success, MSG_MBOX_EEMPTY or MSG_MBOX_ENOTREADY if there is nothing to read, MSG_MBOX_xxx error
+ *      code if a message was dropped
+ */
+int32_t MsgIpc_receive(MsgIpc_CtrlObj * obj, MsgMbox_Msg * msg)
+{
+    return MsgMbox_receive(&obj->mbox, msg);
+}
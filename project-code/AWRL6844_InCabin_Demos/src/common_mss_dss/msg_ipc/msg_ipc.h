@@ -43,6 +43,7 @@ extern "C" {
 #include <drivers/soc.h>
 #include <drivers/ipc_notify.h>
 #include <common/syscommon.h>
+#include <common_mss_dss/msg_ipc/msg_mbox.h>
 
 /**************************************************************************
  **************************************************************************/
@@ -56,6 +57,14 @@ extern "C" {
 #define DPC_DSS_TO_MSS_CONFIGURATION_COMPLETED  100
 #define DPC_DSS_TO_MSS_POINT_CLOUD_READY        101
 
+/* IPC notify message: new messages in the mailbox, the argument is the producer index */
+#define MSG_IPC_MBOX_DOORBELL                   200
+
+/* Checksum the mailbox buffers, for debug: costs a pass over the radar cube every frame */
+#ifndef MSG_IPC_MBOX_BUF_CHECKSUM_ENABLE
+#define MSG_IPC_MBOX_BUF_CHECKSUM_ENABLE        0
+#endif
+
 
 /**************************************************************************
  **************************  Data Structures ***************************
@@ -90,6 +99,11 @@ typedef struct MsgIpc_CtrlObj_t
      */
     bool    isMsgIpcInitialized;
 
+    /**
+     * @brief   Shared memory mailbox carrying the messages
+     */
+    MsgMbox_Obj mbox;
+
 } MsgIpc_CtrlObj;
 
 typedef struct MsgIpc_Cfg_t
@@ -127,6 +141,13 @@ void MsgIpc_Sync();
 
 void MsgIpc_sendMessage(MsgIpc_CtrlObj * obj, uint32_t message, uint32_t arg);
 
+int32_t MsgIpc_mboxConfig(MsgIpc_CtrlObj * obj, uint32_t localId, bool isOwner);
+
+int32_t MsgIpc_post(MsgIpc_CtrlObj * obj, uint32_t message, uint32_t frameNum,
+                    const MsgMbox_Buf * buf, uint32_t numBufs);
+
+int32_t MsgIpc_receive(MsgIpc_CtrlObj * obj, MsgMbox_Msg * msg);
+
 
 
 
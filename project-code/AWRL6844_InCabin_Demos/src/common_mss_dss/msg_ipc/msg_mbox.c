@@ -0,0 +1,359 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_TMS320C6X)
+#include <c6x.h>
+#endif
+
+#include <common_mss_dss/msg_ipc/msg_mbox.h>
+
+/* Orders the accesses to a slot and to the index that publishes it */
+#if defined(_TMS320C6X)
+#define MSG_MBOX_MEM_BARRIER()      _mfence()
+#else
+#define MSG_MBOX_MEM_BARRIER()      __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/* The slots, the indices and the header each fill whole cache lines */
+typedef char MsgMbox_SlotSizeCheck[(sizeof(MsgMbox_Slot) == MSG_MBOX_CACHE_LINE_SIZE) ? 1 : -1];
+typedef char MsgMbox_IndexSizeCheck[(sizeof(MsgMbox_Index) == MSG_MBOX_CACHE_LINE_SIZE) ? 1 : -1];
+typedef char MsgMbox_ShmSizeCheck[(sizeof(MsgMbox_Shm) <= MSG_MBOX_SHM_SIZE) ? 1 : -1];
+
+static void MsgMbox_cacheWb(MsgMbox_Obj *obj, void *addr, uint32_t size)
+{
+    if ((obj->cfg.platformCfg.cacheWb != NULL) && (size > 0U))
+    {
+        obj->cfg.platformCfg.cacheWb(addr, MSG_MBOX_CACHE_LINE_ROUND_UP(size));
+    }
+}
+
+static void MsgMbox_cacheInv(MsgMbox_Obj *obj, void *addr, uint32_t size)
+{
+    if ((obj->cfg.platformCfg.cacheInv != NULL) && (size > 0U))
+    {
+        obj->cfg.platformCfg.cacheInv(addr, MSG_MBOX_CACHE_LINE_ROUND_UP(size));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Lightweight 32-bit checksum (Fletcher style sums over 32-bit words) of the slots and buffers.
+ *
+ *  @param[in]  data    Data
+ *  @param[in]  size    Size in bytes
+ *
+ *  @retval
+ *      Checksum
+ */
+uint32_t MsgMbox_checksum(const void *data, uint32_t size)
+{
+    const uint8_t *ptr = (const uint8_t *) data;
+    uint32_t sum1 = 1U;
+    uint32_t sum2 = 0U;
+    uint32_t word;
+    uint32_t idx;
+
+    for (idx = 0; (idx + sizeof(uint32_t)) <= size; idx += sizeof(uint32_t))
+    {
+        memcpy(&word, &ptr[idx], sizeof(uint32_t));
+        sum1 += word;
+        sum2 += sum1;
+    }
+    for (; idx < size; idx++)
+    {
+        sum1 += ptr[idx];
+        sum2 += sum1;
+    }
+    return sum1 ^ ((sum2 << 16) | (sum2 >> 16));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Initializes the local end of the mailbox. The owner core clears the shared memory and must be done before
+ *      the other core attaches, e.g. by calling it before the IPC sync.
+ *
+ *  @param[in]  obj     Mailbox object
+ *  @param[in]  cfg     Configuration, copied
+ *
+ *  @retval
+ *      0 on success, MSG_MBOX_EINVAL or MSG_MBOX_ENOTREADY otherwise
+ */
+int32_t MsgMbox_init(MsgMbox_Obj *obj, const MsgMbox_Cfg *cfg)
+{
+    int32_t retVal = 0;
+    MsgMbox_Shm *shm;
+
+    if ((obj == NULL) || (cfg == NULL) || (cfg->shm == NULL) || (cfg->localId > MSG_MBOX_ID_DSS))
+    {
+        retVal = MSG_MBOX_EINVAL;
+        goto exit;
+    }
+
+    memset((void *)obj, 0, sizeof(MsgMbox_Obj));
+    obj->cfg = *cfg;
+    shm = cfg->shm;
+    obj->txQueue = &shm->queue[cfg->localId];
+    obj->rxQueue = &shm->queue[1U - cfg->localId];
+
+    if (cfg->isOwner)
+    {
+        memset((void *)shm, 0, sizeof(MsgMbox_Shm));
+        shm->numSlots = MSG_MBOX_NUM_SLOTS;
+        shm->slotSize = sizeof(MsgMbox_Slot);
+        MSG_MBOX_MEM_BARRIER();
+        shm->magic = MSG_MBOX_MAGIC;
+        MsgMbox_cacheWb(obj, (void *)shm, sizeof(MsgMbox_Shm));
+    }
+    else
+    {
+        MsgMbox_cacheInv(obj, (void *)shm, sizeof(MsgMbox_Shm));
+        if ((shm->magic != MSG_MBOX_MAGIC) || (shm->numSlots != MSG_MBOX_NUM_SLOTS) ||
+            (shm->slotSize != sizeof(MsgMbox_Slot)))
+        {
+            retVal = MSG_MBOX_ENOTREADY;
+            goto exit;
+        }
+    }
+
+    obj->isInitialized = true;
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Posts a message and rings the doorbell of the remote core. The buffers are written back from the local
+ *      cache, the caller must not modify them until the remote core is done with them.
+ *
+ *  @param[in]  obj         Mailbox object
+ *  @param[in]  msgId       Message identifier
+ *  @param[in]  frameNum    Frame number
+ *  @param[in]  buf         Buffers, may be NULL if numBufs is 0
+ *  @param[in]  numBufs     Number of buffers, up to MSG_MBOX_MAX_NUM_BUFS
+ *
+ *  @retval
+ *      0 on success, MSG_MBOX_EFULL if all the slots are in flight, MSG_MBOX_EINVAL or MSG_MBOX_EALIGN otherwise
+ */
+int32_t MsgMbox_send(MsgMbox_Obj *obj, uint32_t msgId, uint32_t frameNum, const MsgMbox_Buf *buf, uint32_t numBufs)
+{
+    int32_t retVal = 0;
+    MsgMbox_Queue *queue;
+    MsgMbox_Slot slot;
+    uint32_t prodIdx;
+    uint32_t consIdx;
+    uint32_t offset;
+    uint32_t bufIdx;
+
+    if ((obj == NULL) || (!obj->isInitialized) || (numBufs > MSG_MBOX_MAX_NUM_BUFS) ||
+        ((buf == NULL) && (numBufs > 0U)) || (msgId > 0xFFFFU))
+    {
+        retVal = MSG_MBOX_EINVAL;
+        goto exit;
+    }
+    queue = obj->txQueue;
+
+    MsgMbox_cacheInv(obj, (void *)&queue->consIdx, sizeof(MsgMbox_Index));
+    prodIdx = queue->prodIdx.idx;
+    consIdx = queue->consIdx.idx;
+    if ((prodIdx - consIdx) >= MSG_MBOX_NUM_SLOTS)
+    {
+        obj->numFull++;
+        retVal = MSG_MBOX_EFULL;
+        goto exit;
+    }
+
+    memset((void *)&slot, 0, sizeof(MsgMbox_Slot));
+    slot.seq        = prodIdx;
+    slot.msgId      = (uint16_t) msgId;
+    slot.numBufs    = (uint8_t) numBufs;
+    slot.frameNum   = frameNum;
+    if (obj->cfg.bufChecksumEnable)
+    {
+        slot.flags |= MSG_MBOX_FLAG_BUF_CHECKSUM;
+    }
+
+    for (bufIdx = 0; bufIdx < numBufs; bufIdx++)
+    {
+        if (((uintptr_t) buf[bufIdx].addr < obj->cfg.bufWindowAddr) ||
+            (((uintptr_t) buf[bufIdx].addr - obj->cfg.bufWindowAddr) > (uintptr_t) obj->cfg.bufWindowSize))
+        {
+            retVal = MSG_MBOX_EINVAL;
+            goto exit;
+        }
+        offset = (uint32_t) ((uintptr_t) buf[bufIdx].addr - obj->cfg.bufWindowAddr);
+        if (buf[bufIdx].size > (obj->cfg.bufWindowSize - offset))
+        {
+            retVal = MSG_MBOX_EINVAL;
+            goto exit;
+        }
+        if ((offset & (MSG_MBOX_CACHE_LINE_SIZE - 1U)) != 0U)
+        {
+            retVal = MSG_MBOX_EALIGN;
+            goto exit;
+        }
+
+        slot.buf[bufIdx].offset = offset;
+        slot.buf[bufIdx].size   = buf[bufIdx].size;
+        if (obj->cfg.bufChecksumEnable)
+        {
+            slot.buf[bufIdx].checksum = MsgMbox_checksum(buf[bufIdx].addr, buf[bufIdx].size);
+        }
+        MsgMbox_cacheWb(obj, buf[bufIdx].addr, buf[bufIdx].size);
+    }
+    slot.checksum = MsgMbox_checksum(&slot, offsetof(MsgMbox_Slot, checksum));
+
+    /* Fill the slot, then publish it */
+    queue->slot[prodIdx & (MSG_MBOX_NUM_SLOTS - 1U)] = slot;
+    MsgMbox_cacheWb(obj, (void *)&queue->slot[prodIdx & (MSG_MBOX_NUM_SLOTS - 1U)], sizeof(MsgMbox_Slot));
+    MSG_MBOX_MEM_BARRIER();
+    queue->prodIdx.idx = prodIdx + 1U;
+    MsgMbox_cacheWb(obj, (void *)&queue->prodIdx, sizeof(MsgMbox_Index));
+    MSG_MBOX_MEM_BARRIER();
+
+    obj->numSent++;
+    if (obj->cfg.platformCfg.doorbell != NULL)
+    {
+        obj->cfg.platformCfg.doorbell(obj->cfg.platformCfg.doorbellArg, prodIdx + 1U);
+    }
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Takes the oldest message of the receive ring. The buffers are invalidated in the local cache. A message
+ *      failing the checks is consumed and dropped, so the caller can keep draining the ring.
+ *
+ *  @param[in]  obj     Mailbox object
+ *  @param[out] msg     Message
+ *
+ *  @retval
+ *      0 on success, MSG_MBOX_EEMPTY if there is no message, MSG_MBOX_ENOTREADY if the mailbox is not
+ *      initialized, MSG_MBOX_ECHECKSUM, MSG_MBOX_ESEQ or MSG_MBOX_EINVAL if a message was dropped
+ */
+int32_t MsgMbox_receive(MsgMbox_Obj *obj, MsgMbox_Msg *msg)
+{
+    int32_t retVal = 0;
+    MsgMbox_Queue *queue;
+    MsgMbox_Slot slot;
+    uint32_t prodIdx;
+    uint32_t consIdx;
+    uint32_t bufIdx;
+
+    if ((obj == NULL) || (msg == NULL))
+    {
+        return MSG_MBOX_EINVAL;
+    }
+    if (!obj->isInitialized)
+    {
+        return MSG_MBOX_ENOTREADY;
+    }
+    queue = obj->rxQueue;
+
+    MsgMbox_cacheInv(obj, (void *)&queue->prodIdx, sizeof(MsgMbox_Index));
+    prodIdx = queue->prodIdx.idx;
+    consIdx = queue->consIdx.idx;
+    if (prodIdx == consIdx)
+    {
+        return MSG_MBOX_EEMPTY;
+    }
+    MSG_MBOX_MEM_BARRIER();
+
+    MsgMbox_cacheInv(obj, (void *)&queue->slot[consIdx & (MSG_MBOX_NUM_SLOTS - 1U)], sizeof(MsgMbox_Slot));
+    slot = queue->slot[consIdx & (MSG_MBOX_NUM_SLOTS - 1U)];
+
+    memset((void *)msg, 0, sizeof(MsgMbox_Msg));
+    if ((slot.checksum != MsgMbox_checksum(&slot, offsetof(MsgMbox_Slot, checksum))) ||
+        (slot.numBufs > MSG_MBOX_MAX_NUM_BUFS))
+    {
+        retVal = MSG_MBOX_ECHECKSUM;
+        goto exit;
+    }
+    if (slot.seq != consIdx)
+    {
+        retVal = MSG_MBOX_ESEQ;
+        goto exit;
+    }
+
+    msg->msgId      = slot.msgId;
+    msg->frameNum   = slot.frameNum;
+    msg->numBufs    = slot.numBufs;
+    for (bufIdx = 0; bufIdx < slot.numBufs; bufIdx++)
+    {
+        if ((slot.buf[bufIdx].offset > obj->cfg.bufWindowSize) ||
+            (slot.buf[bufIdx].size > (obj->cfg.bufWindowSize - slot.buf[bufIdx].offset)))
+        {
+            retVal = MSG_MBOX_EINVAL;
+            goto exit;
+        }
+        msg->buf[bufIdx].addr = (void *) (obj->cfg.bufWindowAddr + slot.buf[bufIdx].offset);
+        msg->buf[bufIdx].size = slot.buf[bufIdx].size;
+        MsgMbox_cacheInv(obj, msg->buf[bufIdx].addr, msg->buf[bufIdx].size);
+
+        if (((slot.flags & MSG_MBOX_FLAG_BUF_CHECKSUM) != 0U) &&
+            (slot.buf[bufIdx].checksum != MsgMbox_checksum(msg->buf[bufIdx].addr, msg->buf[bufIdx].size)))
+        {
+            retVal = MSG_MBOX_ECHECKSUM;
+            goto exit;
+        }
+    }
+
+exit:
+    /* Release the slot */
+    MSG_MBOX_MEM_BARRIER();
+    queue->consIdx.idx = consIdx + 1U;
+    MsgMbox_cacheWb(obj, (void *)&queue->consIdx, sizeof(MsgMbox_Index));
+
+    if (retVal == 0)
+    {
+        obj->numReceived++;
+    }
+    else
+    {
+        obj->numDropped++;
+    }
+    return retVal;
+}
@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Shared memory mailbox between the MSS and the DSS
+ *
+ * Messages are fixed size slot descriptors (message identifier, frame number, buffer offsets, sizes and
+ * checksums) in two single producer / single consumer rings, one per direction, in the reserved IPC window at
+ * the start of the shared L3. The producer fills the next free slot and advances its producer index, the
+ * consumer copies the slot out and advances its consumer index, so up to MSG_MBOX_NUM_SLOTS messages (frames)
+ * can be in flight per direction. The only thing left to the core to core interrupt is the doorbell: it tells the
+ * consumer to drain the ring and carries no data.
+ *
+ * Cache rules
+ *  - The producer and consumer indices, and every slot, each own a full MSG_MBOX_CACHE_LINE_SIZE line, so a core
+ *    never writes back a line the other core is writing.
+ *  - Buffers start on a cache line. The producer writes a buffer back before posting it and the consumer
+ *    invalidates it before returning it, rounded up to whole lines, which is only safe when nothing else shares
+ *    the first and last line of the buffer.
+ *  - The cache operations are provided by the caller (MsgMbox_PlatformCfg) and left NULL on a core that does not
+ *    cache the shared L3.
+ *
+ * The module has no dependency on the SDK drivers or the RTOS, two host threads sharing an MsgMbox_Shm emulate
+ * the two cores (tools/msg_mbox_host_check.sh).
+ *
+ * The receiver drains the ring in task context: the doorbell interrupt handler only wakes up the task.
+ */
+
+#ifndef MSG_MBOX_H
+#define MSG_MBOX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**************************************************************************
+ **************************************************************************/
+
+/*! @brief Invalid argument, or buffer outside of the shared window */
+#define MSG_MBOX_EINVAL                     (-1)
+
+/*! @brief Buffer not aligned to a cache line */
+#define MSG_MBOX_EALIGN                     (-2)
+
+/*! @brief All the slots are in flight */
+#define MSG_MBOX_EFULL                      (-3)
+
+/*! @brief No message */
+#define MSG_MBOX_EEMPTY                     (-4)
+
+/*! @brief Shared memory not initialized by the owner core */
+#define MSG_MBOX_ENOTREADY                  (-5)
+
+/*! @brief Slot or buffer checksum mismatch, the message is dropped */
+#define MSG_MBOX_ECHECKSUM                  (-6)
+
+/*! @brief Slot sequence number mismatch, the message is dropped */
+#define MSG_MBOX_ESEQ                       (-7)
+
+/*! @brief Shared memory header magic word, "MBOX" */
+#define MSG_MBOX_MAGIC                      0x584F424DU
+
+/*! @brief Shared memory: IPC window at the start of the shared L3, same address on both cores */
+#define MSG_MBOX_SHM_ADDR                   0x88000000U
+#define MSG_MBOX_SHM_SIZE                   0x400U
+
+/*! @brief Buffer window: shared L3, buffers are exchanged as offsets from its start */
+#define MSG_MBOX_BUF_WINDOW_ADDR            0x88000000U
+#define MSG_MBOX_BUF_WINDOW_SIZE            0x160000U
+
+/*! @brief Largest cache line of the two cores (C66 L1D) */
+#define MSG_MBOX_CACHE_LINE_SIZE            64U
+
+/*! @brief Size rounded up to whole cache lines, for the allocation of the buffers */
+#define MSG_MBOX_CACHE_LINE_ROUND_UP(size)  (((size) + (MSG_MBOX_CACHE_LINE_SIZE - 1U)) & ~(MSG_MBOX_CACHE_LINE_SIZE - 1U))
+
+/*! @brief Slots per direction, power of 2 */
+#define MSG_MBOX_NUM_SLOTS                  4U
+
+/*! @brief Buffers per message */
+#define MSG_MBOX_MAX_NUM_BUFS               3U
+
+/*! @brief Mailbox ends, select the transmit and receive rings */
+#define MSG_MBOX_ID_MSS                     0U
+#define MSG_MBOX_ID_DSS                     1U
+
+/*! @brief Slot flag: buffer checksums are valid */
+#define MSG_MBOX_FLAG_BUF_CHECKSUM          0x01U
+
+/**************************************************************************
+ **************************  Data Structures ***************************
+ **************************************************************************/
+
+/**
+ * @brief  Buffer descriptor in a slot
+ */
+typedef struct MsgMbox_BufDesc_t
+{
+    /*! @brief Offset from MSG_MBOX_BUF_WINDOW_ADDR */
+    uint32_t    offset;
+
+    /*! @brief Size in bytes */
+    uint32_t    size;
+
+    /*! @brief MsgMbox_checksum() of the buffer, if MSG_MBOX_FLAG_BUF_CHECKSUM */
+    uint32_t    checksum;
+} MsgMbox_BufDesc;
+
+/**
+ * @brief  Message slot, one cache line
+ */
+typedef struct MsgMbox_Slot_t
+{
+    /*! @brief Producer index the slot was written at */
+    uint32_t        seq;
+
+    /*! @brief Message identifier */
+    uint16_t        msgId;
+
+    /*! @brief Number of valid buffers */
+    uint8_t         numBufs;
+
+    /*! @brief MSG_MBOX_FLAG_xxx */
+    uint8_t         flags;
+
+    /*! @brief Frame number */
+    uint32_t        frameNum;
+
+    /*! @brief Buffers */
+    MsgMbox_BufDesc buf[MSG_MBOX_MAX_NUM_BUFS];
+
+    /*! @brief MsgMbox_checksum() of the slot up to this field */
+    uint32_t        checksum;
+
+    uint32_t        reserved[3];
+} MsgMbox_Slot;
+
+/**
+ * @brief  Ring index, written by one core only, one cache line
+ */
+typedef struct MsgMbox_Index_t
+{
+    /*! @brief Free running index */
+    volatile uint32_t   idx;
+
+    uint32_t            reserved[(MSG_MBOX_CACHE_LINE_SIZE / sizeof(uint32_t)) - 1U];
+} MsgMbox_Index;
+
+/**
+ * @brief  Ring of one direction
+ */
+typedef struct MsgMbox_Queue_t
+{
+    /*! @brief Number of messages posted, written by the producer */
+    MsgMbox_Index   prodIdx;
+
+    /*! @brief Number of messages consumed, written by the consumer */
+    MsgMbox_Index   consIdx;
+
+    /*! @brief Slots, message n is in slot[n % MSG_MBOX_NUM_SLOTS] */
+    MsgMbox_Slot    slot[MSG_MBOX_NUM_SLOTS];
+} MsgMbox_Queue;
+
+/**
+ * @brief  Shared memory layout
+ */
+typedef struct MsgMbox_Shm_t
+{
+    /*! @brief MSG_MBOX_MAGIC once initialized by the owner */
+    uint32_t        magic;
+
+    /*! @brief Layout check: MSG_MBOX_NUM_SLOTS */
+    uint32_t        numSlots;
+
+    /*! @brief Layout check: sizeof(MsgMbox_Slot) */
+    uint32_t        slotSize;
+
+    uint32_t        reserved[(MSG_MBOX_CACHE_LINE_SIZE / sizeof(uint32_t)) - 3U];
+
+    /*! @brief Rings, indexed by the producer MSG_MBOX_ID_xxx */
+    MsgMbox_Queue   queue[2];
+} MsgMbox_Shm;
+
+/**
+ * @brief  Buffer of a message
+ */
+typedef struct MsgMbox_Buf_t
+{
+    /*! @brief Address, in the buffer window and aligned to MSG_MBOX_CACHE_LINE_SIZE */
+    void        *addr;
+
+    /*! @brief Size in bytes */
+    uint32_t    size;
+} MsgMbox_Buf;
+
+/**
+ * @brief  Received message
+ */
+typedef struct MsgMbox_Msg_t
+{
+    /*! @brief Message identifier */
+    uint32_t    msgId;
+
+    /*! @brief Frame number */
+    uint32_t    frameNum;
+
+    /*! @brief Number of valid buffers */
+    uint32_t    numBufs;
+
+    /*! @brief Buffers */
+    MsgMbox_Buf buf[MSG_MBOX_MAX_NUM_BUFS];
+} MsgMbox_Msg;
+
+/**
+ * @brief  Platform services
+ */
+typedef struct MsgMbox_PlatformCfg_t
+{
+    /*! @brief Writes back a range of the local cache, NULL if the shared memory is not cached */
+    void (*cacheWb)(void *addr, uint32_t size);
+
+    /*! @brief Invalidates a range of the local cache, NULL if the shared memory is not cached */
+    void (*cacheInv)(void *addr, uint32_t size);
+
+    /*! @brief Rings the doorbell of the remote core */
+    void (*doorbell)(void *arg, uint32_t prodIdx);
+
+    /*! @brief Argument of doorbell */
+    void *doorbellArg;
+} MsgMbox_PlatformCfg;
+
+/**
+ * @brief  Mailbox configuration
+ */
+typedef struct MsgMbox_Cfg_t
+{
+    /*! @brief Shared memory, MSG_MBOX_SHM_ADDR on the target */
+    MsgMbox_Shm     *shm;
+
+    /*! @brief Start of the buffer window */
+    uintptr_t       bufWindowAddr;
+
+    /*! @brief Size of the buffer window */
+    uint32_t        bufWindowSize;
+
+    /*! @brief Local end, MSG_MBOX_ID_xxx */
+    uint32_t        localId;
+
+    /*! @brief The owner initializes the shared memory, the other core only attaches to it */
+    bool            isOwner;
+
+    /*! @brief Checksum the buffers of the sent messages (the slots are always checksummed) */
+    bool            bufChecksumEnable;
+
+    /*! @brief Platform services */
+    MsgMbox_PlatformCfg platformCfg;
+} MsgMbox_Cfg;
+
+/**
+ * @brief  Mailbox object, local to a core
+ */
+typedef struct MsgMbox_Obj_t
+{
+    /*! @brief Configuration */
+    MsgMbox_Cfg     cfg;
+
+    /*! @brief Ring written by the local core */
+    MsgMbox_Queue   *txQueue;
+
+    /*! @brief Ring read by the local core */
+    MsgMbox_Queue   *rxQueue;
+
+    /*! @brief Number of messages sent */
+    uint32_t        numSent;
+
+    /*! @brief Number of messages received */
+    uint32_t        numReceived;
+
+    /*! @brief Number of messages not sent because the ring was full */
+    uint32_t        numFull;
+
+    /*! @brief Number of messages dropped on a checksum or sequence error */
+    uint32_t        numDropped;
+
+    /*! @brief Mailbox ready */
+    bool            isInitialized;
+} MsgMbox_Obj;
+
+/**************************************************************************
+ *************************** Extern Definitions ***************************
+ **************************************************************************/
+
+int32_t MsgMbox_init(MsgMbox_Obj *obj, const MsgMbox_Cfg *cfg);
+
+int32_t MsgMbox_send(MsgMbox_Obj *obj, uint32_t msgId, uint32_t frameNum, const MsgMbox_Buf *buf, uint32_t numBufs);
+
+int32_t MsgMbox_receive(MsgMbox_Obj *obj, MsgMbox_Msg *msg);
+
+uint32_t MsgMbox_checksum(const void *data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSG_MBOX_H */
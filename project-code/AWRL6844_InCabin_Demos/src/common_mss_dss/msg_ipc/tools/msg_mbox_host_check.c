@@ -0,0 +1,406 @@
+/**
+ *   @file  msg_mbox_host_check.c
+ *
+ *   @brief
+ *      Host check of the shared memory mailbox, two threads emulating the two cores.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: msg_mbox_host_check [number of frames]
+ *
+ *  Two host threads share an MsgMbox_Shm and a buffer window, as the MSS and the DSS share the IPC window
+ *  of the L3. Each doorbell posts a semaphore of the remote end, and a receive thread per end drains the
+ *  ring on it, as the doorbell interrupt and the message task do on the target:
+ *  - the MSS thread posts a radar cube ready message per frame, with a buffer filled with a pattern of
+ *    the frame, keeping up to MSG_MBOX_NUM_SLOTS frames in flight
+ *  - the DSS receive thread checks the message, the frame number order and the buffer, and replies with a
+ *    point cloud ready message that echoes the frame number, with a result buffer
+ *  - the MSS receive thread checks the reply and returns the credit of the frame
+ *  The slot and buffer checksums are enabled. A single thread check then corrupts a slot and replays one,
+ *  which must be dropped with MSG_MBOX_ECHECKSUM and MSG_MBOX_ESEQ while the next message goes through.
+ *  The exit status is 0 if all checks pass.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+
+#include <common_mss_dss/msg_ipc/msg_mbox.h>
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+#define CHECK_MSG_RADAR_CUBE_READY      1U
+#define CHECK_MSG_POINT_CLOUD_READY     101U
+#define CHECK_MSG_STOP                  2U
+
+#define CHECK_DEFAULT_NUM_FRAMES        (100000U)
+
+/* Buffer window: one radar cube and one result buffer per slot */
+#define CHECK_CUBE_SIZE                 (4096U)
+#define CHECK_RESULT_SIZE               (256U)
+#define CHECK_WINDOW_SIZE               (MSG_MBOX_NUM_SLOTS * (CHECK_CUBE_SIZE + CHECK_RESULT_SIZE))
+
+/* One end of the mailbox */
+typedef struct CheckEnd_t
+{
+    MsgMbox_Obj mbox;
+    sem_t       doorbellSem;
+    pthread_t   rxThread;
+    uint32_t    numRx;
+    uint32_t    numErrors;
+    uint32_t    numFullRetries;
+} CheckEnd;
+
+/**************************************************************************
+ ************************** Global Variables ******************************
+ **************************************************************************/
+
+static MsgMbox_Shm gCheckShm __attribute__((aligned(MSG_MBOX_CACHE_LINE_SIZE)));
+static uint8_t gCheckWindow[CHECK_WINDOW_SIZE] __attribute__((aligned(MSG_MBOX_CACHE_LINE_SIZE)));
+static CheckEnd gCheckMss;
+static CheckEnd gCheckDss;
+static uint32_t gCheckNumFrames;
+
+/* Frames posted by the MSS and not yet answered, the credit of the MSS producer */
+static volatile uint32_t gCheckInFlight;
+
+/**************************************************************************
+ ************************** Helpers ***************************************
+ **************************************************************************/
+
+static uint8_t *Check_cube(uint32_t frameNum)
+{
+    return &gCheckWindow[(frameNum % MSG_MBOX_NUM_SLOTS) * CHECK_CUBE_SIZE];
+}
+
+static uint8_t *Check_result(uint32_t frameNum)
+{
+    return &gCheckWindow[(MSG_MBOX_NUM_SLOTS * CHECK_CUBE_SIZE) + ((frameNum % MSG_MBOX_NUM_SLOTS) * CHECK_RESULT_SIZE)];
+}
+
+static uint8_t Check_pattern(uint32_t frameNum, uint32_t i, uint32_t salt)
+{
+    return (uint8_t) ((frameNum * 2654435761U) ^ (i * 40503U) ^ salt);
+}
+
+static void Check_fill(uint8_t *buf, uint32_t size, uint32_t frameNum, uint32_t salt)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        buf[i] = Check_pattern(frameNum, i, salt);
+    }
+}
+
+static bool Check_verify(const uint8_t *buf, uint32_t size, uint32_t frameNum, uint32_t salt)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        if (buf[i] != Check_pattern(frameNum, i, salt))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Doorbell: posts the semaphore the remote receive thread pends on, as the IPC interrupt handler does */
+static void Check_doorbell(void *arg, uint32_t prodIdx)
+{
+    (void) prodIdx;
+    sem_post(&((CheckEnd *) arg)->doorbellSem);
+}
+
+static int32_t Check_mboxInit(CheckEnd *end, uint32_t localId, bool isOwner, CheckEnd *remote)
+{
+    MsgMbox_Cfg cfg;
+
+    memset((void *)&cfg, 0, sizeof(MsgMbox_Cfg));
+    cfg.shm                     = &gCheckShm;
+    cfg.bufWindowAddr           = (uintptr_t) gCheckWindow;
+    cfg.bufWindowSize           = CHECK_WINDOW_SIZE;
+    cfg.localId                 = localId;
+    cfg.isOwner                 = isOwner;
+    cfg.bufChecksumEnable       = true;
+    cfg.platformCfg.doorbell    = Check_doorbell;
+    cfg.platformCfg.doorbellArg = (void *) remote;
+    return MsgMbox_init(&end->mbox, &cfg);
+}
+
+/* Posts a message, retrying while the ring is full */
+static void Check_send(CheckEnd *end, uint32_t msgId, uint32_t frameNum, const MsgMbox_Buf *buf, uint32_t numBufs)
+{
+    int32_t retVal;
+
+    while ((retVal = MsgMbox_send(&end->mbox, msgId, frameNum, buf, numBufs)) == MSG_MBOX_EFULL)
+    {
+        end->numFullRetries++;
+        sched_yield();
+    }
+    if (retVal != 0)
+    {
+        printf("    FAIL: send of message %u frame %u returned %d\n", msgId, frameNum, retVal);
+        end->numErrors++;
+    }
+}
+
+/**************************************************************************
+ ************************** Receive threads *******************************
+ **************************************************************************/
+
+/* DSS message task: checks the radar cube and replies */
+static void *Check_dssRxThread(void *arg)
+{
+    MsgMbox_Msg msg;
+    MsgMbox_Buf buf;
+    int32_t retVal;
+    bool stop = false;
+
+    (void) arg;
+    while (!stop)
+    {
+        sem_wait(&gCheckDss.doorbellSem);
+        while ((retVal = MsgMbox_receive(&gCheckDss.mbox, &msg)) != MSG_MBOX_EEMPTY)
+        {
+            if (retVal != 0)
+            {
+                printf("    FAIL: DSS receive returned %d\n", retVal);
+                gCheckDss.numErrors++;
+                continue;
+            }
+            if (msg.msgId == CHECK_MSG_STOP)
+            {
+                stop = true;
+                break;
+            }
+            if ((msg.msgId != CHECK_MSG_RADAR_CUBE_READY) || (msg.frameNum != gCheckDss.numRx) ||
+                (msg.numBufs != 1U) || (msg.buf[0].addr != (void *) Check_cube(msg.frameNum)) ||
+                (msg.buf[0].size != CHECK_CUBE_SIZE) ||
+                !Check_verify((const uint8_t *) msg.buf[0].addr, CHECK_CUBE_SIZE, msg.frameNum, 0))
+            {
+                printf("    FAIL: DSS got message %u frame %u, expected frame %u\n", msg.msgId, msg.frameNum,
+                       gCheckDss.numRx);
+                gCheckDss.numErrors++;
+            }
+            gCheckDss.numRx++;
+
+            Check_fill(Check_result(msg.frameNum), CHECK_RESULT_SIZE, msg.frameNum, 0x5AU);
+            buf.addr = (void *) Check_result(msg.frameNum);
+            buf.size = CHECK_RESULT_SIZE;
+            Check_send(&gCheckDss, CHECK_MSG_POINT_CLOUD_READY, msg.frameNum, &buf, 1);
+        }
+    }
+    return NULL;
+}
+
+/* MSS message task: checks the point cloud and returns the credit */
+static void *Check_mssRxThread(void *arg)
+{
+    MsgMbox_Msg msg;
+    int32_t retVal;
+
+    (void) arg;
+    while (gCheckMss.numRx < gCheckNumFrames)
+    {
+        sem_wait(&gCheckMss.doorbellSem);
+        while ((retVal = MsgMbox_receive(&gCheckMss.mbox, &msg)) != MSG_MBOX_EEMPTY)
+        {
+            if (retVal != 0)
+            {
+                printf("    FAIL: MSS receive returned %d\n", retVal);
+                gCheckMss.numErrors++;
+                continue;
+            }
+            if ((msg.msgId != CHECK_MSG_POINT_CLOUD_READY) || (msg.frameNum != gCheckMss.numRx) ||
+                (msg.numBufs != 1U) || (msg.buf[0].addr != (void *) Check_result(msg.frameNum)) ||
+                !Check_verify((const uint8_t *) msg.buf[0].addr, CHECK_RESULT_SIZE, msg.frameNum, 0x5AU))
+            {
+                printf("    FAIL: MSS got message %u frame %u, expected frame %u\n", msg.msgId, msg.frameNum,
+                       gCheckMss.numRx);
+                gCheckMss.numErrors++;
+            }
+            gCheckMss.numRx++;
+            __atomic_fetch_sub(&gCheckInFlight, 1U, __ATOMIC_SEQ_CST);
+        }
+    }
+    return NULL;
+}
+
+/**************************************************************************
+ ************************** Checks ****************************************
+ **************************************************************************/
+
+/* Frames exchanged between the two threads */
+static uint32_t Check_twoThreads(void)
+{
+    MsgMbox_Buf buf;
+    uint32_t frameNum;
+    uint32_t numErrors;
+
+    printf("Two threads, %u frames\n", gCheckNumFrames);
+    memset((void *)&gCheckMss, 0, sizeof(CheckEnd));
+    memset((void *)&gCheckDss, 0, sizeof(CheckEnd));
+    sem_init(&gCheckMss.doorbellSem, 0, 0);
+    sem_init(&gCheckDss.doorbellSem, 0, 0);
+    gCheckInFlight = 0;
+
+    /* The owner initializes the shared memory before the other end attaches, as before the IPC sync */
+    if ((Check_mboxInit(&gCheckMss, MSG_MBOX_ID_MSS, true, &gCheckDss) != 0) ||
+        (Check_mboxInit(&gCheckDss, MSG_MBOX_ID_DSS, false, &gCheckMss) != 0))
+    {
+        printf("    FAIL: mailbox init\n");
+        return 1;
+    }
+    pthread_create(&gCheckDss.rxThread, NULL, Check_dssRxThread, NULL);
+    pthread_create(&gCheckMss.rxThread, NULL, Check_mssRxThread, NULL);
+
+    for (frameNum = 0; frameNum < gCheckNumFrames; frameNum++)
+    {
+        while (__atomic_load_n(&gCheckInFlight, __ATOMIC_SEQ_CST) >= MSG_MBOX_NUM_SLOTS)
+        {
+            sched_yield();
+        }
+        Check_fill(Check_cube(frameNum), CHECK_CUBE_SIZE, frameNum, 0);
+        __atomic_fetch_add(&gCheckInFlight, 1U, __ATOMIC_SEQ_CST);
+        buf.addr = (void *) Check_cube(frameNum);
+        buf.size = CHECK_CUBE_SIZE;
+        Check_send(&gCheckMss, CHECK_MSG_RADAR_CUBE_READY, frameNum, &buf, 1);
+    }
+    pthread_join(gCheckMss.rxThread, NULL);
+    Check_send(&gCheckMss, CHECK_MSG_STOP, 0, NULL, 0);
+    pthread_join(gCheckDss.rxThread, NULL);
+
+    numErrors = gCheckMss.numErrors + gCheckDss.numErrors + gCheckMss.mbox.numDropped + gCheckDss.mbox.numDropped;
+    printf("    MSS sent %u received %u, DSS sent %u received %u, ring full %u/%u times, %u dropped\n",
+           gCheckMss.mbox.numSent, gCheckMss.mbox.numReceived, gCheckDss.mbox.numSent, gCheckDss.mbox.numReceived,
+           gCheckMss.numFullRetries, gCheckDss.numFullRetries, gCheckMss.mbox.numDropped + gCheckDss.mbox.numDropped);
+    if ((gCheckMss.numRx != gCheckNumFrames) || (gCheckDss.numRx != gCheckNumFrames))
+    {
+        printf("    FAIL: %u/%u frames answered\n", gCheckMss.numRx, gCheckNumFrames);
+        numErrors++;
+    }
+    sem_destroy(&gCheckMss.doorbellSem);
+    sem_destroy(&gCheckDss.doorbellSem);
+    return numErrors;
+}
+
+/* A corrupted slot and a replayed slot are dropped, the ring keeps going */
+static uint32_t Check_corruption(void)
+{
+    MsgMbox_Queue *queue;
+    MsgMbox_Slot saved;
+    MsgMbox_Msg msg;
+    uint32_t numErrors = 0;
+    int32_t retVal;
+
+    printf("Corrupted and replayed slots\n");
+    memset((void *)&gCheckMss, 0, sizeof(CheckEnd));
+    memset((void *)&gCheckDss, 0, sizeof(CheckEnd));
+    sem_init(&gCheckMss.doorbellSem, 0, 0);
+    sem_init(&gCheckDss.doorbellSem, 0, 0);
+    Check_mboxInit(&gCheckMss, MSG_MBOX_ID_MSS, true, &gCheckDss);
+    Check_mboxInit(&gCheckDss, MSG_MBOX_ID_DSS, false, &gCheckMss);
+    queue = &gCheckShm.queue[MSG_MBOX_ID_MSS];
+
+    /* Message 0 corrupted in flight */
+    Check_send(&gCheckMss, CHECK_MSG_RADAR_CUBE_READY, 10, NULL, 0);
+    queue->slot[0].frameNum ^= 1U;
+    retVal = MsgMbox_receive(&gCheckDss.mbox, &msg);
+    if (retVal != MSG_MBOX_ECHECKSUM)
+    {
+        printf("    FAIL: corrupted slot returned %d\n", retVal);
+        numErrors++;
+    }
+
+    /* Message 1 good, then the producer index moves on while slot 2 still holds a stale message */
+    Check_send(&gCheckMss, CHECK_MSG_RADAR_CUBE_READY, 11, NULL, 0);
+    saved = queue->slot[1];
+    retVal = MsgMbox_receive(&gCheckDss.mbox, &msg);
+    if ((retVal != 0) || (msg.frameNum != 11U))
+    {
+        printf("    FAIL: message after the corrupted one returned %d\n", retVal);
+        numErrors++;
+    }
+    queue->slot[2] = saved;
+    queue->prodIdx.idx++;
+    retVal = MsgMbox_receive(&gCheckDss.mbox, &msg);
+    if (retVal != MSG_MBOX_ESEQ)
+    {
+        printf("    FAIL: replayed slot returned %d\n", retVal);
+        numErrors++;
+    }
+    Check_send(&gCheckMss, CHECK_MSG_RADAR_CUBE_READY, 12, NULL, 0);
+    retVal = MsgMbox_receive(&gCheckDss.mbox, &msg);
+    if ((retVal != 0) || (msg.frameNum != 12U) || (MsgMbox_receive(&gCheckDss.mbox, &msg) != MSG_MBOX_EEMPTY))
+    {
+        printf("    FAIL: message after the replayed one returned %d\n", retVal);
+        numErrors++;
+    }
+    if (gCheckDss.mbox.numDropped != 2U)
+    {
+        printf("    FAIL: %u messages dropped, expected 2\n", gCheckDss.mbox.numDropped);
+        numErrors++;
+    }
+    sem_destroy(&gCheckMss.doorbellSem);
+    sem_destroy(&gCheckDss.doorbellSem);
+    return numErrors;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t numErrors;
+
+    gCheckNumFrames = (argc > 1) ? (uint32_t) strtoul(argv[1], NULL, 0) : CHECK_DEFAULT_NUM_FRAMES;
+
+    numErrors = Check_twoThreads();
+    numErrors += Check_corruption();
+
+    printf("%s: %u failed checks\n", (numErrors == 0U) ? "PASS" : "FAIL", numErrors);
+    return (numErrors == 0U) ? 0 : 1;
+}
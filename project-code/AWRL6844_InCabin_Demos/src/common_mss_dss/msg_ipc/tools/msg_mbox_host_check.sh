@@ -0,0 +1,49 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the shared memory mailbox check on the host, two threads emulating the MSS and the DSS
+#
+#   msg_mbox_host_check.sh [number of frames]
+#
+# Needs a host C compiler with pthreads (CC, default cc). BUILD_DIR defaults to ./msg_mbox_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../../.."
+BUILD_DIR=${BUILD_DIR:-./msg_mbox_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+$CC -O2 -Wall -I "$SRC_DIR" -o "$BUILD_DIR/msg_mbox_host_check" \
+    "$TOOLS_DIR/msg_mbox_host_check.c" "$TOOLS_DIR/../msg_mbox.c" -lpthread
+"$BUILD_DIR/msg_mbox_host_check" "$@"
@@ -361,7 +361,7 @@ void DPC_ObjectDetection_init(DPC_DSS_ObjectDetection_InitParams *dpcInitParams,
     memset((void *)objDetObj, 0, sizeof(ObjDetObj));
 
 
-    objDetObj->executeResult = (DPC_DSS_ObjectDetection_ExecuteResult *) radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(DPC_DSS_ObjectDetection_ExecuteResult), 1);
+    objDetObj->executeResult = (DPC_DSS_ObjectDetection_ExecuteResult *) radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, MSG_MBOX_CACHE_LINE_ROUND_UP(sizeof(DPC_DSS_ObjectDetection_ExecuteResult)), MSG_MBOX_CACHE_LINE_SIZE);
     objDetObj->stats         = (DPC_DSS_ObjectDetection_Stats *) radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(DPC_DSS_ObjectDetection_Stats), 1);
 
     //*errCode = DPC_ObjDetDSP_initDPU(objDetObj, DEMO_RL_MAX_SUBFRAMES);
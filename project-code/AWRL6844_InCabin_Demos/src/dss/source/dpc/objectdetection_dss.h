@@ -180,14 +180,15 @@ extern "C"
      */
     typedef struct DPC_DSS_ObjectDetection_ExecuteResult_t
     {
+        /*! @brief      Detected objects output list of @ref numObjOut elements.
+         *              First member: posted to the MSS through the mailbox, it starts on a cache line */
+        DPIF_MSS_DSS_radarProcessOutput objOut;
+
         /*! @brief      Sub-frame index, this is in the range [0..numSubFrames - 1] */
         uint8_t subFrameIdx;
 
         DPIF_RadarCube radarCube;
 
-        /*! @brief      Detected objects output list of @ref numObjOut elements */
-        DPIF_MSS_DSS_radarProcessOutput objOut;
-
     } DPC_DSS_ObjectDetection_ExecuteResult;
 
 
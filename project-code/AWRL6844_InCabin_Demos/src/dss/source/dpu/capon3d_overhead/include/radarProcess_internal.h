@@ -44,11 +44,67 @@
 #include <source/common/swpform.h>
 #include <source/dpu/capon3d_overhead/radarProcess.h>
 #include <source/dpu/capon3d_overhead/include/copyTranspose.h>
+#include <source/utilities/radarOsal_memPlan.h>
 
 #if defined(_WIN32) || defined(CCS)
 #include <stdio.h>
 #endif
 
+/**
+ *  Stages of the frame processing in DPU_radarProcess_process(). Buffers used in some stages only are placed with a
+ *  memory plan and share memory with the buffers of the other stages.
+ */
+#define RADARPROCESS_STAGE_DYN_HEATMAP      (0U)
+#define RADARPROCESS_STAGE_DYN_CFAR         (1U)
+#define RADARPROCESS_STAGE_DYN_ANGLE        (2U)
+#define RADARPROCESS_STAGE_STATIC_HEATMAP   (3U)
+#define RADARPROCESS_STAGE_STATIC_CFAR      (4U)
+#define RADARPROCESS_STAGE_STATIC_ANGLE     (5U)
+#define RADARPROCESS_STAGE_NUM              (6U)
+
+/** Heatmap generation, per range bin */
+#define RADARPROCESS_LIVE_HEATMAP           (RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_DYN_HEATMAP) | \
+                                             RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_STATIC_HEATMAP))
+/** CFAR detection */
+#define RADARPROCESS_LIVE_CFAR              (RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_DYN_CFAR) | \
+                                             RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_STATIC_CFAR))
+/** Angle estimation, per detected point */
+#define RADARPROCESS_LIVE_ANGLE             (RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_DYN_ANGLE) | \
+                                             RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_STATIC_ANGLE))
+/** CFAR output, read by the angle estimation */
+#define RADARPROCESS_LIVE_DETECTION         (RADARPROCESS_LIVE_CFAR | RADARPROCESS_LIVE_ANGLE)
+/** Dynamic scene processing: written by the heatmap generation, read by the angle estimation */
+#define RADARPROCESS_LIVE_DYNAMIC           (RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_DYN_HEATMAP) | \
+                                             RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_DYN_CFAR) | \
+                                             RADAROSAL_MEMPLAN_STAGE(RADARPROCESS_STAGE_DYN_ANGLE))
+
+/**
+ *  \def  _radarProcessAutotune_
+ *
+ *  \brief   Autotune state. The plan gets one arena per heap, a trial solves the plan in its placement and moves
+ *           the buffers to their offset in the arenas.
+ *
+ *  \sa
+ */
+
+typedef struct _radarProcessAutotune_
+{
+    uint16_t framesPerTrial; /**<frames measured per placement*/
+    uint16_t frameCnt; /**<frames run with the current placement*/
+    uint8_t  done; /**<set once the best placement is applied*/
+    uint8_t  bufId; /**<buffer moved by the current trial, DPU_radarProcessBufId*/
+    uint8_t  heapType; /**<heap the buffer is moved to by the current trial*/
+    uint32_t numTrials; /**<number of placements measured*/
+    DPU_radarProcessPlacement current; /**<placement being measured*/
+    DPU_radarProcessPlacement best; /**<fastest placement so far*/
+    uint32_t budget[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS]; /**<arena size per heap, the heap capacity left to the plan at init*/
+    int8_t  *arena[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS]; /**<region of the plan per heap, NULL if the heap has no capacity left*/
+    int8_t  *save; /**<DDR copy of the buffers holding data across frames during a move*/
+    uint8_t  saved[RADAROSAL_MEMPLAN_MAX_NUM_BUFS]; /**<buffer placed by a previous move, its data is kept*/
+    uint64_t stageCycles[RADARPROCESS_STAGE_NUM]; /**<cycles of the current trial per stage*/
+    uint64_t bestStageCycles[RADARPROCESS_STAGE_NUM]; /**<cycles of the best placement per stage*/
+    uint64_t bestCycles; /**<cycles of the best placement*/
+} radarProcessAutotune_t;
 
 /**
  *  \def  _processInstance_
@@ -68,6 +124,7 @@ typedef struct _processInstance_
     float *localHeatmap; /**<pointer to heatmap memory*/
 
     float *localHeatmapL3; /**<pointer to heatmap memory in L3 for debugging */
+    HeatmapCodec_Encoder heatmapEncoder; /**<heatmap delta export, exportCoarseHeatmap 2 or 3 */
     DPIF_MSS_DSS_rawCfarPointCloud  rawCfarPointCloud; /**<raw CFAR detection list for debugging */
 
     float **dynamicHeatmapPtr; /**<2D pointer to heatmap memory for dynamic scene, in [angle][range] format as CFAR input*/
@@ -75,9 +132,32 @@ typedef struct _processInstance_
     float  *perRangeBinMax; /**<per range bin max value from heatmap, for CFAR input*/
 
     int8_t staticProcEnabled; /**<static processing enabled, if set to 1*/
+    uint8_t  staticCacheEnabled; /**<static heatmap kept across frames, refreshed per range bin, if set to 1*/
+    uint16_t staticRefreshPeriod; /**<frames between two refreshes of the whole static heatmap*/
+    uint16_t staticFrameCnt; /**<frames since the last refresh of the whole static heatmap*/
+    float    staticChangeThr; /**<relative change of the static information of a range bin refreshing its static heatmap*/
+    float   *staticHeatmap; /**<static heatmap kept across frames, in [angle][range] format, static cache only*/
+    float   *staticRangeBinMax; /**<per range bin max value from the static heatmap, static cache only*/
+    cplxf_t *staticRef; /**<static information of each range bin at its last static heatmap refresh, static cache only*/
+    DPIF_PointCloudSpherical *staticPointCache; /**<static points of the last static CFAR and angle estimation, static cache only*/
+    DPIF_PointCloudSideInfo  *staticSnrCache; /**<SNR of the static points, static cache only*/
+    int32_t  staticNumPnts; /**<number of static points in the cache*/
+    uint16_t *staticDetRangeInd; /**<range bins of the detections of the last static CFAR, static cache only*/
+    uint16_t *staticDetAzimInd; /**<angle bins of the detections of the last static CFAR, static cache only*/
+    float    *staticDetSnr; /**<SNR of the detections of the last static CFAR, static cache only*/
+    float    *staticDetNoise; /**<noise of the detections of the last static CFAR, static cache only*/
+    int32_t   staticNumDet; /**<number of detections in the static CFAR cache*/
 
     RADARDEMO_detectionCFAR_input  *detectionCFARInput; /**<CFAR input*/
     RADARDEMO_detectionCFAR_output *detectionCFAROutput; /**<CFAR output*/
+    uint16_t *detOrder; /**<CFAR detections sorted by range bin, for the angle estimation*/
+    uint16_t *detRangeBinHist; /**<number of CFAR detections per range bin, numRangeBins + 1 entries*/
+    uint16_t *detOutStart; /**<first point of each CFAR detection in anglePoints, in CFAR order*/
+    uint16_t *detOutNum; /**<number of points of each CFAR detection in anglePoints, in CFAR order*/
+    uint8_t   dopplerBatchEnabled; /**<Doppler estimation batched over the detections of a range bin (angle estimation steps 2 and 3), if set to 1*/
+    uint16_t  maxNumAngleEstPerDet; /**<max number of angle estimates of one detection*/
+    DPIF_PointCloudSpherical *anglePoints; /**<points of the angle estimation in range bin order, DOA_OUTPUT_MAXPOINTS entries*/
+    DPIF_PointCloudSideInfo  *angleSnr; /**<SNR of anglePoints*/
 
     uint8_t                           mimoModeFlag; /**<Flag for MIMO mode: 0 -- SIMO, 1 -- TDM MIMO, 2 -- FDM or BF*/
     RADARDEMO_aoaEst2DCaponBF_input  *aoaInput; /**<2D capon input*/
@@ -113,12 +193,23 @@ typedef struct _processInstance_
 
     radarProcessBenchmarkObj *benchmarkPtr;
 
+    radarOsal_memPlan *memPlan; /**<placement of the buffers used in some stages of the frame only*/
+    uint8_t planBufId[RADAROSAL_MEMPLAN_MAX_NUM_BUFS]; /**<DPU_radarProcessBufId of each buffer of the plan*/
+    DPU_radarProcessPlacement placement; /**<memory tier per buffer*/
+    radarProcessAutotune_t *autotune; /**<autotune state, NULL if autotune is disabled*/
+
     uint8_t exportCoarseHeatmap;
     uint8_t exportRawCfarDetList;
     uint8_t exportZoomInHeatmap;
 
 } radarProcessInstance_t;
 
+extern void radarProcess_bindBuffers(radarProcessInstance_t *inst);
+
+extern int32_t radarProcess_autotuneInit(radarProcessInstance_t *inst, uint16_t framesPerTrial);
+
+extern void radarProcess_autotuneFrame(radarProcessInstance_t *inst, DPIF_MSS_DSS_radarProcessBenchmarkElem *benchmark);
+
 
 #endif // _RADARPROCESS_INTERNAL_H
 
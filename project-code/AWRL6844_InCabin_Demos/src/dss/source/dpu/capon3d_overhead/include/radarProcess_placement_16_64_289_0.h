@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ *
+ *   Neither the name of Texas Instruments Incorporated nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Placement of the radarProcess buffers for 16 antennas, 64 range bins, 17 x 17 angle bins, static processing off.
+   Written by tools/radarProcess_placement_gen.sh 16 64 17 17 9 32: the autotune mode run on the host with a cost model per
+   tier (LL1 1, LL2 2, HSRAM 3, DDR 6 cycles per 8 bytes) and the bytes each buffer accesses per frame, in the
+   heaps of the default placement. Not measured: replace with the header of an autotune run on the target. */
+
+#ifndef RADARPROCESS_PLACEMENT_16_64_289_0_H
+#define RADARPROCESS_PLACEMENT_16_64_289_0_H
+
+/* radarProcess placement, best of 2 placements, cycles per frame: */
+/*   dynamic heatmap 101536, CFAR 65024, angle 41520, static heatmap 0, CFAR 0, angle 0 */
+#define RADARPROCESS_PLACEMENT_16_64_289_0 \
+{{ \
+    RADARMEMOSAL_HEAPTYPE_LL2, /* heatmap */ \
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED, /* staticInfo */ \
+    RADARMEMOSAL_HEAPTYPE_LL1, /* rangeBinMax */ \
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED, /* invRn */ \
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED, /* cfarOutput */ \
+    RADARMEMOSAL_HEAPTYPE_LL1, /* tempHeatmap */ \
+    RADARMEMOSAL_HEAPTYPE_LL1 /* angleOutput */ \
+}}
+
+#endif
@@ -191,7 +191,7 @@ RADARDEMO_aoAEstBF_errorCode RADARDEMO_aoaEstimationBF_run(
     signalP = 0.0;
     for (i = 0; i < (int32_t)aoaEstBFInst->nRxAnt; i++)
     {
-        _amem8_f2(&Rn[i]) = _complex_conjugate_mpysp(_amem8_f2(&inputSignal[i]), _amem8_f2(&inputSignal[i]));
+        _amem8_f2(&Rn[i]) = cconjmpysp_i(_amem8_f2(&inputSignal[i]), _amem8_f2(&inputSignal[i]));
         signalP           = signalP + Rn[i].real;
     }
     snr = signalP / input->inputNoisePow;
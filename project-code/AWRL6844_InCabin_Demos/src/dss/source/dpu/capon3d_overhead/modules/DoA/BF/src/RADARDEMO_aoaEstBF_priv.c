@@ -48,44 +48,6 @@
 
 //#define UNOPTIMIZED_CODE
 
-#ifdef UNOPTIMIZED_CODE
-
-//! \brief          complex conjugage multipler
-//!                   out = x'*y
-//! \param[in] x
-//! \param[in] y
-//! \ret       multiplication output
-//!
-cplxf_t complex_conjugate_mpysp(cplxf_t x, cplxf_t y)
-{
-    cplxf_t out;
-    out.real = x.real * y.real + x.imag * y.imag;
-    out.imag = x.real * y.imag - x.imag * y.real;
-    return (out);
-}
-
-float complex_abs(cplxf_t x)
-{
-    float out;
-    out = x.real * x.real + x.imag * x.imag;
-    return (out);
-}
-
-//! \brief          complex addition
-//!                   out = x + y
-//! \param[in] x
-//! \param[in] y
-//! \ret       addition output
-//!
-cplxf_t daddsp(cplxf_t x, cplxf_t y)
-{
-    cplxf_t out;
-    out.real = x.real + y.real;
-    out.imag = y.imag + x.imag;
-    return (out);
-}
-#endif
-
 //! \copydoc RADARDEMO_aoaEstimationBFMultiPeak
 int32_t RADARDEMO_aoaEstimationBFMultiPeak(
     IN uint8_t   numAnt,
@@ -112,9 +74,9 @@ int32_t RADARDEMO_aoaEstimationBFMultiPeak(
     float   minVal = (float)(3.0e+30); // INFINITY;
     float   currentVal;
 #ifdef UNOPTIMIZED_CODE
-    float   absMaxVal, spec;
-    int32_t ind_ang, ind_ant;
-    cplxf_t temp, tempSum;
+    float      absMaxVal, spec;
+    int32_t    ind_ang, ind_ant;
+    __float2_t tempSum;
 #endif
     float   peakThreshold;
     float   maxVal;
@@ -143,14 +105,10 @@ int32_t RADARDEMO_aoaEstimationBFMultiPeak(
         absMaxVal = 0.0;
         for (ind_ang = 0; ind_ang < steeringVecSize; ind_ang++)
         {
-            tempSum.real = sigIn[0].real;
-            tempSum.imag = sigIn[0].imag;
+            tempSum = _amem8_f2(&sigIn[0]);
             for (ind_ant = 1; ind_ant < numAnt; ind_ant++)
-            {
-                temp    = complex_conjugate_mpysp(steeringVec[(numAnt - 1) * ind_ang + ind_ant - 1], sigIn[ind_ant]);
-                tempSum = daddsp(tempSum, temp);
-            }
-            spec                 = complex_abs(tempSum);
+                tempSum = cconjmacsp_i(tempSum, _amem8_f2(&steeringVec[(numAnt - 1) * ind_ang + ind_ant - 1]), _amem8_f2(&sigIn[ind_ant]));
+            spec                 = cmagsqsp_i(tempSum);
             doaSpectrum[ind_ang] = spec;
             if (spec > absMaxVal)
             {
@@ -183,11 +141,10 @@ int32_t RADARDEMO_aoaEstimationBFMultiPeak(
 
             for (i = 0; i < steeringVecSize; i++)
             {
-                f2temp1        = _daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input1));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input2));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input3));
-                f2temp1        = _dmpysp(f2temp1, f2temp1);
-                tempPow        = _hif2(f2temp1) + _lof2(f2temp1);
+                f2temp1        = cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr++), input1);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input2);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input3);
+                tempPow        = cmagsqsp_i(f2temp1);
                 doaSpectrum[i] = tempPow;
                 totPower += tempPow;
                 if (tempPow > maxPow)
@@ -212,15 +169,14 @@ int32_t RADARDEMO_aoaEstimationBFMultiPeak(
 
             for (i = 0; i < steeringVecSize; i++)
             {
-                f2temp1        = _daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input1));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input2));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input3));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input4));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input5));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input6));
-                f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input7));
-                f2temp1        = _dmpysp(f2temp1, f2temp1);
-                tempPow        = _hif2(f2temp1) + _lof2(f2temp1);
+                f2temp1        = cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr++), input1);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input2);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input3);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input4);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input5);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input6);
+                f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input7);
+                tempPow        = cmagsqsp_i(f2temp1);
                 doaSpectrum[i] = tempPow;
                 totPower += tempPow;
                 if (tempPow > maxPow)
@@ -241,16 +197,15 @@ int32_t RADARDEMO_aoaEstimationBFMultiPeak(
     		for (i = 0; i < steeringVecSize; i++ )
     		{
     			input1	=	_amem8_f2(&sigIn[1]);
-    			f2temp1	=	_daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr), input1));
+    			f2temp1	=	cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr), input1);
     			tempSteerVecPtr++;
     			for (j = 2; j < numAnt; j++ )
     			{
     				input1	=	_amem8_f2(&sigIn[j]);
-    				f2temp1	=	_daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr), input1));
+    				f2temp1	=	cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr), input1);
     				tempSteerVecPtr++;
     			}
-    			f2temp1		=	_dmpysp(f2temp1, f2temp1);
-    			tempPow		=	_hif2(f2temp1) + _lof2(f2temp1);
+    			tempPow		=	cmagsqsp_i(f2temp1);
     			doaSpectrum[i]	=	tempPow;
     			totPower	+=	tempPow;
     			if (tempPow > maxPow)
@@ -388,9 +343,7 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak(
     inputPower = 0.f;
     for (i = 0; i < numAnt; i++)
     {
-        input0 = _amem8_f2(tempInPtr++);
-        input0 = _dmpysp(input0, input0);
-        inputPower += _hif2(input0) + _lof2(input0);
+        inputPower += cmagsqsp_i(_amem8_f2(tempInPtr++));
     }
 
     /* Compute the spectrum and record the max */
@@ -409,11 +362,10 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak(
 
         for (i = 0; i < steeringVecSize; i++)
         {
-            f2temp1        = _daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input1));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input2));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input3));
-            f2temp1        = _dmpysp(f2temp1, f2temp1);
-            tempPow        = _hif2(f2temp1) + _lof2(f2temp1);
+            f2temp1        = cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr++), input1);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input2);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input3);
+            tempPow        = cmagsqsp_i(f2temp1);
             doaSpectrum[i] = tempPow;
             totPower += tempPow;
             if (tempPow > maxPow)
@@ -439,15 +391,14 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak(
 
         for (i = 0; i < steeringVecSize; i++)
         {
-            f2temp1        = _daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input1));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input2));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input3));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input4));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input5));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input6));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input7));
-            f2temp1        = _dmpysp(f2temp1, f2temp1);
-            tempPow        = _hif2(f2temp1) + _lof2(f2temp1);
+            f2temp1        = cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr++), input1);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input2);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input3);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input4);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input5);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input6);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input7);
+            tempPow        = cmagsqsp_i(f2temp1);
             doaSpectrum[i] = tempPow;
             totPower += tempPow;
             if (tempPow > maxPow)
@@ -469,16 +420,15 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak(
 		for (i = 0; i < steeringVecSize; i++ )
 		{
 			input1	=	_amem8_f2(&sigIn[1]);
-			f2temp1	=	_daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr), input1));
+			f2temp1	=	cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr), input1);
 			tempSteerVecPtr++;
 			for (j = 2; j < numAnt; j++ )
 			{
 				input1	=	_amem8_f2(&sigIn[j]);
-				f2temp1	=	_daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr), input1));
+				f2temp1	=	cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr), input1);
 				tempSteerVecPtr++;
 			}
-			f2temp1		=	_dmpysp(f2temp1, f2temp1);
-			tempPow		=	_hif2(f2temp1) + _lof2(f2temp1);
+			tempPow		=	cmagsqsp_i(f2temp1);
 			doaSpectrum[i]	=	tempPow;
 			totPower	+=	tempPow;
 			if (tempPow > maxPow)
@@ -514,15 +464,11 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak(
     if (temp3dBSpan <= 0)
         temp3dBSpan += steeringVecSize;
     tempVarSqrInv = 2.f * (float)RADARDEMO_AOAESTBF_VAREST_CONST * (float)RADARDEMO_AOAESTBF_VAREST_CONST * inputPower * (float)numAnt * signalPower;
-    tempInterpol  = _rcpsp(noise * totPower);
-    tempInterpol  = tempInterpol * (2.f - noise * totPower * tempInterpol);
-    tempInterpol  = tempInterpol * (2.f - noise * totPower * tempInterpol);
+    tempInterpol  = rcpsp_i(noise * totPower);
 
     tempVarSqrInv *= tempInterpol;
     tempVar      = estResolution * (float)temp3dBSpan;
-    tempInterpol = _rsqrsp(tempVarSqrInv);
-    tempInterpol = tempInterpol * (1.5f - (0.5f * tempVarSqrInv) * tempInterpol * tempInterpol);
-    tempInterpol = tempInterpol * (1.5f - (0.5f * tempVarSqrInv) * tempInterpol * tempInterpol);
+    tempInterpol = rsqrtsp_i(tempVarSqrInv);
     tempVar *= tempInterpol;
 
     *estVar   = tempVar;
@@ -44,6 +44,7 @@
 #ifndef _TMS320C6600
 #include <modules/utilities/radar_c674x.h>
 #endif
+#include <modules/utilities/radar_cplxMath.h>
 
 #define RADARDEMO_AOAESTBF_MAX_NUM_PEAKS (10) //!< Maximum number of detected peak per input vector internally during peak search.
 #define RADARDEMO_AOAESTBF_VAREST_CONST  1 //!< A constant used in angle variance estimation
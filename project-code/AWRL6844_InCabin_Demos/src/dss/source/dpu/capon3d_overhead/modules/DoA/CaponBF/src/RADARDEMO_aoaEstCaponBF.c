@@ -327,8 +327,7 @@ RADARDEMO_aoaEstCaponBF_errorCode RADARDEMO_aoaEstCaponBF_run(
         for (i = 0; i < aoaEstBFInst->dopplerFFTSize; i++)
         {
             f2temp             = _amem8_f2(&dopplerFFTOutput[2 * i]);
-            f2temp             = _dmpysp(f2temp, f2temp);
-            ftemp              = _hif2(f2temp) + _lof2(f2temp);
+            ftemp              = cmagsqsp_i(f2temp);
             dopplerSpectrum[i] = ftemp;
             if (ftemp > max)
             {
@@ -355,6 +354,8 @@ RADARDEMO_aoaEstCaponBF_errorCode RADARDEMO_aoaEstCaponBF_run(
             aoaEstBFInst->dopCFARInput->sidelobeThr            = 0; // processInst->sidelobe_dynamic;
             aoaEstBFInst->dopCFARInput->enableSecondPass       = 0;
             aoaEstBFInst->dopCFARInput->enable_neighbour_check = 0;
+            aoaEstBFInst->dopCFARInput->rangeStartInd          = 0;
+            aoaEstBFInst->dopCFARInput->rangeEndInd            = (uint16_t)aoaEstBFInst->dopplerFFTSize;
 
             RADARDEMO_detectionCFAR_run(
                 aoaEstBFInst->dopCFARHandle,
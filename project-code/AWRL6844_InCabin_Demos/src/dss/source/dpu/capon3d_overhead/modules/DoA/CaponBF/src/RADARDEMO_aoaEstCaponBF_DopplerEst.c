@@ -99,7 +99,7 @@ void RADARDEMO_aoaEstCaponBF_dopperEstInput(
     __float2_t *RESTRICT bweights;
     __float2_t *RESTRICT rnPtr;
     __float2_t *RESTRICT steerVecPtr;
-    __float2_t           f2temp1, acc2, scale2;
+    __float2_t           acc2, scale2;
 
 
     /* beamforming weights = A*Rn, beamforming output = input(1x8)*A*Rn */
@@ -134,120 +134,85 @@ void RADARDEMO_aoaEstCaponBF_dopperEstInput(
             acc2 = _amem8_f2(&rnPtr[0]);
             for (i = 1; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[0]) = _dmpysp(acc2, scale2);
 
             // bweights[1]
             acc2    = _amem8_f2(&rnPtr[1]);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[8]), _amem8_f2(&steerVecPtr[0]));
-            acc2    = _daddsp(acc2, f2temp1);
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[8]), _amem8_f2(&steerVecPtr[0]));
             for (i = 2; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i + 7]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i + 7]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[1]) = _dmpysp(acc2, scale2);
 
             // bweights[2]
             acc2    = _amem8_f2(&rnPtr[2]);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[9]), _amem8_f2(&steerVecPtr[0]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[15]), _amem8_f2(&steerVecPtr[1]));
-            acc2    = _daddsp(acc2, f2temp1);
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[9]), _amem8_f2(&steerVecPtr[0]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[15]), _amem8_f2(&steerVecPtr[1]));
             for (i = 3; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i + 13]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i + 13]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[2]) = _dmpysp(acc2, scale2);
 
             // bweights[3]
             acc2    = _amem8_f2(&rnPtr[3]);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[10]), _amem8_f2(&steerVecPtr[0]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[16]), _amem8_f2(&steerVecPtr[1]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[21]), _amem8_f2(&steerVecPtr[2]));
-            acc2    = _daddsp(acc2, f2temp1);
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[10]), _amem8_f2(&steerVecPtr[0]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[16]), _amem8_f2(&steerVecPtr[1]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[21]), _amem8_f2(&steerVecPtr[2]));
             for (i = 4; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i + 18]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i + 18]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[3]) = _dmpysp(acc2, scale2);
 
             // bweights[4]
             acc2    = _amem8_f2(&rnPtr[4]);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[11]), _amem8_f2(&steerVecPtr[0]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[17]), _amem8_f2(&steerVecPtr[1]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[22]), _amem8_f2(&steerVecPtr[2]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[26]), _amem8_f2(&steerVecPtr[3]));
-            acc2    = _daddsp(acc2, f2temp1);
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[11]), _amem8_f2(&steerVecPtr[0]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[17]), _amem8_f2(&steerVecPtr[1]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[22]), _amem8_f2(&steerVecPtr[2]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[26]), _amem8_f2(&steerVecPtr[3]));
             for (i = 5; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i + 22]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i + 22]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[4]) = _dmpysp(acc2, scale2);
 
             // bweights[5]
             acc2    = _amem8_f2(&rnPtr[5]);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[12]), _amem8_f2(&steerVecPtr[0]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[18]), _amem8_f2(&steerVecPtr[1]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[23]), _amem8_f2(&steerVecPtr[2]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[27]), _amem8_f2(&steerVecPtr[3]));
-            acc2    = _daddsp(acc2, f2temp1);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[30]), _amem8_f2(&steerVecPtr[4]));
-            acc2    = _daddsp(acc2, f2temp1);
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[12]), _amem8_f2(&steerVecPtr[0]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[18]), _amem8_f2(&steerVecPtr[1]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[23]), _amem8_f2(&steerVecPtr[2]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[27]), _amem8_f2(&steerVecPtr[3]));
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[30]), _amem8_f2(&steerVecPtr[4]));
             for (i = 6; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i + 25]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i + 25]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[5]) = _dmpysp(acc2, scale2);
 
             // bweights[6]
             acc2                    = _amem8_f2(&rnPtr[6]);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[13]), _amem8_f2(&steerVecPtr[0]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[19]), _amem8_f2(&steerVecPtr[1]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[24]), _amem8_f2(&steerVecPtr[2]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[28]), _amem8_f2(&steerVecPtr[3]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[31]), _amem8_f2(&steerVecPtr[4]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[33]), _amem8_f2(&steerVecPtr[5]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[34]), _amem8_f2(&steerVecPtr[6]));
-            acc2                    = _daddsp(acc2, f2temp1);
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[13]), _amem8_f2(&steerVecPtr[0]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[19]), _amem8_f2(&steerVecPtr[1]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[24]), _amem8_f2(&steerVecPtr[2]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[28]), _amem8_f2(&steerVecPtr[3]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[31]), _amem8_f2(&steerVecPtr[4]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[33]), _amem8_f2(&steerVecPtr[5]));
+            acc2                    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[34]), _amem8_f2(&steerVecPtr[6]));
             _amem8_f2(&bweights[6]) = _dmpysp(acc2, scale2);
 
             // bweights[7]
             acc2                    = _amem8_f2(&rnPtr[7]);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[14]), _amem8_f2(&steerVecPtr[0]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[20]), _amem8_f2(&steerVecPtr[1]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[25]), _amem8_f2(&steerVecPtr[2]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[29]), _amem8_f2(&steerVecPtr[3]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[32]), _amem8_f2(&steerVecPtr[4]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[34]), _amem8_f2(&steerVecPtr[5]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[35]), _amem8_f2(&steerVecPtr[6]));
-            acc2                    = _daddsp(acc2, f2temp1);
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[14]), _amem8_f2(&steerVecPtr[0]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[20]), _amem8_f2(&steerVecPtr[1]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[25]), _amem8_f2(&steerVecPtr[2]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[29]), _amem8_f2(&steerVecPtr[3]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[32]), _amem8_f2(&steerVecPtr[4]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[34]), _amem8_f2(&steerVecPtr[5]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[35]), _amem8_f2(&steerVecPtr[6]));
             _amem8_f2(&bweights[7]) = _dmpysp(acc2, scale2);
         }
         else
@@ -261,14 +226,14 @@ void RADARDEMO_aoaEstCaponBF_dopperEstInput(
 
         for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
         {
-            acc2                               = _complex_mpysp(_dinthsp(_amem4(&inPtr1[chirpIdx])), _amem8_f2(&bweights[0]));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr2[chirpIdx])), _amem8_f2(&bweights[1])));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr3[chirpIdx])), _amem8_f2(&bweights[2])));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr4[chirpIdx])), _amem8_f2(&bweights[3])));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr5[chirpIdx])), _amem8_f2(&bweights[4])));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr6[chirpIdx])), _amem8_f2(&bweights[5])));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr7[chirpIdx])), _amem8_f2(&bweights[6])));
-            acc2                               = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr8[chirpIdx])), _amem8_f2(&bweights[7])));
+            acc2                               = cmpysp_i(_dinthsp(_amem4(&inPtr1[chirpIdx])), _amem8_f2(&bweights[0]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr2[chirpIdx])), _amem8_f2(&bweights[1]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr3[chirpIdx])), _amem8_f2(&bweights[2]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr4[chirpIdx])), _amem8_f2(&bweights[3]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr5[chirpIdx])), _amem8_f2(&bweights[4]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr6[chirpIdx])), _amem8_f2(&bweights[5]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr7[chirpIdx])), _amem8_f2(&bweights[6]));
+            acc2                               = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr8[chirpIdx])), _amem8_f2(&bweights[7]));
             _amem8_f2(&bfOutput[2 * chirpIdx]) = _ftof2(_lof2(acc2), _hif2(acc2));
         }
     }
@@ -289,40 +254,31 @@ void RADARDEMO_aoaEstCaponBF_dopperEstInput(
             acc2 = _amem8_f2(&rnPtr[0]);
             for (i = 1; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[0]) = _dmpysp(acc2, scale2);
 
             // bweights[1]
             acc2    = _amem8_f2(&rnPtr[1]);
-            f2temp1 = _complex_mpysp(_amem8_f2(&rnPtr[4]), _amem8_f2(&steerVecPtr[0]));
-            acc2    = _daddsp(acc2, f2temp1);
+            acc2    = cmacsp_i(acc2, _amem8_f2(&rnPtr[4]), _amem8_f2(&steerVecPtr[0]));
             for (i = 2; i < nRxAnt; i++)
             {
-                f2temp1 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[i + 3]), _amem8_f2(&steerVecPtr[i - 1]));
-                acc2    = _daddsp(acc2, f2temp1);
+                acc2    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[i + 3]), _amem8_f2(&steerVecPtr[i - 1]));
             }
             _amem8_f2(&bweights[1]) = _dmpysp(acc2, scale2);
 
             // bweights[2]
             acc2                    = _amem8_f2(&rnPtr[2]);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[5]), _amem8_f2(&steerVecPtr[0]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[7]), _amem8_f2(&steerVecPtr[1]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_conjugate_mpysp(_amem8_f2(&rnPtr[8]), _amem8_f2(&steerVecPtr[2]));
-            acc2                    = _daddsp(acc2, f2temp1);
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[5]), _amem8_f2(&steerVecPtr[0]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[7]), _amem8_f2(&steerVecPtr[1]));
+            acc2                    = cconjmacsp_i(acc2, _amem8_f2(&rnPtr[8]), _amem8_f2(&steerVecPtr[2]));
             _amem8_f2(&bweights[2]) = _dmpysp(acc2, scale2);
 
             // bweights[3]
             acc2                    = _amem8_f2(&rnPtr[3]);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[6]), _amem8_f2(&steerVecPtr[0]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[8]), _amem8_f2(&steerVecPtr[1]));
-            acc2                    = _daddsp(acc2, f2temp1);
-            f2temp1                 = _complex_mpysp(_amem8_f2(&rnPtr[9]), _amem8_f2(&steerVecPtr[2]));
-            acc2                    = _daddsp(acc2, f2temp1);
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[6]), _amem8_f2(&steerVecPtr[0]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[8]), _amem8_f2(&steerVecPtr[1]));
+            acc2                    = cmacsp_i(acc2, _amem8_f2(&rnPtr[9]), _amem8_f2(&steerVecPtr[2]));
             _amem8_f2(&bweights[3]) = _dmpysp(acc2, scale2);
         }
         else
@@ -337,10 +293,10 @@ void RADARDEMO_aoaEstCaponBF_dopperEstInput(
 
         for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
         {
-            acc2                           = _complex_mpysp(_dinthsp(_amem4(&inPtr1[chirpIdx])), _amem8_f2(&bweights[0]));
-            acc2                           = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr2[chirpIdx])), _amem8_f2(&bweights[1])));
-            acc2                           = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr3[chirpIdx])), _amem8_f2(&bweights[2])));
-            acc2                           = _daddsp(acc2, _complex_mpysp(_dinthsp(_amem4(&inPtr4[chirpIdx])), _amem8_f2(&bweights[3])));
+            acc2                           = cmpysp_i(_dinthsp(_amem4(&inPtr1[chirpIdx])), _amem8_f2(&bweights[0]));
+            acc2                           = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr2[chirpIdx])), _amem8_f2(&bweights[1]));
+            acc2                           = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr3[chirpIdx])), _amem8_f2(&bweights[2]));
+            acc2                           = cmacsp_i(acc2, _dinthsp(_amem4(&inPtr4[chirpIdx])), _amem8_f2(&bweights[3]));
             _amem8_f2(&bfOutput[chirpIdx]) = _ftof2(_lof2(acc2), _hif2(acc2));
         }
     }
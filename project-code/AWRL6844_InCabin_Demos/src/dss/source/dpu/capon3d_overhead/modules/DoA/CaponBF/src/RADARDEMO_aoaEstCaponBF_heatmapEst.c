@@ -112,9 +112,7 @@ void RADARDEMO_aoaEstCaponBF_covInv(
     Rn            = (__float2_t *)&scratch[scratchOffset];
     scratchOffset = scratchOffset + 2 * nRxAnt * (1 + (nRxAnt >> 1)); /*72 32-bit word for 8 antennas*/
 
-    ftemp = _rcpsp((float)nChirps);
-    ftemp = ftemp * (2.f - (float)nChirps * ftemp);
-    ftemp = ftemp * (2.f - (float)nChirps * ftemp);
+    ftemp = rcpsp_i((float)nChirps);
 
     scale2 = _ftof2(ftemp, ftemp);
 
@@ -514,9 +512,7 @@ void RADARDEMO_aoaEstCaponBF_heatmap(
             f2temp     = _dmpysp(f2temp, steerVecIn);
             output += 2.f * (_hif2(f2temp) + _lof2(f2temp));
 
-            result = _rcpsp(output);
-            result = result * (2.f - output * result);
-            result = result * (2.f - output * result);
+            result = rcpsp_i(output);
             // result		=	result * result;
 
             if (!bfFlag)
@@ -556,9 +552,7 @@ void RADARDEMO_aoaEstCaponBF_heatmap(
             f2temp     = _dmpysp(f2temp, steerVecIn);
             output += 2.f * (_hif2(f2temp) + _lof2(f2temp));
 
-            result = _rcpsp(output);
-            result = result * (2.f - output * result);
-            result = result * (2.f - output * result);
+            result = rcpsp_i(output);
             // result		=	result * result;
 
             if (!bfFlag)
@@ -626,11 +620,10 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak_static_use(
 
         for (i = 0; i < steeringVecSize; i++)
         {
-            f2temp1        = _daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input1));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input2));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input3));
-            f2temp1        = _dmpysp(f2temp1, f2temp1);
-            tempPow        = _hif2(f2temp1) + _lof2(f2temp1);
+            f2temp1        = cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr++), input1);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input2);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input3);
+            tempPow        = cmagsqsp_i(f2temp1);
             doaSpectrum[i] = tempPow;
             // totPower	+=	tempPow;
             if (tempPow > maxPow)
@@ -656,15 +649,14 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak_static_use(
 
         for (i = 0; i < steeringVecSize; i++)
         {
-            f2temp1        = _daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input1));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input2));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input3));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input4));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input5));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input6));
-            f2temp1        = _daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr++), input7));
-            f2temp1        = _dmpysp(f2temp1, f2temp1);
-            tempPow        = _hif2(f2temp1) + _lof2(f2temp1);
+            f2temp1        = cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr++), input1);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input2);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input3);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input4);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input5);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input6);
+            f2temp1        = cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr++), input7);
+            tempPow        = cmagsqsp_i(f2temp1);
             doaSpectrum[i] = tempPow;
             // totPower	+=	tempPow;
             if (tempPow > maxPow)
@@ -686,16 +678,15 @@ int32_t RADARDEMO_aoaEstimationBFSinglePeak_static_use(
 		for (i = 0; i < steeringVecSize; i++ )
 		{
 			input1	=	_amem8_f2(&sigIn[1]);
-			f2temp1	=	_daddsp(input0, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr), input1));
+			f2temp1	=	cconjmacsp_i(input0, _amem8_f2(tempSteerVecPtr), input1);
 			tempSteerVecPtr++;
 			for (j = 2; j < numAnt; j++ )
 			{
 				input1	=	_amem8_f2(&sigIn[j]);
-				f2temp1	=	_daddsp(f2temp1, _complex_conjugate_mpysp(_amem8_f2(tempSteerVecPtr), input1));
+				f2temp1	=	cconjmacsp_i(f2temp1, _amem8_f2(tempSteerVecPtr), input1);
 				tempSteerVecPtr++;
 			}
-			f2temp1		=	_dmpysp(f2temp1, f2temp1);
-			tempPow		=	_hif2(f2temp1) + _lof2(f2temp1);
+			tempPow		=	cmagsqsp_i(f2temp1);
 			doaSpectrum[i]	=	tempPow;
 			totPower	+=	tempPow;
 			if (tempPow > maxPow)
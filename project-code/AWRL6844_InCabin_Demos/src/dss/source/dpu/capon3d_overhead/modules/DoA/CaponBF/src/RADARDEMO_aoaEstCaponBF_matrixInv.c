@@ -248,38 +248,38 @@ void MATRIX_single8x8MatInv(
     /* calculate T = D - C*inv(A)*B */
     // results			=	_cmpysp(_amem8_f2(&C[0]), _amem8_f2(&B[0]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[0]), _amem8_f2(&B[0]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[0]), _amem8_f2(&B[0]));
 
     // results			=	_cmpysp(_amem8_f2(&C[1]), _amem8_f2(&B[1]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[1]), _amem8_f2(&B[1])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[1]), _amem8_f2(&B[1]));
 
     // results			=	_cmpysp(_amem8_f2(&C[2]), _amem8_f2(&B[2]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[2]), _amem8_f2(&B[2])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[2]), _amem8_f2(&B[2]));
 
     // results			=	_cmpysp(_amem8_f2(&C[3]), _amem8_f2(&B[3]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[3]), _amem8_f2(&B[3])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[3]), _amem8_f2(&B[3]));
 
     dtemp1           = _dsubsp(_amem8_f2(&D[0]), dtemp1);
     _amem8_f2(&T[0]) = dtemp1;
 
     // results			=	_cmpysp(_amem8_f2(&C[4]), _amem8_f2(&B[0]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[4]), _amem8_f2(&B[0]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[4]), _amem8_f2(&B[0]));
 
     // results			=	_cmpysp(_amem8_f2(&C[5]), _amem8_f2(&B[1]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[5]), _amem8_f2(&B[1])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[5]), _amem8_f2(&B[1]));
 
     // results			=	_cmpysp(_amem8_f2(&C[6]), _amem8_f2(&B[2]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[6]), _amem8_f2(&B[2])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[6]), _amem8_f2(&B[2]));
 
     // results			=	_cmpysp(_amem8_f2(&C[7]), _amem8_f2(&B[3]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[7]), _amem8_f2(&B[3])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[7]), _amem8_f2(&B[3]));
 
     dtemp1           = _dsubsp(_amem8_f2(&D[1]), dtemp1);
     _amem8_f2(&T[1]) = dtemp1;
@@ -288,38 +288,38 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&C[4]), _amem8_f2(&B[4]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[4]), _amem8_f2(&B[4]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[4]), _amem8_f2(&B[4]));
 
     // results			=	_cmpysp(_amem8_f2(&C[5]), _amem8_f2(&B[5]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[5]), _amem8_f2(&B[5])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[5]), _amem8_f2(&B[5]));
 
     // results			=	_cmpysp(_amem8_f2(&C[6]), _amem8_f2(&B[6]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[6]), _amem8_f2(&B[6])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[6]), _amem8_f2(&B[6]));
 
     // results			=	_cmpysp(_amem8_f2(&C[7]), _amem8_f2(&B[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[7]), _amem8_f2(&B[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[7]), _amem8_f2(&B[7]));
 
     dtemp1           = _dsubsp(_amem8_f2(&D[5]), dtemp1);
     _amem8_f2(&T[5]) = dtemp1;
 
     // results			=	_cmpysp(_amem8_f2(&C[8]), _amem8_f2(&B[0]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[8]), _amem8_f2(&B[0]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[8]), _amem8_f2(&B[0]));
 
     // results			=	_cmpysp(_amem8_f2(&C[9]), _amem8_f2(&B[1]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[9]), _amem8_f2(&B[1])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[9]), _amem8_f2(&B[1]));
 
     // results			=	_cmpysp(_amem8_f2(&C[10]), _amem8_f2(&B[2]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[10]), _amem8_f2(&B[2])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[10]), _amem8_f2(&B[2]));
 
     // results			=	_cmpysp(_amem8_f2(&C[11]), _amem8_f2(&B[3]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[11]), _amem8_f2(&B[3])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[11]), _amem8_f2(&B[3]));
 
     dtemp1           = _dsubsp(_amem8_f2(&D[2]), dtemp1);
     _amem8_f2(&T[2]) = dtemp1;
@@ -328,19 +328,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&C[8]), _amem8_f2(&B[4]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[8]), _amem8_f2(&B[4]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[8]), _amem8_f2(&B[4]));
 
     // results			=	_cmpysp(_amem8_f2(&C[9]), _amem8_f2(&B[5]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[9]), _amem8_f2(&B[5])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[9]), _amem8_f2(&B[5]));
 
     // results			=	_cmpysp(_amem8_f2(&C[10]), _amem8_f2(&B[6]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[10]), _amem8_f2(&B[6])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[10]), _amem8_f2(&B[6]));
 
     // results			=	_cmpysp(_amem8_f2(&C[11]), _amem8_f2(&B[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[11]), _amem8_f2(&B[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[11]), _amem8_f2(&B[7]));
 
     dtemp1           = _dsubsp(_amem8_f2(&D[6]), dtemp1);
     _amem8_f2(&T[6]) = dtemp1;
@@ -349,38 +349,38 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&C[8]), _amem8_f2(&B[8]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[8]), _amem8_f2(&B[8]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[8]), _amem8_f2(&B[8]));
 
     // results			=	_cmpysp(_amem8_f2(&C[9]), _amem8_f2(&B[9]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[9]), _amem8_f2(&B[9])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[9]), _amem8_f2(&B[9]));
 
     // results			=	_cmpysp(_amem8_f2(&C[10]), _amem8_f2(&B[10]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[10]), _amem8_f2(&B[10])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[10]), _amem8_f2(&B[10]));
 
     // results			=	_cmpysp(_amem8_f2(&C[11]), _amem8_f2(&B[11]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[11]), _amem8_f2(&B[11])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[11]), _amem8_f2(&B[11]));
 
     dtemp1            = _dsubsp(_amem8_f2(&D[10]), dtemp1);
     _amem8_f2(&T[10]) = dtemp1;
 
     // results			=	_cmpysp(_amem8_f2(&C[12]), _amem8_f2(&B[0]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[12]), _amem8_f2(&B[0]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[12]), _amem8_f2(&B[0]));
 
     // results			=	_cmpysp(_amem8_f2(&C[13]), _amem8_f2(&B[1]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[13]), _amem8_f2(&B[1])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[13]), _amem8_f2(&B[1]));
 
     // results			=	_cmpysp(_amem8_f2(&C[14]), _amem8_f2(&B[2]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[14]), _amem8_f2(&B[2])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[14]), _amem8_f2(&B[2]));
 
     // results			=	_cmpysp(_amem8_f2(&C[15]), _amem8_f2(&B[3]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[15]), _amem8_f2(&B[3])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[15]), _amem8_f2(&B[3]));
 
     dtemp1            = _dsubsp(_amem8_f2(&D[3]), dtemp1);
     _amem8_f2(&T[3])  = dtemp1;
@@ -389,19 +389,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&C[12]), _amem8_f2(&B[4]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[12]), _amem8_f2(&B[4]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[12]), _amem8_f2(&B[4]));
 
     // results			=	_cmpysp(_amem8_f2(&C[13]), _amem8_f2(&B[5]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[13]), _amem8_f2(&B[5])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[13]), _amem8_f2(&B[5]));
 
     // results			=	_cmpysp(_amem8_f2(&C[14]), _amem8_f2(&B[6]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[14]), _amem8_f2(&B[6])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[14]), _amem8_f2(&B[6]));
 
     // results			=	_cmpysp(_amem8_f2(&C[15]), _amem8_f2(&B[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[15]), _amem8_f2(&B[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[15]), _amem8_f2(&B[7]));
 
     dtemp1            = _dsubsp(_amem8_f2(&D[7]), dtemp1);
     _amem8_f2(&T[7])  = dtemp1;
@@ -410,19 +410,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&C[12]), _amem8_f2(&B[8]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[12]), _amem8_f2(&B[8]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[12]), _amem8_f2(&B[8]));
 
     // results			=	_cmpysp(_amem8_f2(&C[13]), _amem8_f2(&B[9]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[13]), _amem8_f2(&B[9])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[13]), _amem8_f2(&B[9]));
 
     // results			=	_cmpysp(_amem8_f2(&C[14]), _amem8_f2(&B[10]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[14]), _amem8_f2(&B[10])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[14]), _amem8_f2(&B[10]));
 
     // results			=	_cmpysp(_amem8_f2(&C[15]), _amem8_f2(&B[11]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[15]), _amem8_f2(&B[11])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[15]), _amem8_f2(&B[11]));
 
     dtemp1            = _dsubsp(_amem8_f2(&D[11]), dtemp1);
     _amem8_f2(&T[11]) = dtemp1;
@@ -431,19 +431,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&C[12]), _amem8_f2(&B[12]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&C[12]), _amem8_f2(&B[12]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&C[12]), _amem8_f2(&B[12]));
 
     // results			=	_cmpysp(_amem8_f2(&C[13]), _amem8_f2(&B[13]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[13]), _amem8_f2(&B[13])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[13]), _amem8_f2(&B[13]));
 
     // results			=	_cmpysp(_amem8_f2(&C[14]), _amem8_f2(&B[14]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[14]), _amem8_f2(&B[14])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[14]), _amem8_f2(&B[14]));
 
     // results			=	_cmpysp(_amem8_f2(&C[15]), _amem8_f2(&B[15]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&C[15]), _amem8_f2(&B[15])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&C[15]), _amem8_f2(&B[15]));
 
     dtemp1            = _dsubsp(_amem8_f2(&D[15]), dtemp1);
     _amem8_f2(&T[15]) = dtemp1;
@@ -562,38 +562,38 @@ void MATRIX_single8x8MatInv(
     /* output NW 4x4 matrix = A + conj(B)*C */
     // results			=	_cmpysp(_amem8_f2(&B[0]), _amem8_f2(&C[0]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[0]), _amem8_f2(&C[0]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[0]), _amem8_f2(&C[0]));
 
     // results			=	_cmpysp(_amem8_f2(&B[4]), _amem8_f2(&C[4]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[4]), _amem8_f2(&C[4])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[4]), _amem8_f2(&C[4]));
 
     // results			=	_cmpysp(_amem8_f2(&B[8]), _amem8_f2(&C[8]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[8]), _amem8_f2(&C[8])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[8]), _amem8_f2(&C[8]));
 
     // results			=	_cmpysp(_amem8_f2(&B[12]), _amem8_f2(&C[12]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[12]), _amem8_f2(&C[12])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[12]), _amem8_f2(&C[12]));
 
     dtemp1                = _daddsp(_amem8_f2(&invA[0]), dtemp1);
     _amem8_f2(&output[0]) = dtemp1;
 
     // results			=	_cmpysp(_amem8_f2(&B[0]), _amem8_f2(&C[1]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[0]), _amem8_f2(&C[1]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[0]), _amem8_f2(&C[1]));
 
     // results			=	_cmpysp(_amem8_f2(&B[4]), _amem8_f2(&C[5]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[4]), _amem8_f2(&C[5])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[4]), _amem8_f2(&C[5]));
 
     // results			=	_cmpysp(_amem8_f2(&B[8]), _amem8_f2(&C[9]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[8]), _amem8_f2(&C[9])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[8]), _amem8_f2(&C[9]));
 
     // results			=	_cmpysp(_amem8_f2(&B[12]), _amem8_f2(&C[13]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[12]), _amem8_f2(&C[13])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[12]), _amem8_f2(&C[13]));
 
     dtemp1                = _daddsp(_amem8_f2(&invA[1]), dtemp1);
     _amem8_f2(&output[1]) = dtemp1;
@@ -601,19 +601,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[1]), _amem8_f2(&C[1]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[1]), _amem8_f2(&C[1]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[1]), _amem8_f2(&C[1]));
 
     // results			=	_cmpysp(_amem8_f2(&B[5]), _amem8_f2(&C[5]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[5]), _amem8_f2(&C[5])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[5]), _amem8_f2(&C[5]));
 
     // results			=	_cmpysp(_amem8_f2(&B[9]), _amem8_f2(&C[9]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[9]), _amem8_f2(&C[9])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[9]), _amem8_f2(&C[9]));
 
     // results			=	_cmpysp(_amem8_f2(&B[13]), _amem8_f2(&C[13]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[13]), _amem8_f2(&C[13])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[13]), _amem8_f2(&C[13]));
 
     dtemp1 = _daddsp(_amem8_f2(&invA[5]), dtemp1);
     //_amem8_f2(&output[9])	=	dtemp1;
@@ -621,19 +621,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[0]), _amem8_f2(&C[2]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[0]), _amem8_f2(&C[2]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[0]), _amem8_f2(&C[2]));
 
     // results			=	_cmpysp(_amem8_f2(&B[4]), _amem8_f2(&C[6]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[4]), _amem8_f2(&C[6])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[4]), _amem8_f2(&C[6]));
 
     // results			=	_cmpysp(_amem8_f2(&B[8]), _amem8_f2(&C[10]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[8]), _amem8_f2(&C[10])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[8]), _amem8_f2(&C[10]));
 
     // results			=	_cmpysp(_amem8_f2(&B[12]), _amem8_f2(&C[14]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[12]), _amem8_f2(&C[14])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[12]), _amem8_f2(&C[14]));
 
     dtemp1                = _daddsp(_amem8_f2(&invA[2]), dtemp1);
     _amem8_f2(&output[2]) = dtemp1;
@@ -641,19 +641,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[1]), _amem8_f2(&C[2]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[1]), _amem8_f2(&C[2]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[1]), _amem8_f2(&C[2]));
 
     // results			=	_cmpysp(_amem8_f2(&B[5]), _amem8_f2(&C[6]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[5]), _amem8_f2(&C[6])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[5]), _amem8_f2(&C[6]));
 
     // results			=	_cmpysp(_amem8_f2(&B[9]), _amem8_f2(&C[10]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[9]), _amem8_f2(&C[10])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[9]), _amem8_f2(&C[10]));
 
     // results			=	_cmpysp(_amem8_f2(&B[13]), _amem8_f2(&C[14]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[13]), _amem8_f2(&C[14])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[13]), _amem8_f2(&C[14]));
 
     dtemp1                = _daddsp(_amem8_f2(&invA[6]), dtemp1);
     _amem8_f2(&output[9]) = dtemp1;
@@ -662,19 +662,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[2]), _amem8_f2(&C[2]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[2]), _amem8_f2(&C[2]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[2]), _amem8_f2(&C[2]));
 
     // results			=	_cmpysp(_amem8_f2(&B[6]), _amem8_f2(&C[6]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[6]), _amem8_f2(&C[6])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[6]), _amem8_f2(&C[6]));
 
     // results			=	_cmpysp(_amem8_f2(&B[10]), _amem8_f2(&C[10]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[10]), _amem8_f2(&C[10])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[10]), _amem8_f2(&C[10]));
 
     // results			=	_cmpysp(_amem8_f2(&B[14]), _amem8_f2(&C[14]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[14]), _amem8_f2(&C[14])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[14]), _amem8_f2(&C[14]));
 
     dtemp1                 = _daddsp(_amem8_f2(&invA[10]), dtemp1);
     _amem8_f2(&output[15]) = dtemp1;
@@ -682,19 +682,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[0]), _amem8_f2(&C[3]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[0]), _amem8_f2(&C[3]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[0]), _amem8_f2(&C[3]));
 
     // results			=	_cmpysp(_amem8_f2(&B[4]), _amem8_f2(&C[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[4]), _amem8_f2(&C[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[4]), _amem8_f2(&C[7]));
 
     // results			=	_cmpysp(_amem8_f2(&B[8]), _amem8_f2(&C[11]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[8]), _amem8_f2(&C[11])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[8]), _amem8_f2(&C[11]));
 
     // results			=	_cmpysp(_amem8_f2(&B[12]), _amem8_f2(&C[15]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[12]), _amem8_f2(&C[15])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[12]), _amem8_f2(&C[15]));
 
     dtemp1                = _daddsp(_amem8_f2(&invA[3]), dtemp1);
     _amem8_f2(&output[3]) = dtemp1;
@@ -702,19 +702,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[1]), _amem8_f2(&C[3]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[1]), _amem8_f2(&C[3]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[1]), _amem8_f2(&C[3]));
 
     // results			=	_cmpysp(_amem8_f2(&B[5]), _amem8_f2(&C[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[5]), _amem8_f2(&C[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[5]), _amem8_f2(&C[7]));
 
     // results			=	_cmpysp(_amem8_f2(&B[9]), _amem8_f2(&C[11]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[9]), _amem8_f2(&C[11])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[9]), _amem8_f2(&C[11]));
 
     // results			=	_cmpysp(_amem8_f2(&B[13]), _amem8_f2(&C[15]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[13]), _amem8_f2(&C[15])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[13]), _amem8_f2(&C[15]));
 
     dtemp1                 = _daddsp(_amem8_f2(&invA[7]), dtemp1);
     _amem8_f2(&output[10]) = dtemp1;
@@ -723,19 +723,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[2]), _amem8_f2(&C[3]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[2]), _amem8_f2(&C[3]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[2]), _amem8_f2(&C[3]));
 
     // results			=	_cmpysp(_amem8_f2(&B[6]), _amem8_f2(&C[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[6]), _amem8_f2(&C[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[6]), _amem8_f2(&C[7]));
 
     //	results			=	_cmpysp(_amem8_f2(&B[10]), _amem8_f2(&C[11]));
     //	dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[10]), _amem8_f2(&C[11])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[10]), _amem8_f2(&C[11]));
 
     //	results			=	_cmpysp(_amem8_f2(&B[14]), _amem8_f2(&C[15]));
     //	dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[14]), _amem8_f2(&C[15])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[14]), _amem8_f2(&C[15]));
 
     dtemp1                 = _daddsp(_amem8_f2(&invA[11]), dtemp1);
     _amem8_f2(&output[16]) = dtemp1;
@@ -744,19 +744,19 @@ void MATRIX_single8x8MatInv(
 
     // results			=	_cmpysp(_amem8_f2(&B[3]), _amem8_f2(&C[3]));
     // dtemp1			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp1 = _complex_conjugate_mpysp(_amem8_f2(&B[3]), _amem8_f2(&C[3]));
+    dtemp1 = cconjmpysp_i(_amem8_f2(&B[3]), _amem8_f2(&C[3]));
 
     // results			=	_cmpysp(_amem8_f2(&B[7]), _amem8_f2(&C[7]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[7]), _amem8_f2(&C[7])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[7]), _amem8_f2(&C[7]));
 
     // results			=	_cmpysp(_amem8_f2(&B[11]), _amem8_f2(&C[11]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[11]), _amem8_f2(&C[11])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[11]), _amem8_f2(&C[11]));
 
     // results			=	_cmpysp(_amem8_f2(&B[15]), _amem8_f2(&C[15]));
     // dtemp1			=	_daddsp(dtemp1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    dtemp1 = _daddsp(dtemp1, _complex_conjugate_mpysp(_amem8_f2(&B[15]), _amem8_f2(&C[15])));
+    dtemp1 = cconjmacsp_i(dtemp1, _amem8_f2(&B[15]), _amem8_f2(&C[15]));
 
     dtemp1                 = _daddsp(_amem8_f2(&invA[15]), dtemp1);
     _amem8_f2(&output[21]) = dtemp1;
@@ -841,9 +841,7 @@ void MATRIX_4x4_BWInversionfp(
     D1          = _amem8_f2(&Input[11]);
     dtemp       = _dmpysp(D1, D1);
     detA        = D0 * D3 - _hif2(dtemp) - _lof2(dtemp);
-    oneOverdetA = _rcpsp(detA);
-    oneOverdetA = oneOverdetA * (2.f - detA * oneOverdetA);
-    oneOverdetA = oneOverdetA * (2.f - detA * oneOverdetA);
+    oneOverdetA = rcpsp_i(detA);
 
     ftemp1 = D0 * oneOverdetA;
     D0     = D3 * oneOverdetA;
@@ -859,20 +857,20 @@ void MATRIX_4x4_BWInversionfp(
     /* calculate C = B*inv(D) */
     // results			=	_cmpysp(D1, B1);
     // C0				=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    C0 = _complex_conjugate_mpysp(D1, B1);
+    C0 = cconjmpysp_i(D1, B1);
     C0 = _daddsp(C0, _dmpysp(B0, _ftof2(D0, D0)));
     // results			=	_cmpysp(D1, B0);
     // C1				=	_daddsp(_hif2_128(results), _lof2_128(results));
-    C1     = _complex_mpysp(D1, B0);
+    C1     = cmpysp_i(D1, B0);
     dtemp1 = C1;
     C1     = _daddsp(C1, _dmpysp(B1, _ftof2(D3, D3)));
     // results			=	_cmpysp(D1, B3);
     // C2				=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    C2 = _complex_conjugate_mpysp(D1, B3);
+    C2 = cconjmpysp_i(D1, B3);
     C2 = _daddsp(C2, _dmpysp(B2, _ftof2(D0, D0)));
     // results			=	_cmpysp(D1, B2);
     // C3				=	_daddsp(_hif2_128(results), _lof2_128(results));
-    C3     = _complex_mpysp(D1, B2);
+    C3     = cmpysp_i(D1, B2);
     dtemp2 = C3;
     C3     = _daddsp(C3, _dmpysp(B3, _ftof2(D3, D3)));
 
@@ -883,7 +881,7 @@ void MATRIX_4x4_BWInversionfp(
     F0 -= D3 * (_hif2(dtemp) + _lof2(dtemp));
     // results			=	_cmpysp(B1, dtemp1);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp = _complex_conjugate_mpysp(B1, dtemp1);
+    dtemp = cconjmpysp_i(B1, dtemp1);
     F0 -= 2.f * _hif2(dtemp);
 
     dtemp = _dmpysp(B2, B2);
@@ -892,22 +890,20 @@ void MATRIX_4x4_BWInversionfp(
     F3 -= D3 * (_hif2(dtemp) + _lof2(dtemp));
     // results			=	_cmpysp(B3, dtemp2);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp = _complex_conjugate_mpysp(B3, dtemp2);
+    dtemp = cconjmpysp_i(B3, dtemp2);
     F3 -= 2.f * _hif2(dtemp);
 
     // results			=	_cmpysp(B2, C0);
     // F1				=	_dsubsp(A1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    F1 = _dsubsp(A1, _complex_conjugate_mpysp(B2, C0));
+    F1 = _dsubsp(A1, cconjmpysp_i(B2, C0));
     // results			=	_cmpysp(B3, C1);
     // F1				=	_dsubsp(F1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    F1 = _dsubsp(F1, _complex_conjugate_mpysp(B3, C1));
+    F1 = _dsubsp(F1, cconjmpysp_i(B3, C1));
 
     /* Calculate F = inv(F) */
     dtemp       = _dmpysp(F1, F1);
     detA        = F0 * F3 - _hif2(dtemp) - _lof2(dtemp);
-    oneOverdetA = _rcpsp(detA);
-    oneOverdetA = oneOverdetA * (2.f - detA * oneOverdetA);
-    oneOverdetA = oneOverdetA * (2.f - detA * oneOverdetA);
+    oneOverdetA = rcpsp_i(detA);
 
     ftemp1 = F0 * oneOverdetA;
     F0     = F3 * oneOverdetA;
@@ -924,7 +920,7 @@ void MATRIX_4x4_BWInversionfp(
     /* NE output = - F * C, SW = conj(NW)*/
     // results			=	_cmpysp(F1, C2);
     // dtemp			=	_daddsp(_hif2_128(results), _lof2_128(results));
-    dtemp                 = _complex_mpysp(F1, C2);
+    dtemp                 = cmpysp_i(F1, C2);
     dtemp1                = dtemp;
     dtemp                 = _daddsp(dtemp, _dmpysp(C0, _ftof2(F0, F0)));
     _amem8_f2(&output[2]) = _ftof2(-_hif2(dtemp), -_lof2(dtemp));
@@ -934,7 +930,7 @@ void MATRIX_4x4_BWInversionfp(
 
     // results			=	_cmpysp(F1, C3);
     // dtemp			=	_daddsp(_hif2_128(results), _lof2_128(results));
-    dtemp                  = _complex_mpysp(F1, C3);
+    dtemp                  = cmpysp_i(F1, C3);
     dtemp2                 = dtemp;
     dtemp                  = _daddsp(dtemp, _dmpysp(C1, _ftof2(F0, F0)));
     B1                     = dtemp;
@@ -945,7 +941,7 @@ void MATRIX_4x4_BWInversionfp(
 
     // results			=	_cmpysp(F1, C0);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp                 = _complex_conjugate_mpysp(F1, C0);
+    dtemp                 = cconjmpysp_i(F1, C0);
     dtemp                 = _daddsp(dtemp, _dmpysp(C2, _ftof2(F3, F3)));
     _amem8_f2(&output[6]) = _ftof2(-_hif2(dtemp), -_lof2(dtemp));
     _amem8_f2(&output[9]) = _ftof2(-_hif2(dtemp), _lof2(dtemp));
@@ -954,7 +950,7 @@ void MATRIX_4x4_BWInversionfp(
 
     // results			=	_cmpysp(F1, C1);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp                  = _complex_conjugate_mpysp(F1, C1);
+    dtemp                  = cconjmpysp_i(F1, C1);
     dtemp                  = _daddsp(dtemp, _dmpysp(C3, _ftof2(F3, F3)));
     B3                     = dtemp;
     _amem8_f2(&output[7])  = _ftof2(-_hif2(dtemp), -_lof2(dtemp));
@@ -971,7 +967,7 @@ void MATRIX_4x4_BWInversionfp(
     A0 += F3 * (_hif2(dtemp) + _lof2(dtemp));
     // results			=	_cmpysp(C0, dtemp1);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp = _complex_conjugate_mpysp(C0, dtemp1);
+    dtemp = cconjmpysp_i(C0, dtemp1);
     A0 += 2.f * _hif2(dtemp);
 
     dtemp = _dmpysp(C1, C1);
@@ -980,18 +976,18 @@ void MATRIX_4x4_BWInversionfp(
     A3 += F3 * (_hif2(dtemp) + _lof2(dtemp));
     // results			=	_cmpysp(C1, dtemp2);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp = _complex_conjugate_mpysp(C1, dtemp2);
+    dtemp = cconjmpysp_i(C1, dtemp2);
     A3 += 2.f * _hif2(dtemp);
     _amem8_f2(&output[10]) = _ftof2(A0, 0.f);
     _amem8_f2(&output[15]) = _ftof2(A3, 0.f);
 
     // results			=	_cmpysp(C0, B1);
     // dtemp			=	_dsubsp(_hif2_128(results), _lof2_128(results));
-    dtemp = _complex_conjugate_mpysp(C0, B1);
+    dtemp = cconjmpysp_i(C0, B1);
     A1    = _daddsp(D1, dtemp);
     // results			=	_cmpysp(C2, B3);
     // A1				=	_daddsp(A1, _dsubsp(_hif2_128(results), _lof2_128(results)));
-    A1 = _daddsp(A1, _complex_conjugate_mpysp(C2, B3));
+    A1 = cconjmacsp_i(A1, C2, B3);
 
     _amem8_f2(&output[11]) = A1;
     _amem8_f2(&output[14]) = _ftof2(_hif2(A1), -_lof2(A1));
@@ -1050,10 +1046,10 @@ void MATRIX_Mult4x4fp(
 #endif
         for (mm = 0; mm < 4; mm++)
         {
-            dtemp  = _daddsp(dtemp, _complex_mpysp(_amem8_f2(&A1[mm]), _amem8_f2(&B[4 * mm + kk])));
-            dtemp1 = _daddsp(dtemp1, _complex_mpysp(_amem8_f2(&A2[mm]), _amem8_f2(&B[4 * mm + kk])));
-            dtemp2 = _daddsp(dtemp2, _complex_mpysp(_amem8_f2(&A3[mm]), _amem8_f2(&B[4 * mm + kk])));
-            dtemp3 = _daddsp(dtemp3, _complex_mpysp(_amem8_f2(&A4[mm]), _amem8_f2(&B[4 * mm + kk])));
+            dtemp  = cmacsp_i(dtemp, _amem8_f2(&A1[mm]), _amem8_f2(&B[4 * mm + kk]));
+            dtemp1 = cmacsp_i(dtemp1, _amem8_f2(&A2[mm]), _amem8_f2(&B[4 * mm + kk]));
+            dtemp2 = cmacsp_i(dtemp2, _amem8_f2(&A3[mm]), _amem8_f2(&B[4 * mm + kk]));
+            dtemp3 = cmacsp_i(dtemp3, _amem8_f2(&A4[mm]), _amem8_f2(&B[4 * mm + kk]));
         }
         _amem8_f2(&C1[kk]) = dtemp;
         _amem8_f2(&C2[kk]) = dtemp1;
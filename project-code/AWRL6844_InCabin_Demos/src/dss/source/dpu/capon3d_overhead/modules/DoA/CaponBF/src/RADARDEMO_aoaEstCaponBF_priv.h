@@ -44,6 +44,8 @@
 #ifndef _TMS320C6600
 #include <modules/utilities/radar_c674x.h>
 #endif
+#include <modules/utilities/radar_cplxMath.h>
+#include <modules/utilities/radar_twiddle.h>
 
 #ifdef _WIN32
 extern void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max);
@@ -271,7 +273,5 @@ extern void MATRIX_single8x8MatInv(
     IN int32_t *RESTRICT scratch,
     OUT cplxf_t         *output);
 
-extern void tw_gen_float(float *w, int n);
-
 
 #endif // RADARDEMO_AOAESTCAPONBF_PRIV_H
@@ -57,11 +57,17 @@
 #define MAX_DOPCFAR_DET   (10)
 #define MAX_RANGEBINS     (128)
 #define MAX_NPNTS         (600)
+#define RADARDEMO_AOAEST2D_DOPBATCH_MAXDET (2) //!< angle estimation outputs of the batched Doppler estimation (processingStepSelector 2 and 3) hold the estimates of this many detections
+                                              //!< with the most estimates each: 2 keeps those of 16 antennas and 9 estimates per detection in LL1
 
 #ifdef _TMS320C6X
 //#define CAPON2DMODULEDEBUG
+//#define RADARDEMO_AOAEST2D_STEERVEC_BENCHMARK
 #endif
 
+#define RADARDEMO_AOAEST2D_STEERVEC_TABLE     (0) //!< range-azimuth-elevation steering vectors stored for all angle bins
+#define RADARDEMO_AOAEST2D_STEERVEC_SEPARABLE (1) //!< range-azimuth-elevation steering vectors generated from azimuth and elevation tables
+
 //! \brief   Error code for BF AoA estimation module.
 //!
 typedef enum
@@ -71,7 +77,9 @@ typedef enum
     RADARDEMO_AOACAPONBF_NUMANT_NOTSUPPORTED, /**< number of antennas not supported */
     RADARDEMO_AOACAPONBF_FAIL_ALLOCATE_HANDLE, /**< RADARDEMO_aoAEstBF_create failed to allocate handle */
     RADARDEMO_AOACAPONBF_FAIL_ALLOCATE_LOCALINSTMEM, /**< RADARDEMO_aoAEstBF_create failed to allocate memory for buffers in local instance  */
-    RADARDEMO_AOACAPONBF_INOUTPTR_NOTCORRECT /**< input and/or output buffer for RADARDEMO_aoAEstBF_run are either NULL, or not aligned properly  */
+    RADARDEMO_AOACAPONBF_INOUTPTR_NOTCORRECT, /**< input and/or output buffer for RADARDEMO_aoAEstBF_run are either NULL, or not aligned properly  */
+    RADARDEMO_AOACAPONBF_COARSESTEP_NOTSUPPORTED, /**< coarse step of the hierarchical angle search not supported */
+    RADARDEMO_AOACAPONBF_DOPBATCH_NOTCORRECT /**< detection queued for the batched Doppler estimation is of another range bin, or the outputs have no room for its estimates */
 } RADARDEMO_aoaEst2DCaponBF_errorCode;
 
 
@@ -86,6 +94,8 @@ typedef struct _RADARDEMO_aoaEst2D_rangeAngleCfg_
                                                            1: range-azimuth detection, plus 2D capon angle heatmap, and estimation elevation only, with peak expansion
                                                            2: range-azimuth-elevation detection, plus zoom-in for finer angle estimation. */
     uint8_t dopplerEstMethod; /**< Doppler estimation method, 0-single peak search, 1-CFAR.*/
+    uint8_t steerVecGenMode; /**< steering vectors of detection method 2, RADARDEMO_AOAEST2D_STEERVEC_TABLE: stored for all angle bins,
+                                                           RADARDEMO_AOAEST2D_STEERVEC_SEPARABLE: generated from the azimuth and elevation tables.*/
 } RADARDEMO_aoaEst2D_rangeAngleCfg;
 
 
@@ -101,6 +111,7 @@ typedef struct _RADARDEMO_aoaEst2D_2DAngleCfg_
     float   sideLobThr; /**Sidelobe threshold */
     float   peakExpRelThr; /**peak expansion relative threshold -- only include neighbors with power higher than  peakExpRelThr * peakPower*/
     float   peakExpSNRThr; /**peak expansion SNR threshold -- only expand peak with SNR higher than this threshold */
+    uint8_t coarseSearchStep; /**< coarse grid step of the hierarchical angle search, in search steps: 0 or 1 - dense search (default), 2 or 3 - hierarchical search, larger values are not supported */
 } RADARDEMO_aoaEst2D_2DAngleCfg;
 
 //! \brief   Configuration substructure RADARDEMO_aoaEst2D_2DZoomInCfg for RADARDEMO_aoaEst2DCaponBF configuration.
@@ -113,6 +124,7 @@ typedef struct _RADARDEMO_aoaEst2D_2DZoomInCfg_
     float   peakExpRelThr; /**peak expansion relative threshold -- only include neighbors with power higher than  peakExpRelThr * peakPower*/
     float   peakExpSNRThr; /**peak expansion SNR threshold -- only expand peak with SNR higher than this threshold */
     uint8_t localMaxCheckFlag; /**Loca max check flag: 0 - no check; 1 - elevation domain only; 2 - both elevation and azimuth */
+    uint8_t coarseSearchStep; /**< coarse grid step of the hierarchical angle search, in zoom-in steps: 0 or 1 - dense search (default), 2 or 3 - hierarchical search, larger values are not supported */
 } RADARDEMO_aoaEst2D_2DZoomInCfg;
 
 //! \brief   Configuration substructure RADARDEMO_aoaEst2D_staticCfg for RADARDEMO_aoaEst2DCaponBF configuration.
@@ -122,6 +134,8 @@ typedef struct _RADARDEMO_aoaEst2D_staticCfg_
     uint8_t staticProcEnabled; /**< Enable static scene processing if set to 1 */
     uint8_t staticAzimStepDeciFactor; /**< static azimuth search step decimation factor, over the azimuth search steps in RADARDEMO_aoaEst2D_rangeAngleCfg*/
     uint8_t staticElevStepDeciFactor; /**< static elevation search step decimation factor, over the elevation search steps in RADARDEMO_aoaEst2D_2DAngleCfg*/
+    uint16_t staticRefreshPeriod; /**< frames between two refreshes of the whole static heatmap, 0 or 1 to compute the static heatmap every frame*/
+    float   staticChangeThr; /**< relative change of the static information of a range bin refreshing its static heatmap between two periodic refreshes*/
 } RADARDEMO_aoaEst2D_staticCfg;
 
 //! \brief   Configuration substructure RADARDEMO_aoaEst2D_staticCfg for RADARDEMO_aoaEst2DCaponBF configuration.
@@ -147,7 +161,9 @@ typedef struct _RADARDEMO_doppBinSel_config_
 {
     uint16_t doppBinSelEnable; /**< Number of input range bins.*/
     uint16_t doppFFTSize; /**< Doppler FFT size (zero padding).*/
-    uint16_t doppSelMinBin; /**< Doppler Bin min bin select (positive).*/
+    uint16_t doppSelMinBin; /**< Doppler Bin min bin select (positive). Bins doppSelMinBin to doppSelMaxBin and their
+                                 negative counterparts are used. Earlier versions read the first half at bin
+                                 doppSelMinBin / 2 (real and imaginary swapped for odd values), the same for 0 only.*/
     uint16_t doppSelMaxBin; /**< Doppler bin max bin select (positive).*/
 } RADARDEMO_doppBinSel_config;
 
@@ -194,7 +210,12 @@ typedef struct _RADARDEMO_aoaEst2DCaponBF_config_
 typedef struct _RADARDEMO_aoaEst2DCaponBF_input_
 {
     uint32_t frameCntr;
-    uint8_t   processingStepSelector; /**< Flag to select which processing to be done, if set to 0, construct rangeAzimuthHeatMap; if set to 1, estimate azimuth-elevation angle and doppler for detected points. */
+    uint8_t   processingStepSelector; /**< Flag to select which processing to be done, if set to 0, construct rangeAzimuthHeatMap; if set to 1, estimate azimuth-elevation angle and doppler for detected points;
+                                           if set to 2, estimate azimuth-elevation angle for detected points and queue the estimates for Doppler estimation, the outputs are written after the
+                                           ones already queued; if set to 3, estimate Doppler for all the queued estimates, with the input of their range bin, one dopplerIdx per estimate, and empty the queue.
+                                           Steps 2 and 3 are for range-azimuth-elevation detection (detectionMethod 2) with simple peak search for Doppler, the detections of a queue
+                                           are of one range bin, a detection is queued while the outputs, sized for RADARDEMO_AOAEST2D_DOPBATCH_MAXDET detections with the most
+                                           estimates each, have room for one more of those. */
     cplx16_t *inputRangeProcOutSamples; /**< input samples after range processing for rangeBin rangeIndx, array in format of (nVirtRxAnt * nChirps). nVirtRxAnt = nTxAnt * nPhyRxAnt. It will be
                                                                                                  modified (clutter removed) if clutterRemovalFlag = 1. */
     uint16_t rangeIndx; /**< Index to the current range bin to be processed (out of CFAR). */
@@ -247,7 +268,7 @@ typedef struct _RADARDEMO_aoaEst2DCaponBF_output_
     float    *peakPow; /**< peak power estimation.*/
     float    *dopplerDetSNR; /**< output doppler detection SNR, if NULL, then same as range-azimuth detection SNR, otherwise, contains doppler CFAR detection linear SNR.*/
     cplxf_t  *static_information; /**< Zero doppler samples for the range bins, for all the antennas, arranged in ant x rangeBin format.*/
-    cplxf_t  *bwFilter; /**< the beamweight filter for Doppler estimation, only used as output for processingStepSelector = 0 or 1. */
+    cplxf_t  *bwFilter; /**< the beamweight filter for Doppler estimation, only used as output for processingStepSelector = 0, 1 or 2. */
     cplxf_t  *invRnMatrices; /**< Pointer to vovariance matrices memory, in the order number of range bins, and upper triangle of nRxAnt x nRxAnt Hermitian matrix, only used as input
                                                           for processingStepSelector = 0. */
     float *malValPerRngBin; /**< output peak value in angle domain, per range bin.*/
@@ -73,6 +73,10 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
         *errorCode = RADARDEMO_AOACAPONBF_NUMANT_NOTSUPPORTED;
     if (moduleConfig->rangeAngleCfg.detectionMethod > 2)
         *errorCode = RADARDEMO_AOACAPONBF_ESTMETHOD_NOTSUPPORTED;
+    if ((moduleConfig->rangeAngleCfg.detectionMethod <= 1) && (moduleConfig->angle2DEst.azimElevAngleEstCfg.coarseSearchStep > RADARDEMO_AOAEST2D_HIER_MAX_STEP))
+        *errorCode = RADARDEMO_AOACAPONBF_COARSESTEP_NOTSUPPORTED;
+    if ((moduleConfig->rangeAngleCfg.detectionMethod == 2) && (moduleConfig->angle2DEst.azimElevZoominCfg.coarseSearchStep > RADARDEMO_AOAEST2D_HIER_MAX_STEP))
+        *errorCode = RADARDEMO_AOACAPONBF_COARSESTEP_NOTSUPPORTED;
 
     if (*errorCode > RADARDEMO_AOACAPONBF_NO_ERROR)
         return (NULL);
@@ -122,13 +126,31 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
     else
         handle->doppBining_handle->rad2D = 2;
 
+    // only the selected bins are computed, with the cheapest of full FFT, DFT and pruned FFT
+    RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(handle->doppBining_handle);
+    handle->doppBining_handle->doppBinTwiddle = NULL;
+    handle->doppBining_handle->subFFTTwiddle  = NULL;
+    if (handle->doppBining_handle->method != RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT)
+    {
+        handle->doppBining_handle->doppBinTwiddle = (cplxf_t *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->doppBining_handle->dopplerFFTSize * sizeof(cplxf_t), 8);
+        RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen(handle->doppBining_handle->doppBinTwiddle, handle->doppBining_handle->dopplerFFTSize);
+    }
+    if (handle->doppBining_handle->method == RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT)
+    {
+        handle->doppBining_handle->subFFTTwiddle = (float *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL1, 0, 2 * handle->doppBining_handle->subFFTSize * sizeof(float), 8);
+        tw_gen_float(handle->doppBining_handle->subFFTTwiddle, handle->doppBining_handle->subFFTSize);
+    }
+
 	// initialize handle for range-angle heatmap estimation
 	handle->raHeatMap_handle						=	(RADARDEMO_aoaEst2D_RAHeatMap_handle *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL1, 0, sizeof(RADARDEMO_aoaEst2D_RAHeatMap_handle), 1);
 	handle->raHeatMap_handle->numInputRangeBins		=	moduleConfig->numInputRangeBins;
 	handle->raHeatMap_handle->gamma					=   moduleConfig->rangeAngleCfg.mvdr_alpha;
 	handle->raHeatMap_handle->numChirps				=   moduleConfig->numInputChirps;
 
-	handle->tempInputWOstatic						=	(cplx16_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 1, handle->nRxAnt * moduleConfig->numInputChirps * sizeof(cplx16_t), 8);
+	// clutter removed copy of the range bin, only for Doppler binning: otherwise clutter removal is fused with the covariance estimation
+	handle->tempInputWOstatic						=	NULL;
+	if (handle->doppBining_handle->doppBinningEnable == 1)
+		handle->tempInputWOstatic					=	(cplx16_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 1, handle->nRxAnt * moduleConfig->numInputChirps * sizeof(cplx16_t), 8);
 	if (moduleConfig->rangeAngleCfg.detectionMethod	<= 1)	// 0: range-azimuth detection, plus 2D capon angle heatmap, and estimation (azimuth, elevation) with peak expansion
 															// 1: range-azimuth detection, plus 2D capon angle heatmap, and estimation elevation only, with peak expansion
 	{
@@ -189,6 +211,9 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 	    handle->raHeatMap_handle->elevSearchLen           =   (uint32_t) floor(divsp_i(2.f * moduleConfig->fovCfg[1], (moduleConfig->angle2DEst.azimElevAngleEstCfg.elevSearchStep))) + 1;
 	    handle->raHeatMap_handle->steeringVecAzim         =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->nRxAnt * handle->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t), 8);
 	    handle->raHeatMap_handle->steeringVecElev         =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->nRxAnt * handle->raHeatMap_handle->elevSearchLen *sizeof(cplxf_t), 8);
+	    handle->raHeatMap_handle->steeringVec             =   NULL;
+	    handle->raHeatMap_handle->steeringVecBlock        =   NULL;
+	    handle->raHeatMap_handle->steerVecBlockRows       =   0;
 
 	    currentAngle                                    =   handle->raHeatMap_handle->nuInit;
 	    steerVecPtr                                     =   (__float2_t *)handle->raHeatMap_handle->steeringVecAzim;
@@ -218,7 +243,7 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 
 	    moduleConfig->numRAangleBin						=	handle->raHeatMap_handle->azimSearchLen;
 		
-		scratchSize										=   2 * numAzimAnt * numAzimAnt * sizeof(cplxf_t);		// 8 x 8 x 8 bytes
+		scratchSize										=   RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(numAzimAnt, handle->nRxAnt);
 		handle->raHeatMap_handle->scratchPad			=   (uint32_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 1, scratchSize, 8);
 	}
 	else                                                    //2: range-azimuth-elevation detection, plus zoom-in for finer angle estimation.
@@ -237,12 +262,8 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 		fov0											=	moduleConfig->fovCfg[0] - moduleConfig->rangeAngleCfg.searchStep;
 		fov1											=	moduleConfig->fovCfg[1] - moduleConfig->rangeAngleCfg.searchStep;
 
-		invFov0											=	_rcpsp(fov0);
-		invFov0											=	invFov0 * (2.f - fov0 * invFov0);
-		invFov0											=	invFov0 * (2.f - fov0 * invFov0);
-		invFov1											=	_rcpsp(fov1);
-		invFov1											=	invFov1 * (2.f - fov1 * invFov1);
-		invFov1											=	invFov1 * (2.f - fov1 * invFov1);
+		invFov0											=	rcpsp_i(fov0);
+		invFov1											=	rcpsp_i(fov1);
 
         //init nu/mu init/step, and steer vector -- this is range-azimuth-elevation search
         handle->raHeatMap_handle->nuInit                =   - (float)sinsp_i(fov0 * (float)RADARDEMO_AOAESTBF_PIOVER180);
@@ -252,28 +273,80 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 
         handle->raHeatMap_handle->azimSearchLen         =   (uint32_t) floor(divsp_i(2.f * fov0, (moduleConfig->rangeAngleCfg.searchStep))) + 1;
         handle->raHeatMap_handle->elevSearchLen         =   (uint32_t) floor(divsp_i(2.f * fov1,  (moduleConfig->rangeAngleCfg.searchStep))) + 1;
-        handle->raHeatMap_handle->steeringVec           =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, moduleConfig->nRxAnt * handle->raHeatMap_handle->elevSearchLen * handle->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t), 1);
         moduleConfig->numRAangleBin                     =   handle->raHeatMap_handle->azimSearchLen * handle->raHeatMap_handle->elevSearchLen;
+        handle->raHeatMap_handle->steeringVec           =   NULL;
+        handle->raHeatMap_handle->steeringVecAzim       =   NULL;
+        handle->raHeatMap_handle->steeringVecElev       =   NULL;
+        handle->raHeatMap_handle->steeringVecBlock      =   NULL;
+        handle->raHeatMap_handle->steerVecBlockRows     =   0;
 
-        currentElev                                     =   handle->raHeatMap_handle->muInit;
-        steerVecPtr                                     =   (__float2_t *)handle->raHeatMap_handle->steeringVec;
-        for (i = 0; i < (int32_t)handle->raHeatMap_handle->elevSearchLen; i++ )
+        if (moduleConfig->rangeAngleCfg.steerVecGenMode == RADARDEMO_AOAEST2D_STEERVEC_SEPARABLE)
         {
+            // a(az, el) = aAzim(az) .* aElev(el): only the azimuth and elevation tables are stored, and the steering vectors
+            // of a block of elevation rows, with at least RADARDEMO_AOAEST2D_STEERVEC_BLOCKBINS angle bins, are generated per range bin.
+            k                                           =   (RADARDEMO_AOAEST2D_STEERVEC_BLOCKBINS + handle->raHeatMap_handle->azimSearchLen - 1) / handle->raHeatMap_handle->azimSearchLen;
+            if (k > (int32_t)handle->raHeatMap_handle->elevSearchLen)
+                k                                       =   handle->raHeatMap_handle->elevSearchLen;
+            handle->raHeatMap_handle->steerVecBlockRows =   (uint16_t) k;
+            handle->raHeatMap_handle->steeringVecAzim   =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, moduleConfig->nRxAnt * handle->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t), 8);
+            handle->raHeatMap_handle->steeringVecElev   =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, moduleConfig->nRxAnt * handle->raHeatMap_handle->elevSearchLen *sizeof(cplxf_t), 8);
+            handle->raHeatMap_handle->steeringVecBlock  =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, moduleConfig->nRxAnt * handle->raHeatMap_handle->steerVecBlockRows * handle->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t), 8);
+
             currentAzim                                 =   handle->raHeatMap_handle->nuInit;
+            steerVecPtr                                 =   (__float2_t *)handle->raHeatMap_handle->steeringVecAzim;
             for (k = 0; k < (int32_t)handle->raHeatMap_handle->azimSearchLen; k++ )
             {
                 for (j = 0; j < (int32_t)moduleConfig->nRxAnt; j++)
                 {
                     virtAntIdx                          =   handle->raHeatMap_handle->virtAntInd2Proc[j];
-                    tempfRe                             =   (float)cossp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->m_ind[virtAntIdx] * currentAzim + moduleConfig->n_ind[virtAntIdx] * currentElev)) * (float) moduleConfig->phaseRot[virtAntIdx];
-                    tempfIm                             =   (float)sinsp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->m_ind[virtAntIdx] * currentAzim + moduleConfig->n_ind[virtAntIdx] * currentElev)) * (float) moduleConfig->phaseRot[virtAntIdx];
+                    tempfRe                             =   (float)cossp_i(-RADARDEMO_AOAESTBF_PI * moduleConfig->m_ind[virtAntIdx] * currentAzim) * (float) moduleConfig->phaseRot[virtAntIdx];
+                    tempfIm                             =   (float)sinsp_i(-RADARDEMO_AOAESTBF_PI * moduleConfig->m_ind[virtAntIdx] * currentAzim) * (float) moduleConfig->phaseRot[virtAntIdx];
                     _amem8_f2(steerVecPtr++)            =   _complex_mpysp(_ftof2(tempfRe, tempfIm), _amem8_f2(&moduleConfig->phaseCompVect[virtAntIdx]));
                 }
                 currentAzim                             +=  handle->raHeatMap_handle->nuStep;
             }
-            currentElev                                 +=  handle->raHeatMap_handle->muStep;
+
+            currentElev                                 =   handle->raHeatMap_handle->muInit;
+            steerVecPtr                                 =   (__float2_t *)handle->raHeatMap_handle->steeringVecElev;
+            for (i = 0; i < (int32_t)handle->raHeatMap_handle->elevSearchLen; i++ )
+            {
+                for (j = 0; j < (int32_t)moduleConfig->nRxAnt; j++)
+                {
+                    virtAntIdx                          =   handle->raHeatMap_handle->virtAntInd2Proc[j];
+                    tempfRe                             =   (float)cossp_i(-RADARDEMO_AOAESTBF_PI * moduleConfig->n_ind[virtAntIdx] * currentElev);
+                    tempfIm                             =   (float)sinsp_i(-RADARDEMO_AOAESTBF_PI * moduleConfig->n_ind[virtAntIdx] * currentElev);
+                    _amem8_f2(steerVecPtr++)            =   _ftof2(tempfRe, tempfIm);
+                }
+                currentElev                             +=  handle->raHeatMap_handle->muStep;
+            }
+#ifdef RADARDEMO_AOAEST2D_STEERVEC_BENCHMARK
+            RADARDEMO_aoaEst2DCaponBF_steerVecBenchmark(handle->raHeatMap_handle, moduleConfig->nRxAnt);
+#endif
         }
-		scratchSize										=   2 * handle->nRxAnt * handle->nRxAnt * sizeof(cplxf_t); // 12 x 12 x 8 bytes
+        else
+        {
+            handle->raHeatMap_handle->steeringVec       =   (cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, moduleConfig->nRxAnt * handle->raHeatMap_handle->elevSearchLen * handle->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t), 1);
+
+            currentElev                                 =   handle->raHeatMap_handle->muInit;
+            steerVecPtr                                 =   (__float2_t *)handle->raHeatMap_handle->steeringVec;
+            for (i = 0; i < (int32_t)handle->raHeatMap_handle->elevSearchLen; i++ )
+            {
+                currentAzim                             =   handle->raHeatMap_handle->nuInit;
+                for (k = 0; k < (int32_t)handle->raHeatMap_handle->azimSearchLen; k++ )
+                {
+                    for (j = 0; j < (int32_t)moduleConfig->nRxAnt; j++)
+                    {
+                        virtAntIdx                      =   handle->raHeatMap_handle->virtAntInd2Proc[j];
+                        tempfRe                         =   (float)cossp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->m_ind[virtAntIdx] * currentAzim + moduleConfig->n_ind[virtAntIdx] * currentElev)) * (float) moduleConfig->phaseRot[virtAntIdx];
+                        tempfIm                         =   (float)sinsp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->m_ind[virtAntIdx] * currentAzim + moduleConfig->n_ind[virtAntIdx] * currentElev)) * (float) moduleConfig->phaseRot[virtAntIdx];
+                        _amem8_f2(steerVecPtr++)        =   _complex_mpysp(_ftof2(tempfRe, tempfIm), _amem8_f2(&moduleConfig->phaseCompVect[virtAntIdx]));
+                    }
+                    currentAzim                         +=  handle->raHeatMap_handle->nuStep;
+                }
+                currentElev                             +=  handle->raHeatMap_handle->muStep;
+            }
+        }
+		scratchSize										=   RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(handle->nRxAnt, handle->nRxAnt);
 		handle->raHeatMap_handle->scratchPad			=   (uint32_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 1, scratchSize, 8);
 		moduleConfig->numRAangleBin						=	handle->raHeatMap_handle->azimSearchLen * handle->raHeatMap_handle->elevSearchLen;
 	}
@@ -307,6 +380,7 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 		handle->aeEstimation_handle->sideLobThr			=	moduleConfig->angle2DEst.azimElevAngleEstCfg.sideLobThr;
 		handle->aeEstimation_handle->peakExpRelThr		=	moduleConfig->angle2DEst.azimElevAngleEstCfg.peakExpRelThr;
 		handle->aeEstimation_handle->peakExpSNRThr		=	moduleConfig->angle2DEst.azimElevAngleEstCfg.peakExpSNRThr;
+		handle->aeEstimation_handle->coarseSearchStep	=	moduleConfig->angle2DEst.azimElevAngleEstCfg.coarseSearchStep;
 		handle->aeEstimation_handle->procRngBinMask		=	(uint32_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL1, 0, (moduleConfig->numInputRangeBins >> 5) *sizeof(uint32_t), 1);
 	}
 	else                                                    //2: range-azimuth-elevation detection, plus zoom-in for finer angle estimation.
@@ -351,7 +425,26 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 			handle->aeEstimation_handle->steeringVecElevStep[j].real	=	(float)cossp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->n_ind[j] * handle->aeEstimation_handle->muStep));
 			handle->aeEstimation_handle->steeringVecElevStep[j].imag	=	(float)sinsp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->n_ind[j] * handle->aeEstimation_handle->muStep));
 		}
-		scratchSize  =   (handle->aeEstimation_handle->azimSearchLen * handle->aeEstimation_handle->elevSearchLen) + 3 * handle->aeEstimation_handle->nRxAnt * 2; // 12 x 12 x 8 bytes
+		handle->aeEstimation_handle->coarseSearchStep	=	moduleConfig->angle2DEst.azimElevZoominCfg.coarseSearchStep;
+		handle->aeEstimation_handle->steeringVecElevTab	=	NULL;
+		handle->aeEstimation_handle->zoominCache		=	NULL;
+		handle->aeEstimation_handle->zoominCacheInvRn	=	NULL;
+		if (handle->aeEstimation_handle->coarseSearchStep > 1)
+		{
+			//hierarchical search: elevation steering vectors of the zoom-in grid, and spectrum cache of the range bin
+			handle->aeEstimation_handle->steeringVecElevTab	=	(cplxf_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL1, 0, handle->aeEstimation_handle->elevSearchLen * handle->aeEstimation_handle->nRxAnt *sizeof(cplxf_t), 8);
+			handle->aeEstimation_handle->zoominCache		=	(RADARDEMO_aoaEst2D_aeCacheEntry *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, RADARDEMO_AOAEST2D_AECACHE_SIZE *sizeof(RADARDEMO_aoaEst2D_aeCacheEntry), 8);
+			for (i = 0; i < (int32_t)handle->aeEstimation_handle->elevSearchLen; i++)
+			{
+				for (j = 0; j < (int32_t)moduleConfig->nRxAnt; j++)
+				{
+					tempfRe								=	(float)cossp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->n_ind[j] * (handle->aeEstimation_handle->muInit + handle->aeEstimation_handle->muStep * i)));
+					tempfIm								=	(float)sinsp_i(-RADARDEMO_AOAESTBF_PI * (moduleConfig->n_ind[j] * (handle->aeEstimation_handle->muInit + handle->aeEstimation_handle->muStep * i)));
+					_amem8_f2(&handle->aeEstimation_handle->steeringVecElevTab[i * moduleConfig->nRxAnt + j])	=	_ftof2(tempfRe, tempfIm);
+				}
+			}
+		}
+		scratchSize  =   RADARDEMO_AOAEST2D_ZOOMIN_SCRATCHSIZE(handle->aeEstimation_handle->nRxAnt, handle->aeEstimation_handle->azimSearchLen, handle->aeEstimation_handle->elevSearchLen, handle->aeEstimation_handle->coarseSearchStep > 1);
 		handle->aeEstimation_handle->scratchPad			=   (uint32_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL1, 1, scratchSize, 8);
 
 		handle->aeEstimation_handle->zoominFactor		=	moduleConfig->angle2DEst.azimElevZoominCfg.zoominFactor;
@@ -374,7 +467,25 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 	handle->dopplerFFTSize      =   moduleConfig->dopperFFTSize;
 	handle->useCFAR4DopDet      =   moduleConfig->rangeAngleCfg.dopplerEstMethod;
 
-	scratchSize					= 2 * handle->dopplerFFTSize * 2 * sizeof(float);
+	// the angle estimates of a detection, or of the detections queued for a range bin, are beamformed together, in
+	// passes of as many beams as the LL1 scratch holds: 12 beams with 64 Doppler bins, 4 with 128
+	i							=	2 * handle->aeEstimation_handle->peakExpSamples + 1;
+	if (handle->aeEstimation_handle->zoomInFlag)
+		handle->maxNumBeams		=	(uint16_t) (i * i);
+	else
+		handle->maxNumBeams		=	(uint16_t) (handle->aeEstimation_handle->maxNpeak2Search * i * i);
+	i							=	handle->maxNumBeams;
+	if ((handle->aeEstimation_handle->zoomInFlag) && (handle->useCFAR4DopDet == 0))
+		i						*=	RADARDEMO_AOAEST2D_DOPBATCH_MAXDET;
+	while ((i > 1) && (RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(i, handle->doppBining_handle->dopplerFFTSize) > RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH))
+		i--;
+	if (i > RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK)
+		i						&=	~(RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK - 1);
+	handle->dopNumBeamsPerPass	=	(uint16_t) i;
+	handle->dopQueueNumDet		=	0;
+	handle->dopQueueNumBeams	=	0;
+	handle->dopQueueRangeIndx	=	0;
+	scratchSize					=	RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(handle->dopNumBeamsPerPass, handle->doppBining_handle->dopplerFFTSize);
 	handle->scratchPad			=   (uint32_t *) radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL1, 1, scratchSize, 8);
 		
     if (handle->scratchPad == NULL)
@@ -390,6 +501,16 @@ void *RADARDEMO_aoaEst2DCaponBF_create(
 	}
 	tw_gen_float(handle->dopTwiddle, handle->dopplerFFTSize);
 
+	// persistent across the detections of a range bin, not in scratch: nRxAnt x dopplerFFTSize x 8 bytes of LL2, 16 KB
+	// with 16 antennas and 128 Doppler bins, 11% of the 0x26000 bytes L2 heap of mmwave_demo_dss.c
+	handle->dopSlice			=	(cplxf_t *)radarOsal_memAlloc((uint8_t) RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->nRxAnt * handle->doppBining_handle->dopplerFFTSize * sizeof(cplxf_t), 8);
+	if (handle->dopSlice == NULL)
+	{
+		*errorCode	=	RADARDEMO_AOACAPONBF_FAIL_ALLOCATE_LOCALINSTMEM;
+		return (handle);
+	}
+	handle->dopSliceSrc			=	NULL;
+
 	if (handle->useCFAR4DopDet)
 	{
 		RADARDEMO_detectionCFAR_config cfarModuleConfig;
@@ -447,7 +568,8 @@ void    RADARDEMO_aoaEst2DCaponBF_delete(
 		RADARDEMO_detectionCFAR_delete(aoaEstBFInst->dopCFARHandle);
 	}
 	radarOsal_memFree(aoaEstBFInst->dopTwiddle, 2 * aoaEstBFInst->dopplerFFTSize * sizeof(float));
-	radarOsal_memFree(aoaEstBFInst->scratchPad, 2 * aoaEstBFInst->dopplerFFTSize * 2 * sizeof(float));
+	radarOsal_memFree(aoaEstBFInst->scratchPad, RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(aoaEstBFInst->dopNumBeamsPerPass, aoaEstBFInst->doppBining_handle->dopplerFFTSize));
+	radarOsal_memFree(aoaEstBFInst->dopSlice, aoaEstBFInst->nRxAnt * aoaEstBFInst->doppBining_handle->dopplerFFTSize * sizeof(cplxf_t));
 
     uint32_t totNumInputPerRangeBinForCovCalc, scratchSize_DoppInput, scratchSize_DoppOut;
     totNumInputPerRangeBinForCovCalc = aoaEstBFInst->doppBining_handle->numDoppBinSel * 2 * aoaEstBFInst->numFrmPerSlidingWindow * aoaEstBFInst->nRxAnt;
@@ -457,6 +579,10 @@ void    RADARDEMO_aoaEst2DCaponBF_delete(
     radarOsal_memFree(aoaEstBFInst->doppBining_handle->tempDoppInput, scratchSize_DoppInput);
     radarOsal_memFree(aoaEstBFInst->doppBining_handle->tempDoppOut, scratchSize_DoppOut);
     radarOsal_memFree(aoaEstBFInst->doppBining_handle->dopTwiddle, 2 * aoaEstBFInst->doppBining_handle->dopplerFFTSize * sizeof(float));
+    if (aoaEstBFInst->doppBining_handle->doppBinTwiddle != NULL)
+        radarOsal_memFree(aoaEstBFInst->doppBining_handle->doppBinTwiddle, aoaEstBFInst->doppBining_handle->dopplerFFTSize * sizeof(cplxf_t));
+    if (aoaEstBFInst->doppBining_handle->subFFTTwiddle != NULL)
+        radarOsal_memFree(aoaEstBFInst->doppBining_handle->subFFTTwiddle, 2 * aoaEstBFInst->doppBining_handle->subFFTSize * sizeof(float));
 
 	if (aoaEstBFInst->detectionMethod	<= 1)						// 0: range-azimuth detection, plus 2D capon angle heatmap, and estimation (azimuth, elevation) with peak expansion
 															// 1: range-azimuth detection, plus 2D capon angle heatmap, and estimation elevation only, with peak expansion
@@ -473,7 +599,11 @@ void    RADARDEMO_aoaEst2DCaponBF_delete(
 		radarOsal_memFree(aoaEstBFInst->aeEstimation_handle->steeringVecAzimStep, aoaEstBFInst->aeEstimation_handle->nRxAnt *sizeof(cplxf_t));
 		radarOsal_memFree(aoaEstBFInst->aeEstimation_handle->steeringVecElevInit, aoaEstBFInst->aeEstimation_handle->nRxAnt *sizeof(cplxf_t));
 		radarOsal_memFree(aoaEstBFInst->aeEstimation_handle->steeringVecElevStep, aoaEstBFInst->aeEstimation_handle->nRxAnt *sizeof(cplxf_t));
-		scratchSize  =   (aoaEstBFInst->aeEstimation_handle->nRxAnt * aoaEstBFInst->aeEstimation_handle->nRxAnt) * 2 * sizeof(uint32_t) + 3 * aoaEstBFInst->aeEstimation_handle->nRxAnt * 2 * sizeof(uint32_t); // 12 x 12 x 8 bytes
+		if (aoaEstBFInst->aeEstimation_handle->steeringVecElevTab != NULL)
+			radarOsal_memFree(aoaEstBFInst->aeEstimation_handle->steeringVecElevTab, aoaEstBFInst->aeEstimation_handle->elevSearchLen * aoaEstBFInst->aeEstimation_handle->nRxAnt *sizeof(cplxf_t));
+		if (aoaEstBFInst->aeEstimation_handle->zoominCache != NULL)
+			radarOsal_memFree(aoaEstBFInst->aeEstimation_handle->zoominCache, RADARDEMO_AOAEST2D_AECACHE_SIZE *sizeof(RADARDEMO_aoaEst2D_aeCacheEntry));
+		scratchSize  =   RADARDEMO_AOAEST2D_ZOOMIN_SCRATCHSIZE(aoaEstBFInst->aeEstimation_handle->nRxAnt, aoaEstBFInst->aeEstimation_handle->azimSearchLen, aoaEstBFInst->aeEstimation_handle->elevSearchLen, aoaEstBFInst->aeEstimation_handle->coarseSearchStep > 1);
 		radarOsal_memFree(aoaEstBFInst->aeEstimation_handle->scratchPad, scratchSize);
 	}
 	radarOsal_memFree(aoaEstBFInst->aeEstimation_handle, sizeof(RADARDEMO_aoaEst2D_aeEst_handle));
@@ -487,14 +617,18 @@ void    RADARDEMO_aoaEst2DCaponBF_delete(
 	{
 		radarOsal_memFree(aoaEstBFInst->raHeatMap_handle->virtAntInd2Proc, aoaEstBFInst->raHeatMap_handle->nRxAnt *sizeof(uint8_t));
 		
-		scratchSize  =   aoaEstBFInst->raHeatMap_handle->nRxAnt * aoaEstBFInst->raHeatMap_handle->nRxAnt * 2 * sizeof(uint32_t);		// 8 x 8 x 8 bytes
+		scratchSize  =   RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(aoaEstBFInst->raHeatMap_handle->nRxAnt, aoaEstBFInst->nRxAnt);
 		radarOsal_memFree(aoaEstBFInst->raHeatMap_handle->scratchPad, scratchSize);
 	}
 	else                                                    //2: range-azimuth-elevation detection, plus zoom-in for finer angle estimation.
 	{
 		radarOsal_memFree(aoaEstBFInst->raHeatMap_handle->virtAntInd2Proc, aoaEstBFInst->raHeatMap_handle->nRxAnt *sizeof(uint8_t));
+		if (aoaEstBFInst->raHeatMap_handle->steeringVec != NULL)
+			radarOsal_memFree(aoaEstBFInst->raHeatMap_handle->steeringVec, aoaEstBFInst->raHeatMap_handle->nRxAnt * aoaEstBFInst->raHeatMap_handle->elevSearchLen * aoaEstBFInst->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t));
+		if (aoaEstBFInst->raHeatMap_handle->steeringVecBlock != NULL)
+			radarOsal_memFree(aoaEstBFInst->raHeatMap_handle->steeringVecBlock, aoaEstBFInst->raHeatMap_handle->nRxAnt * aoaEstBFInst->raHeatMap_handle->steerVecBlockRows * aoaEstBFInst->raHeatMap_handle->azimSearchLen *sizeof(cplxf_t));
 
-		scratchSize  =   aoaEstBFInst->raHeatMap_handle->nRxAnt * aoaEstBFInst->raHeatMap_handle->nRxAnt * 2 * sizeof(uint32_t);		// 8 x 8 x 8 bytes
+		scratchSize  =   RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(aoaEstBFInst->raHeatMap_handle->nRxAnt, aoaEstBFInst->nRxAnt);
 		radarOsal_memFree(aoaEstBFInst->raHeatMap_handle->scratchPad, scratchSize);
 	}
     radarOsal_memFree(aoaEstBFInst->raHeatMap_handle, sizeof(RADARDEMO_aoaEst2D_RAHeatMap_handle));
@@ -532,79 +666,57 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 
 	if (input->processingStepSelector == 0) /* estimate the range-angle heatmap, called per range bin*/
 	{
-		/*clutter removal, for all the antennas need to be processed for the module*/
-		if (input->clutterRemovalFlag)
-		{
+		// the inverse covariance matrices are updated, the zoom-in spectrum cache is out of date
+		aoaEstBFInst->aeEstimation_handle->zoominCacheInvRn	=	NULL;
+		// the radar cube and the DC values are updated, the Doppler slice is out of date
+		aoaEstBFInst->dopSliceSrc	=	NULL;
+		aoaEstBFInst->dopQueueNumDet	=	0;
+		aoaEstBFInst->dopQueueNumBeams	=	0;
+
+        if (aoaEstBFInst->doppBining_handle->doppBinningEnable == 1)
+        {
+            /*clutter removal, for all the antennas need to be processed for the module*/
+            if (input->clutterRemovalFlag)
+            {
 #ifdef CAPON2DMODULEDEBUG
-		    cycleStart = TSCL;
+                cycleStart = TSCL;
 #endif
-			RADARDEMO_aoaEst2DCaponBF_clutterRemoval(
-				(int32_t) aoaEstBFInst->nRxAnt,
-				(int32_t) input->nChirps,
-				(cplx16_t *) input->inputRangeProcOutSamples,
-				(cplx16_t *) aoaEstBFInst->tempInputWOstatic,
-                (cplxf_t *)&estOutput->static_information[input->rangeIndx * aoaEstBFInst->nRxAnt]);
+                RADARDEMO_aoaEst2DCaponBF_clutterRemoval(
+                    (int32_t) aoaEstBFInst->nRxAnt,
+                    (int32_t) input->nChirps,
+                    (cplx16_t *) input->inputRangeProcOutSamples,
+                    (cplx16_t *) aoaEstBFInst->tempInputWOstatic,
+                    (cplxf_t *)&estOutput->static_information[input->rangeIndx * aoaEstBFInst->nRxAnt]);
 #if 0
-                if (aoaEstBFInst->numFrmPerSlidingWindow == 1) //ToDo Verify this  Copy only the oldest frame
-                {
-                    // Copy back to radar cube all chirps: Clutter (DC) removed, and transposed (antenna x chirp)
-                    memcpy(input->inputRangeProcOutSamples, aoaEstBFInst->tempInputWOstatic, aoaEstBFInst->nRxAnt * input->nChirps * sizeof(cplx16_t));
-                }
+                    if (aoaEstBFInst->numFrmPerSlidingWindow == 1) //ToDo Verify this  Copy only the oldest frame
+                    {
+                        // Copy back to radar cube all chirps: Clutter (DC) removed, and transposed (antenna x chirp)
+                        memcpy(input->inputRangeProcOutSamples, aoaEstBFInst->tempInputWOstatic, aoaEstBFInst->nRxAnt * input->nChirps * sizeof(cplx16_t));
+                    }
 #endif
 #ifdef CAPON2DMODULEDEBUG
-            estOutput->cyclesLog->crCycles[input->rangeIndx] = TSCL - cycleStart;
+                estOutput->cyclesLog->crCycles[input->rangeIndx] = TSCL - cycleStart;
 #endif
-        }
-
-        if (aoaEstBFInst->doppBining_handle->doppBinningEnable == 1)
-        {
+            }
 
             // ZG: Doppler Binning
-            float *RESTRICT doppBinFFTInput;
-            float *RESTRICT doppBinFFTOutput;
-            uint32_t        inputWOStaticOffset, secondHalfFftOutSelOffset, memOffset;
+            uint32_t        inputWOStaticOffset, memOffset;
             uint32_t        subframeIdx, antIdx;
-            unsigned char  *brev = NULL;
 
             memOffset                 = 0;
             inputWOStaticOffset       = 0;
-            doppBinFFTInput           = (float *)aoaEstBFInst->doppBining_handle->tempDoppInput;
-            doppBinFFTOutput          = (float *)aoaEstBFInst->doppBining_handle->tempDoppOut;
-            secondHalfFftOutSelOffset = (aoaEstBFInst->doppBining_handle->dopplerFFTSize - aoaEstBFInst->doppBining_handle->numDoppBinSel - aoaEstBFInst->doppBining_handle->doppSelMinBin) << 1;
 
             for (antIdx = 0; antIdx < aoaEstBFInst->nRxAnt; antIdx++)
             {
                 for (subframeIdx = 0; subframeIdx < aoaEstBFInst->doppBining_handle->numSubFrames; subframeIdx++)
                 {
-                    // get input value from clutter removal output to FFT input, but need to convert 16 bits to 32 bits.
-                    // memcpy(aoaEstBFInst->tempInputWOstatic[inputWOStaticOffset], doppBinFFTInput, (aoaEstBFInst->doppBining_handle->numChirps << 1) * sizeof(float));
-                    for (i = 0; i < aoaEstBFInst->doppBining_handle->numChirps; i++)
-                    {
-                        doppBinFFTInput[2 * i]     = (float)(aoaEstBFInst->tempInputWOstatic[inputWOStaticOffset + i].real);
-                        doppBinFFTInput[2 * i + 1] = (float)(aoaEstBFInst->tempInputWOstatic[inputWOStaticOffset + i].imag);
-                    }
-                    // padding zeros
-                    for (i = aoaEstBFInst->doppBining_handle->numChirps; i < aoaEstBFInst->doppBining_handle->dopplerFFTSize; i++)
-                    {
-                        _amem8_f2(&doppBinFFTInput[2 * i]) = _ftof2(0.f, 0.f);
-                    }
+                    // selected Doppler bins of the clutter removed chirps, copied to the right position
+                    RADARDEMO_aoaEst2DCaponBF_doppBinning(
+                        aoaEstBFInst->doppBining_handle,
+                        &aoaEstBFInst->tempInputWOstatic[inputWOStaticOffset],
+                        &aoaEstBFInst->doppBining_handle->DoppBinSelOutAccum[memOffset]);
                     inputWOStaticOffset += aoaEstBFInst->doppBining_handle->numChirps;
-
-                    DSPF_sp_fftSPxSP(
-                        aoaEstBFInst->doppBining_handle->dopplerFFTSize,
-                        doppBinFFTInput,
-                        (float *)aoaEstBFInst->doppBining_handle->dopTwiddle,
-                        doppBinFFTOutput,
-                        brev,
-                        aoaEstBFInst->doppBining_handle->rad2D,
-                        0,
-                        aoaEstBFInst->doppBining_handle->dopplerFFTSize);
-
-                    // select the bins from Doppler output and copied to the right position
-                    memcpy((void *)&aoaEstBFInst->doppBining_handle->DoppBinSelOutAccum[memOffset], &doppBinFFTOutput[aoaEstBFInst->doppBining_handle->doppSelMinBin], (aoaEstBFInst->doppBining_handle->numDoppBinSel) * sizeof(cplxf_t));
-                    memOffset += aoaEstBFInst->doppBining_handle->numDoppBinSel; // *2 for complex values
-                    memcpy((void *)&aoaEstBFInst->doppBining_handle->DoppBinSelOutAccum[memOffset], &doppBinFFTOutput[secondHalfFftOutSelOffset], (aoaEstBFInst->doppBining_handle->numDoppBinSel) * sizeof(cplxf_t));
-                    memOffset += aoaEstBFInst->doppBining_handle->numDoppBinSel; // *2 for complex values
+                    memOffset += 2 * aoaEstBFInst->doppBining_handle->numDoppBinSel;
 
                 } // end of 4 sub-frames
             } // end of nRxAnt
@@ -627,19 +739,22 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
         }
         else
         {
-		/*Calculate covariance matrix and invert */
+		/*Clutter removal, covariance matrix and inversion, in one pass over the range bin */
 #ifdef CAPON2DMODULEDEBUG
         cycleStart = TSCL;
 #endif
 		rnOffset	=	(aoaEstBFInst->raHeatMap_handle->nRxAnt * (1 + aoaEstBFInst->raHeatMap_handle->nRxAnt)) >> 1;
-		RADARDEMO_aoaEst2DCaponBF_covInv(
+		RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv(
 				(uint8_t) (input->fallBackToConvBFFlag ^ 1),
+				(uint8_t) input->clutterRemovalFlag,
 				(float) aoaEstBFInst->raHeatMap_handle->gamma,
 				(int32_t) aoaEstBFInst->raHeatMap_handle->nRxAnt,
+				(int32_t) aoaEstBFInst->nRxAnt,
 				(int32_t) input->nChirps,
 				(int32_t *) &aoaEstBFInst->raHeatMap_handle->scratchPad[0],
 				(uint8_t *) aoaEstBFInst->raHeatMap_handle->virtAntInd2Proc,
-				(cplx16_t *) aoaEstBFInst->tempInputWOstatic,
+				(cplx16_t *) input->inputRangeProcOutSamples,
+                (cplxf_t *)&estOutput->static_information[input->rangeIndx * aoaEstBFInst->nRxAnt],
                 (cplxf_t *)&estOutput->invRnMatrices[input->rangeIndx * rnOffset]);
         }
 
@@ -652,20 +767,32 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
         cycleStart = TSCL;
 #endif
 		if ( aoaEstBFInst->raHeatMap_handle->azimOnly == 0)
-			RADARDEMO_aoaEst2DCaponBF_raHeatmap(
-				(uint8_t) (input->fallBackToConvBFFlag ^ 1),
-				(int32_t) aoaEstBFInst->raHeatMap_handle->nRxAnt,
-				(int32_t) aoaEstBFInst->nRxAnt,
-				(int32_t)  aoaEstBFInst->raHeatMap_handle->azimSearchLen,
-				(int32_t)  aoaEstBFInst->raHeatMap_handle->elevSearchLen,
-				(cplxf_t *) aoaEstBFInst->raHeatMap_handle->steeringVec,
-				NULL,
-				(uint8_t *) aoaEstBFInst->raHeatMap_handle->virtAntInd2Proc,
-				(int32_t *) &aoaEstBFInst->raHeatMap_handle->scratchPad[0],
-				(cplxf_t  *) &estOutput->invRnMatrices[input->rangeIndx * rnOffset],
-				(float *) &estOutput->malValPerRngBin[input->rangeIndx], 
-				(float *) estOutput->rangeAzimuthHeatMap
-			);
+		{
+			if (aoaEstBFInst->raHeatMap_handle->steeringVec == NULL)
+				RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(
+					(uint8_t) (input->fallBackToConvBFFlag ^ 1),
+					aoaEstBFInst->raHeatMap_handle,
+					(int32_t) aoaEstBFInst->nRxAnt,
+					(cplxf_t  *) &estOutput->invRnMatrices[input->rangeIndx * rnOffset],
+					(float *) &estOutput->malValPerRngBin[input->rangeIndx],
+					(float *) estOutput->rangeAzimuthHeatMap
+				);
+			else
+				RADARDEMO_aoaEst2DCaponBF_raHeatmap(
+					(uint8_t) (input->fallBackToConvBFFlag ^ 1),
+					(int32_t) aoaEstBFInst->raHeatMap_handle->nRxAnt,
+					(int32_t) aoaEstBFInst->nRxAnt,
+					(int32_t)  aoaEstBFInst->raHeatMap_handle->azimSearchLen,
+					(int32_t)  aoaEstBFInst->raHeatMap_handle->elevSearchLen,
+					(cplxf_t *) aoaEstBFInst->raHeatMap_handle->steeringVec,
+					NULL,
+					(uint8_t *) aoaEstBFInst->raHeatMap_handle->virtAntInd2Proc,
+					(int32_t *) &aoaEstBFInst->raHeatMap_handle->scratchPad[0],
+					(cplxf_t  *) &estOutput->invRnMatrices[input->rangeIndx * rnOffset],
+					(float *) &estOutput->malValPerRngBin[input->rangeIndx], 
+					(float *) estOutput->rangeAzimuthHeatMap
+				);
+		}
 		else 
 		{
 			RADARDEMO_aoaEst2DCaponBF_raHeatmap(
@@ -693,21 +820,31 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 		
 
 	} // end of if (input->processingStepSelector == 0)
-	else if (input->processingStepSelector == 1) /* estimate 2D angle -- azimuth, elevation and Doppler estimation, called per detected point*/
+	else if (input->processingStepSelector <= 3) /* estimate 2D angle -- azimuth, elevation and Doppler estimation, called per detected point,
+													steps 2 and 3 batch the Doppler estimation of the detections of a range bin*/
 	{
-        uint32_t * RESTRICT bfInput;
+        cplx16_t * sliceSrc;
         float * RESTRICT bfOutput;
-		int32_t angleDetIdx, dopplerOutCnt;
+		int32_t angleDetIdx, dopplerOutCnt, numBeams, passIdx, queueOffset;
 		float * RESTRICT dopplerFFTInput;
 		int32_t scratchOffset;
 		float *  RESTRICT dopplerFFTOutput;
 		float *  RESTRICT dopplerSpectrum;
 		unsigned char *brev = NULL;
 		int32_t rad2D;
-		float max;
 		int32_t index;
-		__float2_t f2temp;
-		float ftemp;
+
+		queueOffset				=	0;
+		if (input->processingStepSelector >= 2)
+		{
+			if ((aoaEstBFInst->aeEstimation_handle->zoomInFlag == 0) || (aoaEstBFInst->useCFAR4DopDet))
+				return (RADARDEMO_AOACAPONBF_ESTMETHOD_NOTSUPPORTED);
+			if ((input->processingStepSelector == 2) && (aoaEstBFInst->dopQueueNumDet > 0)
+				&& ((aoaEstBFInst->dopQueueRangeIndx != input->rangeIndx)
+				|| (aoaEstBFInst->dopQueueNumBeams + aoaEstBFInst->maxNumBeams > aoaEstBFInst->maxNumBeams * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET)))
+				return (RADARDEMO_AOACAPONBF_DOPBATCH_NOTCORRECT);
+			queueOffset			=	aoaEstBFInst->dopQueueNumBeams;
+		}
 
 		if (aoaEstBFInst->aeEstimation_handle->zoomInFlag == 0)
 		{
@@ -775,7 +912,7 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 			estOutput->cyclesLog->raDetCnt++;
 #endif
 		}// end of if (aoaEstBFInst->aeEstimation_handle->zoomInFlag == 0), det method 0 or 1, 2D angle estimation
-		else //zoom in
+		else if (input->processingStepSelector != 3) //zoom in
 		{
 			int32_t		azimuthIndx, elevationIndx, angleIdx, skipEst;
 			float       peakPow, sidePow;
@@ -873,10 +1010,10 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 					aoaEstBFInst->aeEstimation_handle,
 					aoaEstBFInst,
 					&estOutput->invRnMatrices[input->rangeIndx * rnOffset],
-					estOutput->azimEst, 
-					estOutput->elevEst, 
-					estOutput->peakPow, 
-					estOutput->bwFilter
+					&estOutput->azimEst[queueOffset],
+					&estOutput->elevEst[queueOffset],
+					&estOutput->peakPow[queueOffset],
+					&estOutput->bwFilter[queueOffset * aoaEstBFInst->aeEstimation_handle->nRxAnt]
 				);
 			else
 				estOutput->numAngleEst	=	0;
@@ -886,16 +1023,28 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 
 		}//end of if (aoaEstBFInst->aeEstimation_handle->zoomInFlag == 1), det method 2, 3D detection with zoom-in.
 
+		if (input->processingStepSelector == 2)
+		{
+			// Doppler estimation deferred to step 3, together with the other detections of the range bin
+			aoaEstBFInst->dopQueueRangeIndx	=	input->rangeIndx;
+			aoaEstBFInst->dopQueueNumDet++;
+			aoaEstBFInst->dopQueueNumBeams	+=	estOutput->numAngleEst;
+			estOutput->numDopplerIdx	=	0;
+			return (errorCode);
+		}
+		numBeams				=	estOutput->numAngleEst;
+		if (input->processingStepSelector == 3)
+		{
+			numBeams			=	aoaEstBFInst->dopQueueNumBeams;
+			aoaEstBFInst->dopQueueNumDet	=	0;
+			aoaEstBFInst->dopQueueNumBeams	=	0;
+		}
+
 		//Doppler estimation
 		dopplerOutCnt			=	0;
-		//Copy chirps from the last frame from the radar cube
         scratchOffset       =   0;
-        bfInput             =   (uint32_t *) &aoaEstBFInst->scratchPad[scratchOffset];
-        scratchOffset       +=  aoaEstBFInst->nRxAnt * aoaEstBFInst->doppBining_handle->dopplerFFTSize; //complex16
-
         bfOutput            =   (float *) &aoaEstBFInst->scratchPad[scratchOffset];
-        dopplerFFTInput     =   bfOutput;
-        scratchOffset      +=   2 * aoaEstBFInst->doppBining_handle->dopplerFFTSize; //complexf32
+        scratchOffset      +=   2 * aoaEstBFInst->dopNumBeamsPerPass * aoaEstBFInst->doppBining_handle->dopplerFFTSize; //complexf32 per beam
 
         dopplerFFTOutput    =   (float *)&aoaEstBFInst->scratchPad[scratchOffset];
         scratchOffset       +=  2 * aoaEstBFInst->doppBining_handle->dopplerFFTSize; //complexf32
@@ -903,29 +1052,38 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
         dopplerSpectrum     =   (float *)&aoaEstBFInst->scratchPad[scratchOffset];
         scratchOffset       +=  aoaEstBFInst->doppBining_handle->dopplerFFTSize; //float
 
-        // Copy and transpose the chirps from the last frame from the radar cube
-        copyTranspose2((uint32_t *) &input->inputRangeProcOutSamples[input->frameCntr * aoaEstBFInst->nRxAnt * aoaEstBFInst->doppBining_handle->dopplerFFTSize],
-                      (uint32_t *) bfInput,
-                      aoaEstBFInst->nRxAnt, aoaEstBFInst->doppBining_handle->dopplerFFTSize);
+        // Transpose and remove DC from the chirps of the current frame once per range bin, the detections of a
+        // range bin are processed back to back
+        sliceSrc            =   &input->inputRangeProcOutSamples[input->frameCntr * aoaEstBFInst->nRxAnt * aoaEstBFInst->doppBining_handle->dopplerFFTSize];
+        if (sliceSrc != aoaEstBFInst->dopSliceSrc)
+        {
+            RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad(
+                    (int32_t) aoaEstBFInst->nRxAnt,
+                    (int32_t) aoaEstBFInst->doppBining_handle->dopplerFFTSize,
+                    sliceSrc,
+                    (cplxf_t *) &estOutput->static_information[input->rangeIndx * aoaEstBFInst->nRxAnt],
+                    aoaEstBFInst->dopSlice);
+            aoaEstBFInst->dopSliceSrc   =   sliceSrc;
+        }
 
-		for (angleDetIdx = 0; angleDetIdx < estOutput->numAngleEst; angleDetIdx++ )
+		for (angleDetIdx = 0; angleDetIdx < numBeams; angleDetIdx++ )
 		{
 #ifdef CAPON2DMODULEDEBUG
             cycleStart = TSCL;
 #endif
-
-
-
-			//Beam forming only on chirps of the current frame, before beam forming subtract DC
-			RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval(
-					(int32_t) aoaEstBFInst->aeEstimation_handle->nRxAnt,
-					(int32_t) aoaEstBFInst->doppBining_handle->dopplerFFTSize,
-					(cplx16_t *) bfInput,
-					(cplxf_t *) &estOutput->bwFilter[angleDetIdx * aoaEstBFInst->aeEstimation_handle->nRxAnt],
-					(cplxf_t *) &estOutput->static_information[input->rangeIndx * aoaEstBFInst->nRxAnt],
-                    (float *) bfOutput
-				);
-
+            passIdx         =   angleDetIdx % aoaEstBFInst->dopNumBeamsPerPass;
+            if (passIdx == 0)
+            {
+                //Beam forming of the next angle estimates, as many as the scratch holds, only on chirps of the current frame
+                RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch(
+                        (int32_t) aoaEstBFInst->aeEstimation_handle->nRxAnt,
+                        (int32_t) aoaEstBFInst->doppBining_handle->dopplerFFTSize,
+                        (int32_t) ((numBeams - angleDetIdx < aoaEstBFInst->dopNumBeamsPerPass) ? numBeams - angleDetIdx : aoaEstBFInst->dopNumBeamsPerPass),
+                        aoaEstBFInst->dopSlice,
+                        (cplxf_t *) &estOutput->bwFilter[angleDetIdx * aoaEstBFInst->aeEstimation_handle->nRxAnt],
+                        bfOutput);
+            }
+            dopplerFFTInput =   &bfOutput[2 * passIdx * aoaEstBFInst->doppBining_handle->dopplerFFTSize];
 
             //Computes Doppler FFT on chirps of the current frame: pointed by input->frameCntr
             DSPF_sp_fftSPxSP(
@@ -939,20 +1097,11 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
                             aoaEstBFInst->doppBining_handle->dopplerFFTSize);
 
             //Magnitude square
-            max     = 0.f;
-            index   =   0;
-            for (i = 0; i < aoaEstBFInst->doppBining_handle->dopplerFFTSize; i++)
-            {
-                f2temp  =   _amem8_f2(&dopplerFFTOutput[2 * i]);
-                f2temp  =   _dmpysp(f2temp,f2temp);
-                ftemp   =   _hif2(f2temp) + _lof2(f2temp);
-                dopplerSpectrum[i]  =   ftemp;
-                if (ftemp > max)
-                {
-                    max     =   ftemp;
-                    index   =   i;
-                }
-            }
+            RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(
+                    (int32_t) aoaEstBFInst->doppBining_handle->dopplerFFTSize,
+                    dopplerFFTOutput,
+                    dopplerSpectrum,
+                    &index);
 
             //Save Doppler index
 			if(aoaEstBFInst->useCFAR4DopDet == 0)
@@ -973,6 +1122,8 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 				aoaEstBFInst->dopCFARInput->sidelobeThr = 0;
 				aoaEstBFInst->dopCFARInput->enableSecondPass = 0;
 				aoaEstBFInst->dopCFARInput->enable_neighbour_check = 0;
+				aoaEstBFInst->dopCFARInput->rangeStartInd = 0;
+				aoaEstBFInst->dopCFARInput->rangeEndInd = (uint16_t)aoaEstBFInst->dopplerFFTSize;
 
 				RADARDEMO_detectionCFAR_run(
 								aoaEstBFInst->dopCFARHandle,
@@ -1000,7 +1151,7 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_run(IN  void *
 			estOutput->cyclesLog->dopDetCnt++;
 #endif
 		}// end of Doppler estimation
-	}// end of if (input->processingStepSelector == 1) /* estimate 2D angle -- azimuth, elevation and Doppler estimation, called per detected point*/
+	}// end of if (input->processingStepSelector <= 3) /* estimate 2D angle -- azimuth, elevation and Doppler estimation, called per detected point*/
     return (errorCode);
 }
 
@@ -1080,9 +1231,7 @@ RADARDEMO_aoaEst2DCaponBF_errorCode    RADARDEMO_aoaEst2DCaponBF_static_run(
 				accElev		+=	power * (float)i;
 			}
 		}
-		invPow				=	_rcpsp(accPow);
-		invPow				=	invPow * (2.f - accPow * invPow);
-		invPow				=	invPow * (2.f - accPow * invPow);
+		invPow				=	rcpsp_i(accPow);
 
 		azimCoM				=	accAzim * invPow;
 		elevCoM				=	accElev * invPow;
@@ -202,3 +202,330 @@ void        RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval(
         }
     }
 }
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad
+ *
+ *   \brief   Transposes the chirps of the current frame of one range bin to antenna major order, converts them to
+ *            floating point and removes DC. Done once per range bin, the slice is shared by all its detections.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna
+ *
+ *   \param[in]    nChirps
+ *               number of chirps
+ *
+ *   \param[in]    inputSamples
+ *              Input 1D FFT results for the current range bin, in chirp major order, as in the radar cube.
+ *
+ *   \param[in]    dcValues
+ *               Chirp DC values
+ *
+ *   \param[out]    slice
+ *               DC removed samples, nRxAnt x nChirps.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+void        RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad(
+                IN int32_t nRxAnt,
+                IN int32_t nChirps,
+                IN cplx16_t * inputSamples,
+                IN cplxf_t * dcValues,
+                OUT cplxf_t * RESTRICT slice
+            )
+{
+    int32_t chirpIdx, i;
+    int32_t * RESTRICT inPtr;
+    cplxf_t * RESTRICT outPtr;
+    __float2_t     dcVal;
+
+#ifdef _TMS320C6X
+    _nassert(nChirps%8 == 0);
+#endif
+    for (i = 0; i < nRxAnt; i++ )
+    {
+        inPtr           =   (int32_t *) &inputSamples[i];
+        outPtr          =   &slice[i * nChirps];
+        dcVal           =   _amem8_f2(&dcValues[i]);
+        #ifdef _TMS320C6X
+        #pragma UNROLL(2);
+        #endif
+        for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
+        {
+            _amem8_f2(&outPtr[chirpIdx])    =   _dsubsp(_dinthsp(_amem4(&inPtr[chirpIdx * nRxAnt])), dcVal);
+        }
+    }
+}
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice
+ *
+ *   \brief   Calculate the beam forming output for doppler estimation from a slice prepared by
+ *            RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad. Same output as RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna
+ *
+ *   \param[in]    nChirps
+ *               number of chirps
+ *
+ *   \param[in]    slice
+ *              DC removed samples of the current range bin, nRxAnt x nChirps.
+ *              Must be aligned to 8-byte boundary.
+ *
+ *   \param[in]    bweights
+ *               Beam filter coefficients for the detection.
+ *
+ *   \param[out]    bfOutput
+ *               Beamforming output for the current range bin and azimuth bin.
+ *               Must be in the order of real0, imag0, real1, imag1... as required by DSP LIB single precision floating-point FFT.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+void        RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice(
+                IN int32_t nRxAnt,
+                IN int32_t nChirps,
+                IN cplxf_t * slice,
+                IN cplxf_t * bweights,
+                OUT float * RESTRICT bfOutput
+            )
+{
+    int32_t chirpIdx, i;
+    __float2_t f2temp, f2temp1, bw;
+    cplxf_t * RESTRICT inPtr;
+
+#ifdef _TMS320C6X
+    _nassert(nChirps%8 == 0);
+#endif
+    inPtr           =   &slice[0];
+    bw              =   _amem8_f2(&bweights[0]);
+    #ifdef _TMS320C6X
+    #pragma UNROLL(2);
+    #endif
+    for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
+    {
+        f2temp                              =   _complex_conjugate_mpysp(bw, _amem8_f2(&inPtr[chirpIdx]));
+        _amem8_f2(&bfOutput[2*chirpIdx])    =   _ftof2(_lof2(f2temp), _hif2(f2temp));
+    }
+
+    for (i = 1; i < nRxAnt; i++ )
+    {
+        inPtr           =   &slice[i * nChirps];
+        bw              =   _amem8_f2(&bweights[i]);
+        #ifdef _TMS320C6X
+        #pragma UNROLL(2);
+        #endif
+        for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
+        {
+            f2temp                              =   _complex_conjugate_mpysp(bw, _amem8_f2(&inPtr[chirpIdx]));
+            f2temp1                             =   _amem8_f2(&bfOutput[2*chirpIdx]);
+            _amem8_f2(&bfOutput[2*chirpIdx])    =   _daddsp(f2temp1, _ftof2(_lof2(f2temp), _hif2(f2temp)));
+        }
+    }
+}
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch
+ *
+ *   \brief   Calculate the beam forming output for doppler estimation of the angle estimates of one pass, as the
+ *            complex matrix product of the beam filters (numBeams x nRxAnt) by the Doppler slice (nRxAnt x nChirps).
+ *            The beams are processed in blocks of RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK, the beams of a block share each
+ *            load of the slice. Same output as RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice per beam.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna
+ *
+ *   \param[in]    nChirps
+ *               number of chirps
+ *
+ *   \param[in]    numBeams
+ *               number of beams
+ *
+ *   \param[in]    slice
+ *              DC removed samples of the current range bin, nRxAnt x nChirps.
+ *              Must be aligned to 8-byte boundary.
+ *
+ *   \param[in]    bweights
+ *               Beam filter coefficients, numBeams x nRxAnt.
+ *
+ *   \param[out]    bfOutput
+ *               Beamforming output, numBeams x nChirps, each beam in the order of real0, imag0, real1, imag1... as
+ *               required by DSP LIB single precision floating-point FFT.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+void        RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch(
+                IN int32_t nRxAnt,
+                IN int32_t nChirps,
+                IN int32_t numBeams,
+                IN cplxf_t * slice,
+                IN cplxf_t * bweights,
+                OUT float * RESTRICT bfOutput
+            )
+{
+    int32_t chirpIdx, beamIdx, i;
+    __float2_t x, f2temp, bw0, bw1, bw2, bw3;
+    cplxf_t * RESTRICT inPtr;
+    float * RESTRICT out0;
+    float * RESTRICT out1;
+    float * RESTRICT out2;
+    float * RESTRICT out3;
+
+#ifdef _TMS320C6X
+    _nassert(nChirps%8 == 0);
+#endif
+    for (beamIdx = 0; beamIdx + RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK <= numBeams; beamIdx += RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK)
+    {
+        out0            =   &bfOutput[2 * nChirps * beamIdx];
+        out1            =   &out0[2 * nChirps];
+        out2            =   &out1[2 * nChirps];
+        out3            =   &out2[2 * nChirps];
+
+        inPtr           =   &slice[0];
+        bw0             =   _amem8_f2(&bweights[beamIdx * nRxAnt]);
+        bw1             =   _amem8_f2(&bweights[(beamIdx + 1) * nRxAnt]);
+        bw2             =   _amem8_f2(&bweights[(beamIdx + 2) * nRxAnt]);
+        bw3             =   _amem8_f2(&bweights[(beamIdx + 3) * nRxAnt]);
+        for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
+        {
+            x                                   =   _amem8_f2(&inPtr[chirpIdx]);
+            f2temp                              =   _complex_conjugate_mpysp(bw0, x);
+            _amem8_f2(&out0[2*chirpIdx])        =   _ftof2(_lof2(f2temp), _hif2(f2temp));
+            f2temp                              =   _complex_conjugate_mpysp(bw1, x);
+            _amem8_f2(&out1[2*chirpIdx])        =   _ftof2(_lof2(f2temp), _hif2(f2temp));
+            f2temp                              =   _complex_conjugate_mpysp(bw2, x);
+            _amem8_f2(&out2[2*chirpIdx])        =   _ftof2(_lof2(f2temp), _hif2(f2temp));
+            f2temp                              =   _complex_conjugate_mpysp(bw3, x);
+            _amem8_f2(&out3[2*chirpIdx])        =   _ftof2(_lof2(f2temp), _hif2(f2temp));
+        }
+
+        for (i = 1; i < nRxAnt; i++ )
+        {
+            inPtr           =   &slice[i * nChirps];
+            bw0             =   _amem8_f2(&bweights[beamIdx * nRxAnt + i]);
+            bw1             =   _amem8_f2(&bweights[(beamIdx + 1) * nRxAnt + i]);
+            bw2             =   _amem8_f2(&bweights[(beamIdx + 2) * nRxAnt + i]);
+            bw3             =   _amem8_f2(&bweights[(beamIdx + 3) * nRxAnt + i]);
+            for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
+            {
+                x                                   =   _amem8_f2(&inPtr[chirpIdx]);
+                f2temp                              =   _complex_conjugate_mpysp(bw0, x);
+                _amem8_f2(&out0[2*chirpIdx])        =   _daddsp(_amem8_f2(&out0[2*chirpIdx]), _ftof2(_lof2(f2temp), _hif2(f2temp)));
+                f2temp                              =   _complex_conjugate_mpysp(bw1, x);
+                _amem8_f2(&out1[2*chirpIdx])        =   _daddsp(_amem8_f2(&out1[2*chirpIdx]), _ftof2(_lof2(f2temp), _hif2(f2temp)));
+                f2temp                              =   _complex_conjugate_mpysp(bw2, x);
+                _amem8_f2(&out2[2*chirpIdx])        =   _daddsp(_amem8_f2(&out2[2*chirpIdx]), _ftof2(_lof2(f2temp), _hif2(f2temp)));
+                f2temp                              =   _complex_conjugate_mpysp(bw3, x);
+                _amem8_f2(&out3[2*chirpIdx])        =   _daddsp(_amem8_f2(&out3[2*chirpIdx]), _ftof2(_lof2(f2temp), _hif2(f2temp)));
+            }
+        }
+    }
+
+    // remaining beams, one at a time
+    for (; beamIdx < numBeams; beamIdx++)
+    {
+        RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice(
+                nRxAnt,
+                nChirps,
+                slice,
+                &bweights[beamIdx * nRxAnt],
+                &bfOutput[2 * nChirps * beamIdx]);
+    }
+}
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopplerPowMax
+ *
+ *   \brief   Power spectrum of the Doppler FFT output and its maximum, two bins per iteration.
+ *
+ *   \param[in]    fftSize
+ *               Doppler FFT size, even.
+ *
+ *   \param[in]    fftOutput
+ *               Doppler FFT output, in the order of real0, imag0, real1, imag1...
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \param[out]    spectrum
+ *               Power spectrum.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \param[out]    maxIdx
+ *               Index of the first maximum of the spectrum, 0 if the spectrum is all 0.
+ *
+ *   \ret       maximum of the spectrum.
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+float       RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(
+                IN int32_t fftSize,
+                IN float * fftOutput,
+                OUT float * RESTRICT spectrum,
+                OUT int32_t * maxIdx
+            )
+{
+    int32_t i, idxEven, idxOdd;
+    float maxEven, maxOdd, powEven, powOdd;
+    __float2_t f2even, f2odd, f2pow;
+
+#ifdef _TMS320C6X
+    _nassert(fftSize%2 == 0);
+#endif
+    maxEven     =   0.f;
+    maxOdd      =   0.f;
+    idxEven     =   0;
+    idxOdd      =   1;
+    for (i = 0; i < fftSize; i += 2)
+    {
+        f2even  =   _amem8_f2(&fftOutput[2 * i]);
+        f2even  =   _dmpysp(f2even, f2even);
+        f2odd   =   _amem8_f2(&fftOutput[2 * i + 2]);
+        f2odd   =   _dmpysp(f2odd, f2odd);
+        f2pow   =   _daddsp(_ftof2(_hif2(f2odd), _hif2(f2even)), _ftof2(_lof2(f2odd), _lof2(f2even)));
+        _amem8_f2(&spectrum[i]) =   f2pow;
+        powEven =   _lof2(f2pow);
+        powOdd  =   _hif2(f2pow);
+        if (powEven > maxEven)
+        {
+            maxEven =   powEven;
+            idxEven =   i;
+        }
+        if (powOdd > maxOdd)
+        {
+            maxOdd  =   powOdd;
+            idxOdd  =   i + 1;
+        }
+    }
+
+    if ((maxOdd > maxEven) || ((maxOdd == maxEven) && (idxOdd < idxEven)))
+    {
+        *maxIdx =   idxOdd;
+        return (maxOdd);
+    }
+    *maxIdx     =   idxEven;
+    return (maxEven);
+}
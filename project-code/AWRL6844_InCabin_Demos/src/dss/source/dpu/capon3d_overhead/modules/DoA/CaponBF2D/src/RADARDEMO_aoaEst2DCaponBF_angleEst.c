@@ -102,7 +102,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevOnly(
 				OUT float    * RESTRICT azimElevHeatMap
 			)
 {
-	int32_t		i, j, k, rnIdx, elevIdx, rnIdx1, scratchOffset, nRxAnt, numElevationBins, maxElevInd, numAngleOut, elevIdxLeft, elevIdxRight;
+	int32_t		i, j, rnIdx, elevIdx, scratchOffset, nRxAnt, numElevationBins, maxElevInd, numAngleOut, elevIdxLeft, elevIdxRight;
 	__float2_t	* RESTRICT steeringVecAzimInit;
 	__float2_t	* RESTRICT steeringVecElevInit;
 	__float2_t	* RESTRICT steeringVecInit;
@@ -828,9 +828,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevOnly(
 
                 output                  =   2.f * output1;
 
-                result                  =   _rcpsp(output);
-                result                  =   result * (2.f - output * result);
-                result                  =   result * (2.f - output * result);
+                result                  =   rcpsp_i(output);
 
                 if (!bfFlag)
                   result              =   output;
@@ -861,22 +859,8 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevOnly(
 			{
 				_amem8_f2(&steeringVecInit[i])		=	_complex_mpysp(_amem8_f2(steeringVecElevInit++), _amem8_f2(&steeringVecAzimInit[i]));	
 			}
-            rnIdx                           =   0;
-            output                          =   0.f;
-            for (i = 0; i < nRxAnt; i++)
-            {
-                output                      +=  _hif2(_amem8_f2(&invRnMatrices[rnIdx++]));
-                for (j = i + 1; j < nRxAnt; j++)
-                {
-                    f2temp                  =   _amem8_f2(&invRnMatrices[rnIdx++]);
-                    acc0f2                  =   _complex_conjugate_mpysp(_amem8_f2(&steeringVecInit[i]), f2temp);
-                    acc0f2                  =   _complex_mpysp(_amem8_f2(&steeringVecInit[j]), acc0f2);
-                    output                  +=  2.f * _hif2(acc0f2);
-                }
-            }
-            result                  =   _rcpsp(output);
-            result                  =   result * (2.f - output * result);
-            result                  =   result * (2.f - output * result);
+            output                          =   hermquadsp_i((__float2_t *) invRnMatrices, steeringVecInit, nRxAnt);
+            result                  =   rcpsp_i(output);
 
             if (!bfFlag)
                 result              =   output;
@@ -897,26 +881,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevOnly(
 		_amem8_f2(&steeringVecInit[i])		=	_complex_mpysp(_amem8_f2(&capon_handle->raHeatMap_handle->steeringVecElev[maxElevInd * nRxAnt + i]), _amem8_f2(&steeringVecAzimInit[i]));	
 	}
 	beamFilterPtr							=	(__float2_t *) beamFilter;
-    rnIdx								=   0;
-    for (i = 0; i < nRxAnt; i++)
-    {
-        rnIdx1							=	i;
-        acc0f2							=	_complex_mpysp(_amem8_f2(&steeringVecInit[i]), _amem8_f2(&invRnMatrices[rnIdx++]));
-        k								=	nRxAnt - 1;
-        for (j = 0; j < i; j++)
-        {
-            acc0f2						=	_daddsp(acc0f2, _complex_conjugate_mpysp(_amem8_f2(&invRnMatrices[rnIdx1]), _amem8_f2(&steeringVecInit[j])));
-            rnIdx1						=	rnIdx1 + k;
-            k--;
-        }
-
-        for (j = i + 1; j < nRxAnt; j++)
-        {
-            acc0f2						=	_daddsp(acc0f2, _complex_mpysp(_amem8_f2(&steeringVecInit[j]), _amem8_f2(&invRnMatrices[rnIdx++])));
-        }
-
-        _amem8_f2(beamFilterPtr++)		=	acc0f2;
-    }
+    hermmatvecsp_i((__float2_t *) invRnMatrices, steeringVecInit, beamFilterPtr, nRxAnt);
 	numAngleOut							=	1;
 
 	elevIdxLeft							=	maxElevInd - 1;
@@ -1004,20 +969,16 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevAzim(
 				OUT float    * RESTRICT azimElevHeatMap
 			)
 {
-	int32_t		i, j, elevIdx, azimIdx, rnIdx, scratchOffset, nRxAnt, numAzimuthBins, numElevationBins, maxElevInd, maxAzimInd, numAngleOut;
+	int32_t		i, elevIdx, azimIdx, scratchOffset, nRxAnt, numAzimuthBins, numElevationBins, maxElevInd, maxAzimInd, numAngleOut;
 	__float2_t	* RESTRICT steeringVecAzimInit;
 	__float2_t	* RESTRICT steeringVecElevInit;
 	__float2_t	* RESTRICT steeringVec;
 	__float2_t	* RESTRICT beamFilterPtr;
 	//__float2_t	* RESTRICT invRnMatPtr;
-	__float2_t	* RESTRICT RnInv;
 	float		* RESTRICT heatMapPtr;
-	__float2_t  f2temp, acc0f2, acc1f2;
 	float		output, result, maxVal, tempAzim, asinArg;
 
 	scratchOffset	=	0;
-	RnInv			=	(__float2_t *) &capon_handle->aeEstimation_handle->scratchPad[scratchOffset];
-	scratchOffset	=	scratchOffset + 2 * capon_handle->aeEstimation_handle->nRxAnt * capon_handle->aeEstimation_handle->nRxAnt;  /*Store the full RnInv matrix*/
 	steeringVec		=	(__float2_t *) &capon_handle->aeEstimation_handle->scratchPad[scratchOffset];
 	scratchOffset	=	scratchOffset + 2 * capon_handle->aeEstimation_handle->nRxAnt;
 
@@ -1025,60 +986,66 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevAzim(
 	numAzimuthBins		=	capon_handle->raHeatMap_handle->azimSearchLen;
 	numElevationBins	=	capon_handle->raHeatMap_handle->elevSearchLen;
 
-	rnIdx		=	0;
-	for (i = 0; i < nRxAnt; i++)
-	{
-		_amem8_f2(&RnInv[i * nRxAnt + i])		=	_amem8_f2(&invRnMatrices[rnIdx++]);
-		for (j = 0; j < i; j++)
-		{
-			f2temp								=	_amem8_f2(&invRnMatrices[rnIdx++]);
-			_amem8_f2(&RnInv[i * nRxAnt + j])	=	f2temp;
-			_amem8_f2(&RnInv[j * nRxAnt + i])	=	_ftof2(_hif2(f2temp), -_lof2(f2temp));
-		}
-	}
-
 	maxVal										=	0.f;
 	maxElevInd									=	0;
 	maxAzimInd									=	0;
 	heatMapPtr									=	azimElevHeatMap;
 
 
-	for (elevIdx = 0; elevIdx < numElevationBins; elevIdx++ )
+	if (capon_handle->aeEstimation_handle->coarseSearchStep > 1)
 	{
-		steeringVecAzimInit							=	(__float2_t *) capon_handle->raHeatMap_handle->steeringVecAzim;
-		steeringVecElevInit							=	(__float2_t *) &capon_handle->raHeatMap_handle->steeringVecElev[numElevationBins * nRxAnt];
-
-		for (azimIdx = 0; azimIdx < numAzimuthBins; azimIdx++ )
+		RADARDEMO_aoaEst2D_aeSearch	search;
+
+		search.bfFlag		=	bfFlag;
+		search.nRxAnt		=	nRxAnt;
+		search.invRn		=	invRnMatrices;
+		search.azimTab		=	capon_handle->raHeatMap_handle->steeringVecAzim;
+		search.elevTab		=	capon_handle->raHeatMap_handle->steeringVecElev;
+		search.azimLen		=	numAzimuthBins;
+		search.elevLen		=	numElevationBins;
+		search.azimStride	=	1;
+		search.elevStride	=	numAzimuthBins;
+		search.heatMap		=	azimElevHeatMap;
+		search.steeringVec	=	(cplxf_t *) steeringVec;
+		search.cache		=	NULL;
+		search.azimOffset	=	0;
+		search.elevOffset	=	0;
+
+		maxVal				=	RADARDEMO_aoaEst2DCaponBF_aeHierSearch(&search, capon_handle->aeEstimation_handle->coarseSearchStep, &maxAzimInd, &maxElevInd);
+
+		// points not evaluated
+		for (i = 0; i < numAzimuthBins * numElevationBins; i++ )
 		{
-			for (i = 0; i < nRxAnt; i++ )
+			if (heatMapPtr[i] < 0.f)
+				heatMapPtr[i]	=	0.f;
+		}
+	}
+	else
+	{
+		for (elevIdx = 0; elevIdx < numElevationBins; elevIdx++ )
+		{
+			steeringVecAzimInit							=	(__float2_t *) capon_handle->raHeatMap_handle->steeringVecAzim;
+			steeringVecElevInit							=	(__float2_t *) &capon_handle->raHeatMap_handle->steeringVecElev[elevIdx * nRxAnt];
+
+			for (azimIdx = 0; azimIdx < numAzimuthBins; azimIdx++ )
 			{
-				_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecElevInit[i]), _amem8_f2(steeringVecAzimInit++));	
-			}
+				for (i = 0; i < nRxAnt; i++ )
+				{
+					_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecElevInit[i]), _amem8_f2(steeringVecAzimInit++));	
+				}
 			
-			acc1f2								=	_ftof2(0.f, 0.f);
-			for (i = 0; i < nRxAnt; i++)
-			{
-				acc0f2								=	_ftof2(0.f, 0.f);
+				output					=	hermquadsp_i((__float2_t *) invRnMatrices, steeringVec, nRxAnt);
+				result					=	rcpsp_i(output);
 
-				for (j = 0; j < nRxAnt; j++)
+				if (!bfFlag)	
+					result				=	output;
+				*heatMapPtr++			=	result;
+				if (maxVal < result)
 				{
-					acc0f2							=	_daddsp(acc0f2, _complex_conjugate_mpysp(_amem8_f2(&steeringVec[j]), _amem8_f2(&invRnMatrices[i * nRxAnt + j])));
+					maxVal				=	result;
+					maxElevInd			=	elevIdx;
+					maxAzimInd			=	azimIdx;
 				}
-				acc1f2								=	_daddsp(acc1f2, _complex_conjugate_mpysp(acc0f2, _amem8_f2(&steeringVec[j])));
-			}
-			output					=	_hif2(acc1f2);
-			result					=	_rcpsp(output);
-			result					=	result * (2.f - output * result);
-			result					=	result * (2.f - output * result);
-
-			if (!bfFlag)	
-				result				=	_hif2(acc1f2);
-			*heatMapPtr++			=	result;
-			if (maxVal < result)
-			{
-				maxVal				=	result;
-				maxElevInd			=	elevIdx;
-				maxAzimInd			=	azimIdx;
 			}
 		}
 	}
@@ -1091,16 +1058,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstElevAzim(
 		_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&capon_handle->raHeatMap_handle->steeringVecAzim[maxAzimInd * nRxAnt + i]), _amem8_f2(&capon_handle->raHeatMap_handle->steeringVecElev[maxElevInd * nRxAnt + i]));	
 	}
 	beamFilterPtr							=	(__float2_t *) beamFilter;
-	for (i = 0; i < nRxAnt; i++)
-	{
-		acc0f2								=	_ftof2(0.f, 0.f);
-
-		for (j = 0; j < nRxAnt; j++)
-		{
-			acc0f2							=	_daddsp(acc0f2, _complex_conjugate_mpysp(_amem8_f2(&steeringVec[j]), _amem8_f2(&invRnMatrices[i * nRxAnt + j])));
-		}
-		_amem8_f2(beamFilterPtr++)			=	acc0f2;
-	}
+	hermmatvecsp_i((__float2_t *) invRnMatrices, steeringVec, beamFilterPtr, nRxAnt);
 	asinArg                                     =   capon_handle->raHeatMap_handle->muInit + capon_handle->raHeatMap_handle->muStep * maxElevInd;
 	if (_fabs(asinArg) < 1.f)
 	{
@@ -1186,7 +1144,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
 				OUT cplxf_t  * RESTRICT beamFilter
 			)
 {
-	int32_t		i, j, k, elevIdx, azimIdx, rnIdx, rnIdx1, scratchOffset, nRxAnt, numAzimuthBins, numElevationBins, maxElevInd, maxAzimInd, numAngleOut;
+	int32_t		i, elevIdx, azimIdx, scratchOffset, nRxAnt, numAzimuthBins, numElevationBins, maxElevInd, maxAzimInd, numAngleOut;
 	__float2_t	* RESTRICT steeringVecAzimInit;
 	__float2_t	* RESTRICT steeringVecAzimStep;
 	__float2_t	* RESTRICT steeringVecElevInit;
@@ -1198,7 +1156,6 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
 	float		* RESTRICT azimElevHeatMap;
 	//__float2_t	* RESTRICT RnInv;
 	float		* RESTRICT heatMapPtr;
-	__float2_t  f2temp, acc0f2;
 	float		output, result, maxVal, minVal, tempAzim, tempElev, sharpness, asinArg;
 
 	numAngleOut		=	0;
@@ -1211,7 +1168,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
 	steeringVecCopy =	(__float2_t *) &aeEstimation_handle->scratchPad[scratchOffset];
 	scratchOffset	=	scratchOffset + 2 * aeEstimation_handle->nRxAnt;
 	azimElevHeatMap	=	(float *)&aeEstimation_handle->scratchPad[scratchOffset];
-	scratchOffset	=	scratchOffset + aeEstimation_handle->azimSearchLen * aeEstimation_handle->elevSearchLen;
+	scratchOffset	=	scratchOffset + ((aeEstimation_handle->azimSearchLen * aeEstimation_handle->elevSearchLen + 1) & ~1);
 
 	nRxAnt				=	aeEstimation_handle->nRxAnt;
 	numAzimuthBins		=	aeEstimation_handle->azimSearchLen;
@@ -1227,64 +1184,118 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
 	steeringVecElevInit							=	(__float2_t *) aeEstimation_handle->steeringVecElevInit;
 	steeringVecElevStep							=	(__float2_t *) aeEstimation_handle->steeringVecElevStep;
 
-	// prepare steering vector starting values for the azimuthIdx(th) azimuth bin
-	for (i = 0; i < nRxAnt; i++ )
+	if (aeEstimation_handle->coarseSearchStep > 1)
 	{
-		_amem8_f2(&steeringVecInit[i])		    =	_complex_mpysp(_amem8_f2(&steeringVecAzimInit[i]), _amem8_f2(&capon_handle->raHeatMap_handle->steeringVec[(elevationIdx * capon_handle->raHeatMap_handle->azimSearchLen + azimuthIdx) * nRxAnt + i]));
-	}
+		RADARDEMO_aoaEst2D_aeSearch	search;
+		__float2_t	* RESTRICT steeringVecAzimTab;
+		__float2_t	* RESTRICT steeringVecElevTab;
+
+		steeringVecAzimTab	=	(__float2_t *)&aeEstimation_handle->scratchPad[scratchOffset];
+		steeringVecElevTab	=	(__float2_t *) aeEstimation_handle->steeringVecElevTab;
+
+		// azimuth steering vectors of the zoom-in grid around the azimuthIdx(th) azimuth bin
+		RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(capon_handle->raHeatMap_handle, nRxAnt, azimuthIdx, elevationIdx, (cplxf_t *)steeringVecAzimInit, (cplxf_t *)steeringVecAzimTab);
+		for (azimIdx = 1; azimIdx < numAzimuthBins; azimIdx++ )
+		{
+			for (i = 0; i < nRxAnt; i++ )
+			{
+				_amem8_f2(&steeringVecAzimTab[azimIdx * nRxAnt + i])	=	_complex_mpysp(_amem8_f2(&steeringVecAzimStep[i]), _amem8_f2(&steeringVecAzimTab[(azimIdx - 1) * nRxAnt + i]));
+			}
+		}
+
+		// values computed by the previous detections of the range bin are reused
+		if ((aeEstimation_handle->zoominCacheInvRn != invRnMatrices) || (aeEstimation_handle->zoominCacheBfFlag != bfFlag))
+		{
+			for (i = 0; i < RADARDEMO_AOAEST2D_AECACHE_SIZE; i++ )
+			{
+				aeEstimation_handle->zoominCache[i].azimIdx	=	RADARDEMO_AOAEST2D_AECACHE_INVALID;
+			}
+			aeEstimation_handle->zoominCacheInvRn		=	invRnMatrices;
+			aeEstimation_handle->zoominCacheBfFlag		=	bfFlag;
+		}
+
+		search.bfFlag		=	bfFlag;
+		search.nRxAnt		=	nRxAnt;
+		search.invRn		=	invRnMatrices;
+		search.azimTab		=	(cplxf_t *) steeringVecAzimTab;
+		search.elevTab		=	(cplxf_t *) steeringVecElevTab;
+		search.azimLen		=	numAzimuthBins;
+		search.elevLen		=	numElevationBins;
+		search.azimStride	=	numElevationBins;
+		search.elevStride	=	1;
+		search.heatMap		=	azimElevHeatMap;
+		search.steeringVec	=	(cplxf_t *) steeringVec;
+		search.cache		=	aeEstimation_handle->zoominCache;
+		search.azimOffset	=	(int32_t)azimuthIdx * aeEstimation_handle->zoominFactor - aeEstimation_handle->zoominFactor;
+		search.elevOffset	=	(int32_t)elevationIdx * aeEstimation_handle->zoominFactor - aeEstimation_handle->zoominFactor;
+
+		maxVal				=	RADARDEMO_aoaEst2DCaponBF_aeHierSearch(&search, aeEstimation_handle->coarseSearchStep, &maxAzimInd, &maxElevInd);
 
-	for (azimIdx = 0; azimIdx < numAzimuthBins; azimIdx++ )
-	{
 		for (i = 0; i < nRxAnt; i++ )
 		{
-			_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecElevInit[i]), _amem8_f2(&steeringVecInit[i]));	
+			_amem8_f2(&steeringVecCopy[i])	=	_complex_mpysp(_amem8_f2(&steeringVecAzimTab[maxAzimInd * nRxAnt + i]), _amem8_f2(&steeringVecElevTab[maxElevInd * nRxAnt + i]));
 		}
-		for (elevIdx = 0; elevIdx < numElevationBins; elevIdx++ )
+
+		// the peak expansion reads the heatmap around the peak
+		if ( ( aeEstimation_handle->peakExpSamples > 0 ) && ( maxVal * _rcpsp(noise) > aeEstimation_handle->peakExpSNRThr) )
 		{
-			rnIdx				=	0;
-			output				=	0.f;
-			for (i = 0; i < nRxAnt; i++)
+			for (azimIdx = maxAzimInd - aeEstimation_handle->peakExpSamples; azimIdx <= maxAzimInd + aeEstimation_handle->peakExpSamples; azimIdx++ )
 			{
-				output			+=	_hif2(_amem8_f2(&invRnMatrices[rnIdx++]));
-				for (j = i + 1; j < nRxAnt; j++)
+				if ((azimIdx < 0) || (azimIdx >= numAzimuthBins))
+					continue;
+				for (elevIdx = maxElevInd - aeEstimation_handle->peakExpSamples; elevIdx <= maxElevInd + aeEstimation_handle->peakExpSamples; elevIdx++ )
 				{
-					f2temp		=	_amem8_f2(&invRnMatrices[rnIdx++]);
-					acc0f2		=	_complex_conjugate_mpysp(_amem8_f2(&steeringVec[i]), f2temp);
-					acc0f2		=	_complex_mpysp(_amem8_f2(&steeringVec[j]), acc0f2);
-					output		+=	2.f * _hif2(acc0f2);
+					if ((elevIdx < 0) || (elevIdx >= numElevationBins))
+						continue;
+					RADARDEMO_aoaEst2DCaponBF_aeHierEval(&search, azimIdx, elevIdx);
 				}
 			}
-			result				=	_rcpsp(output);
-			result				=	result * (2.f - output * result);
-			result				=	result * (2.f - output * result);
-
-			if (!bfFlag)	
-				result			=	output;
-			*heatMapPtr++		=	result;
-			if (minVal > result)
-				minVal			=	result;	
-			if (maxVal < result)
+		}
+		minVal				=	search.minVal;
+	}
+	else
+	{
+		// prepare steering vector starting values for the azimuthIdx(th) azimuth bin
+		RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(capon_handle->raHeatMap_handle, nRxAnt, azimuthIdx, elevationIdx, (cplxf_t *)steeringVecAzimInit, (cplxf_t *)steeringVecInit);
+
+		for (azimIdx = 0; azimIdx < numAzimuthBins; azimIdx++ )
+		{
+			for (i = 0; i < nRxAnt; i++ )
+			{
+				_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecElevInit[i]), _amem8_f2(&steeringVecInit[i]));	
+			}
+			for (elevIdx = 0; elevIdx < numElevationBins; elevIdx++ )
 			{
-				maxVal			=	result;
-				maxElevInd		=	elevIdx;
-				maxAzimInd		=	azimIdx;
+				output				=	hermquadsp_i((__float2_t *) invRnMatrices, steeringVec, nRxAnt);
+				result				=	rcpsp_i(output);
+
+				if (!bfFlag)	
+					result			=	output;
+				*heatMapPtr++		=	result;
+				if (minVal > result)
+					minVal			=	result;	
+				if (maxVal < result)
+				{
+					maxVal			=	result;
+					maxElevInd		=	elevIdx;
+					maxAzimInd		=	azimIdx;
+					for (i = 0; i < nRxAnt; i++ )
+					{
+						_amem8_f2(&steeringVecCopy[i])	=	_amem8_f2(&steeringVec[i]);	
+					}
+				}
 				for (i = 0; i < nRxAnt; i++ )
 				{
-					_amem8_f2(&steeringVecCopy[i])	=	_amem8_f2(&steeringVec[i]);	
+					_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecElevStep[i]), _amem8_f2(&steeringVec[i]));	
 				}
 			}
 			for (i = 0; i < nRxAnt; i++ )
 			{
-				_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecElevStep[i]), _amem8_f2(&steeringVec[i]));	
+				_amem8_f2(&steeringVecInit[i])	=	_complex_mpysp(_amem8_f2(&steeringVecAzimStep[i]), _amem8_f2(&steeringVecInit[i]));	
 			}
 		}
-		for (i = 0; i < nRxAnt; i++ )
-		{
-			_amem8_f2(&steeringVecInit[i])	=	_complex_mpysp(_amem8_f2(&steeringVecAzimStep[i]), _amem8_f2(&steeringVecInit[i]));	
-		}
 	}
 
-
 	//peak expansion, only when the peak SNR exceeding threshold 
 	if ( ( aeEstimation_handle->peakExpSamples > 0 ) && ( maxVal * _rcpsp(noise) > aeEstimation_handle->peakExpSNRThr) )
 	{
@@ -1350,26 +1361,8 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
                             azimEst[numAngleOut]			=	(float)asinsp_i(tempAzim);
                             peakPow[numAngleOut]			=	result;
 
-                            rnIdx								=   0;
-                            for (i = 0; i < nRxAnt; i++)
-                            {
-                                rnIdx1						=	i;
-                                acc0f2						=	_complex_mpysp(_amem8_f2(&steeringVec[i]), _amem8_f2(&invRnMatrices[rnIdx++]));
-                                k							=	nRxAnt - 1;
-                                for (j = 0; j < i; j++)
-                                {
-                                    acc0f2					=	_daddsp(acc0f2, _complex_conjugate_mpysp(_amem8_f2(&invRnMatrices[rnIdx1]), _amem8_f2(&steeringVec[j])));
-                                    rnIdx1					=	rnIdx1 + k;
-                                    k--;
-                                }
-
-                                for (j = i + 1; j < nRxAnt; j++)
-                                {
-                                    acc0f2					=	_daddsp(acc0f2, _complex_mpysp(_amem8_f2(&steeringVec[j]), _amem8_f2(&invRnMatrices[rnIdx++])));
-                                }
-
-                                _amem8_f2(beamFilterPtr++)	=	acc0f2;
-                            }
+                            hermmatvecsp_i((__float2_t *) invRnMatrices, steeringVec, beamFilterPtr, nRxAnt);
+                            beamFilterPtr                   +=  nRxAnt;
                             numAngleOut						+=	1;
                         }
 				    }
@@ -1406,26 +1399,7 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
                 azimEst[numAngleOut]			=	(float)asinsp_i(tempAzim);
                 peakPow[numAngleOut]			=	maxVal;
 
-                rnIdx								=   0;
-                for (i = 0; i < nRxAnt; i++)
-                {
-                    rnIdx1							=	i;
-                    acc0f2							=	_complex_mpysp(_amem8_f2(&steeringVecCopy[i]), _amem8_f2(&invRnMatrices[rnIdx++]));
-                    k								=	nRxAnt - 1;
-                    for (j = 0; j < i; j++)
-                    {
-                        acc0f2						=	_daddsp(acc0f2, _complex_conjugate_mpysp(_amem8_f2(&invRnMatrices[rnIdx1]), _amem8_f2(&steeringVecCopy[j])));
-                        rnIdx1						=	rnIdx1 + k;
-                        k--;
-                    }
-
-                    for (j = i + 1; j < nRxAnt; j++)
-                    {
-                        acc0f2						=	_daddsp(acc0f2, _complex_mpysp(_amem8_f2(&steeringVecCopy[j]), _amem8_f2(&invRnMatrices[rnIdx++])));
-                    }
-
-                    _amem8_f2(beamFilterPtr++)		=	acc0f2;
-                }
+                hermmatvecsp_i((__float2_t *) invRnMatrices, steeringVecCopy, beamFilterPtr, nRxAnt);
                 numAngleOut						+=	1;
             }
 		}
@@ -1434,3 +1408,360 @@ int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
 	return (numAngleOut);
 }
 
+/* next point of the coarse grid: multiple of coarseStep in the cache indices, or last point of the dimension */
+static int32_t aeHierNextCoarse(int32_t idx, int32_t len, int32_t coarseStep, int32_t offset)
+{
+	idx				=	idx + coarseStep - ((((idx + offset) % coarseStep) + coarseStep) % coarseStep);
+	if (idx > len - 1)
+		idx			=	len - 1;
+	return (idx);
+}
+
+/* previous point of the coarse grid: multiple of coarseStep in the cache indices, or first point of the dimension */
+static int32_t aeHierPrevCoarse(int32_t idx, int32_t coarseStep, int32_t offset)
+{
+	idx				=	idx - 1;
+	idx				=	idx - ((((idx + offset) % coarseStep) + coarseStep) % coarseStep);
+	if (idx < 0)
+		idx			=	0;
+	return (idx);
+}
+
+/* 1 if coarse point (azimIdx, elevIdx) is not below its 8 coarse neighbors */
+static int32_t aeHierCoarseLocalMax(RADARDEMO_aoaEst2D_aeSearch * search, int32_t coarseStep, int32_t azimIdx,
+				int32_t elevIdx, float value)
+{
+	int32_t		azim[3], elev[3], i, j, numAzim, numElev;
+
+	numAzim			=	0;
+	if (azimIdx > 0)
+		azim[numAzim++]	=	aeHierPrevCoarse(azimIdx, coarseStep, search->azimOffset);
+	if (azimIdx < search->azimLen - 1)
+		azim[numAzim++]	=	aeHierNextCoarse(azimIdx, search->azimLen, coarseStep, search->azimOffset);
+	azim[numAzim++]	=	azimIdx;
+	numElev			=	0;
+	if (elevIdx > 0)
+		elev[numElev++]	=	aeHierPrevCoarse(elevIdx, coarseStep, search->elevOffset);
+	if (elevIdx < search->elevLen - 1)
+		elev[numElev++]	=	aeHierNextCoarse(elevIdx, search->elevLen, coarseStep, search->elevOffset);
+	elev[numElev++]	=	elevIdx;
+
+	for (i = 0; i < numAzim; i++ )
+	{
+		for (j = 0; j < numElev; j++ )
+		{
+			if (RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, azim[i], elev[j]) > value)
+				return (0);
+		}
+	}
+	return (1);
+}
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_aeHierEval
+ *
+ *   \brief   Returns the spectrum value of one grid point of a hierarchical angle search. The value is read from the
+ *            heatmap or the cache if the point has already been evaluated, computed and stored otherwise.
+ *
+ *   \param[in]    search
+ *               Search grid description.
+ *
+ *   \param[in]    azimIdx
+ *               Azimuth index of the grid point.
+ *
+ *   \param[in]    elevIdx
+ *               Elevation index of the grid point.
+ *
+ *   \ret       Spectrum value.
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+float RADARDEMO_aoaEst2DCaponBF_aeHierEval(
+				IN RADARDEMO_aoaEst2D_aeSearch * search,
+				IN int32_t azimIdx,
+				IN int32_t elevIdx)
+{
+	int32_t		i, nRxAnt, cacheAzim, cacheElev;
+	__float2_t	* RESTRICT steeringVec;
+	__float2_t	* RESTRICT steeringVecAzim;
+	__float2_t	* RESTRICT steeringVecElev;
+	__float2_t	* RESTRICT invRnMatrices;
+	RADARDEMO_aoaEst2D_aeCacheEntry * entry;
+	float		* heatMapPtr;
+	float		output, result;
+
+	heatMapPtr		=	&search->heatMap[azimIdx * search->azimStride + elevIdx * search->elevStride];
+	if (*heatMapPtr >= 0.f)
+		return (*heatMapPtr);
+
+	entry			=	NULL;
+	if (search->cache != NULL)
+	{
+		cacheAzim	=	azimIdx + search->azimOffset;
+		cacheElev	=	elevIdx + search->elevOffset;
+		entry		=	&search->cache[((uint32_t)(cacheAzim * 17 + cacheElev)) & (RADARDEMO_AOAEST2D_AECACHE_SIZE - 1)];
+		if ((entry->azimIdx == cacheAzim) && (entry->elevIdx == cacheElev))
+		{
+			result	=	entry->value;
+			*heatMapPtr	=	result;
+			if (search->minVal > result)
+				search->minVal	=	result;
+			return (result);
+		}
+	}
+
+	nRxAnt			=	search->nRxAnt;
+	steeringVec		=	(__float2_t *) search->steeringVec;
+	steeringVecAzim	=	(__float2_t *) &search->azimTab[azimIdx * nRxAnt];
+	steeringVecElev	=	(__float2_t *) &search->elevTab[elevIdx * nRxAnt];
+	invRnMatrices	=	(__float2_t *) search->invRn;
+
+	for (i = 0; i < nRxAnt; i++ )
+	{
+		_amem8_f2(&steeringVec[i])	=	_complex_mpysp(_amem8_f2(&steeringVecAzim[i]), _amem8_f2(&steeringVecElev[i]));
+	}
+
+	output				=	hermquadsp_i(invRnMatrices, steeringVec, nRxAnt);
+	result				=	rcpsp_i(output);
+
+	if (!search->bfFlag)
+		result			=	output;
+
+	*heatMapPtr			=	result;
+	if (search->minVal > result)
+		search->minVal	=	result;
+	if (entry != NULL)
+	{
+		entry->azimIdx	=	(int16_t) cacheAzim;
+		entry->elevIdx	=	(int16_t) cacheElev;
+		entry->value	=	result;
+	}
+	return (result);
+}
+
+/* parabolic prediction of the peak between the coarse neighbors of (bestAzim, bestElev), then hill climb on the grid
+ * to the local max of the 8 neighbors */
+static float aeHierRefine(RADARDEMO_aoaEst2D_aeSearch * search, int32_t coarseStep, int32_t bestAzim, int32_t bestElev,
+				float maxVal, int32_t * maxAzimInd, int32_t * maxElevInd)
+{
+	int32_t		azimIdx, elevIdx, azimLen, elevLen, curAzim, curElev, left, right, moved;
+	float		result, curVal, y0, yLeft, yRight, denom, delta;
+
+	azimLen			=	search->azimLen;
+	elevLen			=	search->elevLen;
+
+	y0				=	maxVal;
+	curAzim			=	bestAzim;
+	left			=	bestAzim - coarseStep;
+	right			=	bestAzim + coarseStep;
+	if ((left >= 0) && (right <= azimLen - 1) && ((((bestAzim + search->azimOffset) % coarseStep) + coarseStep) % coarseStep == 0))
+	{
+		yLeft		=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, left, bestElev);
+		yRight		=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, right, bestElev);
+		denom		=	yLeft - 2.f * y0 + yRight;
+		if (denom < 0.f)
+		{
+			delta	=	0.5f * (yLeft - yRight) * (float)coarseStep * _rcpsp(denom);
+			curAzim	=	bestAzim + (int32_t)(delta + ((delta >= 0.f) ? 0.5f : -0.5f));
+			if (curAzim < left)
+				curAzim	=	left;
+			if (curAzim > right)
+				curAzim	=	right;
+		}
+	}
+	curElev			=	bestElev;
+	left			=	bestElev - coarseStep;
+	right			=	bestElev + coarseStep;
+	if ((left >= 0) && (right <= elevLen - 1) && ((((bestElev + search->elevOffset) % coarseStep) + coarseStep) % coarseStep == 0))
+	{
+		yLeft		=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, bestAzim, left);
+		yRight		=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, bestAzim, right);
+		denom		=	yLeft - 2.f * y0 + yRight;
+		if (denom < 0.f)
+		{
+			delta	=	0.5f * (yLeft - yRight) * (float)coarseStep * _rcpsp(denom);
+			curElev	=	bestElev + (int32_t)(delta + ((delta >= 0.f) ? 0.5f : -0.5f));
+			if (curElev < left)
+				curElev	=	left;
+			if (curElev > right)
+				curElev	=	right;
+		}
+	}
+	curVal			=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, curAzim, curElev);
+	if (curVal < maxVal)
+	{
+		curAzim		=	bestAzim;
+		curElev		=	bestElev;
+		curVal		=	maxVal;
+	}
+
+	do
+	{
+		moved		=	0;
+		bestAzim	=	curAzim;
+		bestElev	=	curElev;
+		for (azimIdx = curAzim - 1; azimIdx <= curAzim + 1; azimIdx++ )
+		{
+			if ((azimIdx < 0) || (azimIdx >= azimLen))
+				continue;
+			for (elevIdx = curElev - 1; elevIdx <= curElev + 1; elevIdx++ )
+			{
+				if ((elevIdx < 0) || (elevIdx >= elevLen))
+					continue;
+				result	=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, azimIdx, elevIdx);
+				if (curVal < result)
+				{
+					curVal		=	result;
+					bestAzim	=	azimIdx;
+					bestElev	=	elevIdx;
+					moved		=	1;
+				}
+			}
+		}
+		curAzim		=	bestAzim;
+		curElev		=	bestElev;
+	} while (moved);
+
+	*maxAzimInd		=	curAzim;
+	*maxElevInd		=	curElev;
+	return (curVal);
+}
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_aeHierSearch
+ *
+ *   \brief   Coarse-to-fine search of the spectrum peak. The grid is evaluated every coarseStep points. If the largest
+ *            coarse point is more than RADARDEMO_AOAEST2D_HIER_DENSE_RANGE above the smallest one, the peaks are too
+ *            sharp for the coarse grid and the whole grid is evaluated. Otherwise the peak is refined from the largest
+ *            coarse point and from every local max of the coarse grid within RADARDEMO_AOAEST2D_HIER_CAND_RATIO of it:
+ *            predicted between the coarse points by parabolic interpolation in each dimension, then a hill climb on
+ *            the grid. Only the evaluated points of the heatmap are written, the other ones are set negative.
+ *            coarseStep up to RADARDEMO_AOAEST2D_HIER_MAX_STEP finds the dense peak within one grid point
+ *            (CaponBF2D/tools/RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check.sh).
+ *
+ *   \param[in]    search
+ *               Search grid description. minVal is set to the minimum of the evaluated points.
+ *
+ *   \param[in]    coarseStep
+ *               Step of the coarse grid, in grid points. The last point of each dimension is always evaluated.
+ *
+ *   \param[out]    maxAzimInd
+ *               Azimuth index of the peak.
+ *
+ *   \param[out]    maxElevInd
+ *               Elevation index of the peak.
+ *
+ *   \ret       Spectrum value of the peak.
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+float RADARDEMO_aoaEst2DCaponBF_aeHierSearch(
+				IN RADARDEMO_aoaEst2D_aeSearch * search,
+				IN int32_t coarseStep,
+				OUT int32_t * maxAzimInd,
+				OUT int32_t * maxElevInd)
+{
+	int32_t		azimIdx, elevIdx, azimLen, elevLen, bestAzim, bestElev, curAzim, curElev;
+	float		result, maxVal, curVal, candVal;
+
+	azimLen			=	search->azimLen;
+	elevLen			=	search->elevLen;
+	search->minVal	=	1.0e25;
+
+	for (azimIdx = 0; azimIdx < azimLen; azimIdx++ )
+	{
+		for (elevIdx = 0; elevIdx < elevLen; elevIdx++ )
+		{
+			search->heatMap[azimIdx * search->azimStride + elevIdx * search->elevStride]	=	-1.f;
+		}
+	}
+
+	//coarse grid, aligned on the cache indices so that neighboring detections evaluate the same coarse points
+	maxVal			=	0.f;
+	bestAzim		=	0;
+	bestElev		=	0;
+	azimIdx			=	0;
+	while (1)
+	{
+		elevIdx		=	0;
+		while (1)
+		{
+			result	=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, azimIdx, elevIdx);
+			if (maxVal < result)
+			{
+				maxVal		=	result;
+				bestAzim	=	azimIdx;
+				bestElev	=	elevIdx;
+			}
+			if (elevIdx == elevLen - 1)
+				break;
+			elevIdx	=	aeHierNextCoarse(elevIdx, elevLen, coarseStep, search->elevOffset);
+		}
+		if (azimIdx == azimLen - 1)
+			break;
+		azimIdx		=	aeHierNextCoarse(azimIdx, azimLen, coarseStep, search->azimOffset);
+	}
+
+	//a coarse grid dynamic range above RADARDEMO_AOAEST2D_HIER_DENSE_RANGE means sharp peaks, which the coarse grid
+	//undersamples: dense search
+	if (maxVal > RADARDEMO_AOAEST2D_HIER_DENSE_RANGE * search->minVal)
+	{
+		curVal		=	maxVal;
+		*maxAzimInd	=	bestAzim;
+		*maxElevInd	=	bestElev;
+		for (azimIdx = 0; azimIdx < azimLen; azimIdx++ )
+		{
+			for (elevIdx = 0; elevIdx < elevLen; elevIdx++ )
+			{
+				result	=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, azimIdx, elevIdx);
+				if (curVal < result)
+				{
+					curVal			=	result;
+					*maxAzimInd		=	azimIdx;
+					*maxElevInd		=	elevIdx;
+				}
+			}
+		}
+		return (curVal);
+	}
+
+	//refinement from the largest coarse point, then from the other strong local maxima of the coarse grid: the
+	//largest coarse point may be on the lobe of another source than the largest peak
+	curVal			=	aeHierRefine(search, coarseStep, bestAzim, bestElev, maxVal, maxAzimInd, maxElevInd);
+	candVal			=	maxVal * RADARDEMO_AOAEST2D_HIER_CAND_RATIO;
+	azimIdx			=	0;
+	while (1)
+	{
+		elevIdx		=	0;
+		while (1)
+		{
+			result	=	RADARDEMO_aoaEst2DCaponBF_aeHierEval(search, azimIdx, elevIdx);
+			if ((result >= candVal) && ((azimIdx != bestAzim) || (elevIdx != bestElev))
+				&& aeHierCoarseLocalMax(search, coarseStep, azimIdx, elevIdx, result))
+			{
+				result	=	aeHierRefine(search, coarseStep, azimIdx, elevIdx, result, &curAzim, &curElev);
+				if (curVal < result)
+				{
+					curVal			=	result;
+					*maxAzimInd		=	curAzim;
+					*maxElevInd		=	curElev;
+				}
+			}
+			if (elevIdx == elevLen - 1)
+				break;
+			elevIdx	=	aeHierNextCoarse(elevIdx, elevLen, coarseStep, search->elevOffset);
+		}
+		if (azimIdx == azimLen - 1)
+			break;
+		azimIdx		=	aeHierNextCoarse(azimIdx, azimLen, coarseStep, search->azimOffset);
+	}
+	return (curVal);
+}
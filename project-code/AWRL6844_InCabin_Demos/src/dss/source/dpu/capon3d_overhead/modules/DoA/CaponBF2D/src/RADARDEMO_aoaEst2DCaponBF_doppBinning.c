@@ -0,0 +1,324 @@
+/*!
+ *  \file   RADARDEMO_aoaEst2DCaponBF_doppBinning.c
+ *  \brief   Doppler binning for the 2D capon covariance: computes only the selected Doppler bins.
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * The covariance of the Doppler binning path only uses 2 x numDoppBinSel bins of the zero padded Doppler FFT of
+ * each antenna and sub-frame, out of dopplerFFTSize (N). Three methods compute them:
+ *
+ *  - Full FFT: conversion to float, zero padding, DSPF_sp_fftSPxSP of size N and copy of the selected bins.
+ *    (N/2)log2(N) butterflies whatever the selection.
+ *  - DFT: each selected bin is a dot product of the numChirps input samples with a twiddle table, read directly
+ *    from the cplx16_t input, without zero padding. L x numChirps complex multiply-accumulates, L = 2 x numDoppBinSel.
+ *  - Pruned FFT (transform decomposition): with N = P x Q,
+ *        X[k] = sum_{p=0..P-1} W_N^(p k) Y_p[k mod Q],  Y_p = Q point FFT of x[p + P q], q = 0..Q-1
+ *    P DSPLIB FFTs of size Q, then P complex multiply-accumulates per selected bin. (N/2)log2(Q) butterflies plus
+ *    L x P multiply-accumulates, the log2(P) last stages of the full FFT are only computed for the selected bins.
+ *
+ * The DFT wins for small selections, the full FFT when most bins are selected, the pruned FFT in between. The
+ * method and P are selected at create time from a cost model: for a given number of chirps and FFT size, the
+ * choice only depends on the ratio of selected to total bins. tools/RADARDEMO_aoaEst2DCaponBF_doppBin_host_check.sh
+ * checks that the three methods agree, and with the timing argument measures them and fits the model constants.
+ */
+
+#include <source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src/RADARDEMO_aoaEst2DCaponBF_priv.h>
+
+#ifdef _TMS320C6X
+#include "c6x.h"
+#endif
+
+/* log2 of a power of 2 */
+static int32_t RADARDEMO_aoaEst2DCaponBF_doppBinLog2(int32_t n)
+{
+    int32_t log2n = 0;
+
+    while ((1 << (log2n + 1)) <= n)
+    {
+        log2n++;
+    }
+    return (log2n);
+}
+
+/* DSPLIB FFT radix parameter: 4 if log2(n) is even, 2 otherwise */
+static uint16_t RADARDEMO_aoaEst2DCaponBF_doppBinRad(int32_t n)
+{
+    return ((RADARDEMO_aoaEst2DCaponBF_doppBinLog2(n) & 1) == 0 ? 4 : 2);
+}
+
+/* Modeled cost of the DSPLIB FFT of size n */
+static float RADARDEMO_aoaEst2DCaponBF_doppBinFftCost(int32_t n)
+{
+    return (0.5f * (float)n * (float)RADARDEMO_aoaEst2DCaponBF_doppBinLog2(n) * RADARDEMO_AOAEST2D_DOPPBIN_BFLY_COST);
+}
+
+/* Selected bin index i, 0 <= i < 2 x numDoppBinSel, in the order of the output */
+static int32_t RADARDEMO_aoaEst2DCaponBF_doppBinIndex(RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle, int32_t i)
+{
+    if (i < doppBinHandle->numDoppBinSel)
+        return (doppBinHandle->doppSelMinBin + i);
+    else
+        return (doppBinHandle->dopplerFFTSize - doppBinHandle->numDoppBinSel - doppBinHandle->doppSelMinBin + (i - doppBinHandle->numDoppBinSel));
+}
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod
+void RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(
+    INOUT RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle)
+{
+    int32_t fftSize, numSel, numSubFFT, subFFTSize;
+    float   cost, bestCost;
+
+    fftSize = doppBinHandle->dopplerFFTSize;
+    numSel  = 2 * doppBinHandle->numDoppBinSel;
+
+    doppBinHandle->method     = RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT;
+    doppBinHandle->subFFTSize = 0;
+    doppBinHandle->numSubFFT  = 0;
+    doppBinHandle->subFFTRad  = 0;
+
+    if ((doppBinHandle->doppBinningEnable != 1) || (numSel > fftSize))
+        return;
+
+    /* Full FFT */
+    bestCost = RADARDEMO_AOAEST2D_DOPPBIN_LOAD_COST * (float)fftSize + RADARDEMO_aoaEst2DCaponBF_doppBinFftCost(fftSize);
+
+    /* Pruned FFT, best number of sub-FFTs */
+    for (numSubFFT = 2; (subFFTSize = fftSize / numSubFFT) >= RADARDEMO_AOAEST2D_DOPPBIN_MIN_SUBFFT; numSubFFT <<= 1)
+    {
+        cost = RADARDEMO_AOAEST2D_DOPPBIN_LOAD_COST * (float)fftSize
+             + (float)numSubFFT * RADARDEMO_aoaEst2DCaponBF_doppBinFftCost(subFFTSize)
+             + RADARDEMO_AOAEST2D_DOPPBIN_RECOMB_COST * (float)(numSel * numSubFFT);
+        if (cost < bestCost)
+        {
+            bestCost                  = cost;
+            doppBinHandle->method     = RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT;
+            doppBinHandle->subFFTSize = (uint16_t)subFFTSize;
+            doppBinHandle->numSubFFT  = (uint16_t)numSubFFT;
+        }
+    }
+
+    /* DFT */
+    cost = (float)(numSel * doppBinHandle->numChirps);
+    if (cost < bestCost)
+    {
+        doppBinHandle->method     = RADARDEMO_AOAEST2D_DOPPBIN_DFT;
+        doppBinHandle->subFFTSize = 0;
+        doppBinHandle->numSubFFT  = 0;
+    }
+
+    if (doppBinHandle->method == RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT)
+        doppBinHandle->subFFTRad = RADARDEMO_aoaEst2DCaponBF_doppBinRad(doppBinHandle->subFFTSize);
+}
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen
+void RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen(
+    OUT cplxf_t *twiddle,
+    IN int32_t fftSize)
+{
+    int32_t      m;
+    const double PI = 3.141592653589793;
+
+    for (m = 0; m < fftSize; m++)
+    {
+        twiddle[m].real = (float)cos(2 * PI * (double)m / (double)fftSize);
+        twiddle[m].imag = (float)-sin(2 * PI * (double)m / (double)fftSize);
+    }
+}
+
+/* Full FFT and copy of the selected bins. The FFT output is an array of floats, bin k starts at float 2k: the first
+ * selected bin is read at doppSelMinBin << 1. Before the pruned methods it was read at doppSelMinBin, that is bin
+ * doppSelMinBin / 2, with real and imaginary parts swapped for odd values; unchanged for doppSelMinBin = 0, the
+ * second half was already read at the right offset. */
+static void RADARDEMO_aoaEst2DCaponBF_doppBinFullFFT(
+    IN RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle,
+    IN cplx16_t *inputChirps,
+    OUT cplxf_t *output)
+{
+    float *RESTRICT doppBinFFTInput;
+    float *RESTRICT doppBinFFTOutput;
+    int32_t         i, secondHalfFftOutSelOffset;
+    unsigned char  *brev = NULL;
+
+    doppBinFFTInput           = (float *)doppBinHandle->tempDoppInput;
+    doppBinFFTOutput          = (float *)doppBinHandle->tempDoppOut;
+    secondHalfFftOutSelOffset = (doppBinHandle->dopplerFFTSize - doppBinHandle->numDoppBinSel - doppBinHandle->doppSelMinBin) << 1;
+
+    // get input value from clutter removal output to FFT input, but need to convert 16 bits to 32 bits.
+    for (i = 0; i < doppBinHandle->numChirps; i++)
+    {
+        doppBinFFTInput[2 * i]     = (float)(inputChirps[i].real);
+        doppBinFFTInput[2 * i + 1] = (float)(inputChirps[i].imag);
+    }
+    // padding zeros
+    for (i = doppBinHandle->numChirps; i < doppBinHandle->dopplerFFTSize; i++)
+    {
+        _amem8_f2(&doppBinFFTInput[2 * i]) = _ftof2(0.f, 0.f);
+    }
+
+    DSPF_sp_fftSPxSP(
+        doppBinHandle->dopplerFFTSize,
+        doppBinFFTInput,
+        (float *)doppBinHandle->dopTwiddle,
+        doppBinFFTOutput,
+        brev,
+        doppBinHandle->rad2D,
+        0,
+        doppBinHandle->dopplerFFTSize);
+
+    // select the bins from Doppler output and copied to the right position
+    memcpy((void *)&output[0], &doppBinFFTOutput[doppBinHandle->doppSelMinBin << 1], (doppBinHandle->numDoppBinSel) * sizeof(cplxf_t));
+    memcpy((void *)&output[doppBinHandle->numDoppBinSel], &doppBinFFTOutput[secondHalfFftOutSelOffset], (doppBinHandle->numDoppBinSel) * sizeof(cplxf_t));
+}
+
+/* Direct DFT of the selected bins, from the cplx16_t input */
+static void RADARDEMO_aoaEst2DCaponBF_doppBinDFT(
+    IN RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle,
+    IN cplx16_t *inputChirps,
+    OUT cplxf_t *output)
+{
+    cplx16_t *RESTRICT input;
+    cplxf_t  *RESTRICT twiddle;
+    int32_t            i, n, k, twIdx, twMask, numChirps;
+    float              xRe, xIm, accRe, accIm;
+
+    input     = inputChirps;
+    twiddle   = doppBinHandle->doppBinTwiddle;
+    twMask    = doppBinHandle->dopplerFFTSize - 1;
+    numChirps = doppBinHandle->numChirps;
+
+    for (i = 0; i < 2 * doppBinHandle->numDoppBinSel; i++)
+    {
+        k     = RADARDEMO_aoaEst2DCaponBF_doppBinIndex(doppBinHandle, i);
+        twIdx = 0;
+        accRe = 0.f;
+        accIm = 0.f;
+#ifdef _TMS320C6X
+#pragma MUST_ITERATE(4, , )
+#endif
+        for (n = 0; n < numChirps; n++)
+        {
+            xRe    = (float)input[n].real;
+            xIm    = (float)input[n].imag;
+            accRe += xRe * twiddle[twIdx].real - xIm * twiddle[twIdx].imag;
+            accIm += xRe * twiddle[twIdx].imag + xIm * twiddle[twIdx].real;
+            twIdx  = (twIdx + k) & twMask;
+        }
+        // same memory layout as the DSPLIB FFT output: real part first
+        _amem8_f2(&output[i]) = _ftof2(accIm, accRe);
+    }
+}
+
+/* Output pruned FFT: sub-FFTs of the decimated input, recombined for the selected bins only */
+static void RADARDEMO_aoaEst2DCaponBF_doppBinPrunedFFT(
+    IN RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle,
+    IN cplx16_t *inputChirps,
+    OUT cplxf_t *output)
+{
+    float   *RESTRICT subFFTInput;
+    cplxf_t *RESTRICT subFFTOutput;
+    cplxf_t *RESTRICT twiddle;
+    int32_t           i, p, q, n, k, twIdx, twMask, subMask;
+    int32_t           numSubFFT, subFFTSize;
+    float             accRe, accIm;
+    unsigned char    *brev = NULL;
+
+    subFFTInput  = (float *)doppBinHandle->tempDoppInput;
+    subFFTOutput = doppBinHandle->tempDoppOut;
+    twiddle      = doppBinHandle->doppBinTwiddle;
+    numSubFFT    = doppBinHandle->numSubFFT;
+    subFFTSize   = doppBinHandle->subFFTSize;
+    twMask       = doppBinHandle->dopplerFFTSize - 1;
+    subMask      = subFFTSize - 1;
+
+    for (p = 0; p < numSubFFT; p++)
+    {
+        // decimated input x[p + P q], zero padded
+        for (q = 0, n = p; q < subFFTSize; q++, n += numSubFFT)
+        {
+            if (n < doppBinHandle->numChirps)
+            {
+                subFFTInput[2 * q]     = (float)(inputChirps[n].real);
+                subFFTInput[2 * q + 1] = (float)(inputChirps[n].imag);
+            }
+            else
+            {
+                _amem8_f2(&subFFTInput[2 * q]) = _ftof2(0.f, 0.f);
+            }
+        }
+
+        DSPF_sp_fftSPxSP(
+            subFFTSize,
+            subFFTInput,
+            doppBinHandle->subFFTTwiddle,
+            (float *)&subFFTOutput[p * subFFTSize],
+            brev,
+            doppBinHandle->subFFTRad,
+            0,
+            subFFTSize);
+    }
+
+    // X[k] = sum_p W_N^(p k) Y_p[k mod Q]
+    for (i = 0; i < 2 * doppBinHandle->numDoppBinSel; i++)
+    {
+        k     = RADARDEMO_aoaEst2DCaponBF_doppBinIndex(doppBinHandle, i);
+        twIdx = 0;
+        accRe = 0.f;
+        accIm = 0.f;
+        for (p = 0; p < numSubFFT; p++)
+        {
+            // DSPLIB FFT output, real part first
+            __float2_t y = _amem8_f2(&subFFTOutput[p * subFFTSize + (k & subMask)]);
+
+            accRe += _lof2(y) * twiddle[twIdx].real - _hif2(y) * twiddle[twIdx].imag;
+            accIm += _lof2(y) * twiddle[twIdx].imag + _hif2(y) * twiddle[twIdx].real;
+            twIdx  = (twIdx + k) & twMask;
+        }
+        _amem8_f2(&output[i]) = _ftof2(accIm, accRe);
+    }
+}
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_doppBinning
+void RADARDEMO_aoaEst2DCaponBF_doppBinning(
+    IN RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle,
+    IN cplx16_t *inputChirps,
+    OUT cplxf_t *output)
+{
+    if (doppBinHandle->method == RADARDEMO_AOAEST2D_DOPPBIN_DFT)
+        RADARDEMO_aoaEst2DCaponBF_doppBinDFT(doppBinHandle, inputChirps, output);
+    else if (doppBinHandle->method == RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT)
+        RADARDEMO_aoaEst2DCaponBF_doppBinPrunedFFT(doppBinHandle, inputChirps, output);
+    else
+        RADARDEMO_aoaEst2DCaponBF_doppBinFullFFT(doppBinHandle, inputChirps, output);
+}
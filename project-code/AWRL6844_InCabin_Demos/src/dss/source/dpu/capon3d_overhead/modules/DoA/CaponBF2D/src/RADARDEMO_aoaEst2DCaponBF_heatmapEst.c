@@ -44,6 +44,9 @@
 #ifdef _TMS320C6X
 #include "c6x.h"
 #endif
+#ifdef RADARDEMO_AOAEST2D_STEERVEC_BENCHMARK
+#include <stdio.h>
+#endif
 
 
 /*!
@@ -200,9 +203,7 @@ void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
             // skip 33
             output                  =   2.f * (diagSum + output1);
 
-            result                  =   _rcpsp(output);
-            result                  =   result * (2.f - output * result);
-            result                  =   result * (2.f - output * result);
+            result                  =   rcpsp_i(output);
 
             if (!bfFlag)
                 result              =   output;
@@ -471,9 +472,7 @@ void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
 
             output                  =   2.f * output1;
 
-            result                  =   _rcpsp(output);
-            result                  =   result * (2.f - output * result);
-            result                  =   result * (2.f - output * result);
+            result                  =   rcpsp_i(output);
 
             if (!bfFlag)
                 result              =   output;
@@ -1142,9 +1141,7 @@ void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
 
             output                  =   2.f * output1;
 
-            result                  =   _rcpsp(output);
-            result                  =   result * (2.f - output * result);
-            result                  =   result * (2.f - output * result);
+            result                  =   rcpsp_i(output);
 
             if (!bfFlag)
                 result              =   output;
@@ -2334,9 +2331,7 @@ void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
 
                 output                  =   2.f * output1;
 
-                result                  =   _rcpsp(output);
-                result                  =   result * (2.f - output * result);
-                result                  =   result * (2.f - output * result);
+                result                  =   rcpsp_i(output);
 
                 if (!bfFlag)
                    result              =   output;
@@ -2378,9 +2373,7 @@ void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
                 }
             }
 
-            result              =   _rcpsp(output);
-            result              =   result * (2.f - output * result);
-            result              =   result * (2.f - output * result);
+            result              =   rcpsp_i(output);
 
             if (!bfFlag)
                 result          =   output;
@@ -2395,3 +2388,201 @@ void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
 
 
 
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable
+void RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(
+                IN uint8_t bfFlag,
+                IN RADARDEMO_aoaEst2D_RAHeatMap_handle * raHeatMap_handle,
+                IN int32_t  steerVecAnts,
+                IN cplxf_t * RESTRICT invRnMatrices,
+                OUT float  * maxValPerRngBin,
+                OUT float  * RESTRICT rangeAzimuthHeatMap)
+{
+    int32_t     i, azimIdx, elevIdx, elevStart, azimLen, elevLen, blockRows;
+    __float2_t  * RESTRICT blockPtr;
+    __float2_t  * RESTRICT azimPtr;
+    __float2_t  * RESTRICT elevPtr;
+    float       maxVal, blockMaxVal;
+
+    azimLen         =   (int32_t) raHeatMap_handle->azimSearchLen;
+    elevLen         =   (int32_t) raHeatMap_handle->elevSearchLen;
+    blockRows       =   (int32_t) raHeatMap_handle->steerVecBlockRows;
+    maxVal          =   0.f;
+
+#ifdef _TMS320C6X
+    _nassert(steerVecAnts %4    ==  0);
+#endif
+
+    for (elevStart = 0; elevStart < elevLen; elevStart += blockRows)
+    {
+        // the last block is moved back to end at elevLen, so that every block has the same number of angle bins
+        if (elevStart + blockRows > elevLen)
+            elevStart       =   elevLen - blockRows;
+
+        blockPtr            =   (__float2_t *) raHeatMap_handle->steeringVecBlock;
+        for (elevIdx = elevStart; elevIdx < elevStart + blockRows; elevIdx++)
+        {
+            azimPtr         =   (__float2_t *) raHeatMap_handle->steeringVecAzim;
+            for (azimIdx = 0; azimIdx < azimLen; azimIdx++)
+            {
+                elevPtr     =   (__float2_t *) &raHeatMap_handle->steeringVecElev[elevIdx * steerVecAnts];
+                #ifdef _TMS320C6X
+                #pragma MUST_ITERATE(4,,4);
+                #endif
+                for (i = 0; i < steerVecAnts; i++)
+                {
+                    _amem8_f2(blockPtr++)   =   _complex_mpysp(_amem8_f2(azimPtr++), _amem8_f2(&elevPtr[i]));
+                }
+            }
+        }
+
+        RADARDEMO_aoaEst2DCaponBF_raHeatmap(
+            bfFlag,
+            (int32_t) raHeatMap_handle->nRxAnt,
+            steerVecAnts,
+            azimLen,
+            blockRows,
+            raHeatMap_handle->steeringVecBlock,
+            NULL,
+            raHeatMap_handle->virtAntInd2Proc,
+            (int32_t *) raHeatMap_handle->scratchPad,
+            invRnMatrices,
+            &blockMaxVal,
+            &rangeAzimuthHeatMap[elevStart * azimLen]);
+
+        if (maxVal < blockMaxVal)
+            maxVal          =   blockMaxVal;
+    }
+    *maxValPerRngBin        =   maxVal;
+}
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy
+void RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(
+                IN RADARDEMO_aoaEst2D_RAHeatMap_handle * raHeatMap_handle,
+                IN int32_t  nRxAnt,
+                IN int32_t  azimIdx,
+                IN int32_t  elevIdx,
+                IN cplxf_t * vecIn,
+                OUT cplxf_t * vecOut)
+{
+    int32_t     i;
+    __float2_t  * azimPtr;
+    __float2_t  * elevPtr;
+
+    if (raHeatMap_handle->steeringVec != NULL)
+    {
+        azimPtr     =   (__float2_t *) &raHeatMap_handle->steeringVec[(elevIdx * raHeatMap_handle->azimSearchLen + azimIdx) * nRxAnt];
+        for (i = 0; i < nRxAnt; i++)
+        {
+            _amem8_f2(&vecOut[i])   =   _complex_mpysp(_amem8_f2(&vecIn[i]), _amem8_f2(&azimPtr[i]));
+        }
+    }
+    else
+    {
+        azimPtr     =   (__float2_t *) &raHeatMap_handle->steeringVecAzim[azimIdx * nRxAnt];
+        elevPtr     =   (__float2_t *) &raHeatMap_handle->steeringVecElev[elevIdx * nRxAnt];
+        for (i = 0; i < nRxAnt; i++)
+        {
+            _amem8_f2(&vecOut[i])   =   _complex_mpysp(_amem8_f2(&vecIn[i]), _complex_mpysp(_amem8_f2(&azimPtr[i]), _amem8_f2(&elevPtr[i])));
+        }
+    }
+}
+
+#ifdef RADARDEMO_AOAEST2D_STEERVEC_BENCHMARK
+
+/* Cycles of the heatmap of one range bin, best of 4 runs. Stored table if blockRows is 0. */
+static uint32_t RADARDEMO_aoaEst2DCaponBF_steerVecBenchRun(
+                RADARDEMO_aoaEst2D_RAHeatMap_handle * raHeatMap_handle,
+                int32_t steerVecAnts,
+                int32_t blockRows,
+                cplxf_t * steeringVec,
+                cplxf_t * invRn,
+                float * heatmap)
+{
+    uint32_t run, cycles, minCycles = 0xFFFFFFFFU;
+    float    maxVal;
+
+    raHeatMap_handle->steerVecBlockRows = (uint16_t)blockRows;
+    for (run = 0; run < 4; run++)
+    {
+        cycles = TSCL;
+        if (blockRows == 0)
+            RADARDEMO_aoaEst2DCaponBF_raHeatmap(1, (int32_t)raHeatMap_handle->nRxAnt, steerVecAnts,
+                (int32_t)raHeatMap_handle->azimSearchLen, (int32_t)raHeatMap_handle->elevSearchLen,
+                steeringVec, NULL, raHeatMap_handle->virtAntInd2Proc, NULL, invRn, &maxVal, heatmap);
+        else
+            RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(1, raHeatMap_handle, steerVecAnts, invRn, &maxVal, heatmap);
+        cycles = TSCL - cycles;
+        if (cycles < minCycles)
+            minCycles = cycles;
+    }
+    return (minCycles);
+}
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_steerVecBenchmark
+void RADARDEMO_aoaEst2DCaponBF_steerVecBenchmark(
+    IN RADARDEMO_aoaEst2D_RAHeatMap_handle *raHeatMap_handle,
+    IN int32_t steerVecAnts)
+{
+    RADARDEMO_aoaEst2D_RAHeatMap_handle bench;
+    int32_t  i, j, k, azimLen, elevLen, numAngleBins, rnLen, blockRows;
+    uint32_t tableBytes, factorBytes, cycles;
+    cplxf_t *steeringVec, *invRn, *block;
+    float   *heatmap;
+
+    azimLen      = (int32_t)raHeatMap_handle->azimSearchLen;
+    elevLen      = (int32_t)raHeatMap_handle->elevSearchLen;
+    numAngleBins = azimLen * elevLen;
+    rnLen        = steerVecAnts * (steerVecAnts + 1) / 2;
+    tableBytes   = numAngleBins * steerVecAnts * sizeof(cplxf_t);
+    factorBytes  = (azimLen + elevLen) * steerVecAnts * sizeof(cplxf_t);
+
+    /* stored table, whole-search block, heatmap and inverse covariance in one scratch buffer */
+    steeringVec  = (cplxf_t *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 1, 2 * tableBytes + numAngleBins * sizeof(float) + rnLen * sizeof(cplxf_t), 8);
+    if (steeringVec == NULL)
+        return;
+    block        = &steeringVec[numAngleBins * steerVecAnts];
+    invRn        = &block[numAngleBins * steerVecAnts];
+    heatmap      = (float *)&invRn[rnLen];
+
+    /* stored table as built in table mode, a(az, el) = aAzim(az) .* aElev(el) */
+    for (k = 0; k < elevLen; k++)
+    {
+        for (j = 0; j < azimLen; j++)
+        {
+            for (i = 0; i < steerVecAnts; i++)
+            {
+                _amem8_f2(&steeringVec[(k * azimLen + j) * steerVecAnts + i]) = _complex_mpysp(
+                    _amem8_f2(&raHeatMap_handle->steeringVecAzim[j * steerVecAnts + i]), _amem8_f2(&raHeatMap_handle->steeringVecElev[k * steerVecAnts + i]));
+            }
+        }
+    }
+
+    /* Hermitian, diagonally dominant inverse covariance, upper triangle */
+    k = 0;
+    for (i = 0; i < steerVecAnts; i++)
+    {
+        for (j = i; j < steerVecAnts; j++)
+        {
+            if (j == i)
+                _amem8_f2(&invRn[k++]) = _ftof2((float)(steerVecAnts + 1), 0.f);
+            else
+                _amem8_f2(&invRn[k++]) = _ftof2((float)(((i * 7919 + j * 104729) & 0xFF) - 128) * (1.f / 1024.f),
+                                                (float)(((i * 104729 + j * 7919) & 0xFF) - 128) * (1.f / 1024.f));
+        }
+    }
+
+    bench                  = *raHeatMap_handle;
+    bench.steeringVec      = NULL;
+    bench.steeringVecBlock = block;
+
+    printf("Steering vector benchmark, %d antennas, %d x %d angle bins, cycles per range bin\n", steerVecAnts, azimLen, elevLen);
+    cycles = RADARDEMO_aoaEst2DCaponBF_steerVecBenchRun(&bench, steerVecAnts, 0, steeringVec, invRn, heatmap);
+    printf("table     %7u bytes %8u cycles\n", tableBytes, cycles);
+    for (blockRows = raHeatMap_handle->steerVecBlockRows; blockRows <= elevLen; blockRows++)
+    {
+        cycles = RADARDEMO_aoaEst2DCaponBF_steerVecBenchRun(&bench, steerVecAnts, blockRows, steeringVec, invRn, heatmap);
+        printf("rows %3d  %7u bytes %8u cycles\n", blockRows, factorBytes + (uint32_t)(blockRows * azimLen * steerVecAnts) * (uint32_t)sizeof(cplxf_t), cycles);
+    }
+}
+#endif
@@ -45,6 +45,8 @@
 #include <source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/api/RADARDEMO_aoaEst2DCaponBF.h>
 #include <source/dpu/capon3d_overhead/modules/postProcessing/matrixFunc/api/MATRIX_cholesky.h>
 #include <source/dpu/capon3d_overhead/modules/utilities/radar_commonMath.h>
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_cplxMath.h>
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_twiddle.h>
 
 #ifndef _TMS320C6600
 #include <source/dpu/capon3d_overhead/modules/utilities/radar_c674x.h>
@@ -72,6 +74,10 @@ extern void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, un
 #define RADARDEMO_AOAESTBF_PIOVER180 (3.141592653589793 / 180.0) //!< define the pi/180
 #define RADARDEMO_AOAESTBF_PI        (3.141592653589793f) //!< define pi
 
+//! \brief   Minimum number of angle bins per call of the range-angle heatmap kernel.
+//!
+#define RADARDEMO_AOAEST2D_STEERVEC_BLOCKBINS (80)
+
 //! \brief   Subtask handle definition for 2D capon beamforming: range-angle heatmap generation.
 //!
 typedef struct _RADARDEMO_aoaEst2DRAHeatMap_handle_
@@ -86,7 +92,9 @@ typedef struct _RADARDEMO_aoaEst2DRAHeatMap_handle_
     float    gamma; //!< Diagnol loading scaling factor
     cplxf_t *steeringVecAzim; //!< steering vector in azimuth domain.
     cplxf_t *steeringVecElev; //!< steering vector in elevation domain.
-    cplxf_t *steeringVec; //!< steering vector in azimuth-elevation domain.
+    cplxf_t *steeringVec; //!< steering vector in azimuth-elevation domain, NULL if generated from steeringVecAzim and steeringVecElev.
+    cplxf_t *steeringVecBlock; //!< steering vectors of steerVecBlockRows elevation rows, generated from steeringVecAzim and steeringVecElev.
+    uint16_t steerVecBlockRows; //!< number of elevation rows in steeringVecBlock.
     float    muStep; /**< Step value of mu --  elevation est step.*/
     float    muInit; /**< Initial value of mu -- elevation est starting value*/
     float    nuStep; /**< Step value of nu -- azimuth est step.*/
@@ -96,6 +104,86 @@ typedef struct _RADARDEMO_aoaEst2DRAHeatMap_handle_
     uint8_t  azimOnly; /**< range-azimuth estimation only */
 } RADARDEMO_aoaEst2D_RAHeatMap_handle;
 
+//! \brief   Number of entries of the zoom-in spectrum cache, power of 2.
+//!
+#define RADARDEMO_AOAEST2D_AECACHE_SIZE         (256)
+
+//! \brief   Azimuth index of an empty zoom-in spectrum cache entry.
+//!
+#define RADARDEMO_AOAEST2D_AECACHE_INVALID      (0x7FFF)
+
+//! \brief   Hierarchical angle search: the peak is refined from every local max of the coarse grid above this
+//!          fraction of the largest coarse point.
+//!
+#define RADARDEMO_AOAEST2D_HIER_CAND_RATIO      (0.25f)
+
+//! \brief   Hierarchical angle search: a ratio of the largest to the smallest coarse point above this value falls
+//!          back to the dense search.
+//!
+#define RADARDEMO_AOAEST2D_HIER_DENSE_RANGE     (10.f)
+
+//! \brief   Hierarchical angle search: largest coarse step, larger values are rejected at creation.
+//!
+#define RADARDEMO_AOAEST2D_HIER_MAX_STEP        (3)
+
+//! \brief   Zoom-in spectrum cache entry. The zoom-in grids of the detections of a range bin are aligned on one fine
+//!          grid of the range bin, zoominFactor fine points per range-angle heatmap bin: a spectrum value computed for
+//!          one detection is reused by the neighboring detections of the same range bin.
+//!
+typedef struct _RADARDEMO_aoaEst2D_aeCacheEntry_
+{
+    int16_t   azimIdx; /**< azimuth index on the fine grid of the range bin, RADARDEMO_AOAEST2D_AECACHE_INVALID if empty.*/
+    int16_t   elevIdx; /**< elevation index on the fine grid of the range bin.*/
+    float     value; /**< spectrum value.*/
+} RADARDEMO_aoaEst2D_aeCacheEntry;
+
+//! \brief   Scratch size in bytes of the zoom-in angle estimation, dense search if hierFlag is 0, hierarchical search
+//!          otherwise: 3 steering vectors, the zoom-in heatmap and, for the hierarchical search, the azimuth steering
+//!          vectors of the zoom-in grid.
+//!
+#define RADARDEMO_AOAEST2D_ZOOMIN_SCRATCHSIZE(nRxAnt, azimLen, elevLen, hierFlag) \
+    ((3 * (nRxAnt) * 2 + (((azimLen) * (elevLen) + 1) & ~1) + ((hierFlag) ? (azimLen) * (nRxAnt) * 2 : 0)) * sizeof(uint32_t))
+
+//! \brief   Number of beams beamformed together for Doppler estimation, the beams of a block share each load of the
+//!          Doppler slice.
+//!
+#define RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK (4)
+
+//! \brief   Scratch size in bytes of the Doppler estimation: beamforming output of the beams of one pass, Doppler FFT
+//!          output and Doppler spectrum.
+//!
+#define RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(numBeamsPerPass, dopplerFFTSize) \
+    (((numBeamsPerPass) * 2 + 2 + 1) * (dopplerFFTSize) * sizeof(float))
+
+//! \brief   Largest Doppler estimation scratch in bytes: the LL1 scratch of the DSS (L1SCRATCHSIZE, 0x2000 in
+//!          mmwave_demo_dss.c), less the 8 bytes radarOsal_memAlloc may skip to align it. The beams beamformed in
+//!          one pass are reduced to fit.
+//!
+#define RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH (0x2000 - 8)
+
+//! \brief   Description of the grid of a hierarchical angle search. The steering vector of grid point (azimIdx, elevIdx)
+//!          is azimTab[azimIdx] .* elevTab[elevIdx], the spectrum value is written to
+//!          heatMap[azimIdx * azimStride + elevIdx * elevStride].
+//!
+typedef struct _RADARDEMO_aoaEst2D_aeSearch_
+{
+    uint8_t   bfFlag; /**< 1: Capon spectrum, 0: conventional BF spectrum.*/
+    int32_t   nRxAnt; /**< number of antennas.*/
+    cplxf_t  *invRn; /**< inverse covariance matrix, upper triangle.*/
+    cplxf_t  *azimTab; /**< azimuth steering vectors, azimLen x nRxAnt.*/
+    cplxf_t  *elevTab; /**< elevation steering vectors, elevLen x nRxAnt.*/
+    int32_t   azimLen; /**< number of azimuth grid points.*/
+    int32_t   elevLen; /**< number of elevation grid points.*/
+    int32_t   azimStride; /**< heatmap stride of the azimuth index.*/
+    int32_t   elevStride; /**< heatmap stride of the elevation index.*/
+    float    *heatMap; /**< heatmap, negative for the points not evaluated.*/
+    cplxf_t  *steeringVec; /**< scratch steering vector, nRxAnt.*/
+    RADARDEMO_aoaEst2D_aeCacheEntry *cache; /**< spectrum cache, NULL if not used.*/
+    int32_t   azimOffset; /**< azimuth index of grid point 0 in the cache, the coarse grid is aligned on it.*/
+    int32_t   elevOffset; /**< elevation index of grid point 0 in the cache, the coarse grid is aligned on it.*/
+    float     minVal; /**< minimum spectrum value of the evaluated points.*/
+} RADARDEMO_aoaEst2D_aeSearch;
+
 //! \brief   Subtask handle definition for 2D capon beamforming: azimuth-elevation heatmap generation, and detection.
 //!
 typedef struct _RADARDEMO_aoaEst2D_aeEst_handle_
@@ -129,9 +217,38 @@ typedef struct _RADARDEMO_aoaEst2D_aeEst_handle_
     uint8_t   zoominFactor; /**< Zoom in factor */
     uint8_t   zoominNn8bors; /**< number of neighbors to zoom in on each side.*/
     uint8_t   localMaxCheckFlag; /**Local max check flag: 0 - no check; 1 - elevation domain only; 2 - both elevation and azimuth */
+    uint8_t   coarseSearchStep; /**< coarse grid step of the hierarchical angle search, 0 or 1 for the dense search.*/
+    cplxf_t  *steeringVecElevTab; //!< zoom-in elevation steering vectors, elevSearchLen x nRxAnt, hierarchical search only.
+    RADARDEMO_aoaEst2D_aeCacheEntry *zoominCache; //!< zoom-in spectrum cache, hierarchical search only.
+    cplxf_t  *zoominCacheInvRn; //!< inverse covariance matrix of the cached values, NULL if the cache is empty.
+    uint8_t   zoominCacheBfFlag; //!< bfFlag of the cached values.
 } RADARDEMO_aoaEst2D_aeEst_handle;
 
 
+//! \brief   Doppler binning methods. Only the 2 x numDoppBinSel selected bins of the Doppler FFT are used, the method
+//!          computing them with the lowest cost is selected at create time.
+//!
+#define RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT      (0)     /**< full DSPLIB FFT, then copy of the selected bins */
+#define RADARDEMO_AOAEST2D_DOPPBIN_DFT          (1)     /**< direct DFT of the selected bins only */
+#define RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT    (2)     /**< output pruned FFT: P sub-FFTs of size Q = N/P, recombined for the selected bins only */
+#define RADARDEMO_AOAEST2D_DOPPBIN_NUMMETHODS   (3)
+
+//! \brief   Cost model of the method selection, in units of one complex multiply-accumulate of the DFT. Fitted
+//!          on the host by tools/RADARDEMO_aoaEst2DCaponBF_doppBin_host_check.sh timing, with a radix-2 stand-in of
+//!          DSPF_sp_fftSPxSP. Crossovers measured there, in selected / total bins: the DFT up to 0.25 (N = 16, 16
+//!          chirps), 0.125 (32, 32), 0.0625 (64, 64), 0.016 (256, 256); the full FFT from about 0.34 to 0.375; the
+//!          pruned FFT in between. The choice is within 10% of the fastest measured method on about 90% of the
+//!          selection sizes, 36-49% slower at worst (was 76% with 0.5 / 2 / 1). Re-run on the C66x with the DSPLIB
+//!          FFT to re-fit.
+//!
+#define RADARDEMO_AOAEST2D_DOPPBIN_BFLY_COST    (1.f)   /**< cost of one radix-2 butterfly of the DSPLIB FFT */
+#define RADARDEMO_AOAEST2D_DOPPBIN_LOAD_COST    (3.f)   /**< cost of converting or zero padding one FFT input sample */
+#define RADARDEMO_AOAEST2D_DOPPBIN_RECOMB_COST  (0.75f) /**< cost of one multiply-accumulate of the pruned FFT recombination */
+
+//! \brief   Minimum sub-FFT size of the pruned FFT, DSPF_sp_fftSPxSP limit.
+//!
+#define RADARDEMO_AOAEST2D_DOPPBIN_MIN_SUBFFT   (8)
+
 //! \brief   Subtask handle definition for 2D capon beamforming: doppler binning feature.
 //!
 typedef struct _RADARDEMO_aoaEst2D_doppBinning_handle_
@@ -144,10 +261,16 @@ typedef struct _RADARDEMO_aoaEst2D_doppBinning_handle_
     uint16_t doppSelMinBin; /**< the min bin selected from Doppler output*/
     uint16_t doppSelMaxBin; /**< the max bin selected from Doppler output*/
     uint16_t numDoppBinSel; /**< the total number of Doppler bin selected cross cumulate frames*/
+    uint16_t method; /**< Doppler binning method, RADARDEMO_AOAEST2D_DOPPBIN_xxx*/
+    uint16_t subFFTSize; /**< Sub-FFT size Q of the pruned FFT*/
+    uint16_t numSubFFT; /**< Number of sub-FFTs P of the pruned FFT*/
+    uint16_t subFFTRad; /**< DSPLIB FFT radix parameter of the sub-FFT*/
     cplxf_t *tempDoppInput; /**< input to floating point Doppler FFT*/
     cplxf_t *tempDoppOut; /**< output to the floating point Doppler FFT*/
     cplxf_t *DoppBinSelOutAccum; /**< input to the coviance matrix generation*/
     float   *dopTwiddle; /**< Doppler FFT twiddle factor.*/
+    float   *subFFTTwiddle; /**< Sub-FFT twiddle factor of the pruned FFT, NULL for the other methods*/
+    cplxf_t *doppBinTwiddle; /**< exp(-j*2*pi*m/dopplerFFTSize), m = 0..dopplerFFTSize-1, for the DFT and the pruned FFT, NULL for the full FFT*/
 } RADARDEMO_aoaEst2D_doppBinning_handle;
 
 ////!  \brief   Subtask handle definition for 2D capon beamforming: azimuth-elevation heatmap generation, and detection.
@@ -201,6 +324,13 @@ typedef struct _RADARDEMO_aoaEst2DCaponBF_handle_
     uint8_t     useCFAR4DopDet;         /**< Flag, if set to 1, indicating using CFAR-CASO for Doppler detection. Otherwise, use simple peak search.*/
 	void		* dopCFARHandle;		/**< CFAR handle Doppler detection. Otherwise, if useCFAR4DopDet is set to 1.*/
 	cplx16_t	* tempInputWOstatic;	/**< temporary buffer in scratch memory to hold the clutter removed signal per range bin.*/	
+	uint16_t	maxNumBeams;			/**< max number of angle estimates per detection.*/
+	uint16_t	dopNumBeamsPerPass;		/**< number of beams beamformed together for Doppler estimation, bounded by RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH.*/
+	uint16_t	dopQueueNumDet;			/**< number of detections queued for the batched Doppler estimation (processingStepSelector 2).*/
+	uint16_t	dopQueueNumBeams;		/**< number of angle estimates queued for the batched Doppler estimation.*/
+	uint16_t	dopQueueRangeIndx;		/**< range bin of the queued detections.*/
+	cplxf_t		* dopSlice;				/**< chirps of the current frame of one range bin, per antenna, DC removed, shared by the detections of the range bin.*/
+	cplx16_t	* dopSliceSrc;			/**< radar cube samples dopSlice is computed from, NULL if dopSlice is out of date.*/
 	RADARDEMO_detectionCFAR_input		* dopCFARInput;
 	RADARDEMO_detectionCFAR_output		* dopCFARout; /**< Pointer Doppler CFAR output, if useCFAR4DopDet is set to 1, otherwise, NULL.*/
 } RADARDEMO_aoaEst2DCaponBF_handle;
@@ -347,6 +477,81 @@ extern void RADARDEMO_aoaEst2DCaponBF_covInv_floatIn(
     IN cplxf_t  *inputAntSamples,
     OUT cplxf_t *invRnMatrices);
 
+//! \brief   Size in bytes of the scratch memory of RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv(): full Rn and RnInv
+//!          matrices, followed by the raw sums of products of the nRxAnt processed antennas and the raw sums of the
+//!          nRxAntTotal antennas.
+//!
+#define RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(nRxAnt, nRxAntTotal) \
+    (2 * (nRxAnt) * (nRxAnt) * sizeof(cplxf_t) + (nRxAnt) * ((nRxAnt) + 1) * sizeof(int64_t) + 2 * (nRxAntTotal) * sizeof(int32_t))
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv
+ *
+ *   \brief   Per range bin, clutter removal and covariance estimation in one pass over the radar cube, and inversion.
+ *            The raw sums and the raw sums of products of the chirps are accumulated exactly in integers, then the
+ *            covariance of the clutter removed signal is obtained with the rank-one correction
+ *            R = (sum(x x^H) - sum(x) sum(x)^H / nChirps) / nChirps. No clutter removed copy of the range bin is written.
+ *
+ *   \param[in]    invFlag
+ *               Flag to indicate matrix inversion will be performed.
+ *               If set to 1, output invRnMatrices will contain inversion of covariance matrices.
+ *               If set to 0, output invRnMatrices will contain covariance matrices without inversion.
+ *
+ *   \param[in]    clutterRemovalFlag
+ *               If set to 1, the mean of each antenna is removed and written to static_information.
+ *               If set to 0, the covariance of the input samples is estimated and static_information is not written.
+ *
+ *   \param[in]    gamma
+ *               Scaling factor for diagnal loading.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna processed, up to MAX_VIRTUAL_RXANT
+ *
+ *   \param[in]    nRxAntTotal
+ *               number of antenna in the radar cube, up to MAX_VIRTUAL_RXANT
+ *
+ *   \param[in]    nChirps
+ *               number of input chirps, up to 256.
+ *
+ *   \param[in]    scratch
+ *               scratch memory, must be of size RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(nRxAnt, nRxAntTotal).
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \param[in]    virtAntInd2Proc
+ *               Input array that defines the antennas need to be processed, contains indices out of the full virtual antenna array indices.
+ *
+ *   \param[in]    inputAntSamples
+ *               input samples from radar cube (1D FFT output) for the current (one) range bin to be processed, in the
+ *               radar cube layout (RADARDEMO_AOARADARCUDE_RNGCHIRPANT or RADARDEMO_AOARADARCUDE_RNGANTCHIRP).
+ *
+ *   \param[out]    static_information
+ *               Zero Doppler antenna samples for the range bin, nRxAntTotal values.
+ *
+ *   \param[out]    invRnMatrices
+ *               Output inverse of covariance matrices for the current range bin, in order of upper triangle of nRxAnt x nRxAnt Hermitian matrix.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv(
+    IN uint8_t   invFlag,
+    IN uint8_t   clutterRemovalFlag,
+    IN float     gamma,
+    IN int32_t   nRxAnt,
+    IN int32_t   nRxAntTotal,
+    IN int32_t   nChirps,
+    IN int32_t  *scratch,
+    IN uint8_t  *virtAntInd2Proc,
+    IN cplx16_t *inputAntSamples,
+    OUT cplxf_t *static_information,
+    OUT cplxf_t *invRnMatrices);
+
 
 /*!
  *   \fn     RADARDEMO_aoaEst2DCaponBF_raHeatmap
@@ -417,6 +622,91 @@ extern void RADARDEMO_aoaEst2DCaponBF_raHeatmap(
 				IN float   * RESTRICT maxValPerRngBin,
 				OUT float  * RESTRICT rangeAzimuthHeatMap);
 
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable
+ *
+ *   \brief   Range-azimuth-elevation heatmap per range bin, with the steering vectors generated from the azimuth and
+ *            elevation tables. The steering vectors of a block of elevation rows are generated in steeringVecBlock,
+ *            and the block is processed with RADARDEMO_aoaEst2DCaponBF_raHeatmap.
+ *
+ *   \param[in]    bfFlag
+ *               Flag to indicate which covariance matrix based beamforming will be performed.
+ *               If set to 1, Capon BF.
+ *               If set to 0, conventional BF.
+ *
+ *   \param[in]    raHeatMap_handle
+ *               Range-angle heatmap handle, with steeringVecAzim, steeringVecElev and steeringVecBlock.
+ *
+ *   \param[in]    steerVecAnts
+ *               number of antenna for steering vectors, it is the same as total number of virtual antennas in the system.
+ *
+ *   \param[in]    invRnMatrices
+ *               Inverse of covariance matrices of the current range bin, in order of upper triangle of nRxAnt x nRxAnt Hermitian matrix.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \param[out]    maxValPerRngBin
+ *               Output peak value in angle domain, per range bin.
+ *
+ *   \param[out]    rangeAzimuthHeatMap
+ *               Output heatmap of the range bin, azimSearchLen x elevSearchLen, azimuth first.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(
+				IN uint8_t bfFlag,
+				IN RADARDEMO_aoaEst2D_RAHeatMap_handle * raHeatMap_handle,
+				IN int32_t  steerVecAnts,
+				IN cplxf_t * RESTRICT invRnMatrices,
+				OUT float  * maxValPerRngBin,
+				OUT float  * RESTRICT rangeAzimuthHeatMap);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy
+ *
+ *   \brief   Multiplies a vector with the range-azimuth-elevation steering vector of one angle bin, element by element,
+ *            from the stored table or from the azimuth and elevation tables.
+ *
+ *   \param[in]    raHeatMap_handle
+ *               Range-angle heatmap handle.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna.
+ *
+ *   \param[in]    azimIdx
+ *               Azimuth index, in azimSearchLen.
+ *
+ *   \param[in]    elevIdx
+ *               Elevation index, in elevSearchLen.
+ *
+ *   \param[in]    vecIn
+ *               Input vector of length nRxAnt.
+ *
+ *   \param[out]    vecOut
+ *               Output vector of length nRxAnt, can be vecIn.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(
+				IN RADARDEMO_aoaEst2D_RAHeatMap_handle * raHeatMap_handle,
+				IN int32_t  nRxAnt,
+				IN int32_t  azimIdx,
+				IN int32_t  elevIdx,
+				IN cplxf_t * vecIn,
+				OUT cplxf_t * vecOut);
+
 
 /*!
  *   \fn     RADARDEMO_aoaEst2DCaponBF_aeEstElevOnly
@@ -592,6 +882,69 @@ extern int32_t RADARDEMO_aoaEst2DCaponBF_aeEstZoomin(
 				OUT cplxf_t  * RESTRICT beamFilter
 			);
 
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_aeHierEval
+ *
+ *   \brief   Returns the spectrum value of one grid point of a hierarchical angle search. The value is read from the
+ *            heatmap or the cache if the point has already been evaluated, computed and stored otherwise.
+ *
+ *   \param[in]    search
+ *               Search grid description.
+ *
+ *   \param[in]    azimIdx
+ *               Azimuth index of the grid point.
+ *
+ *   \param[in]    elevIdx
+ *               Elevation index of the grid point.
+ *
+ *   \ret       Spectrum value.
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern float RADARDEMO_aoaEst2DCaponBF_aeHierEval(
+				IN RADARDEMO_aoaEst2D_aeSearch * search,
+				IN int32_t azimIdx,
+				IN int32_t elevIdx);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_aeHierSearch
+ *
+ *   \brief   Coarse-to-fine search of the spectrum peak: the grid is evaluated every coarseStep points, the peak is
+ *            predicted between the coarse points by parabolic interpolation in each dimension, and refined by a hill
+ *            climb on the grid. Only the evaluated points of the heatmap are written, the other ones are set negative.
+ *            The peak is a local maximum, not always the global one: tools/RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check.sh
+ *            measures how often and how far it differs from the dense search.
+ *
+ *   \param[in]    search
+ *               Search grid description. minVal is set to the minimum of the evaluated points.
+ *
+ *   \param[in]    coarseStep
+ *               Step of the coarse grid, in grid points. The last point of each dimension is always evaluated.
+ *
+ *   \param[out]    maxAzimInd
+ *               Azimuth index of the peak.
+ *
+ *   \param[out]    maxElevInd
+ *               Elevation index of the peak.
+ *
+ *   \ret       Spectrum value of the peak.
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern float RADARDEMO_aoaEst2DCaponBF_aeHierSearch(
+				IN RADARDEMO_aoaEst2D_aeSearch * search,
+				IN int32_t coarseStep,
+				OUT int32_t * maxAzimInd,
+				OUT int32_t * maxElevInd);
+
 /*!
  *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstInput
  *
@@ -679,6 +1032,160 @@ extern void RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval(
     IN cplxf_t         *dcValues,
     OUT float *RESTRICT bfOutput);
 
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad
+ *
+ *   \brief   Transposes the chirps of the current frame of one range bin to antenna major order, converts them to
+ *            floating point and removes DC. Done once per range bin, the slice is shared by all its detections.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna
+ *
+ *   \param[in]    nChirps
+ *               number of chirps
+ *
+ *   \param[in]    inputSamples
+ *              Input 1D FFT results for the current range bin, in chirp major order, as in the radar cube.
+ *
+ *   \param[in]    dcValues
+ *               Chirp DC values
+ *
+ *   \param[out]    slice
+ *               DC removed samples, nRxAnt x nChirps.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad(
+    IN int32_t          nRxAnt,
+    IN int32_t          nChirps,
+    IN cplx16_t        *inputSamples,
+    IN cplxf_t         *dcValues,
+    OUT cplxf_t *RESTRICT slice);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice
+ *
+ *   \brief   Calculate the beam forming output for doppler estimation from a slice prepared by
+ *            RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad. Same output as RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna
+ *
+ *   \param[in]    nChirps
+ *               number of chirps
+ *
+ *   \param[in]    slice
+ *              DC removed samples of the current range bin, nRxAnt x nChirps.
+ *              Must be aligned to 8-byte boundary.
+ *
+ *   \param[in]    bweights
+ *               Beam filter coefficients for the detection.
+ *
+ *   \param[out]    bfOutput
+ *               Beamforming output for the current range bin and azimuth bin.
+ *               Must be in the order of real0, imag0, real1, imag1... as required by DSP LIB single precision floating-point FFT.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice(
+    IN int32_t          nRxAnt,
+    IN int32_t          nChirps,
+    IN cplxf_t         *slice,
+    IN cplxf_t         *bweights,
+    OUT float *RESTRICT bfOutput);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch
+ *
+ *   \brief   Calculate the beam forming output for doppler estimation of the angle estimates of one pass, as the
+ *            complex matrix product of the beam filters (numBeams x nRxAnt) by the Doppler slice (nRxAnt x nChirps).
+ *            The beams are processed in blocks of RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK, the beams of a block share each
+ *            load of the slice. Same output as RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice per beam.
+ *
+ *   \param[in]    nRxAnt
+ *               number of antenna
+ *
+ *   \param[in]    nChirps
+ *               number of chirps
+ *
+ *   \param[in]    numBeams
+ *               number of beams
+ *
+ *   \param[in]    slice
+ *              DC removed samples of the current range bin, nRxAnt x nChirps.
+ *              Must be aligned to 8-byte boundary.
+ *
+ *   \param[in]    bweights
+ *               Beam filter coefficients, numBeams x nRxAnt.
+ *
+ *   \param[out]    bfOutput
+ *               Beamforming output, numBeams x nChirps, each beam in the order of real0, imag0, real1, imag1... as
+ *               required by DSP LIB single precision floating-point FFT.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch(
+    IN int32_t          nRxAnt,
+    IN int32_t          nChirps,
+    IN int32_t          numBeams,
+    IN cplxf_t         *slice,
+    IN cplxf_t         *bweights,
+    OUT float *RESTRICT bfOutput);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_dopplerPowMax
+ *
+ *   \brief   Power spectrum of the Doppler FFT output and its maximum, two bins per iteration.
+ *
+ *   \param[in]    fftSize
+ *               Doppler FFT size, even.
+ *
+ *   \param[in]    fftOutput
+ *               Doppler FFT output, in the order of real0, imag0, real1, imag1...
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \param[out]    spectrum
+ *               Power spectrum.
+ *               Must be aligned to 8-byte boundary.
+ *
+ *   \param[out]    maxIdx
+ *               Index of the first maximum of the spectrum, 0 if the spectrum is all 0.
+ *
+ *   \ret       maximum of the spectrum.
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern float RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(
+    IN int32_t          fftSize,
+    IN float           *fftOutput,
+    OUT float *RESTRICT spectrum,
+    OUT int32_t        *maxIdx);
+
 /*!
  *   \fn     RADARDEMO_aoaEstimationBFSinglePeak_static
  *
@@ -715,6 +1222,102 @@ extern void  RADARDEMO_aoaEstimationBFSinglePeak_static(
                             OUT float   * peakVal
 							);
 
-extern void tw_gen_float (float *w, int n);
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod
+ *
+ *   \brief   Selects the Doppler binning method with the lowest modeled cost and the sub-FFT size of the pruned FFT.
+ *            Sets method, subFFTSize, numSubFFT and subFFTRad. The full FFT is kept when binning is disabled.
+ *
+ *   \param[in,out]    doppBinHandle
+ *               Doppler binning handle, with numChirps, dopplerFFTSize and numDoppBinSel set.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(
+    INOUT RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen
+ *
+ *   \brief   Generates the twiddle table of the DFT and of the pruned FFT recombination, exp(-j*2*pi*m/N).
+ *
+ *   \param[out]    twiddle
+ *               Output table of N values.
+ *
+ *   \param[in]    fftSize
+ *               Doppler FFT size N.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen(
+    OUT cplxf_t *twiddle,
+    IN int32_t fftSize);
+
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_doppBinning
+ *
+ *   \brief   Computes the selected Doppler bins of one antenna and one sub-frame, with the method of the handle.
+ *
+ *   \param[in]    doppBinHandle
+ *               Doppler binning handle.
+ *
+ *   \param[in]    inputChirps
+ *               numChirps clutter removed samples of the antenna and sub-frame.
+ *
+ *   \param[out]    output
+ *               2 x numDoppBinSel output values: bins doppSelMinBin to doppSelMaxBin, followed by bins
+ *               dopplerFFTSize - doppSelMaxBin - 1 to dopplerFFTSize - doppSelMinBin - 1.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_doppBinning(
+    IN RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle,
+    IN cplx16_t *inputChirps,
+    OUT cplxf_t *output);
+
+#ifdef RADARDEMO_AOAEST2D_STEERVEC_BENCHMARK
+/*!
+ *   \fn     RADARDEMO_aoaEst2DCaponBF_steerVecBenchmark
+ *
+ *   \brief   Measures the cycles of the heatmap of one range bin with the stored steering vectors and with the
+ *            steering vectors generated from the azimuth and elevation tables, for block sizes from the minimum to
+ *            the whole elevation search, and prints the table with the steering vector memory of each.
+ *
+ *   \param[in]    raHeatMap_handle
+ *               Range-angle heatmap handle, created with the steering vectors generated from the azimuth and elevation tables.
+ *
+ *   \param[in]    steerVecAnts
+ *               number of antenna for steering vectors.
+ *
+ *   \ret       none
+ *
+ *   \pre       none
+ *
+ *   \post      none
+ *
+ *
+ */
+extern void RADARDEMO_aoaEst2DCaponBF_steerVecBenchmark(
+    IN RADARDEMO_aoaEst2D_RAHeatMap_handle *raHeatMap_handle,
+    IN int32_t steerVecAnts);
+#endif
 
 #endif //RADARDEMO_AOAEST2DCAPONBF_PRIV_H
@@ -414,3 +414,180 @@ void RADARDEMO_aoaEst2DCaponBF_covInv_floatIn(
         }
     }
 }
+
+//! \copydoc RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv
+void RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv(
+    IN uint8_t   invFlag,
+    IN uint8_t   clutterRemovalFlag,
+    IN float     gamma,
+    IN int32_t   nRxAnt,
+    IN int32_t   nRxAntTotal,
+    IN int32_t   nChirps,
+    IN int32_t  *scratch,
+    IN uint8_t  *virtAntInd2Proc,
+    IN cplx16_t *inputAntSamples,
+    OUT cplxf_t *static_information,
+    OUT cplxf_t *invRnMatrices)
+{
+    int32_t            antIdx, chirpIdx, i, j, rnIdx, pairIdx, chirpStride, antStride;
+    cplx16_t *RESTRICT input;
+    cplxf_t *RESTRICT  Rn;
+    cplxf_t *RESTRICT  RnInv;
+    int64_t *RESTRICT  sumProdRe;
+    int64_t *RESTRICT  sumProdIm;
+    int32_t *RESTRICT  sumRe;
+    int32_t *RESTRICT  sumIm;
+    int32_t            xRe[MAX_VIRTUAL_RXANT], xIm[MAX_VIRTUAL_RXANT];
+    int64_t            llRe, llIm;
+    float              scale, ftempRe, ftempIm, diagSum;
+
+#ifdef _TMS320C6X
+    _nassert(nChirps % 8 == 0);
+    _nassert(nRxAnt % 4 == 0);
+#endif
+
+#ifdef RADARDEMO_AOARADARCUDE_RNGCHIRPANT
+    chirpStride = nRxAntTotal;
+    antStride   = 1;
+#else
+    chirpStride = 1;
+    antStride   = nChirps;
+#endif
+
+    Rn        = (cplxf_t *)&scratch[0];
+    RnInv     = (cplxf_t *)&scratch[2 * nRxAnt * nRxAnt];
+    sumProdRe = (int64_t *)&scratch[4 * nRxAnt * nRxAnt];
+    sumProdIm = &sumProdRe[(nRxAnt * (nRxAnt + 1)) >> 1];
+    sumRe     = (int32_t *)&sumProdIm[(nRxAnt * (nRxAnt + 1)) >> 1];
+    sumIm     = &sumRe[nRxAntTotal];
+
+    for (pairIdx = 0; pairIdx < ((nRxAnt * (nRxAnt + 1)) >> 1); pairIdx++)
+    {
+        sumProdRe[pairIdx] = 0;
+        sumProdIm[pairIdx] = 0;
+    }
+    for (antIdx = 0; antIdx < nRxAntTotal; antIdx++)
+    {
+        sumRe[antIdx] = 0;
+        sumIm[antIdx] = 0;
+    }
+
+    /* single pass over the chirps: raw sums, and raw sums of x_antIdx * conj(x_i) for the upper triangle */
+    for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx++)
+    {
+        input = &inputAntSamples[chirpIdx * chirpStride];
+        for (antIdx = 0; antIdx < nRxAntTotal; antIdx++)
+        {
+            sumRe[antIdx] += input[antIdx * antStride].real;
+            sumIm[antIdx] += input[antIdx * antStride].imag;
+        }
+        for (antIdx = 0; antIdx < nRxAnt; antIdx++)
+        {
+            xRe[antIdx] = input[virtAntInd2Proc[antIdx] * antStride].real;
+            xIm[antIdx] = input[virtAntInd2Proc[antIdx] * antStride].imag;
+        }
+
+        pairIdx = 0;
+        for (antIdx = 0; antIdx < nRxAnt; antIdx++)
+        {
+            for (i = antIdx; i < nRxAnt; i++)
+            {
+                sumProdRe[pairIdx] += (int64_t)(xRe[antIdx] * xRe[i]) + (int64_t)(xIm[antIdx] * xIm[i]);
+                sumProdIm[pairIdx] += (int64_t)(xIm[antIdx] * xRe[i]) - (int64_t)(xRe[antIdx] * xIm[i]);
+                pairIdx++;
+            }
+        }
+    }
+
+    scale = _rcpsp((float)nChirps);
+    scale = scale * (2.f - (float)nChirps * scale);
+    scale = scale * (2.f - (float)nChirps * scale);
+
+    if (clutterRemovalFlag)
+    {
+        for (antIdx = 0; antIdx < nRxAntTotal; antIdx++)
+        {
+            static_information[antIdx].real = (float)sumRe[antIdx] * scale;
+            static_information[antIdx].imag = (float)sumIm[antIdx] * scale;
+        }
+        scale = scale * scale;
+    }
+
+    /* Rn estimation, with the rank-one mean correction done exactly in integers */
+    diagSum = 0.f;
+    pairIdx = 0;
+    for (antIdx = 0; antIdx < nRxAnt; antIdx++)
+    {
+        for (i = antIdx; i < nRxAnt; i++)
+        {
+            llRe = sumProdRe[pairIdx];
+            llIm = sumProdIm[pairIdx];
+            pairIdx++;
+            if (clutterRemovalFlag)
+            {
+                int64_t sum1Re = sumRe[virtAntInd2Proc[antIdx]];
+                int64_t sum1Im = sumIm[virtAntInd2Proc[antIdx]];
+                int64_t sum2Re = sumRe[virtAntInd2Proc[i]];
+                int64_t sum2Im = sumIm[virtAntInd2Proc[i]];
+
+                llRe = (int64_t)nChirps * llRe - (sum1Re * sum2Re + sum1Im * sum2Im);
+                llIm = (int64_t)nChirps * llIm - (sum1Im * sum2Re - sum1Re * sum2Im);
+            }
+            ftempRe = (float)llRe * scale;
+            ftempIm = (float)llIm * scale;
+
+            if (i == antIdx)
+            {
+                Rn[antIdx * nRxAnt + antIdx].real = ftempRe;
+                Rn[antIdx * nRxAnt + antIdx].imag = 0.f;
+                diagSum += ftempRe;
+            }
+            else
+            {
+                Rn[i * nRxAnt + antIdx].real = ftempRe;
+                Rn[i * nRxAnt + antIdx].imag = ftempIm;
+                Rn[antIdx * nRxAnt + i].real = ftempRe;
+                Rn[antIdx * nRxAnt + i].imag = -ftempIm;
+            }
+        }
+    }
+
+    if (invFlag)
+    {
+        if (nRxAnt == 8)
+            diagSum *= 0.125f;
+        else if (nRxAnt == 4)
+            diagSum *= 0.25f;
+        else if (nRxAnt == 12)
+            diagSum *= (1.f / 12.f);
+        else
+            diagSum *= _rcpsp((float)nRxAnt);
+
+        diagSum *= gamma;
+        for (i = 0; i < nRxAnt; i++)
+        {
+            Rn[i * nRxAnt + i].real = Rn[i * nRxAnt + i].real + diagSum;
+        }
+
+        /* matrix inversion */
+        MATRIX_cholesky_flp_inv(
+            Rn,
+            RnInv,
+            nRxAnt);
+    }
+    else
+    {
+        RnInv = Rn;
+    }
+
+    // only output the upper triangle for memory savings
+    rnIdx = 0;
+    for (i = 0; i < nRxAnt; i++)
+    {
+        _amem8_f2(&invRnMatrices[rnIdx++]) = _amem8_f2(&RnInv[i * nRxAnt + i]);
+        for (j = i + 1; j < nRxAnt; j++)
+        {
+            _amem8_f2(&invRnMatrices[rnIdx++]) = _amem8_f2(&RnInv[i * nRxAnt + j]);
+        }
+    }
+}
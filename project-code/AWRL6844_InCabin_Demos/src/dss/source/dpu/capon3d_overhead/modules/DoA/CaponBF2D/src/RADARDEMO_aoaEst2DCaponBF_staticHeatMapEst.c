@@ -116,7 +116,8 @@ void  RADARDEMO_aoaEstimationBFSinglePeak_static(
 	_nassert(staticAzimSearchLen >= 10 );
 	_nassert(staticElevSearchLen >= 6 );
 #endif
-	if (azimSteps != 1 )
+	// no stored azimuth-elevation steering vectors when they are generated from the azimuth and elevation tables
+	if ((azimSteps != 1 ) || (capon_handle->raHeatMap_handle->steeringVec == NULL))
 	{
 		for (azimIdx = 0; azimIdx < staticAzimSearchLen; azimIdx++ )
 		{
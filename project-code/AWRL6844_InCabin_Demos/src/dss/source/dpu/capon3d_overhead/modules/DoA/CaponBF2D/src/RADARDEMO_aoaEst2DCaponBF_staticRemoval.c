@@ -211,7 +211,7 @@ void RADARDEMO_aoaEst2DCaponBF_clutterRemoval(
         static_information++;
         itemp1 = _dspinth(acc);
         mean2  = _itoll(itemp1, itemp1);
-        output = (cplx16_t *)outputAntSamples;
+        output = (cplx16_t *)&outputAntSamples[antIdx * nChirps];
         for (chirpIdx = 0; chirpIdx < nChirps; chirpIdx += 4)
         {
             llinput1                      = _amem8(&input1[chirpIdx]);
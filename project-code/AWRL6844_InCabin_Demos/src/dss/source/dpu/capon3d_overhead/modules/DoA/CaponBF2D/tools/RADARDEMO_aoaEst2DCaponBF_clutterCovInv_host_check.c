@@ -0,0 +1,541 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check.c
+ *
+ *   @brief
+ *      Host check of the fused clutter removal and covariance estimation of the 2D Capon beamformer.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check
+ *
+ *  Runs RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv() and the path it replaces,
+ *  RADARDEMO_aoaEst2DCaponBF_clutterRemoval() into an antenna x chirp copy followed by
+ *  RADARDEMO_aoaEst2DCaponBF_covInv(), on synthetic range bins: static returns, moving targets and noise, 4 to 16
+ *  antennas in the cube, all or a subset of them processed, 8 to 256 chirps. The radar cube layout is the one of the
+ *  build, RADARDEMO_AOARADARCUDE_RNGCHIRPANT or RADARDEMO_AOARADARCUDE_RNGANTCHIRP.
+ *
+ *  Fused path against a double precision reference from the radar cube:
+ *   - covariance (invFlag 0), with and without clutter removal, within CHECK_TOL_COV of each value;
+ *   - inverse of the diagonally loaded covariance (invFlag 1), within CHECK_TOL_INV of its largest value;
+ *   - static_information within CHECK_TOL_COV.
+ *
+ *  Fused path against the old path, for inputs up to CHECK_OLD_MAX_AMP where the 16 bit saturating sums of the old
+ *  path do not clip: the old path subtracts the mean rounded to int16, m' = m - d, so its covariance is the exact one
+ *  plus the rank-one term d_c conj(d_r), |d| <= 0.5 per component. The check requires
+ *      |Rold[r][c] - Rnew[r][c] - d_c conj(d_r)| <= CHECK_TOL_OLD x sqrt(R[r][r] R[c][c]) + CHECK_TOL_ABS
+ *  and prints the largest |Rold - Rnew|: at most 0.5 from the rounding, plus the float rounding of large values. The
+ *  inverses of the two paths are compared for information only: on range bins with a noise of a few LSB, the rounding
+ *  term is of the order of the noise covariance and changes the inverse by tens of percent. The old covariance is read
+ *  from its scratch: with invFlag 0, covInv() writes its RnInv scratch, not Rn, to the output.
+ *
+ *  Inputs up to full scale are checked for the fused path only, the largest deviation of the old path is printed.
+ *
+ *  MATRIX_cholesky_flp_inv() is a double precision Gauss-Jordan inversion in the check, the same for both paths.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src/RADARDEMO_aoaEst2DCaponBF_priv.h>
+
+#define CHECK_PI                (3.141592653589793)
+#define CHECK_MAX_ANT           (16)
+#define CHECK_MAX_CHIRPS        (256)
+
+/* Fused path against the reference: relative to each value, and absolute */
+#define CHECK_TOL_COV           (1e-6)
+#define CHECK_TOL_ABS           (1e-4)
+/* Inverse against the reference, relative to its largest value */
+#define CHECK_TOL_INV           (1e-4)
+/* Old path against the fused one once the int16 rounding term is removed, relative to sqrt(R[r][r] R[c][c]) */
+#define CHECK_TOL_OLD           (1e-5)
+/* Largest input component of the old path comparison: sums of 4 chirps fit in 16 bits */
+#define CHECK_OLD_MAX_AMP       (8000)
+
+static uint32_t gCheckSeed = 1U;
+
+static int32_t Check_rand(int32_t range)
+{
+    gCheckSeed = gCheckSeed * 1103515245U + 12345U;
+    return (int32_t)((gCheckSeed >> 8) % (uint32_t)range);
+}
+
+static double Check_uniform(void)
+{
+    return (double)Check_rand(1 << 20) / (double)(1 << 20);
+}
+
+/* Buffers of one range bin */
+static cplx16_t gCheckCube[CHECK_MAX_CHIRPS * CHECK_MAX_ANT] __attribute__((aligned(8)));
+static cplx16_t gCheckWOstatic[CHECK_MAX_CHIRPS * CHECK_MAX_ANT] __attribute__((aligned(8)));
+static int32_t  gCheckScratchOld[4 * CHECK_MAX_ANT * CHECK_MAX_ANT] __attribute__((aligned(8)));
+static int32_t  gCheckScratchNew[RADARDEMO_AOAEST2D_CLUTTERCOVINV_SCRATCHSIZE(CHECK_MAX_ANT, CHECK_MAX_ANT) / sizeof(int32_t)] __attribute__((aligned(8)));
+static cplxf_t  gCheckOutOld[CHECK_MAX_ANT * (CHECK_MAX_ANT + 1) / 2] __attribute__((aligned(8)));
+static cplxf_t  gCheckOutNew[CHECK_MAX_ANT * (CHECK_MAX_ANT + 1) / 2] __attribute__((aligned(8)));
+static cplxf_t  gCheckStaticOld[CHECK_MAX_ANT] __attribute__((aligned(8)));
+static cplxf_t  gCheckStaticNew[CHECK_MAX_ANT] __attribute__((aligned(8)));
+
+/* Index of chirp c, antenna a in the radar cube layout of the build */
+static int32_t Check_cubeIdx(int32_t c, int32_t a, int32_t nRxAntTotal, int32_t nChirps)
+{
+#ifdef RADARDEMO_AOARADARCUDE_RNGCHIRPANT
+    (void)nChirps;
+    return (c * nRxAntTotal + a);
+#else
+    (void)nRxAntTotal;
+    return (a * nChirps + c);
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Host stand-in of MATRIX_cholesky_flp_inv(): inverse of the n x n Hermitian matrix A by Gauss-Jordan
+ *      elimination in double precision.
+ */
+void MATRIX_cholesky_flp_inv(cplxf_t *A, cplxf_t *Ap, int32_t n)
+{
+    double  m[CHECK_MAX_ANT][2 * CHECK_MAX_ANT][2], pr, pi, d, fr, fi, tr, ti;
+    int32_t i, j, k;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            m[i][j][0]     = A[i * n + j].real;
+            m[i][j][1]     = A[i * n + j].imag;
+            m[i][n + j][0] = (i == j) ? 1.0 : 0.0;
+            m[i][n + j][1] = 0.0;
+        }
+    }
+    for (k = 0; k < n; k++)
+    {
+        /* positive definite: no pivoting */
+        d  = m[k][k][0] * m[k][k][0] + m[k][k][1] * m[k][k][1];
+        pr = m[k][k][0] / d;
+        pi = -m[k][k][1] / d;
+        for (j = 0; j < 2 * n; j++)
+        {
+            tr         = m[k][j][0] * pr - m[k][j][1] * pi;
+            ti         = m[k][j][0] * pi + m[k][j][1] * pr;
+            m[k][j][0] = tr;
+            m[k][j][1] = ti;
+        }
+        for (i = 0; i < n; i++)
+        {
+            if (i == k)
+                continue;
+            fr = m[i][k][0];
+            fi = m[i][k][1];
+            for (j = 0; j < 2 * n; j++)
+            {
+                m[i][j][0] -= fr * m[k][j][0] - fi * m[k][j][1];
+                m[i][j][1] -= fr * m[k][j][1] + fi * m[k][j][0];
+            }
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            Ap[i * n + j].real = (float)m[i][n + j][0];
+            Ap[i * n + j].imag = (float)m[i][n + j][1];
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function fills the radar cube with one range bin: a static return per antenna, up to 3 moving targets
+ *      with their own Doppler and angle, and noise, rounded and clipped to maxAmp.
+ */
+static void Check_scene(int32_t nRxAntTotal, int32_t nChirps, int32_t maxAmp)
+{
+    double  staticRe[CHECK_MAX_ANT], staticIm[CHECK_MAX_ANT], amp[3], dopp[3], phase[3], spat[3];
+    double  re, im, staticAmp, noise;
+    int32_t a, c, t, numTargets;
+
+    staticAmp  = maxAmp * (Check_rand(2) ? 0.6 * Check_uniform() : 0.02 * Check_uniform());
+    noise      = 1.0 + maxAmp * 0.002 * Check_uniform();
+    numTargets = Check_rand(4);
+    for (a = 0; a < nRxAntTotal; a++)
+    {
+        staticRe[a] = staticAmp * (2.0 * Check_uniform() - 1.0);
+        staticIm[a] = staticAmp * (2.0 * Check_uniform() - 1.0);
+    }
+    for (t = 0; t < numTargets; t++)
+    {
+        amp[t]   = maxAmp * 0.3 * Check_uniform();
+        dopp[t]  = 2.0 * CHECK_PI * (Check_uniform() - 0.5);
+        phase[t] = 2.0 * CHECK_PI * Check_uniform();
+        spat[t]  = CHECK_PI * (2.0 * Check_uniform() - 1.0);
+    }
+    for (c = 0; c < nChirps; c++)
+    {
+        for (a = 0; a < nRxAntTotal; a++)
+        {
+            re = staticRe[a] + noise * (2.0 * Check_uniform() - 1.0);
+            im = staticIm[a] + noise * (2.0 * Check_uniform() - 1.0);
+            for (t = 0; t < numTargets; t++)
+            {
+                re += amp[t] * cos(dopp[t] * c + spat[t] * a + phase[t]);
+                im += amp[t] * sin(dopp[t] * c + spat[t] * a + phase[t]);
+            }
+            re = fmin(fmax(rint(re), -maxAmp), maxAmp);
+            im = fmin(fmax(rint(im), -maxAmp), maxAmp);
+            gCheckCube[Check_cubeIdx(c, a, nRxAntTotal, nChirps)].real = (int16_t)re;
+            gCheckCube[Check_cubeIdx(c, a, nRxAntTotal, nChirps)].imag = (int16_t)im;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function computes in double precision the mean of every antenna, and the covariance
+ *      R[r][c] = mean over the chirps of x_c conj(x_r) of the processed antennas, of the mean removed samples if
+ *      clutterRemovalFlag is set.
+ */
+static void Check_reference(int32_t clutterRemovalFlag, int32_t nRxAnt, int32_t nRxAntTotal, int32_t nChirps,
+                            const uint8_t *virtAntInd2Proc, double meanRe[], double meanIm[],
+                            double covRe[][CHECK_MAX_ANT], double covIm[][CHECK_MAX_ANT])
+{
+    double  xrRe, xrIm, xcRe, xcIm;
+    int32_t a, c, r, k;
+
+    for (a = 0; a < nRxAntTotal; a++)
+    {
+        meanRe[a] = 0.0;
+        meanIm[a] = 0.0;
+        for (k = 0; k < nChirps; k++)
+        {
+            meanRe[a] += gCheckCube[Check_cubeIdx(k, a, nRxAntTotal, nChirps)].real;
+            meanIm[a] += gCheckCube[Check_cubeIdx(k, a, nRxAntTotal, nChirps)].imag;
+        }
+        meanRe[a] /= nChirps;
+        meanIm[a] /= nChirps;
+    }
+    for (r = 0; r < nRxAnt; r++)
+    {
+        for (c = 0; c < nRxAnt; c++)
+        {
+            covRe[r][c] = 0.0;
+            covIm[r][c] = 0.0;
+            for (k = 0; k < nChirps; k++)
+            {
+                xrRe = gCheckCube[Check_cubeIdx(k, virtAntInd2Proc[r], nRxAntTotal, nChirps)].real;
+                xrIm = gCheckCube[Check_cubeIdx(k, virtAntInd2Proc[r], nRxAntTotal, nChirps)].imag;
+                xcRe = gCheckCube[Check_cubeIdx(k, virtAntInd2Proc[c], nRxAntTotal, nChirps)].real;
+                xcIm = gCheckCube[Check_cubeIdx(k, virtAntInd2Proc[c], nRxAntTotal, nChirps)].imag;
+                if (clutterRemovalFlag)
+                {
+                    xrRe -= meanRe[virtAntInd2Proc[r]];
+                    xrIm -= meanIm[virtAntInd2Proc[r]];
+                    xcRe -= meanRe[virtAntInd2Proc[c]];
+                    xcIm -= meanIm[virtAntInd2Proc[c]];
+                }
+                covRe[r][c] += xcRe * xrRe + xcIm * xrIm;
+                covIm[r][c] += xcIm * xrRe - xcRe * xrIm;
+            }
+            covRe[r][c] /= nChirps;
+            covIm[r][c] /= nChirps;
+        }
+    }
+}
+
+/* Counters of one run of the checks */
+typedef struct
+{
+    int32_t numCases;
+    int32_t numFail;
+    int32_t numOldCases;
+    double  maxCovErr;      /* fused covariance against the reference, relative to the tolerance */
+    double  maxInvErr;      /* fused inverse against the reference, relative to its largest value */
+    double  maxOldErr;      /* old against fused minus the rounding term, relative to sqrt(R[r][r] R[c][c]) */
+    double  maxOldDiff;     /* largest |Rold - Rnew| */
+    double  maxOldInvDiff;  /* largest difference of the inverses, relative to the largest value */
+} Check_stats;
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs one range bin through the fused and the old path, for invFlag 0 and 1 and clutter removal
+ *      on and off, and checks them. With oldPath 0 the old path is run for information only.
+ *
+ *  @retval
+ *      Number of failures
+ */
+static int32_t Check_case(int32_t nRxAnt, int32_t nRxAntTotal, int32_t nChirps, const uint8_t *virtAntInd2Proc,
+                          float gamma, int32_t oldPath, Check_stats *stats)
+{
+    static double meanRe[CHECK_MAX_ANT], meanIm[CHECK_MAX_ANT];
+    static double covRe[CHECK_MAX_ANT][CHECK_MAX_ANT], covIm[CHECK_MAX_ANT][CHECK_MAX_ANT];
+    cplxf_t      *RnOld = (cplxf_t *)gCheckScratchOld, *RnNew = (cplxf_t *)gCheckScratchNew;
+    cplxf_t       Rload[CHECK_MAX_ANT * CHECK_MAX_ANT], RinvRef[CHECK_MAX_ANT * CHECK_MAX_ANT];
+    double        dRe[CHECK_MAX_ANT], dIm[CHECK_MAX_ANT], err, tol, diagSum, maxInv = 1.0, eRe, eIm;
+    int32_t       clutter, invFlag, r, c, idx, numFail = 0;
+    uint8_t       inv;
+
+    for (clutter = 0; clutter <= 1; clutter++)
+    {
+        Check_reference(clutter, nRxAnt, nRxAntTotal, nChirps, virtAntInd2Proc, meanRe, meanIm, covRe, covIm);
+        for (invFlag = 0; invFlag <= 1; invFlag++)
+        {
+            inv = (uint8_t)invFlag;
+            memset(gCheckStaticNew, 0, sizeof(gCheckStaticNew));
+            RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv(inv, (uint8_t)clutter, gamma, nRxAnt, nRxAntTotal, nChirps,
+                                                           gCheckScratchNew, (uint8_t *)virtAntInd2Proc, gCheckCube,
+                                                           gCheckStaticNew, gCheckOutNew);
+            stats->numCases++;
+
+            if (invFlag == 0)
+            {
+                /* covariance, output and scratch */
+                idx = 0;
+                for (r = 0; r < nRxAnt; r++)
+                {
+                    for (c = 0; c < nRxAnt; c++)
+                    {
+                        tol = CHECK_TOL_COV * hypot(covRe[r][c], covIm[r][c]) + CHECK_TOL_ABS;
+                        err = hypot(RnNew[r * nRxAnt + c].real - covRe[r][c], RnNew[r * nRxAnt + c].imag - covIm[r][c]);
+                        if (c >= r)
+                        {
+                            err = fmax(err, hypot(gCheckOutNew[idx].real - covRe[r][c], gCheckOutNew[idx].imag - covIm[r][c]));
+                            idx++;
+                        }
+                        stats->maxCovErr = fmax(stats->maxCovErr, err / tol);
+                        if (err > tol)
+                        {
+                            if (stats->numFail + numFail == 0)
+                                printf("FAIL covariance: %d of %d antennas, %d chirps, clutter %d, R[%d][%d] = %g %g, "
+                                       "reference %g %g\n", nRxAnt, nRxAntTotal, nChirps, clutter, r, c,
+                                       RnNew[r * nRxAnt + c].real, RnNew[r * nRxAnt + c].imag, covRe[r][c], covIm[r][c]);
+                            numFail++;
+                        }
+                    }
+                }
+                if (clutter)
+                {
+                    for (r = 0; r < nRxAntTotal; r++)
+                    {
+                        err = hypot(gCheckStaticNew[r].real - meanRe[r], gCheckStaticNew[r].imag - meanIm[r]);
+                        if (err > CHECK_TOL_COV * hypot(meanRe[r], meanIm[r]) + CHECK_TOL_ABS)
+                        {
+                            if (stats->numFail + numFail == 0)
+                                printf("FAIL static_information[%d] = %g %g, reference %g %g\n", r,
+                                       gCheckStaticNew[r].real, gCheckStaticNew[r].imag, meanRe[r], meanIm[r]);
+                            numFail++;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                /* inverse of the loaded reference covariance */
+                diagSum = 0.0;
+                for (r = 0; r < nRxAnt; r++)
+                    diagSum += covRe[r][r];
+                for (r = 0; r < nRxAnt; r++)
+                {
+                    for (c = 0; c < nRxAnt; c++)
+                    {
+                        Rload[r * nRxAnt + c].real = (float)(covRe[r][c] + ((r == c) ? gamma * diagSum / nRxAnt : 0.0));
+                        Rload[r * nRxAnt + c].imag = (float)covIm[r][c];
+                    }
+                }
+                MATRIX_cholesky_flp_inv(Rload, RinvRef, nRxAnt);
+                maxInv = 0.0;
+                for (r = 0; r < nRxAnt * nRxAnt; r++)
+                    maxInv = fmax(maxInv, hypot(RinvRef[r].real, RinvRef[r].imag));
+                idx = 0;
+                for (r = 0; r < nRxAnt; r++)
+                {
+                    for (c = r; c < nRxAnt; c++, idx++)
+                    {
+                        err = hypot(gCheckOutNew[idx].real - RinvRef[r * nRxAnt + c].real,
+                                    gCheckOutNew[idx].imag - RinvRef[r * nRxAnt + c].imag) / maxInv;
+                        stats->maxInvErr = fmax(stats->maxInvErr, err);
+                        if (err > CHECK_TOL_INV)
+                        {
+                            if (stats->numFail + numFail == 0)
+                                printf("FAIL inverse: %d of %d antennas, %d chirps, clutter %d, Rinv[%d][%d] = %g %g, "
+                                       "reference %g %g\n", nRxAnt, nRxAntTotal, nChirps, clutter, r, c,
+                                       gCheckOutNew[idx].real, gCheckOutNew[idx].imag,
+                                       RinvRef[r * nRxAnt + c].real, RinvRef[r * nRxAnt + c].imag);
+                            numFail++;
+                        }
+                    }
+                }
+            }
+
+            /* old path: clutter removal into the antenna x chirp copy, then covariance from the copy */
+            if (!clutter)
+                continue;
+            memset(gCheckScratchOld, 0, sizeof(gCheckScratchOld));
+            RADARDEMO_aoaEst2DCaponBF_clutterRemoval(nRxAntTotal, nChirps, gCheckCube, gCheckWOstatic, gCheckStaticOld);
+            RADARDEMO_aoaEst2DCaponBF_covInv(inv, gamma, nRxAnt, nChirps, gCheckScratchOld, (uint8_t *)virtAntInd2Proc,
+                                             gCheckWOstatic, gCheckOutOld);
+            if (invFlag == 1)
+            {
+                idx = 0;
+                for (r = 0; r < nRxAnt; r++)
+                    for (c = r; c < nRxAnt; c++, idx++)
+                        stats->maxOldInvDiff = fmax(stats->maxOldInvDiff,
+                                                    hypot(gCheckOutOld[idx].real - gCheckOutNew[idx].real,
+                                                          gCheckOutOld[idx].imag - gCheckOutNew[idx].imag) / maxInv);
+                continue;
+            }
+            if (oldPath)
+                stats->numOldCases++;
+
+            /* rounding of the mean by the old path: d = m - round(m) */
+            for (r = 0; r < nRxAnt; r++)
+            {
+                dRe[r] = meanRe[virtAntInd2Proc[r]] - rint(gCheckStaticOld[virtAntInd2Proc[r]].real);
+                dIm[r] = meanIm[virtAntInd2Proc[r]] - rint(gCheckStaticOld[virtAntInd2Proc[r]].imag);
+            }
+            for (r = 0; r < nRxAnt; r++)
+            {
+                for (c = 0; c < nRxAnt; c++)
+                {
+                    eRe = RnOld[r * nRxAnt + c].real - RnNew[r * nRxAnt + c].real;
+                    eIm = RnOld[r * nRxAnt + c].imag - RnNew[r * nRxAnt + c].imag;
+                    stats->maxOldDiff = fmax(stats->maxOldDiff, hypot(eRe, eIm));
+                    eRe -= dRe[c] * dRe[r] + dIm[c] * dIm[r];
+                    eIm -= dIm[c] * dRe[r] - dRe[c] * dIm[r];
+                    tol  = sqrt(covRe[r][r] * covRe[c][c]);
+                    err  = hypot(eRe, eIm) / (tol + CHECK_TOL_ABS / CHECK_TOL_OLD);
+                    if (!oldPath)
+                        continue;
+                    stats->maxOldErr = fmax(stats->maxOldErr, err);
+                    if (err > CHECK_TOL_OLD)
+                    {
+                        if (stats->numFail + numFail == 0)
+                            printf("FAIL old path: %d of %d antennas, %d chirps, Rold[%d][%d] = %g %g, Rnew %g %g, "
+                                   "rounding term %g %g\n", nRxAnt, nRxAntTotal, nChirps, r, c,
+                                   RnOld[r * nRxAnt + c].real, RnOld[r * nRxAnt + c].imag, RnNew[r * nRxAnt + c].real,
+                                   RnNew[r * nRxAnt + c].imag, dRe[c] * dRe[r] + dIm[c] * dIm[r],
+                                   dIm[c] * dRe[r] - dRe[c] * dIm[r]);
+                        numFail++;
+                    }
+                }
+                if (oldPath)
+                {
+                    err = hypot(gCheckStaticOld[virtAntInd2Proc[r]].real - gCheckStaticNew[virtAntInd2Proc[r]].real,
+                                gCheckStaticOld[virtAntInd2Proc[r]].imag - gCheckStaticNew[virtAntInd2Proc[r]].imag);
+                    if (err > CHECK_TOL_COV * hypot(meanRe[virtAntInd2Proc[r]], meanIm[virtAntInd2Proc[r]]) + CHECK_TOL_ABS)
+                    {
+                        if (stats->numFail + numFail == 0)
+                            printf("FAIL old path static_information[%d] = %g %g, fused %g %g\n", virtAntInd2Proc[r],
+                                   gCheckStaticOld[virtAntInd2Proc[r]].real, gCheckStaticOld[virtAntInd2Proc[r]].imag,
+                                   gCheckStaticNew[virtAntInd2Proc[r]].real, gCheckStaticNew[virtAntInd2Proc[r]].imag);
+                        numFail++;
+                    }
+                }
+            }
+        }
+    }
+    stats->numFail += numFail;
+    return (numFail);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs numScenes range bins for every antenna and chirp configuration, with inputs up to maxAmp.
+ */
+static void Check_run(int32_t numScenes, int32_t maxAmp, int32_t oldPath, Check_stats *stats)
+{
+    static const int32_t antTotal[] = {4, 8, 12, 16};
+    uint8_t              virtAntInd2Proc[CHECK_MAX_ANT];
+    int32_t              t, nRxAnt, nRxAntTotal, nChirps, s, a, subset;
+    float                gamma;
+
+    for (t = 0; t < (int32_t)(sizeof(antTotal) / sizeof(antTotal[0])); t++)
+    {
+        nRxAntTotal = antTotal[t];
+        for (nChirps = 8; nChirps <= CHECK_MAX_CHIRPS; nChirps *= 2)
+        {
+            for (subset = 0; subset <= (nRxAntTotal > 4); subset++)
+            {
+                /* all the antennas, or every other group of 4 of them as for the azimuth only heatmap */
+                nRxAnt = 0;
+                for (a = 0; a < nRxAntTotal; a++)
+                    if (!subset || ((a >> 2) & 1) == 0)
+                        virtAntInd2Proc[nRxAnt++] = (uint8_t)a;
+                for (s = 0; s < numScenes; s++)
+                {
+                    gamma = (s & 1) ? 0.1f : 0.03f;
+                    Check_scene(nRxAntTotal, nChirps, maxAmp);
+                    Check_case(nRxAnt, nRxAntTotal, nChirps, virtAntInd2Proc, gamma, oldPath, stats);
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Check_stats stats, full;
+    int32_t     numScenes = (argc > 1) ? atoi(argv[1]) : 20;
+
+#ifdef RADARDEMO_AOARADARCUDE_RNGCHIRPANT
+    printf("radar cube layout RNGCHIRPANT\n");
+#else
+    printf("radar cube layout RNGANTCHIRP\n");
+#endif
+    memset(&stats, 0, sizeof(stats));
+    Check_run(numScenes, CHECK_OLD_MAX_AMP, 1, &stats);
+    printf("inputs up to %d: %d cases, %d failures\n", CHECK_OLD_MAX_AMP, stats.numCases, stats.numFail);
+    printf("  fused covariance max error %.2f of the tolerance, inverse max error %.1e of its largest value\n",
+           stats.maxCovErr, stats.maxInvErr);
+    printf("  old path on %d cases: max |Rold - Rnew| %.3f, after the int16 rounding term %.1e of sqrt(R[r][r] R[c][c]), "
+           "inverses differ by up to %.1e of the largest value\n", stats.numOldCases, stats.maxOldDiff, stats.maxOldErr,
+           stats.maxOldInvDiff);
+
+    memset(&full, 0, sizeof(full));
+    Check_run(numScenes / 4 + 1, 32767, 0, &full);
+    printf("inputs up to full scale: %d cases, %d failures\n", full.numCases, full.numFail);
+    printf("  fused covariance max error %.2f of the tolerance, inverse max error %.1e of its largest value\n",
+           full.maxCovErr, full.maxInvErr);
+    printf("  old path, for information: max |Rold - Rnew| %.3g\n", full.maxOldDiff);
+
+    printf("%s\n", (stats.numFail + full.numFail) == 0 ? "PASS" : "FAIL");
+    return ((stats.numFail + full.numFail) == 0 ? 0 : 1);
+}
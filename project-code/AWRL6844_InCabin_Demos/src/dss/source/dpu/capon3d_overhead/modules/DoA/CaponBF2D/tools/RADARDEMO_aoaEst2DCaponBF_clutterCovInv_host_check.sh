@@ -0,0 +1,79 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the fused clutter removal and covariance estimation on the host
+#
+#   RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check.sh [numScenes]
+#
+# RADARDEMO_aoaEst2DCaponBF_rnEstInv.c and RADARDEMO_aoaEst2DCaponBF_staticRemoval.c are built as they are, with the
+# C66x intrinsics emulated by radar_c66x_host_shim.h, against a host header made of the covariance part of
+# RADARDEMO_aoaEst2DCaponBF_priv.h. The check is built and run for both radar cube layouts.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+API_DIR="$TOOLS_DIR/../api"
+DSS_DIR="$TOOLS_DIR/../../../../../../.."
+BUILD_DIR=${BUILD_DIR:-./RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check_build}
+CC=${CC:-cc}
+
+for LAYOUT in RNGCHIRPANT RNGANTCHIRP
+do
+    PRIV_DIR="$BUILD_DIR/$LAYOUT/inc/source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src"
+    mkdir -p "$PRIV_DIR"
+    : > "$BUILD_DIR/$LAYOUT/inc/c6x.h"
+    {
+        echo '#pragma once'
+        echo '#include <source/common/swpform.h>'
+        echo '#include <math.h>'
+        echo "#define RADARDEMO_AOARADARCUDE_$LAYOUT"
+        grep '^#define MAX_VIRTUAL_RXANT' "$API_DIR/RADARDEMO_aoaEst2DCaponBF.h"
+        echo '#define SYS_COMMON_NUM_TX_ANTENNAS 4'
+        echo '#define SYS_COMMON_NUM_RX_CHANNEL 4'
+        echo 'void MATRIX_cholesky_flp_inv(cplxf_t *A, cplxf_t *Ap, int32_t n);'
+        sed -n '/^#ifndef _TMS320C6600$/,/^#endif/{p;/^#endif/q;}' "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+        awk '/^extern void[[:space:]]*RADARDEMO_aoaEst2DCaponBF_clutterRemoval\(/ { on = 1 }
+             on { print }
+             /RADARDEMO_aoaEst2DCaponBF_clutterRemovalCovInv\(/ { last = 1 }
+             on && last && /invRnMatrices\);/ { exit }' "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+    } > "$PRIV_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+
+    $CC -O2 -Wall -Werror -std=gnu99 -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 -Wno-unknown-pragmas \
+        -include "$TOOLS_DIR/../../../utilities/tools/radar_c66x_host_shim.h" -I "$BUILD_DIR/$LAYOUT/inc" -I "$DSS_DIR" \
+        -o "$BUILD_DIR/$LAYOUT/RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check" \
+        "$TOOLS_DIR/RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check.c" \
+        "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_rnEstInv.c" "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_staticRemoval.c" -lm
+    "$BUILD_DIR/$LAYOUT/RADARDEMO_aoaEst2DCaponBF_clutterCovInv_host_check" "$@"
+done
@@ -0,0 +1,519 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check.c
+ *
+ *   @brief
+ *      Host check of the batched Doppler estimation of the 2D Capon angle estimates.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check [timing]
+ *
+ *  Bit exactness: runs the Doppler estimation of RADARDEMO_aoaEst2DCaponBF_run() on random radar cube slices, for 4
+ *  to 16 antennas, Doppler FFT sizes 16 to 256 and up to RADARDEMO_AOAEST2D_DOPBATCH_MAXDET detections of 1, 9 or 25
+ *  angle estimates: the slice loaded once, the beams beamformed by RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch() in
+ *  passes of the size set by RADARDEMO_aoaEst2DCaponBF_create(), and in passes of every other size, then the FFT and
+ *  RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(). Each beamforming output must equal, bit for bit, the one of the per
+ *  beam RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice() and the one of the per beam path before the slice,
+ *  RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval() on the antenna major chirps. The spectrum and the Doppler
+ *  index must equal those of the scalar loop of the per beam path, which keeps the first maximum. The spectrum search
+ *  is also run on FFT outputs of a few values, where most maxima are ties.
+ *
+ *  Scratch: the pass size of RADARDEMO_aoaEst2DCaponBF_create(), run as it is, must keep the Doppler scratch within
+ *  RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH for all the FFT sizes and numbers of estimates, with at least one beam. The
+ *  check prints the pass sizes of the zoom-in with 9 estimates per detection.
+ *
+ *  timing: also measures the beamforming of the batched Doppler estimation of the zoom-in, 9 estimates per
+ *  detection, against the per beam beamforming, on the host: full outputs of 9 estimates per detection, and the queue
+ *  of the shipped configurations, whose peakExpRelThr of 1 keeps 1 estimate per detection, so that the outputs take
+ *  (RADARDEMO_AOAEST2D_DOPBATCH_MAXDET - 1) * 9 + 1 detections of a range bin. The exit status is 0 if all the checks pass.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src/RADARDEMO_aoaEst2DCaponBF_priv.h>
+
+#define CHECK_PI                (3.141592653589793)
+#define CHECK_MAX_FFT           (256)
+#define CHECK_MAX_ANT           (16)
+#define CHECK_MAX_BEAMS         (RADARDEMO_AOAEST2D_DOPBATCH_MAXDET * 25)
+
+/* The fields of the module handle the pass size is computed from */
+typedef struct
+{
+    struct Check_aeHandle
+    {
+        uint8_t zoomInFlag;
+    } *aeEstimation_handle;
+    struct Check_doppHandle
+    {
+        uint16_t dopplerFFTSize;
+    } *doppBining_handle;
+    uint8_t  useCFAR4DopDet;
+    uint16_t maxNumBeams;
+    uint16_t dopNumBeamsPerPass;
+    uint16_t dopQueueNumDet;
+    uint16_t dopQueueNumBeams;
+    uint16_t dopQueueRangeIndx;
+} Check_handle;
+
+/* Check_passSize(): the pass size code of RADARDEMO_aoaEst2DCaponBF_create() */
+#include "RADARDEMO_aoaEst2DCaponBF_dopBatch_passSize.h"
+
+/**
+ *  @b Description
+ *  @n
+ *      Host stand-in of the DSPLIB FFT: radix-2 decimation in time, natural order output. The twiddle table is not
+ *      used, the stand-in keeps its own table per size.
+ */
+void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max)
+{
+    static float tw[CHECK_MAX_FFT];
+    static int   twSize;
+    int          i, j, k, len, half, step;
+    float        re, im, tr, ti;
+
+    (void)ptr_w;
+    (void)brev;
+    (void)n_min;
+    (void)offset;
+    (void)n_max;
+    if (twSize != N)
+    {
+        for (i = 0; i < N / 2; i++)
+        {
+            tw[2 * i]     = (float)cos(2.0 * CHECK_PI * i / N);
+            tw[2 * i + 1] = (float)-sin(2.0 * CHECK_PI * i / N);
+        }
+        twSize = N;
+    }
+    for (i = 0, j = 0; i < N; i++)
+    {
+        ptr_y[2 * j]     = ptr_x[2 * i];
+        ptr_y[2 * j + 1] = ptr_x[2 * i + 1];
+        for (k = N >> 1; (j & k) != 0; k >>= 1)
+            j ^= k;
+        j |= k;
+    }
+    for (len = 2; len <= N; len <<= 1)
+    {
+        half = len >> 1;
+        step = N / len;
+        for (i = 0; i < N; i += len)
+        {
+            for (j = 0; j < half; j++)
+            {
+                float *a = &ptr_y[2 * (i + j)], *b = &ptr_y[2 * (i + j + half)];
+
+                re    = tw[2 * j * step];
+                im    = tw[2 * j * step + 1];
+                tr    = b[0] * re - b[1] * im;
+                ti    = b[0] * im + b[1] * re;
+                b[0]  = a[0] - tr;
+                b[1]  = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+static uint32_t gCheckSeed = 1;
+
+static int32_t Check_rand(int32_t range)
+{
+    gCheckSeed = gCheckSeed * 1103515245U + 12345U;
+    return (int32_t)((gCheckSeed >> 8) % (uint32_t)range);
+}
+
+static float Check_randf(void)
+{
+    return (float)(Check_rand(2000001) - 1000000) * 1e-3f;
+}
+
+/* Radar cube samples of one range bin, chirp major, and the same chirps antenna major */
+static cplx16_t gCheckCube[CHECK_MAX_FFT * CHECK_MAX_ANT];
+static cplx16_t gCheckCubeAnt[CHECK_MAX_FFT * CHECK_MAX_ANT];
+static cplxf_t  gCheckDc[CHECK_MAX_ANT];
+static cplxf_t  gCheckBw[CHECK_MAX_BEAMS * CHECK_MAX_ANT];
+static cplxf_t  gCheckSlice[CHECK_MAX_FFT * CHECK_MAX_ANT];
+/* Doppler scratch of the module, largest pass */
+static float    gCheckScratch[CHECK_MAX_BEAMS * 2 * CHECK_MAX_FFT + 3 * CHECK_MAX_FFT];
+/* Per beam references: beamforming output, spectrum and Doppler index */
+static float    gCheckRefBf[CHECK_MAX_BEAMS][2 * CHECK_MAX_FFT];
+static float    gCheckRefSpec[CHECK_MAX_BEAMS][CHECK_MAX_FFT];
+static int32_t  gCheckRefIdx[CHECK_MAX_BEAMS];
+static float    gCheckBf[2 * CHECK_MAX_FFT];
+
+/**
+ *  @b Description
+ *  @n
+ *      The Doppler spectrum and the first maximum of the per beam path before the batched estimation.
+ *
+ *  @param[in]  fftSize     Doppler FFT size
+ *  @param[in]  fftOutput   Doppler FFT output
+ *  @param[out] spectrum    Power spectrum
+ *
+ *  @retval
+ *      Index of the first maximum, 0 if the spectrum is all 0
+ */
+static int32_t Check_powMaxRef(int32_t fftSize, float *fftOutput, float *spectrum)
+{
+    __float2_t f2temp;
+    float      max, ftemp;
+    int32_t    i, index;
+
+    max   = 0.f;
+    index = 0;
+    for (i = 0; i < fftSize; i++)
+    {
+        f2temp      = _amem8_f2(&fftOutput[2 * i]);
+        f2temp      = _dmpysp(f2temp, f2temp);
+        ftemp       = _hif2(f2temp) + _lof2(f2temp);
+        spectrum[i] = ftemp;
+        if (ftemp > max)
+        {
+            max   = ftemp;
+            index = i;
+        }
+    }
+    return (index);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function fills the chirps of a range bin, the DC values and the beam filters with random values, and
+ *      computes the per beam references.
+ *
+ *  @param[in]  nRxAnt      Number of antennas
+ *  @param[in]  fftSize     Doppler FFT size, also the number of chirps
+ *  @param[in]  numBeams    Number of angle estimates
+ */
+static void Check_fill(int32_t nRxAnt, int32_t fftSize, int32_t numBeams)
+{
+    float   fftOut[2 * CHECK_MAX_FFT];
+    int32_t i, j;
+
+    for (i = 0; i < fftSize; i++)
+    {
+        for (j = 0; j < nRxAnt; j++)
+        {
+            gCheckCube[i * nRxAnt + j].real = (int16_t)(Check_rand(65536) - 32768);
+            gCheckCube[i * nRxAnt + j].imag = (int16_t)(Check_rand(65536) - 32768);
+            gCheckCubeAnt[j * fftSize + i]  = gCheckCube[i * nRxAnt + j];
+        }
+    }
+    for (j = 0; j < nRxAnt; j++)
+    {
+        gCheckDc[j].real = Check_randf();
+        gCheckDc[j].imag = Check_randf();
+    }
+    for (i = 0; i < numBeams * nRxAnt; i++)
+    {
+        gCheckBw[i].real = Check_randf() * 1e-3f;
+        gCheckBw[i].imag = Check_randf() * 1e-3f;
+    }
+    for (i = 0; i < numBeams; i++)
+    {
+        RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval(nRxAnt, fftSize, gCheckCubeAnt, &gCheckBw[i * nRxAnt],
+                                                           gCheckDc, gCheckRefBf[i]);
+        DSPF_sp_fftSPxSP(fftSize, gCheckRefBf[i], NULL, fftOut, NULL, 2, 0, fftSize);
+        gCheckRefIdx[i] = Check_powMaxRef(fftSize, fftOut, gCheckRefSpec[i]);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs the Doppler estimation of the step 1 and 3 of RADARDEMO_aoaEst2DCaponBF_run() with a pass
+ *      size and compares each beam with the references of Check_fill().
+ *
+ *  @param[in]  nRxAnt      Number of antennas
+ *  @param[in]  fftSize     Doppler FFT size
+ *  @param[in]  numBeams    Number of angle estimates
+ *  @param[in]  passSize    Beams beamformed per pass
+ *
+ *  @retval
+ *      Number of beams that differ
+ */
+static int32_t Check_run(int32_t nRxAnt, int32_t fftSize, int32_t numBeams, int32_t passSize)
+{
+    float   *bfOutput, *fftOutput, *spectrum;
+    int32_t  angleDetIdx, passIdx, index, numFail = 0;
+
+    bfOutput  = &gCheckScratch[0];
+    fftOutput = &gCheckScratch[2 * passSize * fftSize];
+    spectrum  = &fftOutput[2 * fftSize];
+
+    RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad(nRxAnt, fftSize, gCheckCube, gCheckDc, gCheckSlice);
+    for (angleDetIdx = 0; angleDetIdx < numBeams; angleDetIdx++)
+    {
+        passIdx = angleDetIdx % passSize;
+        if (passIdx == 0)
+        {
+            RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch(nRxAnt, fftSize,
+                    (numBeams - angleDetIdx < passSize) ? numBeams - angleDetIdx : passSize,
+                    gCheckSlice, &gCheckBw[angleDetIdx * nRxAnt], bfOutput);
+        }
+        RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice(nRxAnt, fftSize, gCheckSlice, &gCheckBw[angleDetIdx * nRxAnt],
+                                                      gCheckBf);
+        DSPF_sp_fftSPxSP(fftSize, &bfOutput[2 * passIdx * fftSize], NULL, fftOutput, NULL, 2, 0, fftSize);
+        RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(fftSize, fftOutput, spectrum, &index);
+
+        if ((memcmp(&bfOutput[2 * passIdx * fftSize], gCheckRefBf[angleDetIdx], 2 * fftSize * sizeof(float)) != 0) ||
+            (memcmp(gCheckBf, gCheckRefBf[angleDetIdx], 2 * fftSize * sizeof(float)) != 0) ||
+            (memcmp(spectrum, gCheckRefSpec[angleDetIdx], fftSize * sizeof(float)) != 0) ||
+            (index != gCheckRefIdx[angleDetIdx]))
+        {
+            if (numFail == 0)
+                printf("FAIL: %d antennas, FFT %d, %d beams, pass %d: beam %d differs, Doppler index %d, per beam %d\n",
+                       nRxAnt, fftSize, numBeams, passSize, angleDetIdx, index, gCheckRefIdx[angleDetIdx]);
+            numFail++;
+        }
+    }
+    return (numFail);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function compares RADARDEMO_aoaEst2DCaponBF_dopplerPowMax() with the scalar loop on FFT outputs of a few
+ *      values, so that most maxima are ties, and on an all 0 output.
+ *
+ *  @retval
+ *      Number of FFT outputs that differ
+ */
+static int32_t Check_powMaxTies(void)
+{
+    float   fftOut[2 * CHECK_MAX_FFT], spec[CHECK_MAX_FFT], refSpec[CHECK_MAX_FFT];
+    int32_t fftSize, trial, i, index, numFail = 0;
+
+    for (fftSize = 2; fftSize <= CHECK_MAX_FFT; fftSize <<= 1)
+    {
+        for (trial = 0; trial < 2000; trial++)
+        {
+            for (i = 0; i < 2 * fftSize; i++)
+                fftOut[i] = (trial == 0) ? 0.f : (float)(Check_rand(3) - 1);
+            RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(fftSize, fftOut, spec, &index);
+            if ((index != Check_powMaxRef(fftSize, fftOut, refSpec)) || (memcmp(spec, refSpec, fftSize * sizeof(float)) != 0))
+            {
+                if (numFail == 0)
+                    printf("FAIL: spectrum search with ties, FFT %d, Doppler index %d, scalar loop %d\n", fftSize,
+                           index, Check_powMaxRef(fftSize, fftOut, refSpec));
+                numFail++;
+            }
+        }
+    }
+    return (numFail);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs the pass size code of RADARDEMO_aoaEst2DCaponBF_create().
+ *
+ *  @param[in]  fftSize         Doppler FFT size
+ *  @param[in]  maxNumBeams     Angle estimates per detection
+ *  @param[in]  zoomInFlag      Zoom-in angle estimation
+ *  @param[in]  useCFAR4DopDet  CFAR Doppler detection
+ *
+ *  @retval
+ *      Beams beamformed per pass
+ */
+static int32_t Check_getPassSize(int32_t fftSize, int32_t maxNumBeams, int32_t zoomInFlag, int32_t useCFAR4DopDet)
+{
+    Check_handle            h;
+    struct Check_aeHandle   ae;
+    struct Check_doppHandle dopp;
+
+    memset(&h, 0, sizeof(h));
+    ae.zoomInFlag           = (uint8_t)zoomInFlag;
+    dopp.dopplerFFTSize     = (uint16_t)fftSize;
+    h.aeEstimation_handle   = &ae;
+    h.doppBining_handle     = &dopp;
+    h.useCFAR4DopDet        = (uint8_t)useCFAR4DopDet;
+    h.maxNumBeams           = (uint16_t)maxNumBeams;
+    Check_passSize(&h);
+    return (h.dopNumBeamsPerPass);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function checks the Doppler scratch of the pass sizes against RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH.
+ *
+ *  @retval
+ *      Number of configurations over the scratch or with no beam
+ */
+static int32_t Check_scratch(void)
+{
+    static const int32_t numEst[] = {1, 9, 25, 49, 27, 75};
+    int32_t fftSize, n, zoomInFlag, cfar, pass, queue, numFail = 0;
+
+    for (fftSize = 16; fftSize <= CHECK_MAX_FFT; fftSize <<= 1)
+    {
+        for (n = 0; n < (int32_t)(sizeof(numEst) / sizeof(numEst[0])); n++)
+        {
+            for (zoomInFlag = 0; zoomInFlag <= 1; zoomInFlag++)
+            {
+                for (cfar = 0; cfar <= 1; cfar++)
+                {
+                    pass  = Check_getPassSize(fftSize, numEst[n], zoomInFlag, cfar);
+                    queue = numEst[n] * ((zoomInFlag && !cfar) ? RADARDEMO_AOAEST2D_DOPBATCH_MAXDET : 1);
+                    if ((pass < 1) || (pass > queue) ||
+                        ((pass > 1) && (RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(pass, fftSize) > RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH)) ||
+                        ((pass > RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK) && (pass % RADARDEMO_AOAEST2D_DOPBF_BEAMBLOCK != 0)))
+                    {
+                        printf("FAIL: FFT %d, %d estimates, zoom-in %d, CFAR %d: %d beams per pass, %d bytes of scratch\n",
+                               fftSize, numEst[n], zoomInFlag, cfar, pass,
+                               (int32_t)RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(pass, fftSize));
+                        numFail++;
+                    }
+                }
+            }
+        }
+        pass = Check_getPassSize(fftSize, 9, 1, 0);
+        printf("FFT %3d, zoom-in with 9 estimates: %2d beams per pass, %4d bytes of scratch of %d, "
+               "%5d bytes for the 9 beams of a detection in one pass\n",
+               fftSize, pass, (int32_t)RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(pass, fftSize), RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH,
+               (int32_t)RADARDEMO_AOAEST2D_DOPPLER_SCRATCHSIZE(9, fftSize));
+    }
+    return (numFail);
+}
+
+static double Check_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function measures on the host the beamforming of a Doppler batch of the zoom-in, 9 estimates per
+ *      detection, in passes against one beam at a time.
+ */
+static void Check_timing(void)
+{
+    static const int32_t cfg[][3] = {{16, 32, 9 * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET}, {16, 64, 9 * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET},
+                                     {16, 128, 9 * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET}, {12, 64, 9 * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET},
+                                     {16, 32, 9 * (RADARDEMO_AOAEST2D_DOPBATCH_MAXDET - 1) + 1}, {16, 64, 9 * (RADARDEMO_AOAEST2D_DOPBATCH_MAXDET - 1) + 1}};
+    int32_t c, rep, angleDetIdx, nRxAnt, fftSize, numBeams, passSize, numRep = 2000;
+    double  t0, tBatch, tBeam;
+    volatile float sink = 0.f;
+
+    for (c = 0; c < (int32_t)(sizeof(cfg) / sizeof(cfg[0])); c++)
+    {
+        nRxAnt   = cfg[c][0];
+        fftSize  = cfg[c][1];
+        numBeams = cfg[c][2];
+        passSize = Check_getPassSize(fftSize, 9, 1, 0);
+        Check_fill(nRxAnt, fftSize, numBeams);
+        RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad(nRxAnt, fftSize, gCheckCube, gCheckDc, gCheckSlice);
+
+        t0 = Check_now();
+        for (rep = 0; rep < numRep; rep++)
+        {
+            for (angleDetIdx = 0; angleDetIdx < numBeams; angleDetIdx += passSize)
+            {
+                RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch(nRxAnt, fftSize,
+                        (numBeams - angleDetIdx < passSize) ? numBeams - angleDetIdx : passSize,
+                        gCheckSlice, &gCheckBw[angleDetIdx * nRxAnt], gCheckScratch);
+                sink += gCheckScratch[0];
+            }
+        }
+        tBatch = (Check_now() - t0) / numRep;
+
+        t0 = Check_now();
+        for (rep = 0; rep < numRep; rep++)
+        {
+            for (angleDetIdx = 0; angleDetIdx < numBeams; angleDetIdx++)
+            {
+                RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice(nRxAnt, fftSize, gCheckSlice,
+                                                              &gCheckBw[angleDetIdx * nRxAnt], gCheckScratch);
+                sink += gCheckScratch[0];
+            }
+        }
+        tBeam = (Check_now() - t0) / numRep;
+        printf("timing: %2d antennas, FFT %3d, %d beams: passes of %2d %8.0f ns, per beam %8.0f ns, %.2fx\n",
+               nRxAnt, fftSize, numBeams, passSize, tBatch, tBeam, tBeam / tBatch);
+    }
+    (void)sink;
+}
+
+int main(int argc, char **argv)
+{
+    static const int32_t antCfg[] = {4, 8, 12, 16};
+    static const int32_t estCfg[] = {1, 9, 25};
+    int32_t a, e, fftSize, numBeams, passSize, numCfg = 0, numFail = 0;
+
+    numFail += Check_scratch();
+
+    for (a = 0; a < (int32_t)(sizeof(antCfg) / sizeof(antCfg[0])); a++)
+    {
+        for (fftSize = 16; fftSize <= CHECK_MAX_FFT; fftSize <<= 1)
+        {
+            for (e = 0; e < (int32_t)(sizeof(estCfg) / sizeof(estCfg[0])); e++)
+            {
+                for (numBeams = 1; numBeams <= estCfg[e] * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET; numBeams += (estCfg[e] > 9) ? 7 : 1)
+                {
+                    Check_fill(antCfg[a], fftSize, numBeams);
+                    numFail += Check_run(antCfg[a], fftSize, numBeams, Check_getPassSize(fftSize, estCfg[e], 1, 0));
+                    numCfg++;
+                    for (passSize = 1; passSize <= numBeams; passSize += (numBeams > 9) ? 5 : 1)
+                    {
+                        numFail += Check_run(antCfg[a], fftSize, numBeams, passSize);
+                        numCfg++;
+                    }
+                }
+            }
+        }
+    }
+    printf("%d batched Doppler estimations compared bit for bit to the per beam path\n", numCfg);
+    numFail += Check_powMaxTies();
+
+    if ((argc > 1) && (strcmp(argv[1], "timing") == 0))
+        Check_timing();
+
+    printf("%s: %d failed checks\n", numFail == 0 ? "PASS" : "FAIL", numFail);
+    return (numFail == 0 ? 0 : 1);
+}
@@ -0,0 +1,84 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the batched Doppler estimation on the host
+#
+#   RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check.sh [timing]
+#
+# RADARDEMO_aoaEst2DCaponBF_DopplerEst.c is built as it is, with the C66x intrinsics emulated by
+# radar_c66x_host_shim.h, against a host header made of the Doppler estimation part of RADARDEMO_aoaEst2DCaponBF_priv.h.
+# The pass size code is extracted from RADARDEMO_aoaEst2DCaponBF_create(). The DSPLIB FFT is a radix-2 FFT in the
+# check. timing also measures the batched beamforming against the per beam beamforming on the host.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+DSS_DIR="$TOOLS_DIR/../../../../../../.."
+BUILD_DIR=${BUILD_DIR:-./RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check_build}
+CC=${CC:-cc}
+PRIV_DIR="$BUILD_DIR/inc/source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src"
+
+mkdir -p "$PRIV_DIR"
+: > "$BUILD_DIR/inc/c6x.h"
+{
+    echo '#pragma once'
+    echo '#include <source/common/swpform.h>'
+    echo '#include <math.h>'
+    grep '^#define RADARDEMO_AOAEST2D_DOPBATCH_MAXDET' "$TOOLS_DIR/../api/RADARDEMO_aoaEst2DCaponBF.h"
+    sed -n '/^\/\/! \\brief   Number of beams beamformed together for Doppler estimation/,/^#define RADARDEMO_AOAEST2D_DOPPLER_MAXSCRATCH/p' \
+        "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+    echo 'void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max);'
+    echo 'void RADARDEMO_aoaEst2DCaponBF_dopperEstInput_dcRemoval(int32_t nRxAnt, int32_t nChirps, cplx16_t *inputAntSamples, cplxf_t *bweights, cplxf_t *dcValues, float *bfOutput);'
+    echo 'void RADARDEMO_aoaEst2DCaponBF_dopperEstSliceLoad(int32_t nRxAnt, int32_t nChirps, cplx16_t *inputSamples, cplxf_t *dcValues, cplxf_t *slice);'
+    echo 'void RADARDEMO_aoaEst2DCaponBF_dopperEstInputSlice(int32_t nRxAnt, int32_t nChirps, cplxf_t *slice, cplxf_t *bweights, float *bfOutput);'
+    echo 'void RADARDEMO_aoaEst2DCaponBF_dopperEstInputBatch(int32_t nRxAnt, int32_t nChirps, int32_t numBeams, cplxf_t *slice, cplxf_t *bweights, float *bfOutput);'
+    echo 'float RADARDEMO_aoaEst2DCaponBF_dopplerPowMax(int32_t fftSize, float *fftOutput, float *spectrum, int32_t *maxIdx);'
+} > "$PRIV_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+{
+    echo 'static void Check_passSize(Check_handle *handle)'
+    echo '{'
+    echo '    int32_t i;'
+    echo
+    awk '/^[ \t]*i[ \t]*=[ \t]*handle->maxNumBeams;/ { on = 1 }
+         on { print }
+         on && /handle->dopNumBeamsPerPass[ \t]*=/ { exit }' "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF.c"
+    echo '}'
+} > "$BUILD_DIR/inc/RADARDEMO_aoaEst2DCaponBF_dopBatch_passSize.h"
+
+$CC -O2 -Wall -Werror -std=gnu99 -ffp-contract=off -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 -Wno-unknown-pragmas \
+    -include "$TOOLS_DIR/../../../utilities/tools/radar_c66x_host_shim.h" -I "$BUILD_DIR/inc" -I "$DSS_DIR" \
+    -o "$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check" \
+    "$TOOLS_DIR/RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check.c" "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_DopplerEst.c" -lm
+"$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_dopBatch_host_check" "$@"
@@ -0,0 +1,519 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_doppBin_host_check.c
+ *
+ *   @brief
+ *      Host check of the Doppler binning methods of the 2D Capon covariance.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEst2DCaponBF_doppBin_host_check [timing]
+ *
+ *  Agreement: runs RADARDEMO_aoaEst2DCaponBF_doppBinning() of the module with each method forced (full FFT, DFT,
+ *  pruned FFT with every number of sub-FFTs) for Doppler FFT sizes 8 to 256, chirp counts from a quarter of the FFT
+ *  size to the FFT size, all selection sizes and first selected bins, on random cplx16_t chirps. Every output must
+ *  match a double precision DFT of the selected bins, in the memory layout of the DSPLIB FFT output, within
+ *  CHECK_TOL of the input sum of magnitudes. The exit status is 0 if all of them match.
+ *
+ *  The selected bins start at doppSelMinBin, also for the full FFT: its first bin is read at the float offset
+ *  doppSelMinBin << 1. Before the pruned methods it was read at doppSelMinBin, the bin doppSelMinBin / 2 (real and
+ *  imaginary parts swapped for odd doppSelMinBin); the check counts the configurations where that differs.
+ *
+ *  timing: also measures the methods per selection size for the Doppler FFT sizes and chirp counts of
+ *  gCheckTimingCfg, prints the crossovers of the cost model of RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(), how
+ *  often its choice is within 10% of the fastest measured method, and the cost constants fitted to the measurements. The DSPLIB
+ *  FFT is a radix-2 FFT in the host build, so the numbers are those of the host.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src/RADARDEMO_aoaEst2DCaponBF_priv.h>
+
+#define CHECK_PI                (3.141592653589793)
+#define CHECK_MAX_FFT           (256)
+
+/* Tolerance of a selected bin, relative to the sum of the input magnitudes */
+#define CHECK_TOL               (2e-6)
+
+/* Doppler FFT size and chirp count of the timing */
+static const int32_t gCheckTimingCfg[][2] = {{16, 16}, {32, 32}, {64, 32}, {64, 64}, {128, 128}, {256, 256}};
+#define CHECK_NUM_TIMING_CFG    ((int32_t)(sizeof(gCheckTimingCfg) / sizeof(gCheckTimingCfg[0])))
+
+static const char *gCheckMethodName[RADARDEMO_AOAEST2D_DOPPBIN_NUMMETHODS] = {"fullFFT", "DFT", "prunedFFT"};
+
+/**
+ *  @b Description
+ *  @n
+ *      Host stand-in of the DSPLIB FFT: radix-2 decimation in time, natural order output. The twiddle table of
+ *      tw_gen_float() is not used, the stand-in keeps its own table per size.
+ */
+void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max)
+{
+    static float tw[2 * CHECK_MAX_FFT];
+    static int   twSize;
+    int          i, j, k, len, half, step;
+    float        re, im, tr, ti;
+
+    (void)ptr_w;
+    (void)brev;
+    (void)n_min;
+    (void)offset;
+    (void)n_max;
+    if (twSize != N)
+    {
+        for (i = 0; i < N / 2; i++)
+        {
+            tw[2 * i]     = (float)cos(2.0 * CHECK_PI * i / N);
+            tw[2 * i + 1] = (float)-sin(2.0 * CHECK_PI * i / N);
+        }
+        twSize = N;
+    }
+    for (i = 0, j = 0; i < N; i++)
+    {
+        ptr_y[2 * j]     = ptr_x[2 * i];
+        ptr_y[2 * j + 1] = ptr_x[2 * i + 1];
+        for (k = N >> 1; (j & k) != 0; k >>= 1)
+            j ^= k;
+        j |= k;
+    }
+    for (len = 2; len <= N; len <<= 1)
+    {
+        half = len >> 1;
+        step = N / len;
+        for (i = 0; i < N; i += len)
+        {
+            for (j = 0; j < half; j++)
+            {
+                float *a = &ptr_y[2 * (i + j)], *b = &ptr_y[2 * (i + j + half)];
+
+                re    = tw[2 * j * step];
+                im    = tw[2 * j * step + 1];
+                tr    = b[0] * re - b[1] * im;
+                ti    = b[0] * im + b[1] * re;
+                b[0]  = a[0] - tr;
+                b[1]  = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+void tw_gen_float(float *w, int n)
+{
+    memset(w, 0, 2 * n * sizeof(float));
+}
+
+static uint32_t gCheckSeed = 1;
+
+static int32_t Check_rand(int32_t range)
+{
+    gCheckSeed = gCheckSeed * 1103515245U + 12345U;
+    return (int32_t)((gCheckSeed >> 8) % (uint32_t)range);
+}
+
+/* Handle buffers, sized for the largest FFT */
+static cplxf_t gCheckFFTInput[CHECK_MAX_FFT];
+static cplxf_t gCheckFFTOutput[CHECK_MAX_FFT];
+static cplxf_t gCheckTwiddle[CHECK_MAX_FFT];
+static float   gCheckFFTTwiddle[2 * CHECK_MAX_FFT];
+static float   gCheckSubFFTTwiddle[2 * CHECK_MAX_FFT];
+
+/**
+ *  @b Description
+ *  @n
+ *      This function sets up a Doppler binning handle as RADARDEMO_aoaEst2DCaponBF_create() does.
+ *
+ *  @param[out] h           Handle
+ *  @param[in]  numChirps   Number of chirps
+ *  @param[in]  fftSize     Doppler FFT size
+ *  @param[in]  minBin      First selected bin
+ *  @param[in]  numSel      Number of selected bins on each side
+ */
+static void Check_initHandle(RADARDEMO_aoaEst2D_doppBinning_handle *h, int32_t numChirps, int32_t fftSize,
+                             int32_t minBin, int32_t numSel)
+{
+    memset(h, 0, sizeof(*h));
+    h->doppBinningEnable = 1;
+    h->numSubFrames      = 1;
+    h->numChirps         = (uint16_t)numChirps;
+    h->dopplerFFTSize    = (uint16_t)fftSize;
+    h->rad2D             = 2;
+    h->doppSelMinBin     = (uint16_t)minBin;
+    h->doppSelMaxBin     = (uint16_t)(minBin + numSel - 1);
+    h->numDoppBinSel     = (uint16_t)numSel;
+    h->tempDoppInput     = gCheckFFTInput;
+    h->tempDoppOut       = gCheckFFTOutput;
+    h->dopTwiddle        = gCheckFFTTwiddle;
+    h->subFFTTwiddle     = gCheckSubFFTTwiddle;
+    h->doppBinTwiddle    = gCheckTwiddle;
+    RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen(gCheckTwiddle, fftSize);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function forces a method on the handle.
+ *
+ *  @param[in,out] h        Handle
+ *  @param[in]  method      RADARDEMO_AOAEST2D_DOPPBIN_xxx
+ *  @param[in]  numSubFFT   Number of sub-FFTs of the pruned FFT
+ */
+static void Check_setMethod(RADARDEMO_aoaEst2D_doppBinning_handle *h, int32_t method, int32_t numSubFFT)
+{
+    h->method     = (uint16_t)method;
+    h->numSubFFT  = 0;
+    h->subFFTSize = 0;
+    h->subFFTRad  = 0;
+    if (method == RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT)
+    {
+        h->numSubFFT  = (uint16_t)numSubFFT;
+        h->subFFTSize = (uint16_t)(h->dopplerFFTSize / numSubFFT);
+        h->subFFTRad  = 2;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function computes the double precision DFT of bin k, in the memory layout of the DSPLIB FFT output:
+ *      real part in the first float, imaginary part in the second.
+ */
+static void Check_dft(const cplx16_t *x, int32_t numChirps, int32_t fftSize, int32_t k, double *re, double *im)
+{
+    int32_t n;
+
+    *re = 0.0;
+    *im = 0.0;
+    for (n = 0; n < numChirps; n++)
+    {
+        double c = cos(2.0 * CHECK_PI * k * n / fftSize), s = sin(2.0 * CHECK_PI * k * n / fftSize);
+
+        *re += x[n].real * c + x[n].imag * s;
+        *im += x[n].imag * c - x[n].real * s;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs the agreement check of one configuration for every method.
+ *
+ *  @retval
+ *      Number of failed methods
+ */
+static int32_t Check_agree(int32_t numChirps, int32_t fftSize, int32_t minBin, int32_t numSel, double *maxErr,
+                           int32_t *numOldDiffer)
+{
+    RADARDEMO_aoaEst2D_doppBinning_handle h;
+    cplx16_t x[CHECK_MAX_FFT];
+    cplxf_t  out[CHECK_MAX_FFT];
+    double   refRe[CHECK_MAX_FFT], refIm[CHECK_MAX_FFT], sumMag = 0.0, err, oldRe, oldIm;
+    int32_t  i, k, method, numSubFFT, numFail = 0, oldDiffers = 0;
+
+    for (i = 0; i < numChirps; i++)
+    {
+        x[i].real = (int16_t)(Check_rand(65536) - 32768);
+        x[i].imag = (int16_t)(Check_rand(65536) - 32768);
+        sumMag += sqrt((double)x[i].real * x[i].real + (double)x[i].imag * x[i].imag);
+    }
+    Check_initHandle(&h, numChirps, fftSize, minBin, numSel);
+    for (i = 0; i < 2 * numSel; i++)
+    {
+        k = (i < numSel) ? (minBin + i) : (fftSize - numSel - minBin + (i - numSel));
+        Check_dft(x, numChirps, fftSize, k, &refRe[i], &refIm[i]);
+    }
+
+    for (method = 0; method < RADARDEMO_AOAEST2D_DOPPBIN_NUMMETHODS; method++)
+    {
+        for (numSubFFT = 2; numSubFFT <= fftSize / RADARDEMO_AOAEST2D_DOPPBIN_MIN_SUBFFT; numSubFFT <<= 1)
+        {
+            Check_setMethod(&h, method, numSubFFT);
+            memset(out, 0xFF, sizeof(out));
+            RADARDEMO_aoaEst2DCaponBF_doppBinning(&h, x, out);
+            err = 0.0;
+            for (i = 0; i < 2 * numSel; i++)
+            {
+                const float *f = (const float *)&out[i];
+
+                err = fmax(err, fmax(fabs(f[0] - refRe[i]), fabs(f[1] - refIm[i])) / sumMag);
+            }
+            if (err > CHECK_TOL)
+            {
+                if (numFail == 0)
+                    printf("  %s, %d chirps, FFT %d, bins %d..%d: error %.2e of the input magnitude\n",
+                           gCheckMethodName[method], numChirps, fftSize, minBin, minBin + numSel - 1, err);
+                numFail++;
+            }
+            *maxErr = fmax(*maxErr, err);
+            if (method != RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT)
+                break;
+        }
+    }
+
+    /* First selected bin at the old full FFT offset: float doppSelMinBin of the FFT output */
+    if (minBin > 0)
+    {
+        const float *f = (const float *)gCheckFFTOutput;
+
+        Check_setMethod(&h, RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT, 0);
+        RADARDEMO_aoaEst2DCaponBF_doppBinning(&h, x, out);
+        oldRe = f[minBin];
+        oldIm = f[minBin + 1];
+        oldDiffers = (fabs(oldRe - refRe[0]) > CHECK_TOL * sumMag) || (fabs(oldIm - refIm[0]) > CHECK_TOL * sumMag);
+    }
+    *numOldDiffer += oldDiffers;
+    return (numFail);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function measures one call of the method of the handle, in ns, best of several runs.
+ */
+static double Check_time(RADARDEMO_aoaEst2D_doppBinning_handle *h, cplx16_t *x, cplxf_t *out)
+{
+    struct timespec t0, t1;
+    double best = 1e30, ns;
+    int32_t run, rep, numRep = 1;
+
+    /* repetitions of at least 50 us, best of 15 runs */
+    for (run = 0; run < 15; run++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (rep = 0; rep < numRep; rep++)
+        {
+            RADARDEMO_aoaEst2DCaponBF_doppBinning(h, x, out);
+            __asm__ volatile("" : : "r"(out) : "memory");
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        ns = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec));
+        if ((ns < 50000.0) && (run == 0))
+        {
+            numRep = (int32_t)(50000.0 / (ns / numRep + 1.0)) + 1;
+            run--;
+            continue;
+        }
+        ns /= numRep;
+        if (ns < best)
+            best = ns;
+    }
+    return (best);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function computes the crossovers of the cost model of RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod():
+ *      the largest selected/total ratio where the DFT is selected, and the smallest one where the full FFT is.
+ */
+static void Check_modelCrossovers(int32_t numChirps, int32_t fftSize, double *dftMax, double *fullMin)
+{
+    RADARDEMO_aoaEst2D_doppBinning_handle h;
+    int32_t numSel;
+
+    *dftMax  = 0.0;
+    *fullMin = 1.0;
+    for (numSel = fftSize / 2; numSel >= 1; numSel--)
+    {
+        Check_initHandle(&h, numChirps, fftSize, 0, numSel);
+        RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(&h);
+        if (h.method == RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT)
+            *fullMin = (2.0 * numSel) / fftSize;
+    }
+    for (numSel = 1; 2 * numSel <= fftSize; numSel++)
+    {
+        Check_initHandle(&h, numChirps, fftSize, 0, numSel);
+        RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(&h);
+        if (h.method == RADARDEMO_AOAEST2D_DOPPBIN_DFT)
+            *dftMax = (2.0 * numSel) / fftSize;
+    }
+}
+
+/* Solves the 3 x 3 system a x = b, Cramer */
+static void Check_solve3(double a[3][3], const double *b, double *x)
+{
+    double  m[3][3], det;
+    int32_t i, j, k;
+
+    det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+        + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+    for (k = 0; k < 3; k++)
+    {
+        for (i = 0; i < 3; i++)
+            for (j = 0; j < 3; j++)
+                m[i][j] = (j == k) ? b[i] : a[i][j];
+        x[k] = (m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+              + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0])) / det;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function measures the methods for every selection size of the configurations of gCheckTimingCfg, fits
+ *      the constants of the cost model to the measurements, and prints per configuration the crossovers of the model
+ *      and how often its choice is within 10% of the fastest measured method.
+ *
+ *      Model, in units of one DFT multiply-accumulate u, L = 2 x numDoppBinSel selected bins, M chirps:
+ *        DFT        u L M
+ *        full FFT   u (LOAD N + BFLY (N/2) log2 N)
+ *        pruned FFT u (LOAD N + BFLY P (Q/2) log2 Q + RECOMB L P)
+ */
+static void Check_timing(void)
+{
+    RADARDEMO_aoaEst2D_doppBinning_handle h, sel;
+    cplx16_t x[CHECK_MAX_FFT];
+    cplxf_t  out[CHECK_MAX_FFT];
+    double   t[RADARDEMO_AOAEST2D_DOPPBIN_NUMMETHODS], tp, tSel, regret, maxRegret = 0.0, dftMax, fullMin;
+    double   ata[3][3] = {{0.0}}, atb[3] = {0.0}, coef[3], row[3], sumMac = 0.0, u;
+    int32_t  c, i, j, fftSize, numChirps, numSel, numSubFFT, subFFTSize, best, numMac = 0;
+    int32_t  numAgree, numPoints, totAgree = 0, totPoints = 0;
+
+    printf("\ntiming on the host, model with the constants of RADARDEMO_aoaEst2DCaponBF_priv.h\n");
+    for (c = 0; c < CHECK_NUM_TIMING_CFG; c++)
+    {
+        fftSize   = gCheckTimingCfg[c][0];
+        numChirps = gCheckTimingCfg[c][1];
+        numAgree  = 0;
+        numPoints = 0;
+        for (i = 0; i < numChirps; i++)
+        {
+            x[i].real = (int16_t)(Check_rand(2048) - 1024);
+            x[i].imag = (int16_t)(Check_rand(2048) - 1024);
+        }
+        for (numSel = 1; 2 * numSel <= fftSize; numSel++)
+        {
+            Check_initHandle(&h, numChirps, fftSize, 0, numSel);
+            Check_setMethod(&h, RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT, 0);
+            t[RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT] = Check_time(&h, x, out);
+            Check_setMethod(&h, RADARDEMO_AOAEST2D_DOPPBIN_DFT, 0);
+            t[RADARDEMO_AOAEST2D_DOPPBIN_DFT] = Check_time(&h, x, out);
+            sumMac += t[RADARDEMO_AOAEST2D_DOPPBIN_DFT] / (2.0 * numSel * numChirps);
+            numMac++;
+
+            /* full FFT row of the fit */
+            row[0] = fftSize;
+            row[1] = 0.5 * fftSize * log2((double)fftSize);
+            row[2] = 0.0;
+            for (i = 0; i < 3; i++)
+            {
+                for (j = 0; j < 3; j++)
+                    ata[i][j] += row[i] * row[j];
+                atb[i] += row[i] * t[RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT];
+            }
+
+            sel = h;
+            RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(&sel);
+            tSel = t[sel.method];
+            t[RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT] = 1e30;
+            for (numSubFFT = 2; (subFFTSize = fftSize / numSubFFT) >= RADARDEMO_AOAEST2D_DOPPBIN_MIN_SUBFFT; numSubFFT <<= 1)
+            {
+                Check_setMethod(&h, RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT, numSubFFT);
+                tp = Check_time(&h, x, out);
+                t[RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT] = fmin(t[RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT], tp);
+                if ((sel.method == RADARDEMO_AOAEST2D_DOPPBIN_PRUNEDFFT) && (sel.numSubFFT == numSubFFT))
+                    tSel = tp;
+
+                row[0] = fftSize;
+                row[1] = numSubFFT * 0.5 * subFFTSize * log2((double)subFFTSize);
+                row[2] = 2.0 * numSel * numSubFFT;
+                for (i = 0; i < 3; i++)
+                {
+                    for (j = 0; j < 3; j++)
+                        ata[i][j] += row[i] * row[j];
+                    atb[i] += row[i] * tp;
+                }
+            }
+            best = RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT;
+            for (i = 1; i < RADARDEMO_AOAEST2D_DOPPBIN_NUMMETHODS; i++)
+                if (t[i] < t[best])
+                    best = i;
+            regret    = tSel / t[best] - 1.0;
+            maxRegret = fmax(maxRegret, regret);
+            numAgree += (regret < 0.1);
+            numPoints++;
+        }
+        Check_modelCrossovers(numChirps, fftSize, &dftMax, &fullMin);
+        printf("FFT %3d, %3d chirps: full FFT %5.0f ns, DFT selected up to %.3f of the bins, full FFT from %.3f, "
+               "choice within 10%% of the fastest on %d of %d\n", fftSize, numChirps,
+               t[RADARDEMO_AOAEST2D_DOPPBIN_FULLFFT], dftMax, fullMin, numAgree, numPoints);
+        totAgree += numAgree;
+        totPoints += numPoints;
+    }
+    u = sumMac / numMac;
+    Check_solve3(ata, atb, coef);
+    printf("choice within 10%% of the fastest on %d of %d points, worst %.0f%% slower\n", totAgree, totPoints,
+           100.0 * maxRegret);
+    printf("fitted on the host: DFT multiply-accumulate %.2f ns, LOAD_COST %.2f BFLY_COST %.2f RECOMB_COST %.2f "
+           "(model %.2f %.2f %.2f)\n", u, coef[0] / u, coef[1] / u, coef[2] / u, RADARDEMO_AOAEST2D_DOPPBIN_LOAD_COST,
+           RADARDEMO_AOAEST2D_DOPPBIN_BFLY_COST, RADARDEMO_AOAEST2D_DOPPBIN_RECOMB_COST);
+}
+
+int main(int argc, char **argv)
+{
+    int32_t fftSize, numChirps, minBin, numSel, numCfg = 0, numFail = 0, numOldDiffer = 0, numOldCfg = 0;
+    double  maxErr = 0.0;
+
+    for (fftSize = 8; fftSize <= CHECK_MAX_FFT; fftSize <<= 1)
+    {
+        for (numChirps = fftSize / 4 > 0 ? fftSize / 4 : 1; numChirps <= fftSize; numChirps += (fftSize >= 64 ? fftSize / 8 : 1))
+        {
+            for (numSel = 1; 2 * numSel <= fftSize; numSel++)
+            {
+                for (minBin = 0; 2 * (minBin + numSel) <= fftSize; minBin += (fftSize >= 64 ? 3 : 1))
+                {
+                    numFail += Check_agree(numChirps, fftSize, minBin, numSel, &maxErr, &numOldDiffer);
+                    numCfg++;
+                    numOldCfg += (minBin > 0);
+                }
+            }
+        }
+    }
+    printf("%d configurations, %d method failures, max error %.2e of the input magnitude (tolerance %.0e)\n",
+           numCfg, numFail, maxErr, CHECK_TOL);
+    printf("first bin at the pre-pruning full FFT offset differs from bin doppSelMinBin on %d of %d configurations "
+           "with doppSelMinBin > 0\n", numOldDiffer, numOldCfg);
+
+    if ((argc > 1) && (strcmp(argv[1], "timing") == 0))
+        Check_timing();
+
+    printf("%s\n", numFail == 0 ? "PASS" : "FAIL");
+    return (numFail == 0 ? 0 : 1);
+}
@@ -0,0 +1,71 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the Doppler binning methods on the host
+#
+#   RADARDEMO_aoaEst2DCaponBF_doppBin_host_check.sh [timing]
+#
+# RADARDEMO_aoaEst2DCaponBF_doppBinning.c is built as it is, with the C66x intrinsics emulated by
+# radar_c66x_host_shim.h, against a host header made of the Doppler binning part of RADARDEMO_aoaEst2DCaponBF_priv.h.
+# The DSPLIB FFT is a radix-2 FFT in the check. timing also measures the methods on the host and prints the crossovers
+# of the measurements and of the cost model.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./RADARDEMO_aoaEst2DCaponBF_doppBin_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+DSS_DIR="$TOOLS_DIR/../../../../../../.."
+BUILD_DIR=${BUILD_DIR:-./RADARDEMO_aoaEst2DCaponBF_doppBin_host_check_build}
+CC=${CC:-cc}
+PRIV_DIR="$BUILD_DIR/inc/source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src"
+
+mkdir -p "$PRIV_DIR"
+: > "$BUILD_DIR/inc/c6x.h"
+{
+    echo '#pragma once'
+    echo '#include <source/common/swpform.h>'
+    echo '#include <math.h>'
+    echo 'void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max);'
+    echo 'void tw_gen_float(float *w, int n);'
+    sed -n '/^\/\/! \\brief   Doppler binning methods/,/^} RADARDEMO_aoaEst2D_doppBinning_handle;/p' "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+    echo 'void RADARDEMO_aoaEst2DCaponBF_doppBinSelectMethod(RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle);'
+    echo 'void RADARDEMO_aoaEst2DCaponBF_doppBinTwiddleGen(cplxf_t *twiddle, int32_t fftSize);'
+    echo 'void RADARDEMO_aoaEst2DCaponBF_doppBinning(RADARDEMO_aoaEst2D_doppBinning_handle *doppBinHandle, cplx16_t *inputChirps, cplxf_t *output);'
+} > "$PRIV_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+
+$CC -O2 -Wall -Werror -std=gnu99 -ffp-contract=off -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 -Wno-unknown-pragmas \
+    -include "$TOOLS_DIR/../../../utilities/tools/radar_c66x_host_shim.h" -I "$BUILD_DIR/inc" -I "$DSS_DIR" \
+    -o "$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_doppBin_host_check" \
+    "$TOOLS_DIR/RADARDEMO_aoaEst2DCaponBF_doppBin_host_check.c" "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_doppBinning.c" -lm
+"$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_doppBin_host_check" "$@"
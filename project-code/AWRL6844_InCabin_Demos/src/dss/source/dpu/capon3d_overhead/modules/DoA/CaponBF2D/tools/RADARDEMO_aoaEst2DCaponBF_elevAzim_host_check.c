@@ -0,0 +1,302 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_elevAzim_host_check.c
+ *
+ *   @brief
+ *      Host check of the elevation/azimuth estimate of the 2D Capon angle estimation.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEst2DCaponBF_elevAzim_host_check [numScenes]
+ *
+ *  Runs RADARDEMO_aoaEst2DCaponBF_aeEstElevAzim() of RADARDEMO_aoaEst2DCaponBF_angleEst.c, dense search, on numScenes
+ *  (default 2000) random two-source scenes of a 4 x 3 virtual array, on a CHECK_AZIM_LEN x CHECK_ELEV_LEN grid, and
+ *  compares against a double precision Capon estimate of the same packed inverse covariance matrix:
+ *    - heatmap: 1 / (a^H Rn^-1 a) at every grid point,
+ *    - peak: grid point of the heatmap maximum,
+ *    - beam filter: Rn^-1 a at the peak found by the module.
+ *  It prints the largest relative errors and the scenes whose peak differs. The function is extracted from the
+ *  module source by the script of the same name, the C66x intrinsics are emulated in C.
+ *
+ *  The exit status is 0 if all relative errors are below CHECK_REL_TOL and every peak is the reference one, up to
+ *  ties within CHECK_REL_TOL.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include "RADARDEMO_aoaEst2DCaponBF_elevAzim_host.h"
+
+#define CHECK_REL_TOL           (1.0e-3)
+
+/* Virtual array: azimuth and elevation positions in half wavelengths */
+#define CHECK_NUM_ANT           (12)
+static const int32_t gCheckAntAzim[CHECK_NUM_ANT] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+static const int32_t gCheckAntElev[CHECK_NUM_ANT] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2};
+
+/* Search grid in sin space: nu = CHECK_NU_INIT + azimIdx * CHECK_STEP, mu = CHECK_MU_INIT + elevIdx * CHECK_STEP */
+#define CHECK_AZIM_LEN          (24)
+#define CHECK_ELEV_LEN          (12)
+#define CHECK_STEP              (0.08)
+#define CHECK_NU_INIT           (-0.96)
+#define CHECK_MU_INIT           (-0.44)
+#define CHECK_NUM_SNAPSHOTS     (64)
+
+static double Check_urand(void)
+{
+    return rand() / (double)RAND_MAX;
+}
+
+static double complex Check_grand(void)
+{
+    return sqrt(-log(Check_urand() + 1e-12)) * cexp(2 * M_PI * I * Check_urand());
+}
+
+/* In place inverse of an n x n matrix, Gauss-Jordan */
+static void Check_invert(double complex *a, int32_t n)
+{
+    double complex b[CHECK_NUM_ANT * CHECK_NUM_ANT * 2], p, f;
+    int32_t i, j, k;
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < 2 * n; j++)
+            b[i * 2 * n + j] = (j < n) ? a[i * n + j] : (double complex)(j - n == i);
+    for (i = 0; i < n; i++)
+    {
+        p = b[i * 2 * n + i];
+        for (j = 0; j < 2 * n; j++)
+            b[i * 2 * n + j] /= p;
+        for (k = 0; k < n; k++)
+        {
+            if (k == i)
+                continue;
+            f = b[k * 2 * n + i];
+            for (j = 0; j < 2 * n; j++)
+                b[k * 2 * n + j] -= f * b[i * 2 * n + j];
+        }
+    }
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            a[i * n + j] = b[i * 2 * n + n + j];
+}
+
+static cplxf_t Check_cplxf(double complex z)
+{
+    cplxf_t r;
+
+    r.real = (float)creal(z);
+    r.imag = (float)cimag(z);
+    return r;
+}
+
+static double complex Check_cplx(cplxf_t z)
+{
+    return z.real + I * z.imag;
+}
+
+/* steering vector of grid point (azimIdx, elevIdx), from the float tables given to the module */
+static void Check_steeringVec(const cplxf_t *azimTab, const cplxf_t *elevTab, int32_t azimIdx, int32_t elevIdx, double complex *a)
+{
+    int32_t k;
+
+    for (k = 0; k < CHECK_NUM_ANT; k++)
+        a[k] = Check_cplx(azimTab[azimIdx * CHECK_NUM_ANT + k]) * Check_cplx(elevTab[elevIdx * CHECK_NUM_ANT + k]);
+}
+
+static double Check_relErr(double x, double ref)
+{
+    return fabs(x - ref) / fabs(ref);
+}
+
+int main(int argc, char *argv[])
+{
+    static uint32_t scratch[2 * CHECK_NUM_ANT * CHECK_NUM_ANT + 2 * CHECK_NUM_ANT + 2];
+    static cplxf_t azimTab[CHECK_AZIM_LEN * CHECK_NUM_ANT], elevTab[CHECK_ELEV_LEN * CHECK_NUM_ANT];
+    double complex R[CHECK_NUM_ANT * CHECK_NUM_ANT], x[CHECK_NUM_ANT], a[CHECK_NUM_ANT], w, g0, g1;
+    /* packed inverse covariance matrix of the scene, followed by the one of the previous scene as the matrices of
+     * consecutive range bins in the module output */
+    static cplxf_t invRn[CHECK_NUM_ANT * (CHECK_NUM_ANT + 1)];
+    cplxf_t  beamFilter[CHECK_NUM_ANT];
+    float    heatMap[CHECK_AZIM_LEN * CHECK_ELEV_LEN], azimEst[1], elevEst[1], peakPow[1];
+    double   refMap[CHECK_AZIM_LEN * CHECK_ELEV_LEN], nu0, mu0, nu1, mu1, snr0, snr1, err, norm;
+    double   maxErrMap = 0.0, maxErrBf = 0.0, refMax;
+    int32_t  numScenes = 2000, scene, i, j, k, s, refPeak, peak;
+    long     numPeakDiff = 0, numFailed = 0;
+    RADARDEMO_aoaEst2D_RAHeatMap_handle raHeatMap;
+    RADARDEMO_aoaEst2D_aeEst_handle     aeEst;
+    RADARDEMO_aoaEst2DCaponBF_handle    capon;
+
+    if (argc > 1)
+        numScenes = atoi(argv[1]);
+    srand(1);
+
+    for (i = 0; i < CHECK_AZIM_LEN; i++)
+        for (k = 0; k < CHECK_NUM_ANT; k++)
+            azimTab[i * CHECK_NUM_ANT + k] = Check_cplxf(cexp(I * M_PI * gCheckAntAzim[k] * (CHECK_NU_INIT + i * CHECK_STEP)));
+    for (i = 0; i < CHECK_ELEV_LEN; i++)
+        for (k = 0; k < CHECK_NUM_ANT; k++)
+            elevTab[i * CHECK_NUM_ANT + k] = Check_cplxf(cexp(I * M_PI * gCheckAntElev[k] * (CHECK_MU_INIT + i * CHECK_STEP)));
+
+    memset(&raHeatMap, 0, sizeof(raHeatMap));
+    memset(&aeEst, 0, sizeof(aeEst));
+    raHeatMap.nRxAnt          = CHECK_NUM_ANT;
+    raHeatMap.steeringVecAzim = azimTab;
+    raHeatMap.steeringVecElev = elevTab;
+    raHeatMap.azimSearchLen   = CHECK_AZIM_LEN;
+    raHeatMap.elevSearchLen   = CHECK_ELEV_LEN;
+    raHeatMap.nuInit          = (float)CHECK_NU_INIT;
+    raHeatMap.nuStep          = (float)CHECK_STEP;
+    raHeatMap.muInit          = (float)CHECK_MU_INIT;
+    raHeatMap.muStep          = (float)CHECK_STEP;
+    aeEst.nRxAnt              = CHECK_NUM_ANT;
+    aeEst.scratchPad          = scratch;
+    aeEst.scratchPadSize      = sizeof(scratch);
+    aeEst.coarseSearchStep    = 0;
+    capon.raHeatMap_handle    = &raHeatMap;
+    capon.aeEstimation_handle = &aeEst;
+    capon.nRxAnt              = CHECK_NUM_ANT;
+
+    for (scene = 0; scene < numScenes; scene++)
+    {
+        nu0  = -0.8 + Check_urand() * 1.6;
+        mu0  = -0.4 + Check_urand() * 0.8;
+        nu1  = -0.8 + Check_urand() * 1.6;
+        mu1  = -0.4 + Check_urand() * 0.8;
+        snr1 = pow(10, Check_urand() * 2);
+        snr0 = pow(10, 0.5 + Check_urand() * 2.5);
+
+        memset(R, 0, sizeof(R));
+        for (s = 0; s < CHECK_NUM_SNAPSHOTS; s++)
+        {
+            g0 = Check_grand() * sqrt(snr0);
+            g1 = Check_grand() * sqrt(snr1);
+            for (k = 0; k < CHECK_NUM_ANT; k++)
+                x[k] = g0 * cexp(I * M_PI * (gCheckAntAzim[k] * nu0 + gCheckAntElev[k] * mu0)) +
+                       g1 * cexp(I * M_PI * (gCheckAntAzim[k] * nu1 + gCheckAntElev[k] * mu1)) + Check_grand();
+            for (i = 0; i < CHECK_NUM_ANT; i++)
+                for (j = 0; j < CHECK_NUM_ANT; j++)
+                    R[i * CHECK_NUM_ANT + j] += x[i] * conj(x[j]) / CHECK_NUM_SNAPSHOTS;
+        }
+        for (i = 0; i < CHECK_NUM_ANT; i++)
+            R[i * CHECK_NUM_ANT + i] += 0.03;
+        Check_invert(R, CHECK_NUM_ANT);
+        memcpy(&invRn[CHECK_NUM_ANT * (CHECK_NUM_ANT + 1) / 2], invRn, CHECK_NUM_ANT * (CHECK_NUM_ANT + 1) / 2 * sizeof(cplxf_t));
+        k = 0;
+        for (i = 0; i < CHECK_NUM_ANT; i++)
+            for (j = i; j < CHECK_NUM_ANT; j++)
+                invRn[k++] = Check_cplxf(R[i * CHECK_NUM_ANT + j]);
+        /* the reference uses the rounded matrix given to the module */
+        k = 0;
+        for (i = 0; i < CHECK_NUM_ANT; i++)
+        {
+            R[i * CHECK_NUM_ANT + i] = creal(Check_cplx(invRn[k++]));
+            for (j = i + 1; j < CHECK_NUM_ANT; j++)
+            {
+                R[i * CHECK_NUM_ANT + j] = Check_cplx(invRn[k++]);
+                R[j * CHECK_NUM_ANT + i] = conj(R[i * CHECK_NUM_ANT + j]);
+            }
+        }
+
+        /* reference heatmap, elevation major as written by the module */
+        refPeak = 0;
+        refMax  = 0.0;
+        for (i = 0; i < CHECK_ELEV_LEN; i++)
+        {
+            for (j = 0; j < CHECK_AZIM_LEN; j++)
+            {
+                Check_steeringVec(azimTab, elevTab, j, i, a);
+                w = 0.0;
+                for (k = 0; k < CHECK_NUM_ANT; k++)
+                    for (s = 0; s < CHECK_NUM_ANT; s++)
+                        w += conj(a[k]) * R[k * CHECK_NUM_ANT + s] * a[s];
+                refMap[i * CHECK_AZIM_LEN + j] = 1.0 / creal(w);
+                if (refMap[i * CHECK_AZIM_LEN + j] > refMax)
+                {
+                    refMax  = refMap[i * CHECK_AZIM_LEN + j];
+                    refPeak = i * CHECK_AZIM_LEN + j;
+                }
+            }
+        }
+
+        RADARDEMO_aoaEst2DCaponBF_aeEstElevAzim(1, 0, &capon, invRn, azimEst, elevEst, peakPow, beamFilter, heatMap);
+
+        peak = 0;
+        for (i = 0; i < CHECK_AZIM_LEN * CHECK_ELEV_LEN; i++)
+        {
+            err = Check_relErr(heatMap[i], refMap[i]);
+            if (!(err <= maxErrMap))
+                maxErrMap = err;
+            if (!(err < CHECK_REL_TOL))
+                numFailed++;
+            if (heatMap[i] > heatMap[peak])
+                peak = i;
+        }
+        if (peak != refPeak)
+        {
+            numPeakDiff++;
+            if (!(Check_relErr(refMap[peak], refMax) < CHECK_REL_TOL))
+                numFailed++;
+        }
+
+        /* beam filter of the peak found by the module */
+        Check_steeringVec(azimTab, elevTab, peak % CHECK_AZIM_LEN, peak / CHECK_AZIM_LEN, a);
+        err  = 0.0;
+        norm = 0.0;
+        for (k = 0; k < CHECK_NUM_ANT; k++)
+        {
+            w = 0.0;
+            for (s = 0; s < CHECK_NUM_ANT; s++)
+                w += R[k * CHECK_NUM_ANT + s] * a[s];
+            err  += cabs(Check_cplx(beamFilter[k]) - w) * cabs(Check_cplx(beamFilter[k]) - w);
+            norm += cabs(w) * cabs(w);
+        }
+        err = sqrt(err / norm);
+        if (!(err <= maxErrBf))
+            maxErrBf = err;
+        if (!(err < CHECK_REL_TOL))
+            numFailed++;
+    }
+
+    printf("%d scenes, %d x %d azimuth x elevation grid, %d antennas\n", numScenes, CHECK_AZIM_LEN, CHECK_ELEV_LEN,
+           CHECK_NUM_ANT);
+    printf("heatmap: max relative error %.3g\n", maxErrMap);
+    printf("peak: differs from the reference in %ld scenes (%.2f%%)\n", numPeakDiff, 100.0 * numPeakDiff / numScenes);
+    printf("beam filter: max relative error %.3g\n", maxErrBf);
+    printf("%s: %ld failed checks\n", (numFailed == 0) ? "PASS" : "FAIL", numFailed);
+    return (numFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_elevAzim_host_shim.h
+ *
+ *   @brief
+ *      Host emulation of the C66x intrinsics and of the handles used by the elevation/azimuth estimate.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RADARDEMO_AOAEST2DCAPONBF_ELEVAZIM_HOST_SHIM_H
+#define RADARDEMO_AOAEST2DCAPONBF_ELEVAZIM_HOST_SHIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <source/common/swpform.h>
+
+/* Memory image of a cplxf_t: imaginary part in the low word, real part in the high word */
+typedef struct
+{
+    float imag;
+    float real;
+} cplxf_t;
+
+typedef struct
+{
+    float lo;
+    float hi;
+} __float2_t;
+
+static inline __float2_t _ftof2(float hi, float lo)
+{
+    __float2_t r;
+
+    r.hi = hi;
+    r.lo = lo;
+    return r;
+}
+
+#define _hif2(x)        ((x).hi)
+#define _lof2(x)        ((x).lo)
+#define _amem8_f2(p)    (*(__float2_t *)(p))
+#define _fabs(x)        fabs(x)
+
+static inline __float2_t _daddsp(__float2_t x, __float2_t y)
+{
+    return _ftof2(x.hi + y.hi, x.lo + y.lo);
+}
+
+static inline __float2_t _complex_mpysp(__float2_t x, __float2_t y)
+{
+    return _ftof2(x.hi * y.hi - x.lo * y.lo, x.hi * y.lo + x.lo * y.hi);
+}
+
+static inline __float2_t _complex_conjugate_mpysp(__float2_t x, __float2_t y)
+{
+    return _ftof2(x.hi * y.hi + x.lo * y.lo, x.hi * y.lo - x.lo * y.hi);
+}
+
+/* _rcpsp and _rsqrsp are 8 bit estimates on the C66x */
+static inline float _rcpsp(float x)
+{
+    return (1.0f / x) * (1.0f + 1.0f / 512.0f);
+}
+
+static inline float _rsqrsp(float x)
+{
+    return (1.0f / sqrtf(x)) * (1.0f - 1.0f / 512.0f);
+}
+
+/* the angle conversion is not checked, the radar_commonMath.h approximations are replaced by libm */
+static inline float asinsp_i(float x)
+{
+    return asinf(x);
+}
+
+static inline float cossp_i(float x)
+{
+    return cosf(x);
+}
+
+static inline float divsp_i(float a, float b)
+{
+    return a / b;
+}
+
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_cplxMath.h>
+
+#endif
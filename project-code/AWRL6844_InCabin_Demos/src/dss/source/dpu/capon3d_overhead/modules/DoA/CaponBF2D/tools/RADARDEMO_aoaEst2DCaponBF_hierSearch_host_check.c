@@ -0,0 +1,327 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check.c
+ *
+ *   @brief
+ *      Host check of the hierarchical angle search of the 2D Capon angle estimation.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check [numScenes]
+ *
+ *  Runs the zoom-in search of RADARDEMO_aoaEst2DCaponBF_angleEst.c, dense and hierarchical with the supported coarse
+ *  steps 2 to RADARDEMO_AOAEST2D_HIER_MAX_STEP, on numScenes (default 2000) random two-source scenes of a 4 x 3
+ *  virtual array, zoominFactor 5 (11 x 11 points), and prints per step the points evaluated, the scenes whose peak
+ *  differs from the dense search, and for those the angle error against the dense peak in degrees. The search
+ *  functions are extracted from the module source by the script of the same name, the C66x intrinsics are emulated
+ *  in C.
+ *
+ *  The exit status is 0 if no hierarchical peak is more than RADARDEMO_AOAEST2D_HIER_TOL_POINTS zoom-in points
+ *  away from the dense peak in either dimension, every hierarchical peak is a local maximum of the spectrum, and
+ *  the hierarchical search with the cache finds the same peak as without it.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include "RADARDEMO_aoaEst2DCaponBF_hierSearch_host.h"
+
+/* Tolerance of the hierarchical search: distance to the dense peak in zoom-in points */
+#define RADARDEMO_AOAEST2D_HIER_TOL_POINTS  (1)
+
+/* Virtual array: azimuth and elevation positions in half wavelengths */
+#define CHECK_NUM_ANT           (12)
+static const int32_t gCheckAntAzim[CHECK_NUM_ANT] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+static const int32_t gCheckAntElev[CHECK_NUM_ANT] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2};
+
+/* Zoom-in grid: zoominFactor points per range-angle heatmap bin of CHECK_BIN_STEP in sin space */
+#define CHECK_ZOOMIN_FACTOR     (5)
+#define CHECK_GRID_LEN          (2 * CHECK_ZOOMIN_FACTOR + 1)
+#define CHECK_BIN_STEP          (0.12)
+#define CHECK_NU_START          (-0.6)
+#define CHECK_MU_START          (-0.4)
+#define CHECK_NUM_SNAPSHOTS     (64)
+
+#define CHECK_MIN_STEP          (2)
+#define CHECK_MAX_STEP          (RADARDEMO_AOAEST2D_HIER_MAX_STEP)
+
+/* Number of complex multiplies of the steering vectors, nRxAnt per spectrum evaluation */
+long gCheckNumEval;
+
+static double Check_urand(void)
+{
+    return rand() / (double)RAND_MAX;
+}
+
+static double complex Check_grand(void)
+{
+    return sqrt(-log(Check_urand() + 1e-12)) * cexp(2 * M_PI * I * Check_urand());
+}
+
+/* In place inverse of an n x n matrix, Gauss-Jordan */
+static void Check_invert(double complex *a, int32_t n)
+{
+    double complex b[CHECK_NUM_ANT * CHECK_NUM_ANT * 2], p, f;
+    int32_t i, j, k;
+
+    for (i = 0; i < n; i++)
+        for (j = 0; j < 2 * n; j++)
+            b[i * 2 * n + j] = (j < n) ? a[i * n + j] : (double complex)(j - n == i);
+    for (i = 0; i < n; i++)
+    {
+        p = b[i * 2 * n + i];
+        for (j = 0; j < 2 * n; j++)
+            b[i * 2 * n + j] /= p;
+        for (k = 0; k < n; k++)
+        {
+            if (k == i)
+                continue;
+            f = b[k * 2 * n + i];
+            for (j = 0; j < 2 * n; j++)
+                b[k * 2 * n + j] -= f * b[i * 2 * n + j];
+        }
+    }
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++)
+            a[i * n + j] = b[i * 2 * n + n + j];
+}
+
+static cplxf_t Check_cplxf(double complex z)
+{
+    cplxf_t r;
+
+    r.real = (float)creal(z);
+    r.imag = (float)cimag(z);
+    return r;
+}
+
+/* Azimuth and elevation in degrees of zoom-in point (azimIdx, elevIdx) of heatmap bin (azimBin, elevBin) */
+static void Check_angle(int32_t azimBin, int32_t elevBin, int32_t azimIdx, int32_t elevIdx, double *azim, double *elev)
+{
+    double nu = CHECK_NU_START + (azimBin * CHECK_ZOOMIN_FACTOR + azimIdx - CHECK_ZOOMIN_FACTOR) * CHECK_BIN_STEP / CHECK_ZOOMIN_FACTOR;
+    double mu = CHECK_MU_START + (elevBin * CHECK_ZOOMIN_FACTOR + elevIdx - CHECK_ZOOMIN_FACTOR) * CHECK_BIN_STEP / CHECK_ZOOMIN_FACTOR;
+
+    *elev = asin(mu);
+    *azim = asin(nu / cos(*elev)) * 180.0 / M_PI;
+    *elev = *elev * 180.0 / M_PI;
+}
+
+/* Azimuth steering vectors of the zoom-in grid of heatmap bin azimBin */
+static void Check_azimTab(cplxf_t *tab, int32_t azimBin)
+{
+    int32_t i, k;
+    double  nu;
+
+    for (i = 0; i < CHECK_GRID_LEN; i++)
+    {
+        nu = CHECK_NU_START + (azimBin * CHECK_ZOOMIN_FACTOR + i - CHECK_ZOOMIN_FACTOR) * CHECK_BIN_STEP / CHECK_ZOOMIN_FACTOR;
+        for (k = 0; k < CHECK_NUM_ANT; k++)
+            tab[i * CHECK_NUM_ANT + k] = Check_cplxf(cexp(I * M_PI * gCheckAntAzim[k] * nu));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    static RADARDEMO_aoaEst2D_aeCacheEntry cache[RADARDEMO_AOAEST2D_AECACHE_SIZE];
+    double complex R[CHECK_NUM_ANT * CHECK_NUM_ANT], x[CHECK_NUM_ANT], g0, g1;
+    cplxf_t  invRn[CHECK_NUM_ANT * (CHECK_NUM_ANT + 1) / 2], steeringVec[CHECK_NUM_ANT];
+    cplxf_t  azimTab[CHECK_GRID_LEN * CHECK_NUM_ANT], elevTab[CHECK_GRID_LEN * CHECK_NUM_ANT];
+    float    denseMap[CHECK_GRID_LEN * CHECK_GRID_LEN], hierMap[CHECK_GRID_LEN * CHECK_GRID_LEN];
+    RADARDEMO_aoaEst2D_aeSearch search;
+    int32_t  numScenes = 2000, scene, step, i, j, k, s, azimBin, elevBin, denseAzim, denseElev, azimIdx, elevIdx;
+    int32_t  cacheAzim, cacheElev, det;
+    double   nu0, mu0, nu1, mu1, snr0, snr1, mu, a0, e0, a1, e1, errAzim, errElev;
+    float    denseMax, hierMax;
+    long     numEval[CHECK_MAX_STEP + 1] = {0}, numDiff[CHECK_MAX_STEP + 1] = {0}, numOutTol[CHECK_MAX_STEP + 1] = {0};
+    double   sumErrAzim[CHECK_MAX_STEP + 1] = {0}, sumErrElev[CHECK_MAX_STEP + 1] = {0};
+    double   maxErrAzim[CHECK_MAX_STEP + 1] = {0}, maxErrElev[CHECK_MAX_STEP + 1] = {0}, maxLossDb[CHECK_MAX_STEP + 1] = {0};
+    long     evalNoCache = 0, evalCache = 0, numFailed = 0;
+
+    if (argc > 1)
+        numScenes = atoi(argv[1]);
+    srand(1);
+
+    for (scene = 0; scene < numScenes; scene++)
+    {
+        /* two sources, the first one in heatmap bin (azimBin, elevBin), the second anywhere */
+        azimBin = 3 + rand() % 6;
+        elevBin = 2 + rand() % 3;
+        nu0     = CHECK_NU_START + azimBin * CHECK_BIN_STEP + (Check_urand() - 0.5) * CHECK_BIN_STEP;
+        mu0     = CHECK_MU_START + elevBin * CHECK_BIN_STEP + (Check_urand() - 0.5) * CHECK_BIN_STEP;
+        nu1     = -0.6 + Check_urand() * 1.2;
+        mu1     = -0.4 + Check_urand() * 0.8;
+        snr1    = pow(10, Check_urand() * 2);
+        snr0    = pow(10, 0.5 + Check_urand() * 2.5);
+
+        memset(R, 0, sizeof(R));
+        for (s = 0; s < CHECK_NUM_SNAPSHOTS; s++)
+        {
+            g0 = Check_grand() * sqrt(snr0);
+            g1 = Check_grand() * sqrt(snr1);
+            for (k = 0; k < CHECK_NUM_ANT; k++)
+                x[k] = g0 * cexp(-I * M_PI * (gCheckAntAzim[k] * nu0 + gCheckAntElev[k] * mu0)) +
+                       g1 * cexp(-I * M_PI * (gCheckAntAzim[k] * nu1 + gCheckAntElev[k] * mu1)) + Check_grand();
+            for (i = 0; i < CHECK_NUM_ANT; i++)
+                for (j = 0; j < CHECK_NUM_ANT; j++)
+                    R[i * CHECK_NUM_ANT + j] += x[i] * conj(x[j]) / CHECK_NUM_SNAPSHOTS;
+        }
+        for (i = 0; i < CHECK_NUM_ANT; i++)
+            R[i * CHECK_NUM_ANT + i] += 0.03;
+        Check_invert(R, CHECK_NUM_ANT);
+        k = 0;
+        for (i = 0; i < CHECK_NUM_ANT; i++)
+            for (j = i; j < CHECK_NUM_ANT; j++)
+                invRn[k++] = Check_cplxf(R[i * CHECK_NUM_ANT + j]);
+
+        Check_azimTab(azimTab, azimBin);
+        for (i = 0; i < CHECK_GRID_LEN; i++)
+        {
+            mu = CHECK_MU_START + (elevBin * CHECK_ZOOMIN_FACTOR + i - CHECK_ZOOMIN_FACTOR) * CHECK_BIN_STEP / CHECK_ZOOMIN_FACTOR;
+            for (k = 0; k < CHECK_NUM_ANT; k++)
+                elevTab[i * CHECK_NUM_ANT + k] = Check_cplxf(cexp(I * M_PI * gCheckAntElev[k] * mu));
+        }
+
+        memset(&search, 0, sizeof(search));
+        search.bfFlag      = 1;
+        search.nRxAnt      = CHECK_NUM_ANT;
+        search.invRn       = invRn;
+        search.azimTab     = azimTab;
+        search.elevTab     = elevTab;
+        search.azimLen     = CHECK_GRID_LEN;
+        search.elevLen     = CHECK_GRID_LEN;
+        search.azimStride  = CHECK_GRID_LEN;
+        search.elevStride  = 1;
+        search.steeringVec = steeringVec;
+        search.azimOffset  = azimBin * CHECK_ZOOMIN_FACTOR - CHECK_ZOOMIN_FACTOR;
+        search.elevOffset  = elevBin * CHECK_ZOOMIN_FACTOR - CHECK_ZOOMIN_FACTOR;
+
+        /* dense search */
+        search.heatMap = denseMap;
+        search.minVal  = 1.0e25f;
+        for (i = 0; i < CHECK_GRID_LEN * CHECK_GRID_LEN; i++)
+            denseMap[i] = -1.f;
+        denseMax  = 0.f;
+        denseAzim = 0;
+        denseElev = 0;
+        for (i = 0; i < CHECK_GRID_LEN; i++)
+        {
+            for (j = 0; j < CHECK_GRID_LEN; j++)
+            {
+                if (RADARDEMO_aoaEst2DCaponBF_aeHierEval(&search, i, j) > denseMax)
+                {
+                    denseMax  = denseMap[i * CHECK_GRID_LEN + j];
+                    denseAzim = i;
+                    denseElev = j;
+                }
+            }
+        }
+        Check_angle(azimBin, elevBin, denseAzim, denseElev, &a0, &e0);
+
+        /* hierarchical search, without cache */
+        search.heatMap = hierMap;
+        for (step = CHECK_MIN_STEP; step <= CHECK_MAX_STEP; step++)
+        {
+            gCheckNumEval = 0;
+            hierMax = RADARDEMO_aoaEst2DCaponBF_aeHierSearch(&search, step, &azimIdx, &elevIdx);
+            numEval[step] += gCheckNumEval;
+
+            /* local maximum of the dense spectrum */
+            for (i = azimIdx - 1; i <= azimIdx + 1; i++)
+                for (j = elevIdx - 1; j <= elevIdx + 1; j++)
+                    if ((i >= 0) && (i < CHECK_GRID_LEN) && (j >= 0) && (j < CHECK_GRID_LEN) &&
+                        (denseMap[i * CHECK_GRID_LEN + j] > hierMax))
+                        numFailed++;
+
+            if ((azimIdx != denseAzim) || (elevIdx != denseElev))
+            {
+                numDiff[step]++;
+                Check_angle(azimBin, elevBin, azimIdx, elevIdx, &a1, &e1);
+                errAzim = fabs(a1 - a0);
+                errElev = fabs(e1 - e0);
+                sumErrAzim[step] += errAzim;
+                sumErrElev[step] += errElev;
+                if (errAzim > maxErrAzim[step])
+                    maxErrAzim[step] = errAzim;
+                if (errElev > maxErrElev[step])
+                    maxErrElev[step] = errElev;
+                if (10.0 * log10(denseMax / hierMax) > maxLossDb[step])
+                    maxLossDb[step] = 10.0 * log10(denseMax / hierMax);
+                if ((abs(azimIdx - denseAzim) > RADARDEMO_AOAEST2D_HIER_TOL_POINTS) ||
+                    (abs(elevIdx - denseElev) > RADARDEMO_AOAEST2D_HIER_TOL_POINTS))
+                {
+                    numOutTol[step]++;
+                    numFailed++;
+                }
+            }
+        }
+
+        /* two neighboring detections of the range bin at step 2, with and without the cache: same peaks */
+        for (i = 0; i < RADARDEMO_AOAEST2D_AECACHE_SIZE; i++)
+            cache[i].azimIdx = RADARDEMO_AOAEST2D_AECACHE_INVALID;
+        for (det = 0; det < 2; det++)
+        {
+            Check_azimTab(azimTab, azimBin + det);
+            search.azimOffset = (azimBin + det) * CHECK_ZOOMIN_FACTOR - CHECK_ZOOMIN_FACTOR;
+            search.cache      = NULL;
+            gCheckNumEval     = 0;
+            RADARDEMO_aoaEst2DCaponBF_aeHierSearch(&search, 2, &azimIdx, &elevIdx);
+            evalNoCache      += gCheckNumEval;
+            search.cache      = cache;
+            gCheckNumEval     = 0;
+            RADARDEMO_aoaEst2DCaponBF_aeHierSearch(&search, 2, &cacheAzim, &cacheElev);
+            evalCache        += gCheckNumEval;
+            if ((cacheAzim != azimIdx) || (cacheElev != elevIdx))
+                numFailed++;
+        }
+    }
+
+    printf("%d scenes, %d x %d zoom-in points, dense peak tolerance %d point(s)\n", numScenes, CHECK_GRID_LEN,
+           CHECK_GRID_LEN, RADARDEMO_AOAEST2D_HIER_TOL_POINTS);
+    for (step = CHECK_MIN_STEP; step <= CHECK_MAX_STEP; step++)
+    {
+        printf("step %d: %5.1f points, peak differs in %3ld scenes (%.2f%%), %ld beyond tolerance; "
+               "error azim mean %.2f max %.2f deg, elev mean %.2f max %.2f deg, peak loss max %.2f dB\n",
+               step, (double)numEval[step] / numScenes / CHECK_NUM_ANT, numDiff[step], 100.0 * numDiff[step] / numScenes,
+               numOutTol[step], (numDiff[step] != 0) ? sumErrAzim[step] / numDiff[step] : 0.0, maxErrAzim[step],
+               (numDiff[step] != 0) ? sumErrElev[step] / numDiff[step] : 0.0, maxErrElev[step], maxLossDb[step]);
+    }
+    printf("2 neighboring detections at step 2: %.1f points computed without the cache, %.1f with\n",
+           (double)evalNoCache / numScenes / CHECK_NUM_ANT, (double)evalCache / numScenes / CHECK_NUM_ANT);
+    printf("%s: %ld failed checks\n", (numFailed == 0) ? "PASS" : "FAIL", numFailed);
+    return (numFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the hierarchical angle search on the host
+#
+#   RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check.sh [numScenes]
+#
+# The search functions and their types are extracted from RADARDEMO_aoaEst2DCaponBF_angleEst.c and
+# RADARDEMO_aoaEst2DCaponBF_priv.h, so the check runs the code of the module.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+DSS_DIR="$TOOLS_DIR/../../../../../../.."
+BUILD_DIR=${BUILD_DIR:-./RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+{
+    cat "$TOOLS_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host_shim.h"
+    sed -n '/^#define RADARDEMO_AOAEST2D_AECACHE_SIZE/,/^} RADARDEMO_aoaEst2D_aeSearch;/p' \
+        "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_priv.h"
+    echo 'float RADARDEMO_aoaEst2DCaponBF_aeHierEval(RADARDEMO_aoaEst2D_aeSearch *search, int32_t azimIdx, int32_t elevIdx);'
+    echo 'float RADARDEMO_aoaEst2DCaponBF_aeHierSearch(RADARDEMO_aoaEst2D_aeSearch *search, int32_t coarseStep, int32_t *maxAzimInd, int32_t *maxElevInd);'
+} > "$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host.h"
+{
+    echo '#include "RADARDEMO_aoaEst2DCaponBF_hierSearch_host.h"'
+    awk '/^\/\* next point of the coarse grid/ { on = 1 }
+         on { print }
+         on && /^float RADARDEMO_aoaEst2DCaponBF_aeHierSearch\(/ { last = 1 }
+         on && last && /^}/ { exit }' "$SRC_DIR/RADARDEMO_aoaEst2DCaponBF_angleEst.c"
+} > "$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host.c"
+
+$CC -O2 -Wall -std=gnu99 -D_LITTLE_ENDIAN -I "$DSS_DIR" -I "$BUILD_DIR" -o "$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check" \
+    "$TOOLS_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check.c" "$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host.c" -lm
+"$BUILD_DIR/RADARDEMO_aoaEst2DCaponBF_hierSearch_host_check" "$@"
@@ -0,0 +1,537 @@
+/**
+ *   @file  RADARDEMO_aoaEst2DCaponBF_steerVec_host_check.c
+ *
+ *   @brief
+ *      Host check of the separable range-azimuth-elevation steering vectors of the 2D Capon heatmap.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEst2DCaponBF_steerVec_host_check [timing]
+ *
+ *  Heatmaps: for the 16 antenna array of the shipped antGeometry0/1, random antenna phase rotations and unit modulus
+ *  calibration vectors, and range-azimuth-elevation grids from the shipped fovCfg 75 75 and searchStep 8 to 1936
+ *  angle bins, the steering vectors are built as RADARDEMO_aoaEst2DCaponBF_create() builds them: the stored table of
+ *  RADARDEMO_AOAEST2D_STEERVEC_TABLE from the phase of each angle bin, the azimuth and elevation tables of
+ *  RADARDEMO_AOAEST2D_STEERVEC_SEPARABLE. cossp_i() and sinsp_i() are the host cos() and sin() in the check. On
+ *  random inverse covariance matrices with 0 to 3 sources, for Capon and conventional beamforming:
+ *  - RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable() with the block size of RADARDEMO_aoaEst2DCaponBF_create(), and
+ *    with every larger block size, must equal bit for bit RADARDEMO_aoaEst2DCaponBF_raHeatmap() on a table of the
+ *    products of the azimuth and elevation vectors, peak value included
+ *  - its error to a'*invRn*a computed in double precision, relative to each heatmap value and the largest over the
+ *    scenes of a grid, must be at most CHECK_ERR_RATIO times that of RADARDEMO_aoaEst2DCaponBF_raHeatmap() on the
+ *    stored table, plus CHECK_ERR_FLOOR: the product and the phase of the angle bin round differently, and both
+ *    errors grow with the dynamic range of the heatmap, the single precision quadratic form losing digits at the
+ *    sidelobe nulls of strong sources
+ *  - RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy() from the azimuth and elevation tables must equal the product
+ *    table bit for bit, and match the stored table within CHECK_VEC_TOL
+ *  The check prints the steering vector memory of both modes per grid.
+ *
+ *  timing: also measures the heatmap of a range bin with the stored table and with the generated blocks on the host.
+ *  The C66x cycles are measured by the target build with RADARDEMO_AOAEST2D_STEERVEC_BENCHMARK.
+ *  The exit status is 0 if all the checks pass.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include <source/dpu/capon3d_overhead/modules/DoA/CaponBF2D/src/RADARDEMO_aoaEst2DCaponBF_priv.h>
+
+#define CHECK_PI            (3.141592653589793)
+#define CHECK_NUM_ANT       (16)
+#define CHECK_RN_LEN        (CHECK_NUM_ANT * (CHECK_NUM_ANT + 1) / 2)
+#define CHECK_MAX_BINS      (2048)
+#define CHECK_NUM_TRIALS    (20)
+/* relative error of the separable heatmaps to double precision, at most CHECK_ERR_RATIO times that of the stored
+ * table plus CHECK_ERR_FLOOR */
+#define CHECK_ERR_RATIO     (2.0)
+#define CHECK_ERR_FLOOR     (1e-6)
+/* relative difference of the separable and the stored steering vectors */
+#define CHECK_VEC_TOL       (1e-5)
+
+/* The fields of the module handle the block size is computed from */
+typedef struct
+{
+    RADARDEMO_aoaEst2D_RAHeatMap_handle *raHeatMap_handle;
+} Check_handle;
+
+/* Check_blockRows(): the block size code of RADARDEMO_aoaEst2DCaponBF_create() */
+#include "RADARDEMO_aoaEst2DCaponBF_steerVec_blockRows.h"
+
+/* shipped antGeometry0/1, made non-negative as MmwDemo_calcActiveAntennaGeometry() does */
+static const int32_t gCheckMInd[CHECK_NUM_ANT] = {2, 2, 3, 3, 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3};
+static const int32_t gCheckNInd[CHECK_NUM_ANT] = {0, 1, 1, 0, 0, 1, 1, 0, 2, 3, 3, 2, 2, 3, 3, 2};
+
+/* fovCfg azimuth and elevation, searchStep */
+static const float gCheckGrid[][3] = {{75.f, 75.f, 8.f}, {75.f, 75.f, 4.f}, {60.f, 20.f, 4.f}, {75.f, 30.f, 6.f}, {45.f, 45.f, 2.f}};
+
+static int32_t gCheckPhaseRot[CHECK_NUM_ANT];
+static cplxf_t gCheckPhaseComp[CHECK_NUM_ANT];
+static uint8_t gCheckAnt2Proc[CHECK_NUM_ANT];
+
+static cplxf_t gCheckTable[CHECK_MAX_BINS * CHECK_NUM_ANT];
+static cplxf_t gCheckProd[CHECK_MAX_BINS * CHECK_NUM_ANT];
+static cplxf_t gCheckAzim[CHECK_MAX_BINS * CHECK_NUM_ANT];
+static cplxf_t gCheckElev[CHECK_MAX_BINS * CHECK_NUM_ANT];
+static cplxf_t gCheckBlock[CHECK_MAX_BINS * CHECK_NUM_ANT];
+static cplxf_t gCheckInvRn[CHECK_RN_LEN];
+static float   gCheckHmTable[CHECK_MAX_BINS];
+static float   gCheckHmProd[CHECK_MAX_BINS];
+static float   gCheckHmSep[CHECK_MAX_BINS];
+static uint32_t gCheckScratch[2 * CHECK_NUM_ANT * CHECK_NUM_ANT];
+static double  gCheckRef[CHECK_MAX_BINS];
+
+static struct
+{
+    int32_t numRuns;
+    double  maxErrSep;
+    double  maxErrTable;
+    double  maxRelDiffHm;
+    double  maxRelDiffVec;
+} gCheckStats;
+
+static uint32_t gCheckSeed = 1U;
+
+static double Check_rand(void)
+{
+    gCheckSeed = gCheckSeed * 1664525U + 1013904223U;
+    return (double)(gCheckSeed >> 8) / 16777216.0;
+}
+
+static cplxf_t Check_cplx(float re, float im)
+{
+    cplxf_t c;
+
+    c.real = re;
+    c.imag = im;
+    return (c);
+}
+
+static cplxf_t Check_mpy(cplxf_t x, cplxf_t y)
+{
+    __float2_t r = _complex_mpysp(_ftof2(x.real, x.imag), _ftof2(y.real, y.imag));
+
+    return (Check_cplx(_hif2(r), _lof2(r)));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Heatmap handle and steering vectors of a grid, as RADARDEMO_aoaEst2DCaponBF_create() sets them for detection
+ *      method 2: the stored table from the phase of each angle bin, the azimuth and elevation tables, and the table
+ *      of their products.
+ */
+static void Check_grid(const float *grid, RADARDEMO_aoaEst2D_RAHeatMap_handle *hm)
+{
+    float   fov0, fov1, azim, elev, phase;
+    int32_t i, j, k, azimLen, elevLen;
+    cplxf_t a;
+
+    memset(hm, 0, sizeof(*hm));
+    hm->nRxAnt          = CHECK_NUM_ANT;
+    hm->virtAntInd2Proc = gCheckAnt2Proc;
+    hm->scratchPad      = gCheckScratch;
+    fov0                = grid[0] - grid[2];
+    fov1                = grid[1] - grid[2];
+    hm->nuInit          = -(float)sin(fov0 * CHECK_PI / 180.0);
+    hm->nuStep          = -hm->nuInit * grid[2] * (1.f / fov0);
+    hm->muInit          = -(float)sin(fov1 * CHECK_PI / 180.0);
+    hm->muStep          = -hm->muInit * grid[2] * (1.f / fov1);
+    hm->azimSearchLen   = (uint16_t)(floor(2.f * fov0 / grid[2]) + 1);
+    hm->elevSearchLen   = (uint16_t)(floor(2.f * fov1 / grid[2]) + 1);
+    azimLen             = hm->azimSearchLen;
+    elevLen             = hm->elevSearchLen;
+
+    for (k = 0, azim = hm->nuInit; k < azimLen; k++, azim += hm->nuStep)
+    {
+        for (j = 0; j < CHECK_NUM_ANT; j++)
+        {
+            phase = -(float)CHECK_PI * gCheckMInd[j] * azim;
+            a = Check_cplx((float)cos(phase) * (float)gCheckPhaseRot[j], (float)sin(phase) * (float)gCheckPhaseRot[j]);
+            gCheckAzim[k * CHECK_NUM_ANT + j] = Check_mpy(a, gCheckPhaseComp[j]);
+        }
+    }
+    for (i = 0, elev = hm->muInit; i < elevLen; i++, elev += hm->muStep)
+    {
+        for (j = 0; j < CHECK_NUM_ANT; j++)
+        {
+            phase = -(float)CHECK_PI * gCheckNInd[j] * elev;
+            gCheckElev[i * CHECK_NUM_ANT + j] = Check_cplx((float)cos(phase), (float)sin(phase));
+        }
+    }
+    for (i = 0, elev = hm->muInit; i < elevLen; i++, elev += hm->muStep)
+    {
+        for (k = 0, azim = hm->nuInit; k < azimLen; k++, azim += hm->nuStep)
+        {
+            for (j = 0; j < CHECK_NUM_ANT; j++)
+            {
+                phase = -(float)CHECK_PI * (gCheckMInd[j] * azim + gCheckNInd[j] * elev);
+                a = Check_cplx((float)cos(phase) * (float)gCheckPhaseRot[j], (float)sin(phase) * (float)gCheckPhaseRot[j]);
+                gCheckTable[(i * azimLen + k) * CHECK_NUM_ANT + j] = Check_mpy(a, gCheckPhaseComp[j]);
+                gCheckProd[(i * azimLen + k) * CHECK_NUM_ANT + j] = Check_mpy(gCheckAzim[k * CHECK_NUM_ANT + j],
+                                                                              gCheckElev[i * CHECK_NUM_ANT + j]);
+            }
+        }
+    }
+
+    hm->steeringVecAzim  = gCheckAzim;
+    hm->steeringVecElev  = gCheckElev;
+    hm->steeringVecBlock = gCheckBlock;
+    hm->steeringVec      = NULL;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Random inverse covariance matrix, upper triangle of (I + sum of the sources) scaled: Hermitian, positive
+ *      definite, with the peaks of up to 3 sources on the stored table.
+ */
+static void Check_invRn(int32_t numAngleBins)
+{
+    double  re[CHECK_NUM_ANT][CHECK_NUM_ANT], im[CHECK_NUM_ANT][CHECK_NUM_ANT], srcPow;
+    int32_t s, i, j, k, bin, numSrc;
+    cplxf_t *a;
+
+    memset(re, 0, sizeof(re));
+    memset(im, 0, sizeof(im));
+    for (i = 0; i < CHECK_NUM_ANT; i++)
+        re[i][i] = 1.0;
+    numSrc = (int32_t)(Check_rand() * 4.0);
+    for (s = 0; s < numSrc; s++)
+    {
+        bin = (int32_t)(Check_rand() * numAngleBins);
+        a   = &gCheckTable[bin * CHECK_NUM_ANT];
+        srcPow = pow(10.0, 3.0 * Check_rand());
+        for (i = 0; i < CHECK_NUM_ANT; i++)
+        {
+            for (j = 0; j < CHECK_NUM_ANT; j++)
+            {
+                re[i][j] += srcPow * ((double)a[i].real * a[j].real + (double)a[i].imag * a[j].imag);
+                im[i][j] += srcPow * ((double)a[i].imag * a[j].real - (double)a[i].real * a[j].imag);
+            }
+        }
+    }
+    for (i = 0, k = 0; i < CHECK_NUM_ANT; i++)
+    {
+        for (j = i; j < CHECK_NUM_ANT; j++, k++)
+            gCheckInvRn[k] = Check_cplx((float)(re[i][j] * 1e-2), (float)(im[i][j] * 1e-2));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      a'*invRn*a in double precision for the angle bins of a grid, a computed in double precision from the same
+ *      azimuth and elevation values: the heatmap of conventional beamforming, its inverse for Capon beamforming.
+ */
+static void Check_refHeatmap(const RADARDEMO_aoaEst2D_RAHeatMap_handle *hm, double *ref)
+{
+    double  aRe[CHECK_NUM_ANT], aIm[CHECK_NUM_ANT], phase, cRe, cIm, q;
+    float   azim, elev;
+    int32_t i, k, m, n, r;
+
+    for (i = 0, elev = hm->muInit; i < hm->elevSearchLen; i++, elev += hm->muStep)
+    {
+        for (k = 0, azim = hm->nuInit; k < hm->azimSearchLen; k++, azim += hm->nuStep)
+        {
+            for (m = 0; m < CHECK_NUM_ANT; m++)
+            {
+                phase  = -CHECK_PI * (gCheckMInd[m] * (double)azim + gCheckNInd[m] * (double)elev);
+                cRe    = cos(phase) * gCheckPhaseRot[m];
+                cIm    = sin(phase) * gCheckPhaseRot[m];
+                aRe[m] = cRe * gCheckPhaseComp[m].real - cIm * gCheckPhaseComp[m].imag;
+                aIm[m] = cRe * gCheckPhaseComp[m].imag + cIm * gCheckPhaseComp[m].real;
+            }
+            q = 0.0;
+            for (m = 0, r = 0; m < CHECK_NUM_ANT; m++)
+            {
+                q += gCheckInvRn[r++].real * (aRe[m] * aRe[m] + aIm[m] * aIm[m]);
+                for (n = m + 1; n < CHECK_NUM_ANT; n++, r++)
+                {
+                    /* 2 Re(conj(a(m)) * invRn(m, n) * a(n)) */
+                    cRe = aRe[m] * gCheckInvRn[r].real + aIm[m] * gCheckInvRn[r].imag;
+                    cIm = aRe[m] * gCheckInvRn[r].imag - aIm[m] * gCheckInvRn[r].real;
+                    q  += 2.0 * (cRe * aRe[n] - cIm * aIm[n]);
+                }
+            }
+            ref[i * hm->azimSearchLen + k] = q;
+        }
+    }
+}
+
+static uint32_t Check_maxRelErr(const float *x, const double *ref, int32_t bfFlag, int32_t n, double *maxRel)
+{
+    uint32_t numNonFinite = 0;
+    double   d, r;
+    int32_t  i;
+
+    for (i = 0; i < n; i++)
+    {
+        if (!isfinite(x[i]))
+        {
+            numNonFinite++;
+            continue;
+        }
+        r = bfFlag ? (1.0 / ref[i]) : ref[i];
+        d = fabs((double)x[i] - r) / fabs(r);
+        if (d > *maxRel)
+            *maxRel = d;
+    }
+    return (numNonFinite);
+}
+
+static uint32_t Check_maxRelDiff(const float *x, const float *ref, int32_t n, double *maxRel)
+{
+    uint32_t numNonFinite = 0;
+    double   d;
+    int32_t  i;
+
+    for (i = 0; i < n; i++)
+    {
+        if (!isfinite(x[i]) || !isfinite(ref[i]))
+        {
+            numNonFinite++;
+            continue;
+        }
+        d = fabs((double)x[i] - (double)ref[i]) / fabs((double)ref[i]);
+        if (d > *maxRel)
+            *maxRel = d;
+    }
+    return (numNonFinite);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Heatmaps of a grid, separable against the product table bit for bit, and against the stored table.
+ */
+static int32_t Check_heatmaps(int32_t g)
+{
+    RADARDEMO_aoaEst2D_RAHeatMap_handle hm, hmTable;
+    Check_handle handle;
+    int32_t  t, bfFlag, rows, minRows, azimLen, elevLen, numAngleBins, i, j, numFail = 0;
+    float    maxTable, maxProd, maxSep;
+    cplxf_t  vecIn[CHECK_NUM_ANT], vecSep[CHECK_NUM_ANT], vecProd[CHECK_NUM_ANT], vecTable[CHECK_NUM_ANT];
+    double   rel, errTable, errSep, gridErrTable = 0.0, gridErrSep = 0.0;
+
+    for (i = 0; i < CHECK_NUM_ANT; i++)
+    {
+        gCheckPhaseRot[i]  = (Check_rand() < 0.5) ? -1 : 1;
+        rel                = 2.0 * CHECK_PI * Check_rand();
+        /* unit modulus: the heatmap kernel takes the diagonal of invRn as is */
+        gCheckPhaseComp[i] = Check_cplx((float)cos(rel), (float)sin(rel));
+    }
+    Check_grid(gCheckGrid[g], &hm);
+    azimLen      = hm.azimSearchLen;
+    elevLen      = hm.elevSearchLen;
+    numAngleBins = azimLen * elevLen;
+    handle.raHeatMap_handle = &hm;
+    Check_blockRows(&handle);
+    minRows      = hm.steerVecBlockRows;
+
+    printf("grid %2.0f %2.0f step %.0f: %2d x %2d angle bins, blocks of %d rows, steering vectors %6d bytes stored, "
+           "%5d bytes separable\n", gCheckGrid[g][0], gCheckGrid[g][1], gCheckGrid[g][2], azimLen, elevLen, minRows,
+           (int32_t)(numAngleBins * CHECK_NUM_ANT * sizeof(cplxf_t)),
+           (int32_t)((azimLen + elevLen + minRows * azimLen) * CHECK_NUM_ANT * sizeof(cplxf_t)));
+
+    for (t = 0; t < CHECK_NUM_TRIALS; t++)
+    {
+        Check_invRn(numAngleBins);
+        Check_refHeatmap(&hm, gCheckRef);
+        for (bfFlag = 0; bfFlag <= 1; bfFlag++)
+        {
+            RADARDEMO_aoaEst2DCaponBF_raHeatmap(bfFlag, CHECK_NUM_ANT, CHECK_NUM_ANT, azimLen, elevLen, gCheckTable, NULL,
+                                                gCheckAnt2Proc, (int32_t *)gCheckScratch, gCheckInvRn, &maxTable, gCheckHmTable);
+            RADARDEMO_aoaEst2DCaponBF_raHeatmap(bfFlag, CHECK_NUM_ANT, CHECK_NUM_ANT, azimLen, elevLen, gCheckProd, NULL,
+                                                gCheckAnt2Proc, (int32_t *)gCheckScratch, gCheckInvRn, &maxProd, gCheckHmProd);
+            for (rows = minRows; rows <= elevLen; rows++)
+            {
+                hm.steerVecBlockRows = (uint16_t)rows;
+                memset(gCheckHmSep, 0xFF, sizeof(gCheckHmSep));
+                RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(bfFlag, &hm, CHECK_NUM_ANT, gCheckInvRn, &maxSep, gCheckHmSep);
+                gCheckStats.numRuns++;
+                if ((memcmp(gCheckHmSep, gCheckHmProd, numAngleBins * sizeof(float)) != 0) || (maxSep != maxProd))
+                {
+                    printf("    FAIL: grid %d trial %d bfFlag %d blocks of %d rows differ from the product table\n",
+                           g, t, bfFlag, rows);
+                    numFail++;
+                }
+                if (rows == minRows)
+                {
+                    errTable = 0.0;
+                    errSep   = 0.0;
+                    if ((Check_maxRelErr(gCheckHmTable, gCheckRef, bfFlag, numAngleBins, &errTable) != 0) ||
+                        (Check_maxRelErr(gCheckHmSep, gCheckRef, bfFlag, numAngleBins, &errSep) != 0))
+                    {
+                        printf("    FAIL: grid %d trial %d bfFlag %d heatmap not finite\n", g, t, bfFlag);
+                        numFail++;
+                    }
+                    gridErrTable = (errTable > gridErrTable) ? errTable : gridErrTable;
+                    gridErrSep   = (errSep > gridErrSep) ? errSep : gridErrSep;
+                    (void)Check_maxRelDiff(gCheckHmSep, gCheckHmTable, numAngleBins, &gCheckStats.maxRelDiffHm);
+                    gCheckStats.maxErrTable = (errTable > gCheckStats.maxErrTable) ? errTable : gCheckStats.maxErrTable;
+                    gCheckStats.maxErrSep   = (errSep > gCheckStats.maxErrSep) ? errSep : gCheckStats.maxErrSep;
+                }
+            }
+            hm.steerVecBlockRows = (uint16_t)minRows;
+        }
+
+        /* one angle bin */
+        hmTable             = hm;
+        hmTable.steeringVec = gCheckTable;
+        i = (int32_t)(Check_rand() * azimLen);
+        j = (int32_t)(Check_rand() * elevLen);
+        for (rows = 0; rows < CHECK_NUM_ANT; rows++)
+            vecIn[rows] = Check_cplx((float)(Check_rand() - 0.5), (float)(Check_rand() - 0.5));
+        RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(&hm, CHECK_NUM_ANT, i, j, vecIn, vecSep);
+        RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(&hmTable, CHECK_NUM_ANT, i, j, vecIn, vecTable);
+        hmTable.steeringVec = gCheckProd;
+        RADARDEMO_aoaEst2DCaponBF_raSteeringVecMpy(&hmTable, CHECK_NUM_ANT, i, j, vecIn, vecProd);
+        if (memcmp(vecSep, vecProd, sizeof(vecSep)) != 0)
+        {
+            printf("    FAIL: grid %d trial %d steering vector of bin %d %d differs from the product table\n", g, t, i, j);
+            numFail++;
+        }
+        for (rows = 0; rows < CHECK_NUM_ANT; rows++)
+        {
+            rel = hypot((double)vecSep[rows].real - vecTable[rows].real, (double)vecSep[rows].imag - vecTable[rows].imag) /
+                  hypot((double)vecTable[rows].real, (double)vecTable[rows].imag);
+            if (rel > gCheckStats.maxRelDiffVec)
+                gCheckStats.maxRelDiffVec = rel;
+            if (rel > CHECK_VEC_TOL)
+            {
+                printf("    FAIL: grid %d trial %d steering vector of bin %d %d, relative difference %.3g to the stored table\n",
+                       g, t, i, j, rel);
+                numFail++;
+            }
+        }
+    }
+    printf("    relative error to double precision: %.2g separable, %.2g stored table\n", gridErrSep, gridErrTable);
+    if (gridErrSep > CHECK_ERR_RATIO * gridErrTable + CHECK_ERR_FLOOR)
+    {
+        printf("    FAIL: grid %d relative error %.3g, %.3g with the stored table\n", g, gridErrSep, gridErrTable);
+        numFail++;
+    }
+    return (numFail);
+}
+
+static double Check_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9 + (double)ts.tv_nsec);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function measures on the host the Capon heatmap of a range bin with the stored table, with the blocks
+ *      of RADARDEMO_aoaEst2DCaponBF_create() and with one block of the whole grid.
+ */
+static void Check_timing(void)
+{
+    RADARDEMO_aoaEst2D_RAHeatMap_handle hm;
+    Check_handle handle;
+    int32_t g, rep, minRows, numRep;
+    double  t0, tTable, tBlock, tWhole;
+    float   maxVal;
+    volatile float sink = 0.f;
+
+    for (g = 0; g < (int32_t)(sizeof(gCheckGrid) / sizeof(gCheckGrid[0])); g++)
+    {
+        Check_grid(gCheckGrid[g], &hm);
+        handle.raHeatMap_handle = &hm;
+        Check_blockRows(&handle);
+        minRows = hm.steerVecBlockRows;
+        Check_invRn(hm.azimSearchLen * hm.elevSearchLen);
+        numRep  = 2000000 / (hm.azimSearchLen * hm.elevSearchLen);
+
+        t0 = Check_now();
+        for (rep = 0; rep < numRep; rep++)
+        {
+            RADARDEMO_aoaEst2DCaponBF_raHeatmap(1, CHECK_NUM_ANT, CHECK_NUM_ANT, hm.azimSearchLen, hm.elevSearchLen, gCheckTable,
+                                                NULL, gCheckAnt2Proc, (int32_t *)gCheckScratch, gCheckInvRn, &maxVal, gCheckHmTable);
+            sink += maxVal;
+        }
+        tTable = (Check_now() - t0) / numRep;
+
+        t0 = Check_now();
+        for (rep = 0; rep < numRep; rep++)
+        {
+            RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(1, &hm, CHECK_NUM_ANT, gCheckInvRn, &maxVal, gCheckHmSep);
+            sink += maxVal;
+        }
+        tBlock = (Check_now() - t0) / numRep;
+
+        hm.steerVecBlockRows = hm.elevSearchLen;
+        t0 = Check_now();
+        for (rep = 0; rep < numRep; rep++)
+        {
+            RADARDEMO_aoaEst2DCaponBF_raHeatmapSeparable(1, &hm, CHECK_NUM_ANT, gCheckInvRn, &maxVal, gCheckHmSep);
+            sink += maxVal;
+        }
+        tWhole = (Check_now() - t0) / numRep;
+
+        printf("timing: %2d x %2d angle bins, per range bin: stored %7.0f ns, blocks of %d rows %7.0f ns (%+.1f %%), "
+               "one block %7.0f ns (%+.1f %%)\n", hm.azimSearchLen, hm.elevSearchLen, tTable, minRows, tBlock,
+               100.0 * (tBlock / tTable - 1.0), tWhole, 100.0 * (tWhole / tTable - 1.0));
+    }
+    (void)sink;
+}
+
+int main(int argc, char **argv)
+{
+    int32_t g, i, numFail = 0;
+
+    for (i = 0; i < CHECK_NUM_ANT; i++)
+        gCheckAnt2Proc[i] = (uint8_t)i;
+
+    for (g = 0; g < (int32_t)(sizeof(gCheckGrid) / sizeof(gCheckGrid[0])); g++)
+        numFail += Check_heatmaps(g);
+    printf("%d separable heatmaps equal to the product table bit for bit\n", gCheckStats.numRuns);
+    printf("relative error to double precision: %.2g separable, %.2g stored table; relative difference to the stored "
+           "table %.2g (heatmaps), %.2g (steering vectors)\n", gCheckStats.maxErrSep, gCheckStats.maxErrTable,
+           gCheckStats.maxRelDiffHm, gCheckStats.maxRelDiffVec);
+
+    if ((argc > 1) && (strcmp(argv[1], "timing") == 0))
+        Check_timing();
+
+    printf("%s: %d failed checks\n", numFail == 0 ? "PASS" : "FAIL", numFail);
+    return (numFail == 0 ? 0 : 1);
+}
@@ -43,6 +43,7 @@
 #include <modules/utilities/radarOsal_malloc.h>
 #include <modules/DoA/common/api/RADARDEMO_aoaEst_commonDef.h>
 
+#define RADARDEMO_AOAESTDML_MAXNUMANT (16) /**< Maximum number of (virtual) antennas, 4 Tx by 4 Rx.*/
 
 /**
  *  \enum
@@ -63,8 +64,8 @@
 typedef enum
 {
     RADARDEMO_AOADML_NO_ERROR = 0, /**< no error */
-    RADARDEMO_AOADML_ANTSPACE_NOTSUPPORTED, /**< normalized antenna spacing non supported */
-    RADARDEMO_AOADML_NUMANT_NOTSUPPORTED, /**< number of antennas not supported */
+    RADARDEMO_AOADML_ANTSPACE_NOTSUPPORTED, /**< antenna positions missing, or all antennas at the same azimuth position */
+    RADARDEMO_AOADML_NUMANT_NOTSUPPORTED, /**< number of antennas not supported, less than 2 */
     RADARDEMO_AOADML_FAIL_ALLOCATE_HANDLE, /**< RADARDEMO_aoAEstDML_create failed to allocate handle */
     RADARDEMO_AOADML_FAIL_ALLOCATE_LOCALINSTMEM, /**< RADARDEMO_aoAEstDML_create failed to allocate memory for buffers in local instance  */
     RADARDEMO_AOADML_INOUTPTR_NOTCORRECT /**< input and/or output buffer for RADARDEMO_aoAEstDML_run are either NULL, or not aligned properly  */
@@ -74,24 +75,35 @@ typedef enum
 /**
  *  \struct   _RADARDEMO_aoAEstDML_config_
  *   {
- *  uint8_t        antSpacing;
+ *  uint8_t       *antSpacing;
+ *  uint8_t       *antRow;
  *  uint32_t      nRxAnt;
- *  uint32_t      estResolution;
- *  uint32_t      estRange;
+ *  float         estResolution;
+ *  float         estRange;
+ *  float         elevAngle;
  *  uint8_t       enableMultiStageSearch;
+ *  float         minimumOutputConf;
+ *  float         angleEstBound;
  *   }   RADARDEMO_aoAEstDML_config;
  *
  *  \brief   Structure element of the list of descriptors for RADARDEMO_aoAEstDML configuration.
  *
+ *  The antenna positions are the virtual antenna columns and rows in unit of lambda/2, as computed by
+ *  MmwDemo_calcActiveAntennaGeometry(). For a 2D array, the azimuth is estimated at the elevation elevAngle: the
+ *  output of RADARDEMO_aoAEst_output is an azimuth per estimate, and a joint azimuth-elevation search of 2 sources
+ *  would take (numAzim * numElev)^2 / 2 pairs, 7M for 121 azimuths by 31 elevations, against 630 cached pairs for
+ *  the first stage of a 141 angle azimuth search.
  *
  */
 
 typedef struct _RADARDEMO_aoAEstDML_config_
 {
-    uint8_t *antSpacing; /**< antenna spacing in unit of lambda/2, size of nRxAnt, only support uniform linear array*/
-    uint32_t nRxAnt; /**< number of receive antennas, only support 4 and 8 antennas now!!!.*/
+    uint8_t *antSpacing; /**< antenna position in azimuth (column) in unit of lambda/2, size of nRxAnt. Any linear or sparse array.*/
+    uint8_t *antRow; /**< antenna position in elevation (row) in unit of lambda/2, size of nRxAnt. NULL for a linear array.*/
+    uint32_t nRxAnt; /**< number of (virtual) receive antennas, 2 or more.*/
     float    estResolution; /**< Estimation resolution in degree.*/
     float    estRange; /**< Range of the estimation, from -estRange to +estRange degrees*/
+    float    elevAngle; /**< Elevation angle in degree of the azimuth search, only used if antRow is not NULL.*/
     uint8_t  enableMultiStageSearch; /**< Flag to indicate multi-step search is enabled. if 1 enabled, 0 disabled. */
     float    minimumOutputConf; /**< Minimum confidence range (in degree) for the output estimation. Estimates with bigger confidence range will not be reported.*/
     float    angleEstBound; /**< the boundary of the estimates. Angle estimates outside [-angleEstBound angleEstBound] will be filtered out.*/
@@ -51,16 +51,6 @@
 #define PISQROVER180    (3.141592653589793 * 3.141592653589793f / 180.0)
 #define PI              (3.141592653589793f)
 
-/*
-extern int32_t  RADARDEMO_aoaEstimationDML_generic(
-                            IN  cplxf_t * Rn,
-                            IN  cplxf_t * steeringVec,
-                            IN  int32_t steeringVecSize,
-                            IN  float   * scratchPad,
-                            IN  int32_t nRxAnt,
-                            OUT int32_t   * angleEst);
-*/
-
 /*!
    \fn     RADARDEMO_aoaEstimationDML_create
 
@@ -87,27 +77,45 @@ void *RADARDEMO_aoaEstimationDML_create(
 
 {
     uint32_t                    i, j;
-    double                      ftemp1, freal1, fimag1, frealJ, fimagJ;
+    double                      ftemp1, phase, sinElev, cosElev, posMean, posSpread;
+    double                      antPos[RADARDEMO_AOAESTDML_MAXNUMANT];
+    uint32_t                    numGridFirstStage;
     RADARDEMO_aoAEstDML_handle *handle;
-    // FILE *testSteerVec = fopen("steeringVec.bin","wb");
 
     *errorCode = RADARDEMO_AOADML_NO_ERROR;
 
-    /* Check antenna spacing, if it's not a uniform linear array, return with NULL */
-    if (moduleConfig->antSpacing[0] != 0)
+    /* Check number of antenna */
+    if ((moduleConfig->nRxAnt < 2) || (moduleConfig->nRxAnt > RADARDEMO_AOAESTDML_MAXNUMANT))
+        *errorCode = RADARDEMO_AOADML_NUMANT_NOTSUPPORTED;
+    if (moduleConfig->antSpacing == NULL)
         *errorCode = RADARDEMO_AOADML_ANTSPACE_NOTSUPPORTED;
-    for (i = 1; i < moduleConfig->nRxAnt; i++)
+    if (*errorCode > RADARDEMO_AOADML_NO_ERROR)
+        return (NULL);
+
+    /* Azimuth positions of the antennas at the search elevation, any linear, sparse or 2D geometry */
+    sinElev = 0.0;
+    cosElev = 1.0;
+    if (moduleConfig->antRow != NULL)
     {
-        if (moduleConfig->antSpacing[i] - moduleConfig->antSpacing[i - 1] != 1)
-            *errorCode = RADARDEMO_AOADML_ANTSPACE_NOTSUPPORTED;
+        sinElev = sin((double)moduleConfig->elevAngle * PIOVER180);
+        cosElev = cos((double)moduleConfig->elevAngle * PIOVER180);
     }
-    /* Check number of antenna , only supporting 4 and 8 at this point */
-    if ((moduleConfig->nRxAnt != 4) && (moduleConfig->nRxAnt != 8))
-        *errorCode = RADARDEMO_AOADML_NUMANT_NOTSUPPORTED;
-
-
-    if (*errorCode > RADARDEMO_AOADML_NO_ERROR)
+    posMean = 0.0;
+    for (i = 0; i < moduleConfig->nRxAnt; i++)
+    {
+        antPos[i] = (double)moduleConfig->antSpacing[i] * cosElev;
+        posMean += antPos[i];
+    }
+    posMean   = posMean / (double)moduleConfig->nRxAnt;
+    posSpread = 0.0;
+    for (i = 0; i < moduleConfig->nRxAnt; i++)
+        posSpread += (antPos[i] - posMean) * (antPos[i] - posMean);
+    /* All antennas in the same column, no azimuth aperture */
+    if (posSpread == 0.0)
+    {
+        *errorCode = RADARDEMO_AOADML_ANTSPACE_NOTSUPPORTED;
         return (NULL);
+    }
 
     handle = (RADARDEMO_aoAEstDML_handle *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 0, sizeof(RADARDEMO_aoAEstDML_handle), 1);
     if (handle == NULL)
@@ -121,6 +129,7 @@ void *RADARDEMO_aoaEstimationDML_create(
     handle->estResolution     = moduleConfig->estResolution;
     handle->minimumOutputConf = moduleConfig->minimumOutputConf;
     handle->angleEstBound     = moduleConfig->angleEstBound;
+    handle->posSpread         = (float)sqrt(posSpread);
 
     handle->steeringVecSize = (uint32_t)((2.f * handle->estRange) / (handle->estResolution)) + 1;
     if (moduleConfig->enableMultiStageSearch == 0)
@@ -140,6 +149,13 @@ void *RADARDEMO_aoaEstimationDML_create(
         else
             handle->firstStageSearchStep = 8;
     }
+    /* pair cache of numGrid * (numGrid - 1) / 2 * 12 bytes of LL2, numGrid = ceil(steeringVecSize / firstStageSearchStep):
+       7.4 KB for -70:1:70 degrees with a step of 4, 116 KB with a step of 1, which exceeds RADARDEMO_AOAESTDML_MAXPAIRCACHE
+       and is searched without cache */
+    numGridFirstStage = (handle->steeringVecSize + handle->firstStageSearchStep - 1) / handle->firstStageSearchStep;
+    handle->numPairs  = numGridFirstStage * (numGridFirstStage - 1) / 2;
+    if (handle->numPairs * (sizeof(cplxf_t) + sizeof(float)) > RADARDEMO_AOAESTDML_MAXPAIRCACHE)
+        handle->numPairs = 0;
 
     handle->steeringVec = (cplxf_t *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->nRxAnt * handle->steeringVecSize * sizeof(cplxf_t), 8);
     if (handle->steeringVec == NULL)
@@ -147,36 +163,47 @@ void *RADARDEMO_aoaEstimationDML_create(
         *errorCode = RADARDEMO_AOADML_FAIL_ALLOCATE_LOCALINSTMEM;
         return (handle);
     }
-    handle->scratchPad = (uint32_t *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 1, (5 * handle->steeringVecSize + 4 + 2 * handle->nRxAnt * handle->nRxAnt) * sizeof(uint32_t), 8);
+    handle->pairCoef = NULL;
+    handle->pairNorm = NULL;
+    if (handle->numPairs > 0)
+    {
+        handle->pairCoef = (cplxf_t *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->numPairs * sizeof(cplxf_t), 8);
+        handle->pairNorm = (float *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 0, handle->numPairs * sizeof(float), 8);
+        if ((handle->pairCoef == NULL) || (handle->pairNorm == NULL))
+        {
+            *errorCode = RADARDEMO_AOADML_FAIL_ALLOCATE_LOCALINSTMEM;
+            return (handle);
+        }
+    }
+    handle->scratchPad = (uint32_t *)radarOsal_memAlloc((uint8_t)RADARMEMOSAL_HEAPTYPE_LL2, 1, 4 * handle->steeringVecSize * sizeof(uint32_t), 8);
     if (handle->scratchPad == NULL)
     {
         *errorCode = RADARDEMO_AOADML_FAIL_ALLOCATE_LOCALINSTMEM;
         return (handle);
     }
 
-    /* Ant0's steeringVec is 1 for all angle possiblities, so we don't save them*/
+    /* a(theta) = exp(-1j*pi*(col*sin(theta)*cos(elev) + row*sin(elev))) */
     for (i = 0; i < handle->steeringVecSize; i++)
     {
-        ftemp1                                                 = (double)sin((-handle->estRange + (double)i * handle->estResolution) * (double)PIOVER180);
-        freal1                                                 = (double)cos(-PI * ftemp1);
-        fimag1                                                 = (double)sin(-PI * ftemp1);
-        frealJ                                                 = freal1;
-        fimagJ                                                 = fimag1;
-        handle->steeringVec[(handle->nRxAnt - 1) * i + 0].real = (float)frealJ;
-        handle->steeringVec[(handle->nRxAnt - 1) * i + 0].imag = (float)fimagJ;
-        for (j = 2; j < handle->nRxAnt; j++)
+        ftemp1 = (double)sin((-handle->estRange + (double)i * handle->estResolution) * (double)PIOVER180);
+        for (j = 0; j < handle->nRxAnt; j++)
         {
-            ftemp1                                                     = frealJ;
-            frealJ                                                     = frealJ * freal1 - fimagJ * fimag1;
-            fimagJ                                                     = ftemp1 * fimag1 + fimagJ * freal1;
-            handle->steeringVec[(handle->nRxAnt - 1) * i + j - 1].real = (float)frealJ;
-            handle->steeringVec[(handle->nRxAnt - 1) * i + j - 1].imag = (float)fimagJ;
+            phase = antPos[j] * ftemp1;
+            if (moduleConfig->antRow != NULL)
+                phase += (double)moduleConfig->antRow[j] * sinElev;
+            handle->steeringVec[handle->nRxAnt * i + j].real = (float)cos(-PI * phase);
+            handle->steeringVec[handle->nRxAnt * i + j].imag = (float)sin(-PI * phase);
         }
     }
 
-    // printf("handle->steeringVecSize = %d\n", handle->steeringVecSize);
-    // fwrite(handle->steeringVec, 4, handle->steeringVecSize * 6, testSteerVec);
-    // fclose(testSteerVec);
+    if (handle->numPairs > 0)
+        RADARDEMO_aoaEstimationDML_genPairCache(
+            handle->steeringVec,
+            handle->steeringVecSize,
+            handle->nRxAnt,
+            handle->firstStageSearchStep,
+            handle->pairCoef,
+            handle->pairNorm);
 
     return ((void *)handle);
 }
@@ -204,7 +231,12 @@ void RADARDEMO_aoaEstimationDML_delete(
     aoaEstDMLInst = (RADARDEMO_aoAEstDML_handle *)handle;
 
     radarOsal_memFree(aoaEstDMLInst->steeringVec, aoaEstDMLInst->steeringVecSize * aoaEstDMLInst->nRxAnt * sizeof(cplxf_t));
-    radarOsal_memFree(aoaEstDMLInst->scratchPad, aoaEstDMLInst->steeringVecSize * sizeof(uint32_t));
+    if (aoaEstDMLInst->numPairs > 0)
+    {
+        radarOsal_memFree(aoaEstDMLInst->pairCoef, aoaEstDMLInst->numPairs * sizeof(cplxf_t));
+        radarOsal_memFree(aoaEstDMLInst->pairNorm, aoaEstDMLInst->numPairs * sizeof(float));
+    }
+    radarOsal_memFree(aoaEstDMLInst->scratchPad, 4 * aoaEstDMLInst->steeringVecSize * sizeof(uint32_t));
 
     radarOsal_memFree(handle, sizeof(RADARDEMO_aoAEstDML_handle));
 }
@@ -239,7 +271,7 @@ RADARDEMO_aoAEstDML_errorCode RADARDEMO_aoaEstimationDML_run(
 {
     int32_t                       i, j, k;
     RADARDEMO_aoAEstDML_handle   *aoaEstDMLInst;
-    cplxf_t                      *Rn, *inputSignal;
+    cplxf_t                      *inputSignal;
     float                        *localScratch;
     int32_t                       angleEst[2];
     float                         normVar[2];
@@ -250,7 +282,7 @@ RADARDEMO_aoAEstDML_errorCode RADARDEMO_aoaEstimationDML_run(
     aoaEstDMLInst = (RADARDEMO_aoAEstDML_handle *)handle;
 
     inputSignal = input->inputAntSamples;
-    noiseP      = input->inputNoisePow / 4.f;
+    noiseP      = input->inputNoisePow / (float)aoaEstDMLInst->nRxAnt;
     if (inputSignal == NULL)
         errorCode = RADARDEMO_AOADML_INOUTPTR_NOTCORRECT;
     if (estOutput == NULL)
@@ -259,78 +291,43 @@ RADARDEMO_aoAEstDML_errorCode RADARDEMO_aoaEstimationDML_run(
         errorCode = RADARDEMO_AOADML_INOUTPTR_NOTCORRECT;
     if (aoaEstDMLInst->steeringVec == NULL)
         errorCode = RADARDEMO_AOADML_INOUTPTR_NOTCORRECT;
+    if ((aoaEstDMLInst->numPairs > 0) && ((aoaEstDMLInst->pairCoef == NULL) || (aoaEstDMLInst->pairNorm == NULL)))
+        errorCode = RADARDEMO_AOADML_INOUTPTR_NOTCORRECT;
     if (errorCode > RADARDEMO_AOADML_NO_ERROR)
         return (errorCode);
 
-    Rn           = (cplxf_t *)&aoaEstDMLInst->scratchPad[0];
-    localScratch = (float *)&aoaEstDMLInst->scratchPad[aoaEstDMLInst->nRxAnt * aoaEstDMLInst->nRxAnt * 2];
+    localScratch = (float *)&aoaEstDMLInst->scratchPad[0];
 
-    k = 0;
+    signalP = 0.f;
     for (i = 0; i < (int32_t)aoaEstDMLInst->nRxAnt; i++)
-    {
-        for (j = i; j < (int32_t)aoaEstDMLInst->nRxAnt; j++)
-        {
-            _amem8_f2(&Rn[k]) = _complex_conjugate_mpysp(_amem8_f2(&inputSignal[i]), _amem8_f2(&inputSignal[j]));
-            k++;
-        }
-    }
-    signalP = Rn[0].real + Rn[4].real + Rn[7].real + Rn[9].real;
-
-    /*
-        estOutput->numOutput = RADARDEMO_aoaEstimationDML_generic(
-                                Rn,
-                                aoaEstDMLInst->steeringVec,
-                                aoaEstDMLInst->steeringVecSize,
-                                localScratch,
-                                aoaEstDMLInst->nRxAnt,
-                                angleEst);
-
-            estOutput->outputAngles[0] = -(aoaEstDMLInst->estRange) + (float) angleEst[0] * aoaEstDMLInst->estResolution;
-            if (estOutput->numOutput > 1)
-                estOutput->outputAngles[1] = -(aoaEstDMLInst->estRange) + (float) angleEst[1] * aoaEstDMLInst->estResolution;
-
-    */
+        signalP += cmagsqsp_i(_amem8_f2(&inputSignal[i]));
+
+    estOutput->numOutput = RADARDEMO_aoaEstimationDML_generic(
+        inputSignal,
+        aoaEstDMLInst->steeringVec,
+        aoaEstDMLInst->steeringVecSize,
+        aoaEstDMLInst->nRxAnt,
+        aoaEstDMLInst->firstStageSearchStep,
+        aoaEstDMLInst->pairCoef,
+        aoaEstDMLInst->pairNorm,
+        localScratch,
+        normVar,
+        angleEst);
 
-    if (aoaEstDMLInst->nRxAnt == 4)
-    {
-        estOutput->numOutput = RADARDEMO_aoaEstimationDML_4ant(
-            Rn,
-            aoaEstDMLInst->steeringVec,
-            aoaEstDMLInst->steeringVecSize,
-            localScratch,
-            aoaEstDMLInst->firstStageSearchStep,
-            normVar,
-            angleEst);
-    }
-    else if (aoaEstDMLInst->nRxAnt == 8)
-    {
-        estOutput->numOutput = RADARDEMO_aoaEstimationDML_8ant(
-            Rn,
-            aoaEstDMLInst->steeringVec,
-            aoaEstDMLInst->steeringVecSize,
-            localScratch,
-            aoaEstDMLInst->firstStageSearchStep,
-            normVar,
-            angleEst);
-    }
     j            = 0;
     tempAngle[j] = -(aoaEstDMLInst->estRange) + (float)angleEst[0] * aoaEstDMLInst->estResolution;
     if ((tempAngle[j] <= aoaEstDMLInst->angleEstBound) && (tempAngle[j] >= -aoaEstDMLInst->angleEstBound))
     {
         k       = 0;
         dtemp1  = cos(tempAngle[j] * PIOVER180);
-        dwx[j]  = (float)dtemp1 * 2.236068f * (float)PISQROVER180; /* 2.236068 = sqrt(5)*/
+        dwx[j]  = (float)dtemp1 * aoaEstDMLInst->posSpread * (float)PISQROVER180; /* sqrt(5) for 4 antennas at lambda/2*/
         dwx[j]  = dwx[j] * dwx[j];
         dwt     = dwx[j] * signalP;
         ftemp1  = normVar[k];
-        temprcp = _rsqrsp(ftemp1);
-        temprcp = temprcp * (1.5f - (0.5f * ftemp1) * temprcp * temprcp);
-        temprcp = temprcp * (1.5f - (0.5f * ftemp1) * temprcp * temprcp);
+        temprcp = rsqrtsp_i(ftemp1);
         ftemp1  = normVar[k] * temprcp; /*ftemp1 = sqrt(normVar[0])*/
         ftemp2  = ftemp1 * noiseP;
-        temprcp = _rcpsp(ftemp2);
-        temprcp = temprcp * (2.f - ftemp2 * temprcp);
-        temprcp = temprcp * (2.f - ftemp2 * temprcp);
+        temprcp = rcpsp_i(ftemp2);
         ftemp1  = dwt * temprcp;
         conf[j] = _rsqrsp(ftemp1) * (float)ONEEIGHTYOVERPI * 0.5f;
         j++;
@@ -341,18 +338,14 @@ RADARDEMO_aoAEstDML_errorCode RADARDEMO_aoaEstimationDML_run(
     {
         k       = 1;
         dtemp1  = cos(tempAngle[j] * PIOVER180);
-        dwx[j]  = (float)dtemp1 * 2.236068f * (float)PISQROVER180; /* 2.236068 = sqrt(5)*/
+        dwx[j]  = (float)dtemp1 * aoaEstDMLInst->posSpread * (float)PISQROVER180; /* sqrt(5) for 4 antennas at lambda/2*/
         dwx[j]  = dwx[j] * dwx[j];
         dwt     = dwx[j] * signalP;
         ftemp1  = normVar[k];
-        temprcp = _rsqrsp(ftemp1);
-        temprcp = temprcp * (1.5f - (0.5f * ftemp1) * temprcp * temprcp);
-        temprcp = temprcp * (1.5f - (0.5f * ftemp1) * temprcp * temprcp);
+        temprcp = rsqrtsp_i(ftemp1);
         ftemp1  = normVar[k] * temprcp; /*ftemp1 = sqrt(normVar[0])*/
         ftemp2  = ftemp1 * noiseP;
-        temprcp = _rcpsp(ftemp2);
-        temprcp = temprcp * (2.f - ftemp2 * temprcp);
-        temprcp = temprcp * (2.f - ftemp2 * temprcp);
+        temprcp = rcpsp_i(ftemp2);
         ftemp1  = dwt * temprcp;
         conf[j] = _rsqrsp(ftemp1) * (float)ONEEIGHTYOVERPI * 0.5f;
         j++;
@@ -43,11 +43,17 @@
 #ifndef _TMS320C6600
 #include <modules/utilities/radar_c674x.h>
 #endif
+#include <modules/utilities/radar_cplxMath.h>
 
 
 /**< maximum number of searches for the coarse search .*/
 #define RADARDEMO_AOAESTDML_MAXNUMFIRSTSTEP (4)
 #define RADARDEMO_AOAESTDML_NORMVAETHR      (0.02f)
+/**< pairs of angles with a Gram matrix determinant below this fraction of nRxAnt^2 are not resolvable, they are scored as their first angle alone .*/
+#define RADARDEMO_AOAESTDML_MINGRAMDET      (1e-3f)
+/**< maximum LL2 size in bytes of the pair cache, 12 bytes per pair: 1365 pairs, a first stage search grid of 52 angles.
+ * Beyond it the first stage search computes the pairs on the fly.*/
+#define RADARDEMO_AOAESTDML_MAXPAIRCACHE    (0x4000)
 
 /**
  *  \struct   _RADARDEMO_aoAEstDML_handle_
@@ -59,6 +65,10 @@
  *	cplxf_t       *steeringVec;
  *	uint32_t      *scratchPad;
  *	uint8_t       firstStageSearchStep;
+ *	uint32_t      numPairs;
+ *	cplxf_t       *pairCoef;
+ *	float         *pairNorm;
+ *	float         posSpread;
  *   }   _RADARDEMO_aoAEstDML_handle_;
  *
  *  \brief   Structure element of the list of descriptors for UL allocations.
@@ -73,22 +83,23 @@ typedef struct _RADARDEMO_aoAEstDML_handle_
     float    estRange; /**< Range of the estimation, from -estRange to +estRange degrees*/
     uint32_t steeringVecSize; /**< size of -estRange:estResolution:estRange */
     cplxf_t *steeringVec; /**< steering vector for angle: -estRange:estResolution:estRange, for nRxAnt antennas, must be aligned to 8-byte boundary  */
-    /**< The steeringVec is arranged in ... degree0ant1 degree0ant2 degree0ant3 degree1ant1 degree1ant2 degree1ant3 ... fashion*/
-    /**< Ant0's steeringVec is 1 for all angle possiblities, so we don't save them*/
-    uint32_t *scratchPad; /**< Pointer to the scratch memory used in this function, must have length sizeof(uint32_t) * (5 * steeringVecSize + 4 + 2* nRxAnt*nRxAnt), must be aligned to 8-byte boundary  */
+    /**< The steeringVec is arranged in ... degree0ant0 degree0ant1 ... degree0antN-1 degree1ant0 ... fashion*/
+    uint32_t *scratchPad; /**< Pointer to the scratch memory used in this function, must have length sizeof(uint32_t) * 4 * steeringVecSize, must be aligned to 8-byte boundary  */
     uint8_t   firstStageSearchStep; /**< Search step for the first stage search, if 1, only 1 stage search (multi-stage search is disabled.*/
     float     minimumOutputConf; /**< Minimum confidence range (in degree) for the output estimation. Estimates with bigger confidence range will not be reported.*/
     float     angleEstBound; /**< the boundary of the estimates. Angle estimates outside [-angleEstBound angleEstBound] will be filtered out.*/
+    uint32_t  numPairs; /**< number of angle pairs of the first stage search grid in the pair cache, 0 if the cache would exceed RADARDEMO_AOAESTDML_MAXPAIRCACHE*/
+    cplxf_t  *pairCoef; /**< a1'*a2 / nRxAnt for each angle pair of the first stage search grid, must be aligned to 8-byte boundary, NULL without pair cache */
+    float    *pairNorm; /**< nRxAnt / det(A'*A) for each angle pair of the first stage search grid, NULL without pair cache*/
+    /**< The pair cache is arranged in ... (0,1) (0,2) ... (0,K-1) (1,2) ... (K-2,K-1) fashion, in first stage search grid index*/
+    float     posSpread; /**< sqrt(sum((pos - mean(pos))^2)) of the azimuth antenna positions, for the confidence of the estimates*/
 } RADARDEMO_aoAEstDML_handle;
 
 
 /*!
-   \fn     RADARDEMO_aoaEstimationDML_4ant
+   \fn     RADARDEMO_aoaEstimationDML_genPairCache
 
-   \brief   Estimate the angle of arrival of each detected object using DML for 4 Rx antennas.
-
-   \param[in]    Rn
-               input covariance matrix from input antenna samples.
+   \brief   Computes the inverse Gram matrices of all the angle pairs of the first stage search grid.
 
    \param[in]    steeringVec
                Pointer to steering vector.
@@ -96,19 +107,19 @@ typedef struct _RADARDEMO_aoAEstDML_handle_
    \param[in]    steeringVecSize
                Size of the steering vector.
 
-   \param[in]    scratchPad
-               Scratch memory.
+   \param[in]    nRxAnt
+               Number of antennas.
 
    \param[in]    firstStageSearchStep
-               First stage search step size, if 1, no second stage search needed.
+               First stage search step size.
 
-   \param[out]    normVar
-               Output normalized variance of the search metric.
+   \param[out]    pairCoef
+               a1'*a2 / nRxAnt for each pair.
 
-   \param[out]    angleEst
-               Output angle estimates.
+   \param[out]    pairNorm
+               nRxAnt / det(A'*A) for each pair.
 
-   \ret        Number of output angle estimates. Retuns 0 if nRxAnt !=4 ,
+   \ret        Number of pairs.
 
    \pre       none
 
@@ -117,22 +128,22 @@ typedef struct _RADARDEMO_aoAEstDML_handle_
 
  */
 
-extern int32_t RADARDEMO_aoaEstimationDML_4ant(
-    IN cplxf_t  *Rn,
+extern uint32_t RADARDEMO_aoaEstimationDML_genPairCache(
     IN cplxf_t  *steeringVec,
     IN int32_t   steeringVecSize,
-    IN float    *scratchPad,
+    IN int32_t   nRxAnt,
     IN uint8_t   firstStageSearchStep,
-    OUT float   *normVar,
-    OUT int32_t *angleEst);
+    OUT cplxf_t *pairCoef,
+    OUT float   *pairNorm);
 
 /*!
-   \fn     RADARDEMO_aoaEstimationDML_8ant
+   \fn     RADARDEMO_aoaEstimationDML_generic
 
-   \brief   Estimate the angle of arrival of each detected object using DML for 8 Rx antennas.
+   \brief   Estimate the angle of arrival of each detected object using DML, for any number of antennas and any
+            array geometry.
 
-   \param[in]    Rn
-               input covariance matrix from input antenna samples.
+   \param[in]    inputSignal
+               input antenna samples.
 
    \param[in]    steeringVec
                Pointer to steering vector.
@@ -140,19 +151,29 @@ extern int32_t RADARDEMO_aoaEstimationDML_4ant(
    \param[in]    steeringVecSize
                Size of the steering vector.
 
-   \param[in]    scratchPad
-               Scratch memory.
+   \param[in]    nRxAnt
+               Number of antennas.
 
    \param[in]    firstStageSearchStep
                First stage search step size, if 1, no second stage search needed.
 
+   \param[in]    pairCoef
+               Pair cache of the first stage search grid, from RADARDEMO_aoaEstimationDML_genPairCache, NULL to compute
+               the pairs on the fly.
+
+   \param[in]    pairNorm
+               Pair cache of the first stage search grid, from RADARDEMO_aoaEstimationDML_genPairCache.
+
+   \param[in]    scratchPad
+               Scratch memory.
+
    \param[out]    normVar
                Output normalized variance of the search metric.
 
    \param[out]    angleEst
                Output angle estimates.
 
-   \ret        Number of output angle estimates. Retuns 0 if nRxAnt !=4 ,
+   \ret        Number of output angle estimates.
 
    \pre       none
 
@@ -161,12 +182,15 @@ extern int32_t RADARDEMO_aoaEstimationDML_4ant(
 
  */
 
-extern int32_t RADARDEMO_aoaEstimationDML_8ant(
-    IN cplxf_t  *Rn,
+extern int32_t RADARDEMO_aoaEstimationDML_generic(
+    IN cplxf_t  *inputSignal,
     IN cplxf_t  *steeringVec,
     IN int32_t   steeringVecSize,
-    IN float    *scratchPad,
+    IN int32_t   nRxAnt,
     IN uint8_t   firstStageSearchStep,
+    IN cplxf_t  *pairCoef,
+    IN float    *pairNorm,
+    IN float    *scratchPad,
     OUT float   *normVar,
     OUT int32_t *angleEst);
 
@@ -0,0 +1,624 @@
+/**
+ *   @file  RADARDEMO_aoaEstDML_host_check.c
+ *
+ *   @brief
+ *      Host check of the DML angle estimation for any number of antennas.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_aoaEstDML_host_check [numTrials]
+ *
+ *  Old kernels (built with CHECK_OLD_KERNELS): on random scenes of 1 or 2 sources in noise, for 4 and 8 antenna
+ *  uniform linear arrays, with and without the multi-stage search, RADARDEMO_aoaEstimationDML_generic() must find the
+ *  angle pair of RADARDEMO_aoaEstimationDML_4ant() and RADARDEMO_aoaEstimationDML_8ant(), fed the covariance and the
+ *  steering vectors of the module before the generalization, or a pair of a metric, computed in double precision, at
+ *  least as large. Its normalized variances must match the double precision ones. Those of the old kernels lose the
+ *  metric to cancellation for close pairs, or are NaN for 8 antennas: their error is reported, not compared.
+ *
+ *  Dense search: for single-stage search grids, with and without pair cache, the pair found must have the largest
+ *  metric x'*B'*inv(B*B')*B*x, computed in double precision for all the pairs of the grid, B the 2 steering vectors,
+ *  over pairs resolvable by the module (Gram matrix determinant above RADARDEMO_AOAESTDML_MINGRAMDET). Linear, sparse
+ *  and 2D arrays are covered, the 2D ones at 0 and 20 degrees elevation, among them the 16 antenna array of the
+ *  shipped antGeometry0/1.
+ *
+ *  Pair cache: every entry must match the pair terms computed in double precision, the cache must stay within
+ *  RADARDEMO_AOAESTDML_MAXPAIRCACHE, and grids beyond it must run without cache. The cached search must find the pair of
+ *  the search with the pairs computed on the fly, up to ties, or for multi-stage grids a pair of a metric within 1 %:
+ *  a near tie of the first stage may lead the second stage to another local maximum. The differing pairs are
+ *  reported. RADARDEMO_aoaEstimationDML_run() must return finite outputs.
+ *
+ *  The exit status is 0 if all the checks pass.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <modules/DoA/DML/api/RADARDEMO_aoaEstDML.h>
+#include <modules/DoA/DML/src/RADARDEMO_aoaEstDM_priv.h>
+
+#define CHECK_PI        (3.141592653589793)
+#define CHECK_MAX_ANT   (RADARDEMO_AOAESTDML_MAXNUMANT)
+#define CHECK_MAX_GRID  (512)
+/* relative error of the normalized variances */
+#define CHECK_NORMVAR_TOL   (1e-3)
+
+#ifdef CHECK_OLD_KERNELS
+/* the kernels of the module before the generalization, Rn the upper triangle of conj(x(i))*x(j) and steeringVec
+ * without antenna 0 */
+extern int32_t RADARDEMO_aoaEstimationDML_4ant(cplxf_t *Rn, cplxf_t *steeringVec, int32_t steeringVecSize, float *scratchPad,
+                                               uint8_t firstStageSearchStep, float *normVar, int32_t *angleEst);
+extern int32_t RADARDEMO_aoaEstimationDML_8ant(cplxf_t *Rn, cplxf_t *steeringVec, int32_t steeringVecSize, float *scratchPad,
+                                               uint8_t firstStageSearchStep, float *normVar, int32_t *angleEst);
+#endif
+
+typedef struct
+{
+    const char    *name;
+    int32_t        nRxAnt;
+    const uint8_t *col;
+    const uint8_t *row;
+} Check_array;
+
+static const uint8_t gCheckUla[CHECK_MAX_ANT]    = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+static const uint8_t gCheckSparse[6]             = {0, 1, 3, 6, 7, 9};
+static const uint8_t gCheckCol3x4[12]            = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+static const uint8_t gCheckRow3x4[12]            = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2};
+/* antGeometry0/1 of the shipped profiles, as MmwDemo_calcActiveAntennaGeometry() makes them non negative */
+static const uint8_t gCheckColCabin[16]          = {2, 2, 3, 3, 0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 3, 3};
+static const uint8_t gCheckRowCabin[16]          = {0, 1, 1, 0, 0, 1, 1, 0, 2, 3, 3, 2, 2, 3, 3, 2};
+
+static const Check_array gCheckArrays[] = {
+    {"ULA 2", 2, gCheckUla, NULL},
+    {"ULA 4", 4, gCheckUla, NULL},
+    {"ULA 8", 8, gCheckUla, NULL},
+    {"sparse 6", 6, gCheckSparse, NULL},
+    {"2D 3x4", 12, gCheckCol3x4, gCheckRow3x4},
+    {"2D cabin 16", 16, gCheckColCabin, gCheckRowCabin},
+};
+
+static uint32_t gCheckSeed = 1;
+
+void *radarOsal_memAlloc(uint8_t memoryType, uint8_t scratchFlag, uint32_t size, uint16_t alignment)
+{
+    (void)memoryType;
+    (void)scratchFlag;
+    (void)alignment;
+    return (malloc(size));
+}
+
+void radarOsal_memFree(void *ptr, uint32_t size)
+{
+    (void)size;
+    free(ptr);
+}
+
+static double Check_rand(void)
+{
+    gCheckSeed = gCheckSeed * 1103515245U + 12345U;
+    return ((double)(gCheckSeed >> 8) / (double)(1U << 24));
+}
+
+static double Check_gauss(void)
+{
+    double u = Check_rand() + 1e-12;
+
+    return (sqrt(-2.0 * log(u)) * cos(2.0 * CHECK_PI * Check_rand()));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates the antenna samples of 1 or 2 sources at random azimuths within +-angleSpan degrees, at elevation
+ *      elevAngle, the second one 0 to 10 dB weaker, in noise of 20 to 40 dB SNR.
+ */
+static void Check_genSignal(const Check_array *arr, float elevAngle, float angleSpan, cplxf_t *x)
+{
+    double  ang[2], amp[2], phase[2], p, sinElev, cosElev, snr;
+    int32_t s, k, numSrc;
+
+    numSrc  = (Check_rand() < 0.25) ? 1 : 2;
+    sinElev = sin(elevAngle * CHECK_PI / 180.0);
+    cosElev = cos(elevAngle * CHECK_PI / 180.0);
+    for (s = 0; s < 2; s++)
+    {
+        ang[s]   = (2.0 * Check_rand() - 1.0) * angleSpan;
+        amp[s]   = (s == 0) ? 1.0 : pow(10.0, -Check_rand() * 0.5);
+        phase[s] = 2.0 * CHECK_PI * Check_rand();
+    }
+    snr = pow(10.0, -(20.0 + 20.0 * Check_rand()) / 20.0);
+    for (k = 0; k < arr->nRxAnt; k++)
+    {
+        x[k].real = (float)(snr * Check_gauss() * 0.7071);
+        x[k].imag = (float)(snr * Check_gauss() * 0.7071);
+        for (s = 0; s < numSrc; s++)
+        {
+            p = (double)arr->col[k] * cosElev * sin(ang[s] * CHECK_PI / 180.0);
+            if (arr->row != NULL)
+                p += (double)arr->row[k] * sinElev;
+            x[k].real += (float)(amp[s] * cos(phase[s] - CHECK_PI * p));
+            x[k].imag += (float)(amp[s] * sin(phase[s] - CHECK_PI * p));
+        }
+    }
+}
+
+static void *Check_create(const Check_array *arr, float estRange, float estResolution, float elevAngle, uint8_t multiStage)
+{
+    RADARDEMO_aoAEstDML_config    cfg;
+    RADARDEMO_aoAEstDML_errorCode err;
+    void                         *h;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.antSpacing             = (uint8_t *)arr->col;
+    cfg.antRow                 = (uint8_t *)arr->row;
+    cfg.nRxAnt                 = (uint32_t)arr->nRxAnt;
+    cfg.estResolution          = estResolution;
+    cfg.estRange               = estRange;
+    cfg.elevAngle              = elevAngle;
+    cfg.enableMultiStageSearch = multiStage;
+    cfg.minimumOutputConf      = 90.f;
+    cfg.angleEstBound          = estRange;
+    h                          = RADARDEMO_aoaEstimationDML_create(&cfg, &err);
+    if ((h == NULL) || (err != RADARDEMO_AOADML_NO_ERROR))
+    {
+        printf("FAIL: %s create error %d\n", arr->name, (int)err);
+        return (NULL);
+    }
+    return (h);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Metric of the angle pair (i, j) in double precision, x'*B'*inv(B*B')*B*x with B the 2 steering vectors of
+ *      the grid as rows. For the pairs the module does not resolve, returns -1, or with firstAlone the metric of
+ *      angle i alone, |y1|^2 / nRxAnt, as the module scores them.
+ */
+static double Check_refMetric(const RADARDEMO_aoAEstDML_handle *h, const cplxf_t *x, int32_t i, int32_t j, int32_t firstAlone)
+{
+    const cplxf_t *a1 = &h->steeringVec[h->nRxAnt * i];
+    const cplxf_t *a2 = &h->steeringVec[h->nRxAnt * j];
+    double         y1r = 0.0, y1i = 0.0, y2r = 0.0, y2i = 0.0, g11 = 0.0, g22 = 0.0, gr = 0.0, gi = 0.0, det, q;
+    int32_t        k;
+
+    for (k = 0; k < (int32_t)h->nRxAnt; k++)
+    {
+        y1r += (double)a1[k].real * x[k].real - (double)a1[k].imag * x[k].imag;
+        y1i += (double)a1[k].real * x[k].imag + (double)a1[k].imag * x[k].real;
+        y2r += (double)a2[k].real * x[k].real - (double)a2[k].imag * x[k].imag;
+        y2i += (double)a2[k].real * x[k].imag + (double)a2[k].imag * x[k].real;
+        g11 += (double)a1[k].real * a1[k].real + (double)a1[k].imag * a1[k].imag;
+        g22 += (double)a2[k].real * a2[k].real + (double)a2[k].imag * a2[k].imag;
+        /* g12 = a1 * conj(a2), the (1, 2) entry of B*B' */
+        gr += (double)a1[k].real * a2[k].real + (double)a1[k].imag * a2[k].imag;
+        gi += (double)a1[k].imag * a2[k].real - (double)a1[k].real * a2[k].imag;
+    }
+    det = g11 * g22 - gr * gr - gi * gi;
+    if (det <= (double)RADARDEMO_AOAESTDML_MINGRAMDET * (double)h->nRxAnt * (double)h->nRxAnt)
+        return (firstAlone ? (y1r * y1r + y1i * y1i) / g11 : -1.0);
+    /* y'*inv(G)*y, inv(G) = [g22 -g12; -conj(g12) g11] / det: the cross term is 2*real(g12*conj(y1)*y2) */
+    q = g22 * (y1r * y1r + y1i * y1i) + g11 * (y2r * y2r + y2i * y2i)
+        - 2.0 * (gr * (y1r * y2r + y1i * y2i) - gi * (y1r * y2i - y1i * y2r));
+    return (q / det);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Normalized variance of the metric of the pairs of angle i2 in double precision, as
+ *      RADARDEMO_aoaEstimationDML_generic() defines it.
+ */
+static double Check_refNormVar(const RADARDEMO_aoAEstDML_handle *h, const cplxf_t *x, int32_t i2)
+{
+    static double m[CHECK_MAX_GRID];
+    double        avg = 0.0, var = 0.0;
+    int32_t       j, n = (int32_t)h->steeringVecSize;
+
+    for (j = 0; j < n; j++)
+    {
+        m[j] = (j == i2) ? 0.0 : Check_refMetric(h, x, i2, j, 1);
+        avg += m[j];
+    }
+    avg = avg / n;
+    for (j = 0; j < n; j++)
+        if (j != i2)
+            var += (m[j] - avg) * (m[j] - avg);
+    return (var / (avg * avg * n));
+}
+
+static int32_t Check_generic(RADARDEMO_aoAEstDML_handle *h, cplxf_t *x, int32_t useCache, float *normVar, int32_t *angleEst)
+{
+    return (RADARDEMO_aoaEstimationDML_generic(x, h->steeringVec, (int32_t)h->steeringVecSize, (int32_t)h->nRxAnt,
+                                               h->firstStageSearchStep, useCache ? h->pairCoef : NULL, h->pairNorm,
+                                               (float *)h->scratchPad, normVar, angleEst));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Compares 2 estimated angle pairs of a scene: equal, or of the same metric within relTol, a tie of the grid.
+ *      Returns 0 if they are the same estimate.
+ */
+static int32_t Check_samePair(const RADARDEMO_aoAEstDML_handle *h, const cplxf_t *x, const int32_t *est0, const int32_t *est1, double relTol)
+{
+    double m0, m1;
+
+    if ((est0[0] == est1[0]) && (est0[1] == est1[1]))
+        return (0);
+    m0 = Check_refMetric(h, x, est0[0], est0[1], 0);
+    m1 = Check_refMetric(h, x, est1[0], est1[1], 0);
+    return (fabs(m0 - m1) <= relTol * fabs(m0) ? 0 : 1);
+}
+
+#ifdef CHECK_OLD_KERNELS
+/* Rn entry of the old module, _complex_conjugate_mpysp(x(i), x(j)) */
+static void Check_conjMpy(const cplxf_t *xi, const cplxf_t *xj, cplxf_t *r)
+{
+    __float2_t fi, fj, fr;
+
+    memcpy(&fi, xi, sizeof(fi));
+    memcpy(&fj, xj, sizeof(fj));
+    fr = _complex_conjugate_mpysp(fi, fj);
+    memcpy(r, &fr, sizeof(fr));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the old 4 and 8 antenna kernels and the generic one on the same scenes.
+ */
+static int32_t Check_oldKernels(int32_t numTrials)
+{
+    static const int32_t antCfg[] = {4, 8};
+    Check_array          arr;
+    RADARDEMO_aoAEstDML_handle *h;
+    cplxf_t             *oldSteeringVec;
+    cplxf_t              x[CHECK_MAX_ANT] __attribute__((aligned(8)));
+    cplxf_t              Rn[CHECK_MAX_ANT * (CHECK_MAX_ANT + 1) / 2] __attribute__((aligned(8)));
+    float               *oldScratch, normVarOld[2], normVarNew[2];
+    int32_t              angleOld[2], angleNew[2];
+    int32_t              a, multiStage, t, i, j, k, n, samePair, numFail = 0, numNaN = 0, numCmp = 0, numSame = 0, numBetter = 0;
+    double               ftemp1, freal1, fimag1, frealJ, fimagJ, mOld, mNew, ref, diff, maxDiffNew = 0.0, maxDiffOld = 0.0;
+
+    for (a = 0; a < (int32_t)(sizeof(antCfg) / sizeof(antCfg[0])); a++)
+    {
+        for (multiStage = 0; multiStage < 2; multiStage++)
+        {
+            n          = antCfg[a];
+            arr.name   = (n == 4) ? "ULA 4" : "ULA 8";
+            arr.nRxAnt = n;
+            arr.col    = gCheckUla;
+            arr.row    = NULL;
+            h          = (RADARDEMO_aoAEstDML_handle *)Check_create(&arr, 60.f, 1.f, 0.f, (uint8_t)multiStage);
+            if (h == NULL)
+                return (numFail + 1);
+
+            /* steering vectors of the old module, antenna 0 left out */
+            oldSteeringVec = (cplxf_t *)malloc(h->steeringVecSize * (n - 1) * sizeof(cplxf_t));
+            oldScratch     = (float *)malloc(16 * (h->steeringVecSize + 4) * sizeof(float));
+            for (i = 0; i < (int32_t)h->steeringVecSize; i++)
+            {
+                ftemp1                              = sin((-h->estRange + (double)i * h->estResolution) * (CHECK_PI / 180.0));
+                freal1                              = cos(-(double)(float)CHECK_PI * ftemp1);
+                fimag1                              = sin(-(double)(float)CHECK_PI * ftemp1);
+                frealJ                              = freal1;
+                fimagJ                              = fimag1;
+                oldSteeringVec[(n - 1) * i].real    = (float)frealJ;
+                oldSteeringVec[(n - 1) * i].imag    = (float)fimagJ;
+                for (j = 2; j < n; j++)
+                {
+                    ftemp1                                  = frealJ;
+                    frealJ                                  = frealJ * freal1 - fimagJ * fimag1;
+                    fimagJ                                  = ftemp1 * fimag1 + fimagJ * freal1;
+                    oldSteeringVec[(n - 1) * i + j - 1].real = (float)frealJ;
+                    oldSteeringVec[(n - 1) * i + j - 1].imag = (float)fimagJ;
+                }
+            }
+
+            for (t = 0; t < numTrials; t++)
+            {
+                Check_genSignal(&arr, 0.f, 55.f, x);
+                k = 0;
+                for (i = 0; i < n; i++)
+                    for (j = i; j < n; j++)
+                        Check_conjMpy(&x[i], &x[j], &Rn[k++]);
+                if (n == 4)
+                    RADARDEMO_aoaEstimationDML_4ant(Rn, oldSteeringVec, (int32_t)h->steeringVecSize, oldScratch, h->firstStageSearchStep, normVarOld, angleOld);
+                else
+                    RADARDEMO_aoaEstimationDML_8ant(Rn, oldSteeringVec, (int32_t)h->steeringVecSize, oldScratch, h->firstStageSearchStep, normVarOld, angleOld);
+                Check_generic(h, x, 1, normVarNew, angleNew);
+                numCmp++;
+
+                /* the same pair, or one of a larger metric than the pair of the old kernel */
+                mOld = Check_refMetric(h, x, angleOld[0], angleOld[1], 0);
+                mNew = Check_refMetric(h, x, angleNew[0], angleNew[1], 0);
+                samePair = (angleOld[0] == angleNew[0]) && (angleOld[1] == angleNew[1]);
+                numSame += samePair;
+                if ((samePair == 0) && (mNew < mOld * (1.0 - 1e-6)))
+                {
+                    if (numFail < 10)
+                        printf("FAIL: %s, multi-stage %d, trial %d: old angles %d %d of metric %.8g, generic %d %d of metric %.8g\n",
+                               arr.name, multiStage, t, angleOld[0], angleOld[1], mOld, angleNew[0], angleNew[1], mNew);
+                    numFail++;
+                }
+                numBetter += (samePair == 0) && (mNew > mOld);
+
+                /* normalized variances against the double precision ones */
+                for (i = 0; i < 2; i++)
+                {
+                    ref  = Check_refNormVar(h, x, angleNew[i]);
+                    diff = fabs(normVarNew[i] - ref) / ref;
+                    if (diff > maxDiffNew)
+                        maxDiffNew = diff;
+                    if (diff > CHECK_NORMVAR_TOL)
+                    {
+                        if (numFail < 10)
+                            printf("FAIL: %s, multi-stage %d, trial %d: normalized variance %g, double precision %g\n", arr.name,
+                                   multiStage, t, normVarNew[i], ref);
+                        numFail++;
+                    }
+                    if (samePair == 0)
+                        continue;
+                    if (isnan(normVarOld[i]))
+                        numNaN++;
+                    else if (fabs(normVarOld[i] - ref) / ref > maxDiffOld)
+                        maxDiffOld = fabs(normVarOld[i] - ref) / ref;
+                }
+            }
+            free(oldSteeringVec);
+            free(oldScratch);
+            RADARDEMO_aoaEstimationDML_delete(h);
+        }
+    }
+    printf("old kernels: %d scenes, %d same angle pairs, %d pairs of a larger metric than the old kernels\n", numCmp, numSame, numBetter);
+    printf("old kernels: normalized variances off the double precision ones by %.2g, by %.2g for the old kernels, %d NaN\n",
+           maxDiffNew, maxDiffOld, numNaN);
+    return (numFail);
+}
+#endif
+
+/**
+ *  @b Description
+ *  @n
+ *      Single-stage search against the largest metric over all the pairs of the grid, in double precision.
+ */
+static int32_t Check_dense(int32_t numTrials)
+{
+    static const float          gridCfg[][2] = {{60.f, 1.f}, {20.f, 1.f}};
+    RADARDEMO_aoAEstDML_handle *h;
+    cplxf_t                     x[CHECK_MAX_ANT] __attribute__((aligned(8)));
+    float                       normVar[2], elevAngle;
+    int32_t                     a, g, e, t, i, j, angleEst[2], numFail = 0, numCmp = 0, numCached = 0;
+    double                      m, refMax, got, maxNormVarDiff = 0.0;
+
+    for (a = 0; a < (int32_t)(sizeof(gCheckArrays) / sizeof(gCheckArrays[0])); a++)
+    {
+        for (e = 0; e < ((gCheckArrays[a].row != NULL) ? 2 : 1); e++)
+        {
+            elevAngle = (e == 0) ? 0.f : 20.f;
+            for (g = 0; g < (int32_t)(sizeof(gridCfg) / sizeof(gridCfg[0])); g++)
+            {
+                h = (RADARDEMO_aoAEstDML_handle *)Check_create(&gCheckArrays[a], gridCfg[g][0], gridCfg[g][1], elevAngle, 0);
+                if (h == NULL)
+                    return (numFail + 1);
+                numCached += (h->pairCoef != NULL);
+                for (t = 0; t < numTrials; t++)
+                {
+                    Check_genSignal(&gCheckArrays[a], elevAngle, gridCfg[g][0] - 2.f, x);
+                    Check_generic(h, x, 1, normVar, angleEst);
+                    refMax = 0.0;
+                    for (i = 0; i < (int32_t)h->steeringVecSize; i++)
+                    {
+                        for (j = i + 1; j < (int32_t)h->steeringVecSize; j++)
+                        {
+                            m = Check_refMetric(h, x, i, j, 0);
+                            if (m > refMax)
+                                refMax = m;
+                        }
+                    }
+                    got = Check_refMetric(h, x, angleEst[0], angleEst[1], 0);
+                    numCmp++;
+                    for (i = 0; i < 2; i++)
+                    {
+                        m = fabs(normVar[i] - Check_refNormVar(h, x, angleEst[i])) / Check_refNormVar(h, x, angleEst[i]);
+                        if (m > maxNormVarDiff)
+                            maxNormVarDiff = m;
+                        if (m > CHECK_NORMVAR_TOL)
+                        {
+                            if (numFail < 10)
+                                printf("FAIL: %s, elevation %.0f, grid +-%.0f, trial %d: normalized variance %g, double precision %g\n",
+                                       gCheckArrays[a].name, elevAngle, gridCfg[g][0], t, normVar[i], Check_refNormVar(h, x, angleEst[i]));
+                            numFail++;
+                        }
+                    }
+                    if (got < refMax * (1.0 - 1e-4))
+                    {
+                        if (numFail < 10)
+                            printf("FAIL: %s, elevation %.0f, grid +-%.0f, trial %d: pair %d %d of metric %.6g, largest %.6g\n",
+                                   gCheckArrays[a].name, elevAngle, gridCfg[g][0], t, angleEst[0], angleEst[1], got, refMax);
+                        numFail++;
+                    }
+                }
+                RADARDEMO_aoaEstimationDML_delete(h);
+            }
+        }
+    }
+    printf("dense search: %d scenes, %d of %d grids with pair cache, normalized variances off the double precision ones by %.2g\n",
+           numCmp, numCached, numCmp / numTrials, maxNormVarDiff);
+    return (numFail);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Pair cache entries, size bound, and search with the cache against the search with the pairs on the fly.
+ */
+static int32_t Check_cache(int32_t numTrials)
+{
+    /* estRange, estResolution, enableMultiStageSearch */
+    static const float          gridCfg[][3] = {{60.f, 1.f, 1.f}, {70.f, 1.f, 1.f}, {90.f, 0.5f, 1.f}, {30.f, 0.5f, 1.f},
+                                                {20.f, 1.f, 0.f}, {60.f, 1.f, 0.f}, {90.f, 0.5f, 0.f}};
+    RADARDEMO_aoAEstDML_handle *h;
+    RADARDEMO_aoAEst_input      in;
+    RADARDEMO_aoAEst_output     out;
+    cplxf_t                     x[CHECK_MAX_ANT] __attribute__((aligned(8)));
+    cplxf_t                    *a1, *a2;
+    float                       normVar[2], normVarRef[2];
+    int32_t                     a, g, t, i, j, k, step, pairIdx, angleEst[2], angleRef[2], numFail = 0, numPairs = 0, numRun = 0;
+    int32_t                     numCmp = 0, numDiff = 0;
+    double                      cr, ci, det, dNant, coefErr, maxCoefErr = 0.0;
+    uint32_t                    maxBytes = 0;
+
+    for (a = 0; a < (int32_t)(sizeof(gCheckArrays) / sizeof(gCheckArrays[0])); a++)
+    {
+        for (g = 0; g < (int32_t)(sizeof(gridCfg) / sizeof(gridCfg[0])); g++)
+        {
+            h = (RADARDEMO_aoAEstDML_handle *)Check_create(&gCheckArrays[a], gridCfg[g][0], gridCfg[g][1], 0.f, (uint8_t)gridCfg[g][2]);
+            if (h == NULL)
+                return (numFail + 1);
+            step = h->firstStageSearchStep;
+            if (h->numPairs * (sizeof(cplxf_t) + sizeof(float)) > RADARDEMO_AOAESTDML_MAXPAIRCACHE)
+            {
+                printf("FAIL: %s, grid +-%.0f by %.1f: pair cache of %u bytes\n", gCheckArrays[a].name, gridCfg[g][0],
+                       gridCfg[g][1], (unsigned)(h->numPairs * (sizeof(cplxf_t) + sizeof(float))));
+                numFail++;
+            }
+            if ((h->numPairs == 0) != (h->pairCoef == NULL))
+            {
+                printf("FAIL: %s, grid +-%.0f by %.1f: %u pairs, cache %p\n", gCheckArrays[a].name, gridCfg[g][0], gridCfg[g][1],
+                       (unsigned)h->numPairs, (void *)h->pairCoef);
+                numFail++;
+            }
+            if (h->numPairs * (sizeof(cplxf_t) + sizeof(float)) > maxBytes)
+                maxBytes = h->numPairs * (sizeof(cplxf_t) + sizeof(float));
+
+            /* cache entries against the pair terms in double precision */
+            dNant   = (double)h->nRxAnt;
+            pairIdx = 0;
+            for (i = 0; (h->pairCoef != NULL) && (i < (int32_t)h->steeringVecSize); i += step)
+            {
+                for (j = i + step; j < (int32_t)h->steeringVecSize; j += step)
+                {
+                    a1 = &h->steeringVec[h->nRxAnt * i];
+                    a2 = &h->steeringVec[h->nRxAnt * j];
+                    cr = 0.0;
+                    ci = 0.0;
+                    for (k = 0; k < (int32_t)h->nRxAnt; k++)
+                    {
+                        cr += (double)a1[k].real * a2[k].real + (double)a1[k].imag * a2[k].imag;
+                        ci += (double)a1[k].real * a2[k].imag - (double)a1[k].imag * a2[k].real;
+                    }
+                    det = dNant * dNant - cr * cr - ci * ci;
+                    /* a1'*a2 / nRxAnt and nRxAnt / det(A'*A), both 0 for unresolvable pairs */
+                    if (det <= (double)RADARDEMO_AOAESTDML_MINGRAMDET * dNant * dNant)
+                        coefErr = fabs(h->pairCoef[pairIdx].real) + fabs(h->pairCoef[pairIdx].imag) + fabs(h->pairNorm[pairIdx]);
+                    else
+                        coefErr = fabs(h->pairCoef[pairIdx].real - cr / dNant) + fabs(h->pairCoef[pairIdx].imag - ci / dNant)
+                                  + fabs(h->pairNorm[pairIdx] - dNant / det) * det / dNant;
+                    if (coefErr > maxCoefErr)
+                        maxCoefErr = coefErr;
+                    pairIdx++;
+                }
+            }
+            if (pairIdx != (int32_t)(h->pairCoef != NULL ? h->numPairs : 0))
+            {
+                printf("FAIL: %s, grid +-%.0f by %.1f: %d pairs in the grid, %u in the cache\n", gCheckArrays[a].name,
+                       gridCfg[g][0], gridCfg[g][1], pairIdx, (unsigned)h->numPairs);
+                numFail++;
+            }
+            numPairs += pairIdx;
+
+            for (t = 0; t < numTrials; t++)
+            {
+                Check_genSignal(&gCheckArrays[a], 0.f, gridCfg[g][0] - 2.f, x);
+                Check_generic(h, x, 1, normVar, angleEst);
+                Check_generic(h, x, 0, normVarRef, angleRef);
+                numCmp++;
+                /* single-stage: the same candidates, the same pair up to ties. Multi-stage: a near tie of the first stage
+                   may lead the second stage to another local maximum, of a metric within 1 % */
+                numDiff += (angleEst[0] != angleRef[0]) || (angleEst[1] != angleRef[1]);
+                if (Check_samePair(h, x, angleEst, angleRef, (step == 1) ? 1e-5 : 1e-2))
+                {
+                    if (numFail < 10)
+                        printf("FAIL: %s, grid +-%.0f by %.1f, trial %d: pair %d %d with cache, %d %d without\n", gCheckArrays[a].name,
+                               gridCfg[g][0], gridCfg[g][1], t, angleEst[0], angleEst[1], angleRef[0], angleRef[1]);
+                    numFail++;
+                }
+
+                in.inputAntSamples = x;
+                in.inputNoisePow   = 1e-3f * (float)h->nRxAnt;
+                memset(&out, 0, sizeof(out));
+                if ((RADARDEMO_aoaEstimationDML_run(h, &in, &out) != RADARDEMO_AOADML_NO_ERROR) || (out.numOutput > MAX_NUM_DETANGLE)
+                    || ((out.numOutput > 0) && !(isfinite(out.outputAngles[0]) && isfinite(out.outputVar[0])))
+                    || ((out.numOutput > 1) && !(isfinite(out.outputAngles[1]) && isfinite(out.outputVar[1]))))
+                {
+                    if (numFail < 10)
+                        printf("FAIL: %s, grid +-%.0f by %.1f, trial %d: run output %u angles %g %g, confidence %g %g\n",
+                               gCheckArrays[a].name, gridCfg[g][0], gridCfg[g][1], t, (unsigned)out.numOutput, out.outputAngles[0],
+                               out.outputAngles[1], out.outputVar[0], out.outputVar[1]);
+                    numFail++;
+                }
+                numRun += out.numOutput;
+            }
+            RADARDEMO_aoaEstimationDML_delete(h);
+        }
+    }
+    if (maxCoefErr > 1e-5)
+    {
+        printf("FAIL: pair cache error %.2g of the pair terms\n", maxCoefErr);
+        numFail++;
+    }
+    printf("pair cache: %d pairs, error %.2g, at most %u bytes of %d, %d estimates of the run\n", numPairs, maxCoefErr,
+           (unsigned)maxBytes, RADARDEMO_AOAESTDML_MAXPAIRCACHE, numRun);
+    printf("pair cache: %d scenes, %d pairs other than the search without cache\n", numCmp, numDiff);
+    return (numFail);
+}
+
+int main(int argc, char **argv)
+{
+    int32_t numTrials = (argc > 1) ? atoi(argv[1]) : 300;
+    int32_t numFail   = 0;
+
+#ifdef CHECK_OLD_KERNELS
+    numFail += Check_oldKernels(numTrials);
+#endif
+    numFail += Check_dense((numTrials + 9) / 10);
+    numFail += Check_cache((numTrials + 2) / 3);
+
+    printf("%s: %d failed checks\n", numFail == 0 ? "PASS" : "FAIL", numFail);
+    return (numFail == 0 ? 0 : 1);
+}
@@ -0,0 +1,83 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the DML angle estimation on the host
+#
+#   RADARDEMO_aoaEstDML_host_check.sh [oldRevision] [numTrials]
+#
+# RADARDEMO_aoaEstDML.c and RADARDEMO_aoaEstDML_priv.c are built as they are, with the C66x intrinsics emulated by
+# radar_c66x_host_shim.h. The 4 and 8 antenna kernels they replaced are built from oldRevision, which defaults to the
+# parent of the last commit that changed RADARDEMO_aoaEstimationDML_4ant, extracted with git archive. Without git, or
+# if no commit has it, the check runs without them. See RADARDEMO_aoaEstDML_host_check.c for what is compared.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./RADARDEMO_aoaEstDML_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+DSS_DIR=$(cd "$TOOLS_DIR/../../../../../../.." && pwd)
+DPU_DIR="$DSS_DIR/source/dpu/capon3d_overhead"
+DML_PATH=source/dpu/capon3d_overhead/modules/DoA/DML/src
+BUILD_DIR=${BUILD_DIR:-./RADARDEMO_aoaEstDML_host_check_build}
+CC=${CC:-cc}
+CFLAGS="-O2 -Wall -std=gnu99 -ffp-contract=off -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 -Wno-unknown-pragmas -include $DPU_DIR/modules/utilities/tools/radar_c66x_host_shim.h"
+
+OLD_REV=$1
+NUM_TRIALS=${2:-300}
+if [ -z "$OLD_REV" ]; then
+    OLD_REV=$(git -C "$DSS_DIR" log -n 1 --format=%H -S RADARDEMO_aoaEstimationDML_4ant -- "$DML_PATH/RADARDEMO_aoaEstDML_priv.c" 2>/dev/null || true)
+    OLD_REV=${OLD_REV:+$OLD_REV^}
+fi
+
+rm -rf "$BUILD_DIR/old"
+mkdir -p "$BUILD_DIR/old" "$BUILD_DIR/inc"
+: > "$BUILD_DIR/inc/c6x.h"
+
+OLD_OBJ=
+OLD_DEF=
+if [ -n "$OLD_REV" ]; then
+    echo "old kernels: $OLD_REV"
+    git -C "$DSS_DIR" archive "$OLD_REV" "$DML_PATH" | tar -x -C "$BUILD_DIR/old"
+    # shellcheck disable=SC2086
+    $CC $CFLAGS -Wno-maybe-uninitialized -Wno-unused-variable -Wno-unused-but-set-variable -I "$BUILD_DIR/inc" \
+        -I "$DPU_DIR" -I "$DSS_DIR" -c -o "$BUILD_DIR/RADARDEMO_aoaEstDML_old_priv.o" "$BUILD_DIR/old/$DML_PATH/RADARDEMO_aoaEstDML_priv.c"
+    OLD_OBJ="$BUILD_DIR/RADARDEMO_aoaEstDML_old_priv.o"
+    OLD_DEF=-DCHECK_OLD_KERNELS
+else
+    echo "old kernels: not found, not compared"
+fi
+
+# shellcheck disable=SC2086
+$CC $CFLAGS -Werror $OLD_DEF -I "$BUILD_DIR/inc" -I "$DPU_DIR" -I "$DSS_DIR" -o "$BUILD_DIR/RADARDEMO_aoaEstDML_host_check" \
+    "$TOOLS_DIR/RADARDEMO_aoaEstDML_host_check.c" "$DPU_DIR/modules/DoA/DML/src/RADARDEMO_aoaEstDML.c" \
+    "$DPU_DIR/modules/DoA/DML/src/RADARDEMO_aoaEstDML_priv.c" $OLD_OBJ -lm
+"$BUILD_DIR/RADARDEMO_aoaEstDML_host_check" "$NUM_TRIALS"
@@ -227,6 +227,8 @@ typedef struct RADARDEMO_detectionCFAR_input
     float   sidelobeThr;
     uint8_t enableSecondPass;
     uint8_t enable_neighbour_check;
+    uint16_t rangeStartInd; /**< first range bin searched, 0 for the whole heatmap*/
+    uint16_t rangeEndInd; /**< range bin after the last one searched, fft1DSize for the whole heatmap*/
 } RADARDEMO_detectionCFAR_input;
 
 
@@ -300,4 +302,25 @@ extern RADARDEMO_detectionCFAR_errorCode RADARDEMO_detectionCFAR_run(
      void                            *handle,
      RADARDEMO_detectionCFAR_input   *detectionCFARInput,
      RADARDEMO_detectionCFAR_output *estOutput);
+
+/*!
+   \fn     RADARDEMO_detectionCFAR_rangeReach
+
+   \brief   Number of range bins on each side of a cell under test read by its range search windows. The detections
+            of a range bin only change with the heatmap of the range bins within this distance.
+
+   \param[in]    handle
+               Module handle.
+
+   \ret     number of range bins.
+
+   \pre       none
+
+   \post      none
+
+
+ */
+
+extern int32_t RADARDEMO_detectionCFAR_rangeReach(
+     void *handle);
 #endif // RADARDEMO_DETECTIONCFAR_H
@@ -312,7 +312,9 @@ RADARDEMO_detectionCFAR_errorCode	RADARDEMO_detectionCFAR_run(
 							detectionCFARInput->azMaxPerRangeBin,  
 							detectionCFARInput->sidelobeThr, 
 							detectionCFARInput->enableSecondPass,
-							detectionCFARInput->enable_neighbour_check);
+							detectionCFARInput->enable_neighbour_check,
+							detectionCFARInput->rangeStartInd,
+							detectionCFARInput->rangeEndInd);
 #if 0 // removed for VOD
 	}
 	else if ((RADARDEMO_detectionCFAR_Type)detectionCFARInst->cfarType == RADARDEMO_DETECTIONCFAR_RA_CASOCFARV2)
@@ -333,3 +335,32 @@ RADARDEMO_detectionCFAR_errorCode	RADARDEMO_detectionCFAR_run(
 #endif
 	return(errorCode);
 }
+
+/*! 
+   \fn     RADARDEMO_detectionCFAR_rangeReach
+ 
+   \brief   Number of range bins on each side of a cell under test read by its range search windows.
+  
+   \param[in]    handle
+               Module handle.
+ 
+   \ret     number of range bins.
+ 
+   \pre       none
+ 
+   \post      none
+  
+ 
+ */
+
+int32_t	RADARDEMO_detectionCFAR_rangeReach(
+                            IN  void * handle)
+{
+	RADARDEMO_detectionCFAR_handle *detectionCFARInst;
+	int32_t reachFar, reachNear;
+
+	detectionCFARInst	=	(RADARDEMO_detectionCFAR_handle *) handle;
+	reachFar	=	(int32_t)detectionCFARInst->searchWinSizeRange + (int32_t)detectionCFARInst->guardSizeRange;
+	reachNear	=	(int32_t)detectionCFARInst->searchWinSizeNear + (int32_t)detectionCFARInst->guardSizeNear;
+	return((reachFar > reachNear) ? reachFar : reachNear);
+}
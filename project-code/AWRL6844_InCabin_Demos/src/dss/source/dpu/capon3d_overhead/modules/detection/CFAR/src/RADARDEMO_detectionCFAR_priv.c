@@ -1544,6 +1544,13 @@ int32_t	RADARDEMO_detectionCFAR_raCAAll(
    \param[out]    noise
                Pointer to the output noise estimation detected objects.
 
+   \param[in]    rangeStartInd
+               First range bin searched. The window sums start from the state of rangeStartInd - 1, computed directly
+               when it is past the near range edge cells.
+
+   \param[in]    rangeEndInd
+               Range bin after the last one searched.
+
    \ret       number of objects detected.
 
    \pre       none
@@ -1565,7 +1572,9 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
     IN float                          *azMaxPerRangeBin,
     IN float                           sidelobeThr,
     IN uint8_t                         enableSecondPass,
-    IN uint8_t                         enable_neighbour_check)
+    IN uint8_t                         enable_neighbour_check,
+    IN uint16_t                        rangeStartInd,
+    IN uint16_t                        rangeEndInd)
 {
 
     int32_t         i_2d;
@@ -1584,6 +1593,7 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
     int16_t         winSizeNear, guardSizeNear;
     int16_t         winSizeFar, guardSizeFar;
     int16_t         leftSkipSize, rightSkipSize;
+    int16_t         searchStart, searchEnd, centerStart, centerEnd, rngStart;
 
     winSizeFar    = (int16_t)detectionCFARInst->searchWinSizeRange;
     guardSizeFar  = (int16_t)detectionCFARInst->guardSizeRange;
@@ -1602,6 +1612,14 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
     relativeThr    = detectionCFARInst->relThr;
     detected       = 0;
 
+    // Range bins searched, and range bins of the center loop where the four windows are inside the skip areas
+    searchStart = (rangeStartInd > leftSkipSize) ? (int16_t)rangeStartInd : leftSkipSize;
+    searchEnd   = (int16_t)detectionCFARInst->fft1DSize - rightSkipSize;
+    if (rangeEndInd < searchEnd)
+        searchEnd = (int16_t)rangeEndInd;
+    centerStart = leftSkipSize + totalWinSize + 1;
+    centerEnd   = (int16_t)detectionCFARInst->fft1DSize - (rightSkipSize + totalWinSize);
+
     // Initialize relative start indexes for the four search windows.
     idxFarA  = totalWinSize + 1;
     idxFarB  = guardSizeFar;
@@ -1654,25 +1672,45 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
         i_2d         = az_row;
         tempDetected = 0;
         powerPtr     = (float *)InputPower[i_2d];
+        if (searchStart >= searchEnd)
+            continue;
 
         // Find the mean of the near end of this azimuth row
         idx       = leftSkipSize;
         leftAvg   = (powerPtr[idx] + powerPtr[idx + 1]) * 0.5; // closest 2-cell range average
-        winAvg[1] = winAvg[3] = 0.0;
+        winAvg[0] = winAvg[1] = winAvg[2] = winAvg[3] = 0.0;
 
-        // Initialize the window sums for position (leftSkipSize - 1)
-        winAvg[0] = leftAvg * winSizeFar; // winFarA
-        winAvg[2] = leftAvg * winSizeNear; // winNearC
-        for (idx = 0; idx < winSizeFar; idx++)
-            winAvg[1] += powerPtr[idx + leftSkipSize + guardSizeFar]; // winFarB
-        for (idx = 0; idx < winSizeNear; idx++)
-            winAvg[3] += powerPtr[idx + leftSkipSize + guardSizeNear]; // winNearD
+        if ((searchStart > centerStart) && (centerStart < centerEnd))
+        {
+            // Initialize the window sums for position (rngStart - 1), the windows only hold cells inside the skip areas
+            rngStart = (searchStart < centerEnd) ? searchStart : centerEnd;
+            for (idx = rngStart - 1 - totalWinSize; idx < rngStart - 1 - totalWinSize + winSizeFar; idx++)
+                winAvg[0] += powerPtr[idx]; // winFarA
+            for (idx = rngStart + guardSizeFar; idx < rngStart + guardSizeFar + winSizeFar; idx++)
+                winAvg[1] += powerPtr[idx]; // winFarB
+            for (idx = rngStart - 1 - winSizeNear - guardSizeNear; idx < rngStart - 1 - guardSizeNear; idx++)
+                winAvg[2] += powerPtr[idx]; // winNearC
+            for (idx = rngStart + guardSizeNear; idx < rngStart + guardSizeNear + winSizeNear; idx++)
+                winAvg[3] += powerPtr[idx]; // winNearD
+        }
+        else
+        {
+            rngStart = leftSkipSize;
+
+            // Initialize the window sums for position (leftSkipSize - 1)
+            winAvg[0] = leftAvg * winSizeFar; // winFarA
+            winAvg[2] = leftAvg * winSizeNear; // winNearC
+            for (idx = 0; idx < winSizeFar; idx++)
+                winAvg[1] += powerPtr[idx + leftSkipSize + guardSizeFar]; // winFarB
+            for (idx = 0; idx < winSizeNear; idx++)
+                winAvg[3] += powerPtr[idx + leftSkipSize + guardSizeNear]; // winNearD
+        }
 
         // Loop over the near range cells where the left side windows extend beyond leftskip.
         // In this case, use the pre-constructed average for the left side. rng_idx is
         // the index of the center "cell under test".
-        for (rng_idx = leftSkipSize;
-             rng_idx < leftSkipSize + totalWinSize + 1;
+        for (rng_idx = rngStart;
+             (rng_idx < centerStart) && (rng_idx < searchEnd);
              rng_idx++)
         {
             // Update the window sums with the leading edge cell values
@@ -1753,8 +1791,8 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
 
         // Loop over the center range cells where all four windows are contained inside
         // the left and right (range) skip areas.
-        for (rng_idx = leftSkipSize + totalWinSize + 1;
-             rng_idx < detectionCFARInst->fft1DSize - (rightSkipSize + totalWinSize);
+        for (rng_idx = (rngStart > centerStart) ? rngStart : centerStart;
+             (rng_idx < centerEnd) && (rng_idx < searchEnd);
              rng_idx++)
         {
             // Update the window sums with the leading edge cell values
@@ -1830,8 +1868,8 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
         // Loop over the far range cells where the right side windows extend beyond rightskip.
         // In this case, use the pre-constructed average for the right side. rng_idx is
         // the index of the center "cell under test".
-        for (rng_idx = detectionCFARInst->fft1DSize - (rightSkipSize + totalWinSize);
-             rng_idx < detectionCFARInst->fft1DSize - rightSkipSize;
+        for (rng_idx = (rngStart > centerEnd) ? rngStart : centerEnd;
+             rng_idx < searchEnd;
              rng_idx++)
         {
             // Update the window sums with the leading edge cell values
@@ -1914,6 +1952,20 @@ int32_t RADARDEMO_detectionCFAR_raCAAll(
 #endif // USE_CFAR_RATIOS
         }
 
+        // Drop the detections of the near range cells run before searchStart to build the window sums
+        if ((tempDetected > 0) && (tempRangeIndex[0] < searchStart))
+        {
+            uint32_t numKept = 0;
+            for (idx = 0; idx < (int16_t)tempDetected; idx++)
+            {
+                if (tempRangeIndex[idx] >= searchStart)
+                {
+                    tempNoise[numKept]        = tempNoise[idx];
+                    tempRangeIndex[numKept++] = tempRangeIndex[idx];
+                }
+            }
+            tempDetected = numKept;
+        }
 
         if (enableSecondPass) // enable second pass search in the azimuth direction on this range column
         {
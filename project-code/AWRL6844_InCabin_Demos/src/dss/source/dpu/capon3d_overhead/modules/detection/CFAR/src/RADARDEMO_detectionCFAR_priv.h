@@ -327,6 +327,12 @@ extern int32_t	RADARDEMO_detectionCFAR_CAAll(
    \param[out]    noise
                Pointer to the output noise estimation detected objects. 
 			   
+   \param[in]    rangeStartInd
+               First range bin searched.
+			   
+   \param[in]    rangeEndInd
+               Range bin after the last one searched.
+			   
    \ret       number of objects detected.
    
    \pre       none
@@ -346,7 +352,9 @@ extern int32_t	RADARDEMO_detectionCFAR_raCAAll(
 							IN	 float	  * azMaxPerRangeBin,  
 							IN   float		sidelobeThr, 
 							IN   uint8_t	enableSecondPass,
-							IN	 uint8_t	enable_neighbour_check);
+							IN	 uint8_t	enable_neighbour_check,
+							IN   uint16_t	rangeStartInd,
+							IN   uint16_t	rangeEndInd);
 
 /*! 
    \fn     RADARDEMO_detectionCFAR_raCAAll_ver2
@@ -0,0 +1,246 @@
+/**
+ *   @file  radarOsal_memPlan_host_check.c
+ *
+ *   @brief
+ *      Host check of the radarOsal memory plans.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: RADARDEMO_detectionCFAR_rangeSearch_host_check [numScenes]
+ *
+ *  Runs the range-azimuth CFAR of RADARDEMO_detectionCFAR_priv.c on numScenes (default 2000) random heatmaps and
+ *  configurations, then refreshes the heatmap of a few range bins per frame as the static cache does. Each frame,
+ *  the search restricted to the range bins within RADARDEMO_detectionCFAR_rangeReach() of the refreshed ones,
+ *  merged with the detections of the last frame by radarProcess_mergeStaticDet(), is compared with a search of the
+ *  whole heatmap. The functions are extracted from the sources by the script of the same name.
+ *
+ *  The exit status is 0 if every frame gives the same detections, with the noise within a relative 1e-5 (the window
+ *  sums of a restricted search start from a direct sum instead of the running sum).
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "RADARDEMO_detectionCFAR_rangeSearch_host.h"
+
+#define CHECK_MAX_RANGE_BINS    (96)
+#define CHECK_MAX_AZIM_BINS     (16)
+#define CHECK_MAX_AZIM_SKIP     (2)
+#define CHECK_NUM_FRAMES        (8)
+#define CHECK_NOISE_TOL         (1e-5f)
+
+typedef struct
+{
+    uint16_t rangeInd[2 * MAX_STATIC_CFAR_PNTS];
+    uint16_t azimInd[2 * MAX_STATIC_CFAR_PNTS];
+    float    snr[2 * MAX_STATIC_CFAR_PNTS];
+    float    noise[2 * MAX_STATIC_CFAR_PNTS];
+    RADARDEMO_detectionCFAR_output out;
+} checkDetList;
+
+/* the left edge of the azimuth pass reads up to leftSkipSizeAzimuth rows past the heatmap, kept at zero */
+static float   gCheckHeatmap[CHECK_MAX_AZIM_BINS + CHECK_MAX_AZIM_SKIP][CHECK_MAX_RANGE_BINS];
+static float  *gCheckRows[CHECK_MAX_AZIM_BINS + CHECK_MAX_AZIM_SKIP];
+static float   gCheckAzMax[CHECK_MAX_RANGE_BINS];
+static int32_t gCheckScratch[CHECK_MAX_RANGE_BINS * 2];
+
+/* in [0, 1), in double so that 1 - u stays above 0 */
+static double checkUniform(void)
+{
+    return (double)rand() / ((double)RAND_MAX + 1.0);
+}
+
+static int32_t checkRandInt(int32_t lo, int32_t hi)
+{
+    return lo + rand() % (hi - lo + 1);
+}
+
+/* Exponential noise with a few targets over the rows of one range bin, and the max over the rows */
+static void checkFillRangeBin(int32_t rangeIdx, int32_t numAzim)
+{
+    int32_t azimIdx;
+
+    gCheckAzMax[rangeIdx] = 0.f;
+    for (azimIdx = 0; azimIdx < numAzim; azimIdx++)
+    {
+        gCheckHeatmap[azimIdx][rangeIdx] = (float)-log(1.0 - checkUniform());
+        if (checkUniform() < 0.005)
+            gCheckHeatmap[azimIdx][rangeIdx] *= (float)(20.0 + 200.0 * checkUniform());
+        if (gCheckHeatmap[azimIdx][rangeIdx] > gCheckAzMax[rangeIdx])
+            gCheckAzMax[rangeIdx] = gCheckHeatmap[azimIdx][rangeIdx];
+    }
+}
+
+static void checkInitList(checkDetList *list)
+{
+    list->out.rangeInd   = list->rangeInd;
+    list->out.dopplerInd = list->azimInd;
+    list->out.snrEst     = list->snr;
+    list->out.noise      = list->noise;
+    list->out.numObjDetected = 0;
+}
+
+static void checkRun(RADARDEMO_detectionCFAR_handle *cfar, checkDetList *list, uint8_t secondPass, int32_t start,
+                     int32_t end)
+{
+    list->out.numObjDetected = (uint16_t)RADARDEMO_detectionCFAR_raCAAll(gCheckRows, cfar, list->rangeInd,
+                                                                        list->azimInd, list->snr, list->noise,
+                                                                        gCheckAzMax, 0.3f, secondPass, 1,
+                                                                        (uint16_t)start, (uint16_t)end);
+}
+
+int main(int argc, char **argv)
+{
+    int32_t numScenes = (argc > 1) ? atoi(argv[1]) : 2000;
+    int32_t scene, frame, i, numFailed = 0, numFrames = 0, numTruncated = 0, numDet = 0;
+    long    binsSearched = 0, binsFull = 0;
+    uint16_t cacheRangeInd[MAX_STATIC_CFAR_PNTS], cacheAzimInd[MAX_STATIC_CFAR_PNTS];
+    float   cacheSnr[MAX_STATIC_CFAR_PNTS], cacheNoise[MAX_STATIC_CFAR_PNTS];
+    checkDetList ref, test;
+    RADARDEMO_detectionCFAR_handle cfar;
+    radarProcessInstance_t inst;
+
+    srand(1);
+    for (i = 0; i < CHECK_MAX_AZIM_BINS + CHECK_MAX_AZIM_SKIP; i++)
+        gCheckRows[i] = gCheckHeatmap[i];
+    checkInitList(&ref);
+    checkInitList(&test);
+
+    for (scene = 0; scene < numScenes; scene++)
+    {
+        int32_t numRange, numAzim, reach;
+        uint8_t secondPass = (scene % 4) ? 1 : 0;
+
+        memset(&cfar, 0, sizeof(cfar));
+        numRange                  = checkRandInt(48, CHECK_MAX_RANGE_BINS);
+        numAzim                   = checkRandInt(8, CHECK_MAX_AZIM_BINS);
+        cfar.fft1DSize            = numRange;
+        cfar.fft2DSize            = numAzim;
+        cfar.scratchPad           = gCheckScratch;
+        cfar.relThr               = (float)(6.0 + 6.0 * checkUniform());
+        cfar.dopplerSearchRelThr  = (float)(1.0 + 2.0 * checkUniform());
+        cfar.searchWinSizeRange   = (uint8_t)checkRandInt(2, 8);
+        cfar.guardSizeRange       = (uint8_t)checkRandInt(1, 4);
+        /* the near windows lie inside the far ones, the window sums of the near range edge cells assume it */
+        cfar.guardSizeNear        = (uint8_t)checkRandInt(0, 2);
+        cfar.searchWinSizeNear    = (uint8_t)checkRandInt(1, cfar.searchWinSizeRange + cfar.guardSizeRange - cfar.guardSizeNear);
+        cfar.searchWinSizeDoppler = (uint8_t)checkRandInt(1, 2);
+        cfar.guardSizeDoppler     = (uint8_t)checkRandInt(0, 1);
+        cfar.maxNumDetObj         = MAX_STATIC_CFAR_PNTS;
+        cfar.leftSkipSize         = (uint8_t)checkRandInt(0, 4);
+        cfar.rightSkipSize        = (uint8_t)checkRandInt(0, 4);
+        /* the neighbour check reads the rows next to the searched ones */
+        cfar.leftSkipSizeAzimuth  = (uint8_t)checkRandInt(1, CHECK_MAX_AZIM_SKIP);
+        cfar.rightSkipSizeAzimuth = (uint8_t)checkRandInt(1, CHECK_MAX_AZIM_SKIP);
+        cfar.rangeRefIndex        = (uint8_t)checkRandInt(0, 10);
+        reach                     = RADARDEMO_detectionCFAR_rangeReach(&cfar);
+
+        inst.detectionCFAROutput = &test.out;
+        inst.numRangeBins        = numRange;
+        inst.staticDetRangeInd   = cacheRangeInd;
+        inst.staticDetAzimInd    = cacheAzimInd;
+        inst.staticDetSnr        = cacheSnr;
+        inst.staticDetNoise      = cacheNoise;
+        inst.staticNumDet        = 0;
+
+        memset(gCheckHeatmap, 0, sizeof(gCheckHeatmap));
+        for (i = 0; i < numRange; i++)
+            checkFillRangeBin(i, numAzim);
+
+        for (frame = 0; frame < CHECK_NUM_FRAMES; frame++)
+        {
+            int32_t start = numRange, end = 0, numRefreshed, det;
+
+            /* the first frame refreshes the whole heatmap, the others a few range bins */
+            numRefreshed = (frame == 0) ? numRange : checkRandInt(0, 3);
+            for (i = 0; i < numRefreshed; i++)
+            {
+                int32_t rangeIdx = (frame == 0) ? i : checkRandInt(cfar.leftSkipSize, numRange - cfar.rightSkipSize - 1);
+                checkFillRangeBin(rangeIdx, numAzim);
+                if (rangeIdx < start)
+                    start = rangeIdx;
+                if (rangeIdx >= end)
+                    end = rangeIdx + 1;
+            }
+            if (numRefreshed == 0)
+                continue;
+
+            /* same search range as DPU_radarProcess_process */
+            if (inst.staticNumDet < MAX_STATIC_CFAR_PNTS)
+            {
+                start = (start > reach) ? (start - reach) : 0;
+                end   = (end + reach < numRange) ? (end + reach) : numRange;
+            }
+            else
+            {
+                start = 0;
+                end   = numRange;
+                numTruncated++;
+            }
+            binsSearched += end - start;
+            binsFull += numRange;
+
+            checkRun(&cfar, &ref, secondPass, 0, numRange);
+            checkRun(&cfar, &test, secondPass, start, end);
+            radarProcess_mergeStaticDet(&inst, start, end);
+            numFrames++;
+            numDet += ref.out.numObjDetected;
+
+            if (test.out.numObjDetected != ref.out.numObjDetected)
+            {
+                numFailed++;
+                continue;
+            }
+            for (det = 0; det < ref.out.numObjDetected; det++)
+            {
+                if ((test.rangeInd[det] != ref.rangeInd[det]) || (test.azimInd[det] != ref.azimInd[det]) ||
+                    (fabsf(test.noise[det] - ref.noise[det]) > CHECK_NOISE_TOL * fabsf(ref.noise[det])) ||
+                    (fabsf(test.snr[det] - ref.snr[det]) > CHECK_NOISE_TOL * fabsf(ref.snr[det])))
+                {
+                    numFailed++;
+                    break;
+                }
+            }
+        }
+    }
+
+    printf("%d frames, %d detections, %d full searches after a truncated list\n", numFrames, numDet, numTruncated);
+    printf("range bins searched: %.1f%% of the whole heatmap\n", 100.0 * (double)binsSearched / (double)binsFull);
+    printf("%s: %d failed checks\n", numFailed ? "FAIL" : "PASS", numFailed);
+    return numFailed ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the range restricted static CFAR on the host
+#
+#   RADARDEMO_detectionCFAR_rangeSearch_host_check.sh [numScenes]
+#
+# The range-azimuth CFAR and its handle are extracted from RADARDEMO_detectionCFAR_priv.c and
+# RADARDEMO_detectionCFAR_priv.h, the merge of the static detection cache from radarProcess.c, so the check runs
+# the code of the demo.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./RADARDEMO_detectionCFAR_rangeSearch_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+DPU_SRC_DIR="$TOOLS_DIR/../../../../src"
+DSS_DIR="$TOOLS_DIR/../../../../../../.."
+BUILD_DIR=${BUILD_DIR:-./RADARDEMO_detectionCFAR_rangeSearch_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+{
+    cat "$TOOLS_DIR/RADARDEMO_detectionCFAR_rangeSearch_host_shim.h"
+    sed -n '/^typedef enum/,/^} RADARDEMO_detectionCFAR_handle;/p' "$SRC_DIR/RADARDEMO_detectionCFAR_priv.h"
+    echo 'int32_t RADARDEMO_detectionCFAR_raCAAll(float **InputPower, RADARDEMO_detectionCFAR_handle *detectionCFARInst, uint16_t *rangeInd, uint16_t *azimuthInd, float *snrEst, float *noise, float *azMaxPerRangeBin, float sidelobeThr, uint8_t enableSecondPass, uint8_t enable_neighbour_check, uint16_t rangeStartInd, uint16_t rangeEndInd);'
+    echo 'void radarProcess_mergeStaticDet(radarProcessInstance_t *inst, int32_t rangeStart, int32_t rangeEnd);'
+} > "$BUILD_DIR/RADARDEMO_detectionCFAR_rangeSearch_host.h"
+{
+    echo '#include "RADARDEMO_detectionCFAR_rangeSearch_host.h"'
+    awk '/^\/\/ Note: This function has been modified for VOD 3D 2-pass/ { on = 1 }
+         on { print }
+         on && /^}/ { exit }' "$SRC_DIR/RADARDEMO_detectionCFAR_priv.c"
+    awk '/^int32_t\tRADARDEMO_detectionCFAR_rangeReach\(/ { on = 1 }
+         on { print }
+         on && /^}/ { exit }' "$SRC_DIR/RADARDEMO_detectionCFAR.c"
+    awk '/^static void radarProcess_mergeStaticDet\(/ { on = 1; sub(/^static /, "") }
+         on { print }
+         on && /^}/ { exit }' "$DPU_SRC_DIR/radarProcess.c"
+} > "$BUILD_DIR/RADARDEMO_detectionCFAR_rangeSearch_host.c"
+
+$CC -O2 -Wall -std=gnu99 -D_LITTLE_ENDIAN -I "$DSS_DIR" -I "$BUILD_DIR" -o "$BUILD_DIR/RADARDEMO_detectionCFAR_rangeSearch_host_check" \
+    "$TOOLS_DIR/RADARDEMO_detectionCFAR_rangeSearch_host_check.c" "$BUILD_DIR/RADARDEMO_detectionCFAR_rangeSearch_host.c" -lm
+"$BUILD_DIR/RADARDEMO_detectionCFAR_rangeSearch_host_check" "$@"
@@ -0,0 +1,69 @@
+/**
+ *   @file  radarOsal_memPlan_host_check.c
+ *
+ *   @brief
+ *      Host check of the radarOsal memory plans.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef RADARDEMO_DETECTIONCFAR_RANGESEARCH_HOST_SHIM_H
+#define RADARDEMO_DETECTIONCFAR_RANGESEARCH_HOST_SHIM_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <source/dpu/capon3d_overhead/modules/detection/CFAR/api/RADARDEMO_detectionCFAR.h>
+
+#define MAX_FLOAT 3.40E+38
+
+static inline float divsp_i(float a, float b)
+{
+    return a / b;
+}
+
+/* Static detection cache of radarProcess, the fields read by radarProcess_mergeStaticDet */
+#define MAX_STATIC_CFAR_PNTS    (40)
+
+typedef struct
+{
+    RADARDEMO_detectionCFAR_output *detectionCFAROutput;
+    int32_t   numRangeBins;
+    uint16_t *staticDetRangeInd;
+    uint16_t *staticDetAzimInd;
+    float    *staticDetSnr;
+    float    *staticDetNoise;
+    int32_t   staticNumDet;
+} radarProcessInstance_t;
+
+#endif
@@ -0,0 +1,489 @@
+/*!
+ *  \file   radar_cplxMath.h
+ *
+ *  \brief   Inline single precision complex math shared by the DoA modules.
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Complex values are held in a __float2_t, real part in the high word (_hif2) and imaginary part in the low word
+ * (_lof2), which is the register image of a cplxf_t loaded with _amem8_f2(). In memory a complex value is two floats,
+ * imaginary part first.
+ *
+ * Implementations behind the same functions:
+ * - _TMS320C6X: the C6x intrinsics. The C66x has the complex multiply in hardware, the C674x gets it from
+ *   radar_c674x.h. _rcpsp()/_rsqrsp() seed the reciprocals.
+ * - host, scalar: plain C on _hif2/_lof2/_ftof2, which the host build provides with __float2_t. Selected with
+ *   RADAR_CPLXMATH_SCALAR, or when none of the SIMD instruction sets below is enabled.
+ * - host, SSE2, AVX or NEON, picked from the compiler target flags: the vector functions (cdotconjsp_i,
+ *   hermquadsp_i, hermmatvecsp_i) process 2 (SSE2, NEON) or 4 (AVX) complex values per instruction, and the
+ *   reciprocals refine the instruction set estimate. A single complex product gains nothing from the vector lanes,
+ *   the per element functions are the scalar ones.
+ *
+ * The C6x and the scalar implementations compute the same products in the same order, the results only differ by
+ * the rounding of the C66x fused complex multiply. The SIMD implementations sum in a different order.
+ *
+ * Hermitian matrices are stored as the DoA modules store the inverse covariance: upper triangle packed row by row,
+ * R(0,0), R(0,1), ..., R(0,n-1), R(1,1), ..., R(n-1,n-1), n(n+1)/2 entries, with a real diagonal.
+ */
+
+#ifndef _RADARDEMO_CPLXMATH_H
+#define _RADARDEMO_CPLXMATH_H
+
+#include <source/common/swpform.h>
+
+#if defined(_TMS320C6X)
+#include "radar_c674x.h"
+#define RADAR_CPLXMATH_C6X
+#define RADAR_CPLXMATH_BACKEND      "C6x"
+#elif defined(RADAR_CPLXMATH_SCALAR)
+#include <math.h>
+#define RADAR_CPLXMATH_BACKEND      "scalar"
+#elif defined(__AVX__)
+#include <math.h>
+#include <immintrin.h>
+#define RADAR_CPLXMATH_SSE
+#define RADAR_CPLXMATH_AVX
+#define RADAR_CPLXMATH_BACKEND      "AVX"
+#elif defined(__SSE2__)
+#include <math.h>
+#include <immintrin.h>
+#define RADAR_CPLXMATH_SSE
+#define RADAR_CPLXMATH_BACKEND      "SSE2"
+#elif defined(__ARM_NEON)
+#include <math.h>
+#include <arm_neon.h>
+#define RADAR_CPLXMATH_NEON
+#define RADAR_CPLXMATH_BACKEND      "NEON"
+#else
+#include <math.h>
+#define RADAR_CPLXMATH_BACKEND      "scalar"
+#endif
+
+/* complex multiply, x * y */
+INLINE __float2_t cmpysp_i(__float2_t x, __float2_t y)
+{
+#ifdef RADAR_CPLXMATH_C6X
+    return (_complex_mpysp(x, y));
+#else
+    return (_ftof2(_hif2(x) * _hif2(y) - _lof2(x) * _lof2(y), _hif2(x) * _lof2(y) + _lof2(x) * _hif2(y)));
+#endif
+}
+
+/* conjugate complex multiply, conj(x) * y */
+INLINE __float2_t cconjmpysp_i(__float2_t x, __float2_t y)
+{
+#ifdef RADAR_CPLXMATH_C6X
+    return (_complex_conjugate_mpysp(x, y));
+#else
+    return (_ftof2(_hif2(x) * _hif2(y) + _lof2(x) * _lof2(y), _hif2(x) * _lof2(y) - _lof2(x) * _hif2(y)));
+#endif
+}
+
+/* complex multiply-accumulate, acc + x * y */
+INLINE __float2_t cmacsp_i(__float2_t acc, __float2_t x, __float2_t y)
+{
+#ifdef RADAR_CPLXMATH_C6X
+    return (_daddsp(acc, _complex_mpysp(x, y)));
+#else
+    return (_ftof2(_hif2(acc) + (_hif2(x) * _hif2(y) - _lof2(x) * _lof2(y)), _lof2(acc) + (_hif2(x) * _lof2(y) + _lof2(x) * _hif2(y))));
+#endif
+}
+
+/* conjugate complex multiply-accumulate, acc + conj(x) * y */
+INLINE __float2_t cconjmacsp_i(__float2_t acc, __float2_t x, __float2_t y)
+{
+#ifdef RADAR_CPLXMATH_C6X
+    return (_daddsp(acc, _complex_conjugate_mpysp(x, y)));
+#else
+    return (_ftof2(_hif2(acc) + (_hif2(x) * _hif2(y) + _lof2(x) * _lof2(y)), _lof2(acc) + (_hif2(x) * _lof2(y) - _lof2(x) * _hif2(y))));
+#endif
+}
+
+/* squared magnitude, |x|^2 */
+INLINE float cmagsqsp_i(__float2_t x)
+{
+#ifdef RADAR_CPLXMATH_C6X
+    __float2_t f2temp = _dmpysp(x, x);
+    return (_hif2(f2temp) + _lof2(f2temp));
+#else
+    return (_hif2(x) * _hif2(x) + _lof2(x) * _lof2(x));
+#endif
+}
+
+#if defined(RADAR_CPLXMATH_SSE)
+/* Sums over n complex values of x * y (conj = 0) or conj(x) * y (conj = 1), memory layout imaginary part first. The
+ * lane products x * y give the real part, the products with the swapped y the imaginary part */
+INLINE __float2_t cdotsp_sse(const float * RESTRICT x, const float * RESTRICT y, int32_t n, int32_t conj)
+{
+    int32_t i;
+    float   a[4], b[4], re, im;
+    __m128  accA = _mm_setzero_ps();
+    __m128  accB = _mm_setzero_ps();
+    __m128  xv, yv;
+
+#ifdef RADAR_CPLXMATH_AVX
+    __m256 accA8 = _mm256_setzero_ps();
+    __m256 accB8 = _mm256_setzero_ps();
+    __m256 xv8, yv8;
+
+    /* the 256 bit reduction only pays off from 8 values, the rows of hermquadsp_i() are mostly shorter */
+    i = 0;
+    if (n >= 8)
+    {
+        for (; i + 3 < n; i += 4)
+        {
+            xv8   = _mm256_loadu_ps(&x[2 * i]);
+            yv8   = _mm256_loadu_ps(&y[2 * i]);
+            accA8 = _mm256_add_ps(accA8, _mm256_mul_ps(xv8, yv8));
+            accB8 = _mm256_add_ps(accB8, _mm256_mul_ps(xv8, _mm256_permute_ps(yv8, 0xB1)));
+        }
+        accA = _mm_add_ps(_mm256_castps256_ps128(accA8), _mm256_extractf128_ps(accA8, 1));
+        accB = _mm_add_ps(_mm256_castps256_ps128(accB8), _mm256_extractf128_ps(accB8, 1));
+    }
+#else
+    i = 0;
+#endif
+    for (; i + 1 < n; i += 2)
+    {
+        xv   = _mm_loadu_ps(&x[2 * i]);
+        yv   = _mm_loadu_ps(&y[2 * i]);
+        accA = _mm_add_ps(accA, _mm_mul_ps(xv, yv));
+        accB = _mm_add_ps(accB, _mm_mul_ps(xv, _mm_shuffle_ps(yv, yv, _MM_SHUFFLE(2, 3, 0, 1))));
+    }
+    _mm_storeu_ps(a, accA);
+    _mm_storeu_ps(b, accB);
+    if (i < n)
+    {
+        a[0] += x[2 * i] * y[2 * i];
+        a[1] += x[2 * i + 1] * y[2 * i + 1];
+        b[0] += x[2 * i] * y[2 * i + 1];
+        b[1] += x[2 * i + 1] * y[2 * i];
+    }
+    /* a: xi*yi, xr*yr; b: xi*yr, xr*yi */
+    if (conj)
+    {
+        re = (a[1] + a[3]) + (a[0] + a[2]);
+        im = (b[1] + b[3]) - (b[0] + b[2]);
+    }
+    else
+    {
+        re = (a[1] + a[3]) - (a[0] + a[2]);
+        im = (b[1] + b[3]) + (b[0] + b[2]);
+    }
+    return (_ftof2(re, im));
+}
+
+/* y[j] += conj(x[j]) * c for n complex values, c given as real and imaginary part. With x = [xi, xr] in memory,
+ * conj(x) * c = [xr*ci - xi*cr, xr*cr + xi*ci] is x times [-cr, cr] plus the swapped x times ci */
+INLINE void caxpyconjsp_sse(const float * RESTRICT x, float * RESTRICT y, float cRe, float cIm, int32_t n)
+{
+    int32_t i;
+    __m128  cr = _mm_setr_ps(-cRe, cRe, -cRe, cRe);
+    __m128  ci = _mm_set1_ps(cIm);
+    __m128  xv;
+
+#ifdef RADAR_CPLXMATH_AVX
+    __m256 cr8 = _mm256_setr_ps(-cRe, cRe, -cRe, cRe, -cRe, cRe, -cRe, cRe);
+    __m256 ci8 = _mm256_set1_ps(cIm);
+    __m256 xv8;
+
+    for (i = 0; i + 3 < n; i += 4)
+    {
+        xv8 = _mm256_loadu_ps(&x[2 * i]);
+        _mm256_storeu_ps(&y[2 * i], _mm256_add_ps(_mm256_loadu_ps(&y[2 * i]), _mm256_add_ps(_mm256_mul_ps(xv8, cr8), _mm256_mul_ps(_mm256_permute_ps(xv8, 0xB1), ci8))));
+    }
+#else
+    i = 0;
+#endif
+    for (; i + 1 < n; i += 2)
+    {
+        xv = _mm_loadu_ps(&x[2 * i]);
+        _mm_storeu_ps(&y[2 * i], _mm_add_ps(_mm_loadu_ps(&y[2 * i]), _mm_add_ps(_mm_mul_ps(xv, cr), _mm_mul_ps(_mm_shuffle_ps(xv, xv, _MM_SHUFFLE(2, 3, 0, 1)), ci))));
+    }
+    if (i < n)
+    {
+        y[2 * i]     += x[2 * i + 1] * cIm - x[2 * i] * cRe;
+        y[2 * i + 1] += x[2 * i + 1] * cRe + x[2 * i] * cIm;
+    }
+}
+#endif
+
+#if defined(RADAR_CPLXMATH_NEON)
+/* same as cdotsp_sse(), 2 complex values per vector */
+INLINE __float2_t cdotsp_neon(const float * RESTRICT x, const float * RESTRICT y, int32_t n, int32_t conj)
+{
+    int32_t     i;
+    float       a[4], b[4], re, im;
+    float32x4_t accA = vdupq_n_f32(0.f);
+    float32x4_t accB = vdupq_n_f32(0.f);
+    float32x4_t xv, yv;
+
+    for (i = 0; i + 1 < n; i += 2)
+    {
+        xv   = vld1q_f32(&x[2 * i]);
+        yv   = vld1q_f32(&y[2 * i]);
+        accA = vmlaq_f32(accA, xv, yv);
+        accB = vmlaq_f32(accB, xv, vrev64q_f32(yv));
+    }
+    vst1q_f32(a, accA);
+    vst1q_f32(b, accB);
+    if (i < n)
+    {
+        a[0] += x[2 * i] * y[2 * i];
+        a[1] += x[2 * i + 1] * y[2 * i + 1];
+        b[0] += x[2 * i] * y[2 * i + 1];
+        b[1] += x[2 * i + 1] * y[2 * i];
+    }
+    if (conj)
+    {
+        re = (a[1] + a[3]) + (a[0] + a[2]);
+        im = (b[1] + b[3]) - (b[0] + b[2]);
+    }
+    else
+    {
+        re = (a[1] + a[3]) - (a[0] + a[2]);
+        im = (b[1] + b[3]) + (b[0] + b[2]);
+    }
+    return (_ftof2(re, im));
+}
+
+/* same as caxpyconjsp_sse() */
+INLINE void caxpyconjsp_neon(const float * RESTRICT x, float * RESTRICT y, float cRe, float cIm, int32_t n)
+{
+    int32_t     i;
+    const float crSign[4] = {-cRe, cRe, -cRe, cRe};
+    float32x4_t cr        = vld1q_f32(crSign);
+    float32x4_t ci        = vdupq_n_f32(cIm);
+    float32x4_t xv, yv;
+
+    for (i = 0; i + 1 < n; i += 2)
+    {
+        xv = vld1q_f32(&x[2 * i]);
+        yv = vld1q_f32(&y[2 * i]);
+        yv = vmlaq_f32(yv, xv, cr);
+        yv = vmlaq_f32(yv, vrev64q_f32(xv), ci);
+        vst1q_f32(&y[2 * i], yv);
+    }
+    if (i < n)
+    {
+        y[2 * i]     += x[2 * i + 1] * cIm - x[2 * i] * cRe;
+        y[2 * i + 1] += x[2 * i + 1] * cRe + x[2 * i] * cIm;
+    }
+}
+#endif
+
+#if defined(RADAR_CPLXMATH_SSE)
+#define RADAR_CPLXMATH_CDOT(x, y, n, conj)              cdotsp_sse((const float *)(x), (const float *)(y), (n), (conj))
+#define RADAR_CPLXMATH_CAXPYCONJ(x, y, cRe, cIm, n)     caxpyconjsp_sse((const float *)(x), (float *)(y), (cRe), (cIm), (n))
+#elif defined(RADAR_CPLXMATH_NEON)
+#define RADAR_CPLXMATH_CDOT(x, y, n, conj)              cdotsp_neon((const float *)(x), (const float *)(y), (n), (conj))
+#define RADAR_CPLXMATH_CAXPYCONJ(x, y, cRe, cIm, n)     caxpyconjsp_neon((const float *)(x), (float *)(y), (cRe), (cIm), (n))
+#endif
+
+/* conjugate dot product, sum_i conj(x[i]) * y[i] */
+INLINE __float2_t cdotconjsp_i(__float2_t * RESTRICT x, __float2_t * RESTRICT y, int32_t n)
+{
+#ifdef RADAR_CPLXMATH_CDOT
+    return (RADAR_CPLXMATH_CDOT(x, y, n, 1));
+#else
+    int32_t    i;
+    __float2_t acc0 = _ftof2(0.f, 0.f);
+    __float2_t acc1 = _ftof2(0.f, 0.f);
+
+    /* two accumulators to hide the add latency */
+    for (i = 0; i + 1 < n; i += 2)
+    {
+        acc0 = cconjmacsp_i(acc0, _amem8_f2(&x[i]), _amem8_f2(&y[i]));
+        acc1 = cconjmacsp_i(acc1, _amem8_f2(&x[i + 1]), _amem8_f2(&y[i + 1]));
+    }
+    if (i < n)
+        acc0 = cconjmacsp_i(acc0, _amem8_f2(&x[i]), _amem8_f2(&y[i]));
+    return (_ftof2(_hif2(acc0) + _hif2(acc1), _lof2(acc0) + _lof2(acc1)));
+#endif
+}
+
+/* Hermitian quadratic form a^H R a of a packed Hermitian matrix, real. The entries of a have unit modulus, as the
+ * steering vectors, the diagonal adds R(i,i) without multiply */
+INLINE float hermquadsp_i(__float2_t * RESTRICT R, __float2_t * RESTRICT a, int32_t n)
+{
+#ifdef RADAR_CPLXMATH_CDOT
+    int32_t    i, rnIdx;
+    __float2_t acc0f2;
+    float      output;
+
+    /* per row, Re(conj(a(i)) * sum_j>i R(i,j) a(j)) */
+    rnIdx  = 0;
+    output = 0.f;
+    for (i = 0; i < n; i++)
+    {
+        output += _hif2(_amem8_f2(&R[rnIdx]));
+        acc0f2  = RADAR_CPLXMATH_CDOT(&R[rnIdx + 1], &a[i + 1], n - 1 - i, 0);
+        output += 2.f * _hif2(cconjmpysp_i(_amem8_f2(&a[i]), acc0f2));
+        rnIdx  += n - i;
+    }
+    return (output);
+#else
+    int32_t    i, j, rnIdx;
+    __float2_t acc0f2;
+    float      output;
+
+    rnIdx  = 0;
+    output = 0.f;
+    for (i = 0; i < n; i++)
+    {
+        output += _hif2(_amem8_f2(&R[rnIdx++]));
+        for (j = i + 1; j < n; j++)
+        {
+            acc0f2  = cconjmpysp_i(_amem8_f2(&a[i]), _amem8_f2(&R[rnIdx++]));
+            acc0f2  = cmpysp_i(_amem8_f2(&a[j]), acc0f2);
+            output += 2.f * _hif2(acc0f2);
+        }
+    }
+    return (output);
+#endif
+}
+
+/* Hermitian matrix-vector product w = R a of a packed Hermitian matrix */
+INLINE void hermmatvecsp_i(__float2_t * RESTRICT R, __float2_t * RESTRICT a, __float2_t * RESTRICT w, int32_t n)
+{
+#ifdef RADAR_CPLXMATH_CDOT
+    int32_t    i, rnIdx;
+    __float2_t acc0f2, ai;
+
+    /* row i of the packed upper triangle gives w(i) += R(i,j) a(j) and, for the lower triangle,
+     * w(j) += conj(R(i,j)) a(i), both over the contiguous j > i */
+    for (i = 0; i < n; i++)
+        _amem8_f2(&w[i]) = _ftof2(0.f, 0.f);
+    rnIdx = 0;
+    for (i = 0; i < n; i++)
+    {
+        ai     = _amem8_f2(&a[i]);
+        acc0f2 = cmacsp_i(RADAR_CPLXMATH_CDOT(&R[rnIdx + 1], &a[i + 1], n - 1 - i, 0), ai, _amem8_f2(&R[rnIdx]));
+        _amem8_f2(&w[i]) = _ftof2(_hif2(_amem8_f2(&w[i])) + _hif2(acc0f2), _lof2(_amem8_f2(&w[i])) + _lof2(acc0f2));
+        RADAR_CPLXMATH_CAXPYCONJ(&R[rnIdx + 1], &w[i + 1], _hif2(ai), _lof2(ai), n - 1 - i);
+        rnIdx += n - i;
+    }
+#else
+    int32_t    i, j, k, rnIdx, rnIdx1;
+    __float2_t acc0f2;
+
+    rnIdx = 0;
+    for (i = 0; i < n; i++)
+    {
+        /* R(j,i) = conj(R(i,j)) for j < i, read down column i of the packed rows */
+        rnIdx1 = i;
+        acc0f2 = cmpysp_i(_amem8_f2(&a[i]), _amem8_f2(&R[rnIdx++]));
+        k      = n - 1;
+        for (j = 0; j < i; j++)
+        {
+            acc0f2  = cconjmacsp_i(acc0f2, _amem8_f2(&R[rnIdx1]), _amem8_f2(&a[j]));
+            rnIdx1 += k;
+            k--;
+        }
+        for (j = i + 1; j < n; j++)
+        {
+            acc0f2 = cmacsp_i(acc0f2, _amem8_f2(&a[j]), _amem8_f2(&R[rnIdx++]));
+        }
+        _amem8_f2(&w[i]) = acc0f2;
+    }
+#endif
+}
+
+/* reciprocal, 1/x: the 8 bit _rcpsp() or vrecpe estimate and two Newton-Raphson steps, the 12 bit SSE estimate and
+ * one step, a division in scalar C */
+INLINE float rcpsp_i(float x)
+{
+#if defined(RADAR_CPLXMATH_C6X) || defined(RADAR_CPLXMATH_NEON)
+    float y;
+
+#if defined(RADAR_CPLXMATH_C6X)
+    y = _rcpsp(x);
+#else
+    y = vget_lane_f32(vrecpe_f32(vdup_n_f32(x)), 0);
+#endif
+    y = y * (2.f - x * y);
+    y = y * (2.f - x * y);
+    return (y);
+#elif defined(RADAR_CPLXMATH_SSE)
+    float y = _mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(x)));
+
+    return (y * (2.f - x * y));
+#else
+    return (1.f / x);
+#endif
+}
+
+/* reciprocal square root, 1/sqrt(x): the 8 bit _rsqrsp() or vrsqrte estimate and two Newton-Raphson steps, the 12 bit
+ * SSE estimate and one step */
+INLINE float rsqrtsp_i(float x)
+{
+#if defined(RADAR_CPLXMATH_C6X) || defined(RADAR_CPLXMATH_NEON)
+    float y;
+
+#if defined(RADAR_CPLXMATH_C6X)
+    y = _rsqrsp(x);
+#else
+    y = vget_lane_f32(vrsqrte_f32(vdup_n_f32(x)), 0);
+#endif
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    return (y);
+#elif defined(RADAR_CPLXMATH_SSE)
+    float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+
+    return (y * (1.5f - 0.5f * x * y * y));
+#else
+    return (1.f / sqrtf(x));
+#endif
+}
+
+#ifdef RADAR_CPLXMATH_BENCHMARK
+/*! @brief Maximum vector length of radar_cplxMathBenchmark() */
+#define RADAR_CPLXMATH_BENCHMARK_MAX_N      (16)
+
+/*!
+   \fn     radar_cplxMathBenchmark
+   \brief   Measures the cycles of each function of radar_cplxMath.h on the target, or the time in ns in a host build,
+            and checks them against a double precision reference. The results are printed.
+
+   \param[in]    n
+               Vector length and matrix order, up to RADAR_CPLXMATH_BENCHMARK_MAX_N.
+
+   \return    none.
+ */
+extern void radar_cplxMathBenchmark(int32_t n);
+#endif
+
+#endif //_RADARDEMO_CPLXMATH_H
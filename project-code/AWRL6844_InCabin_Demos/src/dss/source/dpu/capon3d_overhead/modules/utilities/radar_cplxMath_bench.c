@@ -0,0 +1,279 @@
+/*!
+ *  \file   radar_cplxMath_bench.c
+ *
+ *  \brief   Micro-benchmarks of radar_cplxMath.h.
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Built with RADAR_CPLXMATH_BENCHMARK only. Each function of radar_cplxMath.h is run on fixed pseudo random data,
+ * the cycles (ns in a host build) are the best of 4 runs of RADAR_CPLXMATH_BENCH_NUMCALLS calls and the error is the
+ * largest relative error against a double precision reference.
+ */
+
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_cplxMath.h>
+
+#ifdef RADAR_CPLXMATH_BENCHMARK
+
+#include <stdio.h>
+#include <math.h>
+
+#ifdef _TMS320C6X
+#include "c6x.h"
+#define RADAR_CPLXMATH_BENCH_TIME()     (TSCL)
+#define RADAR_CPLXMATH_BENCH_UNIT       "cycles"
+#else
+#include <time.h>
+/* host build, time in ns, wraps as TSCL */
+static uint32_t radar_cplxMathBenchTime(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec));
+}
+#define RADAR_CPLXMATH_BENCH_TIME()     radar_cplxMathBenchTime()
+#define RADAR_CPLXMATH_BENCH_UNIT       "ns"
+#endif
+
+#ifndef RADAR_CPLXMATH_BENCH_NUMCALLS
+#define RADAR_CPLXMATH_BENCH_NUMCALLS   (64)
+#endif
+#define RADAR_CPLXMATH_BENCH_MAX_RN     ((RADAR_CPLXMATH_BENCHMARK_MAX_N * (RADAR_CPLXMATH_BENCHMARK_MAX_N + 1)) / 2)
+
+#pragma DATA_ALIGN(gCplxMathBenchX, 8)
+static float gCplxMathBenchX[2 * RADAR_CPLXMATH_BENCHMARK_MAX_N];
+#pragma DATA_ALIGN(gCplxMathBenchY, 8)
+static float gCplxMathBenchY[2 * RADAR_CPLXMATH_BENCHMARK_MAX_N];
+#pragma DATA_ALIGN(gCplxMathBenchW, 8)
+static float gCplxMathBenchW[2 * RADAR_CPLXMATH_BENCHMARK_MAX_N];
+#pragma DATA_ALIGN(gCplxMathBenchRn, 8)
+static float gCplxMathBenchRn[2 * RADAR_CPLXMATH_BENCH_MAX_RN];
+
+/* volatile sink, so that the calls are not removed */
+static volatile float gCplxMathBenchSink;
+
+/* element (i, j) of the packed Hermitian matrix, double precision */
+static void radar_cplxMathBenchRn(int32_t n, int32_t i, int32_t j, double *re, double *im)
+{
+    int32_t row, col, idx;
+
+    row = (i < j) ? i : j;
+    col = (i < j) ? j : i;
+    idx = row * n - (row * (row - 1)) / 2 + (col - row);
+    *re = (double)gCplxMathBenchRn[2 * idx + 1];
+    *im = (i <= j) ? (double)gCplxMathBenchRn[2 * idx] : -(double)gCplxMathBenchRn[2 * idx];
+}
+
+static float radar_cplxMathBenchErr(double val, double ref)
+{
+    return ((float)(fabs(val - ref) / ((fabs(ref) > 1e-30) ? fabs(ref) : 1.0)));
+}
+
+//! \copydoc radar_cplxMathBenchmark
+void radar_cplxMathBenchmark(int32_t n)
+{
+    int32_t    i, j, run, call;
+    uint32_t   t1, cycles[8];
+    float      err[8];
+    double     refRe, refIm, accRe, accIm, rRe, rIm, xRe, xIm;
+    __float2_t *x, *y, *w, *Rn, f2temp;
+    float      ftemp;
+    const char *name[8] = {"cmpysp_i", "cconjmpysp_i", "cmacsp_i", "cdotconjsp_i", "hermquadsp_i", "hermmatvecsp_i", "rcpsp_i", "rsqrtsp_i"};
+
+    if ((n < 1) || (n > RADAR_CPLXMATH_BENCHMARK_MAX_N))
+        return;
+
+    x  = (__float2_t *)gCplxMathBenchX;
+    y  = (__float2_t *)gCplxMathBenchY;
+    w  = (__float2_t *)gCplxMathBenchW;
+    Rn = (__float2_t *)gCplxMathBenchRn;
+    for (i = 0; i < 2 * n; i++)
+    {
+        gCplxMathBenchX[i] = (float)(((i * 7919) & 0x3FF) - 512) / 512.f;
+        gCplxMathBenchY[i] = (float)(((i * 104729) & 0x3FF) - 512) / 512.f;
+    }
+    for (i = 0; i < n * (n + 1); i++)
+        gCplxMathBenchRn[i] = (float)(((i * 1299709) & 0x3FF) - 512) / 2048.f;
+    /* real diagonal, diagonally dominant */
+    for (i = 0, j = 0; i < n; j += n - i, i++)
+    {
+        gCplxMathBenchRn[2 * j]     = 0.f;
+        gCplxMathBenchRn[2 * j + 1] = (float)n;
+    }
+
+    for (i = 0; i < 8; i++)
+    {
+        cycles[i] = 0xFFFFFFFFU;
+        err[i]    = 0.f;
+    }
+
+    for (run = 0; run < 4; run++)
+    {
+        t1 = RADAR_CPLXMATH_BENCH_TIME();
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            _amem8_f2(&w[0]) = cmpysp_i(_amem8_f2(&x[0]), _amem8_f2(&y[0]));
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[0] = (t1 < cycles[0]) ? t1 : cycles[0];
+
+        t1 = RADAR_CPLXMATH_BENCH_TIME();
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            _amem8_f2(&w[0]) = cconjmpysp_i(_amem8_f2(&x[0]), _amem8_f2(&y[0]));
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[1] = (t1 < cycles[1]) ? t1 : cycles[1];
+
+        t1     = RADAR_CPLXMATH_BENCH_TIME();
+        f2temp = _ftof2(0.f, 0.f);
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            f2temp = cmacsp_i(f2temp, _amem8_f2(&x[call % n]), _amem8_f2(&y[call % n]));
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[2] = (t1 < cycles[2]) ? t1 : cycles[2];
+        gCplxMathBenchSink = _hif2(f2temp);
+
+        t1 = RADAR_CPLXMATH_BENCH_TIME();
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            _amem8_f2(&w[0]) = cdotconjsp_i(x, y, n);
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[3] = (t1 < cycles[3]) ? t1 : cycles[3];
+
+        t1    = RADAR_CPLXMATH_BENCH_TIME();
+        ftemp = 0.f;
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            ftemp += hermquadsp_i(Rn, x, n);
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[4] = (t1 < cycles[4]) ? t1 : cycles[4];
+        gCplxMathBenchSink = ftemp;
+
+        t1 = RADAR_CPLXMATH_BENCH_TIME();
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            hermmatvecsp_i(Rn, x, w, n);
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[5] = (t1 < cycles[5]) ? t1 : cycles[5];
+
+        t1    = RADAR_CPLXMATH_BENCH_TIME();
+        ftemp = 0.f;
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            ftemp += rcpsp_i((float)(call + 1));
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[6] = (t1 < cycles[6]) ? t1 : cycles[6];
+        gCplxMathBenchSink = ftemp;
+
+        t1    = RADAR_CPLXMATH_BENCH_TIME();
+        ftemp = 0.f;
+        for (call = 0; call < RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+            ftemp += rsqrtsp_i((float)(call + 1));
+        t1 = RADAR_CPLXMATH_BENCH_TIME() - t1;
+        cycles[7] = (t1 < cycles[7]) ? t1 : cycles[7];
+        gCplxMathBenchSink = ftemp;
+    }
+
+    /* accuracy */
+    for (i = 0; i < n; i++)
+    {
+        xRe   = (double)gCplxMathBenchX[2 * i + 1];
+        xIm   = (double)gCplxMathBenchX[2 * i];
+        refRe = xRe * gCplxMathBenchY[2 * i + 1] - xIm * gCplxMathBenchY[2 * i];
+        refIm = xRe * gCplxMathBenchY[2 * i] + xIm * gCplxMathBenchY[2 * i + 1];
+        f2temp = cmpysp_i(_amem8_f2(&x[i]), _amem8_f2(&y[i]));
+        ftemp  = radar_cplxMathBenchErr(_hif2(f2temp), refRe) + radar_cplxMathBenchErr(_lof2(f2temp), refIm);
+        err[0] = (ftemp > err[0]) ? ftemp : err[0];
+        refRe  = xRe * gCplxMathBenchY[2 * i + 1] + xIm * gCplxMathBenchY[2 * i];
+        refIm  = xRe * gCplxMathBenchY[2 * i] - xIm * gCplxMathBenchY[2 * i + 1];
+        f2temp = cconjmpysp_i(_amem8_f2(&x[i]), _amem8_f2(&y[i]));
+        ftemp  = radar_cplxMathBenchErr(_hif2(f2temp), refRe) + radar_cplxMathBenchErr(_lof2(f2temp), refIm);
+        err[1] = (ftemp > err[1]) ? ftemp : err[1];
+    }
+
+    accRe  = 0.0;
+    accIm  = 0.0;
+    f2temp = _ftof2(0.f, 0.f);
+    for (i = 0; i < n; i++)
+    {
+        accRe += (double)gCplxMathBenchX[2 * i + 1] * gCplxMathBenchY[2 * i + 1] - (double)gCplxMathBenchX[2 * i] * gCplxMathBenchY[2 * i];
+        accIm += (double)gCplxMathBenchX[2 * i + 1] * gCplxMathBenchY[2 * i] + (double)gCplxMathBenchX[2 * i] * gCplxMathBenchY[2 * i + 1];
+        f2temp = cmacsp_i(f2temp, _amem8_f2(&x[i]), _amem8_f2(&y[i]));
+    }
+    err[2] = radar_cplxMathBenchErr(_hif2(f2temp), accRe) + radar_cplxMathBenchErr(_lof2(f2temp), accIm);
+
+    accRe = 0.0;
+    accIm = 0.0;
+    for (i = 0; i < n; i++)
+    {
+        accRe += (double)gCplxMathBenchX[2 * i + 1] * gCplxMathBenchY[2 * i + 1] + (double)gCplxMathBenchX[2 * i] * gCplxMathBenchY[2 * i];
+        accIm += (double)gCplxMathBenchX[2 * i + 1] * gCplxMathBenchY[2 * i] - (double)gCplxMathBenchX[2 * i] * gCplxMathBenchY[2 * i + 1];
+    }
+    f2temp = cdotconjsp_i(x, y, n);
+    err[3] = radar_cplxMathBenchErr(_hif2(f2temp), accRe) + radar_cplxMathBenchErr(_lof2(f2temp), accIm);
+
+    /* a^H R a, and R a, with a steering vector */
+    for (i = 0; i < n; i++)
+    {
+        ftemp                      = (float)(0.7 * (double)i);
+        gCplxMathBenchX[2 * i]     = (float)sin((double)ftemp);
+        gCplxMathBenchX[2 * i + 1] = (float)cos((double)ftemp);
+    }
+    hermmatvecsp_i(Rn, x, w, n);
+    refRe = 0.0;
+    for (i = 0; i < n; i++)
+    {
+        accRe = 0.0;
+        accIm = 0.0;
+        for (j = 0; j < n; j++)
+        {
+            radar_cplxMathBenchRn(n, i, j, &rRe, &rIm);
+            xRe    = (double)gCplxMathBenchX[2 * j + 1];
+            xIm    = (double)gCplxMathBenchX[2 * j];
+            accRe += rRe * xRe - rIm * xIm;
+            accIm += rRe * xIm + rIm * xRe;
+        }
+        ftemp  = radar_cplxMathBenchErr(gCplxMathBenchW[2 * i + 1], accRe) + radar_cplxMathBenchErr(gCplxMathBenchW[2 * i], accIm);
+        err[5] = (ftemp > err[5]) ? ftemp : err[5];
+        refRe += (double)gCplxMathBenchX[2 * i + 1] * accRe + (double)gCplxMathBenchX[2 * i] * accIm;
+    }
+    err[4] = radar_cplxMathBenchErr(hermquadsp_i(Rn, x, n), refRe);
+
+    for (call = 1; call <= RADAR_CPLXMATH_BENCH_NUMCALLS; call++)
+    {
+        ftemp  = radar_cplxMathBenchErr(rcpsp_i((float)call), 1.0 / (double)call);
+        err[6] = (ftemp > err[6]) ? ftemp : err[6];
+        ftemp  = radar_cplxMathBenchErr(rsqrtsp_i((float)call), 1.0 / sqrt((double)call));
+        err[7] = (ftemp > err[7]) ? ftemp : err[7];
+    }
+
+    printf("radar_cplxMath benchmark, %s, n = %d, %s per call, max relative error\n", RADAR_CPLXMATH_BACKEND, n, RADAR_CPLXMATH_BENCH_UNIT);
+    for (i = 0; i < 8; i++)
+        printf("%-16s %8.1f %e\n", name[i], (float)cycles[i] / (float)RADAR_CPLXMATH_BENCH_NUMCALLS, err[i]);
+}
+
+#endif
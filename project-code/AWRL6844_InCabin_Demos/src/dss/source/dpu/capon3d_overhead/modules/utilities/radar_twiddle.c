@@ -1,7 +1,8 @@
 /*!
- *  \file   RADARDEMO_aoaEst2DCaponBF_utils.c
+ *  \file   radar_twiddle.c
  *
- *  \brief   Utility functions for FFT function.
+ *  \brief   Twiddle factor generation for the DSPLIB single precision FFT, shared by
+ *           the Capon beamforming modules.
  *
  * Copyright (C) 2017 Texas Instruments Incorporated - http://www.ti.com/
  *
@@ -33,16 +34,13 @@
  *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
  *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
  */
 #ifdef _TMS320C6X
 #include "c6x.h"
 #endif
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_twiddle.h>
 #include <source/dpu/capon3d_overhead/modules/utilities/radar_commonMath.h>
 
-#ifndef _GENTWIDDLE_FFTFLOAT
-#define _GENTWIDDLE_FFTFLOAT
-
 #ifdef _TMS320C6600 // C66x
 
 void tw_gen_float(float *w, int n)
@@ -108,5 +106,3 @@ void tw_gen_float(float *w, int n)
     }
 }
 #endif
-
-#endif //_GENTWIDDLE_FFTFLOAT
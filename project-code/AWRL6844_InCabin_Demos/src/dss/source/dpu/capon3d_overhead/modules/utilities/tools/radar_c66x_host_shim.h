@@ -0,0 +1,311 @@
+/**
+ *   @file  radar_c66x_host_shim.h
+ *
+ *   @brief
+ *      Host emulation of the C66x intrinsics used by the DoA modules.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Included first in every translation unit of a host check built with _TMS320C6X and _TMS320C6600, so that the module
+ * sources compile their C66x code paths. Each intrinsic is the C of the instruction on the C66x. _rcpsp(), _rsqrsp()
+ * and _rcpdp() keep 8 mantissa bits of the exact result, as the instructions estimate.
+ */
+
+#ifndef RADAR_C66X_HOST_SHIM_H
+#define RADAR_C66X_HOST_SHIM_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/* the target build gets cplxf_t from the SDK, source/common/cplx_types.h leaves it out in little endian */
+typedef struct _CPLXF
+{
+    float imag;
+    float real;
+} cplxf_t;
+
+typedef struct
+{
+    float lo;
+    float hi;
+} __float2_t;
+
+typedef struct
+{
+    __float2_t lo;
+    __float2_t hi;
+} __x128_t;
+
+static volatile uint32_t TSCL;
+
+#define _amem8_f2(p)        (*(__float2_t *)(p))
+#define _amem8_f2_const(p)  (*(const __float2_t *)(p))
+#define _mem8_f2(p)         (*(__float2_t *)(p))
+#define _amem8(p)           (*(int64_t *)(p))
+#define _amem4(p)           (*(int32_t *)(p))
+#define _hif2(x)            ((x).hi)
+#define _lof2(x)            ((x).lo)
+#define _hif2_128(x)        ((x).hi)
+#define _lof2_128(x)        ((x).lo)
+
+static inline __float2_t _ftof2(float hi, float lo)
+{
+    __float2_t r;
+
+    r.hi = hi;
+    r.lo = lo;
+    return r;
+}
+
+static inline int64_t _f2toll(__float2_t x)
+{
+    int64_t r;
+
+    memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+static inline __float2_t _lltof2(int64_t x)
+{
+    __float2_t r;
+
+    memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+static inline int32_t _hill(int64_t x)
+{
+    return (int32_t)((uint64_t)x >> 32);
+}
+
+static inline int32_t _loll(int64_t x)
+{
+    return (int32_t)(uint32_t)x;
+}
+
+static inline int64_t _itoll(int32_t hi, int32_t lo)
+{
+    return (int64_t)(((uint64_t)(uint32_t)hi << 32) | (uint32_t)lo);
+}
+
+static inline __float2_t _daddsp(__float2_t x, __float2_t y)
+{
+    return _ftof2(x.hi + y.hi, x.lo + y.lo);
+}
+
+static inline __float2_t _dsubsp(__float2_t x, __float2_t y)
+{
+    return _ftof2(x.hi - y.hi, x.lo - y.lo);
+}
+
+static inline __float2_t _dmpysp(__float2_t x, __float2_t y)
+{
+    return _ftof2(x.hi * y.hi, x.lo * y.lo);
+}
+
+/* CMPYSP: hi = (xr*yr, xr*yi), lo = (-xi*yi, xi*yr) */
+static inline __x128_t _cmpysp(__float2_t x, __float2_t y)
+{
+    __x128_t r;
+
+    r.hi = _ftof2(x.hi * y.hi, x.hi * y.lo);
+    r.lo = _ftof2(-(x.lo * y.lo), x.lo * y.hi);
+    return r;
+}
+
+static inline __float2_t _complex_mpysp(__float2_t x, __float2_t y)
+{
+    __x128_t r = _cmpysp(x, y);
+
+    return _daddsp(r.hi, r.lo);
+}
+
+static inline __float2_t _complex_conjugate_mpysp(__float2_t x, __float2_t y)
+{
+    __x128_t r = _cmpysp(x, y);
+
+    return _dsubsp(r.hi, r.lo);
+}
+
+static inline float _shim_mant8(float x)
+{
+    uint32_t u;
+
+    memcpy(&u, &x, sizeof(u));
+    u &= 0xFFFF8000U;
+    memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+static inline float _rcpsp(float x)
+{
+    return _shim_mant8(1.0f / x);
+}
+
+static inline float _rsqrsp(float x)
+{
+    return _shim_mant8(1.0f / sqrtf(x));
+}
+
+static inline double _rcpdp(double x)
+{
+    uint64_t u;
+    double   r = 1.0 / x;
+
+    memcpy(&u, &r, sizeof(u));
+    u &= 0xFFFFF00000000000ULL;
+    memcpy(&r, &u, sizeof(r));
+    return r;
+}
+
+static inline double _fabs(double x)
+{
+    return fabs(x);
+}
+
+static inline float _fabsf(float x)
+{
+    return fabsf(x);
+}
+
+static inline float _itof(uint32_t x)
+{
+    float f;
+
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+static inline int32_t _dpint(double x)
+{
+    return (int32_t)rint(x);
+}
+
+static inline int32_t _spint(float x)
+{
+    float r = rintf(x);
+
+    if (r >= 2147483647.0f)
+        return 0x7FFFFFFF;
+    if (r <= -2147483648.0f)
+        return (int32_t)0x80000000;
+    return (int32_t)r;
+}
+
+static inline int32_t _shim_sat16(int32_t x)
+{
+    return (x > 32767) ? 32767 : ((x < -32768) ? -32768 : x);
+}
+
+static inline int32_t _pack2(int32_t hi, int32_t lo)
+{
+    return (int32_t)(((uint32_t)hi << 16) | ((uint32_t)lo & 0xFFFFU));
+}
+
+static inline int32_t _packhl2(int32_t x, int32_t y)
+{
+    return (int32_t)(((uint32_t)x & 0xFFFF0000U) | ((uint32_t)y & 0xFFFFU));
+}
+
+static inline int32_t _ext(int32_t x, uint32_t left, uint32_t right)
+{
+    return (int32_t)((uint32_t)x << left) >> right;
+}
+
+static inline int32_t _sadd2(int32_t x, int32_t y)
+{
+    return _pack2(_shim_sat16((x >> 16) + (y >> 16)), _shim_sat16((int16_t)x + (int16_t)y));
+}
+
+static inline int32_t _ssub2(int32_t x, int32_t y)
+{
+    return _pack2(_shim_sat16((x >> 16) - (y >> 16)), _shim_sat16((int16_t)x - (int16_t)y));
+}
+
+static inline int64_t _dsadd2(int64_t x, int64_t y)
+{
+    return _itoll(_sadd2(_hill(x), _hill(y)), _sadd2(_loll(x), _loll(y)));
+}
+
+static inline int64_t _dssub2(int64_t x, int64_t y)
+{
+    return _itoll(_ssub2(_hill(x), _hill(y)), _ssub2(_loll(x), _loll(y)));
+}
+
+static inline int64_t _dadd(int64_t x, int64_t y)
+{
+    return _itoll(_hill(x) + _hill(y), _loll(x) + _loll(y));
+}
+
+/* CMPY: hi = xr*yr - xi*yi, lo = xr*yi + xi*yr, 16 bit halves, real part in the upper half */
+static inline int64_t _cmpy(int32_t x, int32_t y)
+{
+    int32_t xr = x >> 16, xi = (int16_t)x, yr = y >> 16, yi = (int16_t)y;
+
+    return _itoll(xr * yr - xi * yi, xr * yi + xi * yr);
+}
+
+static inline int32_t _norm(int32_t x)
+{
+    int32_t n = 0;
+    uint32_t u = (uint32_t)((x < 0) ? ~x : x);
+
+    while ((n < 31) && !(u & (0x40000000U >> n)))
+        n++;
+    return n;
+}
+
+static inline __float2_t _dinthsp(int32_t x)
+{
+    return _ftof2((float)(x >> 16), (float)(int16_t)x);
+}
+
+static inline __float2_t _dintsp(int64_t x)
+{
+    return _ftof2((float)_hill(x), (float)_loll(x));
+}
+
+static inline int32_t _dspinth(__float2_t x)
+{
+    return _pack2(_shim_sat16(_spint(x.hi)), _shim_sat16(_spint(x.lo)));
+}
+
+static inline int64_t _dspint(__float2_t x)
+{
+    return _itoll(_spint(x.hi), _spint(x.lo));
+}
+
+#endif
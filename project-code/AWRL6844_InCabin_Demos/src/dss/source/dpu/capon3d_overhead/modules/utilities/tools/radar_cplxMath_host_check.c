@@ -0,0 +1,204 @@
+/**
+ *   @file  radar_cplxMath_host_check.c
+ *
+ *   @brief
+ *      Host check of the radar_cplxMath.h functions.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: radar_cplxMath_host_check [numTrials]
+ *
+ *  Runs every function of radar_cplxMath.h on numTrials (default 20000) random vectors of 1 to CHECK_MAX_N complex
+ *  values, random packed Hermitian matrices with a real diagonal and unit modulus vectors, and compares the results
+ *  against double precision. The error of a sum is relative to the sum of the magnitudes of its terms, which bounds the
+ *  rounding of any summation order. The implementation checked is the one radar_cplxMath.h selects for the build
+ *  flags, the script of the same name builds one binary per implementation. Built with RADAR_CPLXMATH_BENCHMARK, the
+ *  check then runs radar_cplxMathBenchmark() for vector lengths 4, 8 and 16.
+ *
+ *  The exit status is 0 if all errors are below CHECK_REL_TOL.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <complex.h>
+
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_cplxMath.h>
+
+#define CHECK_REL_TOL           (1.0e-6)
+#define CHECK_MAX_N             (16)
+#define CHECK_NUM_FUNC          (10)
+
+static const char *gCheckName[CHECK_NUM_FUNC] = {"cmpysp_i", "cconjmpysp_i", "cmacsp_i", "cconjmacsp_i", "cmagsqsp_i", "cdotconjsp_i", "hermquadsp_i", "hermmatvecsp_i", "rcpsp_i", "rsqrtsp_i"};
+
+/* 8 byte aligned, the __float2_t image of a cplxf_t */
+static __float2_t gCheckX[CHECK_MAX_N];
+static __float2_t gCheckY[CHECK_MAX_N];
+static __float2_t gCheckA[CHECK_MAX_N];
+static __float2_t gCheckW[CHECK_MAX_N];
+static __float2_t gCheckRn[CHECK_MAX_N * (CHECK_MAX_N + 1) / 2];
+
+static double Check_urand(void)
+{
+    return rand() / (double)RAND_MAX;
+}
+
+static double complex Check_cplx(__float2_t x)
+{
+    return (double)_hif2(x) + I * (double)_lof2(x);
+}
+
+static __float2_t Check_rand(void)
+{
+    return _ftof2((float)(2.0 * Check_urand() - 1.0), (float)(2.0 * Check_urand() - 1.0));
+}
+
+static double Check_err(double complex val, double complex ref, double scale)
+{
+    return cabs(val - ref) / ((scale > 1e-30) ? scale : 1.0);
+}
+
+/* R(i,j) of the packed upper triangle */
+static double complex Check_rn(int32_t n, int32_t i, int32_t j)
+{
+    int32_t row = (i < j) ? i : j;
+    int32_t col = (i < j) ? j : i;
+    double complex r = Check_cplx(gCheckRn[row * n - (row * (row - 1)) / 2 + (col - row)]);
+
+    return (i <= j) ? r : conj(r);
+}
+
+int main(int argc, char *argv[])
+{
+    int32_t        numTrials = (argc > 1) ? atoi(argv[1]) : 20000;
+    int32_t        trial, n, i, j;
+    double         maxErr[CHECK_NUM_FUNC] = {0.0};
+    double         err, scale, xf;
+    double complex ref, x, y, acc;
+    long           numFailed = 0;
+
+    srand(1);
+    for (trial = 0; trial < numTrials; trial++)
+    {
+        n = 1 + rand() % CHECK_MAX_N;
+        for (i = 0; i < n; i++)
+        {
+            gCheckX[i] = Check_rand();
+            gCheckY[i] = Check_rand();
+            xf         = 2.0 * M_PI * Check_urand();
+            gCheckA[i] = _ftof2((float)cos(xf), (float)sin(xf));
+        }
+        for (i = 0; i < n * (n + 1) / 2; i++)
+            gCheckRn[i] = Check_rand();
+        for (i = 0, j = 0; i < n; j += n - i, i++)
+            gCheckRn[j] = _ftof2((float)(n * Check_urand()), 0.f);
+
+        /* element wise, on the first entries */
+        x = Check_cplx(gCheckX[0]);
+        y = Check_cplx(gCheckY[0]);
+        ref = x * y;
+        err = Check_err(Check_cplx(cmpysp_i(gCheckX[0], gCheckY[0])), ref, cabs(x) * cabs(y));
+        maxErr[0] = fmax(maxErr[0], err);
+        ref = conj(x) * y;
+        err = Check_err(Check_cplx(cconjmpysp_i(gCheckX[0], gCheckY[0])), ref, cabs(x) * cabs(y));
+        maxErr[1] = fmax(maxErr[1], err);
+        ref = Check_cplx(gCheckA[0]) + x * y;
+        err = Check_err(Check_cplx(cmacsp_i(gCheckA[0], gCheckX[0], gCheckY[0])), ref, 1.0 + cabs(x) * cabs(y));
+        maxErr[2] = fmax(maxErr[2], err);
+        ref = Check_cplx(gCheckA[0]) + conj(x) * y;
+        err = Check_err(Check_cplx(cconjmacsp_i(gCheckA[0], gCheckX[0], gCheckY[0])), ref, 1.0 + cabs(x) * cabs(y));
+        maxErr[3] = fmax(maxErr[3], err);
+        ref = cabs(x) * cabs(x);
+        err = Check_err(cmagsqsp_i(gCheckX[0]), ref, creal(ref));
+        maxErr[4] = fmax(maxErr[4], err);
+
+        /* conjugate dot product */
+        ref   = 0.0;
+        scale = 0.0;
+        for (i = 0; i < n; i++)
+        {
+            ref   += conj(Check_cplx(gCheckX[i])) * Check_cplx(gCheckY[i]);
+            scale += cabs(Check_cplx(gCheckX[i])) * cabs(Check_cplx(gCheckY[i]));
+        }
+        err = Check_err(Check_cplx(cdotconjsp_i(gCheckX, gCheckY, n)), ref, scale);
+        maxErr[5] = fmax(maxErr[5], err);
+
+        /* a^H R a and R a */
+        hermmatvecsp_i(gCheckRn, gCheckA, gCheckW, n);
+        ref   = 0.0;
+        scale = 0.0;
+        for (i = 0; i < n; i++)
+        {
+            acc = 0.0;
+            xf  = 0.0;
+            for (j = 0; j < n; j++)
+            {
+                acc += Check_rn(n, i, j) * Check_cplx(gCheckA[j]);
+                xf  += cabs(Check_rn(n, i, j));
+            }
+            err = Check_err(Check_cplx(gCheckW[i]), acc, xf);
+            maxErr[7] = fmax(maxErr[7], err);
+            ref   += conj(Check_cplx(gCheckA[i])) * acc;
+            scale += xf;
+        }
+        err = Check_err(hermquadsp_i(gCheckRn, gCheckA, n), creal(ref), scale);
+        maxErr[6] = fmax(maxErr[6], err);
+
+        /* reciprocals over 2^-20 .. 2^20 */
+        xf  = ldexp(1.0 + Check_urand(), -20 + rand() % 41);
+        err = Check_err(rcpsp_i((float)xf), 1.0 / (double)(float)xf, 1.0 / (double)(float)xf);
+        maxErr[8] = fmax(maxErr[8], err);
+        err = Check_err(rsqrtsp_i((float)xf), 1.0 / sqrt((double)(float)xf), 1.0 / sqrt((double)(float)xf));
+        maxErr[9] = fmax(maxErr[9], err);
+    }
+
+    printf("radar_cplxMath.h, %s, %d trials of 1 to %d complex values\n", RADAR_CPLXMATH_BACKEND, numTrials, CHECK_MAX_N);
+    for (i = 0; i < CHECK_NUM_FUNC; i++)
+    {
+        if (!(maxErr[i] < CHECK_REL_TOL))
+            numFailed++;
+        printf("%-16s max relative error %.3g\n", gCheckName[i], maxErr[i]);
+    }
+
+#ifdef RADAR_CPLXMATH_BENCHMARK
+    radar_cplxMathBenchmark(4);
+    radar_cplxMathBenchmark(8);
+    radar_cplxMathBenchmark(16);
+#endif
+
+    printf("%s: %ld failed checks\n", (numFailed == 0) ? "PASS" : "FAIL", numFailed);
+    return (numFailed == 0) ? 0 : 1;
+}
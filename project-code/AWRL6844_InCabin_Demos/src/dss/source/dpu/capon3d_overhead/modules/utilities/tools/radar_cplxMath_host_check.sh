@@ -0,0 +1,87 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of radar_cplxMath.h on the host, once per implementation
+#
+#   radar_cplxMath_host_check.sh [numTrials]
+#
+# Implementations:
+#   c6x     the C66x intrinsic code, intrinsics emulated by radar_c66x_host_shim.h
+#   scalar  RADAR_CPLXMATH_SCALAR
+#   sse2    default x86-64 flags
+#   avx     -mavx, if the CPU has AVX
+#   neon    if the compiler targets NEON
+# The host implementations are built with RADAR_CPLXMATH_BENCHMARK and also print radar_cplxMathBenchmark(), time in
+# ns per call.
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./radar_cplxMath_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+UTIL_DIR="$TOOLS_DIR/.."
+DSS_DIR="$TOOLS_DIR/../../../../../.."
+BUILD_DIR=${BUILD_DIR:-./radar_cplxMath_host_check_build}
+CC=${CC:-cc}
+CFLAGS="-O2 -Wall -Wno-unknown-pragmas -std=gnu99 -D_LITTLE_ENDIAN -I $DSS_DIR -include $TOOLS_DIR/radar_c66x_host_shim.h"
+BENCH="-DRADAR_CPLXMATH_BENCHMARK -DRADAR_CPLXMATH_BENCH_NUMCALLS=4096 $UTIL_DIR/radar_cplxMath_bench.c"
+
+mkdir -p "$BUILD_DIR"
+status=0
+
+run()
+{
+    name=$1
+    shift
+    # shellcheck disable=SC2086
+    $CC $CFLAGS "$@" -o "$BUILD_DIR/radar_cplxMath_host_check_$name" "$TOOLS_DIR/radar_cplxMath_host_check.c" -lm
+    "$BUILD_DIR/radar_cplxMath_host_check_$name" $ARGS || status=1
+}
+
+ARGS="$*"
+run c6x -D_TMS320C6X -D_TMS320C6600
+# shellcheck disable=SC2086
+run scalar -DRADAR_CPLXMATH_SCALAR $BENCH
+if $CC -dM -E - < /dev/null | grep -q __SSE2__; then
+    # shellcheck disable=SC2086
+    run sse2 $BENCH
+    if grep -q avx /proc/cpuinfo 2> /dev/null; then
+        # shellcheck disable=SC2086
+        run avx -mavx $BENCH
+    else
+        echo "avx: not run, the CPU has no AVX"
+    fi
+elif $CC -dM -E - < /dev/null | grep -q __ARM_NEON; then
+    # shellcheck disable=SC2086
+    run neon $BENCH
+fi
+exit $status
@@ -0,0 +1,504 @@
+/**
+ *   @file  radar_cplxMath_port_host_check.c
+ *
+ *   @brief
+ *      Host equivalence check of the BF, CaponBF and DML modules before and after the port to radar_cplxMath.h.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ */
+
+/**
+ *  Usage: radar_cplxMath_port_host_check run outFile [numTrials]
+ *         radar_cplxMath_port_host_check cmp refFile outFile
+ *
+ *  Driver of the equivalence check of the BF, CaponBF and DML modules before and after their port to
+ *  radar_cplxMath.h. The script of the same name builds the driver twice, against the sources of the revision before
+ *  the port and against the current tree, both with the C66x code and radar_c66x_host_shim.h.
+ *
+ *  "run" creates the modules for a set of configurations and runs them on numTrials (default 200) seeded random
+ *  inputs per configuration, one or two plane waves in noise. Every output is written to outFile as a (kind, value)
+ *  record: angles, variances, heatmaps, the Doppler spectrum, the static information and the Doppler FFT twiddle
+ *  factors are continuous, the number of outputs and the peak indices are discrete.
+ *
+ *  "cmp" compares two such files. Continuous values must agree within CHECK_REL_TOL of the largest magnitude of their
+ *  record group, discrete values must be equal. The exit status is 0 if they do.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <modules/DoA/BF/api/RADARDEMO_aoaEstBF.h>
+#include <modules/DoA/DML/api/RADARDEMO_aoaEstDML.h>
+#include <modules/DoA/CaponBF/api/RADARDEMO_aoaEstCaponBF.h>
+#include <modules/DoA/CaponBF/src/RADARDEMO_aoaEstCaponBF_priv.h>
+
+#define CHECK_REL_TOL           (1.0e-4)
+#define CHECK_PI                (3.14159265358979323846)
+
+#define CHECK_KIND_CONT         (0)
+#define CHECK_KIND_DISC         (1)
+#define CHECK_KIND_GROUP        (2)
+
+typedef struct
+{
+    int32_t kind;
+    float   value;
+} Check_record;
+
+static FILE    *gCheckOut;
+static uint32_t gCheckSeed;
+
+/* Same generator on every host, the two builds must see the same inputs */
+static double Check_urand(void)
+{
+    gCheckSeed = gCheckSeed * 1664525u + 1013904223u;
+    return (gCheckSeed >> 8) * (1.0 / 16777216.0);
+}
+
+static double Check_nrand(void)
+{
+    double u1 = Check_urand() + 1.0e-12, u2 = Check_urand();
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * CHECK_PI * u2);
+}
+
+static void Check_put(int32_t kind, float value)
+{
+    Check_record r;
+
+    r.kind  = kind;
+    r.value = value;
+    fwrite(&r, sizeof(r), 1, gCheckOut);
+}
+
+static void Check_putArray(const float *x, int32_t n)
+{
+    int32_t i;
+
+    Check_put(CHECK_KIND_GROUP, (float)n);
+    for (i = 0; i < n; i++)
+        Check_put(CHECK_KIND_CONT, x[i]);
+}
+
+/* Host stand-ins of the OSAL heap and the DSPLIB FFT, identical in both builds */
+void *radarOsal_memAlloc(uint8_t memoryType, uint8_t scratchFlag, uint32_t size, uint16_t alignment)
+{
+    void *ptr = NULL;
+
+    (void)memoryType;
+    (void)scratchFlag;
+    if (posix_memalign(&ptr, 8, size + 8) != 0)
+        return (NULL);
+    memset(ptr, 0, size + 8);
+    return (ptr);
+}
+
+void radarOsal_memFree(void *ptr, uint32_t size)
+{
+    (void)size;
+    free(ptr);
+}
+
+void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max)
+{
+    int    k, n;
+    double re, im;
+
+    (void)ptr_w;
+    (void)brev;
+    (void)n_min;
+    (void)offset;
+    (void)n_max;
+    for (k = 0; k < N; k++)
+    {
+        re = 0.0;
+        im = 0.0;
+        for (n = 0; n < N; n++)
+        {
+            double c = cos(2.0 * CHECK_PI * k * n / N), s = sin(2.0 * CHECK_PI * k * n / N);
+
+            re += ptr_x[2 * n] * c + ptr_x[2 * n + 1] * s;
+            im += ptr_x[2 * n + 1] * c - ptr_x[2 * n] * s;
+        }
+        ptr_y[2 * k]     = (float)re;
+        ptr_y[2 * k + 1] = (float)im;
+    }
+}
+
+/* The checked configurations run the peak search for the Doppler, the CFAR is never created */
+void *RADARDEMO_detectionCFAR_create(RADARDEMO_detectionCFAR_config *moduleConfig, RADARDEMO_detectionCFAR_errorCode *errorCode)
+{
+    (void)moduleConfig;
+    *errorCode = RADARDEMO_DETECTIONCFAR_NO_ERROR;
+    return (NULL);
+}
+
+RADARDEMO_detectionCFAR_errorCode RADARDEMO_detectionCFAR_run(void *handle, RADARDEMO_detectionCFAR_input *detectionCFARInput, RADARDEMO_detectionCFAR_output *estOutput)
+{
+    (void)handle;
+    (void)detectionCFARInput;
+    estOutput->numObjDetected = 0;
+    return (RADARDEMO_DETECTIONCFAR_NO_ERROR);
+}
+
+/* One or two plane waves at a column step of pi*sin(azim)*cos(elev) and a row step of pi*sin(elev), in unit noise */
+static void Check_genAntSamples(cplxf_t *x, const uint8_t *col, const uint8_t *row, int32_t nRxAnt, float amp)
+{
+    int32_t i, s, numSrc = 1 + (Check_urand() < 0.3);
+    double  azim[2], elev, ph, a[2];
+
+    for (s = 0; s < numSrc; s++)
+    {
+        azim[s] = (Check_urand() - 0.5) * 100.0 * CHECK_PI / 180.0;
+        a[s]    = amp * (s == 0 ? 1.0 : 0.2 + 0.8 * Check_urand());
+    }
+    elev = (row == NULL) ? 0.0 : (Check_urand() - 0.5) * 40.0 * CHECK_PI / 180.0;
+    for (i = 0; i < nRxAnt; i++)
+    {
+        double re = Check_nrand() * 0.7071, im = Check_nrand() * 0.7071;
+
+        for (s = 0; s < numSrc; s++)
+        {
+            ph = CHECK_PI * (col[i] * sin(azim[s]) * cos(elev) + (row == NULL ? 0 : row[i]) * sin(elev));
+            re += a[s] * cos(ph);
+            im += a[s] * sin(ph);
+        }
+        x[i].real = (float)re;
+        x[i].imag = (float)im;
+    }
+}
+
+static void Check_putAoaOutput(const RADARDEMO_aoAEst_output *out)
+{
+    uint32_t i;
+
+    Check_put(CHECK_KIND_DISC, (float)out->numOutput);
+    for (i = 0; i < out->numOutput && i < RADARDEMO_AOAESTBF_MAX_NUM_DETANGLE; i++)
+    {
+        Check_put(CHECK_KIND_GROUP, 1.f);
+        Check_put(CHECK_KIND_CONT, out->outputAngles[i]);
+        Check_put(CHECK_KIND_GROUP, 1.f);
+        Check_put(CHECK_KIND_CONT, out->outputVar[i]);
+    }
+}
+
+static int32_t Check_runBF(int32_t nRxAnt, uint8_t multiPeak, int32_t numTrials)
+{
+    RADARDEMO_aoAEstBF_config    cfg;
+    RADARDEMO_aoAEstBF_errorCode err;
+    RADARDEMO_aoAEst_input       in;
+    RADARDEMO_aoAEst_output      out;
+    uint8_t                      col[8];
+    cplxf_t                      x[8] __attribute__((aligned(8)));
+    void                        *h;
+    int32_t                      i, t;
+
+    for (i = 0; i < nRxAnt; i++)
+        col[i] = (uint8_t)i;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.enableMultiPeakSearch = multiPeak;
+    cfg.antSpacing            = col;
+    cfg.nRxAnt                = (uint32_t)nRxAnt;
+    cfg.estResolution         = 1.f;
+    cfg.estRange              = 70.f;
+    cfg.maxOutputVar          = 20.f;
+    cfg.sidelobeLevel_dB      = 1.f;
+    cfg.angleEstBound         = 60.f;
+    h                         = RADARDEMO_aoaEstimationBF_create(&cfg, &err);
+    if (h == NULL)
+        return (-1);
+    for (t = 0; t < numTrials; t++)
+    {
+        Check_genAntSamples(x, col, NULL, nRxAnt, 10.f);
+        in.inputAntSamples = x;
+        in.inputNoisePow   = (float)nRxAnt;
+        memset(&out, 0, sizeof(out));
+        RADARDEMO_aoaEstimationBF_run(h, &in, &out);
+        Check_putAoaOutput(&out);
+    }
+    RADARDEMO_aoaEstimationBF_delete(h);
+    return (0);
+}
+
+static int32_t Check_runDML(int32_t twoD, uint8_t multiStage, int32_t numTrials)
+{
+    /* 2D: the 3 x 4 virtual array of the in-cabin antenna, linear: a 4 element ULA */
+    static const uint8_t          col2D[12] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+    static const uint8_t          row2D[12] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2};
+    static const uint8_t          colLin[4] = {0, 1, 2, 3};
+    RADARDEMO_aoAEstDML_config    cfg;
+    RADARDEMO_aoAEstDML_errorCode err;
+    RADARDEMO_aoAEst_input        in;
+    RADARDEMO_aoAEst_output       out;
+    cplxf_t                       x[12] __attribute__((aligned(8)));
+    void                         *h;
+    int32_t                       t, nRxAnt = twoD ? 12 : 4;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.antSpacing             = (uint8_t *)(twoD ? col2D : colLin);
+    cfg.antRow                 = twoD ? (uint8_t *)row2D : NULL;
+    cfg.nRxAnt                 = (uint32_t)nRxAnt;
+    cfg.estResolution          = 1.f;
+    cfg.estRange               = 70.f;
+    cfg.elevAngle              = 0.f;
+    cfg.enableMultiStageSearch = multiStage;
+    cfg.minimumOutputConf      = 20.f;
+    cfg.angleEstBound          = 60.f;
+    h                          = RADARDEMO_aoaEstimationDML_create(&cfg, &err);
+    if (h == NULL)
+        return (-1);
+    for (t = 0; t < numTrials; t++)
+    {
+        Check_genAntSamples(x, cfg.antSpacing, cfg.antRow, nRxAnt, 10.f);
+        in.inputAntSamples = x;
+        in.inputNoisePow   = (float)nRxAnt;
+        memset(&out, 0, sizeof(out));
+        RADARDEMO_aoaEstimationDML_run(h, &in, &out);
+        Check_putAoaOutput(&out);
+    }
+    RADARDEMO_aoaEstimationDML_delete(h);
+    return (0);
+}
+
+static int32_t Check_runCaponBF(int32_t nRxAnt, uint8_t clutterRemoval, uint8_t fallBack, int32_t numTrials)
+{
+    enum { NUM_RANGE = 4, NUM_CHIRPS = 32, FFT_SIZE = 32 };
+    RADARDEMO_aoaEstCaponBF_config    cfg;
+    RADARDEMO_aoaEstCaponBF_errorCode err;
+    RADARDEMO_aoAEstCaponBF_input     in;
+    RADARDEMO_aoAEstCaponBF_output    out;
+    RADARDEMO_aoaEstCaponBF_handle   *inst;
+    uint8_t                           col[8];
+    uint16_t                          dopplerIdx[4];
+    cplx16_t                          samples[8 * NUM_CHIRPS] __attribute__((aligned(8)));
+    cplxf_t                           x[8] __attribute__((aligned(8)));
+    cplxf_t                           staticInfo[NUM_RANGE * 8] __attribute__((aligned(8)));
+    float                             heatmap[256] __attribute__((aligned(8)));
+    float                             scratch[1024] __attribute__((aligned(8)));
+    float                             peakVal[NUM_RANGE];
+    float                             max;
+    void                             *h;
+    int32_t                           i, c, t, peak;
+
+    for (i = 0; i < nRxAnt; i++)
+        col[i] = (uint8_t)i;
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.antSpacing         = col;
+    cfg.nRxAnt             = (uint32_t)nRxAnt;
+    cfg.dopplerFFTSize     = FFT_SIZE;
+    cfg.numInputRangeBins  = NUM_RANGE;
+    cfg.estAngleResolution = 1.f;
+    cfg.estAngleRange      = 60.f;
+    cfg.maxOutputVar       = 20.f;
+    cfg.gamma              = 0.03f;
+    h                      = RADARDEMO_aoaEstCaponBF_create(&cfg, &err);
+    if (h == NULL)
+        return (-1);
+    inst = (RADARDEMO_aoaEstCaponBF_handle *)h;
+    /* The FFT stand-in does not read the twiddle factors, compare them directly */
+    Check_putArray(inst->twiddle, 2 * FFT_SIZE);
+    for (t = 0; t < numTrials; t++)
+    {
+        /* Samples in (chirp, antenna) order, a per chirp Doppler rotation of every source */
+        double dop = (Check_urand() - 0.5) * 2.0 * CHECK_PI;
+
+        for (c = 0; c < NUM_CHIRPS; c++)
+        {
+            Check_genAntSamples(x, col, NULL, nRxAnt, 0.f);
+            for (i = 0; i < nRxAnt; i++)
+            {
+                double ph = dop * c + CHECK_PI * i * sin(0.3 * (t % 7 - 3));
+
+                samples[c * nRxAnt + i].real = (int16_t)lrint(200.0 * (x[i].real + 8.0 * cos(ph)) + 30.0);
+                samples[c * nRxAnt + i].imag = (int16_t)lrint(200.0 * (x[i].imag + 8.0 * sin(ph)) - 20.0);
+            }
+        }
+        memset(&out, 0, sizeof(out));
+        out.rangeAzimuthHeatMap = heatmap;
+        out.dopplerIdx          = dopplerIdx;
+        out.static_information  = staticInfo;
+        in.rangeIndx              = (uint32_t)(t % NUM_RANGE);
+        in.azimuthIndx            = 0;
+        in.fallBackToConvBFFlag   = fallBack;
+        in.processingStepSelector = 0;
+        in.clutterRemovalFlag     = clutterRemoval;
+        in.nChirps                = NUM_CHIRPS;
+        in.bwDemon                = 1.f;
+        in.inputAntSamples        = samples;
+        RADARDEMO_aoaEstCaponBF_run(h, &in, &out);
+        Check_putArray(heatmap, (int32_t)inst->steeringVecSize);
+        Check_putArray((float *)&staticInfo[in.rangeIndx * nRxAnt], 2 * nRxAnt);
+
+        max  = 0.f;
+        peak = 0;
+        for (i = 0; i < (int32_t)inst->steeringVecSize; i++)
+        {
+            if (heatmap[i] > max)
+            {
+                max  = heatmap[i];
+                peak = i;
+            }
+        }
+        Check_put(CHECK_KIND_DISC, (float)peak);
+
+        in.azimuthIndx            = (uint32_t)peak;
+        in.processingStepSelector = 1;
+        in.bwDemon                = max;
+        RADARDEMO_aoaEstCaponBF_run(h, &in, &out);
+        Check_putArray((float *)inst->scratchPad, FFT_SIZE);
+        Check_put(CHECK_KIND_DISC, (float)out.dopplerIdx[0]);
+
+        RADARDEMO_aoaEstCaponBF_static_run(h, &in, &out, scratch, peakVal);
+        Check_putArray(&peakVal[in.rangeIndx], 1);
+    }
+    return (0);
+}
+
+static int32_t Check_run(const char *outFile, int32_t numTrials)
+{
+    int32_t status = 0;
+
+    gCheckOut = fopen(outFile, "wb");
+    if (gCheckOut == NULL)
+        return (-1);
+    gCheckSeed = 1;
+    status |= Check_runBF(4, 0, numTrials);
+    status |= Check_runBF(8, 0, numTrials);
+    status |= Check_runBF(4, 1, numTrials);
+    status |= Check_runBF(8, 1, numTrials);
+    status |= Check_runDML(0, 0, numTrials);
+    status |= Check_runDML(0, 1, numTrials);
+    status |= Check_runDML(1, 0, numTrials);
+    status |= Check_runCaponBF(4, 0, 0, numTrials);
+    status |= Check_runCaponBF(8, 0, 0, numTrials);
+    status |= Check_runCaponBF(8, 1, 0, numTrials);
+    status |= Check_runCaponBF(8, 0, 1, numTrials);
+    fclose(gCheckOut);
+    return (status);
+}
+
+static Check_record *Check_load(const char *file, long *num)
+{
+    FILE         *f = fopen(file, "rb");
+    Check_record *r;
+    long          size;
+
+    if (f == NULL)
+        return (NULL);
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    r    = (Check_record *)malloc(size + 1);
+    *num = (long)fread(r, sizeof(Check_record), size / sizeof(Check_record), f);
+    fclose(f);
+    return (r);
+}
+
+static int32_t Check_cmp(const char *refFile, const char *outFile)
+{
+    Check_record *a, *b;
+    long          na, nb, i, j, n, numCont = 0, numDisc = 0, numBitExact = 0, numDiscDiffer = 0, numFail = 0;
+    double        scale, err, maxErr = 0.0;
+
+    a = Check_load(refFile, &na);
+    b = Check_load(outFile, &nb);
+    if ((a == NULL) || (b == NULL))
+        return (-1);
+    if (na != nb)
+    {
+        printf("record count differs: %ld vs %ld\n", na, nb);
+        return (-1);
+    }
+    scale = 0.0;
+    for (i = 0; i < na; i++)
+    {
+        if (a[i].kind != b[i].kind)
+        {
+            printf("record %ld: kind differs\n", i);
+            return (-1);
+        }
+        if (a[i].kind == CHECK_KIND_GROUP)
+        {
+            /* Error scale of the group, the largest magnitude of either run */
+            n     = (long)a[i].value;
+            scale = 0.0;
+            for (j = i + 1; j <= i + n && j < na; j++)
+            {
+                scale = fmax(scale, fabs(a[j].value));
+                scale = fmax(scale, fabs(b[j].value));
+            }
+            scale = fmax(scale, 1.0e-30);
+        }
+        else if (a[i].kind == CHECK_KIND_CONT)
+        {
+            numCont++;
+            numBitExact += (memcmp(&a[i].value, &b[i].value, sizeof(float)) == 0);
+            err    = fabs((double)a[i].value - b[i].value) / scale;
+            maxErr = fmax(maxErr, err);
+            if (!(err <= CHECK_REL_TOL))
+            {
+                if (numFail < 10)
+                    printf("record %ld: %.9g vs %.9g\n", i, a[i].value, b[i].value);
+                numFail++;
+            }
+        }
+        else
+        {
+            numDisc++;
+            if (a[i].value != b[i].value)
+            {
+                if (numFail < 10)
+                    printf("record %ld: index %d vs %d\n", i, (int)a[i].value, (int)b[i].value);
+                numDiscDiffer++;
+                numFail++;
+            }
+        }
+    }
+    printf("%ld continuous values, %ld bit-exact, max relative error %.3g; %ld discrete values, %ld differ\n",
+           numCont, numBitExact, maxErr, numDisc, numDiscDiffer);
+    printf("%s: %ld failed checks\n", numFail ? "FAIL" : "PASS", numFail);
+    free(a);
+    free(b);
+    return (numFail ? 1 : 0);
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc >= 3) && (strcmp(argv[1], "run") == 0))
+        return (Check_run(argv[2], (argc > 3) ? atoi(argv[3]) : 200) ? 1 : 0);
+    if ((argc == 4) && (strcmp(argv[1], "cmp") == 0))
+        return (Check_cmp(argv[2], argv[3]));
+    printf("usage: %s run outFile [numTrials] | cmp refFile outFile\n", argv[0]);
+    return (2);
+}
@@ -0,0 +1,87 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the equivalence check of the BF, CaponBF and DML modules before and after their port to
+# radar_cplxMath.h
+#
+#   radar_cplxMath_port_host_check.sh [oldRevision] [numTrials]
+#
+# oldRevision defaults to the parent of the commit that made RADARDEMO_aoaEstBF_priv.h include radar_cplxMath.h, or
+# HEAD while that change is not committed. Its sources are extracted with git archive. Both builds use the C66x code
+# with the intrinsics emulated by radar_c66x_host_shim.h and without FMA contraction, the DSPLIB FFT is replaced by a
+# DFT in the driver. See radar_cplxMath_port_host_check.c for what is compared.
+#
+# Needs git and a host C compiler (CC, default cc). BUILD_DIR defaults to ./radar_cplxMath_port_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+DSS_DIR=$(cd "$TOOLS_DIR/../../../../../.." && pwd)
+MOD_PATH=source/dpu/capon3d_overhead/modules
+BUILD_DIR=${BUILD_DIR:-./radar_cplxMath_port_host_check_build}
+CC=${CC:-cc}
+CFLAGS="-O2 -Wall -Wno-unknown-pragmas -Wno-maybe-uninitialized -Wno-unused-variable -Wno-unused-but-set-variable -std=gnu99 -ffp-contract=off -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 -include $TOOLS_DIR/radar_c66x_host_shim.h"
+
+OLD_REV=$1
+NUM_TRIALS=${2:-200}
+if [ -z "$OLD_REV" ]; then
+    PORT_REV=$(git -C "$DSS_DIR" log -n 1 --format=%H -S radar_cplxMath.h -- "$MOD_PATH/DoA/BF/src/RADARDEMO_aoaEstBF_priv.h")
+    OLD_REV=${PORT_REV:+$PORT_REV^}
+    OLD_REV=${OLD_REV:-HEAD}
+fi
+echo "reference: $OLD_REV"
+
+rm -rf "$BUILD_DIR/old"
+mkdir -p "$BUILD_DIR/old" "$BUILD_DIR/inc/ti/dsplib/src/DSPF_sp_fftSPxSP"
+git -C "$DSS_DIR" archive "$OLD_REV" source | tar -x -C "$BUILD_DIR/old"
+: > "$BUILD_DIR/inc/c6x.h"
+echo "void DSPF_sp_fftSPxSP(int N, float *ptr_x, float *ptr_w, float *ptr_y, unsigned char *brev, int n_min, int offset, int n_max);" \
+    > "$BUILD_DIR/inc/ti/dsplib/src/DSPF_sp_fftSPxSP/DSPF_sp_fftSPxSP.h"
+
+build()
+{
+    name=$1
+    root=$2
+    srcs="$root/$MOD_PATH/DoA/BF/src/*.c $root/$MOD_PATH/DoA/CaponBF/src/*.c $root/$MOD_PATH/DoA/DML/src/*.c"
+    if [ -f "$root/$MOD_PATH/utilities/radar_twiddle.c" ]; then
+        srcs="$srcs $root/$MOD_PATH/utilities/radar_twiddle.c"
+    fi
+    # shellcheck disable=SC2086
+    $CC $CFLAGS -I "$root" -I "$root/source/dpu/capon3d_overhead" -I "$BUILD_DIR/inc" \
+        -o "$BUILD_DIR/radar_cplxMath_port_host_check_$name" "$TOOLS_DIR/radar_cplxMath_port_host_check.c" $srcs -lm
+}
+
+build old "$BUILD_DIR/old"
+build new "$DSS_DIR"
+"$BUILD_DIR/radar_cplxMath_port_host_check_old" run "$BUILD_DIR/old.bin" "$NUM_TRIALS"
+"$BUILD_DIR/radar_cplxMath_port_host_check_new" run "$BUILD_DIR/new.bin" "$NUM_TRIALS"
+"$BUILD_DIR/radar_cplxMath_port_host_check_new" cmp "$BUILD_DIR/old.bin" "$BUILD_DIR/new.bin"
@@ -49,6 +49,7 @@
 
 #if defined(_TMS320C6X) || defined(LITTLE_ENDIAN_HOST)
 #include <source/dpu/capon3d_overhead/modules/utilities/radar_commonMath.h>
+#include <source/dpu/capon3d_overhead/modules/utilities/radar_cplxMath.h>
 #endif
 
 #include <source/common/swpform.h>
@@ -75,6 +76,49 @@ typedef void *DPU_radarProcess_Handle;
 #define MAX_RESOLVED_OBJECTS_PER_FRAME DOA_OUTPUT_MAXPOINTS // zz: src is defined in odmInterface.h
 #define MAX_NUM_RANGE_BINS             (256)
 
+/* Autotune mode: the DPU tries the placements of the buffers in DPU_radarProcessBufId and writes the fastest one to
+   RADARPROCESS_PLACEMENT_FILE, see radarProcess_autotune.c. Benchmark builds only. */
+//#define RADARPROCESS_AUTOTUNE
+#define RADARPROCESS_AUTOTUNE_FRAMES_PER_TRIAL (16)
+
+/* Placement header written by the autotune mode, one per antenna / bin configuration: it defines
+   RADARPROCESS_PLACEMENT_<numAntenna>_<numRangeBins>_<numDynAngleBin>_<numStaticAngleBin> as a DPU_radarProcessPlacement
+   initializer for DPU_radarProcessConfig_t::placement. The headers of the shipped configurations are in include/,
+   tools/radarProcess_placement_gen.sh writes them from a host run of the autotune mode on a cost model */
+#define RADARPROCESS_PLACEMENT_FILE "radarProcess_placement_%d_%d_%d_%d.h"
+
+/* Layout header of the radarProcess memory plan, written at init when RADAROSAL_MEMPLAN_DEBUG is defined in
+   radarOsal_memPlan.h */
+#define RADARPROCESS_MEMLAYOUT_FILE "radarProcess_memLayout.h"
+
+/**
+ * @brief
+ *  Buffers of the chain whose memory tier is chosen at init
+ */
+typedef enum
+{
+    RADARPROCESS_BUF_HEATMAP = 0,   /**< range-angle heatmap, localHeatmap */
+    RADARPROCESS_BUF_STATIC_INFO,   /**< zero Doppler samples per range bin, static_information */
+    RADARPROCESS_BUF_RANGE_BIN_MAX, /**< per range bin heatmap maximum, perRangeBinMax */
+    RADARPROCESS_BUF_INV_RN,        /**< inverse covariance matrices, invRnMatrices */
+    RADARPROCESS_BUF_CFAR_OUTPUT,   /**< CFAR detection list */
+    RADARPROCESS_BUF_TEMP_HEATMAP,  /**< heatmap of one range bin before transposition, tempHeatMapOut */
+    RADARPROCESS_BUF_ANGLE_OUTPUT,  /**< angle estimation output per detected point */
+    RADARPROCESS_NUM_PLACED_BUFS
+} DPU_radarProcessBufId;
+
+/* Placement entry keeping the default tier of the buffer */
+#define RADARPROCESS_PLACEMENT_DEFAULT (0xFFU)
+
+/**
+ * @brief
+ *  Memory tier per buffer, radarMemOsal_HeapType or RADARPROCESS_PLACEMENT_DEFAULT, indexed by DPU_radarProcessBufId
+ */
+typedef struct DPU_radarProcessPlacement_t
+{
+    uint8_t heapType[RADARPROCESS_NUM_PLACED_BUFS];
+} DPU_radarProcessPlacement;
+
 #if defined(SUBSYS_MSS) || defined(SUBSYS_DSS)
 #include <ti/datapath/dpif/dpif_pointcloud.h>
 #include <ti/datapath/dpif/dpif_detmatrix.h>
@@ -200,6 +244,10 @@ typedef struct _DPU_radarModuleConfig_
     uint8_t exportCoarseHeatmap;
     uint8_t exportRawCfarDetList;
     uint8_t exportZoomInHeatmap;
+    HeatmapCodec_Cfg heatmapExportCfg; /**< delta export configuration, used if exportCoarseHeatmap is 2 (8-bit) or 3 (16-bit). */
+
+    const DPU_radarProcessPlacement *placement; /**< per buffer memory tier override, NULL to use the default tiers. */
+    uint16_t autotuneFramesPerTrial; /**< frames measured per placement in autotune mode, 0 to disable autotune. */
 
 } DPU_radarProcessConfig_t;
 
@@ -61,6 +61,293 @@
 #define MAXWIN1DSize      (128)
 // user input configuration parameters
 
+/* Default tier of the placed buffers, indexed by DPU_radarProcessBufId */
+static const uint8_t gRadarProcessDefaultHeapType[RADARPROCESS_NUM_PLACED_BUFS] =
+{
+    RADARMEMOSAL_HEAPTYPE_LL2,          /* RADARPROCESS_BUF_HEATMAP */
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED,   /* RADARPROCESS_BUF_STATIC_INFO */
+    RADARMEMOSAL_HEAPTYPE_LL1,          /* RADARPROCESS_BUF_RANGE_BIN_MAX */
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED,   /* RADARPROCESS_BUF_INV_RN */
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED,   /* RADARPROCESS_BUF_CFAR_OUTPUT */
+    RADARMEMOSAL_HEAPTYPE_LL1,          /* RADARPROCESS_BUF_TEMP_HEATMAP */
+    RADARMEMOSAL_HEAPTYPE_LL1           /* RADARPROCESS_BUF_ANGLE_OUTPUT */
+};
+
+/* Tier used when the region of the chosen tier does not fit, indexed by DPU_radarProcessBufId */
+static const uint8_t gRadarProcessFallbackHeapType[RADARPROCESS_NUM_PLACED_BUFS] =
+{
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED,   /* RADARPROCESS_BUF_HEATMAP */
+    RADAROSAL_MEMPLAN_NO_FALLBACK,      /* RADARPROCESS_BUF_STATIC_INFO */
+    RADAROSAL_MEMPLAN_NO_FALLBACK,      /* RADARPROCESS_BUF_RANGE_BIN_MAX */
+    RADAROSAL_MEMPLAN_NO_FALLBACK,      /* RADARPROCESS_BUF_INV_RN */
+    RADAROSAL_MEMPLAN_NO_FALLBACK,      /* RADARPROCESS_BUF_CFAR_OUTPUT */
+    RADARMEMOSAL_HEAPTYPE_LL2,          /* RADARPROCESS_BUF_TEMP_HEATMAP */
+    RADAROSAL_MEMPLAN_NO_FALLBACK       /* RADARPROCESS_BUF_ANGLE_OUTPUT */
+};
+
+/* Declares a buffer of the plan in the default tier of its DPU_radarProcessBufId */
+static void radarProcess_planAdd(radarProcessInstance_t *inst, uint8_t bufId, const char *name, void **ptr,
+                                 uint32_t size, uint16_t alignment, uint32_t stageMask)
+{
+    int32_t idx;
+
+    idx = radarOsal_memPlanAdd(inst->memPlan, name, ptr, gRadarProcessDefaultHeapType[bufId],
+                               gRadarProcessFallbackHeapType[bufId], size, alignment, stageMask);
+    if (idx >= 0)
+    {
+        inst->planBufId[idx] = bufId;
+    }
+}
+
+/* Counting sort of the CFAR detections by range bin. The sort is stable, the detections of a range bin keep their
+ * CFAR order and are processed back to back by the angle estimation, which loads the radar cube slice and the
+ * inverse covariance matrix of the range bin once, and with dopplerBatchEnabled beamforms their angle estimates
+ * for the Doppler estimation together. */
+static void radarProcess_sortDetByRangeBin(radarProcessInstance_t *inst)
+{
+    RADARDEMO_detectionCFAR_output *det = inst->detectionCFAROutput;
+    uint16_t *hist = inst->detRangeBinHist;
+    uint32_t i;
+    int32_t rangeIdx;
+
+    memset(hist, 0, (inst->numRangeBins + 1) * sizeof(uint16_t));
+    for (i = 0; i < det->numObjDetected; i++)
+    {
+        hist[det->rangeInd[i] + 1]++;
+    }
+    /* hist[r] is then the first sorted position of range bin r */
+    for (rangeIdx = 1; rangeIdx <= inst->numRangeBins; rangeIdx++)
+    {
+        hist[rangeIdx] += hist[rangeIdx - 1];
+    }
+    for (i = 0; i < det->numObjDetected; i++)
+    {
+        inst->detOrder[hist[det->rangeInd[i]]++] = (uint16_t)i;
+    }
+}
+
+/* The angle estimation writes the points in range bin order to anglePoints. Copies them to the point cloud in the
+ * CFAR order of their detections, the output order before the sort, up to maxNumPnts points. When the points of a
+ * frame do not fit in anglePoints, the points kept are the first ones in range bin order, not in CFAR order: the
+ * CFAR order truncation would need a second angle estimation pass on the busiest frames. */
+static int32_t radarProcess_restoreDetOrder(radarProcessInstance_t *inst, DPIF_PointCloudSpherical *points,
+                                            DPIF_PointCloudSideInfo *snr, int32_t maxNumPnts)
+{
+    uint32_t detIdx;
+    int32_t numPnts = 0, num;
+
+    for (detIdx = 0; (detIdx < inst->detectionCFAROutput->numObjDetected) && (numPnts < maxNumPnts); detIdx++)
+    {
+        num = inst->detOutNum[detIdx];
+        if (num > maxNumPnts - numPnts)
+            num = maxNumPnts - numPnts;
+        memcpy(&points[numPnts], &inst->anglePoints[inst->detOutStart[detIdx]], num * sizeof(DPIF_PointCloudSpherical));
+        memcpy(&snr[numPnts], &inst->angleSnr[inst->detOutStart[detIdx]], num * sizeof(DPIF_PointCloudSideInfo));
+        numPnts += num;
+    }
+    return numPnts;
+}
+
+/* Fast Log2 function */
+float fast_log2(float x) {
+    union {
+        float f;
+        uint32_t i;
+    } vx = { x };
+
+    // Extract exponent: bits 23-30, minus bias (127)
+    int exp = ((vx.i >> 23) & 0xFF) - 127;
+
+    // Normalize mantissa: set exponent bits to 127 (i.e., 1.x)
+    vx.i = (vx.i & 0x007FFFFF) | 0x3F800000;
+    float m = vx.f;
+
+    // log2(m) ~ P(m - 1), m = [1, 2)
+    float y = m - 1.0f;
+
+    // Minimax 3rd-degree polynomial for log2(1 + y) on [0, 1)
+    float log2_m = 0.0012496 + y * (1.4139791 + y * (-0.5684509 + y * 0.1541525));
+
+    return exp + log2_m;
+}
+
+/* Writes the points of CFAR detection detIdx to anglePoints from numPnts on, one per angle estimate and Doppler index:
+ * the numAngleEst estimates of the angle estimation output from angleStart on. Returns the number of points written
+ * to anglePoints, at most DOA_OUTPUT_MAXPOINTS. */
+static int32_t radarProcess_writeDetPoints(radarProcessInstance_t *inst, int32_t detIdx, int32_t angleStart,
+                                           int32_t numAngleEst, int32_t numPnts)
+{
+    RADARDEMO_aoaEst2DCaponBF_output *aoa = inst->aoaOutput;
+    float   noise = inst->detectionCFAROutput->noise[detIdx];
+    float   range = (float)inst->detectionCFAROutput->rangeInd[detIdx] * inst->rangeRes;
+    int32_t angleCount, dopplerCount, dopplerIdx, i;
+
+    inst->detOutStart[detIdx] = (uint16_t)numPnts;
+    dopplerCount = angleStart * aoa->numDopplerIdx;
+    for (angleCount = angleStart; (angleCount < angleStart + numAngleEst) && (numPnts < DOA_OUTPUT_MAXPOINTS); angleCount++)
+    {
+        for (i = 0; (i < aoa->numDopplerIdx) && (numPnts < DOA_OUTPUT_MAXPOINTS); i++)
+        {
+            inst->anglePoints[numPnts].range        = range;
+            inst->anglePoints[numPnts].azimuthAngle = aoa->azimEst[angleCount];
+            inst->anglePoints[numPnts].elevAngle    = aoa->elevEst[angleCount];
+            dopplerIdx                              = (int32_t)aoa->dopplerIdx[dopplerCount++];
+            if (dopplerIdx > (inst->dopplerBinningDopplerFFTSize >> 1))
+                dopplerIdx -= inst->dopplerBinningDopplerFFTSize;
+            inst->anglePoints[numPnts].velocity = (float)dopplerIdx * inst->dopplerRes;
+            /* SNR in dB in Q8 format */
+            float temp = (3.010299957 * 256.0 * fast_log2((divsp_i((float)aoa->peakPow[angleCount], noise))));
+            if (temp > 32767.0)
+            {
+                temp = 32767.0;
+            }
+            if (temp < -32768.0)
+            {
+                temp = -32768.0;
+            }
+            inst->angleSnr[numPnts].snr = (int16_t) temp;
+            numPnts++;
+        }
+    }
+    inst->detOutNum[detIdx] = (uint16_t)(numPnts - inst->detOutStart[detIdx]);
+    return numPnts;
+}
+
+/* Static cache: the static CFAR only searched the range bins [rangeStart, rangeEnd), the detections of the other range
+ * bins are the ones of the last static CFAR. Merges them back from the detection cache, in the angle then range bin
+ * order of a search of the whole heatmap, and updates the cache. The CFAR output holds MAX_RESOLVED_OBJECTS_PER_FRAME
+ * detections, room for both lists of at most MAX_STATIC_CFAR_PNTS detections. */
+static void radarProcess_mergeStaticDet(radarProcessInstance_t *inst, int32_t rangeStart, int32_t rangeEnd)
+{
+    RADARDEMO_detectionCFAR_output *det = inst->detectionCFAROutput;
+    int32_t numKept, numDet, cacheIdx, newIdx, outIdx;
+
+    numKept = 0;
+    for (cacheIdx = 0; cacheIdx < inst->staticNumDet; cacheIdx++)
+    {
+        if ((inst->staticDetRangeInd[cacheIdx] < rangeStart) || (inst->staticDetRangeInd[cacheIdx] >= rangeEnd))
+        {
+            inst->staticDetRangeInd[numKept] = inst->staticDetRangeInd[cacheIdx];
+            inst->staticDetAzimInd[numKept]  = inst->staticDetAzimInd[cacheIdx];
+            inst->staticDetSnr[numKept]      = inst->staticDetSnr[cacheIdx];
+            inst->staticDetNoise[numKept]    = inst->staticDetNoise[cacheIdx];
+            numKept++;
+        }
+    }
+
+    /* merge from the end, the new detections are only moved up */
+    cacheIdx = numKept - 1;
+    newIdx   = det->numObjDetected - 1;
+    for (outIdx = numKept + det->numObjDetected - 1; outIdx > newIdx; outIdx--)
+    {
+        if ((newIdx < 0) ||
+            ((int32_t)inst->staticDetAzimInd[cacheIdx] * inst->numRangeBins + inst->staticDetRangeInd[cacheIdx] >
+             (int32_t)det->dopplerInd[newIdx] * inst->numRangeBins + det->rangeInd[newIdx]))
+        {
+            det->rangeInd[outIdx]   = inst->staticDetRangeInd[cacheIdx];
+            det->dopplerInd[outIdx] = inst->staticDetAzimInd[cacheIdx];
+            det->snrEst[outIdx]     = inst->staticDetSnr[cacheIdx];
+            det->noise[outIdx]      = inst->staticDetNoise[cacheIdx];
+            cacheIdx--;
+        }
+        else
+        {
+            det->rangeInd[outIdx]   = det->rangeInd[newIdx];
+            det->dopplerInd[outIdx] = det->dopplerInd[newIdx];
+            det->snrEst[outIdx]     = det->snrEst[newIdx];
+            det->noise[outIdx]      = det->noise[newIdx];
+            newIdx--;
+        }
+    }
+
+    numDet = numKept + det->numObjDetected;
+    if (numDet > MAX_STATIC_CFAR_PNTS)
+        numDet = MAX_STATIC_CFAR_PNTS;
+    det->numObjDetected = (uint16_t)numDet;
+    memcpy(inst->staticDetRangeInd, det->rangeInd, numDet * sizeof(uint16_t));
+    memcpy(inst->staticDetAzimInd, det->dopplerInd, numDet * sizeof(uint16_t));
+    memcpy(inst->staticDetSnr, det->snrEst, numDet * sizeof(float));
+    memcpy(inst->staticDetNoise, det->noise, numDet * sizeof(float));
+    inst->staticNumDet = numDet;
+}
+
+/* Static cache: the static heatmap of a range bin is only recomputed when its static information moved by more than
+ * staticChangeThr relative to the one of the last refresh */
+static int32_t radarProcess_staticBinChanged(const cplxf_t *cur, const cplxf_t *ref, int32_t nRxAnt, float thr)
+{
+    float diffPow = 0.f, refPow = 0.f, dr, di;
+    int32_t antIdx;
+
+    for (antIdx = 0; antIdx < nRxAnt; antIdx++)
+    {
+        dr       = cur[antIdx].real - ref[antIdx].real;
+        di       = cur[antIdx].imag - ref[antIdx].imag;
+        diffPow += dr * dr + di * di;
+        refPow  += ref[antIdx].real * ref[antIdx].real + ref[antIdx].imag * ref[antIdx].imag;
+    }
+    return (diffPow > thr * thr * refPow) ? 1 : 0;
+}
+
+/* Tier per buffer: default, then the init override */
+static void radarProcess_resolvePlacement(radarProcessInstance_t *inst, const DPU_radarProcessConfig_t *initParams)
+{
+    radarOsal_memPlanBuf *buf;
+    uint32_t i, bufId;
+
+    for (bufId = 0; bufId < RADARPROCESS_NUM_PLACED_BUFS; bufId++)
+    {
+        inst->placement.heapType[bufId] = gRadarProcessDefaultHeapType[bufId];
+    }
+
+    if (initParams->placement != NULL)
+    {
+        for (bufId = 0; bufId < RADARPROCESS_NUM_PLACED_BUFS; bufId++)
+        {
+            if (initParams->placement->heapType[bufId] < (uint8_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS)
+                inst->placement.heapType[bufId] = initParams->placement->heapType[bufId];
+        }
+    }
+
+    for (i = 0; i < inst->memPlan->numBufs; i++)
+    {
+        buf                   = &inst->memPlan->buf[i];
+        bufId                 = inst->planBufId[i];
+        if (bufId >= RADARPROCESS_NUM_PLACED_BUFS)
+            continue; /* fixed tier */
+        buf->heapType         = inst->placement.heapType[bufId];
+        buf->fallbackHeapType = (gRadarProcessFallbackHeapType[bufId] == buf->heapType) ? RADAROSAL_MEMPLAN_NO_FALLBACK : gRadarProcessFallbackHeapType[bufId];
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sets the pointers derived from the placed buffers. Called once the buffers are allocated and each time the
+ *      autotune mode moves them.
+ *
+ *  @param[in]  inst                    radarProcess instance.
+ */
+void radarProcess_bindBuffers(radarProcessInstance_t *inst)
+{
+    int32_t i;
+
+    for (i = 0; i < inst->numDynAngleBin; i++)
+    {
+        inst->dynamicHeatmapPtr[i] = (float *)&inst->localHeatmap[i * inst->numRangeBins];
+    }
+    if (inst->staticProcEnabled)
+    {
+        for (i = 0; i < inst->numStaticAngleBin; i++)
+        {
+            if (inst->staticCacheEnabled)
+                inst->staticHeatmapPtr[i] = (float *)&inst->staticHeatmap[i * inst->numRangeBins];
+            else
+                inst->staticHeatmapPtr[i] = (float *)&inst->localHeatmap[i * inst->numRangeBins];
+        }
+    }
+    inst->aoaOutput->malValPerRngBin = inst->perRangeBinMax;
+}
+
 /***************************************************************************
  *************************** External API Functions ************************
  **************************************************************************/
@@ -89,6 +376,18 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
     DPU_ProcessErrorCodes   errorCode = PROCESS_OK;
 
     inst  = (radarProcessInstance_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, sizeof(radarProcessInstance_t), 8);
+    inst->autotune = NULL;
+
+    /* Buffers are declared in the plan with the stages they hold data in and allocated at the end, in the tier of the placement */
+    inst->memPlan = (radarOsal_memPlan *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(radarOsal_memPlan), 8);
+    if (inst->memPlan == NULL)
+    {
+        *errCode = PROCESS_ERROR_INIT_MEMALLOC_FAILED;
+        return NULL;
+    }
+    radarOsal_memPlanInit(inst->memPlan);
+    memset(inst->planBufId, RADARPROCESS_NUM_PLACED_BUFS, sizeof(inst->planBufId));
+
     itemp = initParams->numChirpPerFrame;
 
     if ((1 << (30 - _norm(itemp))) == itemp)
@@ -141,9 +440,7 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
                 tempRe             = tempCmpVec[i].real;
                 tempIm             = tempCmpVec[i].imag;
                 tempP              = tempRe * tempRe + tempIm * tempIm;
-                invsqrt            = _rsqrsp(tempP);
-                invsqrt            = invsqrt * (1.5f - 0.5f * tempP * invsqrt * invsqrt);
-                invsqrt            = invsqrt * (1.5f - 0.5f * tempP * invsqrt * invsqrt);
+                invsqrt            = rsqrtsp_i(tempP);
                 tempCmpVec[i].real = tempRe * invsqrt * (float)(initParams->doaConfig.phaseRot[i]);
                 tempCmpVec[i].imag = -tempIm * invsqrt * (float)(initParams->doaConfig.phaseRot[i]);
             }
@@ -151,7 +448,8 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
     }
 
 
-    inst->perRangeBinMax = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, inst->numRangeBins * sizeof(float), 8);
+    /* read by the static CFAR of frames without static heatmap, holds data across frames */
+    radarProcess_planAdd(inst, RADARPROCESS_BUF_RANGE_BIN_MAX, "perRangeBinMax", (void **)&inst->perRangeBinMax, inst->numRangeBins * sizeof(float), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
     /* 2D Capon DoA init and config */
     {
         int32_t heatmapSize, maxNumAngleEst;
@@ -177,10 +475,7 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
             heatmapSize = initParams->doaConfig.numRAangleBin * initParams->doaConfig.numInputRangeBins;
         if (heatmapSize < initParams->doaConfig.numAzimBins * initParams->doaConfig.numElevBins)
             heatmapSize = initParams->doaConfig.numAzimBins * initParams->doaConfig.numElevBins;
-        // inst->localHeatmap		=	(float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0,  heatmapSize *sizeof(float), 8);
-        inst->localHeatmap         = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL2, 0, heatmapSize * sizeof(float), 8);
-
-        memset(inst->localHeatmap, 0, heatmapSize * sizeof(float));
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_HEATMAP, "localHeatmap", (void **)&inst->localHeatmap, heatmapSize * sizeof(float), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
 
         initParams->heatMapMemSize = heatmapSize;
         inst->heatMapMemSize       = heatmapSize;
@@ -192,7 +487,26 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
         inst->exportCoarseHeatmap = initParams->exportCoarseHeatmap;
         inst->exportRawCfarDetList = initParams->exportRawCfarDetList;
         inst->exportZoomInHeatmap = initParams->exportZoomInHeatmap;
-        if (inst->exportCoarseHeatmap)
+        if (inst->exportCoarseHeatmap >= 2)
+        {
+            /* Delta export: the quantized samples held by the host and the payload instead of a float copy */
+            HeatmapCodec_Cfg *exportCfg = &initParams->heatmapExportCfg;
+            uint32_t numSamples = (uint32_t)inst->numRangeBins * inst->numAzimuthBin * inst->numElevationBin;
+            void     *ref;
+            uint8_t  *stale, *out;
+
+            if (numSamples > (uint32_t)heatmapSize)
+                numSamples = (uint32_t)heatmapSize;
+            ref   = radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, HEATMAP_CODEC_REF_SIZE(exportCfg->bitsPerSample, numSamples), 8);
+            stale = (uint8_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, HEATMAP_CODEC_NUM_TILES(numSamples), 8);
+            out   = (uint8_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, HEATMAP_CODEC_OUT_SIZE(exportCfg->maxBytesPerFrame), 8);
+            if ((ref == NULL) || (stale == NULL) || (out == NULL))
+                errorCode = PROCESS_ERROR_INIT_MEMALLOC_FAILED;
+            else if (HeatmapCodec_encoderInit(&inst->heatmapEncoder, exportCfg, numSamples, inst->numRangeBins, inst->numAzimuthBin,
+                                              inst->numElevationBin, ref, stale, out) != 0)
+                errorCode = PROCESS_ERROR_NOT_SUPPORTED;
+        }
+        else if (inst->exportCoarseHeatmap)
         {
             inst->localHeatmapL3       =   (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0,  heatmapSize *sizeof(float), 8);
             if (inst->localHeatmapL3 != NULL)
@@ -210,25 +524,32 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
             maxNumAngleEst = initParams->doaConfig.angle2DEst.azimElevAngleEstCfg.maxNpeak2Search * (initParams->doaConfig.angle2DEst.azimElevAngleEstCfg.peakExpSamples * 2 + 1) * (initParams->doaConfig.angle2DEst.azimElevAngleEstCfg.peakExpSamples * 2 + 1);
         else
             maxNumAngleEst = (initParams->doaConfig.angle2DEst.azimElevZoominCfg.peakExpSamples * 2 + 1) * (initParams->doaConfig.angle2DEst.azimElevZoominCfg.peakExpSamples * 2 + 1);
-
-        inst->aoaOutput->azimEst  = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * sizeof(float), 1);
-        inst->aoaOutput->elevEst  = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * sizeof(float), 1);
-        inst->aoaOutput->peakPow  = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * sizeof(float), 1);
-        inst->aoaOutput->bwFilter = (cplxf_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * initParams->doaConfig.nRxAnt * sizeof(cplxf_t), 8);
+        /* the Doppler estimation of the zoom-in with peak search is batched over the detections of a range bin, the
+         * angle outputs hold the estimates of RADARDEMO_AOAEST2D_DOPBATCH_MAXDET detections with the most estimates */
+        inst->dopplerBatchEnabled = ((initParams->doaConfig.rangeAngleCfg.detectionMethod == 2) && (initParams->doaConfig.rangeAngleCfg.dopplerEstMethod == 0)) ? 1 : 0;
+        inst->maxNumAngleEstPerDet = (uint16_t)maxNumAngleEst;
+        if (inst->dopplerBatchEnabled)
+            maxNumAngleEst *= RADARDEMO_AOAEST2D_DOPBATCH_MAXDET;
+
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "azimEst", (void **)&inst->aoaOutput->azimEst, maxNumAngleEst * sizeof(float), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "elevEst", (void **)&inst->aoaOutput->elevEst, maxNumAngleEst * sizeof(float), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "peakPow", (void **)&inst->aoaOutput->peakPow, maxNumAngleEst * sizeof(float), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "bwFilter", (void **)&inst->aoaOutput->bwFilter, maxNumAngleEst * initParams->doaConfig.nRxAnt * sizeof(cplxf_t), 8, RADARPROCESS_LIVE_ANGLE);
         // inst->aoaOutput->malValPerRngBin	=	(float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL2, 0, initParams->doaConfig.numInputRangeBins * sizeof(float), 1);
-        inst->aoaOutput->static_information = (cplxf_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, initParams->doaConfig.numInputRangeBins * initParams->doaConfig.nRxAnt * sizeof(cplxf_t), 8);
-        inst->aoaOutput->malValPerRngBin    = inst->perRangeBinMax;
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticInformation", (void **)&inst->aoaOutput->static_information, initParams->doaConfig.numInputRangeBins * initParams->doaConfig.nRxAnt * sizeof(cplxf_t), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
 
         // inst->aoaOutput->invRnMatrices		=	(cplxf_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL2, 0, initParams->doaConfig.numInputRangeBins * (initParams->doaConfig.nRxAnt >> 1) * (initParams->doaConfig.nRxAnt + 1) * sizeof(cplxf_t), 8);
-        inst->aoaOutput->invRnMatrices = (cplxf_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, initParams->doaConfig.numInputRangeBins * (initParams->doaConfig.nRxAnt >> 1) * (initParams->doaConfig.nRxAnt + 1) * sizeof(cplxf_t), 8);
+        /* inverse covariance of a range bin is computed with its heatmap and only read by the dynamic angle estimation */
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_INV_RN, "invRnMatrices", (void **)&inst->aoaOutput->invRnMatrices, initParams->doaConfig.numInputRangeBins * (initParams->doaConfig.nRxAnt >> 1) * (initParams->doaConfig.nRxAnt + 1) * sizeof(cplxf_t), 8, RADARPROCESS_LIVE_DYNAMIC);
         if (initParams->doaConfig.rangeAngleCfg.dopplerEstMethod == 1)
         {
-            inst->aoaOutput->dopplerIdx    = (uint16_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * MAX_DOPCFAR_DET * sizeof(uint16_t), 1);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "dopplerIdx", (void **)&inst->aoaOutput->dopplerIdx, maxNumAngleEst * MAX_DOPCFAR_DET * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+            /* not planned: the angle estimation replaces the pointer */
             inst->aoaOutput->dopplerDetSNR = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * MAX_DOPCFAR_DET * sizeof(float), 1);
         }
         else
         {
-            inst->aoaOutput->dopplerIdx = (uint16_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, maxNumAngleEst * sizeof(uint16_t), 1);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "dopplerIdx", (void **)&inst->aoaOutput->dopplerIdx, maxNumAngleEst * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
         }
 #ifdef CAPON2DMODULEDEBUG
         inst->aoaOutput->cyclesLog = (RADARDEMO_aoaEst2DCaponBF_moduleCycles *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(RADARDEMO_aoaEst2DCaponBF_moduleCycles), 8);
@@ -266,24 +587,27 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
         // inst->detectionCFAROutput->noise		=	(float *) radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL2, 0, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(float), 1);
 
         inst->detectionCFAROutput             = (RADARDEMO_detectionCFAR_output *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(RADARDEMO_detectionCFAR_output), 1);
-        inst->detectionCFAROutput->rangeInd   = (uint16_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1);
-        inst->detectionCFAROutput->dopplerInd = (uint16_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1);
-        inst->detectionCFAROutput->snrEst     = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(float), 1);
-        inst->detectionCFAROutput->noise      = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(float), 1);
-
-        inst->detectionCFARInput = (RADARDEMO_detectionCFAR_input *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, sizeof(RADARDEMO_detectionCFAR_input), 1);
+        if (inst->detectionCFAROutput == NULL)
+        {
+            *errCode = PROCESS_ERROR_CFARPROC_INOUTALLOC_FAILED;
+            return NULL;
+        }
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarRangeInd", (void **)&inst->detectionCFAROutput->rangeInd, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_DETECTION);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarDopplerInd", (void **)&inst->detectionCFAROutput->dopplerInd, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_DETECTION);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarSnrEst", (void **)&inst->detectionCFAROutput->snrEst, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(float), 1, RADARPROCESS_LIVE_DETECTION);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarNoise", (void **)&inst->detectionCFAROutput->noise, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(float), 1, RADARPROCESS_LIVE_DETECTION);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detOrder", (void **)&inst->detOrder, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detRangeBinHist", (void **)&inst->detRangeBinHist, (inst->numRangeBins + 1) * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detOutStart", (void **)&inst->detOutStart, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detOutNum", (void **)&inst->detOutNum, initParams->dynamicCfarConfig.maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "anglePoints", (void **)&inst->anglePoints, DOA_OUTPUT_MAXPOINTS * sizeof(DPIF_PointCloudSpherical), 4, RADARPROCESS_LIVE_ANGLE);
+        radarProcess_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "angleSnr", (void **)&inst->angleSnr, DOA_OUTPUT_MAXPOINTS * sizeof(DPIF_PointCloudSideInfo), 4, RADARPROCESS_LIVE_ANGLE);
+
+        /* all the fields are written at the start of each CFAR stage */
+        radarOsal_memPlanAdd(inst->memPlan, "cfarInput", (void **)&inst->detectionCFARInput, RADARMEMOSAL_HEAPTYPE_LL1, RADAROSAL_MEMPLAN_NO_FALLBACK, sizeof(RADARDEMO_detectionCFAR_input), 1, RADARPROCESS_LIVE_CFAR);
         inst->dynamicHeatmapPtr  = (float **)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL2, 0, initParams->dynamicCfarConfig.fft2DSize * sizeof(float *), 1);
         inst->dynamicSideLobeThr = initParams->dynamicSideLobeThr;
         inst->dynamicSideLobeThr = initParams->dynamicSideLobeThr;
-        for (i = 0; i < (int32_t)initParams->dynamicCfarConfig.fft2DSize; i++)
-        {
-            inst->dynamicHeatmapPtr[i] = (float *)&inst->localHeatmap[i * initParams->dynamicCfarConfig.fft1DSize];
-        }
-
-        if ((inst->detectionCFAROutput == NULL) || (inst->detectionCFAROutput->rangeInd == NULL) || (inst->detectionCFAROutput->dopplerInd == NULL) || (inst->detectionCFAROutput->snrEst == NULL) || (inst->detectionCFAROutput->noise == NULL))
-        {
-            errorCode = PROCESS_ERROR_CFARPROC_INOUTALLOC_FAILED;
-        }
     }
 
     inst->staticProcEnabled = initParams->doaConfig.staticEstCfg.staticProcEnabled;
@@ -314,22 +638,39 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
 
         inst->staticSideLobeThr = initParams->staticSideLobeThr;
         inst->staticHeatmapPtr  = (float **)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL1, 0, initParams->dynamicCfarConfig.fft2DSize * sizeof(float *), 1);
-        for (i = 0; i < (int32_t)initParams->staticCfarConfig.fft2DSize; i++)
+
+        /* static cache: the static heatmap, its per range bin max and the static points are kept across frames */
+        inst->staticRefreshPeriod = initParams->doaConfig.staticEstCfg.staticRefreshPeriod;
+        inst->staticChangeThr     = initParams->doaConfig.staticEstCfg.staticChangeThr;
+        inst->staticCacheEnabled  = (inst->staticRefreshPeriod > 1U) ? 1U : 0U;
+        inst->staticFrameCnt      = 0;
+        inst->staticNumPnts       = 0;
+        inst->staticNumDet        = 0;
+        if (inst->staticCacheEnabled)
         {
-            inst->staticHeatmapPtr[i] = (float *)&inst->localHeatmap[i * initParams->staticCfarConfig.fft1DSize];
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_HEATMAP, "staticHeatmap", (void **)&inst->staticHeatmap, inst->numStaticAngleBin * inst->numRangeBins * sizeof(float), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_RANGE_BIN_MAX, "staticRangeBinMax", (void **)&inst->staticRangeBinMax, inst->numRangeBins * sizeof(float), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticRef", (void **)&inst->staticRef, inst->numRangeBins * inst->nRxAnt * sizeof(cplxf_t), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticPointCache", (void **)&inst->staticPointCache, MAX_STATIC_CFAR_PNTS * sizeof(DPIF_PointCloudSpherical), 4, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticSnrCache", (void **)&inst->staticSnrCache, MAX_STATIC_CFAR_PNTS * sizeof(DPIF_PointCloudSideInfo), 4, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticDetRangeInd", (void **)&inst->staticDetRangeInd, MAX_STATIC_CFAR_PNTS * sizeof(uint16_t), 1, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticDetAzimInd", (void **)&inst->staticDetAzimInd, MAX_STATIC_CFAR_PNTS * sizeof(uint16_t), 1, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticDetSnr", (void **)&inst->staticDetSnr, MAX_STATIC_CFAR_PNTS * sizeof(float), 1, RADAROSAL_MEMPLAN_STAGE_ALL);
+            radarProcess_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticDetNoise", (void **)&inst->staticDetNoise, MAX_STATIC_CFAR_PNTS * sizeof(float), 1, RADAROSAL_MEMPLAN_STAGE_ALL);
         }
     }
     else
     {
         inst->staticCFARInstance = NULL;
+        inst->staticCacheEnabled = 0;
     }
 
-    inst->tempHeatMapOut = (float *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_LL2, 0, perRngbinHeatmapLen * sizeof(float), 8);
+    /* Written and transposed per range bin: in L1 when it fits, sharing with the angle estimation buffers */
+    radarProcess_planAdd(inst, RADARPROCESS_BUF_TEMP_HEATMAP, "tempHeatMapOut", (void **)&inst->tempHeatMapOut, perRngbinHeatmapLen * sizeof(float), 8, RADARPROCESS_LIVE_HEATMAP);
 
     inst->framePeriod = initParams->framePeriod;
 
     inst->mimoModeFlag     = (uint8_t)initParams->mimoModeFlag;
-    initParams->heatMapMem = inst->localHeatmap;
 
     inst->benchmarkPtr            = (radarProcessBenchmarkObj *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(radarProcessBenchmarkObj), 1);
     inst->benchmarkPtr->bufferLen = 20;
@@ -341,6 +682,27 @@ DPU_radarProcess_Handle DPU_radarProcess_init(
 
     memset(inst->benchmarkPtr->buffer, 0, inst->benchmarkPtr->bufferLen * sizeof(DPIF_MSS_DSS_radarProcessBenchmarkElem));
 
+    /* Last allocation of the chain, the L1 region gets what is left of L1 */
+    radarProcess_resolvePlacement(inst, initParams);
+    if (initParams->autotuneFramesPerTrial != 0U)
+        itemp = radarProcess_autotuneInit(inst, initParams->autotuneFramesPerTrial);
+    else
+        itemp = radarOsal_memPlanAlloc(inst->memPlan);
+    if (itemp != 0)
+    {
+        errorCode = PROCESS_ERROR_INIT_MEMALLOC_FAILED;
+    }
+    else
+    {
+        memset(inst->localHeatmap, 0, inst->heatMapMemSize * sizeof(float));
+        radarProcess_bindBuffers(inst);
+    }
+#ifdef RADAROSAL_MEMPLAN_DEBUG
+    radarOsal_memPlanPrint(inst->memPlan, "RADARPROCESS");
+    radarOsal_memPlanWriteHeader(inst->memPlan, "RADARPROCESS", RADARPROCESS_MEMLAYOUT_FILE);
+#endif
+    initParams->heatMapMem = inst->localHeatmap;
+
     if ((inst->localHeatmap == NULL) || (inst->benchmarkPtr == NULL) || (inst->benchmarkPtr->buffer == NULL))
         errorCode = PROCESS_ERROR_INIT_MEMALLOC_FAILED;
 
@@ -394,29 +756,6 @@ int32_t DPU_radarProcess_config(
     return (retVal);
 }
 
-/* Fast Log2 function */
-float fast_log2(float x) {
-    union {
-        float f;
-        uint32_t i;
-    } vx = { x };
-
-    // Extract exponent: bits 23-30, minus bias (127)
-    int exp = ((vx.i >> 23) & 0xFF) - 127;
-
-    // Normalize mantissa: set exponent bits to 127 (i.e., 1.x)
-    vx.i = (vx.i & 0x007FFFFF) | 0x3F800000;
-    float m = vx.f;
-
-    // log2(m) ~ P(m - 1), m = [1, 2)
-    float y = m - 1.0f;
-
-    // Minimax 3rd-degree polynomial for log2(1 + y) on [0, 1)
-    float log2_m = 0.0012496 + y * (1.4139791 + y * (-0.5684509 + y * 0.1541525));
-
-    return exp + log2_m;
-}
-
 /**
  *  @b Description
  *  @n
@@ -439,7 +778,9 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
 #ifdef _TMS320C6X
     int32_t t1;
 #endif
-    int32_t i, cOutNumDectected, numDynamicPnts;
+    int32_t i, cOutNumDectected, numDynamicPnts, numStaticRefreshed, staticDetection;
+    int32_t staticSearchStart, staticSearchEnd;
+    float  *staticHeatmap;
     // RADARDEMO_aoaEst2DCaponBF_errorCode aoaBFErrorCode;
     DPIF_MSS_DSS_radarProcessOutput *resultsPtr = (DPIF_MSS_DSS_radarProcessOutput *)pDataOut;
     DPIF_MSS_DSS_pointCloud *output = &resultsPtr->pointCloudOut;
@@ -456,6 +797,7 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
 
 #ifdef _TMS320C6X
         t1 = TSCL;
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_DYN_HEATMAP, 0);
 #endif
 
 #ifdef CAPON2DMODULEDEBUG
@@ -482,6 +824,7 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
         if (processInst->benchmarkPtr->bufferIdx >= processInst->benchmarkPtr->bufferLen)
             processInst->benchmarkPtr->bufferIdx = 0;
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].dynHeatmpGenCycles = TSCL - t1;
+        DPC_TRACE_END(DPC_TRACE_ID_DSS_DYN_HEATMAP, 0);
 #endif
     }
 
@@ -489,12 +832,15 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
 
 #ifdef _TMS320C6X
         t1 = TSCL;
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_DYN_CFAR, 0);
 #endif
         processInst->detectionCFARInput->azMaxPerRangeBin       = processInst->perRangeBinMax;
         processInst->detectionCFARInput->sidelobeThr            = processInst->dynamicSideLobeThr;
         processInst->detectionCFARInput->enableSecondPass       = 1;
         processInst->detectionCFARInput->enable_neighbour_check = 1;
         processInst->detectionCFARInput->heatmapInput           = processInst->dynamicHeatmapPtr;
+        processInst->detectionCFARInput->rangeStartInd          = 0;
+        processInst->detectionCFARInput->rangeEndInd            = (uint16_t)processInst->numRangeBins;
 
         // CFAR  - Detection
         processInst->cfarErrorCode = RADARDEMO_detectionCFAR_run(
@@ -504,6 +850,7 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
 
 #ifdef _TMS320C6X
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].dynCfarDetectionCycles = TSCL - t1;
+        DPC_TRACE_END(DPC_TRACE_ID_DSS_DYN_CFAR, 0);
 #endif
         if (processInst->exportRawCfarDetList)
         {
@@ -520,18 +867,25 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
 
     cOutNumDectected = 0;
     { // angle and doppler estimation, per detected range-angle points -- for dynamic scene processing
-        int32_t angleCount, dopplerCount, detIdx;
-        int32_t dopplerIdx;
+        int32_t angleCount, detIdx, sortIdx, batchIdx, batchStart, batchNumBeams, numPnts, numDet;
 
-        processInst->aoaInput->processingStepSelector = 1;
 #ifdef _TMS320C6X
         t1 = TSCL;
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_DYN_ANGLE, 0);
 #endif
         processInst->aoaInput->nChirps              = processInst->numChirpsPerFrame;
         processInst->aoaOutput->rangeAzimuthHeatMap = processInst->localHeatmap;
         processInst->aoaInput->frameCntr                = frameCntr;
-        for (detIdx = 0; detIdx < (int32_t)processInst->detectionCFAROutput->numObjDetected; detIdx++)
+        radarProcess_sortDetByRangeBin(processInst);
+        memset(processInst->detOutNum, 0, processInst->detectionCFAROutput->numObjDetected * sizeof(uint16_t));
+        numPnts = 0;
+        numDet  = (int32_t)processInst->detectionCFAROutput->numObjDetected;
+        batchStart    = 0;
+        batchNumBeams = 0;
+        processInst->aoaInput->processingStepSelector = processInst->dopplerBatchEnabled ? 2 : 1;
+        for (sortIdx = 0; (sortIdx < numDet) && (numPnts < DOA_OUTPUT_MAXPOINTS); sortIdx++)
         {
+            detIdx                                          = processInst->detOrder[sortIdx];
             processInst->aoaInput->rangeIndx                = processInst->detectionCFAROutput->rangeInd[detIdx];
             processInst->aoaInput->angleIndx                = processInst->detectionCFAROutput->dopplerInd[detIdx];
             processInst->aoaInput->inputRangeProcOutSamples = &pDataIn[processInst->aoaInput->rangeIndx * processInst->nRxAnt * processInst->aoaInput->nChirps];
@@ -540,39 +894,45 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
             processInst->aoaBFErrorCode = RADARDEMO_aoaEst2DCaponBF_run(processInst->aoaInstance,
                                                                         processInst->aoaInput,
                                                                         processInst->aoaOutput);
-
-            dopplerCount = 0;
-            for (angleCount = 0; angleCount < processInst->aoaOutput->numAngleEst; angleCount++)
+            if (processInst->dopplerBatchEnabled == 0)
             {
-                for (i = 0; i < processInst->aoaOutput->numDopplerIdx; i++)
+                numPnts = radarProcess_writeDetPoints(processInst, detIdx, 0, processInst->aoaOutput->numAngleEst, numPnts);
+            }
+            else
+            {
+                /* the detections of a range bin get their angles estimated one by one (step 2) and their Doppler
+                 * estimated together (step 3), once the next detection is of another range bin or might not fit the
+                 * angle outputs. detOutNum keeps the number of angle estimates of the queued detections until then. */
+                processInst->detOutNum[detIdx] = (uint16_t)processInst->aoaOutput->numAngleEst;
+                batchNumBeams += processInst->aoaOutput->numAngleEst;
+                if ((sortIdx + 1 == numDet) ||
+                    (processInst->detectionCFAROutput->rangeInd[processInst->detOrder[sortIdx + 1]] != processInst->aoaInput->rangeIndx) ||
+                    (batchNumBeams + processInst->maxNumAngleEstPerDet > processInst->maxNumAngleEstPerDet * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET))
                 {
-                    output->pointCloud[cOutNumDectected].range        = (float)processInst->aoaInput->rangeIndx * processInst->rangeRes;
-                    output->pointCloud[cOutNumDectected].azimuthAngle = processInst->aoaOutput->azimEst[angleCount];
-                    output->pointCloud[cOutNumDectected].elevAngle    = processInst->aoaOutput->elevEst[angleCount];
-                    dopplerIdx                                        = (int32_t)processInst->aoaOutput->dopplerIdx[dopplerCount++];
-                    if (dopplerIdx > (processInst->dopplerBinningDopplerFFTSize >> 1))
-                        dopplerIdx -= processInst->dopplerBinningDopplerFFTSize;
-                    output->pointCloud[cOutNumDectected].velocity = (float)dopplerIdx * processInst->dopplerRes;
-                    /* SNR in dB in Q8 format */
-                    float temp = (3.010299957 * 256.0 * fast_log2((divsp_i((float)processInst->aoaOutput->peakPow[angleCount], processInst->aoaInput->noise))));
-                    if (temp > 32767.0)
-                    {
-                        temp = 32767.0;
-                    }
-                    if (temp < -32768.0)
+                    processInst->aoaInput->processingStepSelector = 3;
+                    processInst->aoaBFErrorCode = RADARDEMO_aoaEst2DCaponBF_run(processInst->aoaInstance,
+                                                                                processInst->aoaInput,
+                                                                                processInst->aoaOutput);
+                    processInst->aoaInput->processingStepSelector = 2;
+
+                    angleCount = 0;
+                    for (batchIdx = batchStart; batchIdx <= sortIdx; batchIdx++)
                     {
-                        temp = -32768.0;
+                        detIdx  = processInst->detOrder[batchIdx];
+                        i       = processInst->detOutNum[detIdx];
+                        numPnts = radarProcess_writeDetPoints(processInst, detIdx, angleCount, i, numPnts);
+                        angleCount += i;
                     }
-                    output->snr[cOutNumDectected].snr = (int16_t) temp;
-                    cOutNumDectected++;
-                    if (cOutNumDectected > DOA_OUTPUT_MAXPOINTS)
-                        break;
+                    batchStart    = sortIdx + 1;
+                    batchNumBeams = 0;
                 }
             }
         }
-        numDynamicPnts = cOutNumDectected;
+        cOutNumDectected = radarProcess_restoreDetOrder(processInst, output->pointCloud, output->snr, DOA_OUTPUT_MAXPOINTS);
+        numDynamicPnts   = cOutNumDectected;
 #ifdef _TMS320C6X
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].dynAngleDopEstCycles = TSCL - t1;
+        DPC_TRACE_END(DPC_TRACE_ID_DSS_DYN_ANGLE, 0);
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].dynNumDetPnts        = numDynamicPnts;
 #endif
     }
@@ -583,87 +943,193 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
     ///////////////////       Calling modules -- Static processing      ////////////////////////
     ////////////////////////////////////////////////////////////////////////////////////////////
 
+    numStaticRefreshed = 0;
+    staticSearchStart  = processInst->numRangeBins;
+    staticSearchEnd    = 0;
+    staticHeatmap      = processInst->staticCacheEnabled ? processInst->staticHeatmap : processInst->localHeatmap;
     if ((processInst->staticProcEnabled) && (cOutNumDectected < DOA_OUTPUT_MAXPOINTS))
     { // range-angle heatmap generation for Static scene processing
+        int32_t forceRefresh;
 
         processInst->aoaInput->processingStepSelector = 0; // BF part
 #ifdef _TMS320C6X
         t1 = TSCL;
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_STATIC_HEATMAP, 0);
 #endif
+        /* with the static cache, only the range bins whose static information moved are recomputed between two
+         * refreshes of the whole heatmap */
+        forceRefresh = (processInst->staticCacheEnabled == 0) || (processInst->staticFrameCnt == 0);
+        if (processInst->staticCacheEnabled)
+        {
+            processInst->aoaOutput->malValPerRngBin = processInst->staticRangeBinMax;
+            /* the range bins skipped by the CFAR are never written */
+            if (forceRefresh)
+            {
+                memset(processInst->staticHeatmap, 0, processInst->numStaticAngleBin * processInst->numRangeBins * sizeof(float));
+                memset(processInst->staticRangeBinMax, 0, processInst->numRangeBins * sizeof(float));
+                staticSearchStart = 0;
+                staticSearchEnd   = processInst->numRangeBins;
+            }
+        }
         for (i = processInst->cfarRangeSkipLeft; i < processInst->numRangeBins - processInst->cfarRangeSkipRight; i++)
         {
+            if ((forceRefresh == 0) &&
+                (radarProcess_staticBinChanged(&processInst->aoaOutput->static_information[i * processInst->nRxAnt],
+                                               &processInst->staticRef[i * processInst->nRxAnt],
+                                               processInst->nRxAnt, processInst->staticChangeThr) == 0))
+                continue;
+
             processInst->aoaInput->rangeIndx            = i;
             processInst->aoaOutput->rangeAzimuthHeatMap = processInst->tempHeatMapOut;
             processInst->aoaBFErrorCode                 = RADARDEMO_aoaEst2DCaponBF_static_run(
                 processInst->aoaInstance,
                 processInst->aoaInput,
                 processInst->aoaOutput);
-            copyTranspose((uint32_t *)&processInst->tempHeatMapOut[0], (uint32_t *)&processInst->localHeatmap[i], processInst->numStaticAngleBin, 0, processInst->numRangeBins, 1);
+            copyTranspose((uint32_t *)&processInst->tempHeatMapOut[0], (uint32_t *)&staticHeatmap[i], processInst->numStaticAngleBin, 0, processInst->numRangeBins, 1);
+            if (processInst->staticCacheEnabled)
+                memcpy(&processInst->staticRef[i * processInst->nRxAnt], &processInst->aoaOutput->static_information[i * processInst->nRxAnt], processInst->nRxAnt * sizeof(cplxf_t));
+            if (i < staticSearchStart)
+                staticSearchStart = i;
+            if (i >= staticSearchEnd)
+                staticSearchEnd = i + 1;
+            numStaticRefreshed++;
+        }
+        if (processInst->staticCacheEnabled)
+        {
+            processInst->aoaOutput->malValPerRngBin = processInst->perRangeBinMax;
+            processInst->staticFrameCnt++;
+            if (processInst->staticFrameCnt >= processInst->staticRefreshPeriod)
+                processInst->staticFrameCnt = 0;
         }
 #ifdef _TMS320C6X
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].staticHeatmpGenCycles = TSCL - t1;
+        DPC_TRACE_END(DPC_TRACE_ID_DSS_STATIC_HEATMAP, 0);
 #endif
     }
+#ifdef _TMS320C6X
+    processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].staticNumRefreshedBins = numStaticRefreshed;
+#endif
 
-    if (processInst->staticProcEnabled)
+    /* with the static cache, the static detection runs only if the static heatmap changed, the static points of the
+     * last detection are output otherwise */
+    staticDetection = (processInst->staticCacheEnabled == 0) || (numStaticRefreshed > 0);
+
+    if ((processInst->staticProcEnabled) && staticDetection)
     { // test CFAR -- for Static scene processing
 
 #ifdef _TMS320C6X
         t1 = TSCL;
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_STATIC_CFAR, 0);
 #endif
-        processInst->detectionCFARInput->azMaxPerRangeBin       = processInst->perRangeBinMax;
+        processInst->detectionCFARInput->azMaxPerRangeBin       = processInst->staticCacheEnabled ? processInst->staticRangeBinMax : processInst->perRangeBinMax;
         processInst->detectionCFARInput->sidelobeThr            = processInst->staticSideLobeThr;
         processInst->detectionCFARInput->enableSecondPass       = 0;
         processInst->detectionCFARInput->enable_neighbour_check = 1;
         processInst->detectionCFARInput->heatmapInput           = processInst->staticHeatmapPtr;
+        /* with the static cache, only the range bins within the CFAR window reach of a refreshed range bin are
+         * searched, unless the last detection list may have been truncated */
+        if ((processInst->staticCacheEnabled) && (processInst->staticNumDet < MAX_STATIC_CFAR_PNTS))
+        {
+            int32_t reach = RADARDEMO_detectionCFAR_rangeReach(processInst->staticCFARInstance);
+            staticSearchStart = (staticSearchStart > reach) ? (staticSearchStart - reach) : 0;
+            staticSearchEnd   = (staticSearchEnd + reach < processInst->numRangeBins) ? (staticSearchEnd + reach) : processInst->numRangeBins;
+        }
+        else
+        {
+            staticSearchStart = 0;
+            staticSearchEnd   = processInst->numRangeBins;
+        }
+        processInst->detectionCFARInput->rangeStartInd          = (uint16_t)staticSearchStart;
+        processInst->detectionCFARInput->rangeEndInd            = (uint16_t)staticSearchEnd;
         // Detection
         processInst->cfarErrorCode = RADARDEMO_detectionCFAR_run(
             processInst->staticCFARInstance,
             processInst->detectionCFARInput,
             processInst->detectionCFAROutput);
+        if (processInst->staticCacheEnabled)
+            radarProcess_mergeStaticDet(processInst, staticSearchStart, staticSearchEnd);
 
 #ifdef _TMS320C6X
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].staticCfarDetectionCycles = TSCL - t1;
+        DPC_TRACE_END(DPC_TRACE_ID_DSS_STATIC_CFAR, 0);
 #endif
     }
 
     if (processInst->staticProcEnabled)
     { // angle interpolation per detected range-angle points -- for Static scene processing
-        int32_t detIdx, angleIdx;
+        int32_t detIdx, sortIdx, angleIdx, numStaticPnts, maxStaticPnts;
+        DPIF_PointCloudSpherical *staticPoints;
+        DPIF_PointCloudSideInfo  *staticSnr;
 
 #ifdef _TMS320C6X
         t1 = TSCL;
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_STATIC_ANGLE, 0);
 #endif
-        processInst->aoaInput->processingStepSelector = 1;
-        processInst->aoaOutput->rangeAzimuthHeatMap   = &processInst->localHeatmap[0];
-        processInst->aoaInput->nChirps                = processInst->numChirpsPerFrame;
-        processInst->aoaOutput->rangeAzimuthHeatMap   = processInst->localHeatmap;
-        for (detIdx = 0; detIdx < (int32_t)processInst->detectionCFAROutput->numObjDetected; detIdx++)
+        if (processInst->staticCacheEnabled)
         {
-            processInst->aoaInput->rangeIndx                = processInst->detectionCFAROutput->rangeInd[detIdx];
-            processInst->aoaInput->angleIndx                = processInst->detectionCFAROutput->dopplerInd[detIdx];
-            processInst->aoaInput->inputRangeProcOutSamples = &pDataIn[processInst->aoaInput->rangeIndx * processInst->nRxAnt * processInst->aoaInput->nChirps];
-            processInst->aoaInput->noise                    = processInst->detectionCFAROutput->noise[detIdx];
-
-            processInst->aoaBFErrorCode = RADARDEMO_aoaEst2DCaponBF_static_run(
-                processInst->aoaInstance,
-                processInst->aoaInput,
-                processInst->aoaOutput);
+            staticPoints  = processInst->staticPointCache;
+            staticSnr     = processInst->staticSnrCache;
+            maxStaticPnts = MAX_STATIC_CFAR_PNTS;
+        }
+        else
+        {
+            staticPoints  = &output->pointCloud[cOutNumDectected];
+            staticSnr     = &output->snr[cOutNumDectected];
+            maxStaticPnts = DOA_OUTPUT_MAXPOINTS - cOutNumDectected;
+        }
 
-            for (angleIdx = 0; angleIdx < processInst->aoaOutput->numAngleEst; angleIdx++)
+        if (staticDetection)
+        {
+            processInst->aoaInput->processingStepSelector = 1;
+            processInst->aoaInput->nChirps                = processInst->numChirpsPerFrame;
+            processInst->aoaOutput->rangeAzimuthHeatMap   = staticHeatmap;
+            radarProcess_sortDetByRangeBin(processInst);
+            memset(processInst->detOutNum, 0, processInst->detectionCFAROutput->numObjDetected * sizeof(uint16_t));
+            numStaticPnts = 0;
+            for (sortIdx = 0; (sortIdx < (int32_t)processInst->detectionCFAROutput->numObjDetected) && (numStaticPnts < DOA_OUTPUT_MAXPOINTS); sortIdx++)
             {
-                output->pointCloud[cOutNumDectected].range        = (float)processInst->aoaInput->rangeIndx * processInst->rangeRes;
-                output->pointCloud[cOutNumDectected].azimuthAngle = -processInst->aoaOutput->azimEst[angleIdx];
-                output->pointCloud[cOutNumDectected].elevAngle    = processInst->aoaOutput->elevEst[angleIdx];
-                output->pointCloud[cOutNumDectected].velocity     = 0.f;
-                output->snr[cOutNumDectected].snr                 = (int16_t)(divsp_i((float)processInst->aoaOutput->peakPow[angleIdx], processInst->aoaInput->noise) * 8.f);
-                cOutNumDectected++;
-                if (cOutNumDectected > DOA_OUTPUT_MAXPOINTS)
-                    break;
+                detIdx                                          = processInst->detOrder[sortIdx];
+                processInst->aoaInput->rangeIndx                = processInst->detectionCFAROutput->rangeInd[detIdx];
+                processInst->aoaInput->angleIndx                = processInst->detectionCFAROutput->dopplerInd[detIdx];
+                processInst->aoaInput->inputRangeProcOutSamples = &pDataIn[processInst->aoaInput->rangeIndx * processInst->nRxAnt * processInst->aoaInput->nChirps];
+                processInst->aoaInput->noise                    = processInst->detectionCFAROutput->noise[detIdx];
+
+                processInst->aoaBFErrorCode = RADARDEMO_aoaEst2DCaponBF_static_run(
+                    processInst->aoaInstance,
+                    processInst->aoaInput,
+                    processInst->aoaOutput);
+
+                processInst->detOutStart[detIdx] = (uint16_t)numStaticPnts;
+                for (angleIdx = 0; (angleIdx < processInst->aoaOutput->numAngleEst) && (numStaticPnts < DOA_OUTPUT_MAXPOINTS); angleIdx++)
+                {
+                    processInst->anglePoints[numStaticPnts].range        = (float)processInst->aoaInput->rangeIndx * processInst->rangeRes;
+                    processInst->anglePoints[numStaticPnts].azimuthAngle = -processInst->aoaOutput->azimEst[angleIdx];
+                    processInst->anglePoints[numStaticPnts].elevAngle    = processInst->aoaOutput->elevEst[angleIdx];
+                    processInst->anglePoints[numStaticPnts].velocity     = 0.f;
+                    processInst->angleSnr[numStaticPnts].snr             = (int16_t)(divsp_i((float)processInst->aoaOutput->peakPow[angleIdx], processInst->aoaInput->noise) * 8.f);
+                    numStaticPnts++;
+                }
+                processInst->detOutNum[detIdx] = (uint16_t)(numStaticPnts - processInst->detOutStart[detIdx]);
             }
+            numStaticPnts = radarProcess_restoreDetOrder(processInst, staticPoints, staticSnr, maxStaticPnts);
         }
+        else
+        {
+            numStaticPnts = processInst->staticNumPnts;
+        }
+
+        if (processInst->staticCacheEnabled)
+        {
+            processInst->staticNumPnts = numStaticPnts;
+            if (numStaticPnts > DOA_OUTPUT_MAXPOINTS - cOutNumDectected)
+                numStaticPnts = DOA_OUTPUT_MAXPOINTS - cOutNumDectected;
+            memcpy(&output->pointCloud[cOutNumDectected], staticPoints, numStaticPnts * sizeof(DPIF_PointCloudSpherical));
+            memcpy(&output->snr[cOutNumDectected], staticSnr, numStaticPnts * sizeof(DPIF_PointCloudSideInfo));
+        }
+        cOutNumDectected += numStaticPnts;
 #ifdef _TMS320C6X
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].staticAngleEstCycles = TSCL - t1;
+        DPC_TRACE_END(DPC_TRACE_ID_DSS_STATIC_ANGLE, 0);
         processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx].staticNumDetPnts     = cOutNumDectected - numDynamicPnts;
 #endif
     }
@@ -672,7 +1138,12 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
     resultsPtr->benchmarkOut = &processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx];
 #endif
 
-    if (processInst->exportCoarseHeatmap)
+    if (processInst->exportCoarseHeatmap >= 2)
+    {
+        resultsPtr->heatMapDeltaOut.length = HeatmapCodec_encode(&processInst->heatmapEncoder, processInst->localHeatmap);
+        resultsPtr->heatMapDeltaOut.data   = processInst->heatmapEncoder.out;
+    }
+    else if (processInst->exportCoarseHeatmap)
     {
         memcpy(processInst->localHeatmapL3, processInst->localHeatmap, processInst->heatMapMemSize* sizeof(float));
         heatMapOut.numRangeBins  = processInst->numRangeBins;
@@ -686,6 +1157,14 @@ int32_t DPU_radarProcess_process(void *handle, cplx16_t *pDataIn, uint32_t frame
         resultsPtr->rawCfarPointCloud =  processInst->rawCfarPointCloud;
     }
 
+#ifdef _TMS320C6X
+    /* Between frames: may move the placed buffers */
+    if (processInst->autotune != NULL)
+    {
+        radarProcess_autotuneFrame(processInst, &processInst->benchmarkPtr->buffer[processInst->benchmarkPtr->bufferIdx]);
+    }
+#endif
+
     output->object_count = cOutNumDectected;
 
     *errCode = (int32_t)processInst->aoaBFErrorCode;
@@ -0,0 +1,386 @@
+/*!
+ *  \file   radarProcess_autotune.c
+ *
+ *  \brief   Autotune mode of the radar signal processing chain: measures the placements of the buffers in the memory tiers.
+ *
+ *  Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * At init the plan gets one arena per heap, of the capacity radarOsal_printHeapStats() reports for the plan in a build
+ * without autotune, up to the size of all the buffers that may be placed in the heap. Each trial solves the plan in
+ * its placement and points the buffers at their offset in the arena of their heap, so the buffers share memory as
+ * they do with radarOsal_memPlanAlloc() and a placement is measured with the layout it runs with. The buffers holding
+ * data across frames are saved to a DDR area before the move and restored after it.
+ *
+ * The search is a coordinate descent from the initial placement: each trial moves one buffer to another heap, runs
+ * framesPerTrial frames, and keeps the move if the sum of the stage cycles of the benchmark harness drops. A trial
+ * is only run if its plan fits in the arenas.
+ *
+ * Once done the chain keeps running with the best placement, which is printed and written to RADARPROCESS_PLACEMENT_FILE
+ * through the CCS console (CIO). The application passes it as DPU_radarProcessConfig_t::placement for the
+ * configuration it was measured on. tools/radarProcess_placement_gen.sh writes the same header from a cost model on
+ * the host, for the configurations not measured yet.
+ */
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <source/utilities/radarOsal_malloc.h>
+#include <source/dpu/capon3d_overhead/include/radarProcess_internal.h>
+
+/* No heap tried yet for the buffer of the trial */
+#define RADARPROCESS_AUTOTUNE_NO_HEAP   (0xFFU)
+
+/* Alignment of the autotune state and of the save area */
+#define RADARPROCESS_AUTOTUNE_ALIGN     (8U)
+
+static const char *gRadarProcessAutotuneHeapName[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS] =
+{
+    "RADARMEMOSAL_HEAPTYPE_LL2", "RADARMEMOSAL_HEAPTYPE_DDR_CACHED", "RADARMEMOSAL_HEAPTYPE_LL1", "RADARMEMOSAL_HEAPTYPE_HSRAM"
+};
+
+static const char *gRadarProcessAutotuneBufName[RADARPROCESS_NUM_PLACED_BUFS] =
+{
+    "heatmap", "staticInfo", "rangeBinMax", "invRn", "cfarOutput", "tempHeatmap", "angleOutput"
+};
+
+/* Heap of a buffer of the plan in a placement, buffers without DPU_radarProcessBufId keep their heap */
+static uint8_t radarProcess_autotuneHeap(const radarProcessInstance_t *inst, const DPU_radarProcessPlacement *placement, uint32_t i)
+{
+    if (inst->planBufId[i] >= RADARPROCESS_NUM_PLACED_BUFS)
+        return inst->memPlan->buf[i].heapType;
+    return placement->heapType[inst->planBufId[i]];
+}
+
+/* Placement fits in the region sizes of budget, solves the plan in that placement */
+static int32_t radarProcess_autotuneFits(radarProcessInstance_t *inst, const DPU_radarProcessPlacement *placement,
+                                         const uint32_t *budget)
+{
+    radarOsal_memPlan *plan = inst->memPlan;
+    uint32_t i, heapType;
+
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        plan->buf[i].heapType = radarProcess_autotuneHeap(inst, placement, i);
+    }
+    radarOsal_memPlanSolve(plan);
+
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        if (plan->regionSize[heapType] > budget[heapType])
+            return 0;
+    }
+    return 1;
+}
+
+/* Moves the buffers to their offset in the arenas in the placement, keeping the data of the buffers used across frames */
+static void radarProcess_autotuneApply(radarProcessInstance_t *inst, const DPU_radarProcessPlacement *placement)
+{
+    radarOsal_memPlan    *plan = inst->memPlan;
+    radarProcessAutotune_t *at = inst->autotune;
+    radarOsal_memPlanBuf *buf;
+    uint32_t i, saveOffset;
+
+    saveOffset = 0;
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        if ((buf->stageMask == RADAROSAL_MEMPLAN_STAGE_ALL) && (at->saved[i]))
+        {
+            memcpy((void *)&at->save[saveOffset], *buf->ptr, buf->size);
+            saveOffset += (buf->size + RADARPROCESS_AUTOTUNE_ALIGN - 1U) & ~(RADARPROCESS_AUTOTUNE_ALIGN - 1U);
+        }
+    }
+
+    radarProcess_autotuneFits(inst, placement, at->budget);
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        if (buf->size == 0U)
+            *buf->ptr = NULL;
+        else
+            *buf->ptr = (void *)&at->arena[buf->heapType][buf->offset];
+    }
+
+    saveOffset = 0;
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        if ((buf->stageMask == RADAROSAL_MEMPLAN_STAGE_ALL) && (at->saved[i]))
+        {
+            memcpy(*buf->ptr, (void *)&at->save[saveOffset], buf->size);
+            saveOffset += (buf->size + RADARPROCESS_AUTOTUNE_ALIGN - 1U) & ~(RADARPROCESS_AUTOTUNE_ALIGN - 1U);
+        }
+        at->saved[i] = (*buf->ptr != NULL) ? 1U : 0U;
+    }
+    radarProcess_bindBuffers(inst);
+}
+
+/* Next trial from the best placement, 0 when all the moves are measured */
+static int32_t radarProcess_autotuneNext(radarProcessInstance_t *inst)
+{
+    radarProcessAutotune_t   *at = inst->autotune;
+    DPU_radarProcessPlacement candidate;
+
+    while (at->bufId < RADARPROCESS_NUM_PLACED_BUFS)
+    {
+        at->heapType = (at->heapType == RADARPROCESS_AUTOTUNE_NO_HEAP) ? 0U : (uint8_t)(at->heapType + 1U);
+        if (at->heapType >= (uint8_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS)
+        {
+            at->bufId++;
+            at->heapType = RADARPROCESS_AUTOTUNE_NO_HEAP;
+            continue;
+        }
+        if (at->heapType == at->best.heapType[at->bufId])
+            continue;
+
+        candidate                        = at->best;
+        candidate.heapType[at->bufId]    = at->heapType;
+        if (radarProcess_autotuneFits(inst, &candidate, at->budget))
+        {
+            at->current = candidate;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Writes the best placement as a DPU_radarProcessPlacement initializer, to the console or to a file */
+static void radarProcess_autotuneWrite(radarProcessInstance_t *inst, FILE *fp)
+{
+    radarProcessAutotune_t *at = inst->autotune;
+    int32_t numStaticAngleBin = inst->staticProcEnabled ? inst->numStaticAngleBin : 0;
+    uint32_t bufId;
+
+    fprintf(fp, "/* radarProcess placement, best of %d placements, cycles per frame: */\n", at->numTrials);
+    fprintf(fp, "/*   dynamic heatmap %u, CFAR %u, angle %u, static heatmap %u, CFAR %u, angle %u */\n",
+            (uint32_t)(at->bestStageCycles[RADARPROCESS_STAGE_DYN_HEATMAP] / at->framesPerTrial),
+            (uint32_t)(at->bestStageCycles[RADARPROCESS_STAGE_DYN_CFAR] / at->framesPerTrial),
+            (uint32_t)(at->bestStageCycles[RADARPROCESS_STAGE_DYN_ANGLE] / at->framesPerTrial),
+            (uint32_t)(at->bestStageCycles[RADARPROCESS_STAGE_STATIC_HEATMAP] / at->framesPerTrial),
+            (uint32_t)(at->bestStageCycles[RADARPROCESS_STAGE_STATIC_CFAR] / at->framesPerTrial),
+            (uint32_t)(at->bestStageCycles[RADARPROCESS_STAGE_STATIC_ANGLE] / at->framesPerTrial));
+    fprintf(fp, "#define RADARPROCESS_PLACEMENT_%d_%d_%d_%d \\\n{{ \\\n", inst->nRxAnt, inst->numRangeBins,
+            inst->numDynAngleBin, numStaticAngleBin);
+    for (bufId = 0; bufId < RADARPROCESS_NUM_PLACED_BUFS; bufId++)
+    {
+        fprintf(fp, "    %s%s /* %s */ \\\n", gRadarProcessAutotuneHeapName[at->best.heapType[bufId]],
+                (bufId + 1U < RADARPROCESS_NUM_PLACED_BUFS) ? "," : "", gRadarProcessAutotuneBufName[bufId]);
+    }
+    fprintf(fp, "}}\n");
+}
+
+/* Prints the best placement and writes it to RADARPROCESS_PLACEMENT_FILE */
+static void radarProcess_autotunePrint(radarProcessInstance_t *inst)
+{
+    char  fileName[64];
+    FILE *fp;
+
+    radarProcess_autotuneWrite(inst, stdout);
+
+    snprintf(fileName, sizeof(fileName), RADARPROCESS_PLACEMENT_FILE, inst->nRxAnt, inst->numRangeBins,
+             inst->numDynAngleBin, inst->staticProcEnabled ? inst->numStaticAngleBin : 0);
+    fp = fopen(fileName, "w");
+    if (fp != NULL)
+    {
+        radarProcess_autotuneWrite(inst, fp);
+        fclose(fp);
+        printf("radarProcess placement written to %s\n", fileName);
+    }
+    else
+    {
+        printf("radarProcess placement: cannot open %s\n", fileName);
+    }
+
+#ifdef RADAROSAL_MEMPLAN_DEBUG
+    radarOsal_memPlanSolve(inst->memPlan);
+    radarOsal_memPlanPrint(inst->memPlan, "RADARPROCESS");
+    radarOsal_memPlanWriteHeader(inst->memPlan, "RADARPROCESS", RADARPROCESS_MEMLAYOUT_FILE);
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Allocates the arenas of the plan and moves the buffers to the placement of the instance. Falls back to
+ *      radarOsal_memPlanAlloc() if the placement does not fit in the arenas.
+ *
+ *  @param[in]  inst                    radarProcess instance, with its plan declared and its placement resolved.
+ *  @param[in]  framesPerTrial          Frames measured per placement.
+ *
+ *  @retval
+ *      Success     =0
+ *  @retval
+ *      Error       <0
+ */
+int32_t radarProcess_autotuneInit(radarProcessInstance_t *inst, uint16_t framesPerTrial)
+{
+    radarOsal_memPlan      *plan = inst->memPlan;
+    radarProcessAutotune_t *at;
+    radarOsal_memPlanBuf   *buf;
+    uint32_t maxSize[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS];
+    uint32_t budget[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS];
+    uint16_t alignment;
+    uint32_t i, heapType, saveSize, stateSize;
+
+    /* Largest region of each heap: all the buffers that may be placed in it, without sharing */
+    alignment = 1;
+    saveSize  = 0;
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        maxSize[heapType] = 0;
+    }
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        if (buf->alignment > alignment)
+            alignment = buf->alignment;
+        for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+        {
+            if ((inst->planBufId[i] < RADARPROCESS_NUM_PLACED_BUFS) || (heapType == buf->heapType))
+                maxSize[heapType] += buf->size + buf->alignment;
+        }
+        if (buf->stageMask == RADAROSAL_MEMPLAN_STAGE_ALL)
+            saveSize += (buf->size + RADARPROCESS_AUTOTUNE_ALIGN - 1U) & ~(RADARPROCESS_AUTOTUNE_ALIGN - 1U);
+    }
+
+    /* Arenas: the capacity the plan gets without autotune, up to the largest region, less the autotune state in DDR */
+    stateSize = sizeof(radarProcessAutotune_t) + saveSize + 2U * RADARPROCESS_AUTOTUNE_ALIGN;
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        budget[heapType] = radarOsal_memAvail((uint8_t)heapType, alignment);
+        if (heapType == (uint32_t)RADARMEMOSAL_HEAPTYPE_DDR_CACHED)
+            budget[heapType] = (budget[heapType] > stateSize) ? (budget[heapType] - stateSize) : 0U;
+        if (budget[heapType] > maxSize[heapType])
+            budget[heapType] = maxSize[heapType];
+    }
+
+    /* a failed radarOsal_memAlloc() leaves the heap unusable, nothing is allocated before the placement is known to fit */
+    if ((budget[RADARMEMOSAL_HEAPTYPE_DDR_CACHED] == 0U) || !radarProcess_autotuneFits(inst, &inst->placement, budget))
+    {
+        printf("radarProcess autotune: disabled, the placement does not fit in the heaps with the autotune state\n");
+        return radarOsal_memPlanAlloc(plan);
+    }
+
+    at = (radarProcessAutotune_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, sizeof(radarProcessAutotune_t), RADARPROCESS_AUTOTUNE_ALIGN);
+    memset((void *)at, 0, sizeof(radarProcessAutotune_t));
+    at->save = (int8_t *)radarOsal_memAlloc(RADARMEMOSAL_HEAPTYPE_DDR_CACHED, 0, saveSize, RADARPROCESS_AUTOTUNE_ALIGN);
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        at->budget[heapType] = budget[heapType];
+        if (budget[heapType] != 0U)
+            at->arena[heapType] = (int8_t *)radarOsal_memAlloc((uint8_t)heapType, 0, budget[heapType], alignment);
+        plan->regionAddr[heapType] = at->arena[heapType];
+    }
+
+    at->framesPerTrial = framesPerTrial;
+    at->bufId          = 0;
+    at->heapType       = RADARPROCESS_AUTOTUNE_NO_HEAP;
+    at->current        = inst->placement;
+    at->best           = inst->placement;
+    inst->autotune     = at;
+    radarProcess_autotuneApply(inst, &at->current);
+    printf("radarProcess autotune: %d frames per placement\n", framesPerTrial);
+
+    return 0;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Accumulates the stage cycles of a frame and moves to the next placement once the current one is measured.
+ *      Called between frames.
+ *
+ *  @param[in]  inst                    radarProcess instance.
+ *  @param[in]  benchmark               Stage cycles of the frame.
+ */
+void radarProcess_autotuneFrame(radarProcessInstance_t *inst, DPIF_MSS_DSS_radarProcessBenchmarkElem *benchmark)
+{
+    radarProcessAutotune_t *at = inst->autotune;
+    uint64_t totalCycles;
+    uint32_t stage;
+
+    if (at->done)
+        return;
+
+    /* First frame after a move runs on cold caches */
+    at->frameCnt++;
+    if (at->frameCnt == 1U)
+        return;
+
+    at->stageCycles[RADARPROCESS_STAGE_DYN_HEATMAP]    += benchmark->dynHeatmpGenCycles;
+    at->stageCycles[RADARPROCESS_STAGE_DYN_CFAR]       += benchmark->dynCfarDetectionCycles;
+    at->stageCycles[RADARPROCESS_STAGE_DYN_ANGLE]      += benchmark->dynAngleDopEstCycles;
+    if (inst->staticProcEnabled)
+    {
+        at->stageCycles[RADARPROCESS_STAGE_STATIC_HEATMAP] += benchmark->staticHeatmpGenCycles;
+        at->stageCycles[RADARPROCESS_STAGE_STATIC_CFAR]    += benchmark->staticCfarDetectionCycles;
+        at->stageCycles[RADARPROCESS_STAGE_STATIC_ANGLE]   += benchmark->staticAngleEstCycles;
+    }
+    if (at->frameCnt <= at->framesPerTrial)
+        return;
+
+    totalCycles = 0;
+    for (stage = 0; stage < RADARPROCESS_STAGE_NUM; stage++)
+    {
+        totalCycles += at->stageCycles[stage];
+    }
+    if (at->numTrials == 0U)
+        printf("radarProcess autotune: initial placement, %u cycles per frame\n", (uint32_t)(totalCycles / at->framesPerTrial));
+    else
+        printf("radarProcess autotune: %s in %s, %u cycles per frame\n", gRadarProcessAutotuneBufName[at->bufId],
+               gRadarProcessAutotuneHeapName[at->heapType], (uint32_t)(totalCycles / at->framesPerTrial));
+
+    if ((at->numTrials == 0U) || (totalCycles < at->bestCycles))
+    {
+        at->best       = at->current;
+        at->bestCycles = totalCycles;
+        memcpy((void *)at->bestStageCycles, (void *)at->stageCycles, sizeof(at->stageCycles));
+    }
+    at->numTrials++;
+    at->frameCnt = 0;
+    memset((void *)at->stageCycles, 0, sizeof(at->stageCycles));
+
+    if (radarProcess_autotuneNext(inst))
+    {
+        radarProcess_autotuneApply(inst, &at->current);
+    }
+    else
+    {
+        at->done    = 1;
+        at->current = at->best;
+        radarProcess_autotuneApply(inst, &at->best);
+        radarProcess_autotunePrint(inst);
+    }
+}
@@ -0,0 +1,288 @@
+/**
+ *   @file  radarProcess_detOrder_host_check.c
+ *
+ *   @brief
+ *      Host check of the range bin sort of the CFAR detections and of the restore of the point cloud to CFAR order.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: radarProcess_detOrder_host_check [numLists]
+ *
+ *  Runs radarProcess_sortDetByRangeBin() and radarProcess_restoreDetOrder() of ../src/radarProcess.c, extracted by
+ *  the script of the same name, on numLists (default 20000) random detection lists: up to
+ *  MAX_RESOLVED_OBJECTS_PER_FRAME detections on 8 to 256 range bins, 0 to 9 points per detection. The angle
+ *  stage is emulated as DPU_radarProcess_process() runs it: detections in sorted order, points written to
+ *  anglePoints until it is full, then restored to the point cloud. Each point is tagged with its detection and
+ *  rank, the output is compared with the one of the CFAR order loop before the sort.
+ *
+ *  Half of the lists run the dynamic stage (output capacity DOA_OUTPUT_MAXPOINTS, the size of anglePoints), the
+ *  other half the static stage (output capacity the room left by the dynamic points, at most MAX_STATIC_CFAR_PNTS
+ *  detections).
+ *
+ *  The exit status is 0 if the sort is a stable permutation by range bin, the SNRs follow their points, and the
+ *  output equals the one of the CFAR order loop when all the points fit in anglePoints. Otherwise the points kept
+ *  are the first DOA_OUTPUT_MAXPOINTS ones in range bin order, in the CFAR order of their detections: the output
+ *  must equal that, and the number of lists whose output then differs from the CFAR order loop is printed.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <source/dpu/capon3d_overhead/include/radarProcess_internal.h>
+
+/* radarProcess_sortDetByRangeBin() and radarProcess_restoreDetOrder(), extracted from ../src/radarProcess.c */
+#include "radarProcess_detOrder_extract.c"
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+#define CHECK_MAX_RANGE_BINS            (256)
+#define CHECK_MAX_PNTS_PER_DET          (9)
+
+/**************************************************************************
+ ************************** Global Variables ******************************
+ **************************************************************************/
+
+static uint16_t                 gCheckRangeInd[MAX_RESOLVED_OBJECTS_PER_FRAME];
+static uint16_t                 gCheckNumPnts[MAX_RESOLVED_OBJECTS_PER_FRAME];
+static uint16_t                 gCheckDetOrder[MAX_RESOLVED_OBJECTS_PER_FRAME];
+static uint16_t                 gCheckHist[CHECK_MAX_RANGE_BINS + 1];
+static uint16_t                 gCheckOutStart[MAX_RESOLVED_OBJECTS_PER_FRAME];
+static uint16_t                 gCheckOutNum[MAX_RESOLVED_OBJECTS_PER_FRAME];
+static DPIF_PointCloudSpherical gCheckAnglePoints[DOA_OUTPUT_MAXPOINTS];
+static DPIF_PointCloudSideInfo  gCheckAngleSnr[DOA_OUTPUT_MAXPOINTS];
+static DPIF_PointCloudSpherical gCheckPoints[DOA_OUTPUT_MAXPOINTS];
+static DPIF_PointCloudSideInfo  gCheckSnr[DOA_OUTPUT_MAXPOINTS];
+static DPIF_PointCloudSpherical gCheckRefPoints[DOA_OUTPUT_MAXPOINTS];
+
+/**************************************************************************
+ ************************** Check *****************************************
+ **************************************************************************/
+
+/* Point rank of detection detIdx: detection in range, rank in azimuthAngle, detection again in the SNR */
+static void Check_writePoint(DPIF_PointCloudSpherical *point, DPIF_PointCloudSideInfo *snr, int32_t detIdx, int32_t rank)
+{
+    point->range        = (float)detIdx;
+    point->azimuthAngle = (float)rank;
+    point->elevAngle    = 0.f;
+    point->velocity     = 0.f;
+    if (snr != NULL)
+        snr->snr        = (int16_t)detIdx;
+}
+
+/* Angle stage of DPU_radarProcess_process(): detections in sorted order, points to anglePoints until it is full,
+   then restored to CFAR order up to maxNumPnts points */
+static int32_t Check_angleStage(radarProcessInstance_t *inst, int32_t maxNumPnts)
+{
+    int32_t sortIdx, detIdx, k, numPnts = 0;
+
+    radarProcess_sortDetByRangeBin(inst);
+    memset(inst->detOutNum, 0, inst->detectionCFAROutput->numObjDetected * sizeof(uint16_t));
+    for (sortIdx = 0; (sortIdx < (int32_t)inst->detectionCFAROutput->numObjDetected) && (numPnts < DOA_OUTPUT_MAXPOINTS); sortIdx++)
+    {
+        detIdx = inst->detOrder[sortIdx];
+        inst->detOutStart[detIdx] = (uint16_t)numPnts;
+        for (k = 0; (k < gCheckNumPnts[detIdx]) && (numPnts < DOA_OUTPUT_MAXPOINTS); k++)
+        {
+            Check_writePoint(&inst->anglePoints[numPnts], &inst->angleSnr[numPnts], detIdx, k);
+            numPnts++;
+        }
+        inst->detOutNum[detIdx] = (uint16_t)(numPnts - inst->detOutStart[detIdx]);
+    }
+    return radarProcess_restoreDetOrder(inst, gCheckPoints, gCheckSnr, maxNumPnts);
+}
+
+/* CFAR order loop before the sort */
+static int32_t Check_angleStageRef(int32_t numDet, int32_t maxNumPnts)
+{
+    int32_t detIdx, k, numPnts = 0;
+
+    for (detIdx = 0; (detIdx < numDet) && (numPnts < maxNumPnts); detIdx++)
+    {
+        for (k = 0; (k < gCheckNumPnts[detIdx]) && (numPnts < maxNumPnts); k++)
+        {
+            Check_writePoint(&gCheckRefPoints[numPnts], NULL, detIdx, k);
+            numPnts++;
+        }
+    }
+    return numPnts;
+}
+
+/* Sort: permutation of the detections, range bins in increasing order, CFAR order within a range bin */
+static int32_t Check_sort(const radarProcessInstance_t *inst)
+{
+    static uint8_t seen[MAX_RESOLVED_OBJECTS_PER_FRAME];
+    int32_t        numDet = inst->detectionCFAROutput->numObjDetected, i, cur, prev;
+
+    memset(seen, 0, sizeof(seen));
+    for (i = 0; i < numDet; i++)
+    {
+        cur = inst->detOrder[i];
+        if ((cur >= numDet) || seen[cur])
+            return 0;
+        seen[cur] = 1;
+        if (i > 0)
+        {
+            prev = inst->detOrder[i - 1];
+            if ((gCheckRangeInd[prev] > gCheckRangeInd[cur]) || ((gCheckRangeInd[prev] == gCheckRangeInd[cur]) && (prev > cur)))
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/* Output when the points do not fit in anglePoints: the first DOA_OUTPUT_MAXPOINTS points in range bin order, in
+   the CFAR order of their detections, up to maxNumPnts points */
+static int32_t Check_angleStageOverflowRef(int32_t numDet, int32_t numRangeBins, int32_t maxNumPnts)
+{
+    static uint16_t kept[MAX_RESOLVED_OBJECTS_PER_FRAME];
+    int32_t         rangeIdx, detIdx, k, num, numPnts = 0;
+
+    for (rangeIdx = 0; rangeIdx < numRangeBins; rangeIdx++)
+    {
+        for (detIdx = 0; detIdx < numDet; detIdx++)
+        {
+            if (gCheckRangeInd[detIdx] != rangeIdx)
+                continue;
+            num = gCheckNumPnts[detIdx];
+            if (num > DOA_OUTPUT_MAXPOINTS - numPnts)
+                num = DOA_OUTPUT_MAXPOINTS - numPnts;
+            kept[detIdx] = (uint16_t)num;
+            numPnts     += num;
+        }
+    }
+    numPnts = 0;
+    for (detIdx = 0; (detIdx < numDet) && (numPnts < maxNumPnts); detIdx++)
+    {
+        for (k = 0; (k < kept[detIdx]) && (numPnts < maxNumPnts); k++)
+        {
+            Check_writePoint(&gCheckRefPoints[numPnts], NULL, detIdx, k);
+            numPnts++;
+        }
+    }
+    return numPnts;
+}
+
+int main(int argc, char *argv[])
+{
+    static radarProcessInstance_t  inst;
+    RADARDEMO_detectionCFAR_output det;
+    int32_t  numLists = 20000, list, numDet, maxNumDet, maxNumPnts, totalPnts, numPnts, numRef, i, staticStage;
+    long     numFailed = 0, numOverflow = 0, numOverflowDiff = 0, numMaxPnts = 0;
+
+    if (argc > 1)
+        numLists = atoi(argv[1]);
+    srand(1);
+
+    memset(&det, 0, sizeof(det));
+    det.rangeInd             = gCheckRangeInd;
+    inst.detectionCFAROutput = &det;
+    inst.detOrder            = gCheckDetOrder;
+    inst.detRangeBinHist     = gCheckHist;
+    inst.detOutStart         = gCheckOutStart;
+    inst.detOutNum           = gCheckOutNum;
+    inst.anglePoints         = gCheckAnglePoints;
+    inst.angleSnr            = gCheckAngleSnr;
+
+    for (list = 0; list < numLists; list++)
+    {
+        staticStage       = list & 1;
+        inst.numRangeBins = 8 + rand() % (CHECK_MAX_RANGE_BINS - 7);
+        maxNumDet         = staticStage ? MAX_STATIC_CFAR_PNTS : MAX_RESOLVED_OBJECTS_PER_FRAME;
+        /* short lists, as on most frames, and full ones */
+        numDet            = (rand() & 1) ? rand() % 64 : rand() % (maxNumDet + 1);
+        maxNumPnts        = staticStage ? 1 + rand() % DOA_OUTPUT_MAXPOINTS : DOA_OUTPUT_MAXPOINTS;
+        det.numObjDetected = (uint16_t)numDet;
+        totalPnts         = 0;
+        for (i = 0; i < numDet; i++)
+        {
+            gCheckRangeInd[i] = (uint16_t)(rand() % inst.numRangeBins);
+            gCheckNumPnts[i]  = (uint16_t)(rand() % (CHECK_MAX_PNTS_PER_DET + 1));
+            totalPnts        += gCheckNumPnts[i];
+        }
+
+        numPnts = Check_angleStage(&inst, maxNumPnts);
+        if (totalPnts <= DOA_OUTPUT_MAXPOINTS)
+        {
+            numRef = Check_angleStageRef(numDet, maxNumPnts);
+            if (totalPnts > maxNumPnts)
+                numMaxPnts++;
+        }
+        else
+        {
+            numOverflow++;
+            numRef = Check_angleStageRef(numDet, maxNumPnts);
+            if ((numPnts != numRef) || memcmp(gCheckPoints, gCheckRefPoints, numPnts * sizeof(DPIF_PointCloudSpherical)))
+                numOverflowDiff++;
+            numRef = Check_angleStageOverflowRef(numDet, inst.numRangeBins, maxNumPnts);
+        }
+        if (!Check_sort(&inst))
+        {
+            if (numFailed == 0)
+                printf("list %d: sort by range bin wrong\n", list);
+            numFailed++;
+        }
+        if ((numPnts != numRef) || memcmp(gCheckPoints, gCheckRefPoints, numPnts * sizeof(DPIF_PointCloudSpherical)))
+        {
+            if (numFailed == 0)
+                printf("list %d: %d detections, %d points, output differs from the expected one\n", list, numDet, totalPnts);
+            numFailed++;
+        }
+        for (i = 0; i < numPnts; i++)
+        {
+            if (gCheckSnr[i].snr != (int16_t)gCheckPoints[i].range)
+            {
+                if (numFailed == 0)
+                    printf("list %d: SNR %d not restored with its point\n", list, i);
+                numFailed++;
+                break;
+            }
+        }
+    }
+
+    printf("%d detection lists, %ld truncated to the output capacity in CFAR order\n", numLists, numMaxPnts);
+    printf("%ld lists over the %d points of anglePoints, %ld of them keep other detections than the CFAR order loop\n",
+           numOverflow, DOA_OUTPUT_MAXPOINTS, numOverflowDiff);
+    printf("%s: %ld failed checks\n", (numFailed == 0) ? "PASS" : "FAIL", numFailed);
+    return (numFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the check of the range bin sort of the CFAR detections and of the restore to CFAR order on the host
+#
+#   radarProcess_detOrder_host_check.sh [numLists]
+#
+# radarProcess_sortDetByRangeBin() and radarProcess_restoreDetOrder() are extracted from ../src/radarProcess.c, so
+# the check runs the code of the DPU. The radarProcess headers need SDK headers that are not in the tree, BUILD_DIR
+# gets stubs with the types they use.
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./radarProcess_detOrder_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+DPU_DIR="$TOOLS_DIR/.."
+DSS_DIR="$TOOLS_DIR/../../../.."
+BUILD_DIR=${BUILD_DIR:-./radarProcess_detOrder_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR/stub/common" "$BUILD_DIR/stub/datapath/dpif" "$BUILD_DIR/stub/drivers/hw_include"
+for f in c6x.h common/mmwave_error.h common/sys_types.h datapath/dpif/dpif_detmatrix.h datapath/dpif/dpif_radarcube.h \
+         drivers/soc.h drivers/hw_include/hw_types.h drivers/hw_include/csl_complex_math_types.h; do
+    : > "$BUILD_DIR/stub/$f"
+done
+cat > "$BUILD_DIR/stub/common/syscommon.h" << 'STUB'
+#pragma once
+#define SYS_COMMON_NUM_TX_ANTENNAS 4
+#define SYS_COMMON_NUM_RX_CHANNEL 4
+STUB
+cat > "$BUILD_DIR/stub/datapath/dpif/dpif_pointcloud.h" << 'STUB'
+#pragma once
+typedef struct { float range; float azimuthAngle; float elevAngle; float velocity; } DPIF_PointCloudSpherical;
+typedef struct { int16_t snr; int16_t noise; } DPIF_PointCloudSideInfo;
+typedef struct { uint32_t datafmt; void *data; uint32_t dataSize; } DPIF_RadarCube;
+STUB
+
+awk '/^static void radarProcess_sortDetByRangeBin\(/ { p = 1 }
+     p { print }
+     p && /^}/ { n++; if (n == 2) exit }' "$DPU_DIR/src/radarProcess.c" > "$BUILD_DIR/radarProcess_detOrder_extract.c"
+grep -q "^static int32_t radarProcess_restoreDetOrder(" "$BUILD_DIR/radarProcess_detOrder_extract.c"
+
+BUILD_DIR=$(cd "$BUILD_DIR" && pwd)
+$CC -O2 -Wall -Werror -std=gnu99 -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 \
+    -include "$DPU_DIR/modules/utilities/tools/radar_c66x_host_shim.h" -I "$DSS_DIR" -I "$DSS_DIR/.." -I "$BUILD_DIR/stub" \
+    -I "$BUILD_DIR" -o "$BUILD_DIR/radarProcess_detOrder_host_check" "$TOOLS_DIR/radarProcess_detOrder_host_check.c"
+"$BUILD_DIR/radarProcess_detOrder_host_check" "$@"
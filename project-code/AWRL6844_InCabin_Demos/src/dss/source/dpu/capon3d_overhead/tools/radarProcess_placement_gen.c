@@ -0,0 +1,402 @@
+/**
+ *   @file  radarProcess_placement_gen.c
+ *
+ *   @brief
+ *      Host run of the radarProcess autotune mode on an access cost model, writes the placement header of a
+ *      configuration.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: radarProcess_placement_gen numAntenna numRangeBins numAzimBins numElevBins maxNumAngleEst numDet
+ *                                    [LL2 DDR LL1 HSRAM]
+ *
+ *  Declares the radarProcess memory plan of a configuration as DPU_radarProcess_init() does (dynamic chain,
+ *  detectionMethod 2, dopplerEstMethod 0, static processing off), and runs radarProcess_autotuneInit() and
+ *  radarProcess_autotuneFrame() of ../src/radarProcess_autotune.c on it. The stage cycles of a frame come from a
+ *  model instead of the benchmark harness: each buffer group is charged its bytes accessed per frame, with numDet
+ *  detections, times the cost per byte of its tier. The autotune writes RADARPROCESS_PLACEMENT_FILE in the working
+ *  directory.
+ *
+ *  The heaps the plan gets are the regions of the default placement, which the shipped build is known to fit in,
+ *  unless their sizes are given: the placements found then fit wherever the default one does. radarOsal_printHeapStats()
+ *  on the target gives the capacity actually left to the plan.
+ *
+ *  Every frame, the buffers live in each stage are overwritten stage by stage, as the chain does, and the buffers
+ *  holding data across frames are checked against the pattern written at init: a move or a shared layout corrupting
+ *  them fails the run. The plan is checked with radarOsal_memPlanVerify() and every buffer must be inside the arena
+ *  of its heap. The exit status is 0 if all checks pass.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <source/dpu/capon3d_overhead/include/radarProcess_internal.h>
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+/* Frames measured per placement */
+#define GEN_FRAMES_PER_TRIAL            (2U)
+
+/* Largest host heap */
+#define GEN_HEAP_SIZE                   (0x40000U)
+
+/* Modeled cost per 8 bytes accessed, in cycles, per radarMemOsal_HeapType: LL2, DDR cached, LL1, HSRAM. Relative
+   costs of the tiers for streamed accesses, not a measurement */
+static const uint32_t gGenTierCost[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS] = { 2U, 6U, 1U, 3U };
+
+static const char *gGenHeapName[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS] = { "LL2", "DDR_CACHED", "LL1", "HSRAM" };
+
+/**************************************************************************
+ ************************** Global Variables ******************************
+ **************************************************************************/
+
+/* Host heaps for radarOsal_memAvail() and radarOsal_memAlloc() */
+static int8_t   gGenHeap[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS][GEN_HEAP_SIZE] __attribute__((aligned(64)));
+static uint32_t gGenHeapSize[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS];
+static uint32_t gGenHeapOffset[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS];
+
+/* Buffer pointers written by the plan, in order of declaration */
+static void    *gGenPtr[RADAROSAL_MEMPLAN_MAX_NUM_BUFS];
+
+/* Bytes accessed per frame and per stage of each placed buffer group, the cost model */
+static uint32_t gGenAccess[RADARPROCESS_NUM_PLACED_BUFS][RADARPROCESS_STAGE_NUM];
+
+static uint32_t gGenFailed;
+static uint32_t gGenNumBind;
+
+/**************************************************************************
+ ************************** Host heaps ************************************
+ **************************************************************************/
+
+static uint32_t Gen_alignUp(uint32_t offset, uint16_t alignment)
+{
+    return (offset + alignment - 1U) & ~((uint32_t)alignment - 1U);
+}
+
+void *radarOsal_memAlloc(uint8_t memoryType, uint8_t scratchFlag, uint32_t size, uint16_t alignment)
+{
+    uint32_t offset;
+
+    if (alignment == 0U)
+        alignment = 1U;
+    offset = Gen_alignUp(gGenHeapOffset[memoryType], alignment);
+    if (offset + size > gGenHeapSize[memoryType])
+        return NULL;
+    gGenHeapOffset[memoryType] = offset + size;
+    return (void *)&gGenHeap[memoryType][offset];
+}
+
+uint32_t radarOsal_memAvail(uint8_t memoryType, uint16_t alignment)
+{
+    uint32_t offset;
+
+    if (alignment == 0U)
+        alignment = 1U;
+    offset = Gen_alignUp(gGenHeapOffset[memoryType], alignment);
+    return (offset < gGenHeapSize[memoryType]) ? (gGenHeapSize[memoryType] - offset) : 0U;
+}
+
+/**************************************************************************
+ ************************** Plan of the chain *****************************
+ **************************************************************************/
+
+/* Default tier of the placed buffers, as gRadarProcessDefaultHeapType of radarProcess.c */
+static const uint8_t gGenDefaultHeapType[RADARPROCESS_NUM_PLACED_BUFS] =
+{
+    RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED, RADARMEMOSAL_HEAPTYPE_LL1, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+    RADARMEMOSAL_HEAPTYPE_DDR_CACHED, RADARMEMOSAL_HEAPTYPE_LL1, RADARMEMOSAL_HEAPTYPE_LL1
+};
+
+static void Gen_planAdd(radarProcessInstance_t *inst, uint8_t bufId, const char *name, uint32_t size, uint16_t alignment,
+                        uint32_t stageMask)
+{
+    int32_t idx;
+    uint8_t heapType = (bufId < RADARPROCESS_NUM_PLACED_BUFS) ? gGenDefaultHeapType[bufId] : RADARMEMOSAL_HEAPTYPE_LL1;
+
+    idx = radarOsal_memPlanAdd(inst->memPlan, name, &gGenPtr[inst->memPlan->numBufs], heapType,
+                               RADAROSAL_MEMPLAN_NO_FALLBACK, size, alignment, stageMask);
+    if (idx >= 0)
+        inst->planBufId[idx] = bufId;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function declares the buffers of the radarProcess plan, with the sizes and stages of
+ *      DPU_radarProcess_init(), and the bytes each buffer group accesses per frame.
+ *
+ *  @param[in]  inst                    Instance, with its plan initialized.
+ *  @param[in]  maxNumAngleEst          Angle estimates per detection, (2 peakExpSamples + 1)^2. The angle outputs
+ *                                      hold RADARDEMO_AOAEST2D_DOPBATCH_MAXDET detections, the Doppler batch of the zoom-in.
+ *  @param[in]  numDet                  Detections per frame of the cost model.
+ *
+ *  @retval
+ *      None
+ */
+static void Gen_declarePlan(radarProcessInstance_t *inst, uint32_t maxNumAngleEst, uint32_t numDet)
+{
+    uint32_t numRangeBins = (uint32_t)inst->numRangeBins;
+    uint32_t numAngleBins = (uint32_t)inst->numDynAngleBin;
+    uint32_t nRxAnt       = (uint32_t)inst->nRxAnt;
+    uint32_t maxNumDetObj = MAX_RESOLVED_OBJECTS_PER_FRAME;
+    uint32_t heatmapSize  = numRangeBins * numAngleBins * sizeof(float);
+    uint32_t invRnSize    = numRangeBins * (nRxAnt >> 1) * (nRxAnt + 1U) * sizeof(cplxf_t);
+    uint32_t numDetBins   = (numDet < numRangeBins) ? numDet : numRangeBins;
+    uint32_t angleBytes   = maxNumAngleEst * (3U * sizeof(float) + nRxAnt * sizeof(cplxf_t) + sizeof(uint16_t));
+    uint32_t numAngleOut  = maxNumAngleEst * RADARDEMO_AOAEST2D_DOPBATCH_MAXDET;
+
+    Gen_planAdd(inst, RADARPROCESS_BUF_RANGE_BIN_MAX, "perRangeBinMax", numRangeBins * sizeof(float), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+    Gen_planAdd(inst, RADARPROCESS_BUF_HEATMAP, "localHeatmap", heatmapSize, 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+    Gen_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "azimEst", numAngleOut * sizeof(float), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "elevEst", numAngleOut * sizeof(float), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "peakPow", numAngleOut * sizeof(float), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "bwFilter", numAngleOut * nRxAnt * sizeof(cplxf_t), 8, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_STATIC_INFO, "staticInformation", numRangeBins * nRxAnt * sizeof(cplxf_t), 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+    Gen_planAdd(inst, RADARPROCESS_BUF_INV_RN, "invRnMatrices", invRnSize, 8, RADARPROCESS_LIVE_DYNAMIC);
+    Gen_planAdd(inst, RADARPROCESS_BUF_ANGLE_OUTPUT, "dopplerIdx", numAngleOut * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarRangeInd", maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_DETECTION);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarDopplerInd", maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_DETECTION);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarSnrEst", maxNumDetObj * sizeof(float), 1, RADARPROCESS_LIVE_DETECTION);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "cfarNoise", maxNumDetObj * sizeof(float), 1, RADARPROCESS_LIVE_DETECTION);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detOrder", maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detRangeBinHist", (numRangeBins + 1U) * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detOutStart", maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "detOutNum", maxNumDetObj * sizeof(uint16_t), 1, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "anglePoints", DOA_OUTPUT_MAXPOINTS * sizeof(DPIF_PointCloudSpherical), 4, RADARPROCESS_LIVE_ANGLE);
+    Gen_planAdd(inst, RADARPROCESS_BUF_CFAR_OUTPUT, "angleSnr", DOA_OUTPUT_MAXPOINTS * sizeof(DPIF_PointCloudSideInfo), 4, RADARPROCESS_LIVE_ANGLE);
+    /* 20 bytes on the C66x, fixed in L1 */
+    Gen_planAdd(inst, RADARPROCESS_NUM_PLACED_BUFS, "cfarInput", 20U, 1, RADARPROCESS_LIVE_CFAR);
+    Gen_planAdd(inst, RADARPROCESS_BUF_TEMP_HEATMAP, "tempHeatMapOut", numAngleBins * sizeof(float), 8, RADARPROCESS_LIVE_HEATMAP);
+
+    /* Heatmap: written per range bin, read by the range and angle passes of the CFAR and by its sidelobe check */
+    gGenAccess[RADARPROCESS_BUF_HEATMAP][RADARPROCESS_STAGE_DYN_HEATMAP]     = heatmapSize;
+    gGenAccess[RADARPROCESS_BUF_HEATMAP][RADARPROCESS_STAGE_DYN_CFAR]        = 3U * heatmapSize;
+    /* Zero Doppler samples: read and updated once per range bin by the clutter removal */
+    gGenAccess[RADARPROCESS_BUF_STATIC_INFO][RADARPROCESS_STAGE_DYN_HEATMAP] = 2U * numRangeBins * nRxAnt * sizeof(cplxf_t);
+    /* Per range bin maximum: written with the heatmap, read per cell by the CFAR sidelobe check */
+    gGenAccess[RADARPROCESS_BUF_RANGE_BIN_MAX][RADARPROCESS_STAGE_DYN_HEATMAP] = numRangeBins * sizeof(float);
+    gGenAccess[RADARPROCESS_BUF_RANGE_BIN_MAX][RADARPROCESS_STAGE_DYN_CFAR]    = numAngleBins * numRangeBins * sizeof(float);
+    /* Inverse covariance: written per range bin, read once per range bin with detections */
+    gGenAccess[RADARPROCESS_BUF_INV_RN][RADARPROCESS_STAGE_DYN_HEATMAP]      = invRnSize;
+    gGenAccess[RADARPROCESS_BUF_INV_RN][RADARPROCESS_STAGE_DYN_ANGLE]        = numDetBins * (invRnSize / numRangeBins);
+    /* Detection list: written by the CFAR, sorted and read by the angle estimation, which writes the points */
+    gGenAccess[RADARPROCESS_BUF_CFAR_OUTPUT][RADARPROCESS_STAGE_DYN_CFAR]    = numDet * 12U;
+    gGenAccess[RADARPROCESS_BUF_CFAR_OUTPUT][RADARPROCESS_STAGE_DYN_ANGLE]   = numDet * (2U * 18U + 20U * maxNumAngleEst);
+    /* Heatmap of one range bin: each angle bin is written by the Capon loop and read by the transposition */
+    gGenAccess[RADARPROCESS_BUF_TEMP_HEATMAP][RADARPROCESS_STAGE_DYN_HEATMAP] = 2U * numRangeBins * numAngleBins * sizeof(float);
+    /* Angle estimates of a detection: written by the zoom-in, read by the point output */
+    gGenAccess[RADARPROCESS_BUF_ANGLE_OUTPUT][RADARPROCESS_STAGE_DYN_ANGLE]  = 2U * numDet * angleBytes;
+}
+
+/**************************************************************************
+ ************************** Checks ****************************************
+ **************************************************************************/
+
+/* Pattern of the buffers holding data across frames */
+static uint8_t Gen_pattern(uint32_t i, uint32_t j)
+{
+    return (uint8_t)(i * 37U + j * 11U + 1U);
+}
+
+/* Called by the autotune after each move */
+void radarProcess_bindBuffers(radarProcessInstance_t *inst)
+{
+    gGenNumBind++;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This function runs the stages of a frame on the buffers: each stage overwrites the buffers live in it, then
+ *      the buffers holding data across frames are checked against their pattern.
+ *
+ *  @param[in]  inst                    Instance, with its buffers placed.
+ *
+ *  @retval
+ *      Number of corrupted buffers
+ */
+static uint32_t Gen_runFrame(radarProcessInstance_t *inst)
+{
+    radarOsal_memPlan *plan = inst->memPlan;
+    radarOsal_memPlanBuf *buf;
+    uint32_t i, j, stage, numBad = 0;
+    int8_t  *region;
+
+    if (radarOsal_memPlanVerify(plan) != 0)
+        numBad++;
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf    = &plan->buf[i];
+        region = inst->autotune->arena[buf->heapType];
+        if ((buf->size != 0U) && ((region == NULL) || ((int8_t *)*buf->ptr != &region[buf->offset]) ||
+                                  (buf->offset + buf->size > inst->autotune->budget[buf->heapType])))
+            numBad++;
+    }
+
+    for (stage = 0; stage < RADARPROCESS_STAGE_NUM; stage++)
+    {
+        for (i = 0; i < plan->numBufs; i++)
+        {
+            buf = &plan->buf[i];
+            if ((buf->stageMask != RADAROSAL_MEMPLAN_STAGE_ALL) && (buf->stageMask & RADAROSAL_MEMPLAN_STAGE(stage)))
+                memset(*buf->ptr, (int)(0xA0U + i), buf->size);
+        }
+    }
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        if (buf->stageMask != RADAROSAL_MEMPLAN_STAGE_ALL)
+            continue;
+        for (j = 0; j < buf->size; j++)
+        {
+            if (((uint8_t *)*buf->ptr)[j] != Gen_pattern(i, j))
+            {
+                printf("%s corrupted at byte %u\n", buf->name, j);
+                numBad++;
+                break;
+            }
+        }
+    }
+    return numBad;
+}
+
+/* Modeled stage cycles of a frame in the current placement */
+static void Gen_frameCycles(radarProcessInstance_t *inst, DPIF_MSS_DSS_radarProcessBenchmarkElem *benchmark)
+{
+    uint32_t cycles[RADARPROCESS_STAGE_NUM];
+    uint32_t bufId, stage;
+
+    memset((void *)cycles, 0, sizeof(cycles));
+    for (bufId = 0; bufId < RADARPROCESS_NUM_PLACED_BUFS; bufId++)
+    {
+        for (stage = 0; stage < RADARPROCESS_STAGE_NUM; stage++)
+        {
+            cycles[stage] += (gGenAccess[bufId][stage] / 8U) * gGenTierCost[inst->autotune->current.heapType[bufId]];
+        }
+    }
+    memset((void *)benchmark, 0, sizeof(*benchmark));
+    benchmark->dynHeatmpGenCycles     = cycles[RADARPROCESS_STAGE_DYN_HEATMAP];
+    benchmark->dynCfarDetectionCycles = cycles[RADARPROCESS_STAGE_DYN_CFAR];
+    benchmark->dynAngleDopEstCycles   = cycles[RADARPROCESS_STAGE_DYN_ANGLE];
+}
+
+int main(int argc, char *argv[])
+{
+    static radarProcessInstance_t inst;
+    static radarOsal_memPlan plan;
+    DPIF_MSS_DSS_radarProcessBenchmarkElem benchmark;
+    uint32_t maxNumAngleEst, numDet, heapType, i, j, frame;
+
+    if ((argc != 7) && (argc != 11))
+    {
+        fprintf(stderr, "usage: %s numAntenna numRangeBins numAzimBins numElevBins maxNumAngleEst numDet [LL2 DDR LL1 HSRAM]\n", argv[0]);
+        return 2;
+    }
+    inst.nRxAnt         = atoi(argv[1]);
+    inst.numRangeBins   = atoi(argv[2]);
+    inst.numDynAngleBin = atoi(argv[3]) * atoi(argv[4]);
+    maxNumAngleEst      = (uint32_t)atoi(argv[5]);
+    numDet              = (uint32_t)atoi(argv[6]);
+    inst.memPlan        = &plan;
+    radarOsal_memPlanInit(&plan);
+    memset(inst.planBufId, RADARPROCESS_NUM_PLACED_BUFS, sizeof(inst.planBufId));
+    Gen_declarePlan(&inst, maxNumAngleEst, numDet);
+    for (i = 0; i < RADARPROCESS_NUM_PLACED_BUFS; i++)
+    {
+        inst.placement.heapType[i] = gGenDefaultHeapType[i];
+    }
+
+    /* Heaps: the regions of the default placement, or the given capacities, and the autotune state in DDR */
+    radarOsal_memPlanSolve(&plan);
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        gGenHeapSize[heapType] = (argc == 11) ? (uint32_t)strtoul(argv[7 + heapType], NULL, 0) : plan.regionSize[heapType];
+    }
+    gGenHeapSize[RADARMEMOSAL_HEAPTYPE_DDR_CACHED] += sizeof(radarProcessAutotune_t) + 64U;
+    for (i = 0; i < plan.numBufs; i++)
+    {
+        if (plan.buf[i].stageMask == RADAROSAL_MEMPLAN_STAGE_ALL)
+            gGenHeapSize[RADARMEMOSAL_HEAPTYPE_DDR_CACHED] += plan.buf[i].size + 8U;
+    }
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        if (gGenHeapSize[heapType] > GEN_HEAP_SIZE)
+        {
+            fprintf(stderr, "heap %u: %u bytes, the host heaps have %u\n", heapType, gGenHeapSize[heapType], GEN_HEAP_SIZE);
+            return 2;
+        }
+        printf("heap %-10s %6u bytes\n", gGenHeapName[heapType], gGenHeapSize[heapType]);
+    }
+
+    if ((radarProcess_autotuneInit(&inst, GEN_FRAMES_PER_TRIAL) != 0) || (inst.autotune == NULL))
+    {
+        printf("FAIL: autotune not started\n");
+        return 1;
+    }
+
+    /* The buffers holding data across frames get their pattern once, it must survive all the moves */
+    for (i = 0; i < plan.numBufs; i++)
+    {
+        if (plan.buf[i].stageMask != RADAROSAL_MEMPLAN_STAGE_ALL)
+            continue;
+        for (j = 0; j < plan.buf[i].size; j++)
+        {
+            ((uint8_t *)*plan.buf[i].ptr)[j] = Gen_pattern(i, j);
+        }
+    }
+
+    for (frame = 0; (frame < 1000U) && !inst.autotune->done; frame++)
+    {
+        gGenFailed += Gen_runFrame(&inst);
+        Gen_frameCycles(&inst, &benchmark);
+        radarProcess_autotuneFrame(&inst, &benchmark);
+    }
+    gGenFailed += Gen_runFrame(&inst);
+    if (!inst.autotune->done)
+        gGenFailed++;
+
+    printf("%u placements in %u frames, %u moves\n", inst.autotune->numTrials, frame, gGenNumBind);
+    printf("%s\n", (gGenFailed == 0U) ? "PASS" : "FAIL");
+    return (gGenFailed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Write the radarProcess placement header of a configuration from the host run of the autotune mode
+#
+#   radarProcess_placement_gen.sh [numAntenna numRangeBins numAzimBins numElevBins maxNumAngleEst numDet [LL2 DDR LL1 HSRAM]]
+#
+# Without arguments: the configuration of the CPD profiles of mss/source/mmw_cli.c (16 virtual antennas, 128 ADC
+# samples so 64 range bins, fovCfg 75 75 and searchStep 8 so 17 x 17 angle bins, zoom-in peakExpSamples 1 so 9 angle
+# estimates per detection), 32 detections per frame. The header is written to ../include, with the cost model named
+# in it: the header of an autotune run on the target replaces it.
+#
+# The radarProcess headers need SDK headers that are not in the tree, BUILD_DIR gets stubs with the types they use.
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./radarProcess_placement_gen_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+DPU_DIR="$TOOLS_DIR/.."
+DSS_DIR="$TOOLS_DIR/../../../.."
+BUILD_DIR=${BUILD_DIR:-./radarProcess_placement_gen_build}
+CC=${CC:-cc}
+
+if [ $# -eq 0 ]; then
+    set -- 16 64 17 17 9 32
+fi
+
+mkdir -p "$BUILD_DIR/stub/common" "$BUILD_DIR/stub/datapath/dpif" "$BUILD_DIR/stub/drivers/hw_include"
+for f in c6x.h common/mmwave_error.h common/sys_types.h datapath/dpif/dpif_detmatrix.h datapath/dpif/dpif_radarcube.h \
+         drivers/soc.h drivers/hw_include/hw_types.h drivers/hw_include/csl_complex_math_types.h; do
+    : > "$BUILD_DIR/stub/$f"
+done
+cat > "$BUILD_DIR/stub/common/syscommon.h" << 'STUB'
+#pragma once
+#define SYS_COMMON_NUM_TX_ANTENNAS 4
+#define SYS_COMMON_NUM_RX_CHANNEL 4
+STUB
+cat > "$BUILD_DIR/stub/datapath/dpif/dpif_pointcloud.h" << 'STUB'
+#pragma once
+typedef struct { float range; float azimuthAngle; float elevAngle; float velocity; } DPIF_PointCloudSpherical;
+typedef struct { int16_t snr; int16_t noise; } DPIF_PointCloudSideInfo;
+typedef struct { uint32_t datafmt; void *data; uint32_t dataSize; } DPIF_RadarCube;
+STUB
+
+BUILD_DIR=$(cd "$BUILD_DIR" && pwd)
+$CC -O2 -Wall -Werror -std=gnu99 -D_LITTLE_ENDIAN -D_TMS320C6X -D_TMS320C6600 \
+    -include "$DPU_DIR/modules/utilities/tools/radar_c66x_host_shim.h" -I "$DSS_DIR" -I "$DSS_DIR/.." -I "$BUILD_DIR/stub" \
+    -o "$BUILD_DIR/radarProcess_placement_gen" "$TOOLS_DIR/radarProcess_placement_gen.c" \
+    "$DPU_DIR/src/radarProcess_autotune.c" "$DSS_DIR/source/utilities/radarOsal_memPlan.c"
+(cd "$BUILD_DIR" && ./radarProcess_placement_gen "$@")
+
+NAME=radarProcess_placement_$1_$2_$(($3 * $4))_0
+GUARD=$(echo "$NAME" | tr 'a-z' 'A-Z')_H
+{
+    echo "/*"
+    sed -n '3,31p' "$0" | sed 's/^#/ */'
+    echo " */"
+    echo ""
+    echo "/* Placement of the radarProcess buffers for $1 antennas, $2 range bins, $3 x $4 angle bins, static processing off."
+    echo "   Written by tools/radarProcess_placement_gen.sh $*: the autotune mode run on the host with a cost model per"
+    echo "   tier (LL1 1, LL2 2, HSRAM 3, DDR 6 cycles per 8 bytes) and the bytes each buffer accesses per frame, in the"
+    echo "   heaps of the default placement. Not measured: replace with the header of an autotune run on the target. */"
+    echo ""
+    echo "#ifndef $GUARD"
+    echo "#define $GUARD"
+    echo ""
+    cat "$BUILD_DIR/$NAME.h"
+    echo ""
+    echo "#endif"
+} > "$DPU_DIR/include/$NAME.h"
+echo "written $DPU_DIR/include/$NAME.h"
@@ -63,6 +63,7 @@
 
 #include <source/mmwave_demo_dss.h>
 #include <source/dpc/objectdetection_dss.h>
+#include <source/dpu/capon3d_overhead/include/radarProcess_placement_16_64_289_0.h>
 
 
 
@@ -158,6 +159,10 @@ typedef struct MmwDemo_dss_Transition_t
     MmwDemo_dss_State nextState;
 } MmwDemo_dss_Transition;
 
+/* Buffer tiers of the Capon chain for the CPD profiles: 16 antennas, 64 range bins, 17 x 17 angle bins (fovCfg 75 75,
+   searchStep 8, range-azimuth-elevation detection), static processing off */
+static const DPU_radarProcessPlacement gMmwCaponPlacementCpd = RADARPROCESS_PLACEMENT_16_64_289_0;
+
 typedef struct  MmwDemo_Msg_t
 {
     uint32_t event;
@@ -221,6 +226,17 @@ void mmwave_parseInputConfiguration(DPC_DSS_ObjectDetection_PreStartCfg *out, DP
     out->dynCfg.caponChainCfg.exportCoarseHeatmap = in->exportCoarseHeatmap;
     out->dynCfg.caponChainCfg.exportRawCfarDetList = in->exportRawCfarDetList;
     out->dynCfg.caponChainCfg.exportZoomInHeatmap = in->exportZoomInHeatmap;
+    out->dynCfg.caponChainCfg.heatmapExportCfg = in->heatmapExportCfg;
+
+    /* Placement of the configuration if there is one, default buffer tiers otherwise */
+    out->dynCfg.caponChainCfg.placement = NULL;
+    if ((out->dynCfg.caponChainCfg.numAntenna == 16) && (in->numRangeBins == 64) && (in->rangeAngleCfg.detectionMethod == 2) &&
+        (in->rangeAngleCfg.searchStep == 8.f) && (in->fovCfg[0] == 75.f) && (in->fovCfg[1] == 75.f) &&
+        (in->staticEstCfg.staticProcEnabled == 0))
+        out->dynCfg.caponChainCfg.placement = &gMmwCaponPlacementCpd;
+#ifdef RADARPROCESS_AUTOTUNE
+    out->dynCfg.caponChainCfg.autotuneFramesPerTrial = RADARPROCESS_AUTOTUNE_FRAMES_PER_TRIAL;
+#endif
 }
 
 
@@ -237,13 +253,31 @@ void action_DPC_config(void * arg)
 
     gMmwDssMCB.numFrmPerSlidingWindow = dpifPreStartCfg->numFrmPerSlidingWindow;
 
+    /* Trace ring allocated and initialized by the MSS, NULL if tracing is disabled. The ring of the previous
+       configuration, usually at the same L3 address, may still be in the cache with its old writeCount: it is dropped
+       without write back, so the events of this configuration do not continue the old count, which the MSS reader
+       would report as lost events */
+    if (gDpcTraceRing != NULL)
+    {
+        CacheP_inv((void *)gDpcTraceRing, MSG_MBOX_CACHE_LINE_ROUND_UP(sizeof(DPC_Trace_Ring)), CacheP_TYPE_ALL);
+    }
+    gDpcTraceRing = dpifPreStartCfg->traceRing;
+    if (gDpcTraceRing != NULL)
+    {
+        CacheP_inv((void *)gDpcTraceRing, MSG_MBOX_CACHE_LINE_ROUND_UP(sizeof(DPC_Trace_Ring)), CacheP_TYPE_ALL);
+    }
+
     errorCode = DPC_ObjDetDSP_preStartConfig(&preStartCfg);
     if (errorCode != 0)
     {
         DebugP_assert(0);
     }
 
-    MsgIpc_sendMessage(&gMmwDssMCB.msgIpcCtrlObj, DPC_DSS_TO_MSS_CONFIGURATION_COMPLETED, NULL);
+    errorCode = MsgIpc_post(&gMmwDssMCB.msgIpcCtrlObj, DPC_DSS_TO_MSS_CONFIGURATION_COMPLETED, 0, NULL, 0);
+    if (errorCode != 0)
+    {
+        DebugP_assert(0);
+    }
     gMmwDssMCB.interSubFrameProcToken--;
     gMmwDssMCB.dssConfigurationCntr++;
 
@@ -252,10 +286,30 @@ void action_DPC_config(void * arg)
 }
 void action_DPC_exec(void *arg)
 {
+    int32_t errorCode;
+    MsgMbox_Buf buf;
+
+    DPC_TRACE_SET_FRAME(gMmwDssMCB.radarCubeReadyEventCntr);
+    DPC_TRACE_BEGIN(DPC_TRACE_ID_DSS_FRAME, 0);
 
     DPC_ObjectDetection_execute();
 
-    MsgIpc_sendMessage(&gMmwDssMCB.msgIpcCtrlObj, DPC_DSS_TO_MSS_POINT_CLOUD_READY, (uint32_t) gMmwDssMCB.outputFromDSP);
+    DPC_TRACE_END(DPC_TRACE_ID_DSS_FRAME, 0);
+    if (gDpcTraceRing != NULL)
+    {
+        /* Make the events of the frame visible to the MSS reader */
+        CacheP_wb((void *)gDpcTraceRing, sizeof(DPC_Trace_Ring), CacheP_TYPE_ALL);
+    }
+
+    buf.addr = (void *) gMmwDssMCB.outputFromDSP;
+    buf.size = sizeof(DPIF_MSS_DSS_radarProcessOutput);
+    /* Echo the frame number, the MSS uses it to match the completion with the run of its DPC graph node */
+    errorCode = MsgIpc_post(&gMmwDssMCB.msgIpcCtrlObj, DPC_DSS_TO_MSS_POINT_CLOUD_READY,
+                            gMmwDssMCB.msgFrameNum, &buf, 1);
+    if (errorCode != 0)
+    {
+        DebugP_assert(0);
+    }
     gMmwDssMCB.interSubFrameProcToken--;
     gMmwDssMCB.radarCubeReadyEventCntr++;
 
@@ -306,7 +360,29 @@ void MmwDemo_handleMsg(MmwDemo_Msg *msg) {
 }
 
 
-/* Registered function with IPC driver that receives messages from MSS */
+/* Runs the FSM on the messages posted in the mailbox since the last doorbell */
+static void MmwDemo_receiveMessages(void)
+{
+    MsgMbox_Msg mboxMsg;
+    MmwDemo_Msg msg;
+    int32_t retVal;
+
+    while (((retVal = MsgIpc_receive(&gMmwDssMCB.msgIpcCtrlObj, &mboxMsg)) != MSG_MBOX_EEMPTY) &&
+           (retVal != MSG_MBOX_ENOTREADY))
+    {
+        if (retVal != 0)
+        {
+            /* Dropped, counted in the mailbox object */
+            continue;
+        }
+        msg.event = mboxMsg.msgId;
+        msg.arg = (mboxMsg.numBufs > 0U) ? (uint32_t) mboxMsg.buf[0].addr : 0U;
+        gMmwDssMCB.msgFrameNum = mboxMsg.frameNum;
+        MmwDemo_handleMsg(&msg);
+    }
+}
+
+/* Registered function with IPC driver that receives the mailbox doorbells from MSS */
 void DPC_dss_MsgHandler(uint32_t remoteCoreId, uint16_t localClientId, uint64_t msgValue, int32_t crcStatus, void *arg)
 {
     uint32_t message;
@@ -433,6 +509,12 @@ void demo_in_cabin_sensing_6844_dss(void* args)
     /* Sync with MSS */
     MsgIpc_Sync();
 
+    /* Attach to the mailbox initialized by the MSS before the sync */
+    if (MsgIpc_mboxConfig(&gMmwDssMCB.msgIpcCtrlObj, MSG_MBOX_ID_DSS, false) != 0)
+    {
+        DebugP_assert(0);
+    }
+
 
      /* Handles events from the queue and processes the FSM  */
      while (1)
@@ -440,7 +522,7 @@ void demo_in_cabin_sensing_6844_dss(void* args)
         // Wait for an event from the queue
         if (xQueueReceive(gMmwDssMCB.eventQueue, &msg, portMAX_DELAY) == pdPASS)
         {
-            MmwDemo_handleMsg(&msg);
+            MmwDemo_receiveMessages();
         }
 
         if (gDummy)
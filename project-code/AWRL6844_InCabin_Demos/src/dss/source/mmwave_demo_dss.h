@@ -342,6 +342,8 @@ typedef struct MmwDemo_DSS_MCB_t
     uint32_t dssConfigurationCntr;
     /*! @brief Counts received radar cube ready message */
     uint32_t radarCubeReadyEventCntr;
+    /*! @brief Frame number of the message being handled, the radar cube ready one is echoed in the point cloud ready message */
+    uint32_t msgFrameNum;
     /*! @brief frame counter modulo N where N is number of frames  per sliding window */
     uint32_t frmCntrModNumFrmPerSlidWin;
     /*! @brief number of frames  per sliding window */
@@ -174,6 +174,41 @@ void * radarOsal_memAlloc(uint8_t memoryType, uint8_t scratchFlag, uint32_t size
 	return (pointer);
 }
 
+/*!
+   \fn     radarOsal_memAvail
+   \brief   OSAL function returning the largest block that can still be allocated from a heap.
+
+   \param[in]    memoryType
+               input radarMemOsal_HeapType.
+
+   \param[in]    alignment
+               Alignment of the block in number of bytes, as for radarOsal_memAlloc.
+
+   \return    Size in number of bytes, 0 if the heap is not configured or full.
+   \pre       none
+   \post      none
+ */
+uint32_t radarOsal_memAvail(uint8_t memoryType, uint16_t alignment)
+{
+	uint32_t addrOffset = 0;
+	uint32_t allocOffset;
+
+	if (memoryType >= (uint8_t) RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS)
+		return 0;
+	if (gRadarOsal_heapObj[memoryType].heapAddr == NULL)
+		return 0;
+
+	allocOffset = gRadarOsal_heapObj[memoryType].heapAllocOffset;
+	/* same padding as radarOsal_memAlloc */
+	if ( alignment > 1 )
+		addrOffset 	=	alignment - ((uint32_t) &gRadarOsal_heapObj[memoryType].heapAddr[allocOffset]) & (alignment - 1);
+
+	if (allocOffset + addrOffset >= gRadarOsal_heapObj[memoryType].heapSize)
+		return 0;
+
+	return (gRadarOsal_heapObj[memoryType].heapSize - allocOffset - addrOffset);
+}
+
 /*!
    \fn     radarOsal_memResetHeapAll
    \brief   OSAL function to reset all heaps
@@ -120,6 +120,22 @@ extern int32_t radarOsal_memDeInit(void);
  */
 extern void * radarOsal_memAlloc(uint8_t memoryType, uint8_t scratchFlag, uint32_t size, uint16_t alignment);
 
+/*! 
+   \fn     radarOsal_memAvail
+   \brief   OSAL function returning the largest block that can still be allocated from a heap.
+
+   \param[in]    memoryType
+               input radarMemOsal heap type.
+
+   \param[in]    alignment
+               Alignment of the block in number of bytes, as for radarOsal_memAlloc.
+
+   \return    Size in number of bytes, 0 if the heap is not configured or full.
+   \pre       none
+   \post      none
+ */
+extern uint32_t radarOsal_memAvail(uint8_t memoryType, uint16_t alignment);
+
 /*! 
    \fn     radarOsal_memFree
    \brief   OSAL function for memory free.
@@ -0,0 +1,455 @@
+/*!
+ *  \file   radarOsal_memPlan.c
+ *
+ *  \brief   Lifetime aware buffer placement on top of the radarOsal heaps.
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <source/utilities/radarOsal_memPlan.h>
+
+/* Maximum length of a buffer name in the layout header */
+#define RADAROSAL_MEMPLAN_MAX_NAME_LEN      (48U)
+
+static const char *gRadarOsal_memPlanHeapName[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS] =
+{
+    "LL2", "DDR", "LL1", "HSRAM"
+};
+
+static uint32_t radarOsal_memPlanAlignUp(uint32_t offset, uint16_t alignment)
+{
+    if (alignment <= 1)
+        return offset;
+    return ((offset + alignment - 1U) & ~((uint32_t)alignment - 1U));
+}
+
+/* Buffers i and j hold data at the same time in the same heap */
+static int32_t radarOsal_memPlanIsLive(const radarOsal_memPlan *plan, uint32_t i, uint32_t j)
+{
+    return ((plan->buf[i].heapType == plan->buf[j].heapType) &&
+            ((plan->buf[i].stageMask & plan->buf[j].stageMask) != 0U) &&
+            (plan->buf[i].size != 0U) && (plan->buf[j].size != 0U));
+}
+
+/* Buffers i and j share at least one byte */
+static int32_t radarOsal_memPlanIsOverlap(const radarOsal_memPlan *plan, uint32_t i, uint32_t j)
+{
+    return ((plan->buf[i].offset < (plan->buf[j].offset + plan->buf[j].size)) &&
+            (plan->buf[j].offset < (plan->buf[i].offset + plan->buf[i].size)));
+}
+
+/* Writes a name in upper case, for the layout header */
+static void radarOsal_memPlanPrintName(FILE *fp, const char *prefix, const char *name, const char *suffix)
+{
+    char     upperName[RADAROSAL_MEMPLAN_MAX_NAME_LEN];
+    uint32_t i;
+
+    for (i = 0; (i < (RADAROSAL_MEMPLAN_MAX_NAME_LEN - 1U)) && (name[i] != '\0'); i++)
+    {
+        upperName[i] = (char)toupper((int32_t)name[i]);
+    }
+    upperName[i] = '\0';
+
+    fprintf(fp, "#define %s_%s_%s", prefix, upperName, suffix);
+}
+
+/*!
+   \fn     radarOsal_memPlanInit
+   \brief   Initializes an empty plan.
+
+   \param[in]    plan
+               Plan object.
+
+   \return    none.
+ */
+void radarOsal_memPlanInit(radarOsal_memPlan *plan)
+{
+    memset((void *)plan, 0, sizeof(radarOsal_memPlan));
+}
+
+/*!
+   \fn     radarOsal_memPlanAdd
+   \brief   Declares a buffer. The buffer pointer is written by radarOsal_memPlanAlloc().
+
+   \return    Buffer index (>= 0) on success, negative error code otherwise.
+ */
+int32_t radarOsal_memPlanAdd(radarOsal_memPlan *plan, const char *name, void **ptr, uint8_t heapType,
+                             uint8_t fallbackHeapType, uint32_t size, uint16_t alignment, uint32_t stageMask)
+{
+    radarOsal_memPlanBuf *buf;
+
+    if ((plan == NULL) || (name == NULL) || (ptr == NULL) || (stageMask == 0U) ||
+        (heapType >= (uint8_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS) ||
+        (fallbackHeapType > RADAROSAL_MEMPLAN_NO_FALLBACK) ||
+        ((alignment & (alignment - 1U)) != 0U))
+    {
+        return RADAROSAL_MEMPLAN_EINVAL;
+    }
+    if (plan->numBufs >= RADAROSAL_MEMPLAN_MAX_NUM_BUFS)
+    {
+        return RADAROSAL_MEMPLAN_ENOMEM;
+    }
+
+    buf = &plan->buf[plan->numBufs];
+    buf->name               = name;
+    buf->ptr                = ptr;
+    buf->size               = size;
+    buf->alignment          = (alignment == 0U) ? 1U : alignment;
+    buf->heapType           = heapType;
+    buf->fallbackHeapType   = (fallbackHeapType == heapType) ? RADAROSAL_MEMPLAN_NO_FALLBACK : fallbackHeapType;
+    buf->stageMask          = stageMask;
+    buf->offset             = 0;
+    *ptr                    = NULL;
+
+    return (int32_t)(plan->numBufs++);
+}
+
+/*!
+   \fn     radarOsal_memPlanSolve
+   \brief   Computes the buffer offsets and the region sizes. Does not allocate.
+
+   \param[in]    plan
+               Plan object.
+
+   \return    none.
+ */
+void radarOsal_memPlanSolve(radarOsal_memPlan *plan)
+{
+    uint8_t  order[RADAROSAL_MEMPLAN_MAX_NUM_BUFS];
+    uint32_t i, j, k, other, heapType, moved;
+    radarOsal_memPlanBuf *buf;
+
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        plan->regionSize[heapType]      = 0;
+        plan->regionAlignment[heapType] = 1;
+        plan->bumpSize[heapType]        = 0;
+    }
+
+    /* What radarOsal_memAlloc() would use for the same buffers */
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        plan->bumpSize[buf->heapType] = radarOsal_memPlanAlignUp(plan->bumpSize[buf->heapType], buf->alignment) + buf->size;
+    }
+
+    /* Largest first, in order of declaration for equal sizes */
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        for (j = i; (j > 0U) && (plan->buf[order[j - 1U]].size < plan->buf[i].size); j--)
+        {
+            order[j] = order[j - 1U];
+        }
+        order[j] = (uint8_t)i;
+    }
+
+    for (k = 0; k < plan->numBufs; k++)
+    {
+        i   = order[k];
+        buf = &plan->buf[i];
+        heapType = buf->heapType;
+
+        if (plan->regionAlignment[heapType] < buf->alignment)
+        {
+            plan->regionAlignment[heapType] = buf->alignment;
+        }
+
+        /* Lowest offset clear of the placed buffers live at the same time: a candidate overlapping a buffer
+           overlaps it up to its end, so moving past it never skips a valid offset */
+        buf->offset = 0;
+        if (buf->size != 0U)
+        {
+            do
+            {
+                moved = 0;
+                for (j = 0; j < k; j++)
+                {
+                    other = order[j];
+                    if (radarOsal_memPlanIsLive(plan, i, other) && radarOsal_memPlanIsOverlap(plan, i, other))
+                    {
+                        buf->offset = radarOsal_memPlanAlignUp(plan->buf[other].offset + plan->buf[other].size,
+                                                               buf->alignment);
+                        moved = 1;
+                    }
+                }
+            } while (moved);
+        }
+
+        if (plan->regionSize[heapType] < (buf->offset + buf->size))
+        {
+            plan->regionSize[heapType] = buf->offset + buf->size;
+        }
+    }
+
+    /* Largest first can lose to the declaration order on alignment padding when there is nothing to share,
+       never do worse than radarOsal_memAlloc() */
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        if (plan->regionSize[heapType] > plan->bumpSize[heapType])
+        {
+            plan->regionSize[heapType] = 0;
+            for (i = 0; i < plan->numBufs; i++)
+            {
+                buf = &plan->buf[i];
+                if (buf->heapType == heapType)
+                {
+                    buf->offset = radarOsal_memPlanAlignUp(plan->regionSize[heapType], buf->alignment);
+                    plan->regionSize[heapType] = buf->offset + buf->size;
+                }
+            }
+        }
+    }
+}
+
+/*!
+   \fn     radarOsal_memPlanVerify
+   \brief   Checks that no two buffers of a heap with a common stage overlap and that every buffer is aligned and
+            inside its region.
+
+   \param[in]    plan
+               Plan object, solved.
+
+   \return    0 if the placement is valid, RADAROSAL_MEMPLAN_EALIAS otherwise.
+ */
+int32_t radarOsal_memPlanVerify(const radarOsal_memPlan *plan)
+{
+    uint32_t i, j;
+    const radarOsal_memPlanBuf *buf;
+
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        if (((buf->offset & ((uint32_t)buf->alignment - 1U)) != 0U) ||
+            ((buf->offset + buf->size) > plan->regionSize[buf->heapType]) ||
+            (buf->alignment > plan->regionAlignment[buf->heapType]))
+        {
+            printf("memPlan: %s misplaced\n", buf->name);
+            return RADAROSAL_MEMPLAN_EALIAS;
+        }
+        for (j = i + 1U; j < plan->numBufs; j++)
+        {
+            if (radarOsal_memPlanIsLive(plan, i, j) && radarOsal_memPlanIsOverlap(plan, i, j))
+            {
+                printf("memPlan: %s and %s overlap\n", buf->name, plan->buf[j].name);
+                return RADAROSAL_MEMPLAN_EALIAS;
+            }
+        }
+    }
+    return 0;
+}
+
+/*!
+   \fn     radarOsal_memPlanAlloc
+   \brief   Solves the plan, moving buffers to their fallback heap until every region fits, verifies it, allocates
+            one region per heap with radarOsal_memAlloc() and writes the buffer pointers.
+
+   \param[in]    plan
+               Plan object.
+
+   \return    0 on success, negative error code otherwise. No memory is allocated on error.
+ */
+int32_t radarOsal_memPlanAlloc(radarOsal_memPlan *plan)
+{
+    int32_t  retVal = 0;
+    uint32_t i, heapType, overflowHeapType, numMoved;
+    radarOsal_memPlanBuf *buf;
+
+    if (plan == NULL)
+    {
+        retVal = RADAROSAL_MEMPLAN_EINVAL;
+        goto exit;
+    }
+
+    /* Every buffer moves at most once, so this terminates */
+    while (1)
+    {
+        radarOsal_memPlanSolve(plan);
+
+        overflowHeapType = (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS;
+        for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+        {
+            if ((plan->regionSize[heapType] != 0U) &&
+                (plan->regionSize[heapType] > radarOsal_memAvail((uint8_t)heapType, plan->regionAlignment[heapType])))
+            {
+                overflowHeapType = heapType;
+                break;
+            }
+        }
+        if (overflowHeapType == (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS)
+        {
+            break;
+        }
+
+        numMoved = 0;
+        for (i = 0; i < plan->numBufs; i++)
+        {
+            buf = &plan->buf[i];
+            if ((buf->heapType == overflowHeapType) && (buf->fallbackHeapType != RADAROSAL_MEMPLAN_NO_FALLBACK))
+            {
+                printf("memPlan: %s moved from %s to %s\n", buf->name, gRadarOsal_memPlanHeapName[buf->heapType],
+                       gRadarOsal_memPlanHeapName[buf->fallbackHeapType]);
+                buf->heapType           = buf->fallbackHeapType;
+                buf->fallbackHeapType   = RADAROSAL_MEMPLAN_NO_FALLBACK;
+                numMoved++;
+            }
+        }
+        if (numMoved == 0U)
+        {
+            printf("memPlan: %s region of %d bytes does not fit\n", gRadarOsal_memPlanHeapName[overflowHeapType],
+                   plan->regionSize[overflowHeapType]);
+            retVal = RADAROSAL_MEMPLAN_EOVERFLOW;
+            goto exit;
+        }
+    }
+
+    retVal = radarOsal_memPlanVerify(plan);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        plan->regionAddr[heapType] = NULL;
+        if (plan->regionSize[heapType] != 0U)
+        {
+            /* Checked against radarOsal_memAvail() above */
+            plan->regionAddr[heapType] = (int8_t *)radarOsal_memAlloc((uint8_t)heapType, 0, plan->regionSize[heapType],
+                                                                      plan->regionAlignment[heapType]);
+        }
+    }
+
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        *buf->ptr = (buf->size != 0U) ? (void *)&plan->regionAddr[buf->heapType][buf->offset] : NULL;
+    }
+
+exit:
+    return retVal;
+}
+
+/*!
+   \fn     radarOsal_memPlanPrint
+   \brief   Prints the placement and the memory saved over the bump allocators.
+
+   \param[in]    plan
+               Plan object, solved.
+
+   \param[in]    prefix
+               Name of the plan, for the report.
+
+   \return    none.
+ */
+void radarOsal_memPlanPrint(const radarOsal_memPlan *plan, const char *prefix)
+{
+    uint32_t i, heapType;
+    const radarOsal_memPlanBuf *buf;
+
+    printf("%s memory plan:\n", prefix);
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        printf("  %-24s %-5s offset 0x%06x size %6d stages 0x%08x\n", buf->name, gRadarOsal_memPlanHeapName[buf->heapType],
+               buf->offset, buf->size, buf->stageMask);
+    }
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        if (plan->bumpSize[heapType] != 0U)
+        {
+            printf("  %-5s region %d bytes, %d without reuse, %d saved\n", gRadarOsal_memPlanHeapName[heapType],
+                   plan->regionSize[heapType], plan->bumpSize[heapType],
+                   plan->bumpSize[heapType] - plan->regionSize[heapType]);
+        }
+    }
+}
+
+/*!
+   \fn     radarOsal_memPlanWriteHeader
+   \brief   Writes the layout of the plan as a C header.
+
+   \param[in]    plan
+               Plan object, solved.
+
+   \param[in]    prefix
+               Prefix of the macros of the layout header, in upper case.
+
+   \param[in]    fileName
+               Header file, overwritten.
+
+   \return    0 on success, RADAROSAL_MEMPLAN_EIO if the file cannot be written.
+ */
+int32_t radarOsal_memPlanWriteHeader(const radarOsal_memPlan *plan, const char *prefix, const char *fileName)
+{
+    uint32_t i, heapType;
+    const radarOsal_memPlanBuf *buf;
+    FILE *fp;
+
+    fp = fopen(fileName, "w");
+    if (fp == NULL)
+    {
+        printf("memPlan: cannot open %s\n", fileName);
+        return RADAROSAL_MEMPLAN_EIO;
+    }
+
+    fprintf(fp, "/* %s memory layout, generated by radarOsal_memPlanWriteHeader() */\n", prefix);
+    fprintf(fp, "#ifndef %s_MEMLAYOUT_H\n#define %s_MEMLAYOUT_H\n", prefix, prefix);
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        if (plan->regionSize[heapType] != 0U)
+        {
+            radarOsal_memPlanPrintName(fp, prefix, gRadarOsal_memPlanHeapName[heapType], "REGION_SIZE");
+            fprintf(fp, " (0x%xU)\n", plan->regionSize[heapType]);
+        }
+    }
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        buf = &plan->buf[i];
+        radarOsal_memPlanPrintName(fp, prefix, buf->name, "HEAP");
+        fprintf(fp, " (%dU)\n", buf->heapType);
+        radarOsal_memPlanPrintName(fp, prefix, buf->name, "OFFSET");
+        fprintf(fp, " (0x%xU)\n", buf->offset);
+        radarOsal_memPlanPrintName(fp, prefix, buf->name, "SIZE");
+        fprintf(fp, " (0x%xU)\n", buf->size);
+    }
+    fprintf(fp, "#endif\n");
+
+    if (fclose(fp) != 0)
+    {
+        printf("memPlan: cannot write %s\n", fileName);
+        return RADAROSAL_MEMPLAN_EIO;
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*!
+ *  \file   radarOsal_memPlan.h
+ *
+ *  \brief   Header file for radarOsal_memPlan.c, lifetime aware buffer placement on top of the radarOsal heaps.
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/*
+ * The radarOsal heaps are bump allocators: a buffer allocated with radarOsal_memAlloc() keeps its memory for the
+ * life of the application, even if it is only used in one step of the frame processing. A memory plan lets the
+ * owner of a processing chain declare its buffers with the stages of the frame in which they hold data, as a bit
+ * mask of stages. Two buffers whose stage masks do not intersect never hold data at the same time and may share
+ * memory.
+ *
+ * radarOsal_memPlanAlloc() places all the buffers of a heap in one region: buffers are placed largest first, each
+ * one at the lowest aligned offset that does not overlap a buffer already placed with a common stage. The region
+ * is then allocated with radarOsal_memAlloc() and the buffer pointers are written. When the region does not fit
+ * in its heap, the buffers that declare a fallback heap are moved there and the plan is computed again, so a
+ * chain can ask for L1 and still run with larger grids.
+ *
+ * radarOsal_memPlanVerify() checks the result independently of the placement: no two buffers of a heap with a
+ * common stage overlap, and every buffer is aligned and inside its region. The placement has no dependency on
+ * the heaps, the same plans can be computed and verified on the host.
+ *
+ * radarOsal_memPlanPrint() prints the placement and the memory saved over the bump allocators, and
+ * radarOsal_memPlanWriteHeader() writes the layout as a C header. Both are debug aids: the users of a plan only call
+ * them when RADAROSAL_MEMPLAN_DEBUG is defined. On the target the header is written through the CCS console
+ * (CIO), relative to the working directory of the debug session.
+ *
+ * tools/radarOsal_memPlan_host_check.sh checks the placement against an independent brute force check on random
+ * plans and writes the layout header of an example plan.
+ */
+
+#ifndef _RADAROSALMEMPLAN_H
+#define _RADAROSALMEMPLAN_H
+
+#include <stdint.h>
+#include <source/utilities/radarOsal_malloc.h>
+
+/*! @brief Invalid argument */
+#define RADAROSAL_MEMPLAN_EINVAL            (-1)
+
+/*! @brief Maximum number of buffers exceeded */
+#define RADAROSAL_MEMPLAN_ENOMEM            (-2)
+
+/*! @brief A region does not fit in its heap and its buffers have no fallback heap */
+#define RADAROSAL_MEMPLAN_EOVERFLOW         (-3)
+
+/*! @brief Two buffers with a common stage overlap, or a buffer is misplaced */
+#define RADAROSAL_MEMPLAN_EALIAS            (-4)
+
+/*! @brief The layout header cannot be written */
+#define RADAROSAL_MEMPLAN_EIO               (-5)
+
+/*! @brief Print the plans and write their layout headers, see radarOsal_memPlanPrint() */
+//#define RADAROSAL_MEMPLAN_DEBUG
+
+/*! @brief Maximum number of buffers in a plan */
+#define RADAROSAL_MEMPLAN_MAX_NUM_BUFS      (32U)
+
+/*! @brief Stage number to stage mask */
+#define RADAROSAL_MEMPLAN_STAGE(n)          ((uint32_t)1U << (n))
+
+/*! @brief Stage mask of a buffer holding data during the whole frame */
+#define RADAROSAL_MEMPLAN_STAGE_ALL         (0xFFFFFFFFU)
+
+/*! @brief No fallback heap */
+#define RADAROSAL_MEMPLAN_NO_FALLBACK       ((uint8_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS)
+
+typedef struct {
+    const char *name;           /**< buffer name, for the report and the layout header */
+    void      **ptr;            /**< written with the buffer address by radarOsal_memPlanAlloc() */
+    uint32_t    size;           /**< size in number of bytes */
+    uint16_t    alignment;      /**< alignment in number of bytes, power of 2 */
+    uint8_t     heapType;       /**< heap the buffer is placed in */
+    uint8_t     fallbackHeapType; /**< heap used if the region of heapType does not fit, RADAROSAL_MEMPLAN_NO_FALLBACK if none */
+    uint32_t    stageMask;      /**< stages in which the buffer holds data */
+    uint32_t    offset;         /**< offset in the region of its heap, computed by radarOsal_memPlanSolve() */
+} radarOsal_memPlanBuf;
+
+typedef struct {
+    radarOsal_memPlanBuf buf[RADAROSAL_MEMPLAN_MAX_NUM_BUFS]; /**< buffers, in order of declaration */
+    uint32_t numBufs;           /**< number of buffers */
+    uint32_t regionSize[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS]; /**< planned region size per heap */
+    uint16_t regionAlignment[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS]; /**< region alignment per heap, largest buffer alignment */
+    uint32_t bumpSize[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS]; /**< size of the same buffers without reuse, for the report */
+    int8_t  *regionAddr[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS]; /**< region base address, set by radarOsal_memPlanAlloc() */
+} radarOsal_memPlan;
+
+/*!
+   \fn     radarOsal_memPlanInit
+   \brief   Initializes an empty plan.
+
+   \param[in]    plan
+               Plan object.
+
+   \return    none.
+ */
+extern void radarOsal_memPlanInit(radarOsal_memPlan *plan);
+
+/*!
+   \fn     radarOsal_memPlanAdd
+   \brief   Declares a buffer. The buffer pointer is written by radarOsal_memPlanAlloc().
+
+   \param[in]    plan
+               Plan object.
+
+   \param[in]    name
+               Buffer name, a C identifier. Not copied.
+
+   \param[in]    ptr
+               Location of the buffer pointer.
+
+   \param[in]    heapType
+               Heap the buffer is placed in, radarMemOsal_HeapType.
+
+   \param[in]    fallbackHeapType
+               Heap used if the region of heapType does not fit, RADAROSAL_MEMPLAN_NO_FALLBACK if none.
+
+   \param[in]    size
+               Size in number of bytes.
+
+   \param[in]    alignment
+               Alignment in number of bytes, power of 2. 0 or 1 for no alignment requirement.
+
+   \param[in]    stageMask
+               Stages in which the buffer holds data, RADAROSAL_MEMPLAN_STAGE_ALL for a buffer used across stages.
+
+   \return    Buffer index (>= 0) on success, negative error code otherwise.
+ */
+extern int32_t radarOsal_memPlanAdd(radarOsal_memPlan *plan, const char *name, void **ptr, uint8_t heapType,
+                                    uint8_t fallbackHeapType, uint32_t size, uint16_t alignment, uint32_t stageMask);
+
+/*!
+   \fn     radarOsal_memPlanSolve
+   \brief   Computes the buffer offsets and the region sizes. Does not allocate.
+
+   \param[in]    plan
+               Plan object.
+
+   \return    none.
+ */
+extern void radarOsal_memPlanSolve(radarOsal_memPlan *plan);
+
+/*!
+   \fn     radarOsal_memPlanVerify
+   \brief   Checks that no two buffers of a heap with a common stage overlap and that every buffer is aligned and
+            inside its region.
+
+   \param[in]    plan
+               Plan object, solved.
+
+   \return    0 if the placement is valid, RADAROSAL_MEMPLAN_EALIAS otherwise.
+ */
+extern int32_t radarOsal_memPlanVerify(const radarOsal_memPlan *plan);
+
+/*!
+   \fn     radarOsal_memPlanAlloc
+   \brief   Solves the plan, moving buffers to their fallback heap until every region fits, verifies it, allocates
+            one region per heap with radarOsal_memAlloc() and writes the buffer pointers.
+
+   \param[in]    plan
+               Plan object.
+
+   \return    0 on success, negative error code otherwise. No memory is allocated on error.
+ */
+extern int32_t radarOsal_memPlanAlloc(radarOsal_memPlan *plan);
+
+/*!
+   \fn     radarOsal_memPlanPrint
+   \brief   Prints the placement and the memory saved over the bump allocators.
+
+   \param[in]    plan
+               Plan object, solved.
+
+   \param[in]    prefix
+               Name of the plan, for the report.
+
+   \return    none.
+ */
+extern void radarOsal_memPlanPrint(const radarOsal_memPlan *plan, const char *prefix);
+
+/*!
+   \fn     radarOsal_memPlanWriteHeader
+   \brief   Writes the layout of the plan as a C header: region size per heap, heap, offset and size per buffer.
+
+   \param[in]    plan
+               Plan object, solved.
+
+   \param[in]    prefix
+               Prefix of the macros of the layout header, in upper case.
+
+   \param[in]    fileName
+               Header file, overwritten.
+
+   \return    0 on success, RADAROSAL_MEMPLAN_EIO if the file cannot be written.
+ */
+extern int32_t radarOsal_memPlanWriteHeader(const radarOsal_memPlan *plan, const char *prefix, const char *fileName);
+
+#endif //_RADAROSALMEMPLAN_H
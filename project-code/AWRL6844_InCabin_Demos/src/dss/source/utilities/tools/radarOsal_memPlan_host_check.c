@@ -0,0 +1,374 @@
+/**
+ *   @file  radarOsal_memPlan_host_check.c
+ *
+ *   @brief
+ *      Host check of the radarOsal memory plans.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: radarOsal_memPlan_host_check [numPlans] [header]
+ *
+ *  Solves numPlans (default 20000) random plans, with random sizes, alignments, heaps, fallback heaps and stage
+ *  masks, and checks each placement independently of radarOsal_memPlanVerify(): a byte map per heap and stage
+ *  must not be claimed by two buffers, every buffer is aligned and inside its region, and no region is larger
+ *  than with the bump allocators. The plans are then allocated from host heaps of random sizes, each buffer is
+ *  filled stage by stage and checked for corruption by the other buffers of the stage, and a buffer moved onto
+ *  a live neighbour must be rejected by radarOsal_memPlanVerify().
+ *
+ *  With a header file name, also writes the layout header of a plan shaped as the radarProcess plan with
+ *  radarOsal_memPlanWriteHeader(). The results are printed on stderr, the diagnostics of the plan functions on
+ *  stdout. The exit status is 0 if all checks pass.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <source/utilities/radarOsal_memPlan.h>
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+/* Stages of the random plans */
+#define CHECK_NUM_STAGES                (8U)
+
+/* Largest random buffer, in number of bytes */
+#define CHECK_MAX_BUF_SIZE              (2048U)
+
+/* Largest random alignment, log2 */
+#define CHECK_MAX_ALIGN_LOG2            (7U)
+
+/* Size of the host heaps, enough for any random plan without reuse */
+#define CHECK_HEAP_SIZE                 (RADAROSAL_MEMPLAN_MAX_NUM_BUFS * (CHECK_MAX_BUF_SIZE + (1U << CHECK_MAX_ALIGN_LOG2)))
+
+/**************************************************************************
+ ************************** Global Variables ******************************
+ **************************************************************************/
+
+/* Host heaps for radarOsal_memAvail() and radarOsal_memAlloc() */
+static int8_t   gCheckHeap[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS][CHECK_HEAP_SIZE];
+static uint32_t gCheckHeapSize[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS];
+static uint32_t gCheckHeapOffset[RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS];
+
+/* Byte map of a heap region for one stage, buffer index + 1 per byte */
+static uint8_t  gCheckMap[CHECK_HEAP_SIZE];
+
+static uint32_t gCheckFailed;
+static uint32_t gCheckSeed = 1U;
+
+/**************************************************************************
+ ************************** Host heaps ************************************
+ **************************************************************************/
+
+static uint32_t Check_alignUp(uint32_t offset, uint16_t alignment)
+{
+    return (offset + alignment - 1U) & ~((uint32_t)alignment - 1U);
+}
+
+/* Host version of the bump allocator, offsets relative to a heap aligned to its largest alignment */
+void *radarOsal_memAlloc(uint8_t memoryType, uint8_t scratchFlag, uint32_t size, uint16_t alignment)
+{
+    uint32_t offset;
+
+    if (alignment == 0U)
+        alignment = 1U;
+    offset = Check_alignUp(gCheckHeapOffset[memoryType], alignment);
+    if (offset + size > gCheckHeapSize[memoryType])
+        return NULL;
+    gCheckHeapOffset[memoryType] = offset + size;
+    return (void *)&gCheckHeap[memoryType][offset];
+}
+
+uint32_t radarOsal_memAvail(uint8_t memoryType, uint16_t alignment)
+{
+    uint32_t offset;
+
+    if (alignment == 0U)
+        alignment = 1U;
+    offset = Check_alignUp(gCheckHeapOffset[memoryType], alignment);
+    return (offset < gCheckHeapSize[memoryType]) ? (gCheckHeapSize[memoryType] - offset) : 0U;
+}
+
+/**************************************************************************
+ ************************** Checks ****************************************
+ **************************************************************************/
+
+static uint32_t Check_rand(void)
+{
+    gCheckSeed = gCheckSeed * 1103515245U + 12345U;
+    return gCheckSeed >> 8;
+}
+
+static void Check_fail(uint32_t planIdx, const char *what, const char *name)
+{
+    if (gCheckFailed < 20U)
+    {
+        fprintf(stderr, "    FAIL: plan %u: %s %s\n", planIdx, what, name);
+    }
+    gCheckFailed++;
+}
+
+/* Random plan over CHECK_NUM_STAGES stages */
+static void Check_randomPlan(radarOsal_memPlan *plan, void **ptr)
+{
+    static char names[RADAROSAL_MEMPLAN_MAX_NUM_BUFS][8];
+    uint32_t i, numBufs, heapType, fallbackHeapType, stageMask, size;
+
+    radarOsal_memPlanInit(plan);
+    numBufs = 1U + Check_rand() % RADAROSAL_MEMPLAN_MAX_NUM_BUFS;
+    for (i = 0; i < numBufs; i++)
+    {
+        sprintf(names[i], "buf%u", i);
+        heapType         = Check_rand() % (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS;
+        fallbackHeapType = Check_rand() % ((uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS + 1U);
+        stageMask        = ((Check_rand() % 8U) == 0U) ? RADAROSAL_MEMPLAN_STAGE_ALL :
+                           (Check_rand() & ((1U << CHECK_NUM_STAGES) - 1U));
+        size             = ((Check_rand() % 16U) == 0U) ? 0U : (1U + Check_rand() % CHECK_MAX_BUF_SIZE);
+        if (stageMask == 0U)
+            stageMask = RADAROSAL_MEMPLAN_STAGE(Check_rand() % CHECK_NUM_STAGES);
+        if (radarOsal_memPlanAdd(plan, names[i], &ptr[i], (uint8_t)heapType, (uint8_t)fallbackHeapType, size,
+                                 (uint16_t)(1U << (Check_rand() % (CHECK_MAX_ALIGN_LOG2 + 1U))), stageMask) != (int32_t)i)
+        {
+            Check_fail(0, "cannot add", names[i]);
+        }
+    }
+}
+
+/* Independent check of a solved plan: byte map per heap and stage */
+static void Check_placement(uint32_t planIdx, const radarOsal_memPlan *plan)
+{
+    uint32_t i, b, stage, heapType;
+    const radarOsal_memPlanBuf *buf;
+
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        if (plan->regionSize[heapType] > plan->bumpSize[heapType])
+            Check_fail(planIdx, "region larger than without reuse in heap", "");
+        if (plan->regionSize[heapType] > CHECK_HEAP_SIZE)
+        {
+            Check_fail(planIdx, "region too large", "");
+            return;
+        }
+        for (stage = 0; stage < CHECK_NUM_STAGES; stage++)
+        {
+            memset(gCheckMap, 0, plan->regionSize[heapType]);
+            for (i = 0; i < plan->numBufs; i++)
+            {
+                buf = &plan->buf[i];
+                if ((buf->heapType != heapType) || ((buf->stageMask & RADAROSAL_MEMPLAN_STAGE(stage)) == 0U))
+                    continue;
+                if (((buf->offset % buf->alignment) != 0U) || (buf->offset + buf->size > plan->regionSize[heapType]))
+                {
+                    Check_fail(planIdx, "misplaced", buf->name);
+                    continue;
+                }
+                for (b = buf->offset; b < buf->offset + buf->size; b++)
+                {
+                    if (gCheckMap[b] != 0U)
+                    {
+                        Check_fail(planIdx, "aliased", buf->name);
+                        break;
+                    }
+                    gCheckMap[b] = (uint8_t)(i + 1U);
+                }
+            }
+        }
+    }
+    if (radarOsal_memPlanVerify(plan) != 0)
+        Check_fail(planIdx, "rejected by radarOsal_memPlanVerify", "");
+}
+
+/* Allocates the plan from host heaps of random sizes and fills the buffers stage by stage */
+static void Check_alloc(uint32_t planIdx, radarOsal_memPlan *plan, void **ptr)
+{
+    uint32_t i, b, stage, heapType;
+    int32_t  retVal;
+    radarOsal_memPlanBuf *buf;
+    uint8_t *data;
+
+    for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+    {
+        gCheckHeapOffset[heapType] = 0;
+        gCheckHeapSize[heapType]   = Check_rand() % CHECK_HEAP_SIZE;
+    }
+    gCheckHeapSize[RADARMEMOSAL_HEAPTYPE_DDR_CACHED] = CHECK_HEAP_SIZE;
+
+    retVal = radarOsal_memPlanAlloc(plan);
+    if (retVal == RADAROSAL_MEMPLAN_EOVERFLOW)
+    {
+        /* Nothing allocated on error */
+        for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+            if (gCheckHeapOffset[heapType] != 0U)
+                Check_fail(planIdx, "allocated on overflow", "");
+        return;
+    }
+    if (retVal != 0)
+    {
+        Check_fail(planIdx, "cannot allocate", "");
+        return;
+    }
+    Check_placement(planIdx, plan);
+
+    for (stage = 0; stage < CHECK_NUM_STAGES; stage++)
+    {
+        for (i = 0; i < plan->numBufs; i++)
+        {
+            buf = &plan->buf[i];
+            if ((buf->stageMask & RADAROSAL_MEMPLAN_STAGE(stage)) && (buf->size != 0U))
+                memset(ptr[i], (int)(i + 1U), buf->size);
+        }
+        for (i = 0; i < plan->numBufs; i++)
+        {
+            buf  = &plan->buf[i];
+            data = (uint8_t *)ptr[i];
+            if (((buf->stageMask & RADAROSAL_MEMPLAN_STAGE(stage)) == 0U) || (buf->size == 0U))
+                continue;
+            if (((uintptr_t)data - (uintptr_t)&gCheckHeap[buf->heapType][0]) % buf->alignment != 0U)
+                Check_fail(planIdx, "unaligned pointer", buf->name);
+            for (b = 0; b < buf->size; b++)
+            {
+                if (data[b] != (uint8_t)(i + 1U))
+                {
+                    Check_fail(planIdx, "corrupted", buf->name);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/* Moves a buffer onto a live neighbour, radarOsal_memPlanVerify() must reject it */
+static void Check_mutation(uint32_t planIdx, radarOsal_memPlan *plan)
+{
+    uint32_t i, j, offset;
+
+    for (i = 0; i < plan->numBufs; i++)
+    {
+        for (j = 0; j < plan->numBufs; j++)
+        {
+            if ((i == j) || (plan->buf[i].heapType != plan->buf[j].heapType) ||
+                ((plan->buf[i].stageMask & plan->buf[j].stageMask) == 0U) ||
+                (plan->buf[i].size == 0U) || (plan->buf[j].size == 0U) ||
+                (plan->buf[j].offset % plan->buf[i].alignment != 0U))
+                continue;
+            offset = plan->buf[i].offset;
+            plan->buf[i].offset = plan->buf[j].offset;
+            if (radarOsal_memPlanVerify(plan) != RADAROSAL_MEMPLAN_EALIAS)
+                Check_fail(planIdx, "aliasing not detected for", plan->buf[i].name);
+            plan->buf[i].offset = offset;
+            return;
+        }
+    }
+}
+
+/* Plan shaped as the radarProcess plan with 16 virtual antennas and 64 range bins, for the layout header. Stages
+   and stage masks of radarProcess_internal.h */
+static int32_t Check_header(const char *fileName)
+{
+    static radarOsal_memPlan plan;
+    static void *ptr[8];
+    const uint32_t numRangeBins = 64U, nRxAnt = 16U, maxNumAngleEst = 64U, maxNumDetObj = 256U;
+    const uint32_t liveCfar   = RADAROSAL_MEMPLAN_STAGE(1) | RADAROSAL_MEMPLAN_STAGE(4);
+    const uint32_t liveAngle  = RADAROSAL_MEMPLAN_STAGE(2) | RADAROSAL_MEMPLAN_STAGE(5);
+    const uint32_t liveDyn    = RADAROSAL_MEMPLAN_STAGE(0) | RADAROSAL_MEMPLAN_STAGE(1) | RADAROSAL_MEMPLAN_STAGE(2);
+
+    radarOsal_memPlanInit(&plan);
+    radarOsal_memPlanAdd(&plan, "perRangeBinMax", &ptr[0], RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+                         numRangeBins * 4U, 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+    radarOsal_memPlanAdd(&plan, "staticInformation", &ptr[1], RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+                         numRangeBins * nRxAnt * 8U, 8, RADAROSAL_MEMPLAN_STAGE_ALL);
+    radarOsal_memPlanAdd(&plan, "invRnMatrices", &ptr[2], RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+                         numRangeBins * (nRxAnt >> 1) * (nRxAnt + 1U) * 8U, 8, liveDyn);
+    radarOsal_memPlanAdd(&plan, "bwFilter", &ptr[3], RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+                         maxNumAngleEst * nRxAnt * 8U, 8, liveAngle);
+    radarOsal_memPlanAdd(&plan, "azimEst", &ptr[4], RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+                         maxNumAngleEst * 4U, 1, liveAngle);
+    radarOsal_memPlanAdd(&plan, "cfarRangeInd", &ptr[5], RADARMEMOSAL_HEAPTYPE_LL2, RADARMEMOSAL_HEAPTYPE_DDR_CACHED,
+                         maxNumDetObj * 2U, 1, liveCfar | liveAngle);
+    radarOsal_memPlanAdd(&plan, "cfarInput", &ptr[6], RADARMEMOSAL_HEAPTYPE_LL1, RADAROSAL_MEMPLAN_NO_FALLBACK,
+                         64U, 1, liveCfar);
+    radarOsal_memPlanAdd(&plan, "detOrder", &ptr[7], RADARMEMOSAL_HEAPTYPE_LL1, RADAROSAL_MEMPLAN_NO_FALLBACK,
+                         maxNumDetObj * 2U, 1, liveAngle);
+    radarOsal_memPlanSolve(&plan);
+    if (radarOsal_memPlanVerify(&plan) != 0)
+        return RADAROSAL_MEMPLAN_EALIAS;
+    radarOsal_memPlanPrint(&plan, "RADARPROCESS");
+    return radarOsal_memPlanWriteHeader(&plan, "RADARPROCESS", fileName);
+}
+
+int main(int argc, char *argv[])
+{
+    static radarOsal_memPlan plan;
+    static void *ptr[RADAROSAL_MEMPLAN_MAX_NUM_BUFS];
+    uint32_t planIdx, numPlans = 20000U;
+    uint32_t saved = 0, bump = 0, heapType;
+
+    if (argc > 1)
+        numPlans = (uint32_t)strtoul(argv[1], NULL, 0);
+
+    for (planIdx = 0; planIdx < numPlans; planIdx++)
+    {
+        Check_randomPlan(&plan, ptr);
+        radarOsal_memPlanSolve(&plan);
+        Check_placement(planIdx, &plan);
+        for (heapType = 0; heapType < (uint32_t)RADARMEMOSAL_HEAPTYPE_MAXNUMHEAPS; heapType++)
+        {
+            bump  += plan.bumpSize[heapType];
+            saved += plan.bumpSize[heapType] - plan.regionSize[heapType];
+        }
+        Check_mutation(planIdx, &plan);
+        Check_alloc(planIdx, &plan, ptr);
+    }
+    fprintf(stderr, "%u random plans, %.1f%% of the bump allocator memory saved\n", numPlans,
+           (bump != 0U) ? (100.0 * (double)saved / (double)bump) : 0.0);
+
+    if (argc > 2)
+    {
+        if (Check_header(argv[2]) != 0)
+            Check_fail(0, "cannot write", argv[2]);
+        else
+            fprintf(stderr, "layout header written to %s\n", argv[2]);
+    }
+
+    fprintf(stderr, "%s: %u failed checks\n", (gCheckFailed == 0U) ? "PASS" : "FAIL", gCheckFailed);
+    return (gCheckFailed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the radarOsal memory plan check on the host, and write an example layout header
+#
+#   radarOsal_memPlan_host_check.sh [numPlans]
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./radarOsal_memPlan_host_check_build, the layout
+# header is written there as radarProcess_memLayout.h and compiled to check it. The diagnostics of the plan functions
+# go to radarOsal_memPlan_host_check.log in BUILD_DIR.
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+DSS_DIR="$TOOLS_DIR/../../.."
+BUILD_DIR=${BUILD_DIR:-./radarOsal_memPlan_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+$CC -O2 -Wall -D_LITTLE_ENDIAN -I "$DSS_DIR" -o "$BUILD_DIR/radarOsal_memPlan_host_check" \
+    "$TOOLS_DIR/radarOsal_memPlan_host_check.c" "$TOOLS_DIR/../radarOsal_memPlan.c"
+"$BUILD_DIR/radarOsal_memPlan_host_check" "${1:-20000}" "$BUILD_DIR/radarProcess_memLayout.h" \
+    > "$BUILD_DIR/radarOsal_memPlan_host_check.log"
+echo '#include "radarProcess_memLayout.h"' | $CC -fsyntax-only -Wall -I "$BUILD_DIR" -x c -
@@ -73,6 +73,8 @@ typedef struct {
 
     float *scratchBuffer;   /* Scratch memory needed for computations. Keep NULL to request internal allocation */
     uint32_t scratchBufferSizeInBytes; /* Module needs (CNN_CLASSIFIER_BUFFER_SIZE_NEEDED * sizeof(float)) bytes */
+
+    int32_t max_batch;      /* Maximum number of inputs per cnn_classifier_predict_batch() call, 0 for 1. Open implementation only (CNN_CLASSIFIER_OPEN) */
 } cnn_Classifier_moduleConfig;
 
 
@@ -82,6 +84,12 @@ extern void cnn_classifier_predict(void *handle, const float *features, float *p
 extern void cnn_classifier_delete(void *handle);
 extern uint32_t cnn_classifier_bytes_needed(void);
 
+#ifdef CNN_CLASSIFIER_OPEN
+/* Batched API, available with the open implementation (alg/cnn_classifier/src) only */
+extern void cnn_classifier_predict_batch(void *handle, const float *features, int32_t num_inputs, float *predictions);
+extern uint32_t cnn_classifier_batch_bytes_needed(int32_t max_batch);
+#endif
+
 
 /* Declarations of memory allocation functions. Call these functions to allocate or free memory */
 void *cnn_classifier_malloc(uint32_t sizeInBytes);
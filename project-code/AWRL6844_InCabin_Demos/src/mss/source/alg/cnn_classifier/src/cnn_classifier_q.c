@@ -0,0 +1,496 @@
+/*!
+ *  \file   cnn_classifier_q.c
+ *
+ *  \brief  Open, quantized implementation of the 1D-CNN classifier
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+#include "cnn_classifier_q.h"
+
+
+/* Local function declarations */
+static void cnn_q_conv1d(const CNN_Q_convLayer *layer, const int16_t *in, uint16_t inStride, uint16_t inRowLength,
+                         int16_t *out, uint16_t outStride, uint16_t outRowLength, uint16_t outPadLeft,
+                         int32_t *acc, uint16_t accStride, int32_t *pooledSum, uint16_t numInputs);
+static void cnn_q_layerLengths(const CNN_Q_model *model, uint16_t *layerLength, uint16_t *rowLength);
+static uint32_t cnn_q_scratchBytes(const CNN_Q_model *model, uint16_t maxBatch, uint16_t *actABytes, uint16_t *actBBytes);
+
+
+/* Function Definitions */
+/*
+ This function returns the scratch memory needed by the classifier, in bytes
+ * Arguments    : void
+ * Return Type  : uint32_t, Scratch size in bytes
+ */
+uint32_t cnn_classifier_bytes_needed(void)
+{
+    return cnn_classifier_batch_bytes_needed(1);
+}
+
+/*
+ This function returns the scratch memory needed by the classifier configured with max_batch, in bytes
+ * Arguments    : int32_t max_batch, Maximum number of inputs per cnn_classifier_predict_batch() call
+ * Return Type  : uint32_t, Scratch size in bytes, 0 if max_batch is not supported
+ */
+uint32_t cnn_classifier_batch_bytes_needed(int32_t max_batch)
+{
+    uint16_t actABytes, actBBytes;
+
+    if (max_batch <= 0)
+    {
+        max_batch = 1;
+    }
+    if (max_batch > (int32_t) CNN_Q_MAX_BATCH)
+    {
+        return 0;
+    }
+    return cnn_q_scratchBytes(&gCnnClassifierQModel, (uint16_t) max_batch, &actABytes, &actBBytes);
+}
+
+/*
+ This function creates an instance of the classifier
+ * Arguments    : cnn_Classifier_moduleConfig *config, Module configuration
+                  int32_t *errCode, Error code output
+ * Return Type  : void *, Classifier handle, NULL in case of error
+ */
+void *cnn_classifier_create(cnn_Classifier_moduleConfig *config, int32_t *errCode)
+{
+    const CNN_Q_model *model = &gCnnClassifierQModel;
+    CNN_Q_moduleInstance *inst = NULL;
+    uint16_t actABytes, actBBytes;
+    uint16_t maxBatch;
+    uint32_t scratchBytes;
+    uint8_t *scratch;
+    uint32_t layerInd;
+
+    *errCode = CNN_CLASSIFIER_EOK;
+
+    /* The configuration must match the model */
+    if ((config == NULL) ||
+        (config->num_frames != model->inputLength) ||
+        (config->num_features != 1) ||
+        (config->num_classes != model->numClasses) ||
+        (config->max_batch > (int32_t) CNN_Q_MAX_BATCH) ||
+        (model->inputLength > CNN_Q_MAX_INPUT_LENGTH) ||
+        (model->numClasses > CNN_Q_MAX_CLASSES))
+    {
+        *errCode = CNN_CLASSIFIER_EINVAL;
+        goto exit;
+    }
+    /* The requantization rounds with 1 << (totalShift - 1) and shifts an int64 product right by totalShift.
+       The output of a layer is not longer than its input, so that the accumulator rows of inputLength fit */
+    for (layerInd = 0; layerInd < CNN_Q_NUM_CONV_LAYERS; layerInd++)
+    {
+        const CNN_Q_convLayer *layer = &model->conv[layerInd];
+        uint32_t oc;
+        if ((layer->stride == 0) || ((layer->padLeft + layer->padRight) >= layer->kernelSize))
+        {
+            *errCode = CNN_CLASSIFIER_EINVAL;
+            goto exit;
+        }
+        for (oc = 0; oc < model->conv[layerInd].numOutChannels; oc++)
+        {
+            int32_t totalShift = 31 + model->conv[layerInd].outShift[oc];
+            if ((totalShift < CNN_Q_MIN_TOTAL_SHIFT) || (totalShift > CNN_Q_MAX_TOTAL_SHIFT))
+            {
+                *errCode = CNN_CLASSIFIER_EINVAL;
+                goto exit;
+            }
+        }
+    }
+    maxBatch = (config->max_batch > 1) ? (uint16_t) config->max_batch : 1U;
+
+    inst = (CNN_Q_moduleInstance *) cnn_classifier_malloc(sizeof(CNN_Q_moduleInstance));
+    if (inst == NULL)
+    {
+        *errCode = CNN_CLASSIFIER_ENOMEM;
+        goto exit;
+    }
+    memset(inst, 0, sizeof(CNN_Q_moduleInstance));
+    inst->model = model;
+    inst->maxBatch = maxBatch;
+
+    cnn_q_layerLengths(model, inst->layerLength, inst->rowLength);
+    if (inst->layerLength[CNN_Q_NUM_CONV_LAYERS] == 0)
+    {
+        cnn_classifier_delete(inst);
+        inst = NULL;
+        *errCode = CNN_CLASSIFIER_EINVAL;
+        goto exit;
+    }
+
+    /* Scratch memory: provided by the application or allocated internally */
+    scratchBytes = cnn_q_scratchBytes(model, maxBatch, &actABytes, &actBBytes);
+    if ((config->scratchBuffer != NULL) && (config->scratchBufferSizeInBytes >= scratchBytes))
+    {
+        scratch = (uint8_t *) config->scratchBuffer;
+    }
+    else
+    {
+        inst->scratchBlock = (uint8_t *) cnn_classifier_malloc(scratchBytes);
+        if (inst->scratchBlock == NULL)
+        {
+            cnn_classifier_delete(inst);
+            inst = NULL;
+            *errCode = CNN_CLASSIFIER_ENOMEM;
+            goto exit;
+        }
+        inst->scratchBlockSizeInBytes = scratchBytes;
+        scratch = inst->scratchBlock;
+    }
+
+    inst->actAStride = actABytes / sizeof(int16_t);
+    inst->actBStride = actBBytes / sizeof(int16_t);
+    inst->actA = (int16_t *) scratch;
+    scratch += maxBatch * actABytes;
+    inst->actB = (int16_t *) scratch;
+    scratch += maxBatch * actBBytes;
+    inst->acc = (int32_t *) scratch;
+    scratch += maxBatch * CNN_Q_ALIGN(model->inputLength * sizeof(int32_t));
+    inst->pooledSum = (int32_t *) scratch;
+
+exit:
+    return (void *) inst;
+}
+
+/*
+ This function runs the classifier on one input
+ * Arguments    : void *handle, Classifier handle
+                  const float *features, Input, num_frames values
+                  float *predictions, Output class probabilities, num_classes values
+ * Return Type  : void
+ */
+void cnn_classifier_predict(void *handle, const float *features, float *predictions)
+{
+    cnn_classifier_predict_batch(handle, features, 1, predictions);
+}
+
+/*
+ This function runs the classifier on a batch of inputs, e.g. one per zone. The inputs are processed by chunks of
+ max_batch, and each layer is computed for all the inputs of a chunk before moving on to the next layer
+ * Arguments    : void *handle, Classifier handle
+                  const float *features, Inputs, [num_inputs][num_frames]
+                  int32_t num_inputs, Number of inputs
+                  float *predictions, Output class probabilities, [num_inputs][num_classes]
+ * Return Type  : void
+ */
+void cnn_classifier_predict_batch(void *handle, const float *features, int32_t num_inputs, float *predictions)
+{
+    CNN_Q_moduleInstance *inst = (CNN_Q_moduleInstance *) handle;
+    const CNN_Q_model *model = inst->model;
+    const CNN_Q_convLayer *last = &model->conv[CNN_Q_NUM_CONV_LAYERS - 1U];
+    uint16_t accStride = CNN_Q_ALIGN(model->inputLength * sizeof(int32_t)) / sizeof(int32_t);
+    float pooledMean[CNN_Q_MAX_CHANNELS];
+    float logitMax, expSum;
+    float lengthInv;
+    uint32_t layerInd;
+    uint16_t padLeft = model->conv[0].padLeft;
+    uint16_t numInputs, b, i, k, c;
+
+    lengthInv = 1.f / (float) inst->layerLength[CNN_Q_NUM_CONV_LAYERS];
+
+    while (num_inputs > 0)
+    {
+        numInputs = (num_inputs > (int32_t) inst->maxBatch) ? inst->maxBatch : (uint16_t) num_inputs;
+
+        /* Input quantization */
+        for (b = 0; b < numInputs; b++)
+        {
+            const float *x = &features[b * model->inputLength];
+            int16_t *a = &inst->actA[b * inst->actAStride];
+            memset(a, 0, inst->rowLength[0] * sizeof(int16_t));
+            for (i = 0; i < model->inputLength; i++)
+            {
+                float v = x[i] * model->inputScaleInv;
+                v = (v > (float) CNN_Q_ACT_MAX) ? (float) CNN_Q_ACT_MAX : v;
+                v = (v < (float) -CNN_Q_ACT_MAX) ? (float) -CNN_Q_ACT_MAX : v;
+                a[padLeft + i] = (int16_t) (v + ((v >= 0.f) ? 0.5f : -0.5f));
+            }
+        }
+
+        /* Convolution layers, ping-pong between the activation buffers. The last one is reduced by the global average pooling */
+        for (layerInd = 0; layerInd < CNN_Q_NUM_CONV_LAYERS; layerInd++)
+        {
+            bool odd = ((layerInd & 1U) != 0U);
+            bool isLast = (layerInd == (CNN_Q_NUM_CONV_LAYERS - 1U));
+
+            cnn_q_conv1d(&model->conv[layerInd],
+                         odd ? inst->actB : inst->actA, odd ? inst->actBStride : inst->actAStride,
+                         inst->rowLength[layerInd],
+                         isLast ? NULL : (odd ? inst->actA : inst->actB), odd ? inst->actAStride : inst->actBStride,
+                         isLast ? 0 : inst->rowLength[layerInd + 1U], isLast ? 0 : model->conv[layerInd + 1U].padLeft,
+                         inst->acc, accStride, isLast ? inst->pooledSum : NULL, numInputs);
+        }
+
+        for (b = 0; b < numInputs; b++)
+        {
+            const int32_t *pooledSum = &inst->pooledSum[b * CNN_Q_MAX_CHANNELS];
+            float *p = &predictions[b * model->numClasses];
+
+            /* Global average pooling */
+            for (k = 0; k < last->numOutChannels; k++)
+            {
+                pooledMean[k] = (float) pooledSum[k] * lengthInv;
+            }
+
+            /* Dense layer */
+            for (c = 0; c < model->numClasses; c++)
+            {
+                const int8_t *w = &model->denseWeights[c * last->numOutChannels];
+                float acc = 0.f;
+                for (k = 0; k < last->numOutChannels; k++)
+                {
+                    acc += (float) w[k] * pooledMean[k];
+                }
+                p[c] = acc * model->denseScale[c] + model->denseBias[c];
+            }
+
+            /* Softmax, with the exp approximation of the library. (1 + x/16)^16 is clamped to 0 below x = -16, where the
+               library power grows again */
+            logitMax = p[0];
+            for (c = 1; c < model->numClasses; c++)
+            {
+                logitMax = (p[c] > logitMax) ? p[c] : logitMax;
+            }
+            expSum = 0.f;
+            for (c = 0; c < model->numClasses; c++)
+            {
+                float e = (p[c] - logitMax) * CNN_Q_SOFTMAX_EXP_STEP + 1.f;
+                e = (e < 0.f) ? 0.f : e;
+                e *= e;
+                e *= e;
+                e *= e;
+                e *= e;
+                p[c] = e;
+                expSum += e;
+            }
+            for (c = 0; c < model->numClasses; c++)
+            {
+                p[c] /= expSum;
+            }
+        }
+
+        features += numInputs * model->inputLength;
+        predictions += numInputs * model->numClasses;
+        num_inputs -= numInputs;
+    }
+}
+
+/*
+ This function deletes the classifier instance
+ * Arguments    : void *handle, Classifier handle
+ * Return Type  : void
+ */
+void cnn_classifier_delete(void *handle)
+{
+    CNN_Q_moduleInstance *inst = (CNN_Q_moduleInstance *) handle;
+
+    if (inst == NULL)
+    {
+        return;
+    }
+    if (inst->scratchBlock != NULL)
+    {
+        cnn_classifier_free(inst->scratchBlock, inst->scratchBlockSizeInBytes);
+    }
+    cnn_classifier_free(inst, sizeof(CNN_Q_moduleInstance));
+}
+
+/*
+ This function computes the input length of each layer, the output length of the last one, and the input row length
+ of each layer with its zero padding
+ */
+static void cnn_q_layerLengths(const CNN_Q_model *model, uint16_t *layerLength, uint16_t *rowLength)
+{
+    uint32_t layerInd;
+
+    layerLength[0] = model->inputLength;
+    for (layerInd = 0; layerInd < CNN_Q_NUM_CONV_LAYERS; layerInd++)
+    {
+        const CNN_Q_convLayer *layer = &model->conv[layerInd];
+        rowLength[layerInd] = layerLength[layerInd] + layer->padLeft + layer->padRight;
+        layerLength[layerInd + 1U] = (rowLength[layerInd] < layer->kernelSize) ? 0U :
+                                     (uint16_t) ((rowLength[layerInd] - layer->kernelSize) / layer->stride + 1U);
+    }
+}
+
+/*
+ This function returns the scratch memory needed by a model, in bytes. actABytes and actBBytes are per input of the batch.
+ Layer l reads actA if l is even, actB otherwise, and writes the other buffer. The last layer output is not stored
+ */
+static uint32_t cnn_q_scratchBytes(const CNN_Q_model *model, uint16_t maxBatch, uint16_t *actABytes, uint16_t *actBBytes)
+{
+    uint16_t layerLength[CNN_Q_NUM_CONV_LAYERS + 1U];
+    uint16_t rowLength[CNN_Q_NUM_CONV_LAYERS];
+    uint32_t bytes[2] = {0, 0};
+    uint32_t layerInd, size;
+
+    cnn_q_layerLengths(model, layerLength, rowLength);
+    for (layerInd = 0; layerInd < CNN_Q_NUM_CONV_LAYERS; layerInd++)
+    {
+        size = rowLength[layerInd] * model->conv[layerInd].numInChannels * sizeof(int16_t);
+        bytes[layerInd & 1U] = (size > bytes[layerInd & 1U]) ? size : bytes[layerInd & 1U];
+    }
+    *actABytes = (uint16_t) CNN_Q_ALIGN(bytes[0]);
+    *actBBytes = (uint16_t) CNN_Q_ALIGN(bytes[1]);
+
+    return maxBatch * (*actABytes + *actBBytes +
+                       CNN_Q_ALIGN(model->inputLength * sizeof(int32_t)) +
+                       CNN_Q_ALIGN(CNN_Q_MAX_CHANNELS * sizeof(int32_t)));
+}
+
+/*
+ This function computes a quantized 1D convolution layer, with the batch normalization folded in, followed by ReLU,
+ for a batch of inputs.
+ Direct convolution: for each output channel, the kernel of each input channel is loaded in registers once and
+ slid over the input row of every input of the batch, accumulating into rows of int32 accumulators. No im2col buffer is needed.
+ The input rows hold the zero padding of the layer, so the kernel never reads outside of a row
+ * Arguments    : const CNN_Q_convLayer *layer, Layer
+                  const int16_t *in, Input activations, [numInputs][inStride], each [numInChannels][inRowLength]
+                  uint16_t inStride, Distance between two inputs of the batch in in
+                  uint16_t inRowLength, Input row length, with the padding
+                  int16_t *out, Output activations, [numInputs][outStride], each [numOutChannels][outRowLength], NULL to skip
+                  uint16_t outStride, Distance between two inputs of the batch in out
+                  uint16_t outRowLength, Output row length, with the padding of the next layer
+                  uint16_t outPadLeft, Left padding of the next layer
+                  int32_t *acc, Accumulator rows scratch, [numInputs][accStride]
+                  uint16_t accStride, Distance between two accumulator rows, at least the output length
+                  int32_t *pooledSum, Sum over time of the output activations per channel, [numInputs][CNN_Q_MAX_CHANNELS], NULL to skip
+                  uint16_t numInputs, Number of inputs of the batch
+ * Return Type  : void
+ */
+static void cnn_q_conv1d(const CNN_Q_convLayer *layer, const int16_t *in, uint16_t inStride, uint16_t inRowLength,
+                         int16_t *out, uint16_t outStride, uint16_t outRowLength, uint16_t outPadLeft,
+                         int32_t *acc, uint16_t accStride, int32_t *pooledSum, uint16_t numInputs)
+{
+    uint16_t kernelSize = layer->kernelSize;
+    uint16_t stride = layer->stride;
+    uint16_t outLength = (inRowLength - kernelSize) / stride + 1U;
+    uint16_t oc, ic, b, t, k;
+
+    for (oc = 0; oc < layer->numOutChannels; oc++)
+    {
+        int32_t bias = layer->bias[oc];
+        int64_t mult = layer->outMult[oc];
+        int32_t totalShift = 31 + layer->outShift[oc];
+        int64_t rounding = (int64_t) 1 << (totalShift - 1);
+
+        for (b = 0; b < numInputs; b++)
+        {
+            int32_t *accRow = &acc[b * accStride];
+            for (t = 0; t < outLength; t++)
+            {
+                accRow[t] = bias;
+            }
+        }
+
+        for (ic = 0; ic < layer->numInChannels; ic++)
+        {
+            const int8_t *w = &layer->weights[(oc * layer->numInChannels + ic) * kernelSize];
+
+            if (kernelSize == 5U)
+            {
+                int32_t w0 = w[0], w1 = w[1], w2 = w[2], w3 = w[3], w4 = w[4];
+                for (b = 0; b < numInputs; b++)
+                {
+                    const int16_t *a = &in[b * inStride + ic * inRowLength];
+                    int32_t *accRow = &acc[b * accStride];
+                    for (t = 0; t < outLength; t++)
+                    {
+                        const int16_t *x = &a[t * stride];
+                        accRow[t] += w0 * x[0] + w1 * x[1] + w2 * x[2] + w3 * x[3] + w4 * x[4];
+                    }
+                }
+            }
+            else
+            {
+                for (b = 0; b < numInputs; b++)
+                {
+                    const int16_t *a = &in[b * inStride + ic * inRowLength];
+                    int32_t *accRow = &acc[b * accStride];
+                    for (t = 0; t < outLength; t++)
+                    {
+                        const int16_t *x = &a[t * stride];
+                        int32_t s = 0;
+                        for (k = 0; k < kernelSize; k++)
+                        {
+                            s += (int32_t) w[k] * x[k];
+                        }
+                        accRow[t] += s;
+                    }
+                }
+            }
+        }
+
+        for (b = 0; b < numInputs; b++)
+        {
+            int32_t *accRow = &acc[b * accStride];
+            int32_t sum = 0;
+
+            /* Requantization and ReLU */
+            for (t = 0; t < outLength; t++)
+            {
+                int32_t v = (int32_t) (((int64_t) accRow[t] * mult + rounding) >> totalShift);
+                v = (v < 0) ? 0 : v;
+                v = (v > CNN_Q_ACT_MAX) ? CNN_Q_ACT_MAX : v;
+                accRow[t] = v;
+            }
+
+            if (out != NULL)
+            {
+                int16_t *o = &out[b * outStride + oc * outRowLength];
+                for (t = 0; t < outPadLeft; t++)
+                {
+                    o[t] = 0;
+                }
+                for (t = 0; t < outLength; t++)
+                {
+                    o[outPadLeft + t] = (int16_t) accRow[t];
+                }
+                for (t = outPadLeft + outLength; t < outRowLength; t++)
+                {
+                    o[t] = 0;
+                }
+            }
+            if (pooledSum != NULL)
+            {
+                for (t = 0; t < outLength; t++)
+                {
+                    sum += accRow[t];
+                }
+                pooledSum[b * CNN_Q_MAX_CHANNELS + oc] = sum;
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*!
+ *  \file   cnn_classifier_q.h
+ *
+ *  \brief  Internal header file for the quantized 1D-CNN classifier
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Open, quantized implementation of the 1D-CNN classifier
+ *  The implementation is a drop-in replacement of alg_cnnClassifier library and implements the API defined in cnn_classifier.h
+ *
+ *  Network: the topology of the library model
+ *  - 3 x [1D convolution (kernel 5, stride 4, zero padding 1 on each side) + batch normalization + ReLU],
+ *    1 -> 16 -> 32 -> 64 channels, 128 -> 32 -> 8 -> 2 samples
+ *  - Global average pooling
+ *  - Dense layer, 64 -> num_classes, followed by the softmax of the library, with exp(x) approximated by (1 + x/16)^16
+ *
+ *  Quantization
+ *  - Weights are int8, one quantization step per output channel. Batch normalization is folded into the convolution weights and bias
+ *  - Activations are int16, one quantization step per layer. Accumulators are int32
+ *  - The per-channel requantization from the accumulator to the next layer activations is a Q31 multiplier and a right shift
+ *  The model tables in cnn_classifier_q_model.c are generated by tools/cnn_quantize.py from the float parameters of the
+ *  library model, read from the library itself. tools/cnn_q_host_check.sh regenerates them and compares this implementation,
+ *  built for the host, with the library run by the R5F emulator (tools/r5f_emu) on the same inputs
+ *
+ *  Batching
+ *  cnn_classifier_predict_batch() runs up to max_batch inputs (e.g. one per zone) through each layer together:
+ *  the kernel of each (output, input) channel pair is loaded once and applied to every input of the batch.
+ *  The activation buffers hold [batch][channel][time], each channel row with the zero padding of the layer that reads it
+ *
+ *  The loops are plain C: the host build relies on the compiler autovectorization, there are no SIMD intrinsics
+ */
+
+#ifndef CNN_CLASSIFIER_Q_H
+#define CNN_CLASSIFIER_Q_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#ifndef CNN_CLASSIFIER_OPEN
+#define CNN_CLASSIFIER_OPEN
+#endif
+#include <source/alg/cnn_classifier/cnn_classifier.h>
+
+
+/* Network limitations */
+#define CNN_Q_NUM_CONV_LAYERS       (3U)    /* Number of convolution layers */
+#define CNN_Q_MAX_INPUT_LENGTH      (128U)  /* Maximum input length (num_frames) */
+#define CNN_Q_MAX_CHANNELS          (64U)   /* Maximum number of channels of a convolution layer */
+#define CNN_Q_MAX_CLASSES           (4U)    /* Maximum number of output classes */
+#define CNN_Q_MAX_BATCH             (8U)    /* Maximum number of inputs processed together */
+#define CNN_Q_ACT_MAX               (32767) /* Maximum int16 activation */
+#define CNN_Q_MIN_TOTAL_SHIFT       (1)     /* Minimum requantization shift, 31 + outShift */
+#define CNN_Q_MAX_TOTAL_SHIFT       (62)    /* Maximum requantization shift, 31 + outShift */
+#define CNN_Q_SOFTMAX_EXP_STEP      (0.0625f) /* Softmax of the library: exp(x) = (1 + x * 0.0625)^16 */
+
+#define CNN_Q_MEM_ALIGNMENT         (8U)
+#define CNN_Q_ALIGN(x)              (((x) + (CNN_Q_MEM_ALIGNMENT - 1U)) & ~(CNN_Q_MEM_ALIGNMENT - 1U))
+
+
+/* Quantized 1D convolution layer, with batch normalization and ReLU */
+typedef struct
+{
+    uint16_t numInChannels;         /* Number of input channels */
+    uint16_t numOutChannels;        /* Number of output channels */
+    uint16_t kernelSize;            /* Kernel size */
+    uint16_t stride;                /* Stride */
+    uint16_t padLeft;               /* Number of zeros before the input */
+    uint16_t padRight;              /* Number of zeros after the input, padLeft + padRight less than kernelSize */
+    const int8_t *weights;          /* Weights, [numOutChannels][numInChannels][kernelSize] */
+    const int32_t *bias;            /* Bias per output channel, in accumulator units */
+    const int32_t *outMult;         /* Requantization multiplier per output channel, Q31 */
+    const int8_t *outShift;         /* Requantization right shift per output channel, applied after the multiplier */
+} CNN_Q_convLayer;
+
+
+/* Quantized model */
+typedef struct
+{
+    uint16_t inputLength;                       /* Input length, i.e. num_frames */
+    float inputScaleInv;                        /* Inverse of the input quantization step */
+    CNN_Q_convLayer conv[CNN_Q_NUM_CONV_LAYERS]; /* Convolution layers */
+    uint16_t numClasses;                        /* Number of output classes */
+    const int8_t *denseWeights;                 /* Dense layer weights, [numClasses][numOutChannels of the last layer] */
+    const float *denseScale;                    /* Dense layer output step per class: weight step x last layer activation step */
+    const float *denseBias;                     /* Dense layer bias per class */
+} CNN_Q_model;
+
+
+/* Algorithm instance */
+typedef struct
+{
+    const CNN_Q_model *model;       /* Model */
+    uint16_t maxBatch;              /* Maximum number of inputs processed together */
+    uint16_t layerLength[CNN_Q_NUM_CONV_LAYERS + 1U];  /* Input length of each layer, and output length of the last one */
+    uint16_t rowLength[CNN_Q_NUM_CONV_LAYERS];         /* Input row length of each layer, with the padding */
+
+    int16_t *actA;                  /* Activations ping buffer: network input, and outputs of the even layers, maxBatch x actAStride */
+    int16_t *actB;                  /* Activations pong buffer: outputs of the odd layers, maxBatch x actBStride */
+    uint16_t actAStride;            /* Size of one input of the batch in actA, in int16 */
+    uint16_t actBStride;            /* Size of one input of the batch in actB, in int16 */
+    int32_t *acc;                   /* Accumulator rows of one output channel, [maxBatch][inputLength] */
+    int32_t *pooledSum;             /* Sum over time of the last layer activations, [maxBatch][CNN_Q_MAX_CHANNELS] */
+
+    uint8_t *scratchBlock;          /* Internally allocated scratch block (NULL if provided by the application) */
+    uint32_t scratchBlockSizeInBytes; /* Size of the internally allocated scratch block */
+} CNN_Q_moduleInstance;
+
+
+/* Model tables, generated by tools/cnn_quantize.py into cnn_classifier_q_model.c */
+extern const CNN_Q_model gCnnClassifierQModel;
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
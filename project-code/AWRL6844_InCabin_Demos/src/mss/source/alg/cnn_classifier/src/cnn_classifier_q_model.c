@@ -0,0 +1,921 @@
+/* Generated by tools/cnn_quantize.py from alg_cnnClassifier.xwrL684x.r5f.ti-arm-clang.release.lib, 400 synthetic calibration spectra (seed 1), do not edit */
+
+#include "cnn_classifier_q.h"
+
+static const int8_t conv1_wt[80] =
+{
+    -34, 103, -29, -22, 127, 13, -49, -106, -127, -39, 127, 53, 27, 78, -2, 127,
+    7, 81, -51, 115, -123, 97, -16, -60, -127, -13, 107, -102, 72, -127, 38, -83,
+    -127, 72, 34, 118, 117, 17, 127, 35, 101, -127, -100, 57, -28, -65, -18, -127,
+    34, -82, 55, -1, -127, -42, -36, 48, -85, -127, -19, 51, 41, 127, -85, -93,
+    -98, 127, 90, 94, 46, 114, 22, 43, 87, 127, -14, -114, -6, 46, -127, 107
+};
+
+static const int32_t conv1_bias[16] =
+{
+    -150683, 234825, -258333, -221509, 192710, 57458, 58986, -371847, 77705, 217054, 132068, 116305, 87237, -434450, -300019, 83290
+};
+
+static const int32_t conv1_mult[16] =
+{
+    2068318873, 2143252266, 1119684278, 1161126136, 1476203271, 2089169581, 1839377386, 1558358737,
+    1506801254, 1279949854, 2090413030, 1172803834, 1235371897, 1348540946, 1104365523, 1651546466
+};
+
+static const int8_t conv1_shift[16] =
+{
+    7, 8, 7, 7, 7, 6, 6, 8, 6, 7, 7, 6, 6, 8, 7, 6
+};
+
+static const int8_t conv2_wt[2560] =
+{
+    68, -10, -76, 47, 56, -18, -89, 62, 85, -103, 96, -127, -13, -116, -58, 39,
+    39, -55, -50, -82, -117, 53, -54, -2, 85, 24, -43, 2, 16, -61, 26, -9,
+    -28, 22, 42, -59, -109, 19, 33, 24, -29, -36, -23, -33, 45, 107, -58, 57,
+    -85, -125, -37, -14, -62, -71, 16, -61, -15, 50, 6, -14, 31, -25, -72, 53,
+    3, 14, -118, 74, -91, 84, -49, -21, 61, -73, 33, 96, 23, -108, 15, -78,
+    33, -42, 15, -58, 102, -42, -100, -108, 18, 87, -33, 45, -44, -64, 11, -23,
+    101, -32, 32, 24, 6, -5, -57, -82, 44, -109, 53, -17, 61, 92, -40, -81,
+    42, 39, 7, 23, -55, 57, -20, 97, -49, 61, 56, -90, -16, 80, -30, -44,
+    19, 71, 48, -3, 43, 39, -23, 44, -6, 76, 56, -83, -44, -118, 2, -127,
+    -51, 117, 31, 87, 13, -41, -68, 94, 68, 119, 49, -91, -64, -105, -95, -68,
+    -64, 38, 93, -35, -78, 49, -14, 34, 31, -24, 32, 34, 10, -50, 8, 51,
+    -10, 56, 48, 99, -43, -40, -26, -101, 17, 16, -10, -13, 6, -43, -48, -73,
+    -47, 84, -4, 51, -33, -95, 35, -23, 39, 64, -75, 25, 12, -5, -15, 90,
+    -67, 2, 5, -98, 26, 61, -31, -16, -92, 13, 65, -68, -127, -55, 39, 54,
+    22, -6, -32, 36, 22, 38, -73, 44, 43, 86, 70, -59, 97, -61, -61, -99,
+    -17, -17, 9, -21, -57, -10, -87, 74, -34, 41, 59, -61, -51, -86, 46, -62,
+    51, 0, 50, -30, -79, -63, 38, 39, 77, 18, -39, 87, 60, -127, 37, -50,
+    -48, -69, -51, 35, -22, -52, 3, 69, 25, -5, -5, -25, -84, 33, -19, 7,
+    90, 92, 57, -70, 55, 74, 9, 70, 34, 48, -66, -40, -76, 77, 17, 77,
+    -34, 15, 13, 77, 64, 16, -23, -5, -42, 35, 34, 75, 18, -57, 50, 65,
+    -50, -18, -13, 8, 11, -35, -15, 40, 93, 45, -8, 38, -29, -11, 9, 53,
+    -10, 16, -7, 17, -86, 49, 39, -19, -50, 29, -19, 6, 16, 50, 39, 62,
+    -79, 7, -19, 2, 24, 22, -76, -38, -58, 127, -2, 12, 55, -80, -31, -27,
+    90, -14, -46, 49, 27, 52, 86, 27, -37, 13, 80, -44, -5, 63, -50, 27,
+    -19, 22, -30, -62, 80, 43, 29, 33, 11, 7, -41, -25, 10, 59, -33, 12,
+    54, -65, 13, 20, -61, -56, -118, -50, -31, -95, 76, 50, 44, 62, -45, -77,
+    -51, 25, 82, -98, -18, -117, 6, -51, -84, 65, -52, -44, -33, -65, 37, 61,
+    103, 102, 30, -52, 74, -29, -57, 6, -121, -77, -91, -56, 41, -98, 35, -71,
+    16, 45, -50, -63, -42, -43, -8, -127, -23, -52, -50, -73, -59, -21, 59, -24,
+    95, -51, 35, 17, -100, 25, -90, 8, 83, -15, 17, -51, -51, 29, -49, 49,
+    -37, -3, -36, -46, 3, -57, -56, -93, -72, 39, -5, 68, 80, -37, -50, -2,
+    -32, 56, -46, 64, 32, 47, -43, -125, -83, -10, -97, 1, -38, 41, 78, -67,
+    -24, -5, -97, -86, -83, 65, 84, -18, -23, 30, 33, 26, 49, 68, -79, 62,
+    -127, -105, 54, 22, -16, -33, -86, -32, -49, 79, -91, -98, 29, -30, -94, 16,
+    55, 53, -47, -22, -20, 20, 49, 78, -78, -46, -25, 90, -7, 69, -63, -69,
+    92, 59, 25, -19, -60, 4, 23, -124, -93, -28, 57, 14, 80, -74, 0, -48,
+    -103, 65, 10, -67, -104, -48, -121, 6, -36, 45, -33, -16, -82, -88, -56, -58,
+    -71, -30, -111, -90, -103, 65, -43, -7, -29, 46, 49, 127, 5, -7, -50, -84,
+    -85, -57, 55, -123, 45, 20, 80, -18, -86, 46, -19, -23, 54, 79, -55, 41,
+    112, -79, 38, 64, -9, -12, 70, 85, 49, -49, -27, -64, -24, -99, -110, 0,
+    44, -55, 23, 16, 41, 47, -25, -65, -86, 17, 39, -8, -8, -14, -56, -63,
+    -46, 28, -36, -35, -56, 60, 10, -5, 33, 77, -39, -70, -62, 36, 22, -73,
+    12, -15, -29, -55, 27, -68, 61, -2, -57, -81, -58, 16, -68, 102, -6, 88,
+    -40, -78, 47, 22, 77, -68, 41, -18, 92, 84, 29, -76, -38, -80, -12, -94,
+    65, 80, 1, -1, -72, -22, -6, 0, 38, 95, 4, -5, 127, -61, 27, 42,
+    3, 110, -62, 5, 104, -59, 93, -70, 12, 103, 67, -3, 40, -113, -61, -97,
+    85, -113, 4, -89, 27, 45, 74, -20, 115, 63, -85, -92, 97, -123, 60, -123,
+    53, 17, 69, 121, -79, -103, 70, -5, -71, -88, -71, -51, 120, -41, 39, 102,
+    -36, 69, -12, -27, 50, 9, -88, 126, 10, 19, -19, -50, 95, -23, 8, 63,
+    96, -40, -58, -36, 4, -27, -53, 35, -41, 101, 4, -9, 12, 46, 86, 127,
+    -22, -61, -31, 42, -18, 72, -99, 101, 65, 34, -24, -68, 20, -82, 54, -15,
+    -27, 83, -44, 67, -88, -47, 80, -7, -47, -38, 43, 15, 63, -78, 28, 17,
+    -7, -37, -41, -14, 63, -10, 61, -44, 18, -90, 99, 50, 72, -79, 60, -15,
+    -45, 94, 19, -31, 34, 15, -52, -75, -95, -1, 95, 4, -22, -7, 38, 94,
+    -70, -32, 39, -17, -62, 32, 66, 74, 24, 4, 6, 97, -33, -37, 81, 127,
+    89, 63, 45, 43, -29, -25, -60, 83, 81, 90, -96, -100, -67, 11, -104, -116,
+    -94, 32, -98, 19, 29, -100, -64, -42, -94, 45, -9, -77, 59, 69, -56, 101,
+    -23, -64, 57, 89, 61, -13, 53, -13, -18, 127, 31, 56, 75, -82, 42, -27,
+    -100, 25, 1, -91, 14, -58, 82, -87, -30, 104, -78, -26, -39, 55, 51, 80,
+    -113, -76, 31, -89, 56, 12, 66, -69, 65, 52, 80, -4, -44, -42, -50, -23,
+    -42, 18, 80, -64, -86, 86, 117, -19, -75, 88, -62, -25, -25, 5, -104, 31,
+    -89, -96, -32, -79, 87, 23, 10, -22, 20, 52, -54, -102, 39, 6, -31, 81,
+    -4, 81, -15, 104, 24, 27, -127, -19, -17, 62, 30, -44, 26, 72, -92, -61,
+    82, -83, -83, -11, 110, 46, -79, -44, -47, -20, -86, 100, 52, 93, 85, 91,
+    -66, -14, -111, -121, -126, -100, -72, -19, -35, 3, -78, 22, 9, -54, -68, -80,
+    -59, 27, 49, -31, -7, -50, 63, -43, 33, -1, -25, 24, -45, 44, -39, 94,
+    15, -33, 64, -44, 62, 57, 20, 64, 39, 26, -68, -56, -48, -43, 15, 23,
+    -83, -16, -17, -43, -69, 35, 52, 94, -33, 21, -27, 64, 125, -45, -42, -37,
+    -36, 91, -23, -76, -58, 65, 127, 16, -107, -19, -85, 119, -79, 27, 58, 53,
+    112, -71, 66, -66, -41, 36, 77, 7, -30, -71, -16, -16, -24, -37, -22, 47,
+    24, -112, -89, -7, 62, 47, 116, -15, -55, 56, 40, 29, 66, -4, -5, -23,
+    24, 45, -74, 45, -36, 31, -24, 8, -85, 69, -85, -68, -31, -70, -52, -80,
+    48, -31, -50, 19, -56, -98, -25, -59, 73, 42, 65, -12, -3, 47, 103, 7,
+    -29, 0, -27, -61, -11, -76, 9, 92, 13, 21, -48, -29, -79, 84, 74, -119,
+    -127, 3, 91, 63, 54, 77, -53, -12, 56, -19, -66, 95, 88, 77, 99, -23,
+    -75, 1, 58, -79, 27, 111, 9, -49, 127, 72, 60, -31, -56, -47, 29, -80,
+    -12, -102, -104, 81, 58, -12, 15, 26, 75, 64, 14, -18, 2, -67, 88, -8,
+    2, -96, -6, 96, -60, 40, -109, 40, 85, 61, -113, 120, -17, -79, 29, -9,
+    9, 63, 86, 3, -33, 22, -45, -10, 39, -114, -67, -19, 77, 1, -68, -43,
+    -67, -48, -47, 94, 37, 10, 74, -5, -51, 79, -84, -80, 20, -42, -106, -62,
+    -50, -79, -69, 49, 89, -32, 40, 101, 23, -8, 12, 19, -71, 10, -64, -57,
+    21, 70, 47, 2, 110, 87, 2, -14, 116, 10, 53, -104, -39, -63, -3, -7,
+    -36, 18, -11, 37, 101, 70, -93, 101, 78, 77, -105, 75, -6, 4, 6, 18,
+    115, 106, 15, 96, -28, -75, -12, -43, 11, -2, 42, 6, 89, -39, 37, 127,
+    14, 79, -77, 10, -94, -69, -25, -43, -11, -18, 42, 18, -95, -64, -103, -37,
+    -1, 29, -58, -41, -9, -79, 4, -33, 50, 3, 23, -43, -77, 71, 33, -17,
+    -63, 11, -63, -20, -75, -35, -24, 105, 119, 47, -62, -53, 26, 8, 59, -33,
+    -50, 23, -27, 75, 63, 74, 43, 43, 71, 62, 5, -28, -9, -9, 48, 91,
+    -2, 2, -8, -46, 4, -1, 99, -7, 74, -38, 66, 93, 26, 28, -111, -9,
+    37, 0, 88, 19, 2, 50, -79, -43, 11, -30, -48, 62, -127, -57, 8, 13,
+    -108, -103, -48, -77, 37, -19, -110, -33, 81, 2, 76, 116, 35, 17, 21, 42,
+    70, 40, 72, -5, 22, -96, 75, -78, -50, -31, 77, -66, -86, 54, -100, -64,
+    37, 72, 84, 43, 89, 58, 86, 22, -127, -81, -33, 9, -37, 22, 5, 48,
+    -96, -14, -38, 98, 86, 79, -25, 44, 84, -50, -106, -12, -25, 58, -92, -66,
+    5, -85, -61, 48, -79, 37, 108, -5, -28, 78, 120, 10, -22, -29, -92, -40,
+    -6, 81, 38, 16, -118, -92, 16, -7, 15, -89, 23, 28, 1, -83, 49, 70,
+    -49, 5, -67, -83, 71, -95, -72, 109, 26, 25, 100, -94, 85, 85, -70, -76,
+    32, -62, -79, -28, -24, -92, 38, 0, 104, -81, 88, 64, 88, -33, -4, -86,
+    86, 0, 38, 47, -55, 32, -10, 57, -104, 115, 67, -77, 95, 41, 26, 85,
+    3, -28, -96, 117, 80, -127, 41, 37, -18, -10, -40, -42, -114, -12, -94, -85,
+    12, 27, 58, -68, 56, 69, -2, 111, 67, -4, 66, 41, 123, -105, 93, 15,
+    -102, 120, 84, -118, -44, -25, 37, 110, -29, 38, 123, -26, 24, 83, 91, -108,
+    -84, 9, 64, -69, -37, -44, -16, -90, 71, -111, 118, -127, 69, 105, -17, 33,
+    -41, 63, 31, 27, 102, -22, 94, 15, 24, 29, 45, 15, 70, -1, 122, -114,
+    114, 57, 12, -96, 83, 55, -22, -62, -50, 15, 47, 122, -79, 6, -18, -60,
+    19, 37, -42, -31, -13, -66, -58, -74, -42, -49, 20, 51, -60, 61, 10, -72,
+    12, 19, -36, -4, -84, -87, -12, -90, 44, 123, 32, 29, 57, -2, 98, 19,
+    16, 86, -46, 74, -89, 72, 72, -63, -14, -49, 15, 105, -26, -75, -12, -2,
+    -3, -46, 23, 67, -127, 87, -42, -61, -45, -103, 73, 69, -11, 2, -22, -19,
+    21, -36, 17, 14, -19, 68, -80, -7, -55, -17, 7, -17, -53, -39, -79, 23,
+    31, 42, -61, 35, 47, -44, -13, 44, -75, 89, -67, 4, -85, -36, -37, 109,
+    -56, 14, -5, 69, -122, 108, 19, -127, -14, 2, -3, 58, 2, 65, 93, 37,
+    -21, -33, 106, -15, 61, 85, 75, 21, -59, 7, -43, 21, 0, -41, -52, -49,
+    65, 71, -13, 28, 38, -95, 18, -82, -117, -104, 116, 20, -71, 47, 35, -50,
+    52, -13, -57, -40, -23, -107, -22, 11, 41, -110, 17, -30, 52, 82, -43, 97,
+    3, 65, 55, -59, -57, -86, -72, -30, -114, -117, 19, 90, -87, -67, -61, -84,
+    31, -20, 11, 33, 65, -85, -79, -127, -112, -76, -49, 41, 106, 15, 77, -32,
+    25, 3, 43, 95, -68, 33, 8, 59, 96, -32, 100, -78, -19, 62, -75, -45,
+    -80, -30, 66, -20, -4, 42, 27, 70, 77, -36, -5, 18, 65, 54, -53, -41,
+    -28, -40, 57, 68, -7, 101, -85, 52, 3, 94, 61, -9, -42, -56, -39, -15,
+    -26, 77, -10, 20, 7, 55, -37, 67, 16, -75, 82, 93, -71, -6, 31, -64,
+    -86, -12, -80, 72, 69, 95, 96, 68, 49, -34, -69, -32, 16, -27, 42, -8,
+    79, 7, 63, -61, 62, 91, -59, 60, 41, 50, 68, 90, 2, 38, 9, 92,
+    -44, 77, -63, 60, 4, 58, -32, -22, 30, 117, 99, 37, 83, 55, 24, 127,
+    -81, -65, 64, -15, 34, 63, -27, -34, 11, 2, 6, -2, -83, 15, -17, -31,
+    -55, 118, 94, 66, -63, 31, -97, 80, 76, 120, -79, -33, 75, 16, 17, 82,
+    112, -86, -18, 19, 71, 112, 80, -30, 117, 72, 28, 79, 7, 99, 17, 82,
+    89, -33, 61, 87, 96, -73, -83, 23, -84, -69, -52, 59, -18, 117, 52, 102,
+    -1, -16, 54, 78, 127, 82, 118, 23, -11, -63, -12, 67, -93, 5, 7, 11,
+    44, -21, -87, -32, -38, 54, 31, -64, -52, -72, 55, 47, 71, -64, 11, -78,
+    37, -52, 42, -69, 5, -125, -106, 1, 74, 16, -60, 33, 37, -44, 69, -65,
+    -51, 16, 83, 74, -16, -127, 89, 95, -8, 56, 60, -62, -52, 77, -78, -64,
+    -43, 14, -79, 47, 37, 64, -29, -84, 62, 29, 45, 61, 30, -16, 49, 34,
+    36, 46, 75, 25, 74, -46, 31, -88, -61, 74, -8, -119, -106, -81, 37, -29,
+    -35, -66, 88, -45, -65, 65, -96, -99, -15, 97, 9, -8, -31, 74, -40, 108,
+    -95, 59, -97, -30, 5, -80, 68, -86, -111, 1, 79, 24, -64, 94, -38, -122,
+    -72, 93, 81, 0, 14, -104, -93, -111, 42, -39, -41, -19, -40, 6, -52, 39,
+    46, 83, -23, 84, -70, 56, -25, 63, -17, 55, -60, 127, 77, -36, -17, -47,
+    -55, -55, -78, 11, -4, -83, 7, -88, 36, -63, -75, 103, -49, 52, -47, 56,
+    47, 71, 37, 3, 20, -50, -8, 43, -34, -56, -46, 20, -99, -73, -39, -79,
+    17, 70, -62, -81, -95, -65, -99, -15, -20, 93, 12, -23, -66, 12, 25, -13,
+    -25, -59, 61, -54, 11, 71, -1, -33, 84, -102, 20, 93, 6, -10, -40, 76,
+    59, 0, -28, -97, 60, -78, -52, -39, -51, -118, 20, 57, -40, -52, -9, -63,
+    -11, -24, 60, 18, -36, 49, -18, -35, -64, 19, 56, -55, -127, -40, -1, -14,
+    55, 57, 36, 39, 47, 39, 14, 31, 4, 6, -54, -44, -92, -33, -55, 4,
+    -69, 84, 58, -79, 81, -68, -97, 22, 89, 55, 34, -27, -41, -8, -22, 93,
+    -100, 52, -28, -31, 24, 81, 73, 98, -107, -86, 112, -91, 42, 100, -73, 65,
+    -106, -23, -52, 115, 89, 74, 97, 74, 73, -50, 38, 37, -66, -44, 81, -118,
+    32, -78, 65, -72, -106, 18, -102, 62, 76, -58, -56, -127, -18, 100, 34, -71,
+    17, 71, -76, 26, 91, 53, -49, -24, 18, -88, -12, -67, -12, 55, -39, -7,
+    -103, 74, -79, -36, 22, 65, -69, 22, 127, 61, -104, -117, -17, -23, -16, -86,
+    -47, 70, 42, -32, 97, -83, -54, 116, -72, -37, -48, -94, -76, -24, -48, 34,
+    -58, 95, -47, -88, -4, 50, -24, 96, -8, -45, -31, 115, -52, -16, -58, -34,
+    0, 124, 96, 17, 43, -76, 32, 101, -8, -2, -68, 50, 106, 58, 10, 51,
+    52, 42, 15, -14, 86, 9, 18, 28, 66, -36, 31, 28, -34, -6, 62, -41,
+    77, 65, -57, -21, 66, 23, 52, 71, 56, -10, 36, -74, -24, 39, -40, -11,
+    -35, 34, 33, 95, 65, 28, -46, 8, -96, 64, 17, 64, 14, -40, -82, 63,
+    29, -81, 40, 46, -2, -17, -10, -55, -78, -36, 58, -15, 70, 46, -29, 52,
+    -31, -52, -51, 42, 54, 12, -58, -112, 34, 127, -94, 5, -106, 57, 31, 4,
+    19, -35, -3, 14, -74, 2, -23, 60, 1, -60, 17, -70, 6, 62, 70, 61
+};
+
+static const int32_t conv2_bias[32] =
+{
+    589295, -39290, 30650, -199391, -273441, 732371, 533376, 656991, 108520, -230695, -210508, 206795, 619095, -87447, -30888, 188190,
+    -230896, -202674, -46180, 116472, -620598, 276852, -20327, 166028, -714827, -873360, -8764, 475156, 397672, -131110, -66311, -214390
+};
+
+static const int32_t conv2_mult[32] =
+{
+    1943522160, 2004233956, 1413485958, 1438904637, 1317632790, 1993380490, 1344107717, 1954478730,
+    1873847241, 1770881434, 1509533651, 1105972311, 1189923473, 1912829821, 1718524093, 1200494896,
+    1700869092, 1982964813, 2119409643, 1138877078, 1312175923, 1946300286, 1431436875, 1409093640,
+    1330782372, 1979597137, 1200156454, 2103489901, 1550521084, 1361823759, 1113794860, 1334167216
+};
+
+static const int8_t conv2_shift[32] =
+{
+    8, 9, 8, 6, 6, 8, 7, 8, 6, 8, 6, 6, 9, 6, 6, 7,
+    7, 6, 9, 7, 7, 7, 6, 8, 7, 8, 6, 8, 7, 8, 7, 6
+};
+
+static const int8_t conv3_wt[10240] =
+{
+    55, -27, 39, 39, -72, 15, -56, -14, 36, -50, 31, 20, 48, 22, -3, -45,
+    -59, -67, 35, 84, -15, 19, 19, -29, 27, -35, 43, -30, -33, 47, -16, -21,
+    23, -14, -25, 57, -22, -48, -30, -4, 127, 46, -47, -26, 8, 10, -43, -29,
+    4, -26, -34, -82, -28, -36, -19, 37, 51, 47, -27, -4, 16, 6, -62, -3,
+    0, -56, -39, -28, -17, 52, 2, -94, 30, -18, -41, 44, -45, -45, -34, 32,
+    7, -29, 6, 28, 62, -1, 15, 19, 31, 8, -40, 24, 57, 65, 16, 63,
+    11, -30, -22, -51, 43, -54, -55, -23, 4, -27, 37, 48, -12, -1, 61, -15,
+    20, 42, -28, 59, -9, 27, -21, -56, -13, -10, 15, 22, 72, 48, -18, 35,
+    65, 56, -92, -27, -57, 41, 54, 39, 35, -40, -12, 22, 12, -2, 49, -15,
+    7, 18, 15, -52, -63, -43, -39, 7, -8, 64, 40, 54, -88, 29, 66, -18,
+    41, 71, -51, 4, -61, -54, -16, -26, -8, -40, -8, 46, 57, -61, -27, -29,
+    17, 9, 17, -30, 2, 8, -53, -17, -33, -1, -15, 73, -54, -42, 84, 26,
+    -37, -11, 26, 40, 33, 45, -64, -9, 4, 61, -16, -32, -89, -107, 34, -8,
+    47, -1, -87, -127, 45, 19, -23, -21, 28, -39, 44, 29, -73, -56, 2, 38,
+    44, -48, -45, 60, -39, -6, 93, -63, 29, 28, 53, -25, 90, 89, 2, 53,
+    37, 47, 1, 23, 70, -49, 80, 0, 69, 123, -14, -43, 49, 20, 60, -9,
+    19, 73, 32, 21, -9, -32, -12, -38, 51, 68, 6, -31, 63, 55, 81, -35,
+    46, -50, 39, 87, 11, 32, 7, 42, -90, -58, -58, 37, 72, 46, 21, -53,
+    9, 78, -7, -7, -42, -50, 12, 20, -68, -13, -5, 58, 70, 26, -58, 17,
+    44, -4, -32, -36, 60, -2, 94, 38, 11, 75, 39, 0, -46, -45, 68, 68,
+    23, -13, -41, -12, 44, 15, 20, -86, -65, -6, -44, 56, 58, 60, -47, -12,
+    56, 21, 12, -71, 8, -5, -71, -74, 2, -60, 51, 8, -2, 24, 53, -32,
+    36, 56, 43, -88, -34, -58, 10, -74, -55, 22, -18, -17, 89, 33, -10, -18,
+    21, -10, 58, 88, -43, 43, 50, 10, -2, -28, -2, -33, 14, 25, -33, -54,
+    -28, 27, 37, -66, 58, -76, -63, 22, 76, -22, 51, -21, -55, 49, 14, -19,
+    52, -18, 64, 11, 30, 21, -72, 8, 29, -119, 18, -39, 44, -12, 47, -20,
+    21, -71, -20, -31, 58, 127, 21, 19, 32, -24, 45, -46, -14, -82, 25, 6,
+    64, 99, 20, -46, -95, 47, 20, -18, 114, 73, 1, -21, 15, -52, 16, -53,
+    -76, -107, 106, -57, 49, 13, -51, -103, 34, -36, 38, -60, 26, -36, 60, 67,
+    2, 68, 11, 43, 0, -51, 52, -15, 53, -31, -76, 42, 13, -91, 37, 10,
+    67, -66, 66, 3, 27, 75, -20, -50, 7, -19, -56, 29, 42, 36, 47, 90,
+    -43, 55, 8, 8, 46, -28, -92, 3, 44, -13, -34, -68, -44, 27, 34, 6,
+    -4, 70, 11, -17, -65, 15, -37, -27, -31, 6, 63, 49, 53, 3, -40, -73,
+    55, 56, 80, 125, -22, 10, -31, -73, 26, 7, -76, 17, -34, 5, -46, 43,
+    -49, 102, -18, -27, -46, -74, -87, 127, 64, -36, -12, -38, -60, -49, 15, 77,
+    18, -55, 36, 111, -50, 81, -73, 19, -20, -60, 3, -39, 43, -58, -13, -5,
+    -50, -34, -7, -107, 44, 101, -60, -60, -91, -20, 58, 40, -56, 73, -29, -30,
+    -61, -27, 2, -71, -22, 11, 68, -38, 71, -15, -42, -12, 45, 6, -5, 38,
+    -37, 25, 27, -40, -46, -12, -50, 28, -86, -16, -15, -55, -22, -32, 65, -83,
+    -29, 7, -12, -24, 35, 42, 40, 18, -47, -49, -9, 33, 49, -27, -47, -98,
+    -51, 36, 50, 96, 18, -61, -81, 62, 53, 28, 59, -52, 62, 97, -12, -65,
+    -15, 22, 52, 73, -68, 96, -75, -72, -69, 16, 1, -6, 67, 15, 49, -2,
+    -33, -41, 106, -38, 54, -3, -27, 31, -127, -98, 80, 60, 70, 54, 33, 51,
+    23, -78, -18, 51, -109, -9, -32, -88, 9, 71, 35, 81, 30, -3, 56, 67,
+    -18, -11, 28, -24, -96, -53, -30, -110, 45, -100, -27, 8, 29, -4, -74, -38,
+    -103, 35, -36, 19, -19, -76, -30, -87, -55, -21, 7, 66, 43, 75, 0, 82,
+    -3, -19, 45, 22, 9, -18, -8, -70, -45, -87, 87, 26, 84, -8, -12, 15,
+    27, -2, 49, -59, 58, 36, -24, -33, -54, -64, -25, 67, -78, -79, 9, -62,
+    -27, -91, 22, -20, -3, 5, 15, 53, -34, -77, 34, -35, 91, -29, 56, -27,
+    -14, 30, 87, -43, 91, 50, -104, 76, 46, 18, -35, -25, -71, 0, 36, 19,
+    -49, 106, 12, 62, -36, -15, 21, 22, -16, -2, 33, 40, -40, -13, 23, 52,
+    30, 47, -2, -79, 5, -127, -15, 59, -77, 57, -50, -22, -48, -75, -21, -47,
+    -57, 0, -43, -34, 4, 7, -9, -29, -69, -19, -12, -25, -47, 72, 38, 13,
+    32, -44, 13, -31, -14, 9, 77, -2, -72, -4, -54, -28, -15, -50, -28, 39,
+    47, 76, 62, -72, 13, -75, -35, -6, -26, -30, -14, -30, -75, -5, 49, -23,
+    26, -69, 5, 8, -9, 86, -66, 1, -67, -2, -36, -2, -5, 40, 40, -74,
+    73, 22, -77, -51, -19, 19, 23, 38, -28, 57, 40, 1, 48, 39, -93, 71,
+    33, -1, 2, -80, -74, 63, -29, -12, 101, -26, -7, 3, -60, 19, 10, -16,
+    -22, -42, -1, 43, 49, 20, 90, -4, -63, 16, -60, 38, 59, -39, -23, 48,
+    -13, -4, -84, 1, -14, 12, -40, 30, -55, -13, 46, 78, 73, -46, 25, -65,
+    72, 17, -45, -26, 127, 66, 52, 47, -50, -80, -11, -80, -46, -6, 27, 119,
+    -7, 26, 60, -90, 54, -87, 62, -4, 79, 22, 36, -110, -55, -52, -100, 24,
+    55, -21, -61, 9, 92, 29, -64, -17, -34, -4, 76, 21, 88, -16, -47, -87,
+    59, -35, 20, 11, -12, -55, -7, 9, -41, 62, -77, 10, 22, 9, -2, -69,
+    -50, 38, -63, -97, -5, -19, -31, 104, -23, 86, 12, 69, -99, -64, 37, -10,
+    -84, -25, -37, 3, -52, 100, -28, 55, -85, 62, -68, -57, 10, 53, -46, 58,
+    -39, -108, -2, -46, 39, 118, 34, -21, -121, -66, 23, -107, -50, 10, -106, 12,
+    -24, 11, -75, 83, 18, -36, 4, 77, 120, 78, -34, 38, 11, 15, 7, -59,
+    20, -93, 117, 13, 89, 28, 46, 70, 86, 54, -59, 55, -32, 25, -10, 59,
+    -27, -49, -25, -47, -18, -48, 57, -37, -86, -51, 44, -46, 78, -13, -74, -28,
+    -14, -7, 53, -15, -10, -68, -42, 27, 53, 28, -36, -72, -47, 29, -89, 42,
+    127, 96, -4, 26, 59, 20, 34, -48, 13, 11, 45, -104, -63, 81, 48, -8,
+    29, 61, -40, 26, -117, 13, 5, 60, -88, 33, 71, 36, 67, 36, 35, -36,
+    -31, -91, 41, 25, 7, 15, -72, -5, 67, 27, -30, -3, 9, -5, -81, 86,
+    -97, 37, -17, -3, 64, 20, -97, 107, 5, 0, 67, 87, 84, -61, 75, -36,
+    12, 65, -22, -4, -68, 111, 13, 5, -65, -24, 98, 46, -78, -14, 24, 12,
+    -90, -42, 49, 36, 91, 5, -56, 9, -64, -24, 70, 61, -34, 37, -84, -23,
+    -43, -92, 33, 33, -54, -4, 50, -28, -8, 61, 43, 18, -29, 72, 14, -34,
+    -109, -31, -31, -36, -73, -28, -63, -13, -98, -21, -77, -2, 41, -104, -56, -46,
+    -44, -14, -69, -8, 29, 2, 12, 25, 41, -89, -20, 89, 56, 1, 45, -67,
+    0, -69, -8, 3, -30, -53, 68, -14, -12, 9, 17, -18, -61, 14, 51, 32,
+    59, 85, -10, 12, -7, -95, -79, -77, -15, 47, 10, 62, -83, -34, 56, -115,
+    -61, 41, 59, -11, -11, 62, 36, 21, -50, 2, 37, 79, 43, 15, -18, 52,
+    -39, -80, 107, 38, -2, 1, 76, -23, -31, -15, -71, -50, -40, -19, 61, 36,
+    35, 13, -62, 22, 73, -58, -64, 127, 87, -43, 71, -8, -75, -79, -41, 1,
+    -35, 20, -71, 12, -18, 102, -56, 32, -2, -67, -62, -78, -36, 42, 6, -74,
+    58, -39, 35, -25, -39, -31, 58, -24, -35, 36, 26, -51, 18, -44, -107, -22,
+    -43, 58, 11, -73, -99, -73, 61, 25, 0, 98, -61, 5, -4, 47, -11, -3,
+    -23, -63, 102, -85, 54, -36, 40, 57, -86, 21, -22, -79, -30, 11, 56, 22,
+    -51, 13, 14, 57, 50, -57, 35, 39, 68, 40, -12, 12, 100, -76, -30, -66,
+    -16, -108, -52, 18, 16, 3, -25, -6, 24, -54, -39, 24, 25, 93, 34, -46,
+    -32, -56, -24, -57, 5, 63, 59, 5, -101, 35, -46, -8, -14, 42, -57, 76,
+    -45, -39, -97, -52, -24, -46, 68, -5, -69, 60, -19, -18, 21, 11, -43, -8,
+    -31, -58, 24, 28, -42, -14, -127, 76, 51, 2, 62, 40, 28, 84, 67, -17,
+    -45, 62, -19, -3, -62, 16, 44, 41, 60, -78, 10, -5, -8, 19, -46, -80,
+    -59, -20, -43, -43, -13, -82, 0, -68, 36, -24, -43, 49, -52, -23, 39, -51,
+    -50, -15, -60, -2, -63, -89, 17, 16, -12, 98, 1, -36, 66, 63, -42, 8,
+    -16, -18, 39, 72, 47, -69, -45, -40, 4, 106, 34, 5, -122, 63, 82, 65,
+    66, -59, 18, -15, -6, -52, 11, 80, 61, 64, -5, -32, 0, -73, -57, -42,
+    -13, -35, -3, 10, -32, -19, -10, 0, 53, 2, 48, 80, 98, -10, 37, -95,
+    -15, -80, -86, -77, -111, 91, 8, 56, 27, 55, -37, 79, -8, -76, 70, 18,
+    -41, 31, -37, -99, 22, -33, -13, 26, -30, -60, 114, -74, -24, -89, 109, -17,
+    111, 21, 23, -54, -60, -12, -45, 100, -65, 91, 64, -74, -110, -50, -6, -106,
+    76, -75, -49, -9, -13, -97, -39, 26, 127, 5, 77, -77, -83, 79, -89, -104,
+    -1, -18, -73, 57, 2, -37, -17, -71, -66, 57, 67, 60, -47, 28, -55, -74,
+    24, 68, 32, 46, -69, -24, -24, 69, -69, 5, 5, -45, -64, -13, -28, -48,
+    56, 30, 61, -49, -4, -82, 1, -42, 44, 66, -21, 22, 59, 36, 54, -78,
+    3, -97, 27, 38, 24, 106, -1, 67, 29, -96, 2, -16, -60, -46, -11, 60,
+    -39, -43, -65, -10, 43, -57, -111, -24, -35, 80, -67, 81, 95, 4, -77, 12,
+    65, 35, 74, 31, 86, -98, 46, -92, 11, 42, 25, -42, 29, 82, 32, 69,
+    -51, -52, 59, 26, 57, -57, -63, -20, 34, -70, 45, 15, -19, 37, 18, -32,
+    -7, -19, 23, -72, -65, 40, 11, -81, -25, -38, -18, 37, -21, -46, 76, 80,
+    38, -3, -101, -26, 17, -44, -56, 59, -18, 12, -42, -80, 18, 26, 9, -8,
+    -33, 33, -3, 54, -13, 13, -116, -22, 10, 62, 61, 10, 12, 4, -3, 10,
+    14, 41, 20, 9, -84, -102, 2, 43, 74, 14, -6, -14, -62, 10, -2, -11,
+    -47, 36, -20, -33, -17, -27, 127, 5, -28, -75, 54, -23, -16, 19, 9, -34,
+    -25, 9, -21, 50, -41, 11, 88, -1, -16, 17, -53, -70, -68, 30, 23, 2,
+    3, 19, 106, 24, 2, 25, -3, 6, 43, 9, 69, -3, -50, -42, 82, -35,
+    -52, 78, -59, 13, 30, -1, -59, 77, 57, -15, 79, 33, 25, -69, 20, 12,
+    15, 26, -48, -3, -100, -1, -1, 48, 30, -29, -22, 49, 36, -19, 27, -61,
+    -58, 29, 20, -76, 127, 45, -79, 15, 65, -26, 6, -11, -6, -77, 44, 98,
+    23, 19, 72, -25, -52, 32, 24, -64, -84, -69, -50, 53, 30, -77, -14, 18,
+    -35, 8, -52, -48, -12, 34, -40, -59, -44, -39, -11, 49, 6, 12, 12, -62,
+    -22, -62, 101, 9, 51, -52, 2, -64, -13, -20, -53, -38, -75, 15, 17, -36,
+    -36, 43, -44, -7, 46, -67, 10, 22, 19, -1, 60, 35, -93, 41, 88, 1,
+    -56, 47, -70, 16, 77, 28, -108, 28, 9, 4, 41, -13, -47, -48, 49, 23,
+    18, -63, 39, -29, 11, 94, -80, -15, -103, -86, 72, -2, 8, -47, -9, -29,
+    7, -51, -19, 58, 21, -40, -7, -54, 27, 86, 8, -15, -17, -4, -12, -82,
+    -41, -31, -32, 14, -1, 53, 7, 16, 48, -67, 17, 25, -31, 20, -7, -39,
+    15, -13, -64, -1, 42, -56, 49, 43, 24, -90, 49, -14, 45, -81, -9, -97,
+    -50, -78, -31, 19, 11, 73, 23, -94, -49, 93, 88, 118, -41, 115, 29, 11,
+    -7, 44, 12, -32, -68, -107, -67, -16, -100, 126, -23, 115, -99, -22, -26, 2,
+    65, -5, -100, -85, 24, 60, 34, 99, 92, 88, -56, -23, 7, -24, 24, -66,
+    90, -91, -32, 82, -26, 18, -127, 109, 75, -45, -2, -44, -108, -77, -11, -4,
+    84, -29, -40, 82, -55, -90, 37, 65, -24, -16, -113, -66, 78, 40, 77, 87,
+    18, -111, 58, -99, 6, -30, -123, 71, 38, 40, -22, 50, -3, -14, 108, 15,
+    -49, 108, -16, -34, -26, 81, 14, -96, -51, 67, -7, -42, -63, -59, 48, -96,
+    14, -15, -30, -45, 66, -76, 77, -41, -65, 39, -100, 61, 13, 69, -104, 34,
+    50, 66, -9, 22, -121, 48, 22, 101, -23, 12, -3, -66, 102, -93, 20, -48,
+    100, 12, -86, 81, -101, -79, -50, 72, -34, -101, 65, -25, 61, 95, 44, 17,
+    62, -82, -63, -70, -75, -59, 105, -14, 56, 41, 61, 91, -41, -56, -81, -7,
+    -13, 4, 2, -26, -62, 1, 98, -62, 68, 103, -73, 9, 55, 57, 92, 25,
+    31, -34, 23, -77, 41, 73, 77, -93, 107, -68, 66, -47, -97, -96, -11, 5,
+    -102, -71, -49, 18, 24, -13, 47, 34, 127, -15, 98, 34, -63, 14, 29, 51,
+    -79, 22, 36, 70, 71, -40, -22, -37, -31, 27, 50, 104, -47, -15, 56, -64,
+    -57, 31, -82, -48, -25, -28, -102, -25, -15, -34, -91, 22, -16, 34, -43, -20,
+    -1, 31, -55, -68, -51, -71, -88, -58, 19, 27, 8, 100, 34, 53, 40, -97,
+    53, 45, 10, -77, 90, 37, 98, 18, -36, -82, -21, -30, 40, 67, -92, -66,
+    70, -30, -53, -67, 1, -63, -46, 111, 52, -37, 59, -24, -4, -1, -32, -40,
+    -28, -7, -2, 69, 56, -42, 90, 51, 70, 13, -91, 98, 16, -84, 92, -39,
+    35, -113, -78, 48, 53, -27, -67, 21, -10, 73, 46, 18, 60, -41, -29, -75,
+    -70, 21, -37, 7, 30, 29, -29, -56, 0, -51, 58, -70, 67, -30, 51, -58,
+    42, -39, 88, 7, 5, -31, -9, 21, -32, 5, -59, -58, 56, 0, -2, 59,
+    -4, 51, -21, 62, 17, 21, -127, 15, 64, 21, 36, 68, -7, 37, 9, 32,
+    -1, -47, -27, 46, -36, -27, 44, -17, 71, -9, 25, 30, -54, 82, -10, -68,
+    -67, 94, 15, -12, 2, -33, 89, -35, 5, 19, 27, 67, 38, 10, -7, 24,
+    -67, -2, 35, 59, -21, 36, 18, -48, -36, -57, 50, 33, 59, 81, 38, 1,
+    -6, 65, 50, 55, 0, -74, -33, 13, -24, 16, -30, -21, -112, -9, 56, 66,
+    59, 28, -31, 36, -1, -47, -79, -67, -53, 73, -48, 68, -49, 21, 22, -44,
+    63, 35, -66, -64, 16, -20, -34, 47, 34, 34, 12, 74, -23, 24, 1, 0,
+    -70, 71, -26, -73, 92, -87, -86, -7, -84, 92, 40, 30, -27, -2, -89, -24,
+    109, -71, -47, 62, 25, -2, 67, -61, 87, -19, 74, -11, 13, -102, 31, -22,
+    -71, 24, -97, 76, 41, -44, 49, 25, -81, -6, -88, 59, 83, 25, -15, 52,
+    -108, 80, 82, 96, 86, -72, 63, -20, 8, -50, -73, -58, 38, -10, 5, 48,
+    -92, 22, 37, -50, 54, 15, -31, 38, 57, -35, -85, 18, -8, -61, 74, 83,
+    24, 23, -2, -49, -86, 43, -28, -29, -104, 85, 39, 34, -77, -52, 61, 27,
+    -90, 22, -15, 80, -84, 76, -35, 15, -112, 39, -78, 24, -6, -2, 1, -53,
+    -64, 46, 42, -64, -23, -74, 83, 56, 100, 59, -4, -43, -85, 92, 60, 20,
+    -48, -52, 55, -16, -64, -25, -11, -76, -52, 9, -88, -23, 25, 87, 17, -7,
+    52, -29, -19, -58, 33, -93, -20, 87, 76, 77, -127, -57, -21, -6, -17, 14,
+    -8, 61, 28, 11, -111, 26, 90, 102, 53, -59, 71, -72, 47, -85, 42, -105,
+    65, -76, -83, -35, 37, -50, 99, -88, 6, 47, -8, -85, 33, -52, 48, -1,
+    57, 78, 64, 55, -2, 21, -78, -19, 30, -10, -55, -102, 13, 56, 37, -81,
+    6, 23, -38, -37, 45, -48, -17, 104, 4, 82, 52, -87, 101, 36, -51, -90,
+    -88, -54, -47, -2, 64, 14, 10, -80, -63, 12, -41, -1, -68, 1, 110, -18,
+    -110, -38, 1, 40, -41, -20, 37, 30, 77, -106, 73, -26, 5, 107, 98, 75,
+    2, 48, -6, -17, 47, -45, -65, -40, -30, -83, 14, 97, 66, -46, 71, -127,
+    70, -38, -76, 60, -16, -56, 23, -50, -38, -17, -92, -6, -58, -80, -45, -48,
+    32, -33, -4, 8, -60, 95, -87, 89, 68, 12, -92, -40, 123, 35, -44, 30,
+    -70, 9, 61, -23, -81, 27, 72, -68, 79, 10, -32, -36, 34, 4, -8, -28,
+    -1, -34, 22, 69, 15, -44, 62, -93, -107, -21, -9, 49, 40, 2, -71, -41,
+    -11, -4, 102, 100, -52, 35, 6, 1, 77, 56, 0, -127, -37, -22, 22, -88,
+    13, -26, -109, -89, -30, -15, -45, 76, 11, -50, -59, 69, 31, -7, -40, -15,
+    -2, 14, 48, 122, -14, -58, 115, 18, 95, 16, 28, -28, -68, 9, 45, 29,
+    -75, -34, 60, 0, -19, -36, -31, 94, -15, -63, 18, -108, 2, -33, 53, -79,
+    9, 14, -74, 2, 74, -66, 33, 57, -13, -66, -32, 101, -92, 58, -38, -56,
+    -6, -17, 74, -35, -82, -46, -92, 59, 20, 28, 31, 3, -59, -102, 44, -31,
+    5, -13, 15, -59, -58, 38, 103, -58, 64, 86, 62, 46, -24, 59, 26, 25,
+    36, -15, 73, 92, -87, 63, 5, 10, 107, 75, 106, -44, -63, -31, -44, 4,
+    -60, 86, 31, 60, -80, -89, -34, 19, 12, -35, -57, -84, -7, 61, 54, 94,
+    -29, -87, -64, -18, 3, -51, -67, 42, -13, 34, -62, -7, -3, 65, 85, -35,
+    -6, -35, 41, -81, 66, 53, -5, -73, -93, 64, 77, -9, 82, 29, -32, -54,
+    -72, -29, 26, 49, -26, 43, -54, 70, -94, -47, 8, -23, 65, -55, 28, -22,
+    -32, 68, -16, 83, 24, -103, -82, 1, 0, -54, 59, 70, 39, 73, 76, 18,
+    66, 21, 70, -58, -118, 0, -87, -63, 28, -37, 33, 39, 80, -31, -98, 32,
+    12, 72, -21, -19, -109, -69, 14, -59, 32, 30, -46, -26, 29, 55, -101, -58,
+    -63, 18, 49, 7, 48, -49, 0, 60, 45, 49, 72, -41, 40, -16, 89, 32,
+    -5, 30, 101, -7, -60, -72, 64, -89, 15, 94, 123, -4, -127, 17, 57, -4,
+    55, -40, 26, -9, 7, -59, -119, 75, -69, 73, 5, 2, -12, -105, 39, -38,
+    51, 50, 40, -20, 41, -70, -86, -5, -37, 71, -81, -59, 46, -37, 76, -40,
+    -11, -3, 9, 28, 79, 13, 51, -72, -19, -73, -10, 33, 27, -67, 19, 8,
+    -6, 40, -62, -74, -12, -31, -44, -22, -38, 52, 25, -59, 23, -71, 27, -67,
+    -16, 37, -63, -33, 24, 8, -46, -24, -16, -72, 6, -10, 47, 2, -15, 43,
+    45, 26, 127, -23, -16, 31, 17, 38, -57, -26, -51, -70, 25, -25, -84, -29,
+    -82, 1, -6, -68, 51, -126, -42, 9, -36, 61, 22, 73, -29, -22, 54, 68,
+    46, -61, -39, -33, -48, 72, -88, 28, 20, -62, 39, -44, 21, 17, -24, 6,
+    -66, 17, 56, -3, -75, 97, -84, -66, -74, -29, -41, 67, -61, 29, -7, -25,
+    -90, 54, 9, -72, -24, -10, 39, 65, 116, 42, -1, 39, -71, 56, 40, 49,
+    -27, -119, 95, 4, 17, 12, 78, -76, 32, -67, -70, 21, 2, 93, -68, -78,
+    4, 26, -56, -9, 10, 14, -35, -48, -60, -10, -8, 64, -37, 37, 46, -27,
+    -3, -79, -28, 5, 48, 23, -15, 49, -10, 74, -88, 19, 55, -30, 8, 100,
+    29, 72, 19, 57, -12, -108, 73, -20, -1, 23, -88, -38, 47, -99, -97, -34,
+    -31, 48, -58, -27, 42, 54, -3, 71, 41, -4, 88, 102, 5, 127, 87, -42,
+    53, -46, -14, 85, 34, 17, -40, -49, 44, 19, -45, -59, -29, 10, 7, -73,
+    -79, 44, -3, 4, -77, -99, -17, 66, 54, 32, 46, 89, -10, -43, -57, -55,
+    12, 12, 80, -21, -38, 85, -78, -16, -83, -71, -99, 5, 6, -80, -12, 43,
+    9, -32, -11, -27, -81, 83, 42, -2, -7, 3, 19, -54, 47, 28, 7, -80,
+    -100, 43, 16, 3, -90, -40, 79, 66, 82, -55, 22, -88, -27, 7, 52, -19,
+    -93, -48, 21, -98, 17, 8, 70, 66, -47, -45, -82, 34, 25, 43, -32, 16,
+    -15, 19, 62, -36, 14, -81, -20, 45, -42, -89, 3, 23, 42, 61, -69, 22,
+    -28, 26, -21, 41, -54, 55, -14, 29, 53, -50, 26, 60, 35, -52, -59, 29,
+    55, 17, 58, 14, -10, -47, 19, 60, 60, -8, 58, 47, 94, -7, -53, -3,
+    -17, -3, -67, -48, -35, 60, 84, 29, -26, -29, -73, 12, -52, 61, -102, -25,
+    -38, 32, 60, -49, 34, -93, -107, 119, 112, 38, -46, 49, 47, 11, -13, -80,
+    -23, 61, -21, -29, 28, -113, -49, -66, -100, -60, 58, -49, 102, -58, 2, -24,
+    4, 48, -61, -56, -89, -122, 30, 20, 41, -80, -9, -84, 63, 37, -56, 43,
+    23, 35, 97, 11, -21, 37, -106, 31, -71, 53, 58, -73, 8, -29, 66, -38,
+    -61, 46, 27, -47, -64, 89, -5, 55, 30, 50, 59, -36, 21, 46, 11, 5,
+    -104, 52, -1, -3, 30, -17, 48, -37, 42, 32, 10, -34, 127, 63, 65, -61,
+    13, -15, -68, -25, 57, 62, -98, -9, 44, -41, 17, -80, 22, 63, 39, -22,
+    22, -34, -36, 28, 113, -2, 95, 52, 19, 56, -3, -92, 1, 71, -19, 0,
+    53, 1, 50, 37, -29, 40, -44, -76, -84, -59, 75, 13, -63, -44, -48, 52,
+    -12, 21, 65, -47, -54, 50, -84, -81, -81, 38, -3, 30, 48, 75, 43, 42,
+    -75, -66, 110, 44, -13, -76, -32, -67, 5, -64, 36, 47, 91, 22, -51, 54,
+    -31, 47, 30, -78, 47, -84, -63, 12, -33, -28, -45, 37, -62, -55, 14, -76,
+    96, -94, -50, -35, 38, 100, -12, 14, 67, -33, -7, -78, 80, -51, -73, -29,
+    77, -76, -60, -13, 39, 22, 25, -97, -127, -113, 7, 63, 7, -3, -20, -14,
+    -68, -2, -29, 37, -63, -48, -95, -43, 28, 43, -4, 36, 44, 104, -58, -24,
+    -108, 1, 3, -24, -46, -45, -45, 43, 39, 35, -49, -86, -109, -26, 20, 23,
+    -13, -68, -24, -36, 64, 55, 123, -24, 45, -95, 52, 35, -10, 23, -14, 54,
+    -63, -11, -46, -56, -41, -36, 46, -121, 46, -61, 88, 8, -10, -83, -55, -11,
+    127, 16, -85, 110, -18, 56, -62, 64, -120, -76, 60, 44, 101, 27, 5, 50,
+    92, 96, 88, 42, -34, -121, -66, -120, -37, 94, -58, 83, -78, -27, -11, -68,
+    66, -57, 95, -33, -65, 57, 118, 78, 51, 62, 84, 92, -78, 9, -65, -19,
+    29, 55, -60, 55, 87, 92, 110, -68, 86, 61, 71, -21, -36, -110, -22, -92,
+    -31, -32, 111, -71, 50, -28, -76, -68, 40, -48, 62, 22, -53, 81, 98, 20,
+    59, 19, 62, -111, 76, -80, -97, 37, -74, 55, 85, -81, 54, 28, -20, 102,
+    -95, -88, 18, 58, -35, 121, -119, -43, 52, -122, -107, -79, 88, 76, -79, -74,
+    14, 68, 122, 56, 112, -17, -55, 10, 11, -61, 94, 87, 27, 43, -70, -108,
+    -100, 42, -42, 33, 69, 60, 60, -118, -64, -17, 49, 7, -109, 69, 62, -7,
+    -57, 58, 5, 45, -60, -45, -57, -10, 17, 7, -52, 24, -25, 30, -20, -31,
+    -42, 11, -19, 74, -52, -45, 38, 62, -13, 15, -68, -6, 80, 62, 10, -19,
+    -23, 4, 33, -8, -17, 16, -26, -34, 98, 44, 10, -24, 7, -6, -48, -23,
+    -60, 48, -127, -91, 22, 5, 5, -44, -24, 15, 47, 12, -2, 73, 31, -38,
+    -49, -110, 19, 14, -8, 64, 120, -114, -74, -51, -59, 23, 3, 66, -29, 32,
+    16, 66, -13, -15, 11, -35, 20, 13, 44, 14, 37, 46, -25, -33, -42, 50,
+    34, 38, 20, -10, 4, -17, 10, 28, 3, 32, 4, -34, -17, 45, 69, -37,
+    8, -34, 10, 23, 45, -2, 5, -37, -55, 19, -41, -19, 71, -44, -1, 62,
+    58, 40, -29, 7, 35, -2, -30, 34, 22, -3, -3, -38, 5, -48, -39, 50,
+    57, -3, 20, 6, 65, 60, 30, 48, -58, 19, 57, 2, -62, 24, -18, 34,
+    -127, -75, 26, -14, 7, 7, -77, 55, -5, 77, 17, 66, -46, -58, -52, -88,
+    -57, 38, 34, 63, -65, -15, 72, 7, 46, -7, -54, -3, -13, 68, -35, -37,
+    -51, 62, 39, -38, 34, -43, -7, 78, -27, -72, 19, -69, -74, -71, -17, 29,
+    -12, -34, -40, 54, -58, -63, 28, -28, 52, -11, 0, 61, -47, 49, 75, 20,
+    9, -20, 20, -49, 61, -41, 4, 50, -7, -26, -9, 65, 26, 51, -11, -41,
+    -37, 35, 20, -24, -4, -98, 41, -95, 57, -54, 9, 40, 1, 31, -18, -26,
+    92, 62, 52, 57, 15, -69, -10, 65, -50, 71, -47, -13, -33, -22, 98, -91,
+    12, -46, 9, -17, 64, 52, 9, -76, -6, 49, 11, -45, -7, -58, -9, -24,
+    -35, 17, -94, -64, 36, -68, -61, 63, -2, 74, 15, -3, 6, -51, 55, 28,
+    42, 31, -34, -89, -24, 69, -2, -31, -45, -39, -54, 0, -42, -35, -58, 0,
+    21, -9, -27, -64, 81, -19, -49, 56, 43, 29, 18, -15, 60, -55, 49, 88,
+    68, 5, 38, 99, -72, -9, 19, -16, 22, 38, 12, 41, -78, -34, -25, 12,
+    20, 55, 4, 9, 47, 41, 28, -77, -84, -57, 58, 2, -32, -29, -70, 50,
+    -58, 82, 20, -37, 43, -51, -9, -3, -76, -54, -33, -28, 20, -25, -4, 18,
+    -60, 8, -5, -69, -41, 44, -84, -24, -13, -50, -34, -31, -39, 4, 1, 46,
+    19, 20, 11, -4, 67, 38, -26, 29, -18, 127, -44, -24, -16, -10, -49, -31,
+    -35, -67, -52, 40, -71, 78, -64, -19, -13, 23, -23, 38, -11, 23, -48, 91,
+    75, -6, -12, -47, 18, 33, 49, -15, 79, -57, -99, -86, 85, 48, -57, -74,
+    1, -2, 97, -10, -26, -33, 4, -14, -56, 74, -20, 30, 27, -18, 22, -30,
+    -70, -9, -61, -54, 4, -54, -32, 69, 7, 32, 53, 0, 61, 47, -36, 77,
+    -127, -41, -93, -26, -59, -60, 49, 103, -38, 52, 53, -74, 48, 63, -99, -80,
+    -33, 58, 73, -82, -60, -74, 28, -11, -48, -35, -48, 92, 43, 39, 66, -57,
+    44, 86, -49, 48, 85, -47, 34, 0, 20, -84, 54, -55, -26, 12, -40, -40,
+    22, -37, -51, -105, -73, 45, 67, -20, -40, 8, 123, 85, 5, 67, -48, -88,
+    -34, -58, 41, -47, -41, -54, 21, -77, 22, -76, 11, -28, 62, -73, -58, -58,
+    -30, -30, -60, 18, 73, -30, 36, 14, 14, -97, -16, 60, 55, 96, -7, 34,
+    -27, 11, 50, 30, 5, 39, -90, -64, 62, 38, -80, -37, -84, 77, 15, -33,
+    11, -73, 19, 25, 76, 41, 5, 78, 7, -44, 47, 70, -32, -32, -37, -82,
+    58, 32, -15, -33, 19, 71, 14, -57, 4, 56, -21, 106, 45, 86, 10, -37,
+    101, -86, -65, 89, 26, -48, 45, 71, 92, 28, -6, -69, 66, 34, -47, 95,
+    -65, -104, -71, 66, 28, 8, 19, 5, -62, -8, 9, -34, -73, -34, 9, -83,
+    30, -48, 20, -52, 37, 127, -59, 29, -52, 62, 75, -19, -13, -59, 92, 43,
+    39, -2, -86, -25, -45, -39, -11, 23, 57, 63, -32, 7, -51, 7, -14, 17,
+    -33, -14, -84, -59, 47, 22, -62, -46, -52, 54, 29, 11, -63, 68, -6, 69,
+    -47, 43, 20, 27, -54, -32, -39, 27, 54, -15, -11, -2, -65, -3, -103, 2,
+    31, 67, 45, -3, -47, 3, 95, -34, -25, -36, 25, -44, 26, 39, 34, 16,
+    46, 58, -2, -2, 63, -88, -31, -50, 68, -33, -18, 10, -15, 48, 93, 14,
+    62, 47, 8, -43, 71, -20, 2, -27, 14, 54, 92, 16, -105, 45, -2, 73,
+    41, 46, -53, 60, 12, -17, -82, -34, 16, 61, 59, 43, 10, 34, 49, -23,
+    39, -28, -13, 26, -15, 12, 10, 2, -12, -49, 35, 13, -55, -38, -26, -36,
+    -17, -31, -50, 5, 73, -23, -48, -42, 13, -65, 6, -46, 58, -13, 15, 127,
+    79, 8, -55, -78, -24, -30, 58, 46, 2, -61, -4, 46, -11, -32, -38, 3,
+    -57, 30, 15, 28, -18, 54, 34, -78, 33, 43, -14, 50, 75, 52, 32, -66,
+    79, 36, 116, 52, 16, 25, -32, 8, -48, -29, 25, 29, 10, -58, -76, -34,
+    72, 45, -37, -71, -26, -118, -95, 19, -27, -27, -25, -78, 8, 37, -25, 35,
+    17, -33, -57, -51, 53, 28, -4, -26, -48, 4, -2, 72, -49, 43, -44, -1,
+    -10, -54, 20, -77, 45, 23, -14, -15, -30, -102, 48, -43, -16, -44, -37, 74,
+    33, -10, -20, 40, 43, 45, 40, 25, -45, 87, -38, -5, -90, 54, 39, -29,
+    39, 11, 70, -43, -15, -25, 36, -22, 4, -12, -39, 24, -14, 41, -27, 73,
+    -74, -57, -55, -44, 30, 49, -22, 15, -98, -73, -59, 43, 52, -95, 29, 16,
+    -51, -30, 34, -77, 75, 80, -62, 22, 30, 25, 82, -24, -42, 1, -67, 16,
+    68, -26, 27, 36, 58, -40, -33, 15, 24, -10, 39, -31, -78, -31, 39, 69,
+    -39, -89, -76, 46, 91, 36, 72, -2, -94, -14, 61, 71, -89, 28, 32, -97,
+    -85, 8, -19, 36, -42, -8, 68, -94, 62, -69, 8, -24, -52, -24, -60, -45,
+    -75, 98, 34, 54, -58, -19, -16, 49, -27, 45, -36, 79, -76, 40, 61, -3,
+    45, 12, -63, 42, 91, 85, -5, 11, -100, -5, -76, 49, 8, 42, -39, -93,
+    -78, 2, -81, 66, 74, -2, 57, -9, 35, -17, -66, -14, -43, 61, 20, 57,
+    -71, -62, -55, -28, 45, -23, -40, -27, 118, -30, -20, -68, 10, -78, -66, -32,
+    -20, -26, 98, 26, 67, 76, 16, -60, -76, -45, -17, -12, 69, 127, 15, 13,
+    -88, -24, 77, -50, -52, -24, -16, -26, -34, -63, 53, 28, -70, -88, -98, 74,
+    -12, -42, 70, -39, -73, 28, 0, -50, -21, 38, 45, -3, -11, 29, 37, -49,
+    -6, 24, -20, 16, -5, 81, 8, 51, -39, -64, 42, -5, -2, -7, -23, -19,
+    -29, 13, -10, 49, 12, 60, 58, 4, 113, 18, 12, -31, -1, -36, -65, 90,
+    8, 18, -79, -60, 20, 53, -126, -13, 41, 23, 76, 13, 79, 52, 72, -44,
+    49, -77, -37, 19, -48, -40, 127, -49, -33, 6, -45, -13, -4, 13, -80, -40,
+    -18, 59, 85, 34, -9, -28, 53, -16, -10, 17, -20, 7, 40, -33, -25, 39,
+    50, 26, -61, 38, 43, -55, -18, -6, 26, 61, -93, 31, 14, -11, 28, -9,
+    33, -12, 102, 60, -1, -22, -33, 55, -47, 55, 44, 21, -82, -37, -9, 63,
+    -12, 79, -122, 15, 19, 60, -19, 22, 32, 44, -32, -26, 92, -53, -3, -7,
+    10, -33, -45, -20, 6, -27, 34, 14, -19, -13, -18, 12, -66, 41, -12, 38,
+    -42, -61, 27, 20, 21, 29, 36, 12, 63, 16, 25, 27, 9, 61, 72, -28,
+    -45, 49, 24, -46, -9, 127, -32, 20, -43, 19, 17, -10, 28, 1, 58, 38,
+    -30, 9, 16, 54, 46, -8, 11, -49, -34, 41, 54, 1, -25, 42, -42, -12,
+    -70, 7, 26, -39, 18, -20, -109, 47, -19, 18, 58, 26, -66, 42, 12, 28,
+    56, -5, 44, -38, -94, -39, 4, 5, -11, -40, -13, 27, 18, 6, -51, -76,
+    34, 68, 3, 18, -6, 1, 110, -16, -20, -60, -52, -31, 38, -56, -57, -25,
+    26, -8, -1, -14, 25, -25, 33, -33, 77, -4, -46, -44, 0, 4, -41, 36,
+    63, 15, 64, 33, 52, 15, -55, -48, 1, 59, 26, 0, -82, -54, 72, 25,
+    5, -36, 0, -6, -20, 40, 6, -4, 17, 63, 23, -21, 45, 6, 99, -39,
+    23, -28, -60, -64, -60, 73, 42, 36, 54, 49, 44, -55, -14, 39, 51, -25,
+    -33, 3, -59, -113, 123, -7, 24, -60, 26, 76, 12, 56, 78, -57, -96, 127,
+    -23, -24, 16, -101, -30, 11, 92, 31, 23, -104, -37, 73, 46, 30, -23, -62,
+    -63, 32, 60, 15, -10, 23, -61, 16, -1, 4, 57, 47, 14, 121, 15, 45,
+    -100, 25, 68, 122, 22, 81, -46, 3, -61, -73, -2, 19, 24, -30, -72, -34,
+    95, 74, -64, -54, -84, -113, 21, 95, -59, -28, -34, 74, 45, 64, -4, 81,
+    13, 3, -93, -84, 4, 50, -57, -12, -121, 4, -14, -86, 37, -52, 56, -34,
+    -64, -59, -21, 10, 64, 98, -25, -62, 28, -7, -47, 45, 6, -52, -97, 6,
+    73, 4, -28, -79, -9, -71, -2, 66, 64, 13, 37, -93, -96, 37, -45, 40,
+    -67, -60, 85, 29, 14, -24, 56, -43, -53, -84, -113, 51, 35, -33, 60, 40,
+    -107, -53, 63, 70, -10, -48, 19, -41, -87, 31, -30, 80, 29, 45, 62, -106,
+    -44, -20, 72, 58, 90, 22, 15, -41, 38, -74, 34, -87, 79, 13, 57, 14,
+    98, -26, -49, -38, 52, 8, -20, -29, 42, -62, 62, 24, 82, -65, -62, -48,
+    35, -20, 21, -32, -2, -34, 22, -102, -3, -3, 0, 76, 22, 69, 13, 56,
+    18, -18, 62, 64, -37, -65, 58, -15, 9, -23, 3, -53, -78, 29, -61, 15,
+    -98, 17, -67, 21, -8, -18, -56, -27, -74, 92, 48, 13, -52, -87, 67, 21,
+    -49, 64, -90, 13, 38, 17, -71, 39, -40, -22, -67, 40, -59, -80, 63, 48,
+    51, -73, 12, -65, 76, 82, 33, 13, -127, 1, 68, -3, -5, -50, 46, 32,
+    72, -88, -56, -10, 12, -36, 24, -31, 118, 18, 16, -58, -120, -67, 93, 6,
+    36, -62, -41, -66, -68, -62, 62, -76, 15, -9, -59, 39, 3, -45, -12, 44,
+    -49, 12, 66, 7, 28, 79, 102, 18, 71, -81, -35, 19, 59, -29, -91, -14,
+    -67, 8, 28, -65, 81, -85, 66, 72, -62, 15, 94, -88, -66, -55, 5, 87,
+    85, -2, 17, -65, -56, -32, -51, 33, 68, -80, 14, 31, -5, -71, 78, 76,
+    -13, 23, 40, -56, -61, 13, -101, -106, -110, 10, -5, -21, -50, -7, 54, -53,
+    -30, 62, 120, 99, -27, -56, 57, -31, -21, -44, 47, -59, 17, -57, -34, -76,
+    50, 118, -21, 64, 83, 15, -63, -38, -40, 68, 3, 53, -87, 10, 7, -49,
+    -34, -52, 44, 73, 109, -26, -15, -61, -6, 106, 67, 19, -42, 50, -65, -48,
+    -66, -25, -85, 50, -41, 101, -115, -79, -98, 38, 44, 68, 58, 35, 15, 54,
+    -10, -104, 17, -7, -18, 66, -95, -34, 11, -94, 4, 52, 9, -24, 64, -5,
+    38, 79, 127, 45, -33, 39, 90, 16, 41, -7, -14, 36, -96, 96, 45, 17,
+    29, -43, -42, 37, 85, 51, 19, -42, 26, 24, 50, 83, -58, 14, 7, -85,
+    -40, -6, -11, 1, -75, 13, 30, -48, -19, 59, 57, -51, 41, -29, -3, -87,
+    -58, 15, -30, 12, -7, -61, 29, 17, -4, -17, 3, 32, -43, 34, -26, 13,
+    58, 54, -36, 50, -34, 0, 55, -33, 99, 44, -41, 24, -36, 15, -6, 21,
+    35, -36, -127, -54, -5, -30, 15, 28, 58, 31, 24, 4, 17, -6, 14, 44,
+    0, -46, -62, -39, 44, 37, 15, -93, -31, -32, -8, 44, 65, -36, 48, -49,
+    28, -20, -30, 36, 36, -26, 60, -3, 42, 1, -43, 38, 21, -5, 52, 62,
+    -20, -15, -53, 38, -8, -27, -18, 75, 37, 34, 39, -8, -45, 61, 48, 3,
+    14, 17, 53, 17, -9, 58, -29, -19, 2, 16, -29, 38, 38, 64, -1, 12,
+    19, 90, -68, -12, 9, 30, -48, -1, -38, -19, 2, -23, -36, -2, -36, -29,
+    14, -50, 48, -25, -8, 31, 15, -2, 24, 49, -26, -66, -57, -24, -38, -30,
+    -28, -82, 81, -29, 79, 78, 38, -91, 63, -27, 50, 45, -32, 86, 52, 80,
+    4, 59, 80, -67, -46, -110, 68, 19, 56, 22, 5, -76, 45, 24, 5, 11,
+    48, 42, 40, -29, 71, 15, -52, -85, -78, -25, 73, 109, 126, 114, 116, -57,
+    -71, 18, 126, -22, -16, -87, -30, -56, 55, -40, -106, 0, 66, -71, -81, 3,
+    -17, 34, 11, -22, -16, -54, -26, 124, -25, 40, 33, -41, -11, -57, 10, -84,
+    103, -53, -37, -18, -52, 127, -58, -28, 7, -117, -6, -100, 20, -27, -34, -31,
+    64, -20, -116, 29, -27, -45, 27, -55, -18, 4, -28, -99, 24, 29, -43, -82,
+    45, 93, 76, -27, 55, 63, 14, 0, -4, -12, -52, 71, -35, 52, -29, 84,
+    -20, -15, 81, 22, -83, 2, 103, -107, -101, -97, 3, -108, -34, -23, 19, -38,
+    -49, 29, -1, -51, -25, -65, -25, 56, 4, 14, -33, 86, 6, -44, 44, 47,
+    -127, 14, 25, 33, -44, 28, -23, 62, -66, 4, 58, 34, -89, -75, 13, -74,
+    -29, -28, -93, -36, -21, 14, 80, 3, -56, -22, 68, 27, 35, 33, -31, 87,
+    -92, -27, 27, 94, -13, -12, 37, 64, -11, -38, 28, 7, 17, 30, -113, -79,
+    -99, -75, 52, -1, -90, 55, -16, 98, -21, -33, 60, 18, -28, -48, -45, 56,
+    24, 4, -73, 8, -91, 21, -67, -15, -31, -83, -88, -63, 83, 52, -87, 59,
+    -71, 70, 54, -38, -50, -113, 8, -75, 101, -64, 74, -55, -22, -16, 31, 2,
+    -66, -27, 26, -57, -51, 45, 21, 60, -92, -84, -22, -54, 21, 73, 85, 22,
+    0, -1, 51, 80, -48, 45, -49, -45, 22, 8, -88, 87, 58, 81, -10, 11,
+    -93, 84, 28, 27, -30, -11, -16, 7, -63, 40, 44, 64, -21, 32, -28, -47,
+    -30, 56, -21, -22, 52, -63, -79, -4, -50, 70, 37, 71, -55, -5, 51, -61,
+    -50, -57, 27, 69, -88, -77, 37, -46, 20, 37, 27, 49, 74, 84, 58, -45,
+    -33, -73, 10, 47, -80, 11, 30, 69, 3, -64, -6, 70, 114, 81, -55, 67,
+    51, 41, -55, -6, 12, 100, -1, 5, 57, 29, 70, -127, -109, -74, 14, 45,
+    22, -35, 28, -94, 45, -105, 60, 14, -42, -22, 114, 74, -63, -6, 73, 46,
+    34, -5, -66, 11, -102, -1, 22, -77, -32, 15, 81, -58, 61, 22, -58, 48,
+    -50, 2, -55, -12, 35, -5, -35, 21, 6, -106, 48, 101, 80, -68, 33, 58,
+    17, 8, 16, 78, -43, -29, 11, 35, -25, 102, 100, 74, 50, -76, -44, 25,
+    -70, 25, 1, -73, -48, -69, -9, 86, -13, 98, 93, -45, -74, -4, 19, 45,
+    -20, -71, 12, 103, -30, 34, -42, 34, 27, -38, -69, 41, 44, -53, 93, -85,
+    90, -3, -28, 64, -42, 13, 14, -88, 66, -65, 14, 37, -97, -64, -102, 60,
+    -50, -34, 7, -117, 99, 9, -53, -21, -29, 28, -32, -8, 61, -2, -13, 106,
+    -11, 14, -13, 15, 4, -108, -88, 74, 12, -52, 43, 10, -79, -59, 34, 5,
+    2, -65, 53, 4, 64, -15, -48, -52, -127, -20, 10, -33, -49, 67, 77, -84,
+    51, -25, 68, 8, -68, -66, 48, -62, -1, 3, -28, -1, -83, -20, 3, 5,
+    55, 116, 31, -73, -1, 64, -44, 94, 31, -73, 7, 61, -74, -39, -33, 1,
+    14, -53, 61, 13, 38, 46, -34, 39, -32, 49, 81, -14, 10, 21, 14, -19,
+    -14, -76, -9, -4, -20, 22, -92, -22, 56, 5, 10, -29, 17, 6, 3, 95,
+    -20, -13, -82, -5, -28, -7, -43, -89, 38, -28, -72, 1, 65, 28, -3, -56,
+    -7, -32, 68, 18, -35, 43, 21, -26, 10, 54, 59, -83, -19, 84, 33, -60,
+    -11, -41, 14, 47, 3, -11, -26, 10, -93, -8, -32, 24, 36, 14, 19, -1,
+    28, 62, 11, -11, -19, 70, 5, -81, -5, -43, 6, 89, -23, -96, 39, 16,
+    67, 5, 49, 51, -14, -85, 7, -7, 46, 34, -59, -11, -7, -96, 36, -67,
+    -1, -61, 13, -19, -37, 12, -83, -14, -54, 17, -24, 29, 30, 52, 69, -38,
+    57, 3, 15, -12, 33, -17, 47, -63, 84, 31, 4, -54, 22, -49, 50, -77,
+    -15, 127, 70, 15, 17, 21, -90, 18, -26, -62, 18, 61, 16, -107, -66, -14,
+    114, -16, -75, -28, -30, 33, -8, 26, -56, 22, 22, -80, -22, 84, 80, -49,
+    -57, 55, -25, 58, -16, 29, -47, -58, -51, 31, 57, -31, -20, -47, -126, 110,
+    34, -31, 43, 29, -4, -27, -18, -68, 57, 86, -98, 24, 68, 77, -4, -22,
+    31, -93, -63, -47, 2, -40, 102, -82, -39, -2, 22, 49, 13, 74, 23, -3,
+    38, -15, -87, 100, 48, 7, -17, 7, 65, 52, 34, -76, 51, -43, -55, -102,
+    35, 50, -53, -41, 46, -62, 79, -25, 63, -33, 33, -70, -69, 56, -2, -37,
+    -15, 43, -52, -17, -61, 46, -47, 15, 36, 85, 22, -29, 1, 6, 74, -60,
+    78, 57, 63, 34, 29, -60, -59, 40, 127, -5, 21, -65, -76, 22, -52, 30,
+    -65, 45, 11, -78, -5, 42, -28, 75, -18, 28, 10, -14, 36, -21, 12, -43,
+    66, -18, 29, 78, 41, 33, 83, -66, 39, 75, 49, -67, 27, -3, -65, 48,
+    18, -88, 28, -28, 73, -104, 9, -23, 32, 71, -51, 6, 72, 24, -74, -8,
+    83, 34, 35, 27, -44, 30, -53, 74, 32, 53, -39, 67, 55, -58, 66, -106,
+    11, -3, -5, 45, 44, 68, -3, -13, -14, -76, 12, -17, 119, 18, -60, 72,
+    37, 40, -94, -88, -55, -15, -52, -64, -25, -40, -29, 12, 93, -56, -7, 74,
+    1, 80, 4, 75, 6, -52, -48, 46, -9, 51, -27, -25, -24, 55, 48, -8,
+    40, -103, 51, -46, 53, -68, 20, -21, 16, 62, 26, -35, 71, -83, -61, 72,
+    -24, 43, -35, -23, -35, -65, -43, 17, -83, 17, -69, -28, -18, 33, -50, -34,
+    55, -71, -86, 25, -44, 68, -57, -3, -51, -50, 44, -25, -26, 56, 83, -7,
+    39, 28, 127, 33, 0, -50, -58, -26, 14, 52, -23, -91, 45, -53, -56, -53,
+    -57, 33, -15, -38, -68, 6, -91, 82, 51, -20, -2, -11, 54, -4, -61, -37,
+    -39, -13, -26, 26, -49, 110, -57, 30, -27, 21, -5, -34, -45, 75, 68, 54,
+    -1, -36, -18, 25, 64, 95, 63, -74, -83, -60, -34, 28, -59, -1, -62, 16,
+    -15, 52, -85, -9, -51, -75, 56, -24, 50, -46, -9, -20, -1, -32, -28, -21,
+    43, -4, 31, 4, 7, -46, 50, -11, 0, 62, 30, 65, 26, -11, -8, -4,
+    -65, -5, -30, 11, -13, -79, 11, -66, -1, -43, 4, -22, 88, 29, -65, -26,
+    -37, -9, 53, -49, -12, -69, -45, 35, 41, -53, -11, -3, -65, 38, -31, -5,
+    -5, 1, 19, 58, -43, -51, -2, -38, -13, 55, 14, 14, 9, 9, 4, 53,
+    -7, 46, -55, -30, -78, -29, -17, 2, 44, 39, -5, 19, -23, 60, -55, -14,
+    46, 60, -89, -82, -13, -24, 0, 12, 40, -47, 31, 20, 49, 83, 23, 48,
+    44, -25, -46, 50, -25, 63, 78, -46, 19, -16, 24, 1, 14, 39, -2, -48,
+    -41, 16, 0, -59, 57, -12, 34, -32, 65, -10, -48, 47, 27, -42, 38, -45,
+    59, 76, -35, -65, -34, -83, 38, 37, 34, 54, -73, -43, -4, -8, -19, -28,
+    10, -35, 0, 55, 49, 26, 14, -35, -71, -82, 48, 34, 86, -7, 30, 31,
+    -29, 80, -127, -29, -32, 32, -45, 29, 31, 34, 43, 40, 54, -37, 46, 18,
+    65, 64, 35, -3, -6, -3, 17, -23, 9, 0, 61, -1, -90, -18, 26, -20,
+    -49, 9, 21, -58, 56, -7, -25, 31, 23, -87, 18, -81, 41, 33, -30, 70,
+    -30, -39, -56, 24, 15, -53, -48, -37, 35, 11, -11, -97, -104, 13, 30, 74,
+    7, -71, -84, -26, 36, -11, -19, 12, -101, -22, 33, -4, -26, 55, -23, 8,
+    14, 23, 74, 30, -50, -35, 59, -61, 18, -9, -42, -46, -36, -38, 15, 40,
+    -13, 34, 35, -45, -4, -2, -127, 66, 33, -106, -14, 39, 57, 17, -89, 35,
+    9, -35, 17, -1, 32, 57, -127, 20, -28, 64, -17, 15, 28, -56, 21, -37,
+    -4, -61, 29, -5, -47, 46, -67, 30, -11, -13, -15, 2, 21, -44, -36, 37,
+    -34, -37, -55, -20, 55, 6, 3, 11, 37, -14, 4, -29, -20, 63, -51, -5,
+    40, -45, 55, 35, -35, 4, 39, 0, 77, 41, -9, 49, -82, 52, 45, -3,
+    -67, 39, 2, 5, -22, -54, -1, -33, -46, 12, 12, 72, -11, 16, 13, -1,
+    -52, 15, 10, 47, 26, 6, -21, 30, -29, 68, 39, 39, -34, 60, -25, 77,
+    65, 91, -61, -52, -5, 25, -24, -64, 57, -62, 8, 43, -47, 62, -24, -45,
+    -57, 20, 50, 27, -41, 68, -80, -38, -3, -68, -44, 22, 47, -12, 38, -3,
+    6, 21, 21, 45, -17, -49, 24, -48, -27, -63, -30, -53, 56, 40, 40, -8,
+    12, 20, 57, -5, -62, 32, -70, -11, -46, -15, -19, 43, 12, 74, -24, -9,
+    17, 69, 13, -8, -9, 127, -13, 7, 2, 31, 26, -69, -24, 40, -42, -12,
+    -40, -70, -41, -18, 41, 32, -63, 31, -97, -67, 51, 25, -6, 6, 30, -105,
+    -11, -29, -78, 22, 39, 29, -61, -32, 104, 42, -48, -78, -78, 77, 20, 67,
+    -68, -115, 36, -28, 41, 45, -9, -53, 0, 37, 34, -28, -18, 73, 56, 32,
+    -56, -74, -67, -35, -45, -20, 65, -64, 58, -15, -24, -57, -36, -76, -37, 29,
+    65, -25, -80, 56, 43, -45, 18, -11, 23, -20, -59, 39, 75, 87, -19, 16,
+    32, -38, 11, -60, -12, -64, -93, -7, -24, -50, -14, -32, 55, -20, 6, -50,
+    -68, -53, 22, -15, 72, 30, 31, 6, 4, 1, -17, -12, 45, 30, -44, 23,
+    60, -24, 79, 78, -14, -18, 27, 31, 16, -12, -2, 25, 48, -20, 3, 60,
+    5, 0, -47, -29, 55, -123, -49, 49, 4, -25, -76, -41, -41, 46, 37, -23,
+    45, -15, 1, -28, -1, 77, -34, 27, -10, -42, 18, 29, -11, -24, 37, -5,
+    8, -82, -20, -74, -15, 76, -11, 2, -87, -22, 74, 12, -65, 13, -22, 31,
+    -41, 41, -79, -15, -35, -61, 6, -18, 70, -45, 1, 11, -127, 65, 64, 30,
+    46, -48, 94, 14, -33, -51, 47, -53, -57, -95, -50, -21, 25, 75, 39, 26,
+    -56, -6, -10, 22, -47, -28, -34, -58, 30, 22, -74, 12, 21, -57, 41, 44,
+    10, -1, -31, 24, -17, 13, 13, -10, 31, 1, 41, 33, 73, 30, -5, 48,
+    36, 87, -23, 8, -38, 18, -62, -77, -37, -23, -55, -42, 72, 1, -2, -47,
+    79, 26, 23, -53, -13, 53, -65, 28, 8, -61, -61, -57, 26, 81, 10, -26,
+    -58, 16, 55, 73, -29, 47, -14, -60, -18, 45, 56, -66, 60, 21, -4, 5,
+    -6, 28, -58, 50, -26, 26, 22, 54, 5, -33, 32, 54, 55, 64, -72, 75,
+    16, -71, -56, -27, -49, 92, 28, 66, -1, 5, -51, 1, -73, 41, -38, 65,
+    22, -5, -45, -36, -11, 40, -23, 13, -116, -23, -45, -15, -40, -90, -1, 67,
+    50, -17, 22, 28, -28, -30, 20, -86, 110, 28, -76, 48, -55, 60, 78, -50,
+    -14, -127, -34, -16, 38, -32, 17, -16, 40, 76, -19, -82, -73, -38, -27, 70,
+    -12, 8, -76, -42, 36, -9, 77, -6, -11, 64, -7, 68, 74, -79, -44, -64,
+    18, -23, 81, 53, -30, -8, -20, -2, 18, 23, 45, -65, -16, -44, 52, -16,
+    14, -47, 41, -9, -54, 11, -25, -22, 28, 39, -35, 50, 80, -44, 3, 39,
+    -36, 21, -60, 42, 12, -43, -29, 9, 17, 100, -61, -19, -28, 13, -9, 11,
+    -20, 31, -80, -108, 30, 1, -52, 16, -18, -1, 14, -13, 19, -5, 16, -32,
+    18, -94, -28, 48, -24, 15, 113, -127, 50, 6, 15, 40, -15, 8, -12, 9,
+    -26, 75, 75, 9, 47, -54, 116, 32, 29, -63, -4, 28, -74, -14, -40, 2,
+    41, 43, 26, -42, 31, -79, 2, 53, 67, 78, -72, 26, -37, 58, -14, -21,
+    0, -31, 39, -27, 17, 39, -27, 4, -117, 21, -11, 20, 0, -54, 13, 71,
+    -7, -11, -71, 30, 57, 46, -3, -55, -26, 9, 75, 7, 17, -58, -11, -42,
+    99, -22, 49, 46, 14, -16, 22, 27, 19, -6, 62, 22, -25, 30, 16, -58,
+    -57, 50, -43, 48, 41, -70, -12, 50, 16, -49, 54, -3, 49, 51, 11, 31,
+    0, 59, 84, 8, -51, -57, -65, -37, -46, 29, -17, -18, 27, -80, 60, 28,
+    14, 0, -50, 44, 18, -25, 38, 28, 26, -29, -5, -32, -48, -24, 7, 26,
+    -11, -70, -26, 65, 44, -68, -4, -20, -51, 18, 36, 3, 106, 23, -2, 71,
+    -88, -6, 72, -24, 54, -18, 79, 81, -18, -10, -15, 50, -92, 44, -88, -78,
+    27, 59, 46, 67, -39, 104, -93, -75, 53, -38, -71, -95, -78, 22, -61, 50,
+    -32, -44, 10, 63, 14, 127, 25, -91, -65, -73, -72, 57, -91, 55, -82, -54,
+    -65, -4, -27, -52, 38, -99, -48, 71, 118, -71, 52, -42, 20, 81, 52, 62,
+    -25, -21, -2, 36, 54, -57, 38, 46, 6, 36, 33, -77, 5, 82, -40, -11,
+    -70, 18, -27, 63, 9, -18, 6, -78, 10, -44, 19, -77, 62, -78, 22, -78,
+    -33, 50, -28, -5, 20, -13, 42, 48, 59, 27, 106, -60, -55, 17, -8, -10,
+    -75, -1, 78, -25, -48, -65, -25, 33, 59, 74, -42, 10, 19, -6, -34, 49,
+    33, -11, -2, 42, -48, -34, 7, -35, 127, 75, 21, 3, -91, -47, -112, 93,
+    -6, -16, -29, -85, -56, 52, 33, 57, -11, -44, 64, 47, -22, -18, 3, -14,
+    -49, -1, 32, 43, 82, -23, 35, -61, -73, 9, -31, 0, 56, -22, 52, 37,
+    52, 20, -4, -45, 82, -64, 83, -19, -3, 78, 62, 69, -31, 61, 48, 84,
+    -31, 2, 56, 69, -26, -67, -43, 48, 24, -10, -30, -46, -70, -36, 46, -28,
+    71, -5, -30, 10, -50, -32, 0, -17, -77, -84, -46, 58, 24, 68, 29, 29,
+    20, 51, -107, 55, -28, -78, -43, 83, -30, -15, 18, 28, 74, -58, 41, 62,
+    42, -29, -31, -10, -15, 29, 68, 76, 21, 10, 29, 7, -43, -21, 74, 11,
+    -46, -29, 53, 30, 110, 29, 26, 12, -46, 41, 10, -11, -68, 53, -78, 97,
+    -46, 55, -44, -20, -76, -88, 30, 61, 44, -64, -33, 68, -66, 51, 1, 70,
+    14, 7, 57, -51, -41, -59, 45, 4, -22, 43, -12, 107, -32, 109, -48, 49,
+    10, 47, 115, 127, -62, -81, -65, 32, 73, 62, 36, -65, 18, -17, 32, -40,
+    78, 1, 39, 11, -35, 26, -51, 39, 70, 73, -42, 53, 22, 16, -17, -59,
+    -42, -49, -70, -60, 80, 104, -15, -37, 8, -75, -58, 24, 71, -28, 38, 67,
+    -84, -30, 69, 5, 68, 105, 11, 30, -25, -81, -34, -59, -68, -42, -72, -50,
+    -20, -28, -59, -75, 64, -69, 25, -95, 120, 5, 45, -117, -8, 46, 45, -51,
+    -36, -77, 41, -55, -71, 66, -38, -16, -25, 63, 51, -98, 4, 2, -85, -5,
+    -27, 67, -48, 82, -9, 45, -12, -62, 50, 8, 4, -14, 44, -31, 76, -10,
+    -46, -65, 52, -11, 9, 30, -28, -46, -27, -59, 60, 53, 12, -6, 19, -11,
+    -20, -39, -43, 75, -38, -102, -75, -24, 60, -68, -60, -53, 51, 62, 60, 71,
+    -45, -47, -29, 39, 78, 9, -46, -71, -127, -3, 38, 43, 19, 16, -26, -8,
+    28, -49, 41, -17, -57, -64, 126, -40, -2, 56, -38, -67, 24, 14, 16, -50,
+    -28, 31, -1, 37, -14, -3, -30, 57, 21, -35, -4, -27, -65, -75, 41, 55,
+    -2, -93, -69, 75, -11, 83, -42, 31, -39, 24, 48, 44, 69, 15, 53, 69,
+    35, -72, -31, 27, -73, 102, 26, 49, -13, 37, 55, -14, -26, -21, 13, 33,
+    -52, 24, -17, -38, 8, -47, -64, 13, -29, -50, 40, 11, 54, 49, 36, 23,
+    48, -11, 31, -26, -44, -7, 70, -10, 17, -49, 7, 27, -70, 113, 19, 68,
+    23, -82, 2, -22, -38, 59, -46, -24, 32, -28, -24, 68, 24, 10, 37, 56,
+    -75, -89, 78, -44, 30, 99, 88, 50, 17, -7, -1, -84, -38, 78, -80, -20,
+    -56, 33, -11, -52, 63, 5, 14, 30, 55, 13, 109, -70, 78, -23, -47, 30,
+    49, 15, 80, -41, 53, 34, 92, 13, -53, -54, -12, 20, -94, -43, -99, 32,
+    30, 42, 12, 33, 3, 45, 10, 86, -58, 110, -42, -28, -36, 26, -8, 20,
+    28, 106, 66, -50, -84, -90, -41, 6, -11, -90, 17, -28, 66, -25, 9, -61,
+    -38, -7, -88, -77, -92, -88, 7, -24, 44, -100, 11, -46, 30, 101, 11, 127,
+    -81, 24, 39, 65, 24, 101, -57, 22, -88, -8, 21, 8, -30, -70, 44, 17,
+    17, -35, -10, 127, 64, -97, 24, 42, -5, -56, 14, 54, -58, -14, -28, 36,
+    -10, -5, -79, 3, -46, 9, 26, -37, 69, 65, -97, 113, 51, -79, 52, 40,
+    -31, 0, 62, 57, -26, -19, 27, 111, 87, -15, -8, 67, 50, 97, -17, -60,
+    -33, -111, 83, 47, 33, 51, 10, 31, -51, -70, 22, -36, -85, 51, -3, 57,
+    -49, -56, 66, 28, -32, 45, -56, 20, -12, 39, 68, 49, -52, -51, 30, 17,
+    -37, -65, -68, 83, -19, 7, -22, 40, 38, 70, -39, -7, 28, -89, 29, -13,
+    -56, -13, 21, 39, 25, -27, -77, 23, 51, 23, 14, -31, -14, 26, 38, -23,
+    38, 51, -30, -32, -127, -29, 34, -24, -6, 42, -15, -54, 63, 31, 44, 28,
+    -77, 24, 81, -9, -33, 26, 121, -14, 43, -92, -61, -23, -70, 18, 63, -16,
+    -47, -42, -34, 33, -6, -40, 40, -47, -30, 29, -22, 16, -19, -43, 10, 5,
+    -35, 8, 98, -55, -20, 6, 7, 68, 16, 49, 53, -53, -21, -20, -9, -41,
+    66, -5, -24, -16, -25, -15, -2, -56, 52, -19, 63, 6, -20, -82, -11, 73,
+    -27, 56, 58, 4, 25, -12, -40, 54, -43, -22, -3, -5, 60, 9, 48, -87,
+    58, -18, 33, -76, 49, 38, -68, 46, 38, -69, 13, 14, -52, -16, 41, 32,
+    -32, 18, 39, -32, -42, 19, 61, -10, 32, -57, -37, -52, -57, -6, -36, -82,
+    43, 7, 50, 3, 35, 31, 60, 6, -68, -56, 37, 39, -40, -10, 2, -15,
+    20, -87, 113, 45, 1, -3, 6, -53, -61, 5, -27, 10, 66, -44, 10, 31,
+    -13, 105, -16, -21, -67, -127, 40, 84, 16, 40, 45, 1, -27, -44, 17, -45,
+    1, 17, -41, 23, 11, 88, -73, -8, 40, 12, -4, -53, -39, -59, 12, 38,
+    -73, 7, -46, -62, 30, -13, -86, -41, -66, -38, -31, 65, -37, 4, -69, -2,
+    62, -2, 22, 20, 3, -4, -7, 49, 50, -30, 26, -3, -20, 45, -2, -5,
+    -39, -43, -4, 25, 49, -22, 74, 19, -47, -9, -57, 12, 22, 0, 50, 44,
+    -57, -53, -15, 62, 33, -61, 82, 38, -77, 33, -46, 9, 49, -25, -35, -96,
+    8, -22, 35, 71, -20, -103, -5, -66, 83, -39, -61, -4, -42, -102, 81, 119,
+    101, 92, -15, -76, 38, 12, -35, -92, -41, 34, -1, 55, 27, -103, 101, -86,
+    -10, 15, 25, 56, 42, -41, -69, 42, -31, -23, 24, 57, -27, 84, 22, -22,
+    -15, 11, 66, -20, 72, -29, -29, 32, -67, -16, -79, -87, 32, -37, -26, -55,
+    -80, 37, -48, -20, 34, -114, 13, 119, -4, -12, 14, -37, -44, 63, 91, -75,
+    104, -83, -97, 70, -8, 52, -1, 55, 19, -67, 69, -48, 17, -66, 19, 15,
+    49, -57, -96, -127, -55, -28, -37, -74, -99, -95, -57, 24, -61, -21, -86, 50,
+    -71, 5, 33, 46, 51, -33, 103, -16, 94, 62, -49, 9, -45, -46, 63, -10,
+    -52, -45, 113, 13, 22, -2, -57, -33, -47, -123, -84, 67, 24, -89, -77, 99,
+    63, -34, -19, 38, -5, -2, 73, -14, 45, 48, -35, 53, 32, 19, -14, -71,
+    36, 4, 15, 49, 123, 40, -2, -68, 8, 72, -44, -32, -30, 37, 18, 7,
+    89, -73, -90, 68, 27, -39, -90, -41, -106, -14, 77, -28, -35, -5, -76, 32,
+    -32, -63, -19, -37, -44, -79, -48, -17, -102, -18, -6, 28, 32, 7, -51, -110,
+    10, -47, 83, 81, 60, 15, -39, -50, -7, -26, -73, -37, 60, -53, -73, 16,
+    -38, 103, 17, 6, -45, -124, -44, 93, -52, 88, -75, 94, -80, -58, -10, 20,
+    52, 69, -16, 33, 31, 127, -95, 61, -69, -59, 34, -3, 22, -27, -68, 8,
+    -20, -42, -27, -28, -61, -25, -74, 77, 4, 18, -26, -11, -102, 54, -90, -23,
+    4, -64, 16, -54, -59, 32, -41, -5, 38, 53, -27, 71, -88, 87, -44, 42,
+    -106, -29, -71, -52, 64, 16, 76, 32, -71, 21, -12, 73, 42, 51, 30, -36,
+    25, 39, 45, -5, -88, 26, 42, 63, -55, 74, 23, -45, 27, 17, 7, -85,
+    -69, 23, -18, -20, -1, 45, -96, 65, 64, -47, 22, 63, -72, 16, 1, 99,
+    -18, 34, -89, -58, 0, -43, -47, 87, 29, -25, -46, 56, 68, -51, -59, 8,
+    -17, -73, -17, 2, 18, -46, 2, -14, -127, -10, 10, 39, 33, -16, 45, -82,
+    -25, 56, 100, 2, 34, 30, 56, -63, 9, 2, 20, -25, -30, -17, 31, 7,
+    21, 40, -3, -85, -31, -7, -97, 85, -57, -78, 52, 32, 52, 32, -6, 25,
+    11, -50, -39, 60, 80, 36, -97, 19, -35, -33, -21, 47, 40, 19, 22, -3,
+    -76, -9, 25, 29, 15, 36, -31, -9, -28, -89, 63, -97, -68, 27, -80, 5,
+    -66, -19, -39, 43, -59, -106, 83, -13, 2, -42, -62, -23, -11, -71, -47, -24,
+    -68, 16, 6, 18, -72, 52, 70, -70, -31, 37, -83, -52, -36, -6, 80, -66,
+    -87, 69, -16, 41, -95, -79, -11, -54, 60, -12, -21, -51, -37, 10, 32, 44,
+    -28, -3, 69, 14, -12, -31, 56, -27, 64, -23, 54, -38, -3, 26, -58, -78,
+    -79, -40, 18, 115, -76, -37, -25, -17, 35, 31, 8, -69, -38, 54, -4, 40,
+    77, 70, -60, 43, -45, 39, -10, 18, 4, 59, -31, -27, -47, -24, 29, 25,
+    8, -36, -107, -25, 28, -14, -56, -32, 90, 8, 69, 21, 106, 109, 47, 64,
+    49, -70, 17, -6, -22, 50, 99, -127, -12, -27, 28, -31, 57, 7, -66, -39,
+    -37, 51, 41, -38, 36, -69, 29, 4, 37, -48, 49, 40, -6, -59, -2, -18,
+    -4, 39, -84, -52, 3, -11, 14, 82, 99, 9, -65, 64, -41, -11, 71, -79,
+    82, 14, -26, 76, -13, -24, 3, -12, -26, -44, -3, -43, 7, 69, 40, 35,
+    13, 88, -61, -26, 3, 25, 39, -67, -54, -9, 0, 60, 104, -27, 10, 51,
+    43, -25, 18, 66, -37, 75, -14, 7, 34, 7, -10, -41, -106, 65, -13, 16,
+    -20, 17, -16, -61, -36, 49, 16, -55, -8, 52, -66, -31, 18, -17, 14, -72,
+    21, 35, 74, 8, -5, 70, 4, 56, -21, -57, -4, -4, -26, 76, 77, -4,
+    -9, -14, -3, 0, -1, 61, 62, -5, 81, 42, 14, -8, 33, -70, -74, 78,
+    6, 69, -127, -31, -30, 12, -108, 3, -22, -16, 56, 15, 101, 38, 31, -25,
+    -10, -76, 28, 8, 5, 22, 120, -55, -22, -13, -56, -26, 24, 79, -1, -24,
+    -37, 21, 44, -16, 44, -54, 15, 1, -12, -6, -3, 16, 50, -44, 30, 56,
+    -5, 66, 13, 39, 39, -33, -29, 44, 37, 15, 13, 72, -30, 99, 71, -59,
+    38, -14, 66, 36, 14, -33, -12, 15, -37, 10, 106, 57, -70, 94, -24, -29,
+    -33, 16, -53, 43, 43, 2, -39, 65, -18, -44, -41, -17, 41, -94, 25, -17,
+    23, 45, -30, -49, -12, 39, 23, -10, 38, -8, 10, -50, -18, 11, -5, 65,
+    -30, 53, -39, -66, 103, -29, -19, 45, -56, 9, -39, -4, -32, -6, -62, -13,
+    22, 2, -30, 7, 1, -99, 12, -41, -25, -33, 35, -70, -44, -59, 40, -64,
+    39, 22, -45, -24, 1, -1, 39, -12, -126, 41, 7, -14, -15, 92, -18, -107,
+    -10, -98, 84, 48, 49, 27, -73, -8, -38, 27, -60, 8, -1, -8, -35, 73,
+    -5, 78, -87, 20, -21, -62, -7, 13, -55, -23, -25, -68, -86, -10, -6, 87,
+    25, 34, 25, 27, 60, -29, -118, 4, -40, 31, 4, 0, 52, 11, 55, 51,
+    40, 44, -33, -44, 37, 67, 56, 1, 13, -67, 69, -25, -4, -34, -18, 127,
+    -5, -37, 6, 10, -11, -18, 11, 43, 56, 37, 16, -39, -116, -88, 49, 42,
+    31, -90, 64, -39, 6, 55, -29, -14, 92, -61, -50, -100, -66, -26, 43, -23,
+    -26, 56, -38, 54, -26, -22, 25, 35, -54, -71, 37, -42, 17, -42, -89, -108
+};
+
+static const int32_t conv3_bias[64] =
+{
+    20669, -644564, 132715, 338705, 63084, 466767, 503487, 79793, 427069, 388385, 468763, 75461, 622437, 265070, 323856, -403355,
+    387979, 696660, -194936, -157264, 976397, 440715, 86223, 646615, -258324, -94293, 443872, 24670, 70901, -153514, 343552, 415428,
+    -178094, -339493, 546457, 272862, -236587, -153005, 503597, 514467, -380967, 279600, -2106, -343239, 640415, -233719, 346737, 363746,
+    489165, 213169, -202483, 234299, -281058, -3686, -55817, -206322, 24332, 442593, 818252, 700493, 705393, -290591, -403843, 591534
+};
+
+static const int32_t conv3_mult[64] =
+{
+    1703203686, 1466830343, 1289932220, 1557395756, 1883922436, 2002009622, 1249869570, 1743214272,
+    1278410699, 1393886359, 1137800216, 2058175573, 1793885166, 1369833163, 1961978341, 1633685656,
+    1295826287, 1955498341, 1239043972, 1369146061, 1319545107, 1981378787, 1334131428, 1199150916,
+    1261541322, 2084824530, 1534502604, 1701343494, 2105650751, 1472391198, 1764945355, 1178527892,
+    1446914134, 1271657042, 2113263381, 1137486446, 1397168062, 1084545236, 1772589457, 1741508869,
+    2065048532, 1896651701, 1230610185, 1274167313, 1595218954, 1073956036, 1716984462, 1092210084,
+    1621160071, 1257098405, 1362993139, 1101091336, 1191876912, 1100438257, 1923308626, 1221128924,
+    1176943763, 1716514791, 2106333944, 1267238225, 1211076756, 2134225462, 1253862491, 1959314651
+};
+
+static const int8_t conv3_shift[64] =
+{
+    8, 8, 8, 8, 10, 8, 8, 9, 8, 8, 9, 8, 8, 9, 10, 8,
+    9, 10, 9, 8, 8, 9, 9, 8, 9, 8, 8, 8, 10, 7, 8, 8,
+    7, 7, 9, 8, 8, 7, 9, 9, 10, 8, 8, 8, 8, 7, 8, 8,
+    8, 8, 7, 8, 8, 8, 8, 9, 7, 8, 9, 8, 8, 8, 7, 8
+};
+
+static const int8_t dense_wt[128] =
+{
+    -43, -70, 85, 41, -44, 93, 98, -61, 70, -83, 17, -46, -12, -58, -75, -101,
+    93, -64, 59, -20, 43, 79, -83, 20, -81, -51, -106, -24, 27, -57, 102, 108,
+    -81, 32, 75, 97, 46, -69, 34, -8, 62, 57, -1, -48, 52, 55, 0, 78,
+    70, 35, -22, -53, -82, 65, 16, -8, -126, 28, 108, 37, 87, -127, -85, 97,
+    33, -6, -35, -96, 83, 1, 22, -103, -13, 74, 83, -15, -123, 87, 20, 87,
+    -45, 99, 60, 38, -43, -84, 15, -76, -69, 37, -33, -101, 79, 104, -24, -35,
+    -31, 103, -26, -19, -10, 67, -61, 108, 102, -52, -105, 70, -36, 122, -13, -96,
+    39, -58, 54, -88, 127, -97, -54, 26, 116, -92, 60, -39, 71, -36, 5, -126
+};
+
+static const float dense_scale[2] =
+{
+    3.008449085e-06f, 2.902653478e-06f
+};
+
+static const float dense_bias[2] =
+{
+    -2.510670014e-02f, 2.510670014e-02f
+};
+
+const CNN_Q_model gCnnClassifierQModel =
+{
+    128,
+    3.119358632e-07f,
+    {
+        {1, 16, 5, 4, 1, 1, conv1_wt, conv1_bias, conv1_mult, conv1_shift},
+        {16, 32, 5, 4, 1, 1, conv2_wt, conv2_bias, conv2_mult, conv2_shift},
+        {32, 64, 5, 4, 1, 1, conv3_wt, conv3_bias, conv3_mult, conv3_shift}
+    },
+    2,
+    dense_wt,
+    dense_scale,
+    dense_bias
+};
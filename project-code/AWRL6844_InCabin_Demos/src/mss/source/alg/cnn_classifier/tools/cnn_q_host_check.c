@@ -0,0 +1,182 @@
+/*!
+ *  \file   cnn_q_host_check.c
+ *
+ *  \brief  Host check of the quantized 1D-CNN classifier against cnn_quantize.py
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Host check of cnn_classifier_q.c
+ *  Runs the C implementation, built for the host with the model generated by cnn_quantize.py, on the test vectors
+ *  written by cnn_quantize.py --vectors. The predictions are compared with:
+ *  - the bit-accurate Python model of the C implementation: only the float dense layer and softmax may differ,
+ *    by rounding
+ *  - the float model: decision agreement and max |dp|
+ *  - the library predictions, if the vectors have them: max |dp| within the quantization tolerance, decision agreement
+ *  Usage: cnn_q_host_check <vectors> [max_batch]. See cnn_q_host_check.sh
+ */
+
+#include "../src/cnn_classifier_q.h"
+
+
+/* Tolerance on the class probabilities between the C implementation and the bit-accurate model */
+#define CNN_Q_CHECK_TOLERANCE       (1e-4f)
+/* Tolerance on the class probabilities between the C implementation and the library: int8 weights, int16 activations */
+#define CNN_Q_CHECK_LIBRARY_TOLERANCE (0.1f)
+
+
+void *cnn_classifier_malloc(uint32_t sizeInBytes)
+{
+    return malloc(sizeInBytes);
+}
+
+void cnn_classifier_free(void *pFree, uint32_t sizeInBytes)
+{
+    free(pFree);
+}
+
+/*
+ This function compares predictions with a reference
+ * Arguments    : const float *p, Predictions, [numInputs][numClasses]
+                  const float *ref, Reference predictions, [numInputs][numClasses]
+                  int32_t numInputs, Number of inputs
+                  int32_t numClasses, Number of classes
+                  float *maxDiff, Output max |p - ref|
+ * Return Type  : int32_t, Number of inputs whose decision differs from the reference
+ */
+static int32_t cnn_q_check_compare(const float *p, const float *ref, int32_t numInputs, int32_t numClasses, float *maxDiff)
+{
+    int32_t n, c, numDiffer = 0;
+
+    *maxDiff = 0.f;
+    for (n = 0; n < numInputs; n++)
+    {
+        int32_t best = 0, bestRef = 0;
+        for (c = 0; c < numClasses; c++)
+        {
+            float d = fabsf(p[n * numClasses + c] - ref[n * numClasses + c]);
+            *maxDiff = (d > *maxDiff) ? d : *maxDiff;
+            best = (p[n * numClasses + c] > p[n * numClasses + best]) ? c : best;
+            bestRef = (ref[n * numClasses + c] > ref[n * numClasses + bestRef]) ? c : bestRef;
+        }
+        numDiffer += (best != bestRef) ? 1 : 0;
+    }
+    return numDiffer;
+}
+
+int main(int argc, char **argv)
+{
+    static const char *refNames[3] = {"bit-accurate model", "float model", "library"};
+    cnn_Classifier_moduleConfig config;
+    int32_t header[3], numInputs, numFrames, numClasses;
+    int32_t errCode, numRef, r, numDiffer;
+    float *spectra, *ref[3], *p;
+    float maxDiff;
+    void *handle;
+    FILE *f;
+    int32_t status = 0;
+
+    if ((argc < 2) || ((f = fopen(argv[1], "rb")) == NULL) || (fread(header, sizeof(int32_t), 3, f) != 3))
+    {
+        printf("usage: %s <vectors written by cnn_quantize.py --vectors> [max_batch]\n", argv[0]);
+        return 2;
+    }
+    numInputs = header[0];
+    numFrames = header[1];
+    numClasses = header[2];
+
+    spectra = (float *) malloc(numInputs * numFrames * sizeof(float));
+    p = (float *) malloc(numInputs * numClasses * sizeof(float));
+    if (fread(spectra, sizeof(float), numInputs * numFrames, f) != (size_t) (numInputs * numFrames))
+    {
+        printf("%s: truncated\n", argv[1]);
+        return 2;
+    }
+    for (numRef = 0; numRef < 3; numRef++)
+    {
+        ref[numRef] = (float *) malloc(numInputs * numClasses * sizeof(float));
+        if (fread(ref[numRef], sizeof(float), numInputs * numClasses, f) != (size_t) (numInputs * numClasses))
+        {
+            free(ref[numRef]);
+            break;
+        }
+    }
+    fclose(f);
+    if (numRef < 2)
+    {
+        printf("%s: truncated\n", argv[1]);
+        return 2;
+    }
+
+    memset(&config, 0, sizeof(config));
+    config.num_frames = numFrames;
+    config.num_features = 1;
+    config.num_classes = numClasses;
+    config.max_batch = (argc > 2) ? atoi(argv[2]) : (int32_t) CNN_Q_MAX_BATCH;
+    handle = cnn_classifier_create(&config, &errCode);
+    if (handle == NULL)
+    {
+        printf("cnn_classifier_create failed: %d\n", errCode);
+        return 1;
+    }
+
+    cnn_classifier_predict_batch(handle, spectra, numInputs, p);
+    cnn_classifier_delete(handle);
+
+    printf("inputs: %d, num_frames: %d, max_batch: %d\n", numInputs, numFrames, config.max_batch);
+    for (r = 0; r < numRef; r++)
+    {
+        numDiffer = cnn_q_check_compare(p, ref[r], numInputs, numClasses, &maxDiff);
+        printf("C vs %-19s max |dp| %.4g, decision agreement %.2f%%\n",
+               refNames[r], maxDiff, 100.0 * (numInputs - numDiffer) / numInputs);
+        if ((r == 0) && (maxDiff > CNN_Q_CHECK_TOLERANCE))
+        {
+            printf("FAIL: the C implementation does not match the bit-accurate model\n");
+            status = 1;
+        }
+        if ((r == 2) && (maxDiff > CNN_Q_CHECK_LIBRARY_TOLERANCE))
+        {
+            printf("FAIL: the C implementation differs from the library by more than %g\n", CNN_Q_CHECK_LIBRARY_TOLERANCE);
+            status = 1;
+        }
+        free(ref[r]);
+    }
+    if (status == 0)
+    {
+        printf("PASS\n");
+    }
+
+    free(spectra);
+    free(p);
+    return status;
+}
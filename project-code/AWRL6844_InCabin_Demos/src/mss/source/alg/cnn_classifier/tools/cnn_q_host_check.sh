@@ -0,0 +1,75 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Check cnn_classifier_q.c and its model tables on the host against the classifier library
+#
+#   cnn_q_host_check.sh
+#       regenerates the model tables from the library parameters and synthetic calibration spectra, checks that they
+#       match the committed ../src/cnn_classifier_q_model.c, and compares the C predictions with the bit-accurate
+#       model, the float model and the library run by the R5F emulator (NUM_REFERENCE inputs, default 200)
+#   cnn_q_host_check.sh --spectra <spectra.npy> [--reference <library.npy>]
+#       quantizes the library model on recorded spectra instead, writes ../src/cnn_classifier_q_model.c for the demo
+#       build, and runs the same comparisons on the recorded spectra
+#
+# Needs python3 with numpy and a host C compiler (CC, default cc). BUILD_DIR defaults to ./cnn_q_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+MSS_DIR="$TOOLS_DIR/../../../.."
+LIBRARY="$TOOLS_DIR/../lib/alg_cnnClassifier.xwrL684x.r5f.ti-arm-clang.release.lib"
+BUILD_DIR=${BUILD_DIR:-./cnn_q_host_check_build}
+NUM_REFERENCE=${NUM_REFERENCE:-200}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+if [ $# -eq 0 ]; then
+    MODEL="$BUILD_DIR/cnn_classifier_q_model.c"
+    set -- --synthetic 400 --seed 1
+else
+    MODEL="$SRC_DIR/cnn_classifier_q_model.c"
+fi
+
+python3 "$TOOLS_DIR/cnn_quantize.py" --library "$LIBRARY" "$@" --num-reference $NUM_REFERENCE \
+    --out "$MODEL" --vectors "$BUILD_DIR/cnn_q_vectors.bin"
+if [ "$MODEL" != "$SRC_DIR/cnn_classifier_q_model.c" ]; then
+    if ! cmp -s "$MODEL" "$SRC_DIR/cnn_classifier_q_model.c"; then
+        echo "FAIL: ../src/cnn_classifier_q_model.c is not the model generated from the library"
+        exit 1
+    fi
+fi
+$CC -O2 -Wall -I "$MSS_DIR" -I "$SRC_DIR" -o "$BUILD_DIR/cnn_q_host_check" \
+    "$TOOLS_DIR/cnn_q_host_check.c" "$SRC_DIR/cnn_classifier_q.c" "$MODEL" -lm
+for MAX_BATCH in 1 3 8; do
+    "$BUILD_DIR/cnn_q_host_check" "$BUILD_DIR/cnn_q_vectors.bin" $MAX_BATCH
+done
@@ -0,0 +1,365 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+
+"""Quantize the 1D-CNN LPD classifier and generate cnn_classifier_q_model.c
+
+Model
+  --library    the classifier library (alg_cnnClassifier...lib): the float parameters are read from the data
+               sections of the library objects
+  --params     or an .npz with the float parameters, named and laid out as in the library:
+               conv<i>_wt [out][kernel][in], conv<i>_bias, gamma<i>, beta<i>, mean<i>, var<i> (i = 1..3),
+               dense_wt [classes][channels], dense_bias
+
+Inputs, used to calibrate the activation ranges and to compare the predictions
+  --spectra    .npy [N][num_frames] of recorded CNN inputs, i.e. macro-Doppler spectra already scaled by
+               cnnInputScale (the featureMultiFrmDoppler arrays)
+  --synthetic  or N synthetic spectra: noise floor and Doppler lobes, scaled so that the first layer outputs
+               follow the batch normalization statistics of the model. N spectra calibrate, N others
+               (another seed) are compared
+  --reference  .npy [N][num_classes] of the library predictions for the compared spectra. With --library and
+               without --reference, the library is run on the first --num-reference spectra by the R5F
+               emulator (tools/r5f_emu), none with --num-reference 0
+
+Outputs
+  --out        the model tables for cnn_classifier_q.c
+  --vectors    test vectors for cnn_q_host_check.c: int32 N, num_frames, num_classes, then float32 spectra
+               [N][num_frames], quantized predictions [N][num_classes], float model predictions
+               [N][num_classes] and library predictions [N][num_classes] if available
+
+The tool runs a float model of the library, and a bit-accurate model of the int8/int16 C implementation, and
+reports how the quantized predictions compare with them and with the library predictions.
+"""
+
+import argparse
+import os
+import sys
+
+import numpy as np
+
+NUM_CONV_LAYERS = 3
+ACT_MAX = 32767
+WEIGHT_MAX = 127
+# Requantization shift 31 + shift supported by cnn_classifier_q.c (CNN_Q_MIN_TOTAL_SHIFT, CNN_Q_MAX_TOTAL_SHIFT)
+MIN_TOTAL_SHIFT = 1
+MAX_TOTAL_SHIFT = 62
+# Activation range above the calibration maximum, so that inputs beyond the calibration set do not saturate
+ACT_HEADROOM = 1.5
+
+# Topology of the library model: conv1d_manual_no_pad_alloc() and batch_norm_1d_inference_relu() calls of
+# cnn_classifier_predict()
+CHANNELS = (1, 16, 32, 64)
+KERNEL = 5
+STRIDE = 4
+PAD_LEFT = 1
+PAD_RIGHT = 1
+NUM_FRAMES = 128
+NUM_CLASSES = 2
+BN_EPS = 1e-5
+SOFTMAX_EXP_STEP = 0.0625
+
+R5F_EMU_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', '..', '..', 'tools', 'r5f_emu')
+
+
+def library_params(path):
+    """Float parameters from the .data.<name> sections of the library objects"""
+    sys.path.insert(0, R5F_EMU_DIR)
+    import r5f_emu
+    p = {}
+    for name, body in r5f_emu.read_archive(path):
+        for s in r5f_emu._Object(name, body).sections:
+            if s['name'].startswith('.data.'):
+                p[s['name'][len('.data.'):]] = np.frombuffer(s['data'], dtype=np.float32)
+    return p
+
+
+def q_rsqrt(v):
+    """1/sqrt(v) as computed by the library batch normalization: 0x5f3759df estimate and one Newton step, in float"""
+    v = np.asarray(v, dtype=np.float32)
+    y = (np.uint32(0x5f3759df) - (v.view(np.uint32) >> 1)).astype(np.uint32).view(np.float32)
+    return y * (np.float32(1.5) - np.float32(0.5) * v * y * y)
+
+
+def conv1d(x, w, b):
+    """x [in][len], w [out][in][k] -> [out][(len + PAD_LEFT + PAD_RIGHT - k) / STRIDE + 1], zero padding"""
+    num_out, num_in, k = w.shape
+    xp = np.pad(x, ((0, 0), (PAD_LEFT, PAD_RIGHT)))
+    out_len = (xp.shape[1] - k) // STRIDE + 1
+    y = np.zeros((num_out, out_len))
+    for j in range(k):
+        y += np.einsum('oi,il->ol', w[:, :, j], xp[:, j:j + STRIDE * (out_len - 1) + 1:STRIDE])
+    return y + b[:, None]
+
+
+def softmax(z):
+    """Softmax of the library, exp(x) = (1 + x/16)^16, clamped to 0 below x = -16 as in cnn_classifier_q.c"""
+    e = np.maximum((z - np.max(z)) * SOFTMAX_EXP_STEP + 1.0, 0.0) ** 16
+    return e / np.sum(e)
+
+
+def fold_batch_norm(p):
+    """Convolution weights [out][in][k] and bias with the batch normalization folded in, and the dense layer"""
+    layers = []
+    for i in range(1, NUM_CONV_LAYERS + 1):
+        num_in, num_out = CHANNELS[i - 1], CHANNELS[i]
+        w = p['conv%d_wt' % i].astype(np.float64).reshape(num_out, KERNEL, num_in).transpose(0, 2, 1)
+        g = p['gamma%d' % i].astype(np.float64) * q_rsqrt(p['var%d' % i] + np.float32(BN_EPS))
+        layers.append((w * g[:, None, None],
+                       (p['conv%d_bias' % i] - p['mean%d' % i].astype(np.float64)) * g + p['beta%d' % i]))
+    dense_w = p['dense_wt'].astype(np.float64).reshape(-1, CHANNELS[-1])
+    return layers, dense_w, p['dense_bias'].astype(np.float64)
+
+
+def float_forward(x, layers, dense_w, dense_b, keep_acts=False):
+    a = x[None, :].astype(np.float64)
+    acts = [a]
+    for w, b in layers:
+        a = np.maximum(conv1d(a, w, b), 0.0)
+        acts.append(a)
+    p = softmax(dense_w @ a.mean(axis=1) + dense_b)
+    return (p, acts) if keep_acts else p
+
+
+def synthetic_spectra(num_spectra, p, seed):
+    """Positive spectra with a noise floor and a few Doppler lobes, scaled so that the first convolution outputs
+    match the batch normalization mean and variance of the model, then by a random factor in [1/2, 2]"""
+    rng = np.random.default_rng(seed)
+    t = np.arange(NUM_FRAMES)
+    w1 = p['conv1_wt'].astype(np.float64).reshape(CHANNELS[1], KERNEL, 1).transpose(0, 2, 1)
+    zero = np.zeros(CHANNELS[1])
+    mean, var = p['mean1'].astype(np.float64), p['var1'].astype(np.float64)
+    spectra = np.empty((num_spectra, NUM_FRAMES))
+    for n in range(num_spectra):
+        x = rng.exponential(rng.uniform(0.02, 0.2), NUM_FRAMES)
+        for _ in range(rng.integers(1, 5)):
+            center = NUM_FRAMES / 2 + rng.normal(0.0, NUM_FRAMES / 6)
+            lobe = rng.uniform(0.2, 1.0) * np.exp(-0.5 * ((t - center) / rng.uniform(0.5, 8.0)) ** 2)
+            x += lobe + (lobe[::-1] * rng.uniform(0.0, 0.5) if rng.random() < 0.5 else 0.0)
+        # Least squares scale of the first layer channel means onto the batch normalization means
+        u = conv1d(x[None, :], w1, zero).mean(axis=1)
+        b = p['conv1_bias'].astype(np.float64)
+        scale = np.sum(u * (mean - b) / var) / max(np.sum(u * u / var), 1e-300)
+        spectra[n] = x * abs(scale) * 2.0 ** rng.uniform(-1.0, 1.0)
+    return spectra.astype(np.float32)
+
+
+def requant_params(m):
+    """Real multiplier m = mult * 2^-(31 + shift), mult in [2^30, 2^31)"""
+    shift = -int(np.floor(np.log2(m))) - 1
+    mult = int(round(m * 2.0 ** (31 + shift)))
+    if mult == 2 ** 31:
+        mult //= 2
+        shift -= 1
+    if not MIN_TOTAL_SHIFT <= 31 + shift <= MAX_TOTAL_SHIFT:
+        raise ValueError('requantization multiplier %g needs a shift of %d, outside of [%d, %d]: '
+                         'the activation ranges of the calibration spectra are not supported'
+                         % (m, 31 + shift, MIN_TOTAL_SHIFT, MAX_TOTAL_SHIFT))
+    return mult, shift
+
+
+def patch_mean(a, k):
+    """Mean over the output positions of the padded input patches of a layer, a [in][len] -> [in][k]"""
+    ap = np.pad(a, ((0, 0), (PAD_LEFT, PAD_RIGHT)))
+    out_len = (ap.shape[1] - k) // STRIDE + 1
+    return np.stack([ap[:, j:j + STRIDE * (out_len - 1) + 1:STRIDE].mean(axis=1) for j in range(k)], axis=-1)
+
+
+def quantize(layers, dense_w, dense_b, spectra):
+    # Activation steps from the calibration spectra, and mean input patch of each layer
+    act_max = np.zeros(NUM_CONV_LAYERS + 1)
+    in_mean = [0.0] * NUM_CONV_LAYERS
+    for x in spectra:
+        _, acts = float_forward(x, layers, dense_w, dense_b, keep_acts=True)
+        act_max = np.maximum(act_max, [np.max(np.abs(a)) for a in acts])
+        for i, (w, _) in enumerate(layers):
+            in_mean[i] = in_mean[i] + patch_mean(acts[i], w.shape[2]) / len(spectra)
+    act_step = np.maximum(act_max * ACT_HEADROOM, 1e-30) / ACT_MAX
+
+    q = {'input_step': act_step[0], 'conv': []}
+    for i, (w, b) in enumerate(layers):
+        w_step = np.maximum(np.max(np.abs(w), axis=(1, 2)), 1e-30) / WEIGHT_MAX
+        wq = np.clip(np.round(w / w_step[:, None, None]), -WEIGHT_MAX, WEIGHT_MAX).astype(np.int64)
+        # Bias correction: the bias absorbs the weight rounding error on the mean input. The first layer output is a
+        # small difference of large terms (batch normalization means ~1e9), where the rounding error is mostly this bias
+        b = b + np.einsum('oik,ik->o', w - wq * w_step[:, None, None], in_mean[i])
+        bq = np.round(b / (w_step * act_step[i])).astype(np.int64)
+        if np.max(np.abs(bq)) + w.shape[1] * w.shape[2] * WEIGHT_MAX * ACT_MAX >= 2 ** 31:
+            raise ValueError('layer %d: the int32 accumulator may overflow' % (i + 1))
+        mults, shifts = zip(*[requant_params(s * act_step[i] / act_step[i + 1]) for s in w_step])
+        q['conv'].append({'w': wq, 'b': bq, 'mult': np.array(mults, dtype=np.int64),
+                          'shift': np.array(shifts, dtype=np.int64)})
+
+    d_step = np.maximum(np.max(np.abs(dense_w), axis=1), 1e-30) / WEIGHT_MAX
+    q['dense_w'] = np.clip(np.round(dense_w / d_step[:, None]), -WEIGHT_MAX, WEIGHT_MAX).astype(np.int64)
+    q['dense_scale'] = (d_step * act_step[-1]).astype(np.float32)
+    q['dense_b'] = dense_b.astype(np.float32)
+    return q
+
+
+def quantized_forward(x, q):
+    """Bit-accurate model of cnn_classifier_predict() up to the float dense layer"""
+    v = np.clip(x.astype(np.float32) * np.float32(1.0 / q['input_step']), -ACT_MAX, ACT_MAX)
+    a = np.trunc(v + np.where(v >= 0, 0.5, -0.5)).astype(np.int64)[None, :]
+    for layer in q['conv']:
+        k = layer['w'].shape[2]
+        ap = np.pad(a, ((0, 0), (PAD_LEFT, PAD_RIGHT)))
+        out_len = (ap.shape[1] - k) // STRIDE + 1
+        acc = np.tile(layer['b'][:, None], (1, out_len))
+        for j in range(k):
+            acc = acc + layer['w'][:, :, j] @ ap[:, j:j + STRIDE * (out_len - 1) + 1:STRIDE]
+        total = 31 + layer['shift'][:, None]
+        a = (acc * layer['mult'][:, None] + (np.int64(1) << (total - 1))) >> total
+        a = np.clip(a, 0, ACT_MAX)
+    pooled = (a.sum(axis=1).astype(np.float32) * np.float32(1.0 / a.shape[1]))
+    logits = (q['dense_w'].astype(np.float32) @ pooled) * q['dense_scale'] + q['dense_b']
+    return softmax(logits.astype(np.float64))
+
+
+def library_predictions(path, spectra):
+    """Predictions of the library, run by the R5F emulator"""
+    sys.path.insert(0, R5F_EMU_DIR)
+    import r5f_emu
+    emu = r5f_emu.R5F([path])
+    # cnn_Classifier_moduleConfig of the library: num_frames, num_features, num_classes, scratchBuffer (NULL),
+    # scratchBufferSizeInBytes
+    config = emu.alloc_array(np.int32, [spectra.shape[1], 1, NUM_CLASSES, 0, 0])
+    err = emu.alloc_array(np.int32, [0])
+    handle = emu.call('cnn_classifier_create', config, err)
+    if handle == 0 or emu.read_array(err, np.int32, 1)[0] != 0:
+        raise RuntimeError('cnn_classifier_create of the library failed')
+    features = emu.malloc(spectra.shape[1] * 4)
+    predictions = emu.malloc(NUM_CLASSES * 4)
+    out = np.zeros((len(spectra), NUM_CLASSES))
+    for n, x in enumerate(spectra):
+        emu.write_array(features, np.float32, x)
+        emu.call('cnn_classifier_predict', handle, features, predictions)
+        out[n] = emu.read_array(predictions, np.float32, NUM_CLASSES)
+    return out
+
+
+def c_array(ctype, name, values, per_line=16):
+    values = [str(int(v)) if 'int' in ctype else '%.9ef' % v for v in np.ravel(values)]
+    lines = [', '.join(values[i:i + per_line]) for i in range(0, len(values), per_line)]
+    return 'static const %s %s[%d] =\n{\n    %s\n};\n' % (ctype, name, len(values), ',\n    '.join(lines))
+
+
+def write_model(path, q, input_length, source):
+    out = ['/* Generated by tools/cnn_quantize.py from %s, do not edit */\n' % source,
+           '#include "cnn_classifier_q.h"\n']
+    for i, layer in enumerate(q['conv']):
+        out.append(c_array('int8_t', 'conv%d_wt' % (i + 1), layer['w']))
+        out.append(c_array('int32_t', 'conv%d_bias' % (i + 1), layer['b']))
+        out.append(c_array('int32_t', 'conv%d_mult' % (i + 1), layer['mult'], 8))
+        out.append(c_array('int8_t', 'conv%d_shift' % (i + 1), layer['shift']))
+    out.append(c_array('int8_t', 'dense_wt', q['dense_w']))
+    out.append(c_array('float', 'dense_scale', q['dense_scale'], 4))
+    out.append(c_array('float', 'dense_bias', q['dense_b'], 4))
+
+    conv = []
+    for i, layer in enumerate(q['conv']):
+        num_out, num_in, k = layer['w'].shape
+        conv.append('        {%d, %d, %d, %d, %d, %d, conv%d_wt, conv%d_bias, conv%d_mult, conv%d_shift}'
+                    % (num_in, num_out, k, STRIDE, PAD_LEFT, PAD_RIGHT, i + 1, i + 1, i + 1, i + 1))
+    out.append('const CNN_Q_model gCnnClassifierQModel =\n{\n'
+               '    %d,\n    %.9ef,\n    {\n%s\n    },\n    %d,\n    dense_wt,\n    dense_scale,\n    dense_bias\n};\n'
+               % (input_length, 1.0 / q['input_step'], ',\n'.join(conv), q['dense_w'].shape[0]))
+    with open(path, 'w') as f:
+        f.write('\n'.join(out))
+
+
+def write_vectors(path, spectra, predictions):
+    with open(path, 'wb') as f:
+        np.array([spectra.shape[0], spectra.shape[1], predictions[0].shape[1]], dtype=np.int32).tofile(f)
+        spectra.astype(np.float32).tofile(f)
+        for p in predictions:
+            p.astype(np.float32).tofile(f)
+
+
+def compare(name, p, ref):
+    print('%-28s max |dp| %.4g, decision agreement %.2f%%'
+          % (name, np.max(np.abs(p - ref)), 100.0 * np.mean(np.argmax(p, 1) == np.argmax(ref, 1))))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--library')
+    parser.add_argument('--params')
+    parser.add_argument('--spectra')
+    parser.add_argument('--synthetic', type=int, metavar='N')
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--reference')
+    parser.add_argument('--num-reference', type=int, default=200)
+    parser.add_argument('--vectors')
+    parser.add_argument('--out', default='cnn_classifier_q_model.c')
+    args = parser.parse_args()
+
+    if args.library:
+        params = library_params(args.library)
+        source = os.path.basename(args.library)
+    elif args.params:
+        params = dict(np.load(args.params))
+        source = os.path.basename(args.params)
+    else:
+        parser.error('--library or --params is required')
+    if args.spectra:
+        calibration = spectra = np.load(args.spectra).astype(np.float32)
+    elif args.synthetic:
+        calibration = synthetic_spectra(args.synthetic, params, args.seed)
+        spectra = synthetic_spectra(args.synthetic, params, args.seed + 1)
+        source += ', %d synthetic calibration spectra (seed %d)' % (args.synthetic, args.seed)
+    else:
+        parser.error('--spectra or --synthetic is required')
+    layers, dense_w, dense_b = fold_batch_norm(params)
+    q = quantize(layers, dense_w, dense_b, calibration)
+
+    p_ref = None
+    if args.reference:
+        p_ref = np.load(args.reference)
+    elif args.library and args.num_reference > 0:
+        spectra = spectra[:args.num_reference]
+        p_ref = library_predictions(args.library, spectra)
+
+    p_float = np.array([float_forward(x, layers, dense_w, dense_b) for x in spectra])
+    p_quant = np.array([quantized_forward(x, q) for x in spectra])
+    print('spectra: %d' % len(spectra))
+    compare('quantized vs float model:', p_quant, p_float)
+    if p_ref is not None:
+        compare('float model vs library:', p_float, p_ref)
+        compare('quantized vs library:', p_quant, p_ref)
+
+    write_model(args.out, q, spectra.shape[1], source)
+    print('wrote %s' % args.out)
+    if args.vectors:
+        write_vectors(args.vectors, spectra, [p_quant, p_float] + ([p_ref] if p_ref is not None else []))
+        print('wrote %s' % args.vectors)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,715 @@
+/*!
+ *  \file   inDetect.c
+ *
+ *  \brief  Open implementation of the intrusion detection module
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Processing steps per frame
+ *  1. Mean and variance of the reference zone (first occupancy box), in linear scale
+ *  2. If any box applies the sidelobe check, the heatmap maximum of each range bin
+ *  3. For every other box, the sum over its cells of the squared deviation from the reference mean, normalized by the
+ *     reference variance and by the number of cells of the box. If the 2D local peak check is enabled for the box, only
+ *     the cells which are local maxima across azimuth-elevation and above the sidelobe threshold contribute, each one
+ *     followed by the peakExpSamples neighborhood around it
+ *  4. Hit/miss counting state machine per box, against the occupancy threshold
+ *
+ *  The float operations and their order follow the library, so that the signals and decisions are identical for the
+ *  same configuration and heatmap (tools/inDetect_host_check.sh compares them with the library run by the R5F
+ *  emulator). IDETECT_NUM_SUM_LANES > 1 splits the dense sums of steps 1 and 3 into independent partial sums instead.
+ */
+
+#include "inDetect_internal.h"
+
+
+/* Local function declarations */
+static void inDetect_matrixMultiply(uint32_t m, uint32_t n, uint32_t p, const float *A, const float *B, float *C);
+static void inDetect_computeRotationMatrix(const IDETECT_sensorOrientation *tilt, float *rotW);
+static bool inDetect_cellToWorld(const IDETECT_moduleConfig *config, const float *rotW, uint32_t cellInd, float *world);
+static bool inDetect_isPointInsideBox(const float *point, const IDETECT_boundaryBox *box);
+static int32_t inDetect_buildCellLists(IDETECT_moduleInstance *inst, const IDETECT_moduleConfig *config);
+static void inDetect_referenceStats(IDETECT_moduleInstance *inst, const int16_t *heatmap);
+static void inDetect_computeMaxPerRange(IDETECT_moduleInstance *inst, const int16_t *heatmap);
+static void inDetect_computeBoxSignal(IDETECT_moduleInstance *inst, const int16_t *heatmap, uint8_t boxInd);
+static void inDetect_boxStateMachine(IDETECT_moduleInstance *inst, uint8_t boxInd);
+static float inDetect_sumLanes(const float *lane);
+
+
+/* Conversion of a log2 Q11 heatmap sample to linear scale, built directly in the float representation */
+static inline float inDetect_pow2(const uint16_t *lut, int16_t x)
+{
+    union
+    {
+        uint32_t u;
+        float f;
+    } val;
+
+    val.u = ((uint32_t) (127 + ((int32_t) x >> IDETECT_LOG2_FRAC_BITS)) << 23) |
+            ((uint32_t) lut[(uint32_t) x & (IDETECT_POW2_LUT_SIZE - 1U)] << (23U - IDETECT_LOG2_FRAC_BITS));
+    return val.f;
+}
+
+/* Index wrap around for the azimuth-elevation neighborhoods */
+static inline uint32_t inDetect_wrap(int32_t ind, uint32_t size)
+{
+    int32_t r = ind % (int32_t) size;
+
+    return (uint32_t) ((r < 0) ? (r + (int32_t) size) : r);
+}
+
+
+/* Function Definitions */
+/*
+ This function creates an instance of the intrusion detection algorithm
+ * Arguments    : IDETECT_moduleConfig *config, Module configuration
+                  int32_t *errCode, Error code output
+ * Return Type  : void *, Algorithm handle, NULL in case of error
+ */
+void *inDetect_create(IDETECT_moduleConfig *config, int32_t *errCode)
+{
+    IDETECT_moduleInstance *inst = NULL;
+    uint32_t ind;
+    uint8_t boxInd;
+    uint32_t startCycle = IDETECT_CYCLE_COUNT();
+
+    *errCode = IDETECT_EOK;
+
+    /* Configuration sanity checks */
+    if ((config == NULL) ||
+        (config->numRangeBins == 0) || (config->numRangeBins > IDETECT_RANGE_BINS_MAX) ||
+        (config->numAzimBins == 0) || (config->numAzimBins > IDETECT_AZIM_BINS_MAX) ||
+        (config->numElevBins == 0) || (config->numElevBins > IDETECT_ELEV_BINS_MAX) ||
+        (config->sceneryParams.numOccupancyBoxes < IDETECT_MIN_OCCUPANCY_BOXES) ||
+        (config->sceneryParams.numOccupancyBoxes > IDETECT_MAX_OCCUPANCY_BOXES))
+    {
+        *errCode = IDETECT_EINVAL;
+        goto exit;
+    }
+
+    inst = (IDETECT_moduleInstance *) inDetect_malloc(sizeof(IDETECT_moduleInstance));
+    if (inst == NULL)
+    {
+        *errCode = IDETECT_ENOMEM;
+        goto exit;
+    }
+    memset(inst, 0, sizeof(IDETECT_moduleInstance));
+
+    inst->numRangeBins = config->numRangeBins;
+    inst->numAzimBins = config->numAzimBins;
+    inst->numElevBins = config->numElevBins;
+    inst->numTotalBins = (uint32_t) config->numRangeBins * config->numAzimBins * config->numElevBins;
+    inst->numOccupancyBoxes = config->sceneryParams.numOccupancyBoxes;
+    inst->stateParams = config->stateParams;
+    inst->sigProcParams = config->sigProcParams;
+
+    /* The reference zone is never peak checked */
+    for (boxInd = 1; boxInd < inst->numOccupancyBoxes; boxInd++)
+    {
+        if ((inst->sigProcParams.localPeakCheck[boxInd] == IDETECT_LOCAL_PEAK_CHECK_2D) &&
+            (inst->sigProcParams.sidelobeThre[boxInd] > 0.f))
+        {
+            inst->sidelobeCheck = true;
+        }
+    }
+
+    /* Fractional part of 2^x, x in Q11 */
+    for (ind = 0; ind < IDETECT_POW2_LUT_SIZE; ind++)
+    {
+        inst->pow2Lut[ind] = (uint16_t) floor((pow(2.0, (double) ind / (double) IDETECT_POW2_LUT_SIZE) - 1.0) *
+                                              (double) IDETECT_POW2_LUT_SIZE + 0.5);
+    }
+
+    /* Per box cell lists */
+    *errCode = inDetect_buildCellLists(inst, config);
+    if (*errCode != IDETECT_EOK)
+    {
+        inDetect_delete(inst);
+        inst = NULL;
+        goto exit;
+    }
+
+    inst->benchmarks[IDETECT_BENCHMARK_CREATE] = IDETECT_CYCLE_COUNT() - startCycle;
+
+exit:
+    return (void *) inst;
+}
+
+/*
+ This function runs a single step of the intrusion detection algorithm
+ * Arguments    : void *handle, Algorithm handle
+                  const void *heatmap, SNR heatmap, int16_t log2 Q11, [Elevation][Azimuth][Range]
+                  IDETECT_output *out, Output
+ * Return Type  : void
+ */
+void inDetect_compute(void *handle, const void *heatmap, IDETECT_output *out)
+{
+    IDETECT_moduleInstance *inst = (IDETECT_moduleInstance *) handle;
+    const int16_t *hm = (const int16_t *) heatmap;
+    uint8_t boxInd;
+    uint32_t startCycle = IDETECT_CYCLE_COUNT();
+
+    inDetect_referenceStats(inst, hm);
+
+    if (inst->sidelobeCheck)
+    {
+        inDetect_computeMaxPerRange(inst, hm);
+    }
+
+    for (boxInd = 1; boxInd < inst->numOccupancyBoxes; boxInd++)
+    {
+        inDetect_computeBoxSignal(inst, hm, boxInd);
+        inDetect_boxStateMachine(inst, boxInd);
+    }
+
+    for (boxInd = 0; boxInd < inst->numOccupancyBoxes; boxInd++)
+    {
+        out->occBoxSignal[boxInd] = inst->box[boxInd].occBoxSignal;
+        out->occBoxDecision[boxInd] = inst->box[boxInd].state;
+    }
+
+    inst->benchmarks[IDETECT_BENCHMARK_COMPUTE] = IDETECT_CYCLE_COUNT() - startCycle;
+}
+
+/*
+ This function deletes an instance of the intrusion detection algorithm
+ * Arguments    : void *handle, Algorithm handle
+ * Return Type  : void
+ */
+void inDetect_delete(void *handle)
+{
+    IDETECT_moduleInstance *inst = (IDETECT_moduleInstance *) handle;
+
+    if (inst == NULL)
+    {
+        return;
+    }
+    if (inst->spanBlock != NULL)
+    {
+        inDetect_free(inst->spanBlock, inst->spanBlockSizeInBytes);
+    }
+    inDetect_free(inst, sizeof(IDETECT_moduleInstance));
+}
+
+/*
+ This function multiplies two row-major matrices, C = A * B
+ * Arguments    : uint32_t m, uint32_t n, uint32_t p, Dimensions, A is m x n, B is n x p
+                  const float *A, const float *B, Input matrices
+                  float *C, Output matrix, m x p
+ * Return Type  : void
+ */
+static void inDetect_matrixMultiply(uint32_t m, uint32_t n, uint32_t p, const float *A, const float *B, float *C)
+{
+    uint32_t i, j, k;
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < p; j++)
+        {
+            float acc = 0.f;
+
+            for (k = 0; k < n; k++)
+            {
+                acc = A[i * n + k] * B[k * p + j] + acc;
+            }
+            C[i * p + j] = acc;
+        }
+    }
+}
+
+/*
+ This function computes the sensor to world rotation matrix, Rz * Ry * Rx
+ * Arguments    : const IDETECT_sensorOrientation *tilt, Sensor tilts around the x, y and z axes, radians
+                  float *rotW, Rotation matrix, 3 x 3 row-major
+ * Return Type  : void
+ */
+static void inDetect_computeRotationMatrix(const IDETECT_sensorOrientation *tilt, float *rotW)
+{
+    float sx = sinf(tilt->xTilt), cx = cosf(tilt->xTilt);
+    float sy = sinf(tilt->yTilt), cy = cosf(tilt->yTilt);
+    float sz = sinf(tilt->zTilt), cz = cosf(tilt->zTilt);
+    float rotX[9] = {1.f, 0.f, 0.f,
+                     0.f, cx,  -sx,
+                     0.f, sx,  cx};
+    float rotY[9] = {cy,  0.f, sy,
+                     0.f, 1.f, 0.f,
+                     -sy, 0.f, cy};
+    float rotZ[9] = {cz,  -sz, 0.f,
+                     sz,  cz,  0.f,
+                     0.f, 0.f, 1.f};
+    float rotZY[9];
+
+    inDetect_matrixMultiply(3, 3, 3, rotZ, rotY, rotZY);
+    inDetect_matrixMultiply(3, 3, 3, rotZY, rotX, rotW);
+}
+
+/*
+ This function computes the world coordinates of the center of a heatmap cell
+ * Arguments    : const IDETECT_moduleConfig *config, Module configuration
+                  const float *rotW, Sensor to world rotation matrix
+                  uint32_t cellInd, Heatmap index of the cell
+                  float *world, World coordinates (x, y, z), m
+ * Return Type  : bool, false if the cell does not map to a valid point
+ */
+static bool inDetect_cellToWorld(const IDETECT_moduleConfig *config, const float *rotW, uint32_t cellInd, float *world)
+{
+    uint32_t numRangeAzim = (uint32_t) config->numRangeBins * config->numAzimBins;
+    uint32_t elevInd = cellInd / numRangeAzim;
+    uint32_t azimInd = (cellInd % numRangeAzim) / config->numRangeBins;
+    uint32_t rangeInd = (cellInd % numRangeAzim) % config->numRangeBins;
+    float range = (float) rangeInd * config->rangeStep - config->rangeBias;
+    float azim = config->azimuthGrid[azimInd];
+    float elev = config->elevationGrid[elevInd];
+    float point[3];
+    float rotated[3];
+
+    if (range < 0.f)
+    {
+        return false;
+    }
+
+    if (config->isGridInMuNuDomain)
+    {
+        if ((fabsf(elev) > 1.f) || (fabsf(azim / cosf(asinf(elev))) > 1.f))
+        {
+            return false;
+        }
+        point[0] = range * azim;
+        point[2] = range * elev;
+        point[1] = sqrtf(range * range - point[0] * point[0] - point[2] * point[2]);
+    }
+    else
+    {
+        float rangeCosElev;
+
+        if ((fabsf(elev) > 1.5707963705f) || (fabsf(azim) > 1.5707963705f))
+        {
+            return false;
+        }
+        rangeCosElev = range * cosf(elev);
+        point[0] = sinf(azim) * rangeCosElev;
+        point[1] = cosf(azim) * rangeCosElev;
+        point[2] = range * sinf(elev);
+    }
+
+    inDetect_matrixMultiply(3, 3, 1, rotW, point, rotated);
+    world[0] = config->sceneryParams.sensorPosition.x + rotated[0];
+    world[1] = config->sceneryParams.sensorPosition.y + rotated[1];
+    world[2] = config->sceneryParams.sensorPosition.z + rotated[2];
+
+    return true;
+}
+
+/*
+ This function checks whether a point is strictly inside a boundary box
+ * Arguments    : const float *point, World coordinates (x, y, z), m
+                  const IDETECT_boundaryBox *box, Boundary box
+ * Return Type  : bool, true if inside
+ */
+static bool inDetect_isPointInsideBox(const float *point, const IDETECT_boundaryBox *box)
+{
+    return ((point[0] > box->x1) && (point[0] < box->x2) &&
+            (point[1] > box->y1) && (point[1] < box->y2) &&
+            (point[2] > box->z1) && (point[2] < box->z2));
+}
+
+/*
+ This function assigns the heatmap cells to the occupancy boxes and builds the per box span lists
+ * Arguments    : IDETECT_moduleInstance *inst, Algorithm instance
+                  const IDETECT_moduleConfig *config, Module configuration
+ * Return Type  : int32_t, IDETECT_EOK or error code
+ */
+static int32_t inDetect_buildCellLists(IDETECT_moduleInstance *inst, const IDETECT_moduleConfig *config)
+{
+    int32_t retVal = IDETECT_EOK;
+    uint8_t *cellBox;
+    float rotW[9];
+    float world[3];
+    uint32_t cellInd, totalSpans;
+    uint8_t boxInd;
+    IDETECT_cellSpan *span;
+
+    /* Temporary box index per cell */
+    cellBox = (uint8_t *) inDetect_malloc(inst->numTotalBins);
+    if (cellBox == NULL)
+    {
+        retVal = IDETECT_ENOMEM;
+        goto exit;
+    }
+    memset(cellBox, IDETECT_POINT_NOT_ASSOCIATED, inst->numTotalBins);
+
+    inDetect_computeRotationMatrix(&config->sceneryParams.sensorOrientation, rotW);
+
+    /* First box containing the cell wins. Count the spans, a new span starts at each range row or box change */
+    totalSpans = 0;
+    for (cellInd = 0; cellInd < inst->numTotalBins; cellInd++)
+    {
+        if (inDetect_cellToWorld(config, rotW, cellInd, world))
+        {
+            for (boxInd = 0; boxInd < inst->numOccupancyBoxes; boxInd++)
+            {
+                if (inDetect_isPointInsideBox(world, &config->sceneryParams.occupancyBox[boxInd]))
+                {
+                    cellBox[cellInd] = boxInd;
+                    inst->box[boxInd].numCells++;
+                    if ((cellInd % inst->numRangeBins == 0) || (cellBox[cellInd - 1U] != boxInd))
+                    {
+                        inst->box[boxInd].numSpans++;
+                        totalSpans++;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    inst->spanBlockSizeInBytes = (totalSpans > 0) ? totalSpans * sizeof(IDETECT_cellSpan) : sizeof(IDETECT_cellSpan);
+    inst->spanBlock = (IDETECT_cellSpan *) inDetect_malloc(inst->spanBlockSizeInBytes);
+    if (inst->spanBlock == NULL)
+    {
+        retVal = IDETECT_ENOMEM;
+        goto exit;
+    }
+
+    span = inst->spanBlock;
+    for (boxInd = 0; boxInd < inst->numOccupancyBoxes; boxInd++)
+    {
+        inst->box[boxInd].span = span;
+        span += inst->box[boxInd].numSpans;
+        inst->box[boxInd].numSpans = 0;
+    }
+
+    for (cellInd = 0; cellInd < inst->numTotalBins; cellInd++)
+    {
+        IDETECT_boxInstance *box;
+
+        boxInd = cellBox[cellInd];
+        if (boxInd == IDETECT_POINT_NOT_ASSOCIATED)
+        {
+            continue;
+        }
+        box = &inst->box[boxInd];
+        if ((cellInd % inst->numRangeBins == 0) || (cellBox[cellInd - 1U] != boxInd))
+        {
+            box->span[box->numSpans].start = (uint16_t) cellInd;
+            box->span[box->numSpans].length = 0;
+            box->numSpans++;
+        }
+        box->span[box->numSpans - 1U].length++;
+    }
+
+exit:
+    if (cellBox != NULL)
+    {
+        inDetect_free(cellBox, inst->numTotalBins);
+    }
+    return retVal;
+}
+
+/*
+ This function computes the mean and inverse variance of the reference zone
+ * Arguments    : IDETECT_moduleInstance *inst, Algorithm instance
+                  const int16_t *heatmap, SNR heatmap
+ * Return Type  : void
+ */
+static void inDetect_referenceStats(IDETECT_moduleInstance *inst, const int16_t *heatmap)
+{
+    const IDETECT_boxInstance *ref = &inst->box[IDETECT_POINT_REFERENCE_ZONE];
+    float mean = 0.f, var = 0.f;
+    float meanLane[IDETECT_NUM_SUM_LANES] = {0.f};
+    float varLane[IDETECT_NUM_SUM_LANES] = {0.f};
+    uint32_t spanInd, k, lane;
+
+    if (ref->numCells > 0)
+    {
+        for (spanInd = 0; spanInd < ref->numSpans; spanInd++)
+        {
+            const int16_t *x = &heatmap[ref->span[spanInd].start];
+            uint32_t length = ref->span[spanInd].length;
+
+            for (k = 0; k + IDETECT_NUM_SUM_LANES <= length; k += IDETECT_NUM_SUM_LANES)
+            {
+                for (lane = 0; lane < IDETECT_NUM_SUM_LANES; lane++)
+                {
+                    float v = inDetect_pow2(inst->pow2Lut, x[k + lane]);
+
+                    meanLane[lane] = v + meanLane[lane];
+                    varLane[lane] = v * v + varLane[lane];
+                }
+            }
+            for (lane = 0; k < length; k++, lane++)
+            {
+                float v = inDetect_pow2(inst->pow2Lut, x[k]);
+
+                meanLane[lane] = v + meanLane[lane];
+                varLane[lane] = v * v + varLane[lane];
+            }
+        }
+        mean = inDetect_sumLanes(meanLane);
+        var = inDetect_sumLanes(varLane);
+        mean = mean / (float) ref->numCells;
+        var = var / (float) ref->numCells;
+        var = var - mean * mean;
+    }
+
+    inst->meanReference = mean;
+    inst->invVarReference = (var > 0.f) ? (1.f / var) : 0.f;
+}
+
+/*
+ This function computes the heatmap maximum of each range bin across azimuth-elevation.
+ The maximum is taken on the log2 samples, the conversion to linear scale is monotonic
+ * Arguments    : IDETECT_moduleInstance *inst, Algorithm instance
+                  const int16_t *heatmap, SNR heatmap
+ * Return Type  : void
+ */
+static void inDetect_computeMaxPerRange(IDETECT_moduleInstance *inst, const int16_t *heatmap)
+{
+    int16_t *maxLog = inst->maxPerRangeBinLog;
+    uint32_t numRows = (uint32_t) inst->numAzimBins * inst->numElevBins;
+    uint32_t row, r;
+
+    for (r = 0; r < inst->numRangeBins; r++)
+    {
+        maxLog[r] = INT16_MIN;
+    }
+    for (row = 0; row < numRows; row++)
+    {
+        const int16_t *x = &heatmap[row * inst->numRangeBins];
+
+        for (r = 0; r < inst->numRangeBins; r++)
+        {
+            maxLog[r] = (x[r] > maxLog[r]) ? x[r] : maxLog[r];
+        }
+    }
+    for (r = 0; r < inst->numRangeBins; r++)
+    {
+        inst->maxPerRangeBin[r] = inDetect_pow2(inst->pow2Lut, maxLog[r]);
+    }
+}
+
+/*
+ This function computes the occupancy signal of a box
+ * Arguments    : IDETECT_moduleInstance *inst, Algorithm instance
+                  const int16_t *heatmap, SNR heatmap
+                  uint8_t boxInd, Box index
+ * Return Type  : void
+ */
+static void inDetect_computeBoxSignal(IDETECT_moduleInstance *inst, const int16_t *heatmap, uint8_t boxInd)
+{
+    IDETECT_boxInstance *box = &inst->box[boxInd];
+    uint32_t numRange = inst->numRangeBins;
+    uint32_t numAzim = inst->numAzimBins;
+    uint32_t numElev = inst->numElevBins;
+    uint32_t numRangeAzim = numRange * numAzim;
+    bool peakCheck = (inst->sigProcParams.localPeakCheck[boxInd] == IDETECT_LOCAL_PEAK_CHECK_2D);
+    float sidelobeThre = inst->sigProcParams.sidelobeThre[boxInd];
+    int32_t peakExp = (int32_t) inst->sigProcParams.peakExpSamples[boxInd];
+    float mean = inst->meanReference;
+    float signal = 0.f;
+    float signalLane[IDETECT_NUM_SUM_LANES] = {0.f};
+    uint32_t spanInd, k, lane;
+
+    for (spanInd = 0; spanInd < box->numSpans; spanInd++)
+    {
+        uint32_t start = box->span[spanInd].start;
+        uint32_t length = box->span[spanInd].length;
+        const int16_t *x = &heatmap[start];
+
+        if (!peakCheck)
+        {
+            for (k = 0; k + IDETECT_NUM_SUM_LANES <= length; k += IDETECT_NUM_SUM_LANES)
+            {
+                for (lane = 0; lane < IDETECT_NUM_SUM_LANES; lane++)
+                {
+                    float d = inDetect_pow2(inst->pow2Lut, x[k + lane]) - mean;
+
+                    signalLane[lane] = d * d + signalLane[lane];
+                }
+            }
+            for (lane = 0; k < length; k++, lane++)
+            {
+                float d = inDetect_pow2(inst->pow2Lut, x[k]) - mean;
+
+                signalLane[lane] = d * d + signalLane[lane];
+            }
+        }
+        else
+        {
+            uint32_t elevInd = start / numRangeAzim;
+            uint32_t azimInd = (start % numRangeAzim) / numRange;
+            uint32_t rangeInd = (start % numRangeAzim) % numRange;
+            const int16_t *neighbor[8];
+            uint32_t numNeighbors = 0;
+            int32_t i, j;
+
+            /* Rows of the 8 azimuth-elevation neighbors, with wrap around */
+            for (i = -1; i <= 1; i++)
+            {
+                for (j = -1; j <= 1; j++)
+                {
+                    if ((i != 0) || (j != 0))
+                    {
+                        neighbor[numNeighbors++] = &heatmap[inDetect_wrap((int32_t) azimInd + i, numAzim) * numRange +
+                                                            inDetect_wrap((int32_t) elevInd + j, numElev) * numRangeAzim +
+                                                            rangeInd];
+                    }
+                }
+            }
+
+            for (k = 0; k < length; k++)
+            {
+                uint32_t n;
+                float v, d;
+
+                for (n = 0; n < 8U; n++)
+                {
+                    if (neighbor[n][k] > x[k])
+                    {
+                        break;
+                    }
+                }
+                if (n < 8U)
+                {
+                    continue;
+                }
+
+                v = inDetect_pow2(inst->pow2Lut, x[k]);
+                if ((sidelobeThre > 0.f) && (v < sidelobeThre * inst->maxPerRangeBin[rangeInd + k]))
+                {
+                    continue;
+                }
+                d = v - mean;
+                signal = d * d + signal;
+
+                /* Peak expansion, the neighborhood samples are taken regardless of the box they belong to */
+                for (i = -peakExp; (peakExp > 0) && (i <= peakExp); i++)
+                {
+                    uint32_t azimOffset = inDetect_wrap((int32_t) azimInd + i, numAzim) * numRange + rangeInd + k;
+
+                    for (j = -peakExp; j <= peakExp; j++)
+                    {
+                        if ((i == 0) && (j == 0))
+                        {
+                            continue;
+                        }
+                        d = inDetect_pow2(inst->pow2Lut,
+                                          heatmap[azimOffset + inDetect_wrap((int32_t) elevInd + j, numElev) * numRangeAzim]) - mean;
+                        signal = d * d + signal;
+                    }
+                }
+            }
+        }
+    }
+
+    if (!peakCheck)
+    {
+        signal = inDetect_sumLanes(signalLane);
+    }
+    if (box->numCells > 0)
+    {
+        signal = (inst->invVarReference * signal) / (float) box->numCells;
+    }
+    box->occBoxSignal = signal;
+}
+
+/*
+ This function updates the occupancy state of a box
+ * Arguments    : IDETECT_moduleInstance *inst, Algorithm instance
+                  uint8_t boxInd, Box index
+ * Return Type  : void
+ */
+static void inDetect_boxStateMachine(IDETECT_moduleInstance *inst, uint8_t boxInd)
+{
+    IDETECT_boxInstance *box = &inst->box[boxInd];
+    bool hit = (box->occBoxSignal > inst->stateParams.occupancyThre[boxInd]);
+
+    if (box->state == IDETECT_OCC_STATE_ACTIVE)
+    {
+        if (hit)
+        {
+            box->active2freeCount = 0;
+        }
+        else
+        {
+            box->active2freeCount++;
+            if (box->active2freeCount > inst->stateParams.active2freeThre[boxInd])
+            {
+                box->state = IDETECT_OCC_STATE_FREE;
+            }
+        }
+    }
+    else
+    {
+        if (hit)
+        {
+            box->free2activeCount++;
+            if (box->free2activeCount > inst->stateParams.free2activeThre[boxInd])
+            {
+                box->state = IDETECT_OCC_STATE_ACTIVE;
+            }
+        }
+        else if (box->free2activeCount > 0)
+        {
+            box->free2activeCount--;
+        }
+    }
+}
+
+/*
+ This function adds up the partial sums, pairwise. With a single lane it returns the sum as accumulated
+ * Arguments    : const float *lane, IDETECT_NUM_SUM_LANES partial sums
+ * Return Type  : float, Sum
+ */
+static float inDetect_sumLanes(const float *lane)
+{
+    float sum[IDETECT_NUM_SUM_LANES];
+    uint32_t n, k;
+
+    for (k = 0; k < IDETECT_NUM_SUM_LANES; k++)
+    {
+        sum[k] = lane[k];
+    }
+    for (n = IDETECT_NUM_SUM_LANES; n > 1U; n = (n + 1U) >> 1)
+    {
+        for (k = 0; k < (n >> 1); k++)
+        {
+            sum[k] = sum[2U * k] + sum[2U * k + 1U];
+        }
+        if ((n & 1U) != 0)
+        {
+            sum[n >> 1] = sum[n - 1U];
+        }
+    }
+    return sum[0];
+}
@@ -0,0 +1,147 @@
+/*!
+ *  \file   inDetect_internal.h
+ *
+ *  \brief  Internal definitions of the open intrusion detection module
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Open implementation of the intrusion detection module
+ *  The implementation is a drop-in replacement of alg_intrusionDetection library and implements the API defined in inDetect.h
+ *
+ *  Cell lists
+ *  At create time every heatmap cell is mapped to world coordinates and assigned to the first occupancy box containing it.
+ *  Each box keeps the cells assigned to it as a list of spans. A span is a run of consecutive range bins at a fixed
+ *  azimuth-elevation bin, so it is contiguous in the [Elevation][Azimuth][Range] heatmap. The spans of a box are sorted by
+ *  heatmap index, so the per-frame accumulations see the cells in the same order as a full heatmap scan
+ */
+
+#ifndef INTRDETECT_INTERNAL_H
+#define INTRDETECT_INTERNAL_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#include <source/alg/intrusionDetection/inDetect.h>
+
+
+/* Occupancy box states */
+#define IDETECT_OCC_STATE_FREE      (0U)    /* Box is free */
+#define IDETECT_OCC_STATE_ACTIVE    (1U)    /* Box is occupied */
+
+
+/* Local peak check modes */
+#define IDETECT_LOCAL_PEAK_CHECK_2D (2U)    /* 2D local peak check across azimuth-elevation */
+
+
+/* The heatmap is log2 in Q11. Linear values are built from a table of the fractional part */
+#define IDETECT_LOG2_FRAC_BITS      (11U)
+#define IDETECT_POW2_LUT_SIZE       (1U << IDETECT_LOG2_FRAC_BITS)
+
+
+/* Number of partial sums of the reference zone statistics and of the box signals without peak check.
+ * With 1 the cells are accumulated one after the other, in the order of the library, and the signals and decisions are
+ * bit-identical to it. With more lanes, cell k of a span goes to partial sum k % IDETECT_NUM_SUM_LANES: the additions
+ * no longer wait on each other (FPU pipeline, SIMD lanes of a host build), and the signals differ from the library in
+ * the last bits. tools/inDetect_host_check.sh measures both */
+#ifndef IDETECT_NUM_SUM_LANES
+#define IDETECT_NUM_SUM_LANES       (1U)
+#endif
+
+
+/* Cycle counter used for benchmarking. Host builds report the process clock */
+#ifdef SUBSYS_MSS
+#define IDETECT_CYCLE_COUNT()       inDetect_getCycleCount()
+#else
+#include <time.h>
+#define IDETECT_CYCLE_COUNT()       ((uint32_t) clock())
+#endif
+
+
+/* Run of consecutive range bins at a fixed azimuth-elevation bin */
+typedef struct
+{
+    uint16_t start;             /* Heatmap index of the first cell */
+    uint16_t length;            /* Number of cells */
+} IDETECT_cellSpan;
+
+
+/* Occupancy box instance */
+typedef struct
+{
+    uint8_t state;                  /* Occupancy state, IDETECT_OCC_STATE_FREE or IDETECT_OCC_STATE_ACTIVE */
+    uint16_t free2activeCount;      /* Hit counter in FREE state */
+    uint16_t active2freeCount;      /* Consecutive miss counter in ACTIVE state */
+    float occBoxSignal;             /* Occupancy signal of the current frame */
+    uint32_t numCells;              /* Number of heatmap cells assigned to the box */
+    IDETECT_cellSpan *span;         /* Cells assigned to the box, sorted by heatmap index */
+    uint32_t numSpans;              /* Number of spans */
+} IDETECT_boxInstance;
+
+
+/* Algorithm instance */
+typedef struct
+{
+    uint16_t numRangeBins;          /* Number of range bins */
+    uint16_t numAzimBins;           /* Number of azimuth bins */
+    uint16_t numElevBins;           /* Number of elevation bins */
+    uint32_t numTotalBins;          /* Number of heatmap cells */
+
+    uint8_t numOccupancyBoxes;      /* Number of occupancy boxes, the first one is the reference zone */
+    IDETECT_stateParams stateParams;        /* State parameters */
+    IDETECT_sigProcParams sigProcParams;    /* Signal processing parameters */
+    bool sidelobeCheck;             /* True if any box needs the per range bin maximum */
+
+    IDETECT_boxInstance box[IDETECT_MAX_OCCUPANCY_BOXES];   /* Occupancy boxes */
+    IDETECT_cellSpan *spanBlock;    /* Memory block holding the spans of all the boxes */
+    uint32_t spanBlockSizeInBytes;  /* Size of the span memory block */
+
+    int16_t maxPerRangeBinLog[IDETECT_RANGE_BINS_MAX];  /* Per range bin heatmap maximum, log2 */
+    float maxPerRangeBin[IDETECT_RANGE_BINS_MAX];       /* Per range bin heatmap maximum, linear */
+    float meanReference;            /* Mean of the reference zone, linear */
+    float invVarReference;          /* Inverse variance of the reference zone, 0 if the variance is not positive */
+
+    uint16_t pow2Lut[IDETECT_POW2_LUT_SIZE];    /* Fractional part of 2^x, in units of 2^-11 */
+
+    uint32_t benchmarks[IDETECT_BENCHMARK_COMPUTE + 1U];    /* Cycle counts, indexed by IDETECT_BENCHMARK_xxx */
+} IDETECT_moduleInstance;
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,223 @@
+/*!
+ *  \file   inDetect_host_check.c
+ *
+ *  \brief  Host check of the open intrusion detection against the library
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** Host check of inDetect.c
+ *  Runs the open implementation, built for the host, on the test vectors written by inDetect_vectors.py, which hold the
+ *  outputs of the alg_intrusionDetection library run by the R5F emulator on the same configurations and heatmaps.
+ *  With IDETECT_NUM_SUM_LANES 1 (default) every occupancy signal and decision must be bit-identical to the library.
+ *  With more lanes the signals must stay within CHECK_LANES_TOLERANCE of the library, relative, and the decision
+ *  agreement is reported. The compute time per frame is measured on the host.
+ *  Usage: inDetect_host_check <vectors>. See inDetect_host_check.sh
+ */
+
+#include "../src/inDetect_internal.h"
+
+
+/* Relative tolerance on the occupancy signals with several sum lanes: float sums over up to a few thousand cells */
+#define CHECK_LANES_TOLERANCE       (1e-4f)
+/* Number of runs over the frames of a configuration for the timing */
+#define CHECK_TIMING_RUNS           (20U)
+
+
+void *inDetect_malloc(uint32_t sizeInBytes)
+{
+    return malloc(sizeInBytes);
+}
+
+void inDetect_free(void *pFree, uint32_t sizeInBytes)
+{
+    (void) sizeInBytes;
+    free(pFree);
+}
+
+/*
+ This function reads a configuration and its frames from the test vectors
+ * Arguments    : FILE *f, Test vectors
+                  IDETECT_moduleConfig *config, Output configuration
+                  int32_t *numFrames, Output number of frames
+                  int16_t **heatmaps, Output heatmaps, [numFrames][numTotalBins], allocated
+                  IDETECT_output **ref, Output library outputs, [numFrames], allocated
+ * Return Type  : int32_t, 0 on success
+ */
+static int32_t inDetect_checkRead(FILE *f, IDETECT_moduleConfig *config, int32_t *numFrames, int16_t **heatmaps,
+                                  IDETECT_output **ref)
+{
+    int32_t cfgBytes, n;
+    uint32_t numCells;
+
+    /* The configuration is stored up to scratchBuffer, where the R5F and host layouts start to differ */
+    memset(config, 0, sizeof(IDETECT_moduleConfig));
+    if ((fread(&cfgBytes, sizeof(int32_t), 1, f) != 1) ||
+        (cfgBytes != (int32_t) offsetof(IDETECT_moduleConfig, scratchBuffer)) ||
+        (fread(config, 1, (size_t) cfgBytes, f) != (size_t) cfgBytes) ||
+        (fread(numFrames, sizeof(int32_t), 1, f) != 1) || (*numFrames <= 0))
+    {
+        return -1;
+    }
+    numCells = (uint32_t) config->numRangeBins * config->numAzimBins * config->numElevBins;
+    *heatmaps = (int16_t *) malloc((size_t) *numFrames * numCells * sizeof(int16_t));
+    *ref = (IDETECT_output *) malloc((size_t) *numFrames * sizeof(IDETECT_output));
+    for (n = 0; n < *numFrames; n++)
+    {
+        /* IDETECT_output is float[16] then uint8_t[16], 80 bytes on both sides */
+        if ((fread(&(*heatmaps)[(size_t) n * numCells], sizeof(int16_t), numCells, f) != numCells) ||
+            (fread(&(*ref)[n], sizeof(IDETECT_output), 1, f) != 1))
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    IDETECT_moduleConfig config;
+    IDETECT_output out;
+    int16_t *heatmaps;
+    IDETECT_output *ref;
+    int32_t numConfigs, numFrames, cfgInd, n, errCode;
+    uint32_t numCells, run, b;
+    uint32_t numFramesTotal = 0, numMismatch = 0, numDecisions = 0, numDecisionDiffer = 0;
+    float maxRelDiff = 0.f;
+    double seconds = 0.0, secondsFullSize = 0.0;
+    uint32_t framesFullSize = 0;
+    void *handle;
+    FILE *f;
+    clock_t start;
+    int32_t status = 0;
+
+    if ((argc < 2) || ((f = fopen(argv[1], "rb")) == NULL) || (fread(&numConfigs, sizeof(int32_t), 1, f) != 1))
+    {
+        printf("usage: %s <vectors written by inDetect_vectors.py>\n", argv[0]);
+        return 2;
+    }
+
+    printf("IDETECT_NUM_SUM_LANES %u\n", (uint32_t) IDETECT_NUM_SUM_LANES);
+    for (cfgInd = 0; cfgInd < numConfigs; cfgInd++)
+    {
+        uint32_t cfgMismatch = 0;
+        double cfgSeconds;
+
+        if (inDetect_checkRead(f, &config, &numFrames, &heatmaps, &ref) != 0)
+        {
+            printf("%s: truncated, or configuration layout not matching\n", argv[1]);
+            return 2;
+        }
+        numCells = (uint32_t) config.numRangeBins * config.numAzimBins * config.numElevBins;
+
+        handle = inDetect_create(&config, &errCode);
+        if (handle == NULL)
+        {
+            printf("configuration %d: inDetect_create failed: %d\n", cfgInd, errCode);
+            return 1;
+        }
+        for (n = 0; n < numFrames; n++)
+        {
+            const IDETECT_output *r = &ref[n];
+
+            memset(&out, 0, sizeof(out));
+            inDetect_compute(handle, &heatmaps[(size_t) n * numCells], &out);
+            if (memcmp(&out, r, sizeof(out)) != 0)
+            {
+                cfgMismatch++;
+            }
+            for (b = 1; b < config.sceneryParams.numOccupancyBoxes; b++)
+            {
+                float scale = (fabsf(r->occBoxSignal[b]) > FLT_MIN) ? fabsf(r->occBoxSignal[b]) : 1.f;
+                float rel = fabsf(out.occBoxSignal[b] - r->occBoxSignal[b]) / scale;
+
+                maxRelDiff = (rel > maxRelDiff) ? rel : maxRelDiff;
+                numDecisionDiffer += (out.occBoxDecision[b] != r->occBoxDecision[b]) ? 1U : 0U;
+                numDecisions++;
+            }
+        }
+        inDetect_delete(handle);
+
+        /* Timing on fresh instances, the outputs are not checked again */
+        start = clock();
+        for (run = 0; run < CHECK_TIMING_RUNS; run++)
+        {
+            handle = inDetect_create(&config, &errCode);
+            for (n = 0; n < numFrames; n++)
+            {
+                inDetect_compute(handle, &heatmaps[(size_t) n * numCells], &out);
+            }
+            inDetect_delete(handle);
+        }
+        cfgSeconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+        if (numCells == IDETECT_RANGE_BINS_MAX * IDETECT_AZIM_BINS_MAX * IDETECT_ELEV_BINS_MAX)
+        {
+            secondsFullSize += cfgSeconds;
+            framesFullSize += CHECK_TIMING_RUNS * (uint32_t) numFrames;
+        }
+        seconds += cfgSeconds;
+
+        printf("configuration %2d: %2u x %2u x %2u cells, %u boxes, %2d frames, %s\n", cfgInd, config.numRangeBins,
+               config.numAzimBins, config.numElevBins, config.sceneryParams.numOccupancyBoxes, numFrames,
+               (cfgMismatch == 0) ? "bit-identical" : "differs from the library");
+        numMismatch += cfgMismatch;
+        numFramesTotal += (uint32_t) numFrames;
+        free(heatmaps);
+        free(ref);
+    }
+    fclose(f);
+
+    printf("frames: %u, not bit-identical: %u, max relative signal difference %.3g, decision agreement %.2f%%\n",
+           numFramesTotal, numMismatch, maxRelDiff, 100.0 * (numDecisions - numDecisionDiffer) / numDecisions);
+    printf("create + compute: %.1f us/frame over all configurations", 1e6 * seconds / (CHECK_TIMING_RUNS * numFramesTotal));
+    if (framesFullSize > 0)
+    {
+        printf(", %.1f us/frame at 64 x 32 x 32", 1e6 * secondsFullSize / framesFullSize);
+    }
+    printf("\n");
+
+    if ((IDETECT_NUM_SUM_LANES == 1U) && (numMismatch != 0))
+    {
+        printf("FAIL: the open implementation is not bit-identical to the library\n");
+        status = 1;
+    }
+    if (maxRelDiff > CHECK_LANES_TOLERANCE)
+    {
+        printf("FAIL: occupancy signals differ from the library by more than %g\n", CHECK_LANES_TOLERANCE);
+        status = 1;
+    }
+    if (status == 0)
+    {
+        printf("PASS\n");
+    }
+    return status;
+}
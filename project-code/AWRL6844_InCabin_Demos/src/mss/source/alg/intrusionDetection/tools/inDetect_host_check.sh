@@ -0,0 +1,63 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Check the open intrusion detection (../src/inDetect.c) on the host against the alg_intrusionDetection library
+#
+#   inDetect_host_check.sh
+#       runs the library with the R5F emulator on the configurations and heatmaps of inDetect_vectors.py, then builds
+#       inDetect.c with all warnings as errors and checks that its signals and decisions are bit-identical to the
+#       library. A second build with IDETECT_NUM_SUM_LANES 4 is checked against the library within a tolerance
+#
+# Needs python3 with numpy and a host C compiler (CC, default cc). BUILD_DIR defaults to ./inDetect_host_check_build,
+# NUM_FRAMES (default 0, the per configuration defaults: 446 frames, a few minutes in the emulator) sets the frames of
+# every configuration
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+MSS_DIR="$TOOLS_DIR/../../../.."
+LIBRARY="$TOOLS_DIR/../lib/alg_intrusionDetection.xwrL684x.r5f.ti-arm-clang.release.lib"
+BUILD_DIR=${BUILD_DIR:-./inDetect_host_check_build}
+NUM_FRAMES=${NUM_FRAMES:-0}
+CC=${CC:-cc}
+
+# No contraction into fused multiply-adds: the library rounds every product
+CFLAGS="-O2 -std=c11 -Wall -Wextra -Werror -ffp-contract=off"
+
+mkdir -p "$BUILD_DIR"
+python3 "$TOOLS_DIR/inDetect_vectors.py" --library "$LIBRARY" --frames $NUM_FRAMES --out "$BUILD_DIR/inDetect_vectors.bin"
+for LANES in 1 4; do
+    $CC $CFLAGS -DIDETECT_NUM_SUM_LANES=${LANES}U -I "$MSS_DIR" -o "$BUILD_DIR/inDetect_host_check_$LANES" \
+        "$TOOLS_DIR/inDetect_host_check.c" "$SRC_DIR/inDetect.c" -lm
+    "$BUILD_DIR/inDetect_host_check_$LANES" "$BUILD_DIR/inDetect_vectors.bin"
+done
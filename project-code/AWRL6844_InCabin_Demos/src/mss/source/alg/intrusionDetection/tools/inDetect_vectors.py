@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Test vectors of the intrusion detection library for inDetect_host_check.c
+
+Runs the prebuilt alg_intrusionDetection library with the R5F emulator (tools/r5f_emu) on synthetic SNR heatmaps and
+writes its outputs, which the open implementation in ../src/inDetect.c must reproduce bit for bit.
+
+The configurations cover the mu-nu and angle grids, sensor tilts, 2 to 7 boxes, the 2D local peak check with and
+without the sidelobe threshold, peak expansion of 0 to 2 samples, and several heatmap sizes up to the maximum
+64 x 32 x 32. The heatmaps are a noise floor in log2 Q11, negative samples included, whose level changes every few
+frames, with bursts of strong cells, so that the boxes go through the FREE and ACTIVE states.
+
+The library calls sinf, cosf, asinf, atanf, sqrtf and log2f. The emulator runs them with the host C library, the
+same functions inDetect.c uses in the host check, so the cell to box assignment is compared on the same math.
+
+Usage
+  inDetect_vectors.py --library alg_intrusionDetection...lib --out vectors.bin [--frames N] [--seed S]
+
+vectors.bin: int32 number of configurations, then for each configuration
+  int32 size of the configuration, the IDETECT_moduleConfig bytes up to scratchBuffer (R5F layout),
+  int32 number of frames, then for each frame the int16 heatmap [elev][azim][range] and the library IDETECT_output
+  (float occBoxSignal[16], uint8 occBoxDecision[16]), zero past numOccupancyBoxes
+"""
+
+import argparse
+import ctypes
+import ctypes.util
+import math
+import os
+import struct
+import sys
+import time
+
+import numpy as np
+
+R5F_EMU_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', '..', '..', 'tools', 'r5f_emu')
+
+MAX_BOXES = 16
+MAX_AZIM = 32
+MAX_ELEV = 32
+OUTPUT_BYTES = 4 * MAX_BOXES + MAX_BOXES
+
+
+class ModuleConfig(ctypes.Structure):
+    """IDETECT_moduleConfig of inDetect.h. The R5F and host layouts agree up to scratchBuffer"""
+    _fields_ = [('numRangeBins', ctypes.c_uint16), ('numAzimBins', ctypes.c_uint16),
+                ('numElevBins', ctypes.c_uint16), ('rangeStep', ctypes.c_float), ('rangeBias', ctypes.c_float),
+                ('azimuthGrid', ctypes.c_float * MAX_AZIM), ('elevationGrid', ctypes.c_float * MAX_ELEV),
+                ('isGridInMuNuDomain', ctypes.c_bool),
+                ('sensorPosition', ctypes.c_float * 3), ('sensorOrientation', ctypes.c_float * 3),
+                ('numOccupancyBoxes', ctypes.c_uint8), ('occupancyBox', ctypes.c_float * (6 * MAX_BOXES)),
+                ('occupancyThre', ctypes.c_float * MAX_BOXES), ('free2activeThre', ctypes.c_uint16 * MAX_BOXES),
+                ('active2freeThre', ctypes.c_uint16 * MAX_BOXES), ('localPeakCheck', ctypes.c_uint8 * MAX_BOXES),
+                ('sidelobeThre', ctypes.c_float * MAX_BOXES), ('peakExpSamples', ctypes.c_uint8 * MAX_BOXES),
+                ('scratchBuffer', ctypes.c_uint32), ('scratchBufferSizeInBytes', ctypes.c_uint32)]
+
+
+# (range, azimuth, elevation bins, frames) per configuration; the emulated library takes about 5 s per frame at the
+# full size, 0.3 s at 32 x 16 x 8
+GRIDS = [(32, 16, 8, 40), (32, 16, 16, 40), (48, 16, 8, 40), (24, 8, 16, 40), (32, 8, 8, 40), (64, 32, 32, 6),
+         (40, 16, 8, 40), (32, 16, 8, 40), (16, 16, 16, 40), (32, 32, 4, 40), (32, 8, 16, 40), (48, 8, 8, 40)]
+
+
+def libm_hooks(r5f_emu):
+    """Emulator hooks of the single precision math functions, run by the host C library"""
+    libm = ctypes.CDLL(ctypes.util.find_library('m'))
+    hooks = {}
+    for name in ('sinf', 'cosf', 'asinf', 'atanf', 'sqrtf', 'log2f'):
+        fn = getattr(libm, name)
+        fn.restype = ctypes.c_float
+        fn.argtypes = [ctypes.c_float]
+
+        def hook(emu, fn=fn):
+            emu.s[0] = r5f_emu.f32_bits(fn(r5f_emu.bits_f32(emu.s[0])))
+        hooks[name] = hook
+    return hooks
+
+
+def make_config(rng, case, grid):
+    num_range, num_azim, num_elev = grid[:3]
+    c = ModuleConfig()
+    c.numRangeBins, c.numAzimBins, c.numElevBins = num_range, num_azim, num_elev
+    c.rangeStep = 3.0 / num_range
+    c.rangeBias = float(rng.choice([0.0, 0.05]))
+    c.isGridInMuNuDomain = (case % 4) != 3
+    span = 2.0 if c.isGridInMuNuDomain else 3.1
+    for i in range(num_azim):
+        c.azimuthGrid[i] = (i - num_azim / 2) * span / num_azim
+    for i in range(num_elev):
+        c.elevationGrid[i] = (i - num_elev / 2) * span / num_elev
+    c.sensorPosition[2] = 1.2
+    c.sensorOrientation[0] = -0.6
+    c.sensorOrientation[2] = 0.05 * case
+
+    num_boxes = 2 + case % 6
+    c.numOccupancyBoxes = num_boxes
+    boxes = [[-2.0, 2.0, 2.0, 3.0, -1.0, 3.0]]
+    for b in range(1, num_boxes):
+        x0 = -1.0 + 0.4 * b
+        boxes.append([x0, x0 + 0.6, 0.2, 1.8, 0.0, 1.1])
+        c.occupancyThre[b] = 2.0 if case & 1 else 0.5
+        c.free2activeThre[b] = 2
+        c.active2freeThre[b] = 3
+        c.localPeakCheck[b] = 2 if (case + b) % 3 else 0
+        c.sidelobeThre[b] = 0.3 if b % 2 else 0.0
+        c.peakExpSamples[b] = (case + b) % 3
+    for b, box in enumerate(boxes):
+        for k, v in enumerate(box):
+            c.occupancyBox[6 * b + k] = v
+    return c
+
+
+def make_heatmap(rng, frame, num_cells):
+    amp = 9000 if (frame // 8) % 2 else 3000
+    hm = rng.integers(4000, 4000 + amp, num_cells)
+    hm[rng.integers(0, num_cells, num_cells // 64)] -= 6000
+    if frame % 5 == 0:
+        hm[rng.integers(0, num_cells, num_cells // 200 + 1)] = rng.integers(20000, 25000, num_cells // 200 + 1)
+    return hm.astype(np.int16)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--library', required=True, help='alg_intrusionDetection library')
+    parser.add_argument('--out', required=True, help='test vectors')
+    parser.add_argument('--frames', type=int, default=0, help='frames per configuration, 0 for the defaults')
+    parser.add_argument('--seed', type=int, default=1, help='random seed')
+    args = parser.parse_args()
+
+    sys.path.insert(0, R5F_EMU_DIR)
+    import r5f_emu
+
+    rng = np.random.default_rng(args.seed)
+    cfg_bytes = ModuleConfig.scratchBuffer.offset
+    total_frames = 0
+    start = time.time()
+    with open(args.out, 'wb') as f:
+        f.write(struct.pack('<i', len(GRIDS)))
+        for case, grid in enumerate(GRIDS):
+            num_frames = args.frames if args.frames > 0 else grid[3]
+            num_cells = grid[0] * grid[1] * grid[2]
+            c = make_config(rng, case, grid)
+
+            # A new emulator per configuration, so that the heap does not grow across the instances
+            emu = r5f_emu.R5F([args.library], libm_hooks(r5f_emu))
+            cfg = emu.alloc_array(np.uint8, np.frombuffer(bytes(c), dtype=np.uint8))
+            err = emu.alloc_array(np.int32, [0])
+            handle = emu.call('inDetect_create', cfg, err)
+            if handle == 0 or emu.read_array(err, np.int32, 1)[0] != 0:
+                sys.exit('configuration %d: inDetect_create error %d' % (case, emu.read_array(err, np.int32, 1)[0]))
+            heatmap = emu.malloc(2 * num_cells)
+            out = emu.malloc(OUTPUT_BYTES)
+
+            f.write(struct.pack('<i', cfg_bytes))
+            f.write(bytes(c)[:cfg_bytes])
+            f.write(struct.pack('<i', num_frames))
+            num_active = 0
+            for frame in range(num_frames):
+                hm = make_heatmap(rng, frame, num_cells)
+                emu.write_array(heatmap, np.int16, hm)
+                emu.write_array(out, np.uint8, np.zeros(OUTPUT_BYTES))
+                emu.call('inDetect_compute', handle, heatmap, out)
+                result = bytes(emu.mem[out:out + OUTPUT_BYTES])
+                num_active += sum(result[4 * MAX_BOXES:4 * MAX_BOXES + c.numOccupancyBoxes])
+                f.write(hm.astype('<i2').tobytes())
+                f.write(result)
+            total_frames += num_frames
+            print('configuration %2d: %2d x %2d x %2d cells, %d boxes, %s grid, %2d frames, %3d active box frames'
+                  % (case, grid[0], grid[1], grid[2], c.numOccupancyBoxes,
+                     'mu-nu' if c.isGridInMuNuDomain else 'angle', num_frames, num_active))
+    print('%d frames of the library in %.0f s' % (total_frames, time.time() - start))
+
+
+if __name__ == '__main__':
+    main()
@@ -92,7 +92,11 @@ extern "C" {
 
 /* Number of points limitations */
 #define FEXTRACT_MAX_NUM_POINTS_PER_ZONE            (3200U) /* Defines maximum possible number of points expected per zone across multiple frames (needed to limit total point cloud buffer size) */
+#ifdef FEXTRACT_OPEN
+#define FEXTRACT_MAX_NUM_POINTS_PER_ZONE_PER_FRAME  (800U)  /* Defines maximum possible number of points expected per zone and per frame (needed to limit the per frame scratch buffers) */
+#else
 #define FEXTRACT_MAX_NUM_POINTS_PER_ZONE_PER_FRAME  (200U)  /* Defines maximum possible number of points expected per zone and per frame (needed to limit the clustering algorithm per frame) */
+#endif
 #define FEXTRACT_RATIO_OF_POINTS_ACROSS_FRAMES      (0.8f)  /* The ratio of total points expected to be buffered across frames */
 
 
@@ -276,6 +280,10 @@ typedef struct
     uint32_t scratchBufferSizeInBytes;  /* The amount of bytes needed by the module for per frame scratch processing */
 
     FEXTRACT_point_cloud_compressed_unit pointCloudCompressionUnit; /* Point cloud compression units */
+
+#ifdef FEXTRACT_OPEN
+    bool dbScanMultiFrame;              /* The flag to run DBSCAN on all the points buffered across frames instead of per frame: (true) to enable. Open implementation only (FEXTRACT_OPEN) */
+#endif
 } FEXTRACT_moduleConfig;
 
 
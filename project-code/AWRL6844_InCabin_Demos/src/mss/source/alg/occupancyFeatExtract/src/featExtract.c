@@ -0,0 +1,807 @@
+/*!
+ *  \file   featExtract.c
+ *
+ *  \brief  Open implementation of the occupancy detection system feature extraction module
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Processing steps per frame
+ *  1. Zone assignment: single pass over the input point cloud. Each point is converted to world coordinates and
+ *     appended to the frame arrays of the first zone with a cuboid containing it, up to maxNumPointsPerZonePerFrame points
+ *  2. Optional DBSCAN filtering of the frame points of each zone (grid-indexed, see featExtract_dbscan.c)
+ *  3. Offset correction: the per-zone z offset is added to z, and if offsetCorrection is set the zone xy center is removed
+ *  4. The frame points are quantized and their raw moments stored in the frame slot of the zone, evicting the oldest frame
+ *     once numFramesProc frames are buffered
+ *  5. Once numFramesProc frames are buffered, the features are computed from the moments combined over all the frame slots.
+ *     If dbScanMultiFrame is set, DBSCAN filtering is done at this step on all the buffered points instead of at step 2
+ *
+ *  Input SNR is expected in dB, as provided by the demo point cloud.
+ */
+
+#include "featExtract_internal.h"
+
+
+/* Local function declarations */
+static void featExtract_computeRotation(const FEXTRACT_sensorOrientation *tilt, float *rotW);
+static uint32_t featExtract_persistentBytes(const FEXTRACT_moduleConfig *config, uint16_t bufCapacity, bool keepSamples);
+static uint32_t featExtract_scratchBytes(const FEXTRACT_moduleConfig *config, uint16_t bufCapacity, uint16_t dbScanMaxPoints);
+static void featExtract_assignPoints(FEXTRACT_moduleInstance *inst, const FEXTRACT_measurementPoint *points, uint16_t numPoints);
+static void featExtract_filterFrame(FEXTRACT_moduleInstance *inst, FEXTRACT_framePoints *frame);
+static void featExtract_bufferFrame(FEXTRACT_moduleInstance *inst, uint8_t zoneInd);
+static void featExtract_dimMomentsInit(FEXTRACT_dimMoments *m);
+static void featExtract_dimMomentsAccumulate(const FEXTRACT_bufSample *s, uint16_t numSamples, FEXTRACT_dimMoments *m);
+static void featExtract_dimMomentsCombine(const FEXTRACT_dimMoments *src, FEXTRACT_dimMoments *m);
+static uint16_t featExtract_filterBuffer(FEXTRACT_moduleInstance *inst, uint8_t zoneInd);
+static void featExtract_computeZoneFeatures(FEXTRACT_moduleInstance *inst, uint8_t zoneInd, FEXTRACT_outputPerZone *out);
+
+
+/* Function Definitions */
+/*
+ This function creates an instance of the feature extraction algorithm
+ * Arguments    : FEXTRACT_moduleConfig *config, Module configuration
+                  int32_t *errCode, Error code output
+ * Return Type  : void *, Algorithm handle, NULL in case of error
+ */
+void *featExtract_create(FEXTRACT_moduleConfig *config, int32_t *errCode)
+{
+    FEXTRACT_moduleInstance *inst = NULL;
+    uint32_t bufCapacity;
+    uint32_t persistentBytes, scratchBytes;
+    uint8_t *mem, *scratch;
+    uint8_t zoneInd, cuboidInd, cuboidOffset, d;
+    uint32_t totalCuboids = 0;
+    uint32_t startCycle = FEXTRACT_CYCLE_COUNT();
+
+    *errCode = FEXTRACT_EOK;
+
+    /* Configuration sanity checks */
+    if ((config == NULL) ||
+        (config->sceneryParams.numOccupancyBoxes == 0) ||
+        (config->sceneryParams.numOccupancyBoxes > FEXTRACT_MAX_OCCUPANCY_BOXES) ||
+        (config->numFramesProc == 0) ||
+        (config->maxNumPointsPerZonePerFrame == 0) ||
+        (config->maxNumPointsPerZonePerFrame > FEXTRACT_MAX_NUM_POINTS_PER_ZONE_PER_FRAME) ||
+        (config->dbScanFiltering && ((config->dbScanEpsilon <= 0.f) || (config->dbScanMinPts == 0))))
+    {
+        *errCode = FEXTRACT_EINVAL;
+        goto exit;
+    }
+    for (zoneInd = 0; zoneInd < config->sceneryParams.numOccupancyBoxes; zoneInd++)
+    {
+        if ((config->sceneryParams.numCuboidsPerOccupancyBox[zoneInd] == 0) ||
+            (config->sceneryParams.numCuboidsPerOccupancyBox[zoneInd] > FEXTRACT_MAX_CUBOID_PER_OCCUPANCY_BOX))
+        {
+            *errCode = FEXTRACT_EINVAL;
+            goto exit;
+        }
+        totalCuboids += config->sceneryParams.numCuboidsPerOccupancyBox[zoneInd];
+    }
+    if (totalCuboids > FEXTRACT_MAX_TOTAL_CUBOIDS)
+    {
+        *errCode = FEXTRACT_EINVAL;
+        goto exit;
+    }
+#if FEXTRACT_COMPRESS_POINTS
+    if ((config->pointCloudCompressionUnit.xUnit <= 0.f) || (config->pointCloudCompressionUnit.yUnit <= 0.f) ||
+        (config->pointCloudCompressionUnit.zUnit <= 0.f) || (config->pointCloudCompressionUnit.dopplerUnit <= 0.f) ||
+        (config->pointCloudCompressionUnit.snrdBUnit <= 0.f))
+    {
+        *errCode = FEXTRACT_EINVAL;
+        goto exit;
+    }
+#endif
+
+    /* Size of the multi-frame buffer per zone */
+    bufCapacity = (uint32_t) ceilf((float) config->maxNumPointsPerZonePerFrame * (float) config->numFramesProc * FEXTRACT_RATIO_OF_POINTS_ACROSS_FRAMES);
+    if (bufCapacity > FEXTRACT_MAX_NUM_POINTS_PER_ZONE)
+    {
+        bufCapacity = FEXTRACT_MAX_NUM_POINTS_PER_ZONE;
+    }
+
+    inst = (FEXTRACT_moduleInstance *) featExtract_malloc(sizeof(FEXTRACT_moduleInstance));
+    if (inst == NULL)
+    {
+        *errCode = FEXTRACT_ENOMEM;
+        goto exit;
+    }
+    memset(inst, 0, sizeof(FEXTRACT_moduleInstance));
+    inst->cfg = *config;
+    inst->bufCapacity = (uint16_t) bufCapacity;
+    inst->dbScanMaxPoints = config->dbScanMultiFrame ? inst->bufCapacity : config->maxNumPointsPerZonePerFrame;
+    inst->keepSamples = config->dbScanFiltering && config->dbScanMultiFrame;
+
+    /* Persistent memory: per frame slot moments, and multi-frame ring buffers if needed */
+    persistentBytes = featExtract_persistentBytes(config, inst->bufCapacity, inst->keepSamples);
+    inst->memBlock = (uint8_t *) featExtract_malloc(persistentBytes);
+    if (inst->memBlock == NULL)
+    {
+        featExtract_delete(inst);
+        inst = NULL;
+        *errCode = FEXTRACT_ENOMEM;
+        goto exit;
+    }
+    inst->memBlockSizeInBytes = persistentBytes;
+
+    /* Scratch memory: per-frame arrays, provided by the application or allocated internally */
+    scratchBytes = featExtract_scratchBytes(config, inst->bufCapacity, inst->dbScanMaxPoints);
+    if ((config->scratchBuffer != NULL) && (config->scratchBufferSizeInBytes >= scratchBytes))
+    {
+        scratch = config->scratchBuffer;
+    }
+    else
+    {
+        inst->scratchBlock = (uint8_t *) featExtract_malloc(scratchBytes);
+        if (inst->scratchBlock == NULL)
+        {
+            featExtract_delete(inst);
+            inst = NULL;
+            *errCode = FEXTRACT_ENOMEM;
+            goto exit;
+        }
+        inst->scratchBlockSizeInBytes = scratchBytes;
+        scratch = inst->scratchBlock;
+    }
+
+    /* Carve the memory blocks */
+    mem = inst->memBlock;
+    for (zoneInd = 0; zoneInd < config->sceneryParams.numOccupancyBoxes; zoneInd++)
+    {
+        uint32_t slotInd;
+        if (inst->keepSamples)
+        {
+            for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+            {
+                inst->zone[zoneInd].dim[d] = (FEXTRACT_bufSample *) mem;
+                mem += FEXTRACT_ALIGN(inst->bufCapacity * sizeof(FEXTRACT_bufSample));
+            }
+        }
+        inst->zone[zoneInd].slotMoments = (FEXTRACT_dimMoments *) mem;
+        mem += FEXTRACT_ALIGN(config->numFramesProc * FEXTRACT_NUM_DIMS * sizeof(FEXTRACT_dimMoments));
+        for (slotInd = 0; slotInd < (uint32_t) config->numFramesProc * FEXTRACT_NUM_DIMS; slotInd++)
+        {
+            featExtract_dimMomentsInit(&inst->zone[zoneInd].slotMoments[slotInd]);
+        }
+        inst->zone[zoneInd].numPointsPerFrame = (uint16_t *) mem;
+        mem += FEXTRACT_ALIGN(config->numFramesProc * sizeof(uint16_t));
+        memset(inst->zone[zoneInd].numPointsPerFrame, 0, config->numFramesProc * sizeof(uint16_t));
+
+        for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+        {
+            inst->frame[zoneInd].dim[d] = (float *) scratch;
+            scratch += FEXTRACT_ALIGN(config->maxNumPointsPerZonePerFrame * sizeof(float));
+        }
+    }
+    for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+    {
+        inst->frameSamples[d] = (FEXTRACT_bufSample *) scratch;
+        scratch += FEXTRACT_ALIGN(config->maxNumPointsPerZonePerFrame * sizeof(FEXTRACT_bufSample));
+    }
+    if (config->dbScanFiltering)
+    {
+        featExtract_dbscanScratchAssign(scratch, inst->dbScanMaxPoints, &inst->dbScanScratch);
+        scratch += featExtract_dbscanScratchBytes(inst->dbScanMaxPoints);
+        inst->dbScanKeep = scratch;
+        scratch += FEXTRACT_ALIGN(inst->dbScanMaxPoints * sizeof(uint8_t));
+        if (config->dbScanMultiFrame)
+        {
+            for (d = 0; d < 3U; d++)
+            {
+                inst->mfCoord[d] = (float *) scratch;
+                scratch += FEXTRACT_ALIGN(inst->bufCapacity * sizeof(float));
+            }
+            for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+            {
+                inst->mfKept[d] = (FEXTRACT_bufSample *) scratch;
+                scratch += FEXTRACT_ALIGN(inst->bufCapacity * sizeof(FEXTRACT_bufSample));
+            }
+        }
+    }
+
+    /* Sensor to world rotation */
+    featExtract_computeRotation(&config->sceneryParams.sensorOrientation, inst->rotW);
+
+    /* Zone xy centers used by the offset correction */
+    cuboidOffset = 0;
+    for (zoneInd = 0; zoneInd < config->sceneryParams.numOccupancyBoxes; zoneInd++)
+    {
+        float xMin = FLT_MAX, xMax = -FLT_MAX, yMin = FLT_MAX, yMax = -FLT_MAX;
+        for (cuboidInd = 0; cuboidInd < config->sceneryParams.numCuboidsPerOccupancyBox[zoneInd]; cuboidInd++)
+        {
+            const FEXTRACT_boundaryBox *box = &config->sceneryParams.cuboidDefs[cuboidOffset + cuboidInd];
+            xMin = fminf(xMin, box->x1);
+            xMax = fmaxf(xMax, box->x2);
+            yMin = fminf(yMin, box->y1);
+            yMax = fmaxf(yMax, box->y2);
+        }
+        inst->xyOffset[zoneInd][0] = 0.5f * (xMin + xMax);
+        inst->xyOffset[zoneInd][1] = 0.5f * (yMin + yMax);
+        cuboidOffset += config->sceneryParams.numCuboidsPerOccupancyBox[zoneInd];
+    }
+
+    /* Compression units */
+#if FEXTRACT_COMPRESS_POINTS
+    inst->unit[FEXTRACT_DIM_X] = config->pointCloudCompressionUnit.xUnit;
+    inst->unit[FEXTRACT_DIM_Y] = config->pointCloudCompressionUnit.yUnit;
+    inst->unit[FEXTRACT_DIM_Z] = config->pointCloudCompressionUnit.zUnit;
+    inst->unit[FEXTRACT_DIM_DOPPLER] = config->pointCloudCompressionUnit.dopplerUnit;
+    inst->unit[FEXTRACT_DIM_SNR] = config->pointCloudCompressionUnit.snrdBUnit;
+#else
+    for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+    {
+        inst->unit[d] = 1.f;
+    }
+#endif
+    for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+    {
+        inst->unitInv[d] = 1.f / inst->unit[d];
+    }
+
+    inst->benchmarks[FEXTRACT_BENCHMARK_CREATE] = FEXTRACT_CYCLE_COUNT() - startCycle;
+
+exit:
+    return (void *) inst;
+}
+
+/*
+ This function runs a single step of the feature extraction algorithm
+ * Arguments    : void *handle, Algorithm handle
+                  FEXTRACT_measurementPoint *points, Point cloud of the current frame
+                  uint16_t numPoints, Number of points
+                  FEXTRACT_output *featOut, Features output
+ * Return Type  : void
+ */
+void featExtract_compute(void *handle, FEXTRACT_measurementPoint *points, uint16_t numPoints, FEXTRACT_output *featOut)
+{
+    FEXTRACT_moduleInstance *inst = (FEXTRACT_moduleInstance *) handle;
+    uint8_t numZones = inst->cfg.sceneryParams.numOccupancyBoxes;
+    uint8_t zoneInd;
+    uint32_t startCycle = FEXTRACT_CYCLE_COUNT();
+
+    /* Single pass zone assignment into the per-zone frame arrays */
+    featExtract_assignPoints(inst, points, numPoints);
+
+    for (zoneInd = 0; zoneInd < numZones; zoneInd++)
+    {
+        if (inst->cfg.dbScanFiltering && !inst->cfg.dbScanMultiFrame)
+        {
+            featExtract_filterFrame(inst, &inst->frame[zoneInd]);
+        }
+        featExtract_bufferFrame(inst, zoneInd);
+    }
+
+    /* Advance the frame slot */
+    inst->frameSlot++;
+    if (inst->frameSlot == inst->cfg.numFramesProc)
+    {
+        inst->frameSlot = 0;
+    }
+    if (inst->numFramesBuffered < inst->cfg.numFramesProc)
+    {
+        inst->numFramesBuffered++;
+    }
+
+    /* Features are available once the buffer holds numFramesProc frames */
+    featOut->featuresComputed = (inst->numFramesBuffered == inst->cfg.numFramesProc);
+    if (featOut->featuresComputed)
+    {
+        for (zoneInd = 0; zoneInd < numZones; zoneInd++)
+        {
+            featExtract_computeZoneFeatures(inst, zoneInd, &featOut->featsPerZone[zoneInd]);
+        }
+    }
+
+    inst->benchmarks[FEXTRACT_BENCHMARK_COMPUTE] = FEXTRACT_CYCLE_COUNT() - startCycle;
+}
+
+/*
+ This function deletes the algorithm instance and frees all its resources
+ * Arguments    : void *handle, Algorithm handle
+ * Return Type  : void
+ */
+void featExtract_delete(void *handle)
+{
+    FEXTRACT_moduleInstance *inst = (FEXTRACT_moduleInstance *) handle;
+
+    if (inst == NULL)
+    {
+        return;
+    }
+    if (inst->scratchBlock != NULL)
+    {
+        featExtract_free(inst->scratchBlock, inst->scratchBlockSizeInBytes);
+    }
+    if (inst->memBlock != NULL)
+    {
+        featExtract_free(inst->memBlock, inst->memBlockSizeInBytes);
+    }
+    featExtract_free(inst, sizeof(FEXTRACT_moduleInstance));
+}
+
+/*
+ This function updates the per-zone z offsets at runtime. The new offsets apply to the points of the following frames
+ * Arguments    : void *handle, Algorithm handle
+                  float *zOffset, Z offsets, one per zone
+                  uint8_t numZoffsets, Number of z offsets
+ * Return Type  : int32_t, FEXTRACT_EOK on success, FEXTRACT_EINVAL otherwise
+ */
+int32_t featExtract_updateZoffsets(void *handle, float *zOffset, uint8_t numZoffsets)
+{
+    FEXTRACT_moduleInstance *inst = (FEXTRACT_moduleInstance *) handle;
+
+    if ((inst == NULL) || (zOffset == NULL) || (numZoffsets > inst->cfg.sceneryParams.numOccupancyBoxes))
+    {
+        return FEXTRACT_EINVAL;
+    }
+    memcpy(inst->cfg.zOffset, zOffset, numZoffsets * sizeof(float));
+    return FEXTRACT_EOK;
+}
+
+/*
+ This function computes the rotation from sensor to world coordinates, rotW = rotZ * rotY * rotX.
+ This is the inverse of the rotation used by MmwDemo_computeInvRotationMatrix()
+ * Arguments    : const FEXTRACT_sensorOrientation *tilt, Sensor orientation
+                  float *rotW, Output 3x3 rotation matrix, row-major
+ * Return Type  : void
+ */
+static void featExtract_computeRotation(const FEXTRACT_sensorOrientation *tilt, float *rotW)
+{
+    float sx = sinf(tilt->xTilt), cx = cosf(tilt->xTilt);
+    float sy = sinf(tilt->yTilt), cy = cosf(tilt->yTilt);
+    float sz = sinf(tilt->zTilt), cz = cosf(tilt->zTilt);
+
+    rotW[0] = cz*cy;    rotW[1] = cz*sy*sx - sz*cx;     rotW[2] = cz*sy*cx + sz*sx;
+    rotW[3] = sz*cy;    rotW[4] = sz*sy*sx + cz*cx;     rotW[5] = sz*sy*cx - cz*sx;
+    rotW[6] = -sy;      rotW[7] = cy*sx;                rotW[8] = cy*cx;
+}
+
+/*
+ This function returns the persistent memory needed by the instance, in bytes
+ */
+static uint32_t featExtract_persistentBytes(const FEXTRACT_moduleConfig *config, uint16_t bufCapacity, bool keepSamples)
+{
+    uint32_t perZone = FEXTRACT_ALIGN(config->numFramesProc * FEXTRACT_NUM_DIMS * sizeof(FEXTRACT_dimMoments)) +
+                       FEXTRACT_ALIGN(config->numFramesProc * sizeof(uint16_t));
+
+    if (keepSamples)
+    {
+        perZone += FEXTRACT_NUM_DIMS * FEXTRACT_ALIGN(bufCapacity * sizeof(FEXTRACT_bufSample));
+    }
+
+    return perZone * config->sceneryParams.numOccupancyBoxes;
+}
+
+/*
+ This function returns the per frame scratch memory needed by the instance, in bytes
+ */
+static uint32_t featExtract_scratchBytes(const FEXTRACT_moduleConfig *config, uint16_t bufCapacity, uint16_t dbScanMaxPoints)
+{
+    uint32_t frameBytes = config->sceneryParams.numOccupancyBoxes * FEXTRACT_NUM_DIMS *
+                          FEXTRACT_ALIGN(config->maxNumPointsPerZonePerFrame * sizeof(float)) +
+                          FEXTRACT_NUM_DIMS * FEXTRACT_ALIGN(config->maxNumPointsPerZonePerFrame * sizeof(FEXTRACT_bufSample));
+    uint32_t dbScanBytes = 0;
+
+    if (config->dbScanFiltering)
+    {
+        dbScanBytes = featExtract_dbscanScratchBytes(dbScanMaxPoints) + FEXTRACT_ALIGN(dbScanMaxPoints * sizeof(uint8_t));
+        if (config->dbScanMultiFrame)
+        {
+            dbScanBytes += 3U * FEXTRACT_ALIGN(bufCapacity * sizeof(float)) +
+                           FEXTRACT_NUM_DIMS * FEXTRACT_ALIGN(bufCapacity * sizeof(FEXTRACT_bufSample));
+        }
+    }
+
+    return frameBytes + dbScanBytes;
+}
+
+/*
+ This function assigns the input points to the zones in a single pass.
+ Each point is transformed to world coordinates, corrected with the zone offsets,
+ and written to the frame arrays of the first zone containing it
+ */
+static void featExtract_assignPoints(FEXTRACT_moduleInstance *inst, const FEXTRACT_measurementPoint *points, uint16_t numPoints)
+{
+    const FEXTRACT_sceneryParams *scene = &inst->cfg.sceneryParams;
+    const float *rotW = inst->rotW;
+    uint8_t numZones = scene->numOccupancyBoxes;
+    uint16_t maxPerFrame = inst->cfg.maxNumPointsPerZonePerFrame;
+    uint16_t i;
+    uint8_t zoneInd, cuboidInd, cuboidOffset;
+    float xs, ys, zs, x, y, z;
+
+    for (zoneInd = 0; zoneInd < numZones; zoneInd++)
+    {
+        inst->frame[zoneInd].numPoints = 0;
+    }
+
+    for (i = 0; i < numPoints; i++)
+    {
+        /* Sensor coordinates */
+        if (inst->cfg.cartesianInput)
+        {
+            xs = points[i].vectorCart.posX;
+            ys = points[i].vectorCart.posY;
+            zs = points[i].vectorCart.posZ;
+        }
+        else
+        {
+            float range = points[i].vectorSph.range;
+            float cosElev = cosf(points[i].vectorSph.elev);
+            xs = range * cosElev * sinf(points[i].vectorSph.azimuth);
+            ys = range * cosElev * cosf(points[i].vectorSph.azimuth);
+            zs = range * sinf(points[i].vectorSph.elev);
+        }
+
+        /* World coordinates */
+        x = rotW[0]*xs + rotW[1]*ys + rotW[2]*zs + scene->sensorPosition.x;
+        y = rotW[3]*xs + rotW[4]*ys + rotW[5]*zs + scene->sensorPosition.y;
+        z = rotW[6]*xs + rotW[7]*ys + rotW[8]*zs + scene->sensorPosition.z;
+
+        /* Zone association: first zone with a cuboid containing the point */
+        cuboidOffset = 0;
+        for (zoneInd = 0; zoneInd < numZones; zoneInd++)
+        {
+            for (cuboidInd = 0; cuboidInd < scene->numCuboidsPerOccupancyBox[zoneInd]; cuboidInd++)
+            {
+                const FEXTRACT_boundaryBox *box = &scene->cuboidDefs[cuboidOffset + cuboidInd];
+                if ((x >= box->x1) && (x <= box->x2) &&
+                    (y >= box->y1) && (y <= box->y2) &&
+                    (z >= box->z1) && (z <= box->z2))
+                {
+                    break;
+                }
+            }
+            if (cuboidInd < scene->numCuboidsPerOccupancyBox[zoneInd])
+            {
+                break;
+            }
+            cuboidOffset += scene->numCuboidsPerOccupancyBox[zoneInd];
+        }
+        if (zoneInd == numZones)
+        {
+            continue;
+        }
+
+        /* Append to the zone frame arrays */
+        {
+            FEXTRACT_framePoints *frame = &inst->frame[zoneInd];
+            uint16_t n = frame->numPoints;
+            if (n >= maxPerFrame)
+            {
+                continue;
+            }
+            if (inst->cfg.offsetCorrection)
+            {
+                x -= inst->xyOffset[zoneInd][0];
+                y -= inst->xyOffset[zoneInd][1];
+            }
+            frame->dim[FEXTRACT_DIM_X][n] = x;
+            frame->dim[FEXTRACT_DIM_Y][n] = y;
+            frame->dim[FEXTRACT_DIM_Z][n] = z + inst->cfg.zOffset[zoneInd];
+            frame->dim[FEXTRACT_DIM_DOPPLER][n] = points[i].doppler;
+            frame->dim[FEXTRACT_DIM_SNR][n] = points[i].snr;
+            frame->numPoints = n + 1U;
+        }
+    }
+}
+
+/*
+ This function removes the DBSCAN noise points from the frame arrays of a zone
+ */
+static void featExtract_filterFrame(FEXTRACT_moduleInstance *inst, FEXTRACT_framePoints *frame)
+{
+    uint16_t i, n = 0;
+    uint8_t d;
+    uint8_t *keep = inst->dbScanKeep;
+
+    featExtract_dbscanRun(frame->dim[FEXTRACT_DIM_X], frame->dim[FEXTRACT_DIM_Y], frame->dim[FEXTRACT_DIM_Z],
+                          frame->numPoints, inst->cfg.dbScanEpsilon, inst->cfg.dbScanMinPts,
+                          &inst->dbScanScratch, keep);
+
+    /* Compact in place, order preserved */
+    for (i = 0; i < frame->numPoints; i++)
+    {
+        if (keep[i])
+        {
+            for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+            {
+                frame->dim[d][n] = frame->dim[d][i];
+            }
+            n++;
+        }
+    }
+    frame->numPoints = n;
+}
+
+/*
+ This function pushes the frame points of a zone into its frame slot: the points are quantized, and their
+ raw moments stored in the slot. The points of the oldest frame are evicted first once numFramesProc frames
+ are buffered. Points exceeding the buffer capacity are dropped
+ */
+static void featExtract_bufferFrame(FEXTRACT_moduleInstance *inst, uint8_t zoneInd)
+{
+    FEXTRACT_zoneBuffer *buf = &inst->zone[zoneInd];
+    FEXTRACT_framePoints *frame = &inst->frame[zoneInd];
+    uint16_t slot = inst->frameSlot;
+    uint16_t cap = inst->bufCapacity;
+    uint16_t numNew, tail, first, i;
+    uint8_t d;
+
+    /* Evict the oldest frame */
+    if (inst->numFramesBuffered == inst->cfg.numFramesProc)
+    {
+        uint16_t numOld = buf->numPointsPerFrame[slot];
+        buf->head = (uint16_t) ((buf->head + numOld) % cap);
+        buf->numPoints -= numOld;
+    }
+
+    numNew = frame->numPoints;
+    if (numNew > (cap - buf->numPoints))
+    {
+        numNew = cap - buf->numPoints;
+    }
+    tail = (uint16_t) ((buf->head + buf->numPoints) % cap);
+    first = ((cap - tail) < numNew) ? (cap - tail) : numNew;
+
+    for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+    {
+        const float *src = frame->dim[d];
+        FEXTRACT_bufSample *q = inst->frameSamples[d];
+        FEXTRACT_dimMoments *m = &buf->slotMoments[slot * FEXTRACT_NUM_DIMS + d];
+
+        /* Quantize */
+#if FEXTRACT_COMPRESS_POINTS
+        float unitInv = inst->unitInv[d];
+        for (i = 0; i < numNew; i++)
+        {
+            float v = src[i] * unitInv;
+            int32_t qv = (int32_t) (v + ((v >= 0.f) ? 0.5f : -0.5f));
+            qv = (qv > FEXTRACT_BUF_SAMPLE_MAX) ? FEXTRACT_BUF_SAMPLE_MAX : qv;
+            qv = (qv < FEXTRACT_BUF_SAMPLE_MIN) ? FEXTRACT_BUF_SAMPLE_MIN : qv;
+            q[i] = (FEXTRACT_bufSample) qv;
+        }
+#else
+        memcpy(q, src, numNew * sizeof(float));
+        (void) i;
+#endif
+
+        /* Moments of the new frame replace the ones of the evicted frame */
+        featExtract_dimMomentsInit(m);
+        featExtract_dimMomentsAccumulate(q, numNew, m);
+
+        /* Append to the ring buffer, in up to two contiguous segments */
+        if (buf->dim[d] != NULL)
+        {
+            memcpy(&buf->dim[d][tail], q, first * sizeof(FEXTRACT_bufSample));
+            memcpy(&buf->dim[d][0], &q[first], (numNew - first) * sizeof(FEXTRACT_bufSample));
+        }
+    }
+
+    buf->numPointsPerFrame[slot] = numNew;
+    buf->numPoints += numNew;
+}
+
+/*
+ This function initializes the raw moments of one dimension
+ */
+static void featExtract_dimMomentsInit(FEXTRACT_dimMoments *m)
+{
+    m->sum = 0;
+    m->sumSq = 0;
+#if FEXTRACT_COMPRESS_POINTS
+    m->min = FEXTRACT_BUF_SAMPLE_MAX;
+    m->max = FEXTRACT_BUF_SAMPLE_MIN;
+#else
+    m->min = FLT_MAX;
+    m->max = -FLT_MAX;
+#endif
+}
+
+/*
+ This function accumulates the raw moments of a contiguous array of samples.
+ The loop body is free of dependencies between iterations other than the reductions, so it vectorizes
+ */
+static void featExtract_dimMomentsAccumulate(const FEXTRACT_bufSample *s, uint16_t numSamples, FEXTRACT_dimMoments *m)
+{
+    FEXTRACT_accum sum = m->sum;
+    FEXTRACT_accum sumSq = m->sumSq;
+    FEXTRACT_bufSample vMin = m->min;
+    FEXTRACT_bufSample vMax = m->max;
+    uint16_t i;
+
+    for (i = 0; i < numSamples; i++)
+    {
+        FEXTRACT_accum v = (FEXTRACT_accum) s[i];
+        sum += v;
+        sumSq += v * v;
+        vMin = (s[i] < vMin) ? s[i] : vMin;
+        vMax = (s[i] > vMax) ? s[i] : vMax;
+    }
+
+    m->sum = sum;
+    m->sumSq = sumSq;
+    m->min = vMin;
+    m->max = vMax;
+}
+
+/*
+ This function adds the raw moments of a set of samples to the raw moments of another set
+ */
+static void featExtract_dimMomentsCombine(const FEXTRACT_dimMoments *src, FEXTRACT_dimMoments *m)
+{
+    m->sum += src->sum;
+    m->sumSq += src->sumSq;
+    m->min = (src->min < m->min) ? src->min : m->min;
+    m->max = (src->max > m->max) ? src->max : m->max;
+}
+
+/*
+ This function runs DBSCAN on all the buffered points of a zone, and copies the points kept,
+ in linear order, to the multi-frame scratch arrays
+ * Return Type  : uint16_t, Number of points kept
+ */
+static uint16_t featExtract_filterBuffer(FEXTRACT_moduleInstance *inst, uint8_t zoneInd)
+{
+    FEXTRACT_zoneBuffer *buf = &inst->zone[zoneInd];
+    uint16_t cap = inst->bufCapacity;
+    uint16_t n = buf->numPoints;
+    uint16_t i, k, numKept = 0;
+    uint8_t d;
+
+    /* Dequantized coordinates in linear order */
+    for (d = 0; d < 3U; d++)
+    {
+        const FEXTRACT_bufSample *src = buf->dim[d];
+        float *dst = inst->mfCoord[d];
+        float unit = inst->unit[d];
+        for (i = 0, k = buf->head; i < n; i++)
+        {
+            dst[i] = (float) src[k] * unit;
+            k = (k + 1U == cap) ? 0 : (k + 1U);
+        }
+    }
+
+    featExtract_dbscanRun(inst->mfCoord[0], inst->mfCoord[1], inst->mfCoord[2], n,
+                          inst->cfg.dbScanEpsilon, inst->cfg.dbScanMinPts, &inst->dbScanScratch, inst->dbScanKeep);
+
+    for (i = 0, k = buf->head; i < n; i++)
+    {
+        if (inst->dbScanKeep[i])
+        {
+            for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+            {
+                inst->mfKept[d][numKept] = buf->dim[d][k];
+            }
+            numKept++;
+        }
+        k = (k + 1U == cap) ? 0 : (k + 1U);
+    }
+
+    return numKept;
+}
+
+/*
+ This function computes the features of one zone over all its buffered points
+ */
+static void featExtract_computeZoneFeatures(FEXTRACT_moduleInstance *inst, uint8_t zoneInd, FEXTRACT_outputPerZone *out)
+{
+    FEXTRACT_zoneBuffer *buf = &inst->zone[zoneInd];
+    uint16_t n;
+    uint16_t slot;
+    float mean[FEXTRACT_NUM_DIMS], rms[FEXTRACT_NUM_DIMS], std[FEXTRACT_NUM_DIMS];
+    float vMax[FEXTRACT_NUM_DIMS], vMin[FEXTRACT_NUM_DIMS];
+    FEXTRACT_dimMoments m[FEXTRACT_NUM_DIMS];
+    uint8_t d;
+
+    for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+    {
+        featExtract_dimMomentsInit(&m[d]);
+    }
+
+    if (inst->keepSamples)
+    {
+        /* Moments of the points kept by multi-frame DBSCAN */
+        n = featExtract_filterBuffer(inst, zoneInd);
+        for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+        {
+            featExtract_dimMomentsAccumulate(inst->mfKept[d], n, &m[d]);
+        }
+    }
+    else
+    {
+        /* Moments of the window, combined from the frame slots */
+        n = buf->numPoints;
+        for (slot = 0; slot < inst->cfg.numFramesProc; slot++)
+        {
+            for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+            {
+                featExtract_dimMomentsCombine(&buf->slotMoments[slot * FEXTRACT_NUM_DIMS + d], &m[d]);
+            }
+        }
+    }
+
+    memset(out, 0, sizeof(FEXTRACT_outputPerZone));
+    out->numPtsMean = (float) n / (float) inst->cfg.numFramesProc;
+    if (n == 0)
+    {
+        return;
+    }
+
+    for (d = 0; d < FEXTRACT_NUM_DIMS; d++)
+    {
+        float nInv = 1.f / (float) n;
+        float unit = inst->unit[d];
+        float meanQ, meanSqQ;
+
+        meanQ = (float) m[d].sum * nInv;
+        meanSqQ = (float) m[d].sumSq * nInv;
+        mean[d] = meanQ * unit;
+        rms[d] = sqrtf(meanSqQ) * unit;
+        std[d] = sqrtf(fmaxf(meanSqQ - meanQ * meanQ, 0.f)) * unit;
+        vMax[d] = (float) m[d].max * unit;
+        vMin[d] = (float) m[d].min * unit;
+    }
+
+    out->xCordMean = mean[FEXTRACT_DIM_X];
+    out->yCordMean = mean[FEXTRACT_DIM_Y];
+    out->zCordMean = mean[FEXTRACT_DIM_Z];
+    out->xCordRms = rms[FEXTRACT_DIM_X];
+    out->yCordRms = rms[FEXTRACT_DIM_Y];
+    out->zCordRms = rms[FEXTRACT_DIM_Z];
+    out->xCordStd = std[FEXTRACT_DIM_X];
+    out->yCordStd = std[FEXTRACT_DIM_Y];
+    out->zCordStd = std[FEXTRACT_DIM_Z];
+    out->xCordMax = vMax[FEXTRACT_DIM_X];
+    out->yCordMax = vMax[FEXTRACT_DIM_Y];
+    out->zCordMax = vMax[FEXTRACT_DIM_Z];
+    out->xCordMin = vMin[FEXTRACT_DIM_X];
+    out->yCordMin = vMin[FEXTRACT_DIM_Y];
+    out->zCordMin = vMin[FEXTRACT_DIM_Z];
+    out->xCordSize = vMax[FEXTRACT_DIM_X] - vMin[FEXTRACT_DIM_X];
+    out->yCordSize = vMax[FEXTRACT_DIM_Y] - vMin[FEXTRACT_DIM_Y];
+    out->zCordSize = vMax[FEXTRACT_DIM_Z] - vMin[FEXTRACT_DIM_Z];
+    out->volume = out->xCordSize * out->yCordSize * out->zCordSize;
+
+    out->doppMean = mean[FEXTRACT_DIM_DOPPLER];
+    out->snrMean = mean[FEXTRACT_DIM_SNR];
+    out->doppRms = rms[FEXTRACT_DIM_DOPPLER];
+    out->snrRms = rms[FEXTRACT_DIM_SNR];
+    out->doppStd = std[FEXTRACT_DIM_DOPPLER];
+    out->snrStd = std[FEXTRACT_DIM_SNR];
+    out->doppMax = vMax[FEXTRACT_DIM_DOPPLER];
+    out->snrMax = vMax[FEXTRACT_DIM_SNR];
+    out->doppMin = vMin[FEXTRACT_DIM_DOPPLER];
+    out->snrMin = vMin[FEXTRACT_DIM_SNR];
+    out->doppSize = vMax[FEXTRACT_DIM_DOPPLER] - vMin[FEXTRACT_DIM_DOPPLER];
+    out->snrSize = vMax[FEXTRACT_DIM_SNR] - vMin[FEXTRACT_DIM_SNR];
+}
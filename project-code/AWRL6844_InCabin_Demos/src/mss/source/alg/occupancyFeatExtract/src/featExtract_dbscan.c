@@ -0,0 +1,395 @@
+/*!
+ *  \file   featExtract_dbscan.c
+ *
+ *  \brief  DBSCAN point filtering for the occupancy feature extraction module
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+#include "featExtract_internal.h"
+#include <math.h>
+
+
+/* Grid cell size relative to epsilon. The margin guarantees that two points within epsilon
+ * are never more than one cell apart, regardless of the rounding of the cell index computation */
+#define FEXTRACT_DBSCAN_CELL_MARGIN     (1.001f)
+
+/* Cell index of a point with a non-finite coordinate, such a point is not binned */
+#define FEXTRACT_DBSCAN_NO_CELL         (0xFFFFU)
+
+/* Number of points from which the grid index is faster than the pairwise test. Below, the grid setup
+ * (cell counters, scan of the empty cells) costs more than it saves: measured crossover 200 to 300 points
+ * on the host with the demo epsilon over a cabin sized box, tools/featExtract_dbscan_host_check.sh */
+#define FEXTRACT_DBSCAN_GRID_MIN_POINTS (256U)
+
+
+/* Function Definitions */
+/*
+ This function filters noisy points with a single stage DBSCAN, brute-force reference implementation.
+ DBSCAN is used as a filter only: a point is kept if it belongs to any cluster, i.e. if it is a core point
+ (at least minPts points, itself included, within epsilon) or if it is within epsilon of a core point.
+ All other points are noise. This decision does not depend on the order the clusters are expanded in.
+ * Arguments    : const float *x, *y, *z, Point coordinates in structure-of-arrays format
+                  uint16_t numPoints, Number of points
+                  float epsilon, Neighborhood radius, m
+                  uint16_t minPts, Minimum number of points in the neighborhood of a core point
+                  uint16_t *numNeighbors, Scratch array of numPoints elements
+                  uint8_t *keep, Output flag per point: (1) clustered point, (0) noise
+ * Return Type  : uint16_t, Number of points kept
+ */
+uint16_t featExtract_dbscanFilter(const float *x, const float *y, const float *z, uint16_t numPoints,
+                                  float epsilon, uint16_t minPts, uint16_t *numNeighbors, uint8_t *keep)
+{
+    uint16_t i, j;
+    uint16_t numKept = 0;
+    float eps2 = epsilon * epsilon;
+    float dx, dy, dz;
+
+    /* Each point is its own neighbor */
+    for (i = 0; i < numPoints; i++)
+    {
+        numNeighbors[i] = 1U;
+    }
+
+    /* Count neighbors, each pair visited once */
+    for (i = 0; i < numPoints; i++)
+    {
+        for (j = i + 1U; j < numPoints; j++)
+        {
+            dx = x[i] - x[j];
+            dy = y[i] - y[j];
+            dz = z[i] - z[j];
+            if ((dx*dx + dy*dy + dz*dz) <= eps2)
+            {
+                numNeighbors[i]++;
+                numNeighbors[j]++;
+            }
+        }
+    }
+
+    /* Core points are kept */
+    for (i = 0; i < numPoints; i++)
+    {
+        keep[i] = (numNeighbors[i] >= minPts) ? 1U : 0U;
+    }
+
+    /* Border points: within epsilon of any core point */
+    for (i = 0; i < numPoints; i++)
+    {
+        if (keep[i])
+        {
+            numKept++;
+            continue;
+        }
+        for (j = 0; j < numPoints; j++)
+        {
+            if (numNeighbors[j] < minPts)
+            {
+                continue;
+            }
+            dx = x[i] - x[j];
+            dy = y[i] - y[j];
+            dz = z[i] - z[j];
+            if ((dx*dx + dy*dy + dz*dz) <= eps2)
+            {
+                keep[i] = 1U;
+                numKept++;
+                break;
+            }
+        }
+    }
+
+    return numKept;
+}
+
+/*
+ This function returns the scratch memory needed by the grid-indexed DBSCAN, in bytes
+ * Arguments    : uint16_t maxNumPoints, Maximum number of points per DBSCAN run
+ * Return Type  : uint32_t, Scratch size in bytes
+ */
+uint32_t featExtract_dbscanScratchBytes(uint16_t maxNumPoints)
+{
+    return 3U * FEXTRACT_ALIGN(maxNumPoints * sizeof(uint16_t)) +
+           FEXTRACT_ALIGN((FEXTRACT_DBSCAN_MAX_GRID_CELLS + 1U) * sizeof(uint16_t));
+}
+
+/*
+ This function assigns the scratch memory of the grid-indexed DBSCAN
+ * Arguments    : uint8_t *mem, Memory of featExtract_dbscanScratchBytes() bytes, aligned to FEXTRACT_MEM_ALIGNMENT
+                  uint16_t maxNumPoints, Maximum number of points per DBSCAN run
+                  FEXTRACT_dbscanScratch *scratch, Scratch descriptor
+ * Return Type  : void
+ */
+void featExtract_dbscanScratchAssign(uint8_t *mem, uint16_t maxNumPoints, FEXTRACT_dbscanScratch *scratch)
+{
+    scratch->numNeighbors = (uint16_t *) mem;
+    mem += FEXTRACT_ALIGN(maxNumPoints * sizeof(uint16_t));
+    scratch->cellInd = (uint16_t *) mem;
+    mem += FEXTRACT_ALIGN(maxNumPoints * sizeof(uint16_t));
+    scratch->sortedInd = (uint16_t *) mem;
+    mem += FEXTRACT_ALIGN(maxNumPoints * sizeof(uint16_t));
+    scratch->cellStart = (uint16_t *) mem;
+}
+
+/*
+ This function filters noisy points with a single stage DBSCAN, using a uniform 3D grid as spatial index.
+ The points are binned with a counting sort into cells of (at least) epsilon size, so the neighbors of
+ a point are searched in the 27 cells around it only. The neighborhood test is the same as in
+ featExtract_dbscanFilter(), so the outputs of both functions are identical.
+ * Arguments    : const float *x, *y, *z, Point coordinates in structure-of-arrays format
+                  uint16_t numPoints, Number of points
+                  float epsilon, Neighborhood radius, m
+                  uint16_t minPts, Minimum number of points in the neighborhood of a core point
+                  FEXTRACT_dbscanScratch *scratch, Scratch memory sized to numPoints
+                  uint8_t *keep, Output flag per point: (1) clustered point, (0) noise
+ * Return Type  : uint16_t, Number of points kept
+ */
+uint16_t featExtract_dbscanFilterGrid(const float *x, const float *y, const float *z, uint16_t numPoints,
+                                      float epsilon, uint16_t minPts, FEXTRACT_dbscanScratch *scratch, uint8_t *keep)
+{
+    uint16_t *numNeighbors = scratch->numNeighbors;
+    uint16_t *cellInd = scratch->cellInd;
+    uint16_t *sortedInd = scratch->sortedInd;
+    uint16_t *cellStart = scratch->cellStart;
+    float eps2 = epsilon * epsilon;
+    float xMin, xMax, yMin, yMax, zMin, zMax;
+    float cellSize, cellInv;
+    float dx, dy, dz;
+    int32_t nx, ny, nz, numCells;
+    int32_t ix, iy, iz, cx, cy, cz;
+    uint16_t i, j, k, m, c, cc;
+    uint16_t numKept = 0;
+    uint16_t numBinned = 0;
+
+    /* Points with a non-finite coordinate are not binned (the float to int conversion of the cell index
+     * would be undefined). They have no neighbor but themselves, as in featExtract_dbscanFilter() */
+    for (i = 0; i < numPoints; i++)
+    {
+        if (isfinite(x[i]) && isfinite(y[i]) && isfinite(z[i]))
+        {
+            if (numBinned == 0)
+            {
+                xMin = xMax = x[i];
+                yMin = yMax = y[i];
+                zMin = zMax = z[i];
+            }
+            cellInd[i] = 0;
+            numBinned++;
+        }
+        else
+        {
+            cellInd[i] = FEXTRACT_DBSCAN_NO_CELL;
+            numNeighbors[i] = 1U;
+        }
+    }
+
+    if (numBinned == 0)
+    {
+        for (i = 0; i < numPoints; i++)
+        {
+            keep[i] = (numNeighbors[i] >= minPts) ? 1U : 0U;
+            numKept += keep[i];
+        }
+        return numKept;
+    }
+
+    /* Bounding box */
+    for (i = 0; i < numPoints; i++)
+    {
+        if (cellInd[i] == FEXTRACT_DBSCAN_NO_CELL)
+        {
+            continue;
+        }
+        xMin = (x[i] < xMin) ? x[i] : xMin;
+        xMax = (x[i] > xMax) ? x[i] : xMax;
+        yMin = (y[i] < yMin) ? y[i] : yMin;
+        yMax = (y[i] > yMax) ? y[i] : yMax;
+        zMin = (z[i] < zMin) ? z[i] : zMin;
+        zMax = (z[i] > zMax) ? z[i] : zMax;
+    }
+
+    /* Grid dimensions, the cell size is doubled until the grid fits */
+    cellSize = epsilon * FEXTRACT_DBSCAN_CELL_MARGIN;
+    while (1)
+    {
+        cellInv = 1.f / cellSize;
+        nx = (int32_t) ((xMax - xMin) * cellInv) + 1;
+        ny = (int32_t) ((yMax - yMin) * cellInv) + 1;
+        nz = (int32_t) ((zMax - zMin) * cellInv) + 1;
+        if (((float) nx * (float) ny * (float) nz) <= (float) FEXTRACT_DBSCAN_MAX_GRID_CELLS)
+        {
+            break;
+        }
+        cellSize *= 2.f;
+    }
+    numCells = nx * ny * nz;
+
+    /* Counting sort of the points into the cells */
+    memset(cellStart, 0, (numCells + 1) * sizeof(uint16_t));
+    for (i = 0; i < numPoints; i++)
+    {
+        if (cellInd[i] == FEXTRACT_DBSCAN_NO_CELL)
+        {
+            continue;
+        }
+        ix = (int32_t) ((x[i] - xMin) * cellInv);
+        iy = (int32_t) ((y[i] - yMin) * cellInv);
+        iz = (int32_t) ((z[i] - zMin) * cellInv);
+        ix = (ix < nx) ? ix : (nx - 1);
+        iy = (iy < ny) ? iy : (ny - 1);
+        iz = (iz < nz) ? iz : (nz - 1);
+        cellInd[i] = (uint16_t) ((iz * ny + iy) * nx + ix);
+        cellStart[cellInd[i]]++;
+    }
+    for (c = 1; c < numCells; c++)
+    {
+        cellStart[c] += cellStart[c - 1];
+    }
+    for (i = numPoints; i > 0; i--)
+    {
+        if (cellInd[i - 1] != FEXTRACT_DBSCAN_NO_CELL)
+        {
+            sortedInd[--cellStart[cellInd[i - 1]]] = i - 1;
+        }
+    }
+    cellStart[numCells] = numBinned;
+
+    /* Count neighbors (each point is its own neighbor), visiting the points cell by cell */
+    for (iz = 0; iz < nz; iz++)
+    for (iy = 0; iy < ny; iy++)
+    for (ix = 0; ix < nx; ix++)
+    {
+        c = (uint16_t) ((iz * ny + iy) * nx + ix);
+        for (k = cellStart[c]; k < cellStart[c + 1]; k++)
+        {
+            uint16_t count = 0;
+            i = sortedInd[k];
+            for (cz = iz - 1; cz <= iz + 1; cz++)
+            for (cy = iy - 1; cy <= iy + 1; cy++)
+            for (cx = ix - 1; cx <= ix + 1; cx++)
+            {
+                if ((cx < 0) || (cx >= nx) || (cy < 0) || (cy >= ny) || (cz < 0) || (cz >= nz))
+                {
+                    continue;
+                }
+                cc = (uint16_t) ((cz * ny + cy) * nx + cx);
+                for (m = cellStart[cc]; m < cellStart[cc + 1]; m++)
+                {
+                    j = sortedInd[m];
+                    dx = x[i] - x[j];
+                    dy = y[i] - y[j];
+                    dz = z[i] - z[j];
+                    if ((dx*dx + dy*dy + dz*dz) <= eps2)
+                    {
+                        count++;
+                    }
+                }
+            }
+            numNeighbors[i] = count;
+        }
+    }
+
+    /* Core points are kept */
+    for (i = 0; i < numPoints; i++)
+    {
+        keep[i] = (numNeighbors[i] >= minPts) ? 1U : 0U;
+    }
+
+    /* Border points: within epsilon of any core point */
+    for (i = 0; i < numPoints; i++)
+    {
+        if (keep[i])
+        {
+            numKept++;
+            continue;
+        }
+        if (cellInd[i] == FEXTRACT_DBSCAN_NO_CELL)
+        {
+            continue;
+        }
+        c = cellInd[i];
+        ix = c % nx;
+        iy = (c / nx) % ny;
+        iz = c / (nx * ny);
+        for (cz = iz - 1; (cz <= iz + 1) && !keep[i]; cz++)
+        for (cy = iy - 1; (cy <= iy + 1) && !keep[i]; cy++)
+        for (cx = ix - 1; (cx <= ix + 1) && !keep[i]; cx++)
+        {
+            if ((cx < 0) || (cx >= nx) || (cy < 0) || (cy >= ny) || (cz < 0) || (cz >= nz))
+            {
+                continue;
+            }
+            cc = (uint16_t) ((cz * ny + cy) * nx + cx);
+            for (m = cellStart[cc]; m < cellStart[cc + 1]; m++)
+            {
+                j = sortedInd[m];
+                if (numNeighbors[j] < minPts)
+                {
+                    continue;
+                }
+                dx = x[i] - x[j];
+                dy = y[i] - y[j];
+                dz = z[i] - z[j];
+                if ((dx*dx + dy*dy + dz*dz) <= eps2)
+                {
+                    keep[i] = 1U;
+                    numKept++;
+                    break;
+                }
+            }
+        }
+    }
+
+    return numKept;
+}
+
+/*
+ This function filters noisy points with a single stage DBSCAN, with the pairwise test for small point clouds
+ and the grid index from FEXTRACT_DBSCAN_GRID_MIN_POINTS points. Both give the same result
+ * Arguments    : const float *x, *y, *z, Point coordinates in structure-of-arrays format
+                  uint16_t numPoints, Number of points
+                  float epsilon, Neighborhood radius, m
+                  uint16_t minPts, Minimum number of points in the neighborhood of a core point
+                  FEXTRACT_dbscanScratch *scratch, Scratch memory sized to numPoints
+                  uint8_t *keep, Output flag per point: (1) clustered point, (0) noise
+ * Return Type  : uint16_t, Number of points kept
+ */
+uint16_t featExtract_dbscanRun(const float *x, const float *y, const float *z, uint16_t numPoints,
+                               float epsilon, uint16_t minPts, FEXTRACT_dbscanScratch *scratch, uint8_t *keep)
+{
+    if (numPoints < FEXTRACT_DBSCAN_GRID_MIN_POINTS)
+    {
+        return featExtract_dbscanFilter(x, y, z, numPoints, epsilon, minPts, scratch->numNeighbors, keep);
+    }
+    return featExtract_dbscanFilterGrid(x, y, z, numPoints, epsilon, minPts, scratch, keep);
+}
@@ -0,0 +1,197 @@
+/*!
+ *  \file   featExtract_internal.h
+ *
+ *  \brief  Internal header file for the open implementation of the occupancy feature extraction module
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Open implementation of the feature extraction module
+ *  The implementation is a drop-in replacement of alg_occupancyFeatExtract library and implements the API defined in featExtract.h
+ *
+ *  Data layout
+ *  Points are kept in structure-of-arrays (SoA) format, one contiguous array per dimension (x, y, z, Doppler, SNR)
+ *  - Per frame, the input point cloud is assigned to the zones in a single pass, and written to the per-zone frame arrays
+ *  - Across frames, each zone owns a ring buffer with one array per dimension. The points of the oldest frame are at the ring head
+ *  - If FEXTRACT_COMPRESS_POINTS is set, the buffered points are quantized to one byte per dimension using the configured compression units
+ */
+
+#ifndef FEATEXTRACT_INTERNAL_H
+#define FEATEXTRACT_INTERNAL_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* The open implementation changes the configuration structure of featExtract.h, so FEXTRACT_OPEN must be
+ * defined for the whole project, not only for these sources */
+#ifndef FEXTRACT_OPEN
+#error "The open feature extraction must be built with FEXTRACT_OPEN defined in the project"
+#endif
+#include <source/alg/occupancyFeatExtract/featExtract.h>
+
+
+/* Point dimensions in the structure-of-arrays layout */
+#define FEXTRACT_DIM_X          (0U)    /* X coordinate, m */
+#define FEXTRACT_DIM_Y          (1U)    /* Y coordinate, m */
+#define FEXTRACT_DIM_Z          (2U)    /* Z coordinate, m */
+#define FEXTRACT_DIM_DOPPLER    (3U)    /* Radial velocity, m/s */
+#define FEXTRACT_DIM_SNR        (4U)    /* SNR, dB */
+#define FEXTRACT_NUM_DIMS       (5U)    /* Number of dimensions per point */
+
+
+/* Buffered sample format */
+#if FEXTRACT_COMPRESS_POINTS
+typedef int8_t FEXTRACT_bufSample;              /* Compressed sample, in units of FEXTRACT_point_cloud_compressed_unit */
+typedef int32_t FEXTRACT_accum;                 /* Accumulator of compressed samples and their squares, exact for up to FEXTRACT_MAX_NUM_POINTS_PER_ZONE samples */
+#define FEXTRACT_BUF_SAMPLE_MIN     (-128)
+#define FEXTRACT_BUF_SAMPLE_MAX     (127)
+#else
+typedef float FEXTRACT_bufSample;               /* Uncompressed sample */
+typedef float FEXTRACT_accum;                   /* Accumulator of uncompressed samples */
+#endif
+
+
+/* Raw moments of a set of buffered samples of one dimension */
+typedef struct
+{
+    FEXTRACT_accum sum;         /* Sum of the samples */
+    FEXTRACT_accum sumSq;       /* Sum of the squared samples */
+    FEXTRACT_bufSample min;     /* Minimum sample */
+    FEXTRACT_bufSample max;     /* Maximum sample */
+} FEXTRACT_dimMoments;
+
+
+/* Memory alignment of the internal arrays, in bytes */
+#define FEXTRACT_MEM_ALIGNMENT      (8U)
+#define FEXTRACT_ALIGN(x)           (((x) + (FEXTRACT_MEM_ALIGNMENT - 1U)) & ~(FEXTRACT_MEM_ALIGNMENT - 1U))
+
+
+/* Cycle counter used for benchmarking. Host builds report the process clock */
+#ifdef SUBSYS_MSS
+#define FEXTRACT_CYCLE_COUNT()      featExtract_getCycleCount()
+#else
+#include <time.h>
+#define FEXTRACT_CYCLE_COUNT()      ((uint32_t) clock())
+#endif
+
+
+/* Maximum number of cells of the DBSCAN grid. The cell size is enlarged beyond epsilon if the point cloud spans more cells */
+#define FEXTRACT_DBSCAN_MAX_GRID_CELLS  (1024U)
+
+
+/* Scratch memory of the grid-indexed DBSCAN */
+typedef struct
+{
+    uint16_t *numNeighbors;     /* Per point neighbor count, sized to the number of points */
+    uint16_t *cellInd;          /* Per point grid cell index, sized to the number of points */
+    uint16_t *sortedInd;        /* Point indices sorted by grid cell, sized to the number of points */
+    uint16_t *cellStart;        /* Start of each cell in sortedInd, sized to FEXTRACT_DBSCAN_MAX_GRID_CELLS + 1 */
+} FEXTRACT_dbscanScratch;
+
+
+/* Points of a single zone in the current frame, structure-of-arrays */
+typedef struct
+{
+    float *dim[FEXTRACT_NUM_DIMS];      /* One array per dimension, each sized to maxNumPointsPerZonePerFrame */
+    uint16_t numPoints;                 /* Number of points assigned to the zone in the current frame */
+} FEXTRACT_framePoints;
+
+
+/* Points of a single zone buffered across frames.
+ * The features are computed from the raw moments of each frame slot, so adding the newest frame and evicting the oldest
+ * one costs the points of the newest frame plus one moments update per frame slot. The samples themselves are only
+ * kept, in a structure-of-arrays ring buffer, when multi-frame DBSCAN needs them */
+typedef struct
+{
+    FEXTRACT_bufSample *dim[FEXTRACT_NUM_DIMS];     /* One array per dimension, each sized to bufCapacity. NULL if the samples are not kept */
+    FEXTRACT_dimMoments *slotMoments;               /* Raw moments per frame slot and dimension, [numFramesProc][FEXTRACT_NUM_DIMS] */
+    uint16_t *numPointsPerFrame;                    /* Number of points buffered per frame slot, sized to numFramesProc */
+    uint16_t head;                                  /* Ring index of the oldest buffered point */
+    uint16_t numPoints;                             /* Total number of points buffered across frames */
+} FEXTRACT_zoneBuffer;
+
+
+/* Algorithm instance */
+typedef struct
+{
+    FEXTRACT_moduleConfig cfg;                  /* Copy of the module configuration */
+
+    float rotW[9];                              /* Rotation from sensor to world coordinates, row-major */
+    float xyOffset[FEXTRACT_MAX_OCCUPANCY_BOXES][2];   /* Per-zone xy offsets (zone center) removed when offset correction is enabled */
+
+    float unit[FEXTRACT_NUM_DIMS];              /* Compression unit per dimension */
+    float unitInv[FEXTRACT_NUM_DIMS];           /* Inverse of the compression unit per dimension */
+
+    uint16_t bufCapacity;                       /* Capacity of the multi-frame ring buffer per zone, in points */
+    uint16_t frameSlot;                         /* Frame slot to be written next. Once all slots are filled, this is also the oldest slot */
+    uint16_t numFramesBuffered;                 /* Number of frames in the buffer, saturates at numFramesProc */
+
+    FEXTRACT_framePoints frame[FEXTRACT_MAX_OCCUPANCY_BOXES];   /* Per-frame points for each zone (scratch) */
+    FEXTRACT_bufSample *frameSamples[FEXTRACT_NUM_DIMS];        /* Quantized points of the zone being buffered (scratch), sized to maxNumPointsPerZonePerFrame */
+    bool keepSamples;                                           /* (true) if the buffered samples are kept, i.e. multi-frame DBSCAN is enabled */
+    FEXTRACT_zoneBuffer zone[FEXTRACT_MAX_OCCUPANCY_BOXES];     /* Multi-frame buffers for each zone */
+
+    uint16_t dbScanMaxPoints;                   /* Maximum number of points per DBSCAN run: maxNumPointsPerZonePerFrame, or bufCapacity in multi-frame mode */
+    uint8_t *dbScanKeep;                        /* DBSCAN scratch: per point flag, sized to dbScanMaxPoints */
+    FEXTRACT_dbscanScratch dbScanScratch;       /* DBSCAN scratch: grid index, sized to dbScanMaxPoints */
+    float *mfCoord[3];                          /* Multi-frame DBSCAN scratch: dequantized x, y, z of the buffered points, sized to bufCapacity */
+    FEXTRACT_bufSample *mfKept[FEXTRACT_NUM_DIMS];  /* Multi-frame DBSCAN scratch: buffered points kept by DBSCAN, sized to bufCapacity */
+
+    uint8_t *memBlock;                          /* Internally allocated memory block */
+    uint32_t memBlockSizeInBytes;               /* Size of the internally allocated memory block */
+    uint8_t *scratchBlock;                      /* Internally allocated scratch block (NULL if provided by the application) */
+    uint32_t scratchBlockSizeInBytes;           /* Size of the internally allocated scratch block */
+
+    uint32_t benchmarks[FEXTRACT_BENCHMARK_SIZE + 1U];  /* Cycle counts of the create/compute functions */
+} FEXTRACT_moduleInstance;
+
+
+/* Internal function declarations */
+extern uint16_t featExtract_dbscanFilter(const float *x, const float *y, const float *z, uint16_t numPoints,
+                                         float epsilon, uint16_t minPts, uint16_t *numNeighbors, uint8_t *keep);
+extern uint16_t featExtract_dbscanFilterGrid(const float *x, const float *y, const float *z, uint16_t numPoints,
+                                             float epsilon, uint16_t minPts, FEXTRACT_dbscanScratch *scratch, uint8_t *keep);
+extern uint16_t featExtract_dbscanRun(const float *x, const float *y, const float *z, uint16_t numPoints,
+                                      float epsilon, uint16_t minPts, FEXTRACT_dbscanScratch *scratch, uint8_t *keep);
+extern uint32_t featExtract_dbscanScratchBytes(uint16_t maxNumPoints);
+extern void featExtract_dbscanScratchAssign(uint8_t *mem, uint16_t maxNumPoints, FEXTRACT_dbscanScratch *scratch);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
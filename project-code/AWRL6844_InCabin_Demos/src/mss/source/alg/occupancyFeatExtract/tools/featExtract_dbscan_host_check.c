@@ -0,0 +1,292 @@
+/*!
+ *  \file   featExtract_dbscan_host_check.c
+ *
+ *  \brief  Host check of the grid-indexed DBSCAN against the pairwise reference
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+/** Host check of featExtract_dbscanFilterGrid()
+ *  Compares the kept flags of the grid-indexed DBSCAN with featExtract_dbscanFilter(), the pairwise test of all
+ *  points, on:
+ *  - random point clouds: blobs over uniform noise in a cabin sized box, a lattice at exactly epsilon spacing, all
+ *    points at one position, points on a line, clouds wide enough to enlarge the grid cells, and clouds with
+ *    non-finite coordinates, for several epsilon and minPts
+ *  - recorded point clouds, if files are given: one "x y z" point per line, a blank line ends a frame
+ *  and prints the run time of both implementations per point cloud size, the crossover sets
+ *  FEXTRACT_DBSCAN_GRID_MIN_POINTS in featExtract_dbscan.c.
+ *  Usage: featExtract_dbscan_host_check [numTrials] [points.txt ...]. See featExtract_dbscan_host_check.sh
+ */
+
+#include "../src/featExtract_internal.h"
+
+
+#define DBSCAN_CHECK_MAX_POINTS     (3200U)
+#define DBSCAN_CHECK_NUM_CONFIGS    (6U)
+
+
+/* (epsilon, minPts) pairs, the demo default is 0.1m and 10 points */
+static const float gDbscanCheckEpsilon[DBSCAN_CHECK_NUM_CONFIGS] = {0.1f, 0.1f, 0.05f, 0.2f, 0.3f, 0.1f};
+static const uint16_t gDbscanCheckMinPts[DBSCAN_CHECK_NUM_CONFIGS] = {10U, 3U, 2U, 5U, 20U, 1U};
+
+static float gX[DBSCAN_CHECK_MAX_POINTS], gY[DBSCAN_CHECK_MAX_POINTS], gZ[DBSCAN_CHECK_MAX_POINTS];
+static uint16_t gNumNeighbors[DBSCAN_CHECK_MAX_POINTS];
+static uint8_t gKeepRef[DBSCAN_CHECK_MAX_POINTS], gKeepGrid[DBSCAN_CHECK_MAX_POINTS];
+static uint8_t *gScratchMem;
+static FEXTRACT_dbscanScratch gScratch;
+static uint32_t gSeed = 12345U;
+
+
+static float dbscan_check_urand(void)
+{
+    gSeed = gSeed * 1664525U + 1013904223U;
+    return (float) (gSeed >> 8) * (1.f / 16777216.f);
+}
+
+/*
+ This function fills gX, gY, gZ with a random point cloud of the given kind
+ * Arguments    : uint16_t kind, Point cloud kind, 0 to 5
+                  uint16_t n, Number of points
+                  float epsilon, DBSCAN epsilon, m
+ * Return Type  : void
+ */
+static void dbscan_check_cloud(uint16_t kind, uint16_t n, float epsilon)
+{
+    const float blobCenter[3][3] = {{0.4f, 0.5f, 0.6f}, {1.0f, 0.3f, 0.8f}, {0.7f, 0.8f, 0.4f}};
+    uint16_t i, side = 1U;
+
+    while ((uint32_t) side * side * side < n)
+    {
+        side++;
+    }
+    for (i = 0; i < n; i++)
+    {
+        float u0 = dbscan_check_urand(), u1 = dbscan_check_urand(), u2 = dbscan_check_urand();
+
+        switch (kind)
+        {
+            case 0:     /* 3/4 of the points in blobs of +/-0.15m, the rest uniform over a 1.4m x 1.1m x 1.2m box */
+                if ((i & 3U) != 3U)
+                {
+                    const float *center = blobCenter[i % 3U];
+                    gX[i] = center[0] + 0.3f * (u0 - 0.5f);
+                    gY[i] = center[1] + 0.3f * (u1 - 0.5f);
+                    gZ[i] = center[2] + 0.3f * (u2 - 0.5f);
+                }
+                else
+                {
+                    gX[i] = 1.4f * u0;
+                    gY[i] = 1.1f * u1;
+                    gZ[i] = 1.2f * u2;
+                }
+                break;
+            case 1:     /* Lattice at exactly epsilon spacing, the neighbor test is decided by the last rounding bit */
+                gX[i] = epsilon * (float) (i % side);
+                gY[i] = epsilon * (float) ((i / side) % side);
+                gZ[i] = epsilon * (float) (i / (side * side));
+                break;
+            case 2:     /* All points at one position, a grid of one cell */
+                gX[i] = 0.5f;
+                gY[i] = -0.25f;
+                gZ[i] = 1.f;
+                break;
+            case 3:     /* Points on a line along y */
+                gX[i] = 0.3f;
+                gY[i] = 2.f * u1;
+                gZ[i] = -0.1f;
+                break;
+            case 4:     /* Outliers up to 100m away, the grid cell size is enlarged to fit FEXTRACT_DBSCAN_MAX_GRID_CELLS */
+                gX[i] = ((i & 7U) == 0U) ? 200.f * (u0 - 0.5f) : u0;
+                gY[i] = ((i & 7U) == 1U) ? 200.f * (u1 - 0.5f) : u1;
+                gZ[i] = u2;
+                break;
+            default:    /* Blobs with NaN and infinite coordinates */
+                gX[i] = blobCenter[i % 3U][0] + 0.3f * (u0 - 0.5f);
+                gY[i] = blobCenter[i % 3U][1] + 0.3f * (u1 - 0.5f);
+                gZ[i] = blobCenter[i % 3U][2] + 0.3f * (u2 - 0.5f);
+                if ((i % 13U) == 0U)
+                {
+                    gY[i] = NAN;
+                }
+                else if ((i % 17U) == 0U)
+                {
+                    gZ[i] = -INFINITY;
+                }
+                break;
+        }
+    }
+}
+
+/*
+ This function runs both implementations on the first n points of gX, gY, gZ for every (epsilon, minPts) pair
+ * Arguments    : uint16_t n, Number of points
+                  int32_t fixedEpsilonConfig, Run only this configuration if >= 0
+                  const char *name, Name printed on a mismatch
+ * Return Type  : int32_t, Number of mismatching runs
+ */
+static int32_t dbscan_check_compare(uint16_t n, int32_t fixedEpsilonConfig, const char *name)
+{
+    uint16_t c, i, numKeptRef, numKeptGrid;
+    int32_t numFailed = 0;
+
+    for (c = 0; c < DBSCAN_CHECK_NUM_CONFIGS; c++)
+    {
+        if ((fixedEpsilonConfig >= 0) && (c != (uint16_t) fixedEpsilonConfig))
+        {
+            continue;
+        }
+        numKeptRef = featExtract_dbscanFilter(gX, gY, gZ, n, gDbscanCheckEpsilon[c], gDbscanCheckMinPts[c], gNumNeighbors, gKeepRef);
+        numKeptGrid = featExtract_dbscanFilterGrid(gX, gY, gZ, n, gDbscanCheckEpsilon[c], gDbscanCheckMinPts[c], &gScratch, gKeepGrid);
+        if ((numKeptRef != numKeptGrid) || (memcmp(gKeepRef, gKeepGrid, n) != 0))
+        {
+            for (i = 0; (i < n) && (gKeepRef[i] == gKeepGrid[i]); i++)
+            {
+            }
+            printf("%s, %u points, epsilon %.2f, minPts %u: %u vs %u kept, first difference at point %u\n", name, n,
+                   gDbscanCheckEpsilon[c], gDbscanCheckMinPts[c], numKeptRef, numKeptGrid, i);
+            numFailed++;
+        }
+    }
+    return numFailed;
+}
+
+/*
+ This function checks the point clouds of a recorded file
+ * Arguments    : const char *fileName, Text file, one "x y z" point per line, a blank line ends a frame
+                  int32_t *numFrames, Incremented by the number of frames read
+ * Return Type  : int32_t, Number of mismatching runs, or 1 if the file cannot be read
+ */
+static int32_t dbscan_check_file(const char *fileName, int32_t *numFrames)
+{
+    FILE *f = fopen(fileName, "r");
+    char line[256];
+    uint16_t n = 0;
+    int32_t numFailed = 0;
+    int32_t eof = 0;
+
+    if (f == NULL)
+    {
+        printf("%s: cannot open\n", fileName);
+        return 1;
+    }
+    while (!eof)
+    {
+        eof = (fgets(line, sizeof(line), f) == NULL);
+        if (!eof && (sscanf(line, "%f %f %f", &gX[n], &gY[n], &gZ[n]) == 3))
+        {
+            n += (n < DBSCAN_CHECK_MAX_POINTS - 1U) ? 1U : 0U;
+        }
+        else if (n > 0U)
+        {
+            numFailed += dbscan_check_compare(n, -1, fileName);
+            (*numFrames)++;
+            n = 0;
+        }
+    }
+    fclose(f);
+    return numFailed;
+}
+
+int main(int argc, char **argv)
+{
+    const uint16_t sizes[] = {1U, 2U, 10U, 25U, 50U, 100U, 150U, 200U, 300U, 400U, 800U, 1600U, 3200U};
+    const uint16_t numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    int32_t numTrials = (argc > 1) ? atoi(argv[1]) : 20;
+    int32_t numFailed = 0, numRuns = 0, numFrames = 0;
+    int32_t t, a, c;
+    uint16_t s, kind;
+    char name[32];
+
+    gScratchMem = (uint8_t *) malloc(featExtract_dbscanScratchBytes(DBSCAN_CHECK_MAX_POINTS));
+    featExtract_dbscanScratchAssign(gScratchMem, DBSCAN_CHECK_MAX_POINTS, &gScratch);
+
+    for (t = 0; t < numTrials; t++)
+    {
+        for (kind = 0; kind < 6U; kind++)
+        {
+            for (s = 0; s < numSizes; s++)
+            {
+                /* Pairwise reference is quadratic, the large clouds run once per kind */
+                if ((sizes[s] > 800U) && (t > 0))
+                {
+                    continue;
+                }
+                for (c = 0; c < (int32_t) DBSCAN_CHECK_NUM_CONFIGS; c++)
+                {
+                    dbscan_check_cloud(kind, sizes[s], gDbscanCheckEpsilon[c]);
+                    snprintf(name, sizeof(name), "cloud kind %u", kind);
+                    numFailed += dbscan_check_compare(sizes[s], c, name);
+                    numRuns++;
+                }
+            }
+        }
+    }
+    printf("random point clouds: %d runs\n", numRuns);
+
+    for (a = 2; a < argc; a++)
+    {
+        numFailed += dbscan_check_file(argv[a], &numFrames);
+    }
+    if (argc > 2)
+    {
+        printf("recorded point clouds: %d frames, %d configurations each\n", numFrames, DBSCAN_CHECK_NUM_CONFIGS);
+    }
+
+    /* Run time of the demo default configuration on the blob clouds */
+    printf("points  pairwise_us  grid_us\n");
+    for (s = 3U; s < numSizes; s++)
+    {
+        clock_t start;
+        double usRef, usGrid;
+        int32_t r, numReps = 2000000 / ((int32_t) sizes[s] * sizes[s]) + 1;
+
+        dbscan_check_cloud(0U, sizes[s], 0.1f);
+        start = clock();
+        for (r = 0; r < numReps; r++)
+        {
+            featExtract_dbscanFilter(gX, gY, gZ, sizes[s], 0.1f, 10U, gNumNeighbors, gKeepRef);
+        }
+        usRef = 1e6 * (double) (clock() - start) / CLOCKS_PER_SEC / numReps;
+        start = clock();
+        for (r = 0; r < numReps; r++)
+        {
+            featExtract_dbscanFilterGrid(gX, gY, gZ, sizes[s], 0.1f, 10U, &gScratch, gKeepGrid);
+        }
+        usGrid = 1e6 * (double) (clock() - start) / CLOCKS_PER_SEC / numReps;
+        printf("%6u  %11.1f  %7.1f\n", sizes[s], usRef, usGrid);
+    }
+
+    free(gScratchMem);
+    printf("%s: %d failed checks\n", (numFailed == 0) ? "PASS" : "FAIL", numFailed);
+    return (numFailed == 0) ? 0 : 1;
+}
@@ -0,0 +1,52 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Check the grid-indexed DBSCAN of the open feature extraction against the pairwise reference on the host
+#
+#   featExtract_dbscan_host_check.sh [numTrials] [points.txt ...]
+#       random point clouds, numTrials (default 20) per kind and size, and the recorded point clouds of the given
+#       files: one "x y z" point per line, a blank line ends a frame
+#
+# Needs a host C compiler (CC, default cc). BUILD_DIR defaults to ./featExtract_dbscan_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+MSS_DIR="$TOOLS_DIR/../../../.."
+BUILD_DIR=${BUILD_DIR:-./featExtract_dbscan_host_check_build}
+CC=${CC:-cc}
+
+mkdir -p "$BUILD_DIR"
+$CC -O2 -Wall -std=gnu99 -DFEXTRACT_OPEN -I "$MSS_DIR" -o "$BUILD_DIR/featExtract_dbscan_host_check" \
+    "$TOOLS_DIR/featExtract_dbscan_host_check.c" "$SRC_DIR/featExtract_dbscan.c" -lm
+"$BUILD_DIR/featExtract_dbscan_host_check" "$@"
@@ -0,0 +1,374 @@
+/*!
+ *  \file   featExtract_dbscan_host_check.c
+ *
+ *  \brief  Host check of the grid-indexed DBSCAN against the pairwise reference
+ *
+ * Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+ *
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+*/
+
+
+/** Host check of the frame slot moments of the open feature extraction
+ *  Runs featExtract_compute() over sequences of frames and writes the features of every frame, so that the output of
+ *  the current sources can be compared with the output of a revision computing the features by a full pass over the
+ *  buffered points. The sequences cover:
+ *  - random configurations: 1 to 4 zones, 1 to 10 frames per window, DBSCAN off, per frame and multi-frame,
+ *    spherical and Cartesian input, with and without offset correction
+ *  - random frames: empty frames, frames filling the per frame limit, and frames overflowing the buffer capacity, so
+ *    that the window drops points
+ *  - recorded point clouds, if files are given: one "x y z doppler snr" point per line, a blank line ends a frame
+ *  Usage: featExtract_window_host_check run <out.bin> [numTrials] [points.txt ...]
+ *         featExtract_window_host_check cmp <ref.bin> <test.bin>
+ *  See featExtract_window_host_check.sh
+ */
+
+#include <source/alg/occupancyFeatExtract/featExtract.h>
+
+
+#define WINDOW_CHECK_MAX_POINTS     (4000U)
+#define WINDOW_CHECK_NUM_FRAMES     (60U)
+#define WINDOW_CHECK_FILE_FRAMES    (4096U)
+
+
+static FEXTRACT_measurementPoint gPoints[WINDOW_CHECK_MAX_POINTS];
+static uint32_t gSeed = 12345U;
+
+
+void *featExtract_malloc(uint32_t sizeInBytes)
+{
+    return malloc(sizeInBytes);
+}
+
+void featExtract_free(void *pFree, uint32_t sizeInBytes)
+{
+    (void) sizeInBytes;
+    free(pFree);
+}
+
+static float window_check_urand(void)
+{
+    gSeed = gSeed * 1664525U + 1013904223U;
+    return (float) (gSeed >> 8) * (1.f / 16777216.f);
+}
+
+static uint32_t window_check_irand(uint32_t n)
+{
+    return (uint32_t) (window_check_urand() * (float) n) % n;
+}
+
+/*
+ This function fills a random configuration, two cuboids per zone along x in a cabin sized scene
+ * Arguments    : FEXTRACT_moduleConfig *cfg, Configuration to fill
+                  bool cartesian, Cartesian input
+ * Return Type  : void
+ */
+static void window_check_config(FEXTRACT_moduleConfig *cfg, bool cartesian)
+{
+    const uint16_t numFrames[] = {1U, 2U, 3U, 5U, 10U};
+    uint8_t z;
+
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->maxNumPointsPerZonePerFrame = (uint16_t) (50U + window_check_irand(FEXTRACT_MAX_NUM_POINTS_PER_ZONE_PER_FRAME - 49U));
+    cfg->numFramesProc = numFrames[window_check_irand(5U)];
+    cfg->sceneryParams.sensorPosition.z = 1.f;
+    cfg->sceneryParams.sensorOrientation.xTilt = 0.3f * window_check_urand();
+    cfg->sceneryParams.numOccupancyBoxes = (uint8_t) (1U + window_check_irand(4U));
+    for (z = 0; z < cfg->sceneryParams.numOccupancyBoxes; z++)
+    {
+        FEXTRACT_boundaryBox *box = &cfg->sceneryParams.cuboidDefs[2U * z];
+
+        cfg->sceneryParams.numCuboidsPerOccupancyBox[z] = 2U;
+        box[0].x1 = -1.2f + 0.6f * (float) z;
+        box[0].x2 = box[0].x1 + 0.6f;
+        box[0].y1 = 0.2f;
+        box[0].y2 = 1.2f;
+        box[0].z1 = -0.2f;
+        box[0].z2 = 0.6f;
+        box[1] = box[0];
+        box[1].y1 = 1.2f;
+        box[1].y2 = 2.2f;
+        cfg->zOffset[z] = 0.1f * (float) z;
+    }
+    cfg->cartesianInput = cartesian;
+    cfg->offsetCorrection = (window_check_irand(2U) != 0U);
+    cfg->dbScanFiltering = (window_check_irand(3U) != 0U);
+    cfg->dbScanMultiFrame = (window_check_irand(2U) != 0U);
+    cfg->dbScanEpsilon = 0.1f + 0.1f * window_check_urand();
+    cfg->dbScanMinPts = (uint16_t) (2U + window_check_irand(10U));
+    /* Demo units of dpc_mss.c, and a Doppler unit for a 128 chirp frame */
+    cfg->pointCloudCompressionUnit.xUnit = 3.0f / 128.0f;
+    cfg->pointCloudCompressionUnit.yUnit = 3.0f / 128.0f;
+    cfg->pointCloudCompressionUnit.zUnit = 3.0f / 128.0f;
+    cfg->pointCloudCompressionUnit.dopplerUnit = 0.04f * 64.f / 128.0f;
+    cfg->pointCloudCompressionUnit.snrdBUnit = .5f;
+}
+
+/*
+ This function fills gPoints with a random frame: blobs in the zones over points spread across the scene
+ * Arguments    : uint16_t n, Number of points
+                  bool cartesian, Cartesian input
+ * Return Type  : void
+ */
+static void window_check_frame(uint16_t n, bool cartesian)
+{
+    uint16_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        float x, y, zc;
+        FEXTRACT_measurementPoint *p = &gPoints[i];
+
+        if ((i & 3U) != 3U)
+        {
+            x = -0.9f + 0.6f * (float) (i % 4U) + 0.3f * (window_check_urand() - 0.5f);
+            y = 0.8f + 0.3f * (window_check_urand() - 0.5f);
+            zc = 0.2f + 0.3f * (window_check_urand() - 0.5f);
+        }
+        else
+        {
+            x = -1.4f + 2.8f * window_check_urand();
+            y = 2.5f * window_check_urand();
+            zc = -0.4f + 1.2f * window_check_urand();
+        }
+        if (cartesian)
+        {
+            p->vectorCart.posX = x;
+            p->vectorCart.posY = y;
+            p->vectorCart.posZ = zc - 1.f;
+        }
+        else
+        {
+            p->vectorSph.range = sqrtf(x * x + y * y + (zc - 1.f) * (zc - 1.f));
+            p->vectorSph.azimuth = atan2f(x, y);
+            p->vectorSph.elev = asinf((zc - 1.f) / p->vectorSph.range);
+        }
+        /* Doppler and SNR beyond the int8 range of the compression units saturate */
+        p->doppler = 3.f * (window_check_urand() - 0.5f);
+        p->snr = 10.f + 60.f * window_check_urand();
+    }
+}
+
+/*
+ This function runs a frame and writes its features
+ * Arguments    : void *handle, Feature extraction instance
+                  uint16_t n, Number of points in gPoints
+                  uint8_t numZones, Number of zones
+                  FILE *out, Output file
+ * Return Type  : void
+ */
+static void window_check_step(void *handle, uint16_t n, uint8_t numZones, FILE *out)
+{
+    FEXTRACT_output featOut;
+    uint8_t computed;
+
+    memset(&featOut, 0, sizeof(featOut));
+    featExtract_compute(handle, gPoints, n, &featOut);
+    computed = featOut.featuresComputed ? 1U : 0U;
+    fwrite(&computed, 1, 1, out);
+    fwrite(featOut.featsPerZone, sizeof(FEXTRACT_outputPerZone), numZones, out);
+}
+
+/*
+ This function runs the recorded frames of a file through every configuration
+ * Arguments    : const char *fileName, Text file, one "x y z doppler snr" point per line, a blank line ends a frame
+                  FILE *out, Output file
+ * Return Type  : int32_t, Number of frames, or -1 if the file cannot be read
+ */
+static int32_t window_check_file(const char *fileName, FILE *out)
+{
+    static FEXTRACT_measurementPoint frames[WINDOW_CHECK_MAX_POINTS * 4U];
+    static uint16_t frameSize[WINDOW_CHECK_FILE_FRAMES];
+    FILE *f = fopen(fileName, "r");
+    char line[256];
+    uint32_t numFrames = 0, frameStart = 0, n = 0, t, i, start;
+    int32_t eof = 0;
+
+    if (f == NULL)
+    {
+        printf("%s: cannot open\n", fileName);
+        return -1;
+    }
+    while (!eof && (numFrames < WINDOW_CHECK_FILE_FRAMES))
+    {
+        FEXTRACT_measurementPoint *p = &frames[frameStart + n];
+
+        eof = (fgets(line, sizeof(line), f) == NULL);
+        if (!eof && (frameStart + n < WINDOW_CHECK_MAX_POINTS * 4U) && (n < WINDOW_CHECK_MAX_POINTS) &&
+            (sscanf(line, "%f %f %f %f %f", &p->a[0], &p->a[1], &p->a[2], &p->a[3], &p->a[4]) == 5))
+        {
+            n++;
+        }
+        else if (n > 0U)
+        {
+            frameSize[numFrames++] = (uint16_t) n;
+            frameStart += n;
+            n = 0;
+        }
+    }
+    fclose(f);
+
+    for (t = 0; t < 20U; t++)
+    {
+        FEXTRACT_moduleConfig cfg;
+        int32_t errCode;
+        void *handle;
+
+        window_check_config(&cfg, true);
+        handle = featExtract_create(&cfg, &errCode);
+        if (handle == NULL)
+        {
+            printf("%s: create failed, error %d\n", fileName, errCode);
+            return -1;
+        }
+        for (i = 0, start = 0; i < numFrames; start += frameSize[i], i++)
+        {
+            memcpy(gPoints, &frames[start], frameSize[i] * sizeof(FEXTRACT_measurementPoint));
+            window_check_step(handle, frameSize[i], cfg.sceneryParams.numOccupancyBoxes, out);
+        }
+        featExtract_delete(handle);
+    }
+    return (int32_t) numFrames;
+}
+
+static int32_t window_check_run(const char *outName, int32_t numTrials, int32_t numFiles, char **files)
+{
+    FILE *out = fopen(outName, "wb");
+    int32_t t, a, numFrames = 0, numFileFrames = 0;
+    uint16_t f;
+
+    if (out == NULL)
+    {
+        printf("%s: cannot open\n", outName);
+        return 1;
+    }
+    for (t = 0; t < numTrials; t++)
+    {
+        FEXTRACT_moduleConfig cfg;
+        int32_t errCode;
+        bool cartesian = ((t & 1) != 0);
+        void *handle;
+
+        window_check_config(&cfg, cartesian);
+        handle = featExtract_create(&cfg, &errCode);
+        if (handle == NULL)
+        {
+            printf("trial %d: create failed, error %d\n", t, errCode);
+            fclose(out);
+            return 1;
+        }
+        for (f = 0; f < WINDOW_CHECK_NUM_FRAMES; f++)
+        {
+            uint32_t kind = window_check_irand(8U);
+            uint16_t n = (kind == 0U) ? 0U :
+                         (kind == 1U) ? (uint16_t) WINDOW_CHECK_MAX_POINTS :
+                         (uint16_t) window_check_irand(400U);
+
+            window_check_frame(n, cartesian);
+            window_check_step(handle, n, cfg.sceneryParams.numOccupancyBoxes, out);
+            numFrames++;
+        }
+        featExtract_delete(handle);
+    }
+    printf("random sequences: %d configurations, %d frames\n", numTrials, numFrames);
+
+    for (a = 0; a < numFiles; a++)
+    {
+        int32_t n = window_check_file(files[a], out);
+
+        if (n < 0)
+        {
+            fclose(out);
+            return 1;
+        }
+        numFileFrames += n;
+    }
+    if (numFiles > 0)
+    {
+        printf("recorded point clouds: %d frames, 20 configurations each\n", numFileFrames);
+    }
+    fclose(out);
+    return 0;
+}
+
+/*
+ This function compares two outputs of window_check_run(), bit for bit
+ * Return Type  : int32_t, Number of differing bytes, or 1 if the files cannot be read
+ */
+static int32_t window_check_cmp(const char *refName, const char *testName)
+{
+    FILE *ref = fopen(refName, "rb");
+    FILE *test = fopen(testName, "rb");
+    int32_t numFailed = 0, r, s;
+    uint32_t numBytes = 0;
+
+    if ((ref == NULL) || (test == NULL))
+    {
+        printf("cannot open %s or %s\n", refName, testName);
+        return 1;
+    }
+    do
+    {
+        r = fgetc(ref);
+        s = fgetc(test);
+        if (r != s)
+        {
+            if (numFailed == 0)
+            {
+                printf("first difference at byte %u\n", numBytes);
+            }
+            numFailed++;
+        }
+        numBytes++;
+    } while ((r != EOF) && (s != EOF));
+    fclose(ref);
+    fclose(test);
+    printf("%u bytes of features compared\n", numBytes - 1U);
+    return numFailed;
+}
+
+int main(int argc, char **argv)
+{
+    int32_t numFailed;
+
+    if ((argc >= 3) && (strcmp(argv[1], "run") == 0))
+    {
+        return window_check_run(argv[2], (argc > 3) ? atoi(argv[3]) : 200, (argc > 4) ? argc - 4 : 0, &argv[4]);
+    }
+    if ((argc == 4) && (strcmp(argv[1], "cmp") == 0))
+    {
+        numFailed = window_check_cmp(argv[2], argv[3]);
+        printf("%s: %d failed checks\n", (numFailed == 0) ? "PASS" : "FAIL", numFailed);
+        return (numFailed == 0) ? 0 : 1;
+    }
+    printf("Usage: %s run <out.bin> [numTrials] [points.txt ...] | cmp <ref.bin> <test.bin>\n", argv[0]);
+    return 1;
+}
@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Check the features computed from the frame slot moments of the open feature extraction against a revision that
+# computes them by a full pass over the buffered points
+#
+#   featExtract_window_host_check.sh [oldRevision] [numTrials] [points.txt ...]
+#       oldRevision defaults to the parent of the commit that added the frame slot moments. Both revisions run the same
+#       random frame sequences, numTrials (default 200) configurations of 60 frames, and the recorded point clouds of
+#       the given files: one "x y z doppler snr" point per line, a blank line ends a frame. The features must be equal
+#       bit for bit
+#
+# Needs git and a host C compiler (CC, default cc). BUILD_DIR defaults to ./featExtract_window_host_check_build
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/../src"
+MSS_DIR=$(cd "$TOOLS_DIR/../../../.." && pwd)
+BUILD_DIR=${BUILD_DIR:-./featExtract_window_host_check_build}
+CC=${CC:-cc}
+
+OLD_REV=$1
+if [ -z "$OLD_REV" ]; then
+    OLD_REV=$(git -C "$SRC_DIR" log -1 --format=%H -S slotMoments -- featExtract_internal.h)^
+fi
+[ $# -gt 0 ] && shift
+NUM_TRIALS=${1:-200}
+[ $# -gt 0 ] && shift
+
+rm -rf "$BUILD_DIR/old"
+mkdir -p "$BUILD_DIR/old"
+git -C "$MSS_DIR" archive "$OLD_REV" source/alg/occupancyFeatExtract | tar -x -C "$BUILD_DIR/old"
+
+for tree in old new; do
+    if [ $tree = old ]; then INC="$BUILD_DIR/old"; else INC="$MSS_DIR"; fi
+    $CC -O2 -Wall -std=gnu99 -DFEXTRACT_OPEN -ffp-contract=off -I "$INC" -o "$BUILD_DIR/featExtract_window_$tree" \
+        "$TOOLS_DIR/featExtract_window_host_check.c" "$INC"/source/alg/occupancyFeatExtract/src/*.c -lm
+    "$BUILD_DIR/featExtract_window_$tree" run "$BUILD_DIR/$tree.bin" "$NUM_TRIALS" "$@"
+done
+"$BUILD_DIR/featExtract_window_new" cmp "$BUILD_DIR/old.bin" "$BUILD_DIR/new.bin"
@@ -0,0 +1,364 @@
+/**
+ *   @file  dpc_graph.c
+ *
+ *   @brief
+ *      Data driven scheduler of the DPC processing chain.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <string.h>
+
+#include <source/dpc/dpc_graph.h>
+
+/* Node identifier to node mask */
+#define DPC_GRAPH_NODE_BIT(id)  ((uint32_t)1U << (id))
+
+/**************************************************************************
+ ************************ Internal Functions ******************************
+ **************************************************************************/
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the time the last input of the node has been written.
+ */
+static uint32_t DPC_Graph_inputReadyTime(DPC_Graph_Obj *graph, uint32_t nodeId)
+{
+    uint32_t bufMask = graph->node[nodeId].inBufMask;
+    uint32_t readyTime = graph->frameStartTime;
+    uint32_t bufId;
+
+    for (bufId = 0; bufMask != 0U; bufId++, bufMask >>= 1)
+    {
+        if (((bufMask & 1U) != 0U) &&
+            ((int32_t)(graph->bufReadyTime[bufId] - readyTime) > 0))
+        {
+            readyTime = graph->bufReadyTime[bufId];
+        }
+    }
+    return readyTime;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Marks the node completed and its outputs written at the given time.
+ */
+static void DPC_Graph_complete(DPC_Graph_Obj *graph, uint32_t nodeId, uint32_t endTime)
+{
+    uint32_t bufMask = graph->node[nodeId].outBufMask;
+    uint32_t bufId;
+
+    for (bufId = 0; bufMask != 0U; bufId++, bufMask >>= 1)
+    {
+        if ((bufMask & 1U) != 0U)
+        {
+            graph->bufReadyTime[bufId] = endTime;
+        }
+    }
+    graph->validBufMask |= graph->node[nodeId].outBufMask;
+    graph->doneNodeMask |= DPC_GRAPH_NODE_BIT(nodeId);
+    graph->stamp[nodeId].endTime = endTime;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns true if the node has not been started in this frame and all its inputs are written.
+ */
+static bool DPC_Graph_isReady(DPC_Graph_Obj *graph, uint32_t nodeId)
+{
+    return (((graph->startedNodeMask & DPC_GRAPH_NODE_BIT(nodeId)) == 0U) &&
+            ((graph->node[nodeId].inBufMask & ~graph->validBufMask) == 0U));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Calls the node function and records the ready and start time stamps.
+ */
+static int32_t DPC_Graph_fire(DPC_Graph_Obj *graph, uint32_t nodeId)
+{
+    DPC_Graph_NodeCfg *node = &graph->node[nodeId];
+
+    graph->startedNodeMask |= DPC_GRAPH_NODE_BIT(nodeId);
+    graph->stamp[nodeId].readyTime = DPC_Graph_inputReadyTime(graph, nodeId);
+
+    if (node->type != DPC_GRAPH_NODE_SYNC)
+    {
+        if (graph->doneSeq[nodeId] != graph->runSeq[nodeId])
+        {
+            /* Previous run of a detached node has not completed, drop it: its completion will not match the new tag */
+            graph->overrunCount[nodeId]++;
+        }
+        /* A node runs at most once per frame, the frame number tags the run. 0 is the initial, idle, tag */
+        graph->runSeq[nodeId] = graph->frameCount + 1U;
+    }
+
+    graph->stamp[nodeId].startTime = graph->platformCfg.getTime();
+    return node->fxn(node->arg);
+}
+
+/**************************************************************************
+ ************************ External Functions ******************************
+ **************************************************************************/
+
+int32_t DPC_Graph_init(DPC_Graph_Obj *graph, const DPC_Graph_PlatformCfg *platformCfg)
+{
+    if ((graph == NULL) || (platformCfg == NULL) || (platformCfg->getTime == NULL) ||
+        (platformCfg->waitEvent == NULL))
+    {
+        return DPC_GRAPH_EINVAL;
+    }
+
+    memset((void *)graph, 0, sizeof(DPC_Graph_Obj));
+    graph->platformCfg = *platformCfg;
+    graph->failedNodeId = DPC_GRAPH_MAX_NUM_NODES;
+    return 0;
+}
+
+int32_t DPC_Graph_addNode(DPC_Graph_Obj *graph, const DPC_Graph_NodeCfg *nodeCfg)
+{
+    if ((graph == NULL) || (nodeCfg == NULL) || (nodeCfg->fxn == NULL) ||
+        (nodeCfg->type > DPC_GRAPH_NODE_DETACHED))
+    {
+        return DPC_GRAPH_EINVAL;
+    }
+    if (graph->numNodes >= DPC_GRAPH_MAX_NUM_NODES)
+    {
+        return DPC_GRAPH_ENOMEM;
+    }
+
+    graph->node[graph->numNodes] = *nodeCfg;
+    graph->isValid = false;
+    return (int32_t) graph->numNodes++;
+}
+
+int32_t DPC_Graph_validate(DPC_Graph_Obj *graph)
+{
+    uint32_t producedMask = 0;
+    uint32_t detachedMask = 0;
+    uint32_t validMask;
+    uint32_t doneMask;
+    uint32_t allNodesMask;
+    uint32_t nodeId;
+    bool progress;
+
+    if (graph == NULL)
+    {
+        return DPC_GRAPH_EINVAL;
+    }
+    graph->isValid = false;
+
+    for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+    {
+        if ((graph->node[nodeId].outBufMask & producedMask) != 0U)
+        {
+            return DPC_GRAPH_EMULTIPRODUCER;
+        }
+        producedMask |= graph->node[nodeId].outBufMask;
+        if (graph->node[nodeId].type == DPC_GRAPH_NODE_DETACHED)
+        {
+            detachedMask |= graph->node[nodeId].outBufMask;
+        }
+    }
+
+    for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+    {
+        if ((graph->node[nodeId].inBufMask & ~producedMask) != 0U)
+        {
+            return DPC_GRAPH_ENOPRODUCER;
+        }
+        if ((graph->node[nodeId].inBufMask & detachedMask) != 0U)
+        {
+            return DPC_GRAPH_EDETACHED;
+        }
+    }
+
+    /* Dry run, every node must become ready */
+    allNodesMask = DPC_GRAPH_NODE_BIT(graph->numNodes) - 1U;
+    validMask = 0;
+    doneMask = 0;
+    do
+    {
+        progress = false;
+        for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+        {
+            if (((doneMask & DPC_GRAPH_NODE_BIT(nodeId)) == 0U) &&
+                ((graph->node[nodeId].inBufMask & ~validMask) == 0U))
+            {
+                doneMask |= DPC_GRAPH_NODE_BIT(nodeId);
+                validMask |= graph->node[nodeId].outBufMask;
+                progress = true;
+            }
+        }
+    } while (progress);
+
+    if (doneMask != allNodesMask)
+    {
+        return DPC_GRAPH_ECYCLE;
+    }
+
+    graph->frameNodeMask = 0;
+    for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+    {
+        if (graph->node[nodeId].type != DPC_GRAPH_NODE_DETACHED)
+        {
+            graph->frameNodeMask |= DPC_GRAPH_NODE_BIT(nodeId);
+        }
+    }
+    graph->isValid = true;
+    return 0;
+}
+
+int32_t DPC_Graph_run(DPC_Graph_Obj *graph)
+{
+    int32_t retVal = 0;
+    uint32_t nodeId;
+    uint32_t pendingMask;
+    bool progress;
+
+    if ((graph == NULL) || (!graph->isValid))
+    {
+        return DPC_GRAPH_ENOTVALID;
+    }
+
+    graph->validBufMask = 0;
+    graph->startedNodeMask = 0;
+    graph->doneNodeMask = 0;
+    graph->failedNodeId = DPC_GRAPH_MAX_NUM_NODES;
+    graph->frameStartTime = graph->platformCfg.getTime();
+
+    while ((graph->doneNodeMask & graph->frameNodeMask) != graph->frameNodeMask)
+    {
+        progress = false;
+
+        /* Collect completed asynchronous nodes */
+        pendingMask = graph->startedNodeMask & ~graph->doneNodeMask;
+        for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+        {
+            if (((pendingMask & DPC_GRAPH_NODE_BIT(nodeId)) != 0U) &&
+                (graph->node[nodeId].type != DPC_GRAPH_NODE_SYNC) &&
+                (graph->doneSeq[nodeId] == graph->runSeq[nodeId]))
+            {
+                DPC_Graph_complete(graph, nodeId, graph->doneTime[nodeId]);
+                progress = true;
+            }
+        }
+
+        /* Start the ready asynchronous nodes, so that their work overlaps the synchronous nodes */
+        for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+        {
+            if ((graph->node[nodeId].type != DPC_GRAPH_NODE_SYNC) && DPC_Graph_isReady(graph, nodeId))
+            {
+                retVal = DPC_Graph_fire(graph, nodeId);
+                if (retVal < 0)
+                {
+                    graph->failedNodeId = (uint8_t) nodeId;
+                    goto exit;
+                }
+                progress = true;
+            }
+        }
+
+        /* Run the first ready synchronous node */
+        for (nodeId = 0; nodeId < graph->numNodes; nodeId++)
+        {
+            if ((graph->node[nodeId].type == DPC_GRAPH_NODE_SYNC) && DPC_Graph_isReady(graph, nodeId))
+            {
+                retVal = DPC_Graph_fire(graph, nodeId);
+                if (retVal < 0)
+                {
+                    graph->failedNodeId = (uint8_t) nodeId;
+                    goto exit;
+                }
+                DPC_Graph_complete(graph, nodeId, graph->platformCfg.getTime());
+                progress = true;
+                break;
+            }
+        }
+
+        if (!progress)
+        {
+            /* Only asynchronous nodes in flight */
+            graph->platformCfg.waitEvent(graph->platformCfg.eventArg);
+        }
+    }
+
+exit:
+    graph->frameEndTime = graph->platformCfg.getTime();
+    graph->frameCount++;
+    return retVal;
+}
+
+uint32_t DPC_Graph_nodeSeq(const DPC_Graph_Obj *graph, uint32_t nodeId)
+{
+    if (nodeId >= graph->numNodes)
+    {
+        return 0;
+    }
+    return graph->runSeq[nodeId];
+}
+
+void DPC_Graph_nodeDone(DPC_Graph_Obj *graph, uint32_t nodeId, uint32_t seq)
+{
+    if (nodeId >= graph->numNodes)
+    {
+        return;
+    }
+    if (seq != graph->runSeq[nodeId])
+    {
+        graph->lateCount[nodeId]++;
+        return;
+    }
+
+    /* Time first: the scheduler reads doneSeq, then doneTime */
+    graph->doneTime[nodeId] = graph->platformCfg.getTime();
+    graph->doneSeq[nodeId] = seq;
+    if (graph->node[nodeId].type == DPC_GRAPH_NODE_DETACHED)
+    {
+        /* The frame may have ended, record the completion time here */
+        graph->stamp[nodeId].endTime = graph->doneTime[nodeId];
+    }
+    if (graph->platformCfg.postEvent != NULL)
+    {
+        graph->platformCfg.postEvent(graph->platformCfg.eventArg);
+    }
+}
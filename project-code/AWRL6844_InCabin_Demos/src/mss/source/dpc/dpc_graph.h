@@ -0,0 +1,320 @@
+/**
+ *   @file  dpc_graph.h
+ *
+ *   @brief
+ *      Data driven scheduler of the DPC processing chain.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  The frame processing is described as a graph. Every node is a processing step (a DPU, an algorithm, a
+ *  hand-off to the DSP or to another task) that declares the buffers it reads and the buffers it writes,
+ *  as bit masks of buffer identifiers owned by the caller. A node becomes ready when all its input buffers
+ *  have been written in the current frame, and DPC_Graph_run() fires ready nodes until the frame is done.
+ *
+ *  Node types
+ *  - DPC_GRAPH_NODE_SYNC: the node function runs to completion in the calling task. Its outputs are valid
+ *    when the function returns.
+ *  - DPC_GRAPH_NODE_ASYNC: the node function only starts the work (IPC message to the DSP, post to another
+ *    task). The outputs are valid when the owner of the work calls DPC_Graph_nodeDone(). The frame waits
+ *    for the node.
+ *  - DPC_GRAPH_NODE_DETACHED: as DPC_GRAPH_NODE_ASYNC, but the frame does not wait for the node. Its outputs
+ *    are consumed outside of the graph and can not be inputs of other nodes.
+ *
+ *  Ready asynchronous nodes are started before any ready synchronous node, so the work they hand off runs
+ *  concurrently with the synchronous nodes. Among synchronous nodes the one added first runs first.
+ *
+ *  Every node records the time its inputs became ready, the time it was started and the time its outputs
+ *  became valid, and every buffer records the time it was written, which timestamps all the edges of the
+ *  graph for the frame.
+ *
+ *  The module has no dependency on the SDK drivers or the RTOS: time and blocking are provided by the
+ *  caller through DPC_Graph_PlatformCfg, so the same schedules can be built on the host with mock nodes
+ *  (tools/dpc_graph_host_check.sh).
+ */
+
+#ifndef DPC_GRAPH_H
+#define DPC_GRAPH_H
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Invalid argument */
+#define DPC_GRAPH_EINVAL                    (-1)
+
+/*! @brief Maximum number of nodes exceeded */
+#define DPC_GRAPH_ENOMEM                    (-2)
+
+/*! @brief A node input is not written by any node */
+#define DPC_GRAPH_ENOPRODUCER               (-3)
+
+/*! @brief A buffer is written by more than one node */
+#define DPC_GRAPH_EMULTIPRODUCER            (-4)
+
+/*! @brief The graph has a cycle */
+#define DPC_GRAPH_ECYCLE                    (-5)
+
+/*! @brief Output of a detached node is used as input of another node */
+#define DPC_GRAPH_EDETACHED                 (-6)
+
+/*! @brief Graph is run before it has been validated */
+#define DPC_GRAPH_ENOTVALID                 (-7)
+
+/*! @brief Maximum number of nodes in a graph */
+#define DPC_GRAPH_MAX_NUM_NODES             (16U)
+
+/*! @brief Maximum number of buffers, one bit per buffer in the node masks */
+#define DPC_GRAPH_MAX_NUM_BUFFERS           (32U)
+
+/*! @brief Buffer identifier to buffer mask */
+#define DPC_GRAPH_BUF(id)                   ((uint32_t)1U << (id))
+
+/*! @brief Node types */
+#define DPC_GRAPH_NODE_SYNC                 (0U)
+#define DPC_GRAPH_NODE_ASYNC                (1U)
+#define DPC_GRAPH_NODE_DETACHED             (2U)
+
+/**
+ * @brief  Node function. Returns 0 on success, a negative error code aborts the frame
+ */
+typedef int32_t (*DPC_Graph_NodeFxn)(void *arg);
+
+/**
+ * @brief  Platform services used by the scheduler
+ */
+typedef struct DPC_Graph_PlatformCfg_t
+{
+    /*! @brief Free running time stamp */
+    uint32_t (*getTime)(void);
+
+    /*! @brief Blocks the scheduler until the next DPC_Graph_nodeDone() */
+    void (*waitEvent)(void *arg);
+
+    /*! @brief Wakes up the scheduler, called by DPC_Graph_nodeDone(), possibly from interrupt context */
+    void (*postEvent)(void *arg);
+
+    /*! @brief Argument of waitEvent and postEvent */
+    void *eventArg;
+} DPC_Graph_PlatformCfg;
+
+/**
+ * @brief  Node configuration
+ */
+typedef struct DPC_Graph_NodeCfg_t
+{
+    /*! @brief Node name, for debug */
+    const char *name;
+
+    /*! @brief Node function */
+    DPC_Graph_NodeFxn fxn;
+
+    /*! @brief Argument of the node function */
+    void *arg;
+
+    /*! @brief Mask of the buffers read by the node */
+    uint32_t inBufMask;
+
+    /*! @brief Mask of the buffers written by the node */
+    uint32_t outBufMask;
+
+    /*! @brief Node type, DPC_GRAPH_NODE_xxx */
+    uint8_t type;
+} DPC_Graph_NodeCfg;
+
+/**
+ * @brief  Node time stamps of the last frame, in units of DPC_Graph_PlatformCfg::getTime
+ */
+typedef struct DPC_Graph_NodeStamp_t
+{
+    /*! @brief All the inputs have been written */
+    uint32_t readyTime;
+
+    /*! @brief Node function called */
+    uint32_t startTime;
+
+    /*! @brief Outputs valid */
+    uint32_t endTime;
+} DPC_Graph_NodeStamp;
+
+/**
+ * @brief  Graph object
+ */
+typedef struct DPC_Graph_Obj_t
+{
+    /*! @brief Platform services */
+    DPC_Graph_PlatformCfg platformCfg;
+
+    /*! @brief Nodes, in order of addition */
+    DPC_Graph_NodeCfg node[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Number of nodes */
+    uint8_t numNodes;
+
+    /*! @brief Set by DPC_Graph_validate() */
+    bool isValid;
+
+    /*! @brief Mask of the nodes the frame waits for */
+    uint32_t frameNodeMask;
+
+    /*! @brief Mask of the buffers written in the current frame */
+    uint32_t validBufMask;
+
+    /*! @brief Mask of the nodes started in the current frame */
+    uint32_t startedNodeMask;
+
+    /*! @brief Mask of the nodes completed in the current frame */
+    uint32_t doneNodeMask;
+
+    /*! @brief Sequence tag of the last run of an asynchronous node, see DPC_Graph_nodeSeq() */
+    volatile uint32_t runSeq[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Sequence tag of the last completed run of an asynchronous node, written by DPC_Graph_nodeDone() */
+    volatile uint32_t doneSeq[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Completion time of an asynchronous node, written by DPC_Graph_nodeDone() */
+    volatile uint32_t doneTime[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Number of times a detached node was started before its previous completion */
+    uint32_t overrunCount[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Number of completions of a run that had been dropped, ignored by DPC_Graph_nodeDone() */
+    volatile uint32_t lateCount[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Node time stamps */
+    DPC_Graph_NodeStamp stamp[DPC_GRAPH_MAX_NUM_NODES];
+
+    /*! @brief Time each buffer was written in the current frame */
+    uint32_t bufReadyTime[DPC_GRAPH_MAX_NUM_BUFFERS];
+
+    /*! @brief Frame start time */
+    uint32_t frameStartTime;
+
+    /*! @brief Frame end time */
+    uint32_t frameEndTime;
+
+    /*! @brief Number of frames run */
+    uint32_t frameCount;
+
+    /*! @brief Node that failed in the last frame, DPC_GRAPH_MAX_NUM_NODES if none */
+    uint8_t failedNodeId;
+} DPC_Graph_Obj;
+
+/**
+ *  @b Description
+ *  @n
+ *      Initializes an empty graph.
+ *
+ *  @param[in]  graph           Graph object
+ *  @param[in]  platformCfg     Platform services
+ *
+ *  @retval     0 on success, DPC_GRAPH_EINVAL otherwise
+ */
+int32_t DPC_Graph_init(DPC_Graph_Obj *graph, const DPC_Graph_PlatformCfg *platformCfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Adds a node to the graph. Among the synchronous nodes ready at the same time, the node added first
+ *      runs first.
+ *
+ *  @param[in]  graph           Graph object
+ *  @param[in]  nodeCfg         Node configuration, copied
+ *
+ *  @retval     Node identifier (>= 0) on success, negative error code otherwise
+ */
+int32_t DPC_Graph_addNode(DPC_Graph_Obj *graph, const DPC_Graph_NodeCfg *nodeCfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Checks that every input is written by exactly one node, that no node depends on the output of a
+ *      detached node and that the graph has no cycle. Must be called after the last DPC_Graph_addNode().
+ *
+ *  @param[in]  graph           Graph object
+ *
+ *  @retval     0 on success, negative error code otherwise
+ */
+int32_t DPC_Graph_validate(DPC_Graph_Obj *graph);
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs one frame: fires the nodes as their inputs become ready and returns when all the nodes, other
+ *      than the detached ones, have completed.
+ *
+ *  @param[in]  graph           Graph object
+ *
+ *  @retval     0 on success, error code of the failing node (see DPC_Graph_Obj::failedNodeId) or
+ *              DPC_GRAPH_ENOTVALID otherwise
+ */
+int32_t DPC_Graph_run(DPC_Graph_Obj *graph);
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the sequence tag of the current run of an asynchronous or detached node. The node function
+ *      hands it over with the work, and the owner of the work passes it back to DPC_Graph_nodeDone(), so
+ *      that a late completion of a dropped run is not taken for the completion of the current one.
+ *
+ *  @param[in]  graph           Graph object
+ *  @param[in]  nodeId          Node identifier returned by DPC_Graph_addNode()
+ *
+ *  @retval     Sequence tag, 0 before the first run
+ */
+uint32_t DPC_Graph_nodeSeq(const DPC_Graph_Obj *graph, uint32_t nodeId);
+
+/**
+ *  @b Description
+ *  @n
+ *      Signals completion of an asynchronous or detached node. Can be called from interrupt context.
+ *      A completion whose tag is not the one of the current run is counted in DPC_Graph_Obj::lateCount
+ *      and otherwise ignored.
+ *
+ *  @param[in]  graph           Graph object
+ *  @param[in]  nodeId          Node identifier returned by DPC_Graph_addNode()
+ *  @param[in]  seq             Sequence tag of the completed run, see DPC_Graph_nodeSeq()
+ */
+void DPC_Graph_nodeDone(DPC_Graph_Obj *graph, uint32_t nodeId, uint32_t seq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DPC_GRAPH_H */
@@ -69,6 +69,7 @@
 #include <source/mmwave_demo_mss.h>
 #include <source/mmw_res.h>
 #include <source/dpc/dpc_mss.h>
+#include <source/dpc/dpc_graph.h>
 #include <source/mmwave_control/interrupts.h>
 #include <source/calibrations/range_phase_bias_measurement.h>
 #include <source/utils/mmw_demo_utils.h>
@@ -91,6 +92,23 @@
 
 #define FRAME_REF_TIMER_CLOCK_MHZ  40
 
+/* DPC pipeline is used in intrusion detection mode, when the low power mode is disabled. Latched by DPC_Config,
+   which allocates the SNR ping-pong buffers and builds the graph accordingly, so a later CLI change has no effect
+   until the next configuration. Not used with the antenna geometry debug output, which the UART task reads from the
+   radar cube while the range processing of the next frame writes it */
+#define DPC_PIPELINE_CFG() ((gMmwMssMCB.dpcPipelineEnabled == 1) && \
+                            (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET) && \
+                            (gMmwMssMCB.lowPowerMode == LOW_PWR_MODE_DISABLE) && \
+                            (gMmwMssMCB.dbgGuiMonSel.dbgAntGeometry == 0))
+#define DPC_PIPELINE_ACTIVE() (gMmwMssMCB.dpcPipelineActive == 1)
+
+/* Frame results the DPC pipeline may start before the UART task sent the older ones: two with the SNR ping-pong
+   buffers, one if the UART task sends an output of the single buffers (range profile, detection matrix), so that
+   the next frame does not overwrite it during the transmission */
+#define DPC_PIPELINE_NUM_UART_FRAME_RESULTS() \
+    (((gMmwMssMCB.guiMonSel.rangeProfile & 0x1) || gMmwMssMCB.dbgGuiMonSel.dbgDetMat3D || \
+      gMmwMssMCB.dbgGuiMonSel.dbgDetMatSlice) ? 1U : MMWDEMO_UART_FRAME_RESULT_NUM)
+
 /* Max Frame Size for FTDI chip is 64KB */
 #define MAXSPISIZEFTDI               (65536U)
 
@@ -143,6 +161,9 @@ extern uint8_t gMmwCoreLocMem2[MSS_CORE_LOCAL_MEM2_SIZE] __attribute__((aligned(
 extern TaskHandle_t    gClassifierTask;
 extern StaticTask_t    gClassifierTaskObj;
 extern StackType_t     gClassifierTaskStack[];
+extern TaskHandle_t    gMboxTask;
+extern StaticTask_t    gMboxTaskObj;
+extern StackType_t     gMboxTaskStack[];
 
 
 // LED config
@@ -158,6 +179,9 @@ extern void MmwDemo_ClassifierTask();
  *************************** Local  Definitions ***************************
  **************************************************************************/
 void DPC_mss_MsgHandler(uint32_t remoteCoreId, uint16_t localClientId, uint64_t msgValue, int32_t crcStatus, void *arg);
+static void MmwDemo_mboxTask(void *args);
+static void DPC_ObjDet_graphConfig(void);
+static void DPC_ObjDet_uartFrameResultConfig(void);
 
 /**************************************************************************
  *************************** Global Definitions ***************************
@@ -695,6 +719,129 @@ exit:
     return retVal;
 }
 
+/**
+*  @b Description
+*  @n
+*    Computes the range gate of the DOA3D DPU from the intrusion detection occupancy boxes.
+*    For each box the range bins between the nearest and the farthest point of the box from the sensor
+*    are gated in, extended by the configured margin and by the range CFAR window of the SNR3D DPU so that
+*    the SNR of the gated in cells is computed from processed neighbours only. Overlapping and adjacent
+*    intervals are merged into sorted spans. The range is invariant to the sensor orientation, so only the
+*    sensor position is used.
+*/
+void DPC_ObjDet_cfgIntrusionRangeGate(DPU_Doa3dProc_RangeGateCfg *rangeGateCfg,
+                                      uint16_t numRangeBins)
+{
+    IDETECT_sceneryParams *scenery = &gMmwMssMCB.idetSceneryParams;
+    int32_t intervalStart[3 * IDETECT_MAX_OCCUPANCY_BOXES];
+    int32_t intervalEnd[3 * IDETECT_MAX_OCCUPANCY_BOXES];
+    int32_t numIntervals = 0;
+    int32_t margin, cfarMargin;
+    int32_t boxInd, axis, ind, indNext;
+    float distMin, distMax, d1, d2, dNear;
+    int32_t first, last, tmp;
+    DPU_Doa3dProc_RangeGateSpan *span;
+
+    memset((void *)rangeGateCfg, 0, sizeof(DPU_Doa3dProc_RangeGateCfg));
+
+    if ((!gMmwMssMCB.intrusionSigProcChainCfg.rangeGateEnabled) || (scenery->numOccupancyBoxes == 0))
+    {
+        goto exit;
+    }
+
+    cfarMargin = gMmwMssMCB.snr3dCfarCfg.guardLen + gMmwMssMCB.snr3dCfarCfg.winLen;
+    margin = gMmwMssMCB.intrusionSigProcChainCfg.rangeGateMargin + cfarMargin;
+
+    for (boxInd = 0; boxInd < scenery->numOccupancyBoxes; boxInd++)
+    {
+        distMin = 0.f;
+        distMax = 0.f;
+        for (axis = 0; axis < 3; axis++)
+        {
+            d1 = scenery->occupancyBox[boxInd].a[2*axis] - scenery->sensorPosition.a[axis];
+            d2 = scenery->occupancyBox[boxInd].a[2*axis + 1] - scenery->sensorPosition.a[axis];
+            if ((d1 <= 0.f) && (d2 >= 0.f))
+            {
+                dNear = 0.f;
+            }
+            else
+            {
+                dNear = (fabsf(d1) < fabsf(d2)) ? d1 : d2;
+            }
+            distMin += dNear * dNear;
+            distMax += (d1 * d1 > d2 * d2) ? d1 * d1 : d2 * d2;
+        }
+
+        /* Range of the bin index r is r*rangeStep - rangeBias */
+        first = (int32_t) floorf((sqrtf(distMin) + gMmwMssMCB.compRxChannelBiasCfg.rangeBias) / gMmwMssMCB.rangeStep) - margin;
+        last = (int32_t) ceilf((sqrtf(distMax) + gMmwMssMCB.compRxChannelBiasCfg.rangeBias) / gMmwMssMCB.rangeStep) + margin;
+
+        if ((first + margin) >= numRangeBins)
+        {
+            /* Box beyond the maximum range */
+            continue;
+        }
+
+        if (gMmwMssMCB.snr3dCfarCfg.cyclicMode)
+        {
+            /* Cyclic CFAR window wraps around the range dimension */
+            if (first < 0)
+            {
+                intervalStart[numIntervals] = (numRangeBins + first < 0) ? 0 : (numRangeBins + first);
+                intervalEnd[numIntervals] = numRangeBins - 1;
+                numIntervals++;
+            }
+            if (last >= numRangeBins)
+            {
+                intervalStart[numIntervals] = 0;
+                intervalEnd[numIntervals] = (last - numRangeBins >= numRangeBins) ? (numRangeBins - 1) : (last - numRangeBins);
+                numIntervals++;
+            }
+        }
+        intervalStart[numIntervals] = (first < 0) ? 0 : first;
+        intervalEnd[numIntervals] = (last >= numRangeBins) ? (numRangeBins - 1) : last;
+        numIntervals++;
+    }
+
+    /* Sort intervals by start */
+    for (ind = 1; ind < numIntervals; ind++)
+    {
+        for (indNext = ind; (indNext > 0) && (intervalStart[indNext - 1] > intervalStart[indNext]); indNext--)
+        {
+            tmp = intervalStart[indNext];
+            intervalStart[indNext] = intervalStart[indNext - 1];
+            intervalStart[indNext - 1] = tmp;
+            tmp = intervalEnd[indNext];
+            intervalEnd[indNext] = intervalEnd[indNext - 1];
+            intervalEnd[indNext - 1] = tmp;
+        }
+    }
+
+    /* Merge overlapping and adjacent intervals. If the span list is full the last span is extended */
+    last = -1;
+    for (ind = 0; ind < numIntervals; ind++)
+    {
+        if ((rangeGateCfg->numSpans == 0) ||
+            ((intervalStart[ind] > last + 1) && (rangeGateCfg->numSpans < DPU_DOA3DPROC_MAX_NUM_RANGE_GATE_SPANS)))
+        {
+            span = &rangeGateCfg->span[rangeGateCfg->numSpans++];
+            span->startRangeBin = (uint16_t) intervalStart[ind];
+        }
+        else
+        {
+            span = &rangeGateCfg->span[rangeGateCfg->numSpans - 1];
+        }
+        if (intervalEnd[ind] > last)
+        {
+            last = intervalEnd[ind];
+        }
+        span->numRangeBins = (uint16_t) (last - span->startRangeBin + 1);
+    }
+
+exit:
+    return;
+}
+
 /**
 *  @b Description
 *  @n
@@ -987,9 +1134,10 @@ int32_t RangeProc_configParser(uint32_t *hwaParamSetStartIdx,
 
     /* Radar cube allocation */
     gMmwMssMCB.radarCube.dataSize = params->numRangeBins * params->ADCBufData.dataProperty.numRxAntennas * sizeof(cmplx16ReIm_t) * params->numChirpsPerSlidingWindow;
+    /* Posted to the DSP through the mailbox: whole cache lines */
     gMmwMssMCB.radarCube.data  = (cmplx16ImRe_t *) DPC_ObjDet_MemPoolAlloc(&gMmwMssMCB.L3RamObj,
-                                                                                 gMmwMssMCB.radarCube.dataSize,
-                                                                                 sizeof(uint32_t));
+                                                                                 MSG_MBOX_CACHE_LINE_ROUND_UP(gMmwMssMCB.radarCube.dataSize),
+                                                                                 MSG_MBOX_CACHE_LINE_SIZE);
     if(gMmwMssMCB.radarCube.data == NULL)
     {
         retVal = DPC_OBJECTDETECTION_ENOMEM__L3_RAM_RADAR_CUBE;
@@ -1096,6 +1244,9 @@ int32_t Doa3dProc_configParser(uint32_t *hwaParamSetStartIdx,
                                       gMmwMssMCB.numTxAntennas,
                                       gMmwMssMCB.numRxAntennas);
 
+    /* Range gate from the intrusion detection occupancy boxes */
+    DPC_ObjDet_cfgIntrusionRangeGate(&doaStaticCfg->rangeGateCfg, doaStaticCfg->numRangeBins);
+
     if (gMmwMssMCB.numAntRow == 1)
     {
         doaStaticCfg->angleDimension = 1;
@@ -1310,6 +1461,23 @@ int32_t Snr3dProc_configParser(uint32_t *hwaParamSetStartIdx,
         goto exit;
     }
 
+    /* DPC pipeline: SNR3D of the next frame writes the second buffer while the intrusion detection reads the first one */
+    memset(gMmwMssMCB.snrOutMatrixPingPong, 0, sizeof(gMmwMssMCB.snrOutMatrixPingPong));
+    gMmwMssMCB.snrOutMatrixPingPongInd = 0;
+    if (DPC_PIPELINE_ACTIVE())
+    {
+        gMmwMssMCB.snrOutMatrixPingPong[0] = gMmwMssMCB.snrOutMatrix;
+        gMmwMssMCB.snrOutMatrixPingPong[1] = gMmwMssMCB.snrOutMatrix;
+        gMmwMssMCB.snrOutMatrixPingPong[1].data = DPC_ObjDet_MemPoolAlloc(&gMmwMssMCB.L3RamObj,
+                                                                          gMmwMssMCB.snrOutMatrix.dataSize,
+                                                                          sizeof(int16_t));
+        if (gMmwMssMCB.snrOutMatrixPingPong[1].data == NULL)
+        {
+            retVal = DPC_OBJECTDETECTION_ENOMEM__L3_RAM_SNR3D_MATRIX;
+            goto exit;
+        }
+    }
+
     /* hwres config - Copy these structures */
     hwRes->detMatrix = gMmwMssMCB.detMatrix;
     hwRes->snrOutMatrix = gMmwMssMCB.snrOutMatrix;
@@ -2000,8 +2168,8 @@ int32_t dsp_configParser()
 
     /* Allocate configuration for DSP */
     gMmwMssMCB.dspPreStartCfgShare = (DPIF_MSS_DSS_PreStartCfg *) DPC_ObjDet_MemPoolAlloc(&gMmwMssMCB.L3RamObj,
-                                                                                     sizeof(DPIF_MSS_DSS_PreStartCfg),
-                                                                                     sizeof(uint32_t));
+                                                                                     MSG_MBOX_CACHE_LINE_ROUND_UP(sizeof(DPIF_MSS_DSS_PreStartCfg)),
+                                                                                     MSG_MBOX_CACHE_LINE_SIZE);
     if (gMmwMssMCB.dspPreStartCfgShare == NULL)
     {
         retVal = DPC_OBJECTDETECTION_ENOMEM__L3_RAM_DSP_CFG;
@@ -2051,8 +2219,27 @@ int32_t dsp_configParser()
     pParam_s->exportCoarseHeatmap = gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap;
     pParam_s->exportRawCfarDetList = gMmwMssMCB.dbgGuiMonSel.exportRawCfarDetList;
     pParam_s->exportZoomInHeatmap = gMmwMssMCB.dbgGuiMonSel.exportZoomInHeatmap;
+    if (pParam_s->exportCoarseHeatmap >= 2)
+    {
+        HeatmapCodec_getDefaultCfg(&pParam_s->heatmapExportCfg, (pParam_s->exportCoarseHeatmap == 3) ? 16U : 8U);
+        if (gMmwMssMCB.heatmapExportCfg.configured)
+        {
+            pParam_s->heatmapExportCfg.floorDb        = gMmwMssMCB.heatmapExportCfg.floorDb;
+            pParam_s->heatmapExportCfg.deadband       = gMmwMssMCB.heatmapExportCfg.deadband;
+            pParam_s->heatmapExportCfg.keyFramePeriod = gMmwMssMCB.heatmapExportCfg.keyFramePeriod;
+            if (gMmwMssMCB.heatmapExportCfg.stepDb > 0.0f)
+            {
+                pParam_s->heatmapExportCfg.stepDb = gMmwMssMCB.heatmapExportCfg.stepDb;
+            }
+            if (gMmwMssMCB.heatmapExportCfg.maxBytesPerFrame != 0U)
+            {
+                pParam_s->heatmapExportCfg.maxBytesPerFrame = gMmwMssMCB.heatmapExportCfg.maxBytesPerFrame;
+            }
+        }
+    }
 
     pParam_s->disablePointCloudGeneration = gMmwMssMCB.cliPointCloudGenDbgCfg.disablePointCloudGeneration;
+    pParam_s->traceRing = gMmwMssMCB.traceRing[DPC_TRACE_CORE_DSS];
 exit:
     return retVal;
 }
@@ -2395,7 +2582,9 @@ void mmwDemo_classifierProcConfig()
     if (config.staticCfg.cpdOption == DPU_CLASSIFIERPROC_CPD_MODE_LPD_USING_CNN)
     {
         config.staticCfg.multiFrmDopplerFftSize = 128;  //ToDo read from CLI command
+        /* CNN inputs of all the zones, classified in one batch */
         config.res.featureMultiFrmDoppler = (float *) DPC_ObjDet_MemPoolAlloc(&gMmwMssMCB.L3RamObj,
+                                                                              gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes *
                                                                               config.staticCfg.multiFrmDopplerFftSize * sizeof(float),
                                                                               sizeof(float));
         if (config.res.featureMultiFrmDoppler == NULL)
@@ -2403,6 +2592,21 @@ void mmwDemo_classifierProcConfig()
             CLI_write("ClassifierProc DPU Configuration memoryallocation failed\n");
             DebugP_assert(0);
         }
+        /* The zones are classified in one batch only with the open classifier (alg/cnn_classifier/src, CNN_CLASSIFIER_OPEN),
+           which the shipped build does not include. The shipped build links the prebuilt alg_cnnClassifier library: it has
+           no batch entry point, classifierproc calls it once per zone, and it allocates its own scratch, so cnnScratch stays NULL */
+#ifdef CNN_CLASSIFIER_OPEN
+        /* CNN scratch for the batch of all the zones, from L3 rather than from the local heap */
+        config.res.cnnScratchSizeInBytes = cnn_classifier_batch_bytes_needed(gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes);
+        config.res.cnnScratch = (float *) DPC_ObjDet_MemPoolAlloc(&gMmwMssMCB.L3RamObj,
+                                                                  config.res.cnnScratchSizeInBytes,
+                                                                  sizeof(uint64_t));
+        if (config.res.cnnScratch == NULL)
+        {
+            CLI_write("ClassifierProc DPU Configuration memoryallocation failed\n");
+            DebugP_assert(0);
+        }
+#endif
 
         /* Copy macro doppler map scales */
         for (uint8_t ii = 0; ii < gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes; ii++)
@@ -2445,6 +2649,18 @@ void mmwDemo_dspConfig()
 
     if(!gMmwMssMCB.msgIpcCtrlObj.isMsgIpcInitialized)
     {
+        /* Mailbox task, woken up by the doorbell handler. Kept across the sensor stop/start, as the IPC */
+        retVal = SemaphoreP_constructBinary(&gMmwMssMCB.mboxTaskSemHandle, 0);
+        DebugP_assert(SystemP_SUCCESS == retVal);
+        gMboxTask = xTaskCreateStatic(MmwDemo_mboxTask,     /* Pointer to the function that implements the task. */
+                                      "mbox_task",          /* Text name for the task.  This is to facilitate debugging only. */
+                                      MBOX_TASK_STACK_SIZE, /* Stack depth in units of StackType_t typically uint32_t on 32b CPUs */
+                                      NULL,                 /* We are not using the task parameter. */
+                                      MBOX_TASK_PRI,        /* task priority, 0 is lowest priority, configMAX_PRIORITIES-1 is highest */
+                                      gMboxTaskStack,       /* pointer to stack base */
+                                      &gMboxTaskObj);       /* pointer to statically allocated task object memory */
+        configASSERT(gMboxTask != NULL);
+
         /* Configure IPC */
         msgIpcCfg.msgChanId = 1;
         msgIpcCfg.remoteCoreId = CSL_CORE_ID_C66SS0;
@@ -2482,6 +2698,13 @@ void mmwDemo_dspConfig()
     {
         /* Create semaphore to wait for DSP configuration */
         SemaphoreP_constructBinary(&gMmwMssMCB.dspCfgDoneSemaphore, 0);
+        /* Initialize the mailbox before the DSP attaches to it */
+        retVal = MsgIpc_mboxConfig(&gMmwMssMCB.msgIpcCtrlObj, MSG_MBOX_ID_MSS, true);
+        if (retVal < 0)
+        {
+            CLI_write("Error: Mailbox initialization failed:%d \n", retVal);
+            DebugP_assert(0);
+        }
         /* Sync with DSP */
         MsgIpc_Sync();
         gMmwMssMCB.msgIpcCtrlObj.isMsgIpcInitialized = TRUE;
@@ -2492,7 +2715,18 @@ void mmwDemo_dspConfig()
     memcpy(gMmwMssMCB.dspPreStartCfgShare, &gMmwMssMCB.dspPreStartCfgLocal, sizeof(DPIF_MSS_DSS_PreStartCfg));
 
     /* Send DSP configuration */
-    MsgIpc_sendMessage(&gMmwMssMCB.msgIpcCtrlObj, DPC_MSS_TO_DSS_PRE_START_CONFIG, (uint32_t) gMmwMssMCB.dspPreStartCfgShare);
+    {
+        MsgMbox_Buf buf;
+
+        buf.addr = (void *) gMmwMssMCB.dspPreStartCfgShare;
+        buf.size = sizeof(DPIF_MSS_DSS_PreStartCfg);
+        retVal = MsgIpc_post(&gMmwMssMCB.msgIpcCtrlObj, DPC_MSS_TO_DSS_PRE_START_CONFIG, 0, &buf, 1);
+        if (retVal < 0)
+        {
+            CLI_write("Error: DSP configuration not sent:%d \n", retVal);
+            DebugP_assert(0);
+        }
+    }
 
     /* Wait for DSP configuration completion */
     SemaphoreP_pend(&gMmwMssMCB.dspCfgDoneSemaphore, SystemP_WAIT_FOREVER);
@@ -2636,6 +2870,9 @@ void DPC_FrameStartISR(Edma_IntrHandle intrHandle, void *arg)
 
     mmwMssMCB->stats.frameStartIntCounter++;
 
+    DPC_TRACE_SET_FRAME(mmwMssMCB->stats.frameStartIntCounter);
+    DPC_Trace_write(gDpcTraceRing, DPC_TRACE_ID_FRAME_START, DPC_TRACE_TYPE_INSTANT, curCycle, mmwMssMCB->stats.frameStartIntCounter);
+
     if ((mmwMssMCB->runningMode == DPC_RUNNING_MODE_INDET) && (mmwMssMCB->lowPowerMode == LOW_PWR_MODE_ENABLE))
     {
         //Change to oscilator clock (40MHz)
@@ -3219,6 +3456,45 @@ void mmwDemo_ProlongedBurstingConfig()
 
 }
 
+/**
+*  @b Description
+*  @n
+*        Allocates and initializes the MSS and DSS trace rings in L3 when tracing is enabled
+*/
+static void DPC_ObjDet_traceConfig(void)
+{
+    uint32_t coreId;
+
+    gDpcTraceRing = NULL;
+    for (coreId = 0; coreId < DPC_TRACE_NUM_CORES; coreId++)
+    {
+        gMmwMssMCB.traceRing[coreId] = NULL;
+        gMmwMssMCB.traceReadCount[coreId] = 0;
+    }
+
+    if (!gMmwMssMCB.dpcTraceCfg.enabled)
+    {
+        return;
+    }
+
+    for (coreId = 0; coreId < DPC_TRACE_NUM_CORES; coreId++)
+    {
+        /* Whole cache lines: the DSS writes its ring back from L1D */
+        gMmwMssMCB.traceRing[coreId] = (DPC_Trace_Ring *) DPC_ObjDet_MemPoolAlloc(&gMmwMssMCB.L3RamObj,
+                                                                                MSG_MBOX_CACHE_LINE_ROUND_UP(sizeof(DPC_Trace_Ring)),
+                                                                                MSG_MBOX_CACHE_LINE_SIZE);
+        if (gMmwMssMCB.traceRing[coreId] == NULL)
+        {
+            CLI_write("Warning: No L3 memory for the trace rings, tracing disabled\n");
+            gMmwMssMCB.traceRing[DPC_TRACE_CORE_MSS] = NULL;
+            gMmwMssMCB.traceRing[DPC_TRACE_CORE_DSS] = NULL;
+            return;
+        }
+        DPC_Trace_ringInit(gMmwMssMCB.traceRing[coreId], coreId, 1);
+    }
+    gDpcTraceRing = gMmwMssMCB.traceRing[DPC_TRACE_CORE_MSS];
+}
+
 /**
 *  @b Description
 *  @n
@@ -3236,6 +3512,11 @@ void DPC_Config()
     
     DPC_ObjDet_MemPoolReset(&gMmwMssMCB.L3RamObj);
     DPC_ObjDet_MemPoolReset(&gMmwMssMCB.CoreLocalRamObj);
+
+    gMmwMssMCB.dpcPipelineActive = DPC_PIPELINE_CFG() ? 1 : 0;
+    DPC_ObjDet_uartFrameResultConfig();
+
+    DPC_ObjDet_traceConfig();
     DPC_ObjDet_HwaDmaTrigSrcChanPoolReset(&gMmwMssMCB.HwaDmaChanPoolObj);
     DPC_ObjDet_HwaWinRamMemoryPoolReset(&gMmwMssMCB.HwaWinRamMemoryPoolObj);
 
@@ -3334,6 +3615,8 @@ void DPC_Config()
         DebugP_assert(0);
     }
 
+    DPC_ObjDet_graphConfig();
+
     if(gMmwMssMCB.measureRxChannelBiasCliCfg.enabled)
     {
         retVal = MmwDemo_rangeBiasRxChPhaseMeasureConfig();
@@ -3380,318 +3663,633 @@ void DPC_Config()
 }
 
 volatile uint64_t gTest;
-//#define PROFILE_INTRUSION_DPUS
-#ifdef PROFILE_INTRUSION_DPUS
-volatile uint32_t gProfileTime[8][5];
-volatile uint32_t gProfileTimeInd = 0;
-volatile uint32_t gStartTime;
-volatile uint32_t gEndTime;
-#endif
 
 volatile cmplx16ImRe_t *gRngBin28VecPtr;
 volatile cmplx16ImRe_t gRngBin28Vec[64];
 volatile uint32_t gRngBin28VecIdx = 0;
 
-volatile uint32_t gMacroDopplerDpuTime[16];
-volatile uint32_t gMacroDopplerDpuTimeIdx = 0;
+
+/* Buffers exchanged between the nodes of the DPC graph */
+#define DPC_OBJDET_BUF_RADAR_CUBE           0U
+#define DPC_OBJDET_BUF_DET_MATRIX           1U
+#define DPC_OBJDET_BUF_SNR_MATRIX           2U
+#define DPC_OBJDET_BUF_RANGE_PROFILE        3U
+#define DPC_OBJDET_BUF_INTRUSION_RESULT     4U
+#define DPC_OBJDET_BUF_POINT_CLOUD          5U
+#define DPC_OBJDET_BUF_MACRO_DOPPLER_MAP    6U
+#define DPC_OBJDET_BUF_CLASSIFIER_INPUT     7U
+#define DPC_OBJDET_BUF_NEXT_FRAME           8U
+
+/* DPC graph. Node and buffer time stamps of the last frame are in gDpcGraph.stamp and gDpcGraph.bufReadyTime */
+DPC_Graph_Obj gDpcGraph;
+
+/* Graph node of the DSP processing, completed by MmwDemo_mboxTask */
+static volatile uint32_t gDpcGraphDspNodeId = DPC_GRAPH_MAX_NUM_NODES;
+
+/* Trace event identifier of each graph node */
+static uint16_t gDpcGraphTraceId[DPC_GRAPH_MAX_NUM_NODES];
+
 /**
- *  @b Description
- *  @n  DPC processing chain execute function.
- *
- */
-void DPC_Execute(){
+*  @b Description
+*  @n
+*        Triggers range processing of the next frame and records the trigger time stamp
+*/
+static void DPC_ObjDet_triggerNextFrame(void)
+{
     int32_t retVal;
-    int32_t errCode = 0;
-    DPU_RangeProc_OutParams outParms;
-    DPU_Doa3dProc_OutParams outParmsDoa3dproc;
-    DPU_SNR3DHM_OutParams   outParmsSnr3dproc;
-    DPU_MacroDopplerProc_OutParams   outParamsMacroDoppProc = {0};
-    IDETECT_output outIntrusionDet;
-    DPC_ObjectDetection_IntrusionDetResult *pIntrusionDetResult;
 
-    
-    /* give initial trigger for the first frame */
-    errCode = DPU_RangeProc_control(gMmwMssMCB.rangeProcDpuHandle,
-                                    DPU_RangeProc_Cmd_triggerProc, NULL, 0);
-    if(errCode < 0)
+    retVal = DPU_RangeProc_control(gMmwMssMCB.rangeProcDpuHandle,
+                                   DPU_RangeProc_Cmd_triggerProc, NULL, 0);
+    if(retVal < 0)
     {
-        CLI_write("Error: Range control execution failed [Error code %d]\n", errCode);
+        CLI_write("Error: DPU_RangeProcHWA_control failed with error code %d", retVal);
+        DebugP_assert(0);
     }
+    DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.nextFrameTrigger);
+}
 
-    /* Send signal to CLI task that this is ready */
-    SemaphoreP_post(&gMmwMssMCB.dpcTaskConfigDoneSemHandle);
-
-    while(true){
+/**
+*  @b Description
+*  @n
+*        Resets the frame results handed to the UART task, and with the DPC pipeline the number of frame results
+*        the DPC may start ahead of the UART transmission
+*/
+static void DPC_ObjDet_uartFrameResultConfig(void)
+{
+    uint32_t i;
 
-        memset((void *)&outParms, 0, sizeof(DPU_RangeProc_OutParams));
-        retVal = DPU_RangeProc_process(gMmwMssMCB.rangeProcDpuHandle, &outParms);
-        if(retVal != 0){
-            CLI_write("DPU_RangeProcHWA_process failed with error code %d", retVal);
-            DebugP_assert(0);
-        }
+    memset(gMmwMssMCB.uartFrameResult, 0, sizeof(gMmwMssMCB.uartFrameResult));
+    gMmwMssMCB.uartFrameResultWriteCount = 0;
+    gMmwMssMCB.uartFrameResultReadCount = 0;
 
-        //DEBUG BREATHING -  REMOVE THIS
+    while (SemaphoreP_pend(&gMmwMssMCB.uartFrameResultFreeSemHandle, SystemP_NO_WAIT) == SystemP_SUCCESS)
+    {
+    }
+    if (DPC_PIPELINE_ACTIVE())
+    {
+        for (i = 0; i < DPC_PIPELINE_NUM_UART_FRAME_RESULTS(); i++)
         {
-            uint32_t frmCntr = (gMmwMssMCB.stats.frameStartIntCounter-1) & 0x3;
-            gRngBin28VecPtr = (cmplx16ImRe_t *) gMmwMssMCB.radarCube.data;
-            gRngBin28Vec[gRngBin28VecIdx] = gRngBin28VecPtr[27*128*16 + frmCntr*32*16];
-            gRngBin28VecIdx = (gRngBin28VecIdx + 1) & 63;
+            SemaphoreP_post(&gMmwMssMCB.uartFrameResultFreeSemHandle);
         }
+    }
+}
+
+/**
+*  @b Description
+*  @n
+*        Hands the buffers and the intrusion detection result of the frame to the UART task
+*/
+static void DPC_ObjDet_uartFrameResultPost(void)
+{
+    MmwDemo_uartFrameResult *pFrameResult;
+
+    pFrameResult = &gMmwMssMCB.uartFrameResult[gMmwMssMCB.uartFrameResultWriteCount % MMWDEMO_UART_FRAME_RESULT_NUM];
+    pFrameResult->snrOutMatrix = gMmwMssMCB.snrOutMatrix;
+    pFrameResult->detMatrix = gMmwMssMCB.detMatrix;
+    pFrameResult->intrusionDetInfo = gMmwMssMCB.intrusionDetInfoToUart;
+    gMmwMssMCB.uartFrameResultWriteCount++;
+
+    /* Trigger UART task to send TLVs to host */
+    SemaphoreP_post(&gMmwMssMCB.tlvSemHandle);
+}
+
+/**
+*  @b Description
+*  @n
+*        DPC graph node: waits for the end of chirping and range processing, then starts the inter-frame processing
+*/
+static int32_t DPC_ObjDet_rangeProcNode(void *arg)
+{
+    int32_t retVal;
+    DPU_RangeProc_OutParams outParms;
+
+    memset((void *)&outParms, 0, sizeof(DPU_RangeProc_OutParams));
+    retVal = DPU_RangeProc_process(gMmwMssMCB.rangeProcDpuHandle, &outParms);
+    if(retVal != 0){
+        return retVal;
+    }
+
+    //DEBUG BREATHING -  REMOVE THIS
+    {
+        uint32_t frmCntr = (gMmwMssMCB.stats.frameStartIntCounter-1) & 0x3;
+        gRngBin28VecPtr = (cmplx16ImRe_t *) gMmwMssMCB.radarCube.data;
+        gRngBin28Vec[gRngBin28VecIdx] = gRngBin28VecPtr[27*128*16 + frmCntr*32*16];
+        gRngBin28VecIdx = (gRngBin28VecIdx + 1) & 63;
+    }
 
-        GPIO_pinWriteLow(gGpioBaseAddrLed, gPinNumLed);
+    GPIO_pinWriteLow(gGpioBaseAddrLed, gPinNumLed);
 #if 1
-        /* Read the temperature */
-        MMWave_getTemperatureReport(&gTempStats);
+    /* Read the temperature */
+    MMWave_getTemperatureReport(&gTempStats);
 #endif
-        if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
+    if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
+    {
+        if ((gMmwMssMCB.lowPowerMode == LOW_PWR_MODE_ENABLE) || (gMmwMssMCB.lowPowerMode == LOW_PWR_TEST_MODE))
         {
-            if ((gMmwMssMCB.lowPowerMode == LOW_PWR_MODE_ENABLE) || (gMmwMssMCB.lowPowerMode == LOW_PWR_TEST_MODE))
-            {
-                /* Shutdown the FECSS after chirping in Low Power Mode */
-                int32_t err;
+            /* Shutdown the FECSS after chirping in Low Power Mode */
+            int32_t err;
 
-                //Change clock back to Fast clock (200MHz)
-                SOC_rcmSetR5Clock(SOC_R5FCoreFreq200MHz,SOC_FastClk1Freq200MHz, SOC_RcmR5ClockSource_FAST_CLK1); 
+            //Change clock back to Fast clock (200MHz)
+            SOC_rcmSetR5Clock(SOC_R5FCoreFreq200MHz,SOC_FastClk1Freq200MHz, SOC_RcmR5ClockSource_FAST_CLK1); 
 
 #if 0
-                /* To-Do the retention list Retain FECSS Code Memory */
-                PRCMSetSRAMRetention((PRCM_FEC_PD_SRAM_CLUSTER_1 | PRCM_FEC_PD_SRAM_CLUSTER_2 | PRCM_FEC_PD_SRAM_CLUSTER_3), PRCM_SRAM_LPDS_RET);
+            /* To-Do the retention list Retain FECSS Code Memory */
+            PRCMSetSRAMRetention((PRCM_FEC_PD_SRAM_CLUSTER_1 | PRCM_FEC_PD_SRAM_CLUSTER_2 | PRCM_FEC_PD_SRAM_CLUSTER_3), PRCM_SRAM_LPDS_RET);
 #endif
-                /* Reset The FrameTimer for next frame */
-                HW_WR_REG32(CSL_APP_RCM_U_BASE + CSL_APP_RCM_BLOCKRESET2, 0x1c0);
+            /* Reset The FrameTimer for next frame */
+            HW_WR_REG32(CSL_APP_RCM_U_BASE + CSL_APP_RCM_BLOCKRESET2, 0x1c0);
 
-                /* To-Do Give a proper delay */
-                for(int i =0;i<10;i++)
-                {
-                    gTest = PRCMSlowClkCtrGet();
-                }
+            /* To-Do Give a proper delay */
+            for(int i =0;i<10;i++)
+            {
+                gTest = PRCMSlowClkCtrGet();
+            }
 
-                HW_WR_REG32(CSL_APP_RCM_U_BASE + CSL_APP_RCM_BLOCKRESET2, 0x0);
+            HW_WR_REG32(CSL_APP_RCM_U_BASE + CSL_APP_RCM_BLOCKRESET2, 0x0);
 
-                /* Front End Shutdown in preparation for Low power state */
-                MMWave_stop(gMmwMssMCB.ctrlHandle, &gMmwMssMCB.mmWaveCfg.strtCfg, &err);
-                MMWave_close(gMmwMssMCB.ctrlHandle,&err);
-                MMWave_deinit(gMmwMssMCB.ctrlHandle,&err);
-            }
+            /* Front End Shutdown in preparation for Low power state */
+            MMWave_stop(gMmwMssMCB.ctrlHandle, &gMmwMssMCB.mmWaveCfg.strtCfg, &err);
+            MMWave_close(gMmwMssMCB.ctrlHandle,&err);
+            MMWave_deinit(gMmwMssMCB.ctrlHandle,&err);
         }
+    }
 
-        /* Chirping finished start interframe processing */
-        gMmwMssMCB.stats.interFrameStartTimeStamp = Cycleprofiler_getTimeStamp();
-#ifdef PROFILE_INTRUSION_DPUS
-        gStartTime = gMmwMssMCB.stats.interFrameStartTimeStamp;
-#endif
-        DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.chirpingCompletion);
-        gMmwMssMCB.stats.chirpingTime_us = gMmwMssMCB.stats.chirpingCompletion.timeInUsec;
-        
-         /* Procedure for range bias measurement and Rx channels gain/phase offset measurement */
-        if(gMmwMssMCB.measureRxChannelBiasCliCfg.enabled)
-        {
-            MmwDemo_rangeBiasRxChPhaseMeasure();
-        }
+    /* Chirping finished start interframe processing */
+    gMmwMssMCB.stats.interFrameStartTimeStamp = Cycleprofiler_getTimeStamp();
+    DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.chirpingCompletion);
+    gMmwMssMCB.stats.chirpingTime_us = gMmwMssMCB.stats.chirpingCompletion.timeInUsec;
 
-#ifdef PROFILE_INTRUSION_DPUS
-        gEndTime = Cycleprofiler_getTimeStamp();
-        gProfileTime[gProfileTimeInd][0] = gEndTime - gStartTime;
-        gStartTime = gEndTime;
-#endif
+     /* Procedure for range bias measurement and Rx channels gain/phase offset measurement */
+    if(gMmwMssMCB.measureRxChannelBiasCliCfg.enabled)
+    {
+        MmwDemo_rangeBiasRxChPhaseMeasure();
+    }
 
-        if ((gMmwMssMCB.runningMode == DPC_RUNNING_MODE_SBR) || (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_CPD))
-        {
-            /* Send to DSP message that the radar cube is ready */
-            MsgIpc_sendMessage(&gMmwMssMCB.msgIpcCtrlObj, DPC_MSS_TO_DSS_RADAR_CUBE_READY, (uint32_t) &gMmwMssMCB.radarCube);
+    if (DPC_PIPELINE_ACTIVE())
+    {
+        /* The nodes below write the buffers of this frame, wait until the UART task has sent the frame which used them */
+        SemaphoreP_pend(&gMmwMssMCB.uartFrameResultFreeSemHandle, SystemP_WAIT_FOREVER);
+    }
 
-            if (gMmwMssMCB.cliMacroDopplerCfg.macroDopplerFeatureEnabled)
-            {
-                uint32_t startTime = Cycleprofiler_getTimeStamp();
+    return 0;
+}
 
-                retVal = DPU_MacroDopplerProc_process (gMmwMssMCB.macroDoppProcDpuHandle,
-                                                       &outParamsMacroDoppProc);
+/**
+*  @b Description
+*  @n
+*        DPC graph node: computes the 3D-heatmap
+*/
+static int32_t DPC_ObjDet_doa3dNode(void *arg)
+{
+    int32_t retVal;
+    DPU_Doa3dProc_OutParams outParmsDoa3dproc;
 
-                /* Check for real-time commands */
-                if (gMmwMssMCB.cliMacroDopplerMapScaleCmdPending)
-                {
-                    uint8_t numZones = gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes;
-                    MmwDemo_MacroDopplerMapScaleCfg cfg;
-                    for (uint8_t i = 0; i < numZones; i++)
-                    {
-                        cfg.cnnInputScale[i] = gMmwMssMCB.cliMacroDopplerMapScale.cnnInputScale[i] * gMmwMssMCB.cnnCommonScaleFactor; // Correction term: 140260.1472 = (1.0701*2^17)
-                    }
-                    retVal = DPU_ClassifierProc_control(gMmwMssMCB.classifierDpuHandle,
-                                                        DPU_ClassifierProc_Cmd_MacroDopplerMapScaleCfg,
-                                                        &cfg.cnnInputScale[0],
-                                                        numZones*sizeof(float));
-                    if (retVal != 0)
-                    {
-                        CLI_write("DPU_ClassifierProcess_Ctrl failed with error code %d", retVal);
-                    }
-                    gMmwMssMCB.cliMacroDopplerMapScaleCmdPending = 0;
-                }
+    retVal = DPU_Doa3dProc_process(gMmwMssMCB.doa3dProcDpuHandle,
+                                   &outParmsDoa3dproc);
+    DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.doa3dCompletion);
+    return retVal;
+}
 
-                if (gMmwMssMCB.cli_zOffsetCmdPending)
-                {
-                    uint8_t numZones = gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes;
-                    retVal = DPU_ClassifierProc_control(gMmwMssMCB.classifierDpuHandle,
-                                                        DPU_ClassifierProc_Cmd_zOffsetsCfg,
-                                                        &gMmwMssMCB.featureExtrModuleCfg.zOffset,
-                                                        numZones*sizeof(float));
-                     if (retVal != 0)
-                     {
-                         CLI_write("DPU_ClassifierProcess_Ctrl failed with error code %d", retVal);
-                     }
-                     gMmwMssMCB.cli_zOffsetCmdPending = 0;
-                }
+/**
+*  @b Description
+*  @n
+*        DPC graph node: computes the 3D-SNR heatmap
+*/
+static int32_t DPC_ObjDet_snr3dNode(void *arg)
+{
+    int32_t retVal;
+    DPU_SNR3DHM_OutParams   outParmsSnr3dproc;
+
+    if (DPC_PIPELINE_ACTIVE())
+    {
+        /* SNR output of this frame goes to the other ping-pong buffer, the previous one may still be sent to UART */
+        gMmwMssMCB.snrOutMatrix = gMmwMssMCB.snrOutMatrixPingPong[gMmwMssMCB.snrOutMatrixPingPongInd];
+        gMmwMssMCB.snrOutMatrixPingPongInd ^= 1;
+        retVal = DPU_SNR3DHM_control(gMmwMssMCB.snr3dProcDpuHandle,
+                                     DPU_SNR3DHM_Cmd_SnrOutMatrixCfg,
+                                     &gMmwMssMCB.snrOutMatrix,
+                                     sizeof(DPIF_DetMatrix));
+        if (retVal != 0)
+        {
+            return retVal;
+        }
+    }
 
+    {
+    /***********************************************************************************************/
+    /* TODO: Known issue - MMWSOC_IWRL68XX-1900. Dynamic clock gating disabled for HWA CFAR engine */
+    DSSHWACCRegs *ctrlBaseAddr = (DSSHWACCRegs *)gHwaObjectPtr[0]->hwAttrs->ctrlBaseAddr;
+    CSL_FINSR(ctrlBaseAddr->HWACCREG1,
+                HWACCREG1_ACCDYNCLKEN_BIT_END,
+                HWACCREG1_ACCDYNCLKEN_BIT_START,
+                0x0U);
+    /***********************************************************************************************/
+    }
+    /* Compute 3D-SNR */
+    retVal = DPU_SNR3DHM_process(gMmwMssMCB.snr3dProcDpuHandle,
+                                     &outParmsSnr3dproc);
+    {
+    /***********************************************************************************************/
+    /* TODO: Known issue - MMWSOC_IWRL68XX-1900. Dynamic clock gating disabled for HWA CFAR engine */
+    DSSHWACCRegs *ctrlBaseAddr = (DSSHWACCRegs *)gHwaObjectPtr[0]->hwAttrs->ctrlBaseAddr;
+    CSL_FINSR(ctrlBaseAddr->HWACCREG1,
+                HWACCREG1_ACCDYNCLKEN_BIT_END,
+                HWACCREG1_ACCDYNCLKEN_BIT_START,
+                0x1U);
+    /***********************************************************************************************/
+    }
+    DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.snr3dCompletion);
+    return retVal;
+}
 
-                if ((gMmwMssMCB.runningMode == DPC_RUNNING_MODE_CPD) && gMmwMssMCB.cpdOption == DPU_CLASSIFIERPROC_CPD_MODE_LPD_USING_CNN)
-                {
-                    /* Send signal to classifier task that macro-doppler is ready */
-                    SemaphoreP_post(&gMmwMssMCB.classifierTaskSem2Handle);
-                }
-                gMacroDopplerDpuTime[gMacroDopplerDpuTimeIdx] = Cycleprofiler_getTimeStamp() - startTime;
-                gMacroDopplerDpuTimeIdx = (gMacroDopplerDpuTimeIdx + 1) & 15;
-            }
+/**
+*  @b Description
+*  @n
+*        DPC graph node: saves range profile to send to UART output. Range profile is in bore site direction
+*        (azimuth and elevation angle equal to zero)
+*/
+static int32_t DPC_ObjDet_rangeProfileNode(void *arg)
+{
+    uint32_t rngInd, ind;
+    uint32_t nRngBins = gMmwMssMCB.numRangeBins;
+    uint32_t nAzBins = gMmwMssMCB.intrusionSigProcChainCfg.azimuthFftSize;
+    uint32_t nAzBinsHalf = nAzBins >> 1;
+    uint32_t nElBinsHalf = gMmwMssMCB.intrusionSigProcChainCfg.elevationFftSize >> 1;
+    uint32_t nOffset = nElBinsHalf*nRngBins*nAzBins + nAzBinsHalf;
 
-            if (retVal != 0)
+    if (gMmwMssMCB.rangeProfile != NULL)
+    {
+        if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
+        {
+            for (rngInd = 0; rngInd < nRngBins; rngInd++)
             {
-                CLI_write("DPU_Doa3dProc_process failed with error code %d", retVal);
-                DebugP_assert(0);
+                cmplx16ImRe_t * radCube = (cmplx16ImRe_t *) gMmwMssMCB.radarCube.data;
+                gMmwMssMCB.rangeProfile[rngInd] = (uint32_t) sqrtf((float) radCube[rngInd].real * (float) radCube[rngInd].real +
+                                                                   (float) radCube[rngInd].imag * (float) radCube[rngInd].imag);
+                //gMmwMssMCB.rangeProfile[rngInd] = detMatrix[rngInd*nAzBins + nOffset];
             }
-
         }
         else
         {
-            /****************************/
-            /* Intrusion Detection Mode */
-            /****************************/
-            /* Compute 3D-heatmap */
-            retVal = DPU_Doa3dProc_process(gMmwMssMCB.doa3dProcDpuHandle,
-                                           &outParmsDoa3dproc);
-            if (retVal != 0)
+            nOffset = gMmwMssMCB.numRxAntennas * gMmwMssMCB.numTxAntennas * gMmwMssMCB.numDopplerChirps;
+            rngInd = 0;
+            for (ind = 0; ind < nRngBins; ind++)
             {
-                CLI_write("DPU_Doa3dProc_process failed with error code %d", retVal);
-                DebugP_assert(0);
+                cmplx16ImRe_t * radCube = (cmplx16ImRe_t *) gMmwMssMCB.radarCube.data;
+                gMmwMssMCB.rangeProfile[ind] = (uint32_t) sqrtf((float) radCube[rngInd].real * (float) radCube[rngInd].real +
+                                                                (float) radCube[rngInd].imag * (float) radCube[rngInd].imag);
+                rngInd += nOffset;
+                //gMmwMssMCB.rangeProfile[rngInd] = detMatrix[rngInd*nAzBins + nOffset];
             }
+        }
+    }
+    return 0;
+}
 
-#ifdef PROFILE_INTRUSION_DPUS
-            gEndTime = Cycleprofiler_getTimeStamp();
-            gProfileTime[gProfileTimeInd][1] = gEndTime - gStartTime;
-            gStartTime = gEndTime;
-#endif
+/**
+*  @b Description
+*  @n
+*        DPC graph node: intrusion detection
+*/
+static int32_t DPC_ObjDet_inDetectNode(void *arg)
+{
+    IDETECT_output outIntrusionDet;
+    DPC_ObjectDetection_IntrusionDetResult *pIntrusionDetResult;
+    uint32_t numOccBoxes = gMmwMssMCB.idetSceneryParams.numOccupancyBoxes;
+    uint32_t dataSizeInBytes;
 
-            {
-            /***********************************************************************************************/
-            /* TODO: Known issue - MMWSOC_IWRL68XX-1900. Dynamic clock gating disabled for HWA CFAR engine */
-            DSSHWACCRegs *ctrlBaseAddr = (DSSHWACCRegs *)gHwaObjectPtr[0]->hwAttrs->ctrlBaseAddr;
-            CSL_FINSR(ctrlBaseAddr->HWACCREG1,
-                        HWACCREG1_ACCDYNCLKEN_BIT_END,
-                        HWACCREG1_ACCDYNCLKEN_BIT_START,
-                        0x0U);
-            /***********************************************************************************************/
-            }
-            /* Compute 3D-SNR */
-            retVal = DPU_SNR3DHM_process(gMmwMssMCB.snr3dProcDpuHandle,
-                                             &outParmsSnr3dproc);
-            if (retVal != 0)
-            {
-                CLI_write("DPU_SNR3DHM_process failed with error code %d", retVal);
-                DebugP_assert(0);
-            }
-            {
-            /***********************************************************************************************/
-            /* TODO: Known issue - MMWSOC_IWRL68XX-1900. Dynamic clock gating disabled for HWA CFAR engine */
-            DSSHWACCRegs *ctrlBaseAddr = (DSSHWACCRegs *)gHwaObjectPtr[0]->hwAttrs->ctrlBaseAddr;
-            CSL_FINSR(ctrlBaseAddr->HWACCREG1,
-                        HWACCREG1_ACCDYNCLKEN_BIT_END,
-                        HWACCREG1_ACCDYNCLKEN_BIT_START,
-                        0x1U);
-            /***********************************************************************************************/
-            }
+    inDetect_compute(gMmwMssMCB.inDetectHandle, gMmwMssMCB.snrOutMatrix.data, &outIntrusionDet);
 
-#ifdef PROFILE_INTRUSION_DPUS
-            gEndTime = Cycleprofiler_getTimeStamp();
-            gProfileTime[gProfileTimeInd][2] = gEndTime - gStartTime;
-            gStartTime = gEndTime;
-#endif
+    pIntrusionDetResult = &gMmwMssMCB.intrusionDetInfoToUart.intrusionDetResult;
 
-            {/* save range profile to send to UART output. Range profile is in bore site direction (azimuth and elevation angle equal to zero) */
-                uint32_t rngInd, ind;
-                uint32_t nRngBins = gMmwMssMCB.numRangeBins;
-                uint32_t nAzBins = gMmwMssMCB.intrusionSigProcChainCfg.azimuthFftSize;
-                uint32_t nAzBinsHalf = nAzBins >> 1;
-                uint32_t nElBinsHalf = gMmwMssMCB.intrusionSigProcChainCfg.elevationFftSize >> 1;
-                uint32_t nOffset = nElBinsHalf*nRngBins*nAzBins + nAzBinsHalf;
+    pIntrusionDetResult->numberOfZones = numOccBoxes;
+    memcpy(&pIntrusionDetResult->data[0], outIntrusionDet.occBoxSignal, sizeof(float)*numOccBoxes);
+    memcpy(&pIntrusionDetResult->data[sizeof(float)*numOccBoxes], outIntrusionDet.occBoxDecision, sizeof(uint8_t)*numOccBoxes);
 
-                if (gMmwMssMCB.rangeProfile != NULL)
-                {
-                    if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
-                    {
-                        for (rngInd = 0; rngInd < nRngBins; rngInd++)
-                        {
-                            cmplx16ImRe_t * radCube = (cmplx16ImRe_t *) gMmwMssMCB.radarCube.data;
-                            gMmwMssMCB.rangeProfile[rngInd] = (uint32_t) sqrtf((float) radCube[rngInd].real * (float) radCube[rngInd].real +
-                                                                               (float) radCube[rngInd].imag * (float) radCube[rngInd].imag);
-                            //gMmwMssMCB.rangeProfile[rngInd] = detMatrix[rngInd*nAzBins + nOffset];
-                        }
-                    }
-                    else
-                    {
-                        nOffset = gMmwMssMCB.numRxAntennas * gMmwMssMCB.numTxAntennas * gMmwMssMCB.numDopplerChirps;
-                        rngInd = 0;
-                        for (ind = 0; ind < nRngBins; ind++)
-                        {
-                            cmplx16ImRe_t * radCube = (cmplx16ImRe_t *) gMmwMssMCB.radarCube.data;
-                            gMmwMssMCB.rangeProfile[ind] = (uint32_t) sqrtf((float) radCube[rngInd].real * (float) radCube[rngInd].real +
-                                                                            (float) radCube[rngInd].imag * (float) radCube[rngInd].imag);
-                            rngInd += nOffset;
-                            //gMmwMssMCB.rangeProfile[rngInd] = detMatrix[rngInd*nAzBins + nOffset];
-                        }
-                    }
-                }
-            }
+    dataSizeInBytes = sizeof(uint32_t) + numOccBoxes * (sizeof(float) + sizeof(uint8_t));
+    gMmwMssMCB.intrusionDetInfoToUart.messageTL.type = MMWDEMO_OUTPUT_MSG_INTRUSION_DET_INFO;
+    gMmwMssMCB.intrusionDetInfoToUart.messageTL.length = dataSizeInBytes;
 
-#ifdef PROFILE_INTRUSION_DPUS
-            gEndTime = Cycleprofiler_getTimeStamp();
-            gProfileTime[gProfileTimeInd][3] = gEndTime - gStartTime;
-            gStartTime = gEndTime;
-#endif
+    /* Interframe Intrusion detection processing finished */
+    DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.intrusionDetCompletion);
+    gMmwMssMCB.outStats.interFrameProcessingTime = gMmwMssMCB.stats.intrusionDetCompletion.timeInUsec - gMmwMssMCB.stats.chirpingCompletion.timeInUsec;
+    gMmwMssMCB.outStats.dspProcessingTime = 0;
+    return 0;
+}
 
-            /* Intrusion detection */
-            inDetect_compute(gMmwMssMCB.inDetectHandle, gMmwMssMCB.snrOutMatrix.data, &outIntrusionDet);
-            {
-                uint32_t numOccBoxes = gMmwMssMCB.idetSceneryParams.numOccupancyBoxes;
-                pIntrusionDetResult = &gMmwMssMCB.intrusionDetInfoToUart.intrusionDetResult;
+/**
+*  @b Description
+*  @n
+*        DPC graph node: sends the radar cube to the DSP. Completed by MmwDemo_mboxTask when the point cloud is ready.
+*        The frame number of the message is the sequence tag of the run, echoed by the DSP in the point cloud message.
+*/
+static int32_t DPC_ObjDet_dspNode(void *arg)
+{
+    MsgMbox_Buf buf;
 
-                pIntrusionDetResult->numberOfZones = numOccBoxes;
-                memcpy(&pIntrusionDetResult->data[0], outIntrusionDet.occBoxSignal, sizeof(float)*numOccBoxes);
-                memcpy(&pIntrusionDetResult->data[sizeof(float)*numOccBoxes], outIntrusionDet.occBoxDecision, sizeof(uint8_t)*numOccBoxes);
+    /* Send to DSP message that the radar cube is ready */
+    buf.addr = (void *) gMmwMssMCB.radarCube.data;
+    buf.size = gMmwMssMCB.radarCube.dataSize;
+    return MsgIpc_post(&gMmwMssMCB.msgIpcCtrlObj, DPC_MSS_TO_DSS_RADAR_CUBE_READY,
+                       DPC_Graph_nodeSeq(&gDpcGraph, gDpcGraphDspNodeId), &buf, 1);
+}
 
-                uint32_t dataSizeInBytes = sizeof(uint32_t) + numOccBoxes * (sizeof(float) + sizeof(uint8_t));
-                gMmwMssMCB.intrusionDetInfoToUart.messageTL.type = MMWDEMO_OUTPUT_MSG_INTRUSION_DET_INFO;
-                gMmwMssMCB.intrusionDetInfoToUart.messageTL.length = dataSizeInBytes;
+/**
+*  @b Description
+*  @n
+*        DPC graph node: computes the macro-Doppler maps
+*/
+static int32_t DPC_ObjDet_macroDopplerNode(void *arg)
+{
+    DPU_MacroDopplerProc_OutParams   outParamsMacroDoppProc = {0};
 
-            }
-            /* Interframe Intrusion detection processing finished */
-            DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.intrusionDetCompletion);
-            gMmwMssMCB.outStats.interFrameProcessingTime = gMmwMssMCB.stats.intrusionDetCompletion.timeInUsec - gMmwMssMCB.stats.chirpingCompletion.timeInUsec;
-            gMmwMssMCB.outStats.dspProcessingTime = 0;
-
-#ifdef PROFILE_INTRUSION_DPUS
-            gProfileTime[gProfileTimeInd][4] = gEndTime - gStartTime;
-            gStartTime = gEndTime;
-            gProfileTimeInd = (gProfileTimeInd + 1) & 0x7;
-#endif
+    return DPU_MacroDopplerProc_process (gMmwMssMCB.macroDoppProcDpuHandle,
+                                         &outParamsMacroDoppProc);
+}
 
+/**
+*  @b Description
+*  @n
+*        DPC graph node: applies the real-time classifier commands and hands the macro-Doppler maps over to the classifier task
+*/
+static int32_t DPC_ObjDet_classifierNode(void *arg)
+{
+    int32_t retVal;
+
+    /* Check for real-time commands */
+    if (gMmwMssMCB.cliMacroDopplerMapScaleCmdPending)
+    {
+        uint8_t numZones = gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes;
+        MmwDemo_MacroDopplerMapScaleCfg cfg;
+        for (uint8_t i = 0; i < numZones; i++)
+        {
+            cfg.cnnInputScale[i] = gMmwMssMCB.cliMacroDopplerMapScale.cnnInputScale[i] * gMmwMssMCB.cnnCommonScaleFactor; // Correction term: 140260.1472 = (1.0701*2^17)
         }
-        
-        /* Give initial trigger for the next frame */
-        retVal = DPU_RangeProc_control(gMmwMssMCB.rangeProcDpuHandle,
-                                       DPU_RangeProc_Cmd_triggerProc, NULL, 0);
-        if(retVal < 0)
+        retVal = DPU_ClassifierProc_control(gMmwMssMCB.classifierDpuHandle,
+                                            DPU_ClassifierProc_Cmd_MacroDopplerMapScaleCfg,
+                                            &cfg.cnnInputScale[0],
+                                            numZones*sizeof(float));
+        if (retVal != 0)
         {
-            CLI_write("Error: DPU_RangeProcHWA_control failed with error code %d", retVal);
-            DebugP_assert(0);
+            CLI_write("DPU_ClassifierProcess_Ctrl failed with error code %d", retVal);
         }
+        gMmwMssMCB.cliMacroDopplerMapScaleCmdPending = 0;
+    }
 
+    if (gMmwMssMCB.cli_zOffsetCmdPending)
+    {
+        uint8_t numZones = gMmwMssMCB.featureExtrModuleCfg.sceneryParams.numOccupancyBoxes;
+        retVal = DPU_ClassifierProc_control(gMmwMssMCB.classifierDpuHandle,
+                                            DPU_ClassifierProc_Cmd_zOffsetsCfg,
+                                            &gMmwMssMCB.featureExtrModuleCfg.zOffset,
+                                            numZones*sizeof(float));
+         if (retVal != 0)
+         {
+             CLI_write("DPU_ClassifierProcess_Ctrl failed with error code %d", retVal);
+         }
+         gMmwMssMCB.cli_zOffsetCmdPending = 0;
+    }
+
+    if ((gMmwMssMCB.runningMode == DPC_RUNNING_MODE_CPD) && gMmwMssMCB.cpdOption == DPU_CLASSIFIERPROC_CPD_MODE_LPD_USING_CNN)
+    {
+        /* Send signal to classifier task that macro-doppler is ready */
+        SemaphoreP_post(&gMmwMssMCB.classifierTaskSem2Handle);
+    }
+    return 0;
+}
+
+/**
+*  @b Description
+*  @n
+*        DPC graph node: triggers the next frame
+*/
+static int32_t DPC_ObjDet_nextFrameNode(void *arg)
+{
+    DPC_ObjDet_triggerNextFrame();
+    return 0;
+}
+
+/**
+*  @b Description
+*  @n
+*        DPC graph platform functions
+*/
+static void DPC_ObjDet_graphWait(void *arg)
+{
+    SemaphoreP_pend((SemaphoreP_Object *) arg, SystemP_WAIT_FOREVER);
+}
+
+static void DPC_ObjDet_graphPost(void *arg)
+{
+    SemaphoreP_post((SemaphoreP_Object *) arg);
+}
+
+/**
+*  @b Description
+*  @n
+*        Adds a node to the DPC graph
+*
+*  @retval
+*      Node identifier
+*/
+static uint32_t DPC_ObjDet_graphAddNode(const char *name, DPC_Graph_NodeFxn fxn, uint32_t inBufMask, uint32_t outBufMask, uint8_t type,
+                                        uint16_t traceId)
+{
+    DPC_Graph_NodeCfg nodeCfg;
+    int32_t nodeId;
+
+    nodeCfg.name = name;
+    nodeCfg.fxn = fxn;
+    nodeCfg.arg = NULL;
+    nodeCfg.inBufMask = inBufMask;
+    nodeCfg.outBufMask = outBufMask;
+    nodeCfg.type = type;
+
+    nodeId = DPC_Graph_addNode(&gDpcGraph, &nodeCfg);
+    if (nodeId < 0)
+    {
+        CLI_write("Error: DPC graph node %s can not be added [Error code %d]\n", name, nodeId);
+        DebugP_assert(0);
+    }
+    gDpcGraphTraceId[nodeId] = traceId;
+    return (uint32_t) nodeId;
+}
+
+/**
+*  @b Description
+*  @n
+*        Builds the DPC graph of the running mode. The node order sets the order of the nodes that are ready
+*        at the same time.
+*
+*        Intrusion detection:
+*        rangeProc -> radarCube -> doa3d -> detMatrix -> snr3d -> snrMatrix -> inDetect
+*                              \-> rangeProfile
+*        The next frame is triggered after inDetect, or as soon as the HWA and the radar cube are released
+*        (snr3d and rangeProfile done) when the pipelined processing is enabled.
+*
+*        SBR/CPD:
+*        rangeProc -> radarCube -> DSP (detached, consumed by the classifier task)
+*                              \-> macroDoppler -> macroDopplerMap -> classifier
+*        The DSP node is started first, so the DSP processing runs concurrently with the macro-Doppler DPU.
+*        The next frame is triggered after the classifier hand-off.
+*/
+static void DPC_ObjDet_graphConfig(void)
+{
+    int32_t retVal;
+    uint32_t nextFrameInBufMask;
+    DPC_Graph_PlatformCfg platformCfg;
+
+    platformCfg.getTime = Cycleprofiler_getTimeStamp;
+    platformCfg.waitEvent = DPC_ObjDet_graphWait;
+    platformCfg.postEvent = DPC_ObjDet_graphPost;
+    platformCfg.eventArg = (void *) &gMmwMssMCB.dpcGraphSemHandle;
+
+    gDpcGraphDspNodeId = DPC_GRAPH_MAX_NUM_NODES;
+    retVal = DPC_Graph_init(&gDpcGraph, &platformCfg);
+    if (retVal != 0)
+    {
+        CLI_write("Error: DPC graph init failed [Error code %d]\n", retVal);
+        DebugP_assert(0);
+    }
+
+    DPC_ObjDet_graphAddNode("rangeProc", DPC_ObjDet_rangeProcNode,
+                            0, DPC_GRAPH_BUF(DPC_OBJDET_BUF_RADAR_CUBE), DPC_GRAPH_NODE_SYNC,
+                            DPC_TRACE_ID_NODE_RANGE_PROC);
+
+    if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
+    {
+        DPC_ObjDet_graphAddNode("doa3d", DPC_ObjDet_doa3dNode,
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_RADAR_CUBE),
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_DET_MATRIX), DPC_GRAPH_NODE_SYNC,
+                                DPC_TRACE_ID_NODE_DOA3D);
+        DPC_ObjDet_graphAddNode("snr3d", DPC_ObjDet_snr3dNode,
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_DET_MATRIX),
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_SNR_MATRIX), DPC_GRAPH_NODE_SYNC,
+                                DPC_TRACE_ID_NODE_SNR3D);
+        DPC_ObjDet_graphAddNode("rangeProfile", DPC_ObjDet_rangeProfileNode,
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_RADAR_CUBE),
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_RANGE_PROFILE), DPC_GRAPH_NODE_SYNC,
+                                DPC_TRACE_ID_NODE_RANGE_PROFILE);
+        if (DPC_PIPELINE_ACTIVE())
+        {
+            /* Intrusion detection overlaps the chirping and range processing of the next frame */
+            DPC_ObjDet_graphAddNode("nextFrame", DPC_ObjDet_nextFrameNode,
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_SNR_MATRIX) | DPC_GRAPH_BUF(DPC_OBJDET_BUF_RANGE_PROFILE),
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_NEXT_FRAME), DPC_GRAPH_NODE_SYNC,
+                                    DPC_TRACE_ID_NODE_NEXT_FRAME);
+            DPC_ObjDet_graphAddNode("inDetect", DPC_ObjDet_inDetectNode,
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_SNR_MATRIX),
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_INTRUSION_RESULT), DPC_GRAPH_NODE_SYNC,
+                                    DPC_TRACE_ID_NODE_IN_DETECT);
+        }
+        else
+        {
+            DPC_ObjDet_graphAddNode("inDetect", DPC_ObjDet_inDetectNode,
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_SNR_MATRIX),
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_INTRUSION_RESULT), DPC_GRAPH_NODE_SYNC,
+                                    DPC_TRACE_ID_NODE_IN_DETECT);
+            DPC_ObjDet_graphAddNode("nextFrame", DPC_ObjDet_nextFrameNode,
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_INTRUSION_RESULT) | DPC_GRAPH_BUF(DPC_OBJDET_BUF_RANGE_PROFILE),
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_NEXT_FRAME), DPC_GRAPH_NODE_SYNC,
+                                    DPC_TRACE_ID_NODE_NEXT_FRAME);
+        }
+    }
+    else
+    {
+        gDpcGraphDspNodeId = DPC_ObjDet_graphAddNode("dsp", DPC_ObjDet_dspNode,
+                                                     DPC_GRAPH_BUF(DPC_OBJDET_BUF_RADAR_CUBE),
+                                                     DPC_GRAPH_BUF(DPC_OBJDET_BUF_POINT_CLOUD), DPC_GRAPH_NODE_DETACHED,
+                                                     DPC_TRACE_ID_NODE_DSP);
+        nextFrameInBufMask = DPC_GRAPH_BUF(DPC_OBJDET_BUF_RADAR_CUBE);
+        if (gMmwMssMCB.cliMacroDopplerCfg.macroDopplerFeatureEnabled)
+        {
+            DPC_ObjDet_graphAddNode("macroDoppler", DPC_ObjDet_macroDopplerNode,
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_RADAR_CUBE),
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_MACRO_DOPPLER_MAP), DPC_GRAPH_NODE_SYNC,
+                                    DPC_TRACE_ID_NODE_MACRO_DOPPLER);
+            DPC_ObjDet_graphAddNode("classifier", DPC_ObjDet_classifierNode,
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_MACRO_DOPPLER_MAP),
+                                    DPC_GRAPH_BUF(DPC_OBJDET_BUF_CLASSIFIER_INPUT), DPC_GRAPH_NODE_SYNC,
+                                    DPC_TRACE_ID_NODE_CLASSIFIER);
+            nextFrameInBufMask = DPC_GRAPH_BUF(DPC_OBJDET_BUF_CLASSIFIER_INPUT);
+        }
+        DPC_ObjDet_graphAddNode("nextFrame", DPC_ObjDet_nextFrameNode,
+                                nextFrameInBufMask,
+                                DPC_GRAPH_BUF(DPC_OBJDET_BUF_NEXT_FRAME), DPC_GRAPH_NODE_SYNC,
+                                DPC_TRACE_ID_NODE_NEXT_FRAME);
+    }
+
+    retVal = DPC_Graph_validate(&gDpcGraph);
+    if (retVal != 0)
+    {
+        CLI_write("Error: DPC graph is not valid [Error code %d]\n", retVal);
+        DebugP_assert(0);
+    }
+}
+
+/**
+*  @b Description
+*  @n
+*        Writes the begin/end trace events of the graph nodes from the time stamps of the last frame.
+*        The end of the detached DSP node is traced by MmwDemo_mboxTask.
+*/
+static void DPC_ObjDet_traceGraph(void)
+{
+    uint32_t nodeId;
+
+    if (gDpcTraceRing == NULL)
+    {
+        return;
+    }
+
+    for (nodeId = 0; nodeId < gDpcGraph.numNodes; nodeId++)
+    {
+        if ((gDpcGraph.startedNodeMask & (1U << nodeId)) == 0U)
+        {
+            continue;
+        }
+        DPC_Trace_write(gDpcTraceRing, gDpcGraphTraceId[nodeId], DPC_TRACE_TYPE_BEGIN,
+                        gDpcGraph.stamp[nodeId].startTime, gDpcGraph.stamp[nodeId].readyTime);
+        if (gDpcGraph.node[nodeId].type != DPC_GRAPH_NODE_DETACHED)
+        {
+            DPC_Trace_write(gDpcTraceRing, gDpcGraphTraceId[nodeId], DPC_TRACE_TYPE_END,
+                            gDpcGraph.stamp[nodeId].endTime, 0);
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n  DPC processing chain execute function.
+ *
+ */
+void DPC_Execute(){
+    int32_t errCode = 0;
+
+    
+    /* give initial trigger for the first frame */
+    errCode = DPU_RangeProc_control(gMmwMssMCB.rangeProcDpuHandle,
+                                    DPU_RangeProc_Cmd_triggerProc, NULL, 0);
+    if(errCode < 0)
+    {
+        CLI_write("Error: Range control execution failed [Error code %d]\n", errCode);
+    }
+
+    /* Send signal to CLI task that this is ready */
+    SemaphoreP_post(&gMmwMssMCB.dpcTaskConfigDoneSemHandle);
+
+    while(true){
+
+        /* Frame processing, ends with the trigger of the next frame */
+        errCode = DPC_Graph_run(&gDpcGraph);
+        if (errCode != 0)
+        {
+            CLI_write("Error: DPC node %s failed with error code %d\n",
+                      (gDpcGraph.failedNodeId < gDpcGraph.numNodes) ? gDpcGraph.node[gDpcGraph.failedNodeId].name : "-",
+                      errCode);
+            DebugP_assert(0);
+        }
+        DPC_ObjDet_traceGraph();
 
         /* Interframe processing finished */
         //gMmwMssMCB.stats.ProcessingEndTimeStampUs = ClockP_getTimeUsec();
@@ -3717,8 +4315,7 @@ void DPC_Execute(){
 
         if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
         {
-            /* Trigger UART task to send TLVs to host */
-            SemaphoreP_post(&gMmwMssMCB.tlvSemHandle);
+            DPC_ObjDet_uartFrameResultPost();
         }
     }
 }
@@ -3743,30 +4340,65 @@ void MmwDemo_dpcTask()
 
 
 
-void DPC_mss_MsgHandler(uint32_t remoteCoreId, uint16_t localClientId, uint64_t msgValue, int32_t crcStatus, void *arg)
+/**
+*  @b Description
+*  @n
+*        Mailbox task: drains the mailbox when the DSS rings the doorbell. Runs the message handling in task
+*        context, above the DPC task, so that the interrupt handler only posts a semaphore.
+*/
+static void MmwDemo_mboxTask(void *args)
 {
-    uint32_t message;
-    uint32_t messageArg;
+    MsgMbox_Msg msg;
+    int32_t retVal;
 
+    while (1)
+    {
+        SemaphoreP_pend(&gMmwMssMCB.mboxTaskSemHandle, SystemP_WAIT_FOREVER);
 
-    message     = (uint32_t) ((msgValue >> 32) & 0xffff);
-    messageArg  = (uint32_t) (msgValue  & 0xffffffff);
+        /* Drain the mailbox, dropped messages are counted in the mailbox object */
+        while (((retVal = MsgIpc_receive(&gMmwMssMCB.msgIpcCtrlObj, &msg)) != MSG_MBOX_EEMPTY) &&
+               (retVal != MSG_MBOX_ENOTREADY))
+        {
+            if (retVal != 0)
+            {
+                continue;
+            }
 
-    switch (message)
-    {
-        case DPC_DSS_TO_MSS_CONFIGURATION_COMPLETED:
-            /* Send signal to CLI task that this is ready */
-            SemaphoreP_post(&gMmwMssMCB.dspCfgDoneSemaphore);
-            break;
+            switch (msg.msgId)
+            {
+                case DPC_DSS_TO_MSS_CONFIGURATION_COMPLETED:
+                    /* Send signal to CLI task that this is ready */
+                    SemaphoreP_post(&gMmwMssMCB.dspCfgDoneSemaphore);
+                    break;
+
+                case DPC_DSS_TO_MSS_POINT_CLOUD_READY:
+
+                    /* Get the pointer to point cloud result from DSP */
+                    gMmwMssMCB.outputFromDSP = (DPIF_MSS_DSS_radarProcessOutput  *) msg.buf[0].addr;
+                    /* Time stamp the DSP node of the DPC graph */
+                    DPC_Graph_nodeDone(&gDpcGraph, gDpcGraphDspNodeId, msg.frameNum);
+                    DPC_TRACE_END(DPC_TRACE_ID_NODE_DSP, msg.frameNum);
+                    /* Send signal to classifier task this is ready */
+                    SemaphoreP_post(&gMmwMssMCB.classifierTaskSemHandle);
+                    break;
+            }
+        }
+    }
+}
 
-        case DPC_DSS_TO_MSS_POINT_CLOUD_READY:
+/* Registered function with IPC driver that receives the mailbox doorbells from DSS, in interrupt context */
+void DPC_mss_MsgHandler(uint32_t remoteCoreId, uint16_t localClientId, uint64_t msgValue, int32_t crcStatus, void *arg)
+{
+    uint32_t message;
 
-            /* Get the pointer to point cloud result from DSP */
-            gMmwMssMCB.outputFromDSP = (DPIF_MSS_DSS_radarProcessOutput  *) messageArg;
-            /* Send signal to classifier task this is ready */
-            SemaphoreP_post(&gMmwMssMCB.classifierTaskSemHandle);
-            break;
+    message     = (uint32_t) ((msgValue >> 32) & 0xffff);
+    if (message != MSG_IPC_MBOX_DOORBELL)
+    {
+        return;
     }
+
+    /* Wake up the mailbox task, doorbells rung while it drains are coalesced */
+    SemaphoreP_post(&gMmwMssMCB.mboxTaskSemHandle);
 }
 
 
@@ -0,0 +1,463 @@
+/**
+ *   @file  dpc_graph_host_check.c
+ *
+ *   @brief
+ *      Host check of the DPC graph scheduler with mock nodes.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: dpc_graph_host_check
+ *
+ *  Builds the DPC graphs of dpc_mss.c (intrusion detection, with and without the pipelined processing, and
+ *  SBR/CPD) with mock nodes on a simulated clock and checks, frame by frame, the order the nodes run in, the
+ *  node and frame time stamps, and the handling of a detached node that overruns the frame: the overrun
+ *  is counted, the late completion of the dropped run is ignored, and the completion of the current run
+ *  time stamps the node. It also checks the validation errors and the abort of a frame on a node error.
+ *  The mock asynchronous work completes from DPC_Graph_PlatformCfg::waitEvent, as the mailbox interrupt does
+ *  on the target. The exit status is 0 if all checks pass.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <source/dpc/dpc_graph.h>
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+/* Buffers of dpc_mss.c */
+#define CHECK_BUF_RADAR_CUBE            0U
+#define CHECK_BUF_DET_MATRIX            1U
+#define CHECK_BUF_SNR_MATRIX            2U
+#define CHECK_BUF_RANGE_PROFILE         3U
+#define CHECK_BUF_INTRUSION_RESULT      4U
+#define CHECK_BUF_POINT_CLOUD           5U
+#define CHECK_BUF_MACRO_DOPPLER_MAP     6U
+#define CHECK_BUF_CLASSIFIER_INPUT      7U
+#define CHECK_BUF_NEXT_FRAME            8U
+
+/* Maximum number of asynchronous runs in flight */
+#define CHECK_MAX_PENDING               (4U)
+
+/* Length of the execution log of a frame */
+#define CHECK_LOG_LEN                   (128U)
+
+/* Mock node: synchronous nodes advance the clock by cost, asynchronous ones complete latency after their start */
+typedef struct CheckNode_t
+{
+    const char *name;
+    uint32_t    cost;
+    uint32_t    latency;
+    int32_t     retVal;
+    uint32_t    nodeId;
+} CheckNode;
+
+/* Asynchronous work in flight, completed with its sequence tag */
+typedef struct CheckPending_t
+{
+    uint32_t nodeId;
+    uint32_t seq;
+    uint32_t doneTime;
+} CheckPending;
+
+/**************************************************************************
+ ************************** Global Variables ******************************
+ **************************************************************************/
+
+static DPC_Graph_Obj gCheckGraph;
+static uint32_t gCheckTime;
+static CheckPending gCheckPending[CHECK_MAX_PENDING];
+static uint32_t gCheckNumPending;
+static char gCheckLog[CHECK_LOG_LEN];
+static uint32_t gCheckFailed;
+
+/**************************************************************************
+ ************************** Mock platform *********************************
+ **************************************************************************/
+
+static uint32_t Check_getTime(void)
+{
+    return gCheckTime;
+}
+
+/* Completes the pending runs due by the given time, in completion order, as the mailbox interrupt would */
+static void Check_completeUntil(uint32_t time)
+{
+    uint32_t i, first;
+
+    while (gCheckNumPending > 0U)
+    {
+        first = 0;
+        for (i = 1; i < gCheckNumPending; i++)
+        {
+            if (gCheckPending[i].doneTime < gCheckPending[first].doneTime)
+            {
+                first = i;
+            }
+        }
+        if (gCheckPending[first].doneTime > time)
+        {
+            break;
+        }
+        if (gCheckPending[first].doneTime > gCheckTime)
+        {
+            gCheckTime = gCheckPending[first].doneTime;
+        }
+        DPC_Graph_nodeDone(&gCheckGraph, gCheckPending[first].nodeId, gCheckPending[first].seq);
+        gCheckPending[first] = gCheckPending[--gCheckNumPending];
+    }
+}
+
+/* Blocks until the next completion: the clock jumps to it */
+static void Check_waitEvent(void *arg)
+{
+    uint32_t i, first = 0;
+
+    (void) arg;
+    if (gCheckNumPending == 0U)
+    {
+        printf("    FAIL: scheduler waits with no work in flight\n");
+        gCheckFailed++;
+        return;
+    }
+    for (i = 1; i < gCheckNumPending; i++)
+    {
+        if (gCheckPending[i].doneTime < gCheckPending[first].doneTime)
+        {
+            first = i;
+        }
+    }
+    Check_completeUntil(gCheckPending[first].doneTime);
+}
+
+/* Node function of the mock nodes */
+static int32_t Check_nodeFxn(void *arg)
+{
+    CheckNode *node = (CheckNode *) arg;
+
+    if (gCheckLog[0] != '\0')
+    {
+        strncat(gCheckLog, " ", CHECK_LOG_LEN - strlen(gCheckLog) - 1U);
+    }
+    strncat(gCheckLog, node->name, CHECK_LOG_LEN - strlen(gCheckLog) - 1U);
+    if (node->retVal != 0)
+    {
+        return node->retVal;
+    }
+
+    if (gCheckGraph.node[node->nodeId].type == DPC_GRAPH_NODE_SYNC)
+    {
+        gCheckTime += node->cost;
+    }
+    else if (gCheckNumPending < CHECK_MAX_PENDING)
+    {
+        /* Hand off the work with the tag of this run */
+        gCheckPending[gCheckNumPending].nodeId = node->nodeId;
+        gCheckPending[gCheckNumPending].seq = DPC_Graph_nodeSeq(&gCheckGraph, node->nodeId);
+        gCheckPending[gCheckNumPending].doneTime = gCheckTime + node->latency;
+        gCheckNumPending++;
+    }
+    return 0;
+}
+
+/**************************************************************************
+ ************************** Check helpers *********************************
+ **************************************************************************/
+
+static void Check_expect(bool cond, const char *what)
+{
+    if (!cond)
+    {
+        printf("    FAIL: %s\n", what);
+        gCheckFailed++;
+    }
+}
+
+static void Check_expectU32(uint32_t value, uint32_t expected, const char *what)
+{
+    if (value != expected)
+    {
+        printf("    FAIL: %s is %u, expected %u\n", what, value, expected);
+        gCheckFailed++;
+    }
+}
+
+static void Check_init(void)
+{
+    DPC_Graph_PlatformCfg platformCfg;
+
+    platformCfg.getTime = Check_getTime;
+    platformCfg.waitEvent = Check_waitEvent;
+    platformCfg.postEvent = NULL;
+    platformCfg.eventArg = NULL;
+
+    gCheckTime = 0;
+    gCheckNumPending = 0;
+    Check_expect(DPC_Graph_init(&gCheckGraph, &platformCfg) == 0, "DPC_Graph_init");
+}
+
+static void Check_addNode(CheckNode *node, uint32_t inBufMask, uint32_t outBufMask, uint8_t type)
+{
+    DPC_Graph_NodeCfg nodeCfg;
+    int32_t nodeId;
+
+    nodeCfg.name = node->name;
+    nodeCfg.fxn = Check_nodeFxn;
+    nodeCfg.arg = (void *) node;
+    nodeCfg.inBufMask = inBufMask;
+    nodeCfg.outBufMask = outBufMask;
+    nodeCfg.type = type;
+    nodeId = DPC_Graph_addNode(&gCheckGraph, &nodeCfg);
+    Check_expect(nodeId >= 0, "DPC_Graph_addNode");
+    node->nodeId = (uint32_t) nodeId;
+}
+
+/* Runs one frame starting at the given time and checks the execution order and the frame length */
+static void Check_runFrame(uint32_t startTime, const char *expectedLog, uint32_t expectedLength)
+{
+    char what[64];
+
+    Check_completeUntil(startTime);
+    gCheckTime = startTime;
+    gCheckLog[0] = '\0';
+    Check_expect(DPC_Graph_run(&gCheckGraph) == 0, "DPC_Graph_run");
+    if (strcmp(gCheckLog, expectedLog) != 0)
+    {
+        printf("    FAIL: frame %u ran \"%s\", expected \"%s\"\n", gCheckGraph.frameCount, gCheckLog, expectedLog);
+        gCheckFailed++;
+    }
+    snprintf(what, sizeof(what), "frame %u length", gCheckGraph.frameCount);
+    Check_expectU32(gCheckGraph.frameEndTime - gCheckGraph.frameStartTime, expectedLength, what);
+}
+
+/**************************************************************************
+ ************************** Checks ****************************************
+ **************************************************************************/
+
+/* Intrusion detection, nextFrame after inDetect or, pipelined, right after snr3d and rangeProfile */
+static void Check_intrusionDetection(bool pipelined)
+{
+    static CheckNode rangeProc    = {"rangeProc", 100, 0, 0, 0};
+    static CheckNode doa3d        = {"doa3d", 300, 0, 0, 0};
+    static CheckNode snr3d        = {"snr3d", 200, 0, 0, 0};
+    static CheckNode rangeProfile = {"rangeProfile", 20, 0, 0, 0};
+    static CheckNode inDetect     = {"inDetect", 500, 0, 0, 0};
+    static CheckNode nextFrame    = {"nextFrame", 5, 0, 0, 0};
+    uint32_t frame;
+
+    printf("Intrusion detection%s\n", pipelined ? ", pipelined" : "");
+    Check_init();
+    Check_addNode(&rangeProc, 0, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&doa3d, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_BUF(CHECK_BUF_DET_MATRIX), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&snr3d, DPC_GRAPH_BUF(CHECK_BUF_DET_MATRIX), DPC_GRAPH_BUF(CHECK_BUF_SNR_MATRIX), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&rangeProfile, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_BUF(CHECK_BUF_RANGE_PROFILE),
+                  DPC_GRAPH_NODE_SYNC);
+    if (pipelined)
+    {
+        Check_addNode(&nextFrame, DPC_GRAPH_BUF(CHECK_BUF_SNR_MATRIX) | DPC_GRAPH_BUF(CHECK_BUF_RANGE_PROFILE),
+                      DPC_GRAPH_BUF(CHECK_BUF_NEXT_FRAME), DPC_GRAPH_NODE_SYNC);
+        Check_addNode(&inDetect, DPC_GRAPH_BUF(CHECK_BUF_SNR_MATRIX), DPC_GRAPH_BUF(CHECK_BUF_INTRUSION_RESULT),
+                      DPC_GRAPH_NODE_SYNC);
+    }
+    else
+    {
+        Check_addNode(&inDetect, DPC_GRAPH_BUF(CHECK_BUF_SNR_MATRIX), DPC_GRAPH_BUF(CHECK_BUF_INTRUSION_RESULT),
+                      DPC_GRAPH_NODE_SYNC);
+        Check_addNode(&nextFrame, DPC_GRAPH_BUF(CHECK_BUF_INTRUSION_RESULT) | DPC_GRAPH_BUF(CHECK_BUF_RANGE_PROFILE),
+                      DPC_GRAPH_BUF(CHECK_BUF_NEXT_FRAME), DPC_GRAPH_NODE_SYNC);
+    }
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == 0, "DPC_Graph_validate");
+
+    for (frame = 0; frame < 3U; frame++)
+    {
+        if (pipelined)
+        {
+            Check_runFrame(frame * 2000U, "rangeProc doa3d snr3d rangeProfile nextFrame inDetect", 1125);
+            /* The next frame is triggered before the intrusion detection */
+            Check_expectU32(gCheckGraph.stamp[nextFrame.nodeId].endTime - gCheckGraph.frameStartTime, 625,
+                            "nextFrame end");
+        }
+        else
+        {
+            Check_runFrame(frame * 2000U, "rangeProc doa3d snr3d rangeProfile inDetect nextFrame", 1125);
+            Check_expectU32(gCheckGraph.stamp[nextFrame.nodeId].endTime - gCheckGraph.frameStartTime, 1125,
+                            "nextFrame end");
+        }
+        /* rangeProfile was ready after rangeProc, it waited for doa3d and snr3d that were added first */
+        Check_expectU32(gCheckGraph.stamp[rangeProfile.nodeId].readyTime - gCheckGraph.frameStartTime, 100,
+                        "rangeProfile ready");
+        Check_expectU32(gCheckGraph.stamp[rangeProfile.nodeId].startTime - gCheckGraph.frameStartTime, 600,
+                        "rangeProfile start");
+    }
+}
+
+/* SBR/CPD: the detached DSP node runs concurrently with the macro-Doppler DPU, the frame does not wait for it */
+static void Check_sbrCpd(void)
+{
+    static CheckNode rangeProc    = {"rangeProc", 100, 0, 0, 0};
+    static CheckNode dsp          = {"dsp", 0, 1500, 0, 0};
+    static CheckNode macroDoppler = {"macroDoppler", 400, 0, 0, 0};
+    static CheckNode classifier   = {"classifier", 50, 0, 0, 0};
+    static CheckNode nextFrame    = {"nextFrame", 5, 0, 0, 0};
+    const char *order = "rangeProc dsp macroDoppler classifier nextFrame";
+
+    printf("SBR/CPD, detached DSP node\n");
+    Check_init();
+    Check_addNode(&rangeProc, 0, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&dsp, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_BUF(CHECK_BUF_POINT_CLOUD),
+                  DPC_GRAPH_NODE_DETACHED);
+    Check_addNode(&macroDoppler, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_BUF(CHECK_BUF_MACRO_DOPPLER_MAP),
+                  DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&classifier, DPC_GRAPH_BUF(CHECK_BUF_MACRO_DOPPLER_MAP), DPC_GRAPH_BUF(CHECK_BUF_CLASSIFIER_INPUT),
+                  DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&nextFrame, DPC_GRAPH_BUF(CHECK_BUF_CLASSIFIER_INPUT), DPC_GRAPH_BUF(CHECK_BUF_NEXT_FRAME),
+                  DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == 0, "DPC_Graph_validate");
+
+    /* Frame 1: the DSP completes at 1600, within the 2000 frame period */
+    Check_runFrame(0, order, 555);
+    Check_completeUntil(2000);
+    Check_expectU32(gCheckGraph.stamp[dsp.nodeId].endTime, 1600, "frame 1 dsp end");
+    Check_expectU32(gCheckGraph.overrunCount[dsp.nodeId], 0, "overrun count");
+
+    /* Frame 2: the DSP takes 2500, the run is still in flight when frame 3 starts */
+    dsp.latency = 2500;
+    Check_runFrame(2000, order, 555);
+    dsp.latency = 1500;
+    Check_runFrame(4000, order, 555);
+    Check_expectU32(gCheckGraph.overrunCount[dsp.nodeId], 1, "overrun count after frame 3");
+
+    /* The completion of the dropped frame 2 run arrives at 4600, before the one of frame 3 at 5600 */
+    Check_completeUntil(5000);
+    Check_expectU32(gCheckGraph.lateCount[dsp.nodeId], 1, "late completions");
+    Check_expect(gCheckGraph.doneSeq[dsp.nodeId] != gCheckGraph.runSeq[dsp.nodeId],
+                 "late completion taken for the frame 3 run");
+    Check_completeUntil(6000);
+    Check_expect(gCheckGraph.doneSeq[dsp.nodeId] == gCheckGraph.runSeq[dsp.nodeId], "frame 3 run completed");
+    Check_expectU32(gCheckGraph.stamp[dsp.nodeId].endTime, 5600, "frame 3 dsp end");
+
+    /* Frame 4 starts with no run in flight */
+    Check_runFrame(6000, order, 555);
+    Check_expectU32(gCheckGraph.overrunCount[dsp.nodeId], 1, "overrun count after frame 4");
+    Check_completeUntil(8000);
+    Check_expectU32(gCheckGraph.stamp[dsp.nodeId].endTime, 7600, "frame 4 dsp end");
+    Check_expectU32(gCheckGraph.lateCount[dsp.nodeId], 1, "late completions after frame 4");
+}
+
+/* Asynchronous node: the frame waits for it, and its outputs are valid at its completion time */
+static void Check_async(void)
+{
+    static CheckNode rangeProc = {"rangeProc", 100, 0, 0, 0};
+    static CheckNode dsp       = {"dsp", 0, 800, 0, 0};
+    static CheckNode local     = {"local", 300, 0, 0, 0};
+    static CheckNode merge     = {"merge", 10, 0, 0, 0};
+
+    printf("Asynchronous node\n");
+    Check_init();
+    Check_addNode(&rangeProc, 0, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&local, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_BUF(CHECK_BUF_DET_MATRIX), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&dsp, DPC_GRAPH_BUF(CHECK_BUF_RADAR_CUBE), DPC_GRAPH_BUF(CHECK_BUF_POINT_CLOUD), DPC_GRAPH_NODE_ASYNC);
+    Check_addNode(&merge, DPC_GRAPH_BUF(CHECK_BUF_DET_MATRIX) | DPC_GRAPH_BUF(CHECK_BUF_POINT_CLOUD),
+                  DPC_GRAPH_BUF(CHECK_BUF_NEXT_FRAME), DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == 0, "DPC_Graph_validate");
+
+    /* dsp is started before local, although added after it, and completes at 900 */
+    Check_runFrame(0, "rangeProc dsp local merge", 910);
+    Check_expectU32(gCheckGraph.stamp[dsp.nodeId].endTime, 900, "dsp end");
+    Check_expectU32(gCheckGraph.stamp[merge.nodeId].readyTime, 900, "merge ready");
+    Check_runFrame(2000, "rangeProc dsp local merge", 910);
+    Check_expectU32(gCheckGraph.overrunCount[dsp.nodeId] + gCheckGraph.lateCount[dsp.nodeId], 0, "overruns");
+}
+
+/* Validation errors and node errors */
+static void Check_errors(void)
+{
+    static CheckNode a = {"a", 10, 0, 0, 0};
+    static CheckNode b = {"b", 10, 0, 0, 0};
+    static CheckNode c = {"c", 10, 0, 0, 0};
+
+    printf("Errors\n");
+    Check_init();
+    Check_addNode(&a, 0, DPC_GRAPH_BUF(0), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&b, 0, DPC_GRAPH_BUF(0), DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == DPC_GRAPH_EMULTIPRODUCER, "two producers");
+    Check_expect(DPC_Graph_run(&gCheckGraph) == DPC_GRAPH_ENOTVALID, "run of an invalid graph");
+
+    Check_init();
+    Check_addNode(&a, DPC_GRAPH_BUF(1), DPC_GRAPH_BUF(0), DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == DPC_GRAPH_ENOPRODUCER, "input without producer");
+
+    Check_init();
+    Check_addNode(&a, DPC_GRAPH_BUF(1), DPC_GRAPH_BUF(0), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&b, DPC_GRAPH_BUF(0), DPC_GRAPH_BUF(1), DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == DPC_GRAPH_ECYCLE, "cycle");
+
+    Check_init();
+    Check_addNode(&a, 0, DPC_GRAPH_BUF(0), DPC_GRAPH_NODE_DETACHED);
+    Check_addNode(&b, DPC_GRAPH_BUF(0), DPC_GRAPH_BUF(1), DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == DPC_GRAPH_EDETACHED, "input from a detached node");
+
+    /* A failing node aborts the frame, the nodes after it do not run */
+    Check_init();
+    Check_addNode(&a, 0, DPC_GRAPH_BUF(0), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&b, DPC_GRAPH_BUF(0), DPC_GRAPH_BUF(1), DPC_GRAPH_NODE_SYNC);
+    Check_addNode(&c, DPC_GRAPH_BUF(1), DPC_GRAPH_BUF(2), DPC_GRAPH_NODE_SYNC);
+    Check_expect(DPC_Graph_validate(&gCheckGraph) == 0, "DPC_Graph_validate");
+    b.retVal = -10;
+    gCheckLog[0] = '\0';
+    Check_expect(DPC_Graph_run(&gCheckGraph) == -10, "error code of the failing node");
+    Check_expectU32(gCheckGraph.failedNodeId, b.nodeId, "failed node");
+    Check_expect(strcmp(gCheckLog, "a b") == 0, "nodes after the failing node not run");
+    b.retVal = 0;
+}
+
+int main(void)
+{
+    Check_intrusionDetection(false);
+    Check_intrusionDetection(true);
+    Check_sbrCpd();
+    Check_async();
+    Check_errors();
+
+    printf("%s: %u failed checks\n", (gCheckFailed == 0U) ? "PASS" : "FAIL", gCheckFailed);
+    return (gCheckFailed == 0U) ? 0 : 1;
+}
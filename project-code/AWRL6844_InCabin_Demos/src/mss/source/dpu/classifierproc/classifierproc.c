@@ -211,11 +211,12 @@ int32_t DPU_ClassifierProc_config
         {
             /* Configure 1D-CNN LPD (empty/occupied) classifier */
             memset(&cnnClassConfig, 0, sizeof(cnn_Classifier_moduleConfig));
-            cnnClassConfig.scratchBuffer = NULL;
-            cnnClassConfig.scratchBufferSizeInBytes = 0;
+            cnnClassConfig.scratchBuffer = pConfigIn->res.cnnScratch;
+            cnnClassConfig.scratchBufferSizeInBytes = pConfigIn->res.cnnScratchSizeInBytes;
             cnnClassConfig.num_frames = pConfigIn->staticCfg.multiFrmDopplerFftSize;
             cnnClassConfig.num_features = 1;
             cnnClassConfig.num_classes = DPU_CLASSIFIERPROC_CLASSIFIER_TWO_CLASSES;
+            cnnClassConfig.max_batch = obj->numOccupancyZones; /* All the zones in one batch */
 
             obj->lpd_cnn_EmptyOccClassifierHandle = cnn_classifier_create(&cnnClassConfig, &errCode);
             if (errCode < 0)
@@ -304,6 +305,7 @@ int32_t DPU_ClassifierProc_process
     int32_t zoneInd;
     float predictions[DPU_CLASSIFIERPROC_CLASSIFIER_TWO_CLASSES];
     float features[DPU_CLASSIFIERPROC_CLASSIFIER_MAX_NUM_FEATURES] = {0};
+    float cnnPredictions[FEXTRACT_MAX_OCCUPANCY_BOXES * DPU_CLASSIFIERPROC_CLASSIFIER_TWO_CLASSES];
     FEXTRACT_output *featOut = &outParams->featOut;
     classifierProcObj *obj = (classifierProcObj *) handle;
 
@@ -360,6 +362,35 @@ int32_t DPU_ClassifierProc_process
         /*** CPD Mode ***/
         if (featOut->featuresComputed)
         {
+            if (obj->config.staticCfg.cpdOption == DPU_CLASSIFIERPROC_CPD_MODE_LPD_USING_CNN)
+            {
+                /* Copy the features used by LPD 1D-CNN of all the zones: Macro-Doppler spectra */
+                uint32_t fftSize = obj->config.staticCfg.multiFrmDopplerFftSize;
+                for (zoneInd = 0; zoneInd < obj->numOccupancyZones; zoneInd++)
+                {
+                    uint32_t *spectrumArray = &multiFrameDopplerFft[zoneInd * fftSize];
+                    float    *featureMultiFrmDoppler = &obj->config.res.featureMultiFrmDoppler[zoneInd * fftSize];
+                    float    scale = obj->config.staticCfg.cnnInputScale[zoneInd];
+                    for (uint32_t i = 0; i < fftSize; i++)
+                    {
+                        featureMultiFrmDoppler[i] = scale * (float) spectrumArray[i];
+                    }
+                }
+
+                /* Classify: Empty/Occupied using 1D-CNN, all the zones in one batch */
+#ifdef CNN_CLASSIFIER_OPEN
+                cnn_classifier_predict_batch(obj->lpd_cnn_EmptyOccClassifierHandle, obj->config.res.featureMultiFrmDoppler,
+                                             obj->numOccupancyZones, cnnPredictions);
+#else
+                /* Prebuilt alg_cnnClassifier library, the shipped configuration: it has no batch entry point */
+                for (zoneInd = 0; zoneInd < obj->numOccupancyZones; zoneInd++)
+                {
+                    cnn_classifier_predict(obj->lpd_cnn_EmptyOccClassifierHandle, &obj->config.res.featureMultiFrmDoppler[zoneInd * fftSize],
+                                           &cnnPredictions[zoneInd * DPU_CLASSIFIERPROC_CLASSIFIER_TWO_CLASSES]);
+                }
+#endif
+            }
+
             for (zoneInd = 0; zoneInd < obj->numOccupancyZones; zoneInd++)
             {
                 if (obj->config.staticCfg.cpdOption == DPU_CLASSIFIERPROC_CPD_MODE_LPD_USING_ANN)
@@ -389,17 +420,8 @@ int32_t DPU_ClassifierProc_process
                 }
                 else if (obj->config.staticCfg.cpdOption == DPU_CLASSIFIERPROC_CPD_MODE_LPD_USING_CNN)
                 {
-                    /* Copy the features used by LPD 1D-CNN: Macro-Doppler spectrum */
-                    uint32_t *spectrumArray = &multiFrameDopplerFft[zoneInd * obj->config.staticCfg.multiFrmDopplerFftSize];
-                    float    *featureMultiFrmDoppler = obj->config.res.featureMultiFrmDoppler;
-                    for (int32_t i = 0; i < obj->config.staticCfg.multiFrmDopplerFftSize; i++)
-                    {
-                        featureMultiFrmDoppler[i] = obj->config.staticCfg.cnnInputScale[zoneInd] * (float) spectrumArray[i];
-                    }
-
-                    /* Classify: Empty/Occupied using 1D-CNN */
-                    cnn_classifier_predict(obj->lpd_cnn_EmptyOccClassifierHandle, featureMultiFrmDoppler, predictions);
-                    outParams->zonesPredictions[zoneInd * DPU_CLASSIFIERPROC_CLASSIFIER_THREE_CLASSES + 0] = predictions[0];
+                    /* Empty/Occupied from the 1D-CNN batch above */
+                    outParams->zonesPredictions[zoneInd * DPU_CLASSIFIERPROC_CLASSIFIER_THREE_CLASSES + 0] = cnnPredictions[zoneInd * DPU_CLASSIFIERPROC_CLASSIFIER_TWO_CLASSES];
                 }
                 else
                 {
@@ -191,7 +191,16 @@ typedef struct DPU_ClassifierProc_Resources_t
      *              sized to @ref detObjOutMaxSize elements,
      *              must be aligned to @ref DPU_CLASSIFIERPROC_POINT_CLOUD_SIDE_INFO_BYTE_ALIGNMENT */
 
+    /*! @brief      1D-CNN input, Macro-Doppler spectra of all the zones, [numOccupancyBoxes][multiFrmDopplerFftSize] */
     float   *featureMultiFrmDoppler;
+
+    /*! @brief      1D-CNN scratch memory for a batch of numOccupancyBoxes inputs, NULL for internal allocation.
+     *              Used with the open classifier implementation (CNN_CLASSIFIER_OPEN) only. The prebuilt library of the
+     *              shipped build is not batched, and gets NULL: it allocates its own scratch */
+    float   *cnnScratch;
+
+    /*! @brief      Size of @ref cnnScratch in bytes */
+    uint32_t cnnScratchSizeInBytes;
 } DPU_ClassifierProc_HW_Resources;
 
 /**
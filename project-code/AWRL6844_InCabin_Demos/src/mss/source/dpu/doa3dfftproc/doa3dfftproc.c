@@ -1091,6 +1091,132 @@ exit:
     return(retVal);
 } 
 
+/**
+ *  @b Description
+ *  @n
+ *  Updates the address and C count of the EDMA channel and of its shadow (reload) param set.
+ *
+ *  @param[in] baseAddr   - EDMA base address
+ *  @param[in] chanCfg    - EDMA channel configuration
+ *  @param[in] isSrc      - true: update the source address, false: update the destination address
+ *  @param[in] address    - New source/destination address
+ *  @param[in] cCnt       - New C count
+ *
+ *  \ingroup    DPU_DOA_INTERNAL_FUNCTION
+ */
+static void doa3dProc_setEdmaRangeGate
+(
+    uint32_t        baseAddr,
+    DPEDMA_ChanCfg  *chanCfg,
+    bool            isSrc,
+    uint32_t        address,
+    uint16_t        cCnt
+)
+{
+    EDMACCPaRAMEntry paramSet;
+    uint32_t paramId[2];
+    uint32_t i;
+
+    paramId[0] = chanCfg->channel;
+    paramId[1] = chanCfg->shadowPramId;
+
+    for (i = 0; i < 2; i++)
+    {
+        /* Keep the link address, it differs between the physical and the shadow param set */
+        EDMAGetPaRAM(baseAddr, paramId[i], &paramSet);
+        if (isSrc)
+        {
+            paramSet.srcAddr = address;
+        }
+        else
+        {
+            paramSet.destAddr = address;
+        }
+        paramSet.cCnt = cCnt;
+        EDMASetPaRAM(baseAddr, paramId[i], &paramSet);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *  Saves the EDMA addresses and per range bin increments of the range loop, as programmed by
+ *  doa3dProc_configEdma. The range gate spans are programmed relative to these values.
+ *
+ *  @param[in] obj    - DPU obj
+ *
+ *  \ingroup    DPU_DOA_INTERNAL_FUNCTION
+ */
+static void doa3dProc_saveRangeGateEdmaBase
+(
+    DPU_Doa3dProc_Obj      *obj
+)
+{
+    EDMACCPaRAMEntry paramSet;
+    uint32_t baseAddr = EDMA_getBaseAddr(obj->edmaHandle);
+    uint32_t chunkIdx;
+
+    /* The two input chunks have their own start address and range step (see gDbgStartRngBin) */
+    for (chunkIdx = 0; chunkIdx < 2; chunkIdx++)
+    {
+        EDMAGetPaRAM(baseAddr, obj->edmaIn.chunk[chunkIdx].channel, &paramSet);
+        obj->rangeGateRadarCubeAddr[chunkIdx] = paramSet.srcAddr;
+        obj->rangeGateRadarCubeStride[chunkIdx] = (uint32_t) paramSet.srcCIdx;
+    }
+
+    EDMAGetPaRAM(baseAddr, obj->edmaDetMatOut.channel, &paramSet);
+    obj->rangeGateDetMatAddr = paramSet.destAddr;
+    obj->rangeGateDetMatStride = (uint32_t) paramSet.destCIdx;
+
+    if (obj->isDopIndMatOutEnabled)
+    {
+        EDMAGetPaRAM(baseAddr, obj->dopIndMatOut.channel, &paramSet);
+        obj->rangeGateDopIndMatAddr = paramSet.destAddr;
+        obj->rangeGateDopIndMatStride = (uint32_t) paramSet.destCIdx;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *  Programs the EDMA range loop for one range gate span. The HWA param sets do not depend on the
+ *  range bin, only the EDMA input/output addresses and the number of range iterations change.
+ *
+ *  @param[in] obj    - DPU obj
+ *  @param[in] span   - Range gate span
+ *
+ *  \ingroup    DPU_DOA_INTERNAL_FUNCTION
+ */
+static void doa3dProc_configRangeGateSpan
+(
+    DPU_Doa3dProc_Obj           *obj,
+    DPU_Doa3dProc_RangeGateSpan *span
+)
+{
+    uint32_t baseAddr = EDMA_getBaseAddr(obj->edmaHandle);
+    uint32_t rngBin = span->startRangeBin;
+    uint16_t numRngBins = span->numRangeBins;
+    uint32_t chunkIdx;
+
+    for (chunkIdx = 0; chunkIdx < 2; chunkIdx++)
+    {
+        doa3dProc_setEdmaRangeGate(baseAddr, &obj->edmaIn.chunk[chunkIdx], true,
+                                   obj->rangeGateRadarCubeAddr[chunkIdx] + rngBin * obj->rangeGateRadarCubeStride[chunkIdx],
+                                   numRngBins);
+    }
+    doa3dProc_setEdmaRangeGate(baseAddr, &obj->edmaDetMatOut, false,
+                               obj->rangeGateDetMatAddr + rngBin * obj->rangeGateDetMatStride,
+                               numRngBins);
+    if (obj->isDopIndMatOutEnabled)
+    {
+        doa3dProc_setEdmaRangeGate(baseAddr, &obj->dopIndMatOut, false,
+                                   obj->rangeGateDopIndMatAddr + rngBin * obj->rangeGateDopIndMatStride,
+                                   numRngBins);
+    }
+
+    obj->hwaNumLoops = numRngBins;
+}
+
 /*===========================================================
  *                    Doppler Proc External APIs
  *===========================================================*/
@@ -1329,12 +1455,39 @@ int32_t DPU_Doa3dProc_config
     }
 #endif
 
+    /* Range gate spans must be sorted, non-overlapping and within the range bins */
+    {
+        DPU_Doa3dProc_RangeGateCfg *rangeGateCfg = &cfg->staticCfg.rangeGateCfg;
+        uint32_t spanIdx;
+        uint32_t nextRngBin = 0;
+
+        if (rangeGateCfg->numSpans > DPU_DOA3DPROC_MAX_NUM_RANGE_GATE_SPANS)
+        {
+            retVal = DPU_DOA3DPROC_ERANGEGATE;
+            goto exit;
+        }
+        for (spanIdx = 0; spanIdx < rangeGateCfg->numSpans; spanIdx++)
+        {
+            if ((rangeGateCfg->span[spanIdx].numRangeBins == 0) ||
+                (rangeGateCfg->span[spanIdx].startRangeBin < nextRngBin) ||
+                ((rangeGateCfg->span[spanIdx].startRangeBin + rangeGateCfg->span[spanIdx].numRangeBins) > cfg->staticCfg.numRangeBins))
+            {
+                retVal = DPU_DOA3DPROC_ERANGEGATE;
+                goto exit;
+            }
+            nextRngBin = rangeGateCfg->span[spanIdx].startRangeBin + rangeGateCfg->span[spanIdx].numRangeBins;
+        }
+    }
+
     /* Save necessary parameters to DPU object that will be used during Process time */
     /* EDMA parameters needed to trigger first EDMA transfer*/
     obj->edmaHandle  = cfg->hwRes.edmaCfg.edmaHandle;
     memcpy((void*)(&obj->edmaIn), (void *)(&cfg->hwRes.edmaCfg.edmaIn), sizeof(DPU_Doa3dProc_Edma));
     memcpy((void*)(&obj->edmaDetMatOut), (void *)(&cfg->hwRes.edmaCfg.edmaDetMatOut), sizeof(DPEDMA_ChanCfg));
     memcpy((void*)(&obj->edmaInterLoopIn), (void *)(&cfg->hwRes.edmaCfg.edmaInterLoopIn), sizeof(DPEDMA_ChanCfg));
+    memcpy((void*)(&obj->dopIndMatOut), (void *)(&cfg->hwRes.edmaCfg.dopIndMatOut), sizeof(DPEDMA_ChanCfg));
+    obj->isDopIndMatOutEnabled = (cfg->staticCfg.selectCoherentPeakInDopplerDim == 2);
+    obj->rangeGateCfg = cfg->staticCfg.rangeGateCfg; //Copy structure
     
     /*HWA parameters needed for the HWA common configuration*/
     obj->hwaNumLoops      = cfg->staticCfg.numRangeBins;
@@ -1397,6 +1550,18 @@ int32_t DPU_Doa3dProc_config
         goto exit;
     }
 
+    if (obj->rangeGateCfg.numSpans > 0)
+    {
+        doa3dProc_saveRangeGateEdmaBase(obj);
+
+        /* Range bins outside the spans are not written by the DPU */
+        memset(cfg->hwRes.detMatrix.data, 0, cfg->hwRes.detMatrix.dataSize);
+        if (obj->isDopIndMatOutEnabled)
+        {
+            memset(cfg->hwRes.dopplerIndexMatrix.data, 0, cfg->hwRes.dopplerIndexMatrix.dataSize);
+        }
+    }
+
 exit:
     return retVal;
 }
@@ -1472,8 +1637,30 @@ int32_t DPU_Doa3dProc_process
     }
 
 
-    /*HWA controlled loop, HWA Internal per range processing loop */
-    doa3dProc_InternalLoop(obj, outParams);
+    if (obj->rangeGateCfg.numSpans == 0)
+    {
+        /*HWA controlled loop, HWA Internal per range processing loop */
+        retVal = doa3dProc_InternalLoop(obj, outParams);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+    else
+    {
+        uint32_t spanIdx;
+
+        /* Range gating: run the HWA range loop over each span */
+        for (spanIdx = 0; spanIdx < obj->rangeGateCfg.numSpans; spanIdx++)
+        {
+            doa3dProc_configRangeGateSpan(obj, &obj->rangeGateCfg.span[spanIdx]);
+            retVal = doa3dProc_InternalLoop(obj, outParams);
+            if (retVal != 0)
+            {
+                goto exit;
+            }
+        }
+    }
     
     outParams->stats.numProcess++;
     //outParams->stats.processingTime = Cycleprofiler_getTimeStamp() - startTime;
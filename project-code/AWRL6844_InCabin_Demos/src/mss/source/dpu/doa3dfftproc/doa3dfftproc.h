@@ -184,6 +184,11 @@ extern "C" {
  */
 #define DPU_DOA3DPROC_E_EXCEEDED_MAX_NUM_DOPPLER_BINS (DP_ERRNO_DOA3D_PROC_BASE-14)
 
+/**
+ * @brief   Error Code: Invalid range gate configuration. Spans must be non-empty, sorted, non-overlapping and within the range bins.
+ */
+#define DPU_DOA3DPROC_ERANGEGATE              (DP_ERRNO_DOA3D_PROC_BASE-15)
+
 
 /**
  * @brief   Maximum number of HWA param sets used by DPU.
@@ -195,6 +200,11 @@ extern "C" {
  */
 #define DPU_DOA3DPROC_NUM_HWA_MEMBANKS  4 
 
+/**
+ * @brief   Maximum number of range gate spans
+ */
+#define DPU_DOA3DPROC_MAX_NUM_RANGE_GATE_SPANS  16
+
 /**
  * @brief   Disables first butterfly stage scaling
  */
@@ -541,6 +551,43 @@ typedef struct DPU_Doa3dProc_compRxChannelBiasCfg_t
 
 } DPU_Doa3dProc_compRxChannelBiasCfg;
 
+/**
+ * @brief
+ *  Range gate span, run of consecutive range bins processed by the DPU
+ *
+ *  \ingroup    DPU_DOA3DPROC_EXTERNAL_DATA_STRUCTURE
+ *
+ */
+typedef struct DPU_Doa3dProc_RangeGateSpan_t
+{
+    /*! @brief  First range bin of the span */
+    uint16_t startRangeBin;
+
+    /*! @brief  Number of range bins in the span */
+    uint16_t numRangeBins;
+} DPU_Doa3dProc_RangeGateSpan;
+
+/**
+ * @brief
+ *  Range gate configuration
+ *
+ * @details
+ *  When numSpans is zero the DPU processes all range bins. Otherwise it processes only the range bins
+ *  of the listed spans, the rows of the detection and Doppler index matrices outside the spans are set
+ *  to zero at configuration time and are not written by the DPU.
+ *
+ *  \ingroup    DPU_DOA3DPROC_EXTERNAL_DATA_STRUCTURE
+ *
+ */
+typedef struct DPU_Doa3dProc_RangeGateCfg_t
+{
+    /*! @brief  Number of spans, 0 - range gating disabled */
+    uint8_t numSpans;
+
+    /*! @brief  Spans sorted by startRangeBin, non-overlapping */
+    DPU_Doa3dProc_RangeGateSpan span[DPU_DOA3DPROC_MAX_NUM_RANGE_GATE_SPANS];
+} DPU_Doa3dProc_RangeGateCfg;
+
 /**
  * @brief
  *  Doppler DPU static configuration parameters
@@ -611,6 +658,9 @@ typedef struct DPU_Doa3dProc_StaticConfig_t
     /*! @brief     Load HWA params sets before execution */
     bool loadHwaParamSetsBeforeExec;
 
+    /*! @brief     Range gate configuration */
+    DPU_Doa3dProc_RangeGateCfg rangeGateCfg;
+
 }DPU_Doa3dProc_StaticConfig;
 
 /**
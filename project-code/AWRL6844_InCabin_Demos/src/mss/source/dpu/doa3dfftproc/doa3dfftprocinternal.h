@@ -170,6 +170,33 @@ typedef struct DPU_Doa3dProc_Obj_t
     /*! @brief     Load HWA params sets before execution */
     bool loadHwaParamSetsBeforeExec;
 
+    /*! @brief  EDMA configuration for data output from HWA - Doppler Index matrix */
+    DPEDMA_ChanCfg dopIndMatOut;
+
+    /*! @brief  Doppler index matrix output enabled */
+    bool isDopIndMatOutEnabled;
+
+    /*! @brief  Range gate configuration */
+    DPU_Doa3dProc_RangeGateCfg rangeGateCfg;
+
+    /*! @brief  Range gating - radar cube source address of range bin 0 per input chunk, as programmed in EDMA */
+    uint32_t rangeGateRadarCubeAddr[2];
+
+    /*! @brief  Range gating - detection matrix destination address of range bin 0, as programmed in EDMA */
+    uint32_t rangeGateDetMatAddr;
+
+    /*! @brief  Range gating - Doppler index matrix destination address of range bin 0, as programmed in EDMA */
+    uint32_t rangeGateDopIndMatAddr;
+
+    /*! @brief  Range gating - radar cube source increment per range bin in bytes, per input chunk */
+    uint32_t rangeGateRadarCubeStride[2];
+
+    /*! @brief  Range gating - detection matrix destination increment per range bin in bytes */
+    uint32_t rangeGateDetMatStride;
+
+    /*! @brief  Range gating - Doppler index matrix destination increment per range bin in bytes */
+    uint32_t rangeGateDopIndMatStride;
+
 }DPU_Doa3dProc_Obj;
 
 
@@ -0,0 +1,911 @@
+/**
+ *   @file  hwa_model.c
+ *
+ *   @brief
+ *      Software model of the HWA intrusion detection chain (doa3dfftproc + snr3dhmproc).
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "hwa_model.h"
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+/* 24-bit internal datapath */
+#define HWA_MODEL_INTERNAL_MAX          ((int32_t)((1 << 23) - 1))
+#define HWA_MODEL_INTERNAL_MIN          ((int32_t)(-(1 << 23)))
+#define HWA_MODEL_INTERNAL_UMAX         ((uint32_t)((1U << 24) - 1U))
+
+#define HWA_MODEL_TWIDDLE_QFORMAT       (20U)
+#define HWA_MODEL_CMULT_QFORMAT         (20U)
+#define HWA_MODEL_WINDOW_QFORMAT        (17U)
+#define HWA_MODEL_LOG2_QFORMAT          (11U)
+
+/* srcScale/dstScale programmed by the DPUs */
+#define HWA_MODEL_SRC_SCALE_16BIT       (8U)
+#define HWA_MODEL_DST_SCALE_16BIT       (0U)
+
+/* Maximum number of Doppler FFTs per range bin (antenna array positions) */
+#define HWA_MODEL_MAX_DOP_POSITIONS     (64U)
+
+#define HWA_MODEL_ALIGN(x)              (((x) + 7U) & ~7U)
+
+/* Number of log2 steps per octave */
+#define HWA_MODEL_LOG2_NUM_STEPS        (1U << HWA_MODEL_LOG2_QFORMAT)
+
+/* Table of HwaModel_log2Q11 */
+typedef struct HwaModel_Log2Table_t
+{
+    uint32_t thr[HWA_MODEL_LOG2_NUM_STEPS + 3U];    /* Mantissa thresholds of the Q11 steps */
+    uint16_t start[HWA_MODEL_LOG2_NUM_STEPS];       /* Step at the start of each 2^-11 mantissa interval */
+} HwaModel_Log2Table;
+
+/* Doppler FFT input/output mapping of one antenna array position */
+typedef struct HwaModel_DopPosition_t
+{
+    int16_t ant;        /* Virtual antenna, -1 for zero fill */
+    int16_t dst;        /* Output position in [row][doppler][col] */
+} HwaModel_DopPosition;
+
+/**************************************************************************
+ ************************ Internal Functions ******************************
+ **************************************************************************/
+
+static inline int32_t HwaModel_sat24(int64_t x)
+{
+    if (x > HWA_MODEL_INTERNAL_MAX)
+    {
+        return HWA_MODEL_INTERNAL_MAX;
+    }
+    if (x < HWA_MODEL_INTERNAL_MIN)
+    {
+        return HWA_MODEL_INTERNAL_MIN;
+    }
+    return (int32_t) x;
+}
+
+static inline uint32_t HwaModel_satU24(uint64_t x)
+{
+    return (x > HWA_MODEL_INTERNAL_UMAX) ? HWA_MODEL_INTERNAL_UMAX : (uint32_t) x;
+}
+
+static inline int16_t HwaModel_sat16(int32_t x)
+{
+    if (x > 32767)
+    {
+        return 32767;
+    }
+    if (x < -32768)
+    {
+        return -32768;
+    }
+    return (int16_t) x;
+}
+
+static inline int64_t HwaModel_roundShift(int64_t x, uint32_t shift)
+{
+    return (x + ((int64_t) 1 << (shift - 1U))) >> shift;
+}
+
+/* log2 of a power of 2, 0xFFFFFFFF otherwise */
+static uint32_t HwaModel_log2Pow2(uint32_t n)
+{
+    uint32_t log2n = 0;
+
+    if ((n == 0) || ((n & (n - 1U)) != 0))
+    {
+        return 0xFFFFFFFFU;
+    }
+    while ((1U << log2n) < n)
+    {
+        log2n++;
+    }
+    return log2n;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates the FFT twiddle table for HWA_MODEL_MAX_FFT_SIZE, exp(-j*2*pi*k/N), Q20
+ */
+static void HwaModel_genTwiddle(int32_t *twRe, int32_t *twIm)
+{
+    uint32_t k;
+    double phase;
+
+    for (k = 0; k < (HWA_MODEL_MAX_FFT_SIZE / 2U); k++)
+    {
+        phase = -2.0 * 3.14159265358979323846 * (double) k / (double) HWA_MODEL_MAX_FFT_SIZE;
+        twRe[k] = (int32_t) lround(cos(phase) * (double) (1 << HWA_MODEL_TWIDDLE_QFORMAT));
+        twIm[k] = (int32_t) lround(sin(phase) * (double) (1 << HWA_MODEL_TWIDDLE_QFORMAT));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Radix-2 butterflies of one (j, j + half) pair over all vectors of a block, scaled by 2^-shift
+ *      (shift 0 or 1, rounded). Kept in its own function so that the restrict-qualified rows let the
+ *      compiler vectorize the loop.
+ */
+static void HwaModel_butterflies(int32_t * restrict aRe, int32_t * restrict aIm,
+                                 int32_t * restrict bRe, int32_t * restrict bIm,
+                                 uint32_t batch, int32_t wr, int32_t wi, int32_t shift)
+{
+    uint32_t b;
+
+    /* Inputs are 24-bit, so sums and differences fit in int32 and only the twiddle products need 64 bits
+       (32 x 32 -> 64 multiplies, which vectorize) */
+    for (b = 0; b < batch; b++)
+    {
+        int32_t sRe = (aRe[b] + bRe[b] + shift) >> shift;
+        int32_t sIm = (aIm[b] + bIm[b] + shift) >> shift;
+        int32_t dRe = (aRe[b] - bRe[b] + shift) >> shift;
+        int32_t dIm = (aIm[b] - bIm[b] + shift) >> shift;
+        int64_t tRe = ((int64_t) dRe * wr - (int64_t) dIm * wi + ((int64_t) 1 << (HWA_MODEL_TWIDDLE_QFORMAT - 1U))) >> HWA_MODEL_TWIDDLE_QFORMAT;
+        int64_t tIm = ((int64_t) dRe * wi + (int64_t) dIm * wr + ((int64_t) 1 << (HWA_MODEL_TWIDDLE_QFORMAT - 1U))) >> HWA_MODEL_TWIDDLE_QFORMAT;
+
+        aRe[b] = HwaModel_sat24(sRe);
+        aIm[b] = HwaModel_sat24(sIm);
+        bRe[b] = HwaModel_sat24(tRe);
+        bIm[b] = HwaModel_sat24(tIm);
+    }
+}
+
+/* Butterflies with the twiddle 1: the rounded Q20 product is the difference itself */
+static void HwaModel_butterfliesW1(int32_t * restrict aRe, int32_t * restrict aIm,
+                                   int32_t * restrict bRe, int32_t * restrict bIm,
+                                   uint32_t batch, int32_t shift)
+{
+    uint32_t b;
+
+    for (b = 0; b < batch; b++)
+    {
+        int32_t sRe = (aRe[b] + bRe[b] + shift) >> shift;
+        int32_t sIm = (aIm[b] + bIm[b] + shift) >> shift;
+        int32_t dRe = (aRe[b] - bRe[b] + shift) >> shift;
+        int32_t dIm = (aIm[b] - bIm[b] + shift) >> shift;
+
+        aRe[b] = HwaModel_sat24(sRe);
+        aIm[b] = HwaModel_sat24(sIm);
+        bRe[b] = HwaModel_sat24(dRe);
+        bIm[b] = HwaModel_sat24(dIm);
+    }
+}
+
+/* Butterflies with the twiddle -j: the rounded Q20 product is (dIm, -dRe) */
+static void HwaModel_butterfliesWmj(int32_t * restrict aRe, int32_t * restrict aIm,
+                                    int32_t * restrict bRe, int32_t * restrict bIm,
+                                    uint32_t batch, int32_t shift)
+{
+    uint32_t b;
+
+    for (b = 0; b < batch; b++)
+    {
+        int32_t sRe = (aRe[b] + bRe[b] + shift) >> shift;
+        int32_t sIm = (aIm[b] + bIm[b] + shift) >> shift;
+        int32_t dRe = (aRe[b] - bRe[b] + shift) >> shift;
+        int32_t dIm = (aIm[b] - bIm[b] + shift) >> shift;
+
+        aRe[b] = HwaModel_sat24(sRe);
+        aIm[b] = HwaModel_sat24(sIm);
+        bRe[b] = HwaModel_sat24(dIm);
+        bIm[b] = HwaModel_sat24(-dRe);
+    }
+}
+
+/* Row of FFT output bin k in the bit-reversed output of HwaModel_fftBatch */
+static inline uint32_t HwaModel_bitRev(uint32_t k, uint32_t log2N)
+{
+    uint32_t rev = 0;
+    uint32_t bit;
+
+    for (bit = 0; bit < log2N; bit++)
+    {
+        rev |= ((k >> bit) & 1U) << (log2N - 1U - bit);
+    }
+    return rev;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      In-place radix-2 FFTs of a block of vectors stored as [sample][vector] (re and im planes).
+ *      Decimation in frequency. The output is left in bit-reversed order: the callers read bin k
+ *      from row HwaModel_bitRev(k, log2N), which saves a reordering pass over the block.
+ *      The inner loops run over the vectors.
+ *      Inputs past numNonZero are zero: while the nonzero samples fit in the first half of the
+ *      butterfly groups, the all-zero butterflies are skipped (their outputs stay zero).
+ *
+ *  @param[in,out]  re, im      Real and imaginary planes, N x batch
+ *  @param[in]      log2N       log2 of the FFT size
+ *  @param[in]      numNonZero  Number of leading nonzero samples
+ *  @param[in]      batch       Number of vectors
+ *  @param[in]      scaling     butterflyScaling, bit k scales stage k
+ *  @param[in]      twRe, twIm  Twiddle table from HwaModel_genTwiddle
+ */
+static void HwaModel_fftBatch(int32_t *re, int32_t *im, uint32_t log2N, uint32_t numNonZero,
+                              uint32_t batch, uint16_t scaling, const int32_t *twRe, const int32_t *twIm)
+{
+    uint32_t N = 1U << log2N;
+    uint32_t stage, half, grp, j, jEnd;
+    uint32_t twStep;
+
+    for (stage = 0; stage < log2N; stage++)
+    {
+        half = N >> (stage + 1U);
+        twStep = (HWA_MODEL_MAX_FFT_SIZE / N) << stage;
+        jEnd = (numNonZero < half) ? numNonZero : half;
+        if (numNonZero > half)
+        {
+            numNonZero = N;
+        }
+
+        for (grp = 0; grp < N; grp += 2U * half)
+        {
+            for (j = 0; j < jEnd; j++)
+            {
+                int32_t wr = twRe[j * twStep];
+                int32_t wi = twIm[j * twStep];
+                int32_t shift = (int32_t) ((scaling >> stage) & 1U);
+
+                /* The trivial twiddles (all of the last two stages) need no multiply */
+                if ((wr == (1 << HWA_MODEL_TWIDDLE_QFORMAT)) && (wi == 0))
+                {
+                    HwaModel_butterfliesW1(&re[(grp + j) * batch], &im[(grp + j) * batch],
+                                           &re[(grp + j + half) * batch], &im[(grp + j + half) * batch],
+                                           batch, shift);
+                }
+                else if ((wr == 0) && (wi == -(1 << HWA_MODEL_TWIDDLE_QFORMAT)))
+                {
+                    HwaModel_butterfliesWmj(&re[(grp + j) * batch], &im[(grp + j) * batch],
+                                            &re[(grp + j + half) * batch], &im[(grp + j + half) * batch],
+                                            batch, shift);
+                }
+                else
+                {
+                    HwaModel_butterflies(&re[(grp + j) * batch], &im[(grp + j) * batch],
+                                         &re[(grp + j + half) * batch], &im[(grp + j + half) * batch],
+                                         batch, wr, wi, shift);
+                }
+            }
+        }
+    }
+}
+
+/* Rounded magnitude, saturated to 24 bits. sqrt(p) is never halfway between integers, and the double
+   precision sqrt is accurate enough for p < 2^48 to round to the nearest integer */
+static inline uint32_t HwaModel_magnitude(int32_t re, int32_t im)
+{
+    double m = sqrt((double) re * re + (double) im * im) + 0.5;
+
+    /* Saturated before the conversion, through int32 so that the conversion vectorizes */
+    m = (m > (double) HWA_MODEL_INTERNAL_UMAX) ? (double) HWA_MODEL_INTERNAL_UMAX : m;
+    return (uint32_t) (int32_t) m;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Magnitude and Doppler SUM/MAX statistics of one elevation bin. The magnitudes are not stored:
+ *      each Doppler row is reduced into the per-azimuth accumulators as it is computed.
+ *
+ *  @param[in]  re, im      Elevation FFT output of the elevation bin, [doppler][az]
+ *  @param[in]  numDop      Number of Doppler bins
+ *  @param[in]  numAz       Number of azimuth bins
+ *  @param[out] sumAcc      Sum of the magnitudes per azimuth bin
+ *  @param[out] maxVal      Maximum magnitude per azimuth bin
+ *  @param[out] maxInd      Doppler index of the first maximum per azimuth bin
+ */
+static void HwaModel_dopplerStats(const int32_t * restrict re, const int32_t * restrict im,
+                                  uint32_t numDop, uint32_t numAz, uint64_t * restrict sumAcc,
+                                  uint32_t * restrict maxVal, uint32_t * restrict maxInd)
+{
+    uint32_t d, k;
+
+    for (k = 0; k < numAz; k++)
+    {
+        uint32_t m = HwaModel_magnitude(re[k], im[k]);
+
+        sumAcc[k] = m;
+        maxVal[k] = m;
+        maxInd[k] = 0;
+    }
+    for (d = 1; d < numDop; d++)
+    {
+        for (k = 0; k < numAz; k++)
+        {
+            uint32_t m = HwaModel_magnitude(re[d * numAz + k], im[d * numAz + k]);
+
+            sumAcc[k] += m;
+            maxInd[k] = (m > maxVal[k]) ? d : maxInd[k];
+            maxVal[k] = (m > maxVal[k]) ? m : maxVal[k];
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates the table of HwaModel_log2Q11. For x = 2^e * M / 2^23 with M in [2^23, 2^24),
+ *      round(log2(x) * 2^11) = (e << 11) + j, where j is the number of thresholds
+ *      thr[i] = ceil(2^23 * 2^((i - 0.5) / 2^11)), i = 1..2^11, that M reaches. start[] gives, for the
+ *      top 11 fractional bits of M, the j of the smallest such M; the next thresholds are at most two steps away.
+ */
+static void HwaModel_genLog2Table(HwaModel_Log2Table *table)
+{
+    uint32_t i, j = 0;
+
+    table->thr[0] = 1U << 23;
+    for (i = 1; i <= HWA_MODEL_LOG2_NUM_STEPS; i++)
+    {
+        table->thr[i] = (uint32_t) ceil(ldexp(exp2(((double) i - 0.5) / (double) HWA_MODEL_LOG2_NUM_STEPS), 23));
+    }
+    table->thr[HWA_MODEL_LOG2_NUM_STEPS + 1U] = 0xFFFFFFFFU;
+    table->thr[HWA_MODEL_LOG2_NUM_STEPS + 2U] = 0xFFFFFFFFU;
+
+    for (i = 0; i < HWA_MODEL_LOG2_NUM_STEPS; i++)
+    {
+        uint32_t mStart = (HWA_MODEL_LOG2_NUM_STEPS + i) << (23U - HWA_MODEL_LOG2_QFORMAT);
+
+        while (table->thr[j + 1U] <= mStart)
+        {
+            j++;
+        }
+        table->start[i] = (uint16_t) j;
+    }
+}
+
+/* Rounded log2 in Q11, log2(0) = 0. Exact for x < 2^24, which covers every input of the 24-bit datapath */
+static inline int32_t HwaModel_log2Q11(const HwaModel_Log2Table *table, uint32_t x)
+{
+    uint32_t e = 0, m, j;
+
+    if (x == 0)
+    {
+        return 0;
+    }
+    if (x > HWA_MODEL_INTERNAL_UMAX)
+    {
+        return (int32_t) lround(log2((double) x) * (double) (1 << HWA_MODEL_LOG2_QFORMAT));
+    }
+    m = x;
+    e += (m >= (1U << 16)) ? 16U : 0U;
+    m = x >> e;
+    e += (m >= (1U << 8)) ? 8U : 0U;
+    m = x >> e;
+    e += (m >= (1U << 4)) ? 4U : 0U;
+    m = x >> e;
+    e += (m >= (1U << 2)) ? 2U : 0U;
+    m = x >> e;
+    e += (m >= (1U << 1)) ? 1U : 0U;
+
+    m = x << (23U - e);
+    j = table->start[(m >> (23U - HWA_MODEL_LOG2_QFORMAT)) - HWA_MODEL_LOG2_NUM_STEPS];
+    j += (m >= table->thr[j + 1U]) ? 1U : 0U;
+    j += (m >= table->thr[j + 1U]) ? 1U : 0U;
+    return (int32_t) ((e << HWA_MODEL_LOG2_QFORMAT) + j);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      CFAR noise average (HWA_CFAR_OPER_MODE_MAG_INPUT_REAL) of one line of cells
+ *
+ *  @param[in]  x           Input cells, 32-bit, srcScale 0
+ *  @param[in]  xStride     Input cell increment
+ *  @param[in]  n           Number of cells
+ *  @param[in]  cfar        CFAR configuration
+ *  @param[out] noise       Noise average per cell
+ *  @param[in]  noiseStride Output increment
+ */
+static void HwaModel_cfarNoise(const uint32_t *x, uint32_t xStride, uint32_t n, const HwaModel_CfarCfg *cfar,
+                               uint32_t *noise, uint32_t noiseStride)
+{
+    int32_t h = cfar->winLen >> 1;
+    int32_t g = cfar->guardLen;
+    int32_t num = (int32_t) n;
+    int32_t i, k, ind;
+    uint64_t sumL, sumR, nAvg;
+    bool validL, validR;
+
+    for (i = 0; i < num; i++)
+    {
+        sumL = 0;
+        sumR = 0;
+        if (cfar->cyclicMode)
+        {
+            validL = true;
+            validR = true;
+        }
+        else
+        {
+            validL = (i - g - h) >= 0;
+            validR = (i + g + h) < num;
+        }
+        for (k = 1; k <= h; k++)
+        {
+            if (validL)
+            {
+                ind = ((i - g - k) % num + num) % num;
+                sumL += HwaModel_satU24(x[ind * xStride]);
+            }
+            if (validR)
+            {
+                ind = (i + g + k) % num;
+                sumR += HwaModel_satU24(x[ind * xStride]);
+            }
+        }
+
+        if (validL && validR)
+        {
+            if (cfar->averageMode == HWA_MODEL_CFAR_CAGO)
+            {
+                nAvg = (sumL > sumR) ? sumL : sumR;
+            }
+            else if (cfar->averageMode == HWA_MODEL_CFAR_CASO)
+            {
+                nAvg = (sumL < sumR) ? sumL : sumR;
+            }
+            else
+            {
+                nAvg = sumL + sumR;
+            }
+        }
+        else
+        {
+            nAvg = validL ? sumL : sumR;
+            if (cfar->averageMode == HWA_MODEL_CFAR_CA)
+            {
+                nAvg *= 2U;
+            }
+        }
+        noise[i * noiseStride] = HwaModel_satU24(nAvg >> cfar->noiseDivShift);
+    }
+}
+
+/**************************************************************************
+ ************************ External Functions ******************************
+ **************************************************************************/
+
+uint16_t HwaModel_doa3dButterflyScaling(uint16_t numDopplerBins, uint8_t firstStageScaling)
+{
+    uint32_t log2N = HwaModel_log2Pow2(numDopplerBins);
+    uint16_t allStages;
+
+    if (log2N == 0xFFFFFFFFU)
+    {
+        return 0;
+    }
+    allStages = (uint16_t) ((1U << log2N) - 1U);
+
+    if (firstStageScaling == HWA_MODEL_FIRST_SCALING_ENABLED)
+    {
+        return allStages;
+    }
+    else if (firstStageScaling == HWA_MODEL_FIRST_SCALING_DISABLED)
+    {
+        return allStages & ~1U;
+    }
+    else
+    {
+        return (uint16_t) ((numDopplerBins - 1U) >> 5);
+    }
+}
+
+/* Scratch layout of HwaModel_doa3dProcess, in int32 words */
+static uint32_t HwaModel_doa3dScratchWords(const HwaModel_Doa3dConfig *cfg, uint32_t numPos)
+{
+    uint32_t numVirtAnt = cfg->numTxAntennas * cfg->numRxAntennas;
+    uint32_t numOutDop = cfg->numDopplerBins - (cfg->isStaticClutterRemovalEnabled ? 1U : 0U);
+    uint32_t words = 0;
+
+    words += HWA_MODEL_ALIGN(HWA_MODEL_MAX_FFT_SIZE);                                       /* Twiddles */
+    words += 2U * HWA_MODEL_ALIGN(cfg->numDopplerChirps * numVirtAnt);                      /* Rx compensation output */
+    words += 2U * HWA_MODEL_ALIGN(cfg->numDopplerBins * numPos);                            /* Doppler FFT */
+    words += 2U * HWA_MODEL_ALIGN(cfg->numAntRow * numOutDop * cfg->numAntCol);             /* [row][doppler][col] */
+    words += 2U * HWA_MODEL_ALIGN(cfg->azimuthFftSize * cfg->numAntRow * numOutDop);        /* Azimuth FFT */
+    words += 2U * HWA_MODEL_ALIGN(cfg->elevationFftSize * numOutDop * cfg->azimuthFftSize); /* Elevation FFT */
+    words += 4U * HWA_MODEL_ALIGN(cfg->azimuthFftSize);                                     /* Doppler statistics */
+    return words;
+}
+
+static uint32_t HwaModel_doa3dNumPositions(const HwaModel_Doa3dConfig *cfg)
+{
+    uint32_t p, numPos = 0;
+
+    for (p = 0; (p < cfg->numDopFftParams) && (p < HWA_MODEL_MAX_NUM_DOP_FFT_PARAMS); p++)
+    {
+        numPos += cfg->dopFftCfg[p].srcBcnt;
+    }
+    return numPos;
+}
+
+uint32_t HwaModel_doa3dScratchBytes(const HwaModel_Doa3dConfig *cfg)
+{
+    return HwaModel_doa3dScratchWords(cfg, HwaModel_doa3dNumPositions(cfg)) * sizeof(int32_t);
+}
+
+int32_t HwaModel_doa3dProcess(const HwaModel_Doa3dConfig *cfg,
+                              const HwaModel_cmplx16ImRe *radarCube,
+                              uint32_t *detMatrix,
+                              uint8_t *dopplerIndexMatrix,
+                              void *scratch,
+                              uint32_t scratchBytes)
+{
+    HwaModel_DopPosition pos[HWA_MODEL_MAX_DOP_POSITIONS];
+    uint32_t numVirtAnt, numOutDop, skipDop, numPos, numBank2;
+    uint32_t log2Dop, log2Az, log2El, sumDiv;
+    uint32_t numRow, numCol, numAz, numEl, numChirps;
+    uint32_t azBatch, elBatch;
+    uint16_t dopScaling;
+    uint32_t rng, chirp, ant, p, k, d, n, row, col, e;
+    int32_t *twRe, *twIm, *compRe, *compIm, *dopRe, *dopIm, *bank2Re, *bank2Im, *azRe, *azIm, *elRe, *elIm;
+    uint64_t *sumAcc;
+    uint32_t *maxVal, *maxInd;
+    int32_t *ptr;
+    int32_t retVal = 0;
+
+    if ((cfg == NULL) || (radarCube == NULL) || (detMatrix == NULL) || (scratch == NULL) ||
+        (cfg->rxChPhaseComp == NULL) || (cfg->window == NULL))
+    {
+        retVal = HWA_MODEL_EINVAL;
+        goto exit;
+    }
+
+    numVirtAnt = cfg->numTxAntennas * cfg->numRxAntennas;
+    numRow = cfg->numAntRow;
+    numCol = cfg->numAntCol;
+    numAz = cfg->azimuthFftSize;
+    numEl = cfg->elevationFftSize;
+    numChirps = cfg->numDopplerChirps;
+    log2Dop = HwaModel_log2Pow2(cfg->numDopplerBins);
+    log2Az = HwaModel_log2Pow2(numAz);
+    log2El = HwaModel_log2Pow2(numEl);
+    skipDop = cfg->isStaticClutterRemovalEnabled ? 1U : 0U;
+    numOutDop = cfg->numDopplerBins - skipDop;
+    numPos = HwaModel_doa3dNumPositions(cfg);
+
+    /* Same limitations as doa3dfftproc: 2D antenna array, selectCoherentPeakInDopplerDim 0 or 2 */
+    if ((numVirtAnt == 0) || (numRow < 2) || (numCol == 0) || (numChirps == 0) ||
+        (log2Dop == 0xFFFFFFFFU) || (log2Az == 0xFFFFFFFFU) || (log2El == 0xFFFFFFFFU) ||
+        (cfg->numDopplerBins > HWA_MODEL_MAX_FFT_SIZE) || (numAz > HWA_MODEL_MAX_FFT_SIZE) ||
+        (numEl > HWA_MODEL_MAX_FFT_SIZE) || (numChirps > cfg->numDopplerBins) ||
+        (numCol > numAz) || (numRow > numEl) || (numOutDop == 0) ||
+        (cfg->numDopFftParams > HWA_MODEL_MAX_NUM_DOP_FFT_PARAMS) ||
+        (numPos == 0) || (numPos > HWA_MODEL_MAX_DOP_POSITIONS) ||
+        ((cfg->selectCoherentPeakInDopplerDim != 0) && (cfg->selectCoherentPeakInDopplerDim != 2)) ||
+        ((cfg->selectCoherentPeakInDopplerDim == 2) && (dopplerIndexMatrix == NULL)))
+    {
+        retVal = HWA_MODEL_EINVAL;
+        goto exit;
+    }
+    if (scratchBytes < HwaModel_doa3dScratchWords(cfg, numPos) * sizeof(int32_t))
+    {
+        retVal = HWA_MODEL_ENOMEM;
+        goto exit;
+    }
+
+    /* Antenna mapping of the Doppler FFT param sets */
+    numBank2 = numRow * numOutDop * numCol;
+    n = 0;
+    for (p = 0; p < cfg->numDopFftParams; p++)
+    {
+        const HwaModel_DopFftCfg *dopCfg = &cfg->dopFftCfg[p];
+
+        for (k = 0; k < dopCfg->srcBcnt; k++)
+        {
+            int32_t srcAnt = dopCfg->srcAddrOffset + (int32_t) k * dopCfg->srcBidx;
+            int32_t dst = dopCfg->dstAddrOffset + (int32_t) k * dopCfg->dstBidx;
+
+            if ((dopCfg->scale != 0) && ((srcAnt < 0) || (srcAnt >= (int32_t) numVirtAnt)))
+            {
+                retVal = HWA_MODEL_EINVAL;
+                goto exit;
+            }
+            if ((dst < 0) || ((uint32_t) dst + (numOutDop - 1U) * numCol >= numBank2))
+            {
+                retVal = HWA_MODEL_EINVAL;
+                goto exit;
+            }
+            pos[n].ant = (dopCfg->scale != 0) ? (int16_t) srcAnt : -1;
+            pos[n].dst = (int16_t) dst;
+            n++;
+        }
+    }
+
+    azBatch = numRow * numOutDop;
+    elBatch = numOutDop * numAz;
+    dopScaling = HwaModel_doa3dButterflyScaling(cfg->numDopplerBins, cfg->firstStageScaling);
+    sumDiv = log2Dop;
+
+    /* Scratch */
+    ptr = (int32_t *) scratch;
+    twRe = ptr;
+    twIm = twRe + HWA_MODEL_MAX_FFT_SIZE / 2U;
+    ptr += HWA_MODEL_ALIGN(HWA_MODEL_MAX_FFT_SIZE);
+    compRe = ptr;
+    ptr += HWA_MODEL_ALIGN(numChirps * numVirtAnt);
+    compIm = ptr;
+    ptr += HWA_MODEL_ALIGN(numChirps * numVirtAnt);
+    dopRe = ptr;
+    ptr += HWA_MODEL_ALIGN(cfg->numDopplerBins * numPos);
+    dopIm = ptr;
+    ptr += HWA_MODEL_ALIGN(cfg->numDopplerBins * numPos);
+    bank2Re = ptr;
+    ptr += HWA_MODEL_ALIGN(numBank2);
+    bank2Im = ptr;
+    ptr += HWA_MODEL_ALIGN(numBank2);
+    azRe = ptr;
+    ptr += HWA_MODEL_ALIGN(numAz * azBatch);
+    azIm = ptr;
+    ptr += HWA_MODEL_ALIGN(numAz * azBatch);
+    elRe = ptr;
+    ptr += HWA_MODEL_ALIGN(numEl * elBatch);
+    elIm = ptr;
+    ptr += HWA_MODEL_ALIGN(numEl * elBatch);
+    sumAcc = (uint64_t *) ptr;
+    ptr += 2U * HWA_MODEL_ALIGN(numAz);
+    maxVal = (uint32_t *) ptr;
+    ptr += HWA_MODEL_ALIGN(numAz);
+    maxInd = (uint32_t *) ptr;
+
+    HwaModel_genTwiddle(twRe, twIm);
+    memset(bank2Re, 0, numBank2 * sizeof(int32_t));
+    memset(bank2Im, 0, numBank2 * sizeof(int32_t));
+
+    for (rng = 0; rng < cfg->numRangeBins; rng++)
+    {
+        /* Rx channel compensation: 16-bit in (srcScale 8), Q20 vector multiply, 16-bit out (dstScale 0) */
+        for (chirp = 0; chirp < numChirps; chirp++)
+        {
+            for (ant = 0; ant < numVirtAnt; ant++)
+            {
+                const HwaModel_cmplx16ImRe *x = &radarCube[(chirp * numVirtAnt + ant) * cfg->numRangeBins + rng];
+                int64_t xRe = (int64_t) x->real << HWA_MODEL_SRC_SCALE_16BIT;
+                int64_t xIm = (int64_t) x->imag << HWA_MODEL_SRC_SCALE_16BIT;
+                int64_t cRe = cfg->rxChPhaseComp[ant].real;
+                int64_t cIm = cfg->rxChPhaseComp[ant].imag;
+                int32_t yRe = HwaModel_sat24(HwaModel_roundShift(xRe * cRe - xIm * cIm, HWA_MODEL_CMULT_QFORMAT));
+                int32_t yIm = HwaModel_sat24(HwaModel_roundShift(xRe * cIm + xIm * cRe, HWA_MODEL_CMULT_QFORMAT));
+
+                compRe[chirp * numVirtAnt + ant] = HwaModel_sat16((int32_t) HwaModel_roundShift(yRe, HWA_MODEL_SRC_SCALE_16BIT - HWA_MODEL_DST_SCALE_16BIT));
+                compIm[chirp * numVirtAnt + ant] = HwaModel_sat16((int32_t) HwaModel_roundShift(yIm, HWA_MODEL_SRC_SCALE_16BIT - HWA_MODEL_DST_SCALE_16BIT));
+            }
+        }
+
+        /* Doppler FFT of every antenna array position: 16-bit in (srcScale 8), zero padded to numDopplerBins */
+        for (chirp = 0; chirp < numChirps; chirp++)
+        {
+            for (p = 0; p < numPos; p++)
+            {
+                if (pos[p].ant >= 0)
+                {
+                    dopRe[chirp * numPos + p] = compRe[chirp * numVirtAnt + pos[p].ant] << HWA_MODEL_SRC_SCALE_16BIT;
+                    dopIm[chirp * numPos + p] = compIm[chirp * numVirtAnt + pos[p].ant] << HWA_MODEL_SRC_SCALE_16BIT;
+                }
+                else
+                {
+                    dopRe[chirp * numPos + p] = 0;
+                    dopIm[chirp * numPos + p] = 0;
+                }
+            }
+        }
+        memset(&dopRe[numChirps * numPos], 0, (cfg->numDopplerBins - numChirps) * numPos * sizeof(int32_t));
+        memset(&dopIm[numChirps * numPos], 0, (cfg->numDopplerBins - numChirps) * numPos * sizeof(int32_t));
+        HwaModel_fftBatch(dopRe, dopIm, log2Dop, numChirps, numPos, dopScaling, twRe, twIm);
+
+        /* 32-bit out (dstScale 8), Doppler bin 0 skipped with clutter removal, [row][doppler][col] */
+        for (d = 0; d < numOutDop; d++)
+        {
+            uint32_t dopRow = HwaModel_bitRev(d + skipDop, log2Dop) * numPos;
+
+            for (p = 0; p < numPos; p++)
+            {
+                bank2Re[pos[p].dst + d * numCol] = dopRe[dopRow + p];
+                bank2Im[pos[p].dst + d * numCol] = dopIm[dopRow + p];
+            }
+        }
+
+        /* Azimuth FFT over the columns of every (row, doppler), windowed. Vector b = row * numOutDop + doppler */
+        for (col = 0; col < numCol; col++)
+        {
+            int64_t w = cfg->window[col];
+
+            for (k = 0; k < azBatch; k++)
+            {
+                azRe[col * azBatch + k] = HwaModel_sat24(HwaModel_roundShift(bank2Re[k * numCol + col] * w, HWA_MODEL_WINDOW_QFORMAT));
+                azIm[col * azBatch + k] = HwaModel_sat24(HwaModel_roundShift(bank2Im[k * numCol + col] * w, HWA_MODEL_WINDOW_QFORMAT));
+            }
+        }
+        memset(&azRe[numCol * azBatch], 0, (numAz - numCol) * azBatch * sizeof(int32_t));
+        memset(&azIm[numCol * azBatch], 0, (numAz - numCol) * azBatch * sizeof(int32_t));
+        HwaModel_fftBatch(azRe, azIm, log2Az, numCol, azBatch, 0, twRe, twIm);
+
+        /* Elevation FFT over the rows of every (doppler, azimuth), windowed. Vector b = doppler * numAz + az */
+        for (k = 0; k < numAz; k++)
+        {
+            uint32_t azRow = HwaModel_bitRev(k, log2Az) * azBatch;
+
+            for (row = 0; row < numRow; row++)
+            {
+                int64_t w = cfg->window[row];
+
+                for (d = 0; d < numOutDop; d++)
+                {
+                    uint32_t azInd = azRow + row * numOutDop + d;
+
+                    elRe[row * elBatch + d * numAz + k] = HwaModel_sat24(HwaModel_roundShift(azRe[azInd] * w, HWA_MODEL_WINDOW_QFORMAT));
+                    elIm[row * elBatch + d * numAz + k] = HwaModel_sat24(HwaModel_roundShift(azIm[azInd] * w, HWA_MODEL_WINDOW_QFORMAT));
+                }
+            }
+        }
+        memset(&elRe[numRow * elBatch], 0, (numEl - numRow) * elBatch * sizeof(int32_t));
+        memset(&elIm[numRow * elBatch], 0, (numEl - numRow) * elBatch * sizeof(int32_t));
+        HwaModel_fftBatch(elRe, elIm, log2El, numRow, elBatch, 0, twRe, twIm);
+
+        /* Magnitude (32-bit out, dstScale 8) and Doppler SUM (and MAX) statistics per (az, el), reformatted to [el][az] */
+        for (e = 0; e < numEl; e++)
+        {
+            uint32_t elRow = HwaModel_bitRev(e, log2El) * elBatch;
+            uint32_t *detOut = &detMatrix[(e * cfg->numRangeBins + rng) * numAz];
+
+            HwaModel_dopplerStats(&elRe[elRow], &elIm[elRow], numOutDop, numAz, sumAcc, maxVal, maxInd);
+            for (k = 0; k < numAz; k++)
+            {
+                uint64_t sum = sumAcc[k] >> sumDiv;
+
+                detOut[k] = (sum > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (uint32_t) sum;
+            }
+            if (cfg->selectCoherentPeakInDopplerDim == 2)
+            {
+                uint8_t *dopIndOut = &dopplerIndexMatrix[(e * cfg->numRangeBins + rng) * numAz];
+
+                for (k = 0; k < numAz; k++)
+                {
+                    dopIndOut[k] = (uint8_t) maxInd[k];
+                }
+            }
+        }
+    }
+
+exit:
+    return retVal;
+}
+
+uint32_t HwaModel_snr3dScratchBytes(const HwaModel_Snr3dConfig *cfg)
+{
+    return (2U * cfg->numRangeBins * cfg->azimuthFftSize * sizeof(uint32_t)) + sizeof(HwaModel_Log2Table);
+}
+
+int32_t HwaModel_snr3dProcess(const HwaModel_Snr3dConfig *cfg,
+                              const uint32_t *detMatrix,
+                              int16_t *snrOutMatrix,
+                              void *scratch,
+                              uint32_t scratchBytes)
+{
+    uint32_t numRange, numAz, e, az, r;
+    uint32_t *noiseRange, *noiseAz;
+    HwaModel_Log2Table *log2Table;
+    uint32_t divShift;
+    int32_t retVal = 0;
+
+    if ((cfg == NULL) || (detMatrix == NULL) || (snrOutMatrix == NULL) || (scratch == NULL))
+    {
+        retVal = HWA_MODEL_EINVAL;
+        goto exit;
+    }
+    numRange = cfg->numRangeBins;
+    numAz = cfg->azimuthFftSize;
+    divShift = cfg->divShiftBeforeLog;
+
+    /* The noise windows must fit in the line */
+    if ((numRange <= 2U * (cfg->cfarCfg.guardLen + (cfg->cfarCfg.winLen >> 1))) ||
+        (cfg->secondPassEnabled && (numAz <= 2U * (cfg->cfarScndPassCfg.guardLen + (cfg->cfarScndPassCfg.winLen >> 1)))))
+    {
+        retVal = HWA_MODEL_EINVAL;
+        goto exit;
+    }
+    if (scratchBytes < HwaModel_snr3dScratchBytes(cfg))
+    {
+        retVal = HWA_MODEL_ENOMEM;
+        goto exit;
+    }
+    noiseRange = (uint32_t *) scratch;
+    noiseAz = noiseRange + numRange * numAz;
+    log2Table = (HwaModel_Log2Table *) (noiseAz + numRange * numAz);
+    HwaModel_genLog2Table(log2Table);
+
+    for (e = 0; e < cfg->elevationFftSize; e++)
+    {
+        const uint32_t *det = &detMatrix[e * numRange * numAz];
+        int16_t *snrOut = &snrOutMatrix[e * numAz * numRange];
+
+        /* Range CFAR per azimuth bin, output [az][range] */
+        for (az = 0; az < numAz; az++)
+        {
+            HwaModel_cfarNoise(&det[az], numAz, numRange, &cfg->cfarCfg, &noiseRange[az * numRange], 1);
+        }
+
+        if (!cfg->secondPassEnabled)
+        {
+            /* SNR = log2(signal) - log2(noise) */
+            for (az = 0; az < numAz; az++)
+            {
+                for (r = 0; r < numRange; r++)
+                {
+                    int32_t s = HwaModel_log2Q11(log2Table, HwaModel_satU24(det[r * numAz + az]) >> divShift);
+                    int32_t n = HwaModel_log2Q11(log2Table, noiseRange[az * numRange + r] >> divShift);
+
+                    snrOut[az * numRange + r] = HwaModel_sat16(s - n);
+                }
+            }
+        }
+        else
+        {
+            /* Azimuth CFAR per range bin, transposed to [az][range] */
+            for (r = 0; r < numRange; r++)
+            {
+                HwaModel_cfarNoise(&det[r * numAz], 1, numAz, &cfg->cfarScndPassCfg, &noiseAz[r], numRange);
+            }
+
+            /* SNR = log2(signal) - log2((noiseRange + noiseAz) / 2), average by a scaled 2-point FFT */
+            for (az = 0; az < numAz; az++)
+            {
+                for (r = 0; r < numRange; r++)
+                {
+                    uint32_t nR = noiseRange[az * numRange + r] >> divShift;
+                    uint32_t nA = noiseAz[az * numRange + r] >> divShift;
+                    int32_t s = HwaModel_log2Q11(log2Table, HwaModel_satU24(det[r * numAz + az]) >> divShift);
+                    int32_t n = HwaModel_log2Q11(log2Table, HwaModel_satU24(((uint64_t) nR + nA + 1U) >> 1));
+
+                    snrOut[az * numRange + r] = HwaModel_sat16(s - n);
+                }
+            }
+        }
+    }
+
+exit:
+    return retVal;
+}
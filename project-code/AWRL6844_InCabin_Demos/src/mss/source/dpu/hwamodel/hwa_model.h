@@ -0,0 +1,362 @@
+/**
+ *   @file  hwa_model.h
+ *
+ *   @brief
+ *      Software model of the HWA intrusion detection chain (doa3dfftproc + snr3dhmproc).
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  The model reproduces, param set by param set, the HWA processing programmed by doa3dfftproc.c
+ *  (Rx compensation, Doppler FFT with antenna mapping, azimuth/elevation FFT, Doppler max/sum statistics)
+ *  and snr3dhmproc.c (range/azimuth CFAR, log2, SNR subtraction). It takes the radar cube in format 6 and
+ *  writes the detection matrix [el][range][az] (uint32), the Doppler index matrix [el][range][az] (uint8) and
+ *  the SNR matrix [el][az][range] (int16, Q11), i.e. the same buffers the DPUs write over EDMA.
+ *  It has no dependency on the HWA/EDMA drivers and is intended for host builds: regression of the
+ *  fixed-point chain, replay of recorded radar cubes, and tuning of the scaling options without the EVM.
+ *
+ *  HWA arithmetic of the model
+ *  - Internal datapath is 24-bit, with saturation at the output of every stage
+ *  - 16-bit input: internal = x << srcScale. 16-bit output: rounded internal >> (8 - dstScale), saturated
+ *  - 32-bit input: internal = x >> srcScale, saturated to 24 bits. 32-bit output with dstScale 8: internal
+ *  - Complex multiply (Rx compensation): coefficients Q20, product rounded
+ *  - FFT: radix-2 decimation in frequency, Q20 twiddles with rounding, butterflyScaling bit k divides the
+ *    output of stage k by 2 with rounding
+ *  - Window: Q17 coefficients, product rounded
+ *  - Magnitude: rounded sqrt(re^2 + im^2). Log2: rounded log2(x) in Q11 (CFAR_HWA_DETMATRIX_DATA_QFORMAT), log2(0) = 0
+ *  - SUM statistics: sum over the A dimension shifted right by fftSumDiv. MAX statistics: index of the first maximum
+ *  - Doppler FFT with dstSkipInit 1 writes the numDopplerBins - 1 bins after bin 0
+ *  - CFAR: noise sum of (winLen >> 1) cells each side past guardLen, shifted right by noiseDivShift. In
+ *    non-cyclic mode, cells whose left (right) window crosses the edge use the right (left) window only,
+ *    doubled for CFAR_CA
+ *  These follow from how the DPUs program the param sets and the HWA documentation. tools/hwa_model_check
+ *  compares the model bit for bit with a capture of the radarCube, detMatrix, dopplerIndexMatrix and
+ *  snrOutMatrix buffers of one frame from the target (layout in tools/hwa_model_capture.h) and reports the
+ *  first differing cell; a convention is only pinned once a capture of the configuration checks bit-exact.
+ *  tools/hwa_model_regress.sh runs the host regression (target positions, double precision reference,
+ *  recorded checksums), checks the model bit for bit against tools/hwa_model_reference.py, an independent
+ *  numpy implementation of the arithmetic above, on random configurations and saturating inputs, and checks
+ *  the given captures.
+ *
+ *  The FFTs run on [sample][vector] structure-of-arrays blocks, so that every butterfly stage processes all
+ *  vectors of a param set (B dimension) in one contiguous inner loop, which the host compiler vectorizes.
+ *  Their output stays in bit-reversed order, the consumers index it through HwaModel_bitRev.
+ *  Throughput, single host core, hwa_model_regress with -O3 -march=native (AVX-512), 64 range bins,
+ *  16 virtual antennas, 32x32 angle bins: about 65 frames/s with 32 Doppler bins, 30 frames/s with 64, i.e.
+ *  3 to 10 times short of the hundreds of frames/s wanted for bulk replay.
+ *  The angle FFTs dominate: every butterfly stage rounds and saturates to 24 bits, so a bit-exact model cannot
+ *  use a faster floating-point transform. Range bins are independent, so a replay tool can split them across cores.
+ */
+
+#ifndef HWA_MODEL_H
+#define HWA_MODEL_H
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Invalid argument */
+#define HWA_MODEL_EINVAL                        (-1)
+
+/*! @brief Insufficient scratch memory */
+#define HWA_MODEL_ENOMEM                        (-2)
+
+/*! @brief Maximum FFT size supported by the model */
+#define HWA_MODEL_MAX_FFT_SIZE                  (1024U)
+
+/*! @brief Maximum number of Doppler FFT param sets, as DPU_DOA3DPROC_MAX_NUM_DOP_FFFT_PARAMS */
+#define HWA_MODEL_MAX_NUM_DOP_FFT_PARAMS        (8U)
+
+/*! @brief Doppler FFT butterfly scaling as programmed by doa3dfftproc: (numDopplerBins - 1) >> 5 */
+#define HWA_MODEL_FIRST_SCALING_DPU             ((uint8_t)0xFFU)
+
+/*! @brief First stage not scaled, all other stages scaled, as DPU_DOA3DPROC_FIRST_SCALING_DISABLED */
+#define HWA_MODEL_FIRST_SCALING_DISABLED        ((uint8_t)0U)
+
+/*! @brief All stages scaled, as DPU_DOA3DPROC_FIRST_SCALING_ENABLED */
+#define HWA_MODEL_FIRST_SCALING_ENABLED         ((uint8_t)1U)
+
+/*! @brief CFAR averaging modes, as DPU_SNR3DProc_CfarCfg::averageMode */
+#define HWA_MODEL_CFAR_CA                       (0U)
+#define HWA_MODEL_CFAR_CAGO                     (1U)
+#define HWA_MODEL_CFAR_CASO                     (2U)
+
+/**
+ * @brief  Complex 16-bit sample, memory layout of cmplx16ImRe_t
+ */
+typedef struct HwaModel_cmplx16ImRe_t
+{
+    int16_t imag;
+    int16_t real;
+} HwaModel_cmplx16ImRe;
+
+/**
+ * @brief  Complex 32-bit coefficient, memory layout of cmplx32ReIm_t
+ */
+typedef struct HwaModel_cmplx32ReIm_t
+{
+    int32_t real;
+    int32_t imag;
+} HwaModel_cmplx32ReIm;
+
+/**
+ * @brief  Doppler FFT param set, as DPU_Doa3dProc_HWA_Doppler_Fft_Cfg
+ */
+typedef struct HwaModel_DopFftCfg_t
+{
+    /*! @brief   Number of Doppler FFTs (antennas) of the param set */
+    uint16_t    srcBcnt;
+
+    /*! @brief   First antenna */
+    int16_t     srcAddrOffset;
+
+    /*! @brief   Antenna increment */
+    int16_t     srcBidx;
+
+    /*! @brief   0: zero fill (no antenna at the positions), 1: antenna data */
+    int16_t     scale;
+
+    /*! @brief   First output position, row * numDopplerOutBins * numAntCol + col */
+    int16_t     dstAddrOffset;
+
+    /*! @brief   Output position increment */
+    int16_t     dstBidx;
+} HwaModel_DopFftCfg;
+
+/**
+ * @brief  doa3dfftproc model configuration, fields as in DPU_Doa3dProc_StaticConfig / DPU_Doa3dProc_HwaCfg
+ */
+typedef struct HwaModel_Doa3dConfig_t
+{
+    /*! @brief  Number of transmit antennas */
+    uint8_t     numTxAntennas;
+
+    /*! @brief  Number of receive antennas */
+    uint8_t     numRxAntennas;
+
+    /*! @brief  Number of range bins */
+    uint16_t    numRangeBins;
+
+    /*! @brief  Number of Doppler chirps */
+    uint16_t    numDopplerChirps;
+
+    /*! @brief  Number of Doppler bins (power of 2) */
+    uint16_t    numDopplerBins;
+
+    /*! @brief  Azimuth FFT size (power of 2) */
+    uint16_t    azimuthFftSize;
+
+    /*! @brief  Elevation FFT size (power of 2) */
+    uint16_t    elevationFftSize;
+
+    /*! @brief  Number of rows of the 2D antenna array */
+    uint16_t    numAntRow;
+
+    /*! @brief  Number of columns of the 2D antenna array */
+    uint16_t    numAntCol;
+
+    /*! @brief  0 - zero Doppler output, 2 - Doppler output based on Doppler maximum position */
+    uint8_t     selectCoherentPeakInDopplerDim;
+
+    /*! @brief  Static clutter removal (Doppler bin 0 skipped) */
+    bool        isStaticClutterRemovalEnabled;
+
+    /*! @brief  Doppler FFT scaling: HWA_MODEL_FIRST_SCALING_DPU, _DISABLED or _ENABLED */
+    uint8_t     firstStageScaling;
+
+    /*! @brief  Rx channel compensation, Q20, [tx][rx] in the radar cube antenna order */
+    const HwaModel_cmplx32ReIm *rxChPhaseComp;
+
+    /*! @brief  Azimuth/elevation window, Q17, max(azimuthFftSize, elevationFftSize) coefficients */
+    const int32_t *window;
+
+    /*! @brief  Doppler FFT param sets (antenna mapping) */
+    uint8_t     numDopFftParams;
+    HwaModel_DopFftCfg dopFftCfg[HWA_MODEL_MAX_NUM_DOP_FFT_PARAMS];
+} HwaModel_Doa3dConfig;
+
+/**
+ * @brief  CFAR configuration, fields as in DPU_SNR3DProc_CfarCfg
+ */
+typedef struct HwaModel_CfarCfg_t
+{
+    /*! @brief  CFAR averaging mode 0-CFAR_CA, 1-CFAR_CAGO, 2-CFAR_CASO */
+    uint8_t     averageMode;
+
+    /*! @brief  CFAR noise window length, (winLen >> 1) cells on each side */
+    uint8_t     winLen;
+
+    /*! @brief  CFAR one sided guard length */
+    uint8_t     guardLen;
+
+    /*! @brief  CFAR noise sum divisor shift */
+    uint8_t     noiseDivShift;
+
+    /*! @brief  0-cyclic mode disabled, 1-cyclic mode enabled */
+    uint8_t     cyclicMode;
+} HwaModel_CfarCfg;
+
+/**
+ * @brief  snr3dhmproc model configuration, fields as in DPU_SNR3DHM_StaticConfig / DPU_SNR3DHM_DynamicConfig
+ */
+typedef struct HwaModel_Snr3dConfig_t
+{
+    /*! @brief  Number of range bins */
+    uint16_t    numRangeBins;
+
+    /*! @brief  Azimuth FFT size */
+    uint16_t    azimuthFftSize;
+
+    /*! @brief  Elevation FFT size */
+    uint16_t    elevationFftSize;
+
+    /*! @brief  Right shift before log2 */
+    uint8_t     divShiftBeforeLog;
+
+    /*! @brief  Range CFAR */
+    HwaModel_CfarCfg cfarCfg;
+
+    /*! @brief  Second pass (azimuth) CFAR */
+    bool        secondPassEnabled;
+    HwaModel_CfarCfg cfarScndPassCfg;
+} HwaModel_Snr3dConfig;
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the Doppler FFT butterfly scaling mask for the firstStageScaling option
+ *
+ *  @param[in]  numDopplerBins      Number of Doppler bins
+ *  @param[in]  firstStageScaling   HWA_MODEL_FIRST_SCALING_DPU, _DISABLED or _ENABLED
+ *
+ *  @retval     butterflyScaling, bit k scales stage k
+ */
+uint16_t HwaModel_doa3dButterflyScaling(uint16_t numDopplerBins, uint8_t firstStageScaling);
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the scratch memory needed by HwaModel_doa3dProcess, in bytes
+ *
+ *  @param[in]  cfg     Model configuration
+ *
+ *  @retval     Scratch size in bytes
+ */
+uint32_t HwaModel_doa3dScratchBytes(const HwaModel_Doa3dConfig *cfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the doa3dfftproc chain on one radar cube
+ *
+ *  @param[in]  cfg                 Model configuration
+ *  @param[in]  radarCube           Radar cube, format 6: [chirp][tx][rx][range]
+ *  @param[out] detMatrix           Detection matrix [el][range][az]
+ *  @param[out] dopplerIndexMatrix  Doppler index matrix [el][range][az], used if selectCoherentPeakInDopplerDim is 2
+ *  @param[in]  scratch             Scratch memory, 8-byte aligned
+ *  @param[in]  scratchBytes        Scratch size in bytes
+ *
+ *  @retval     0 on success, HWA_MODEL_EINVAL or HWA_MODEL_ENOMEM
+ */
+int32_t HwaModel_doa3dProcess(const HwaModel_Doa3dConfig *cfg,
+                              const HwaModel_cmplx16ImRe *radarCube,
+                              uint32_t *detMatrix,
+                              uint8_t *dopplerIndexMatrix,
+                              void *scratch,
+                              uint32_t scratchBytes);
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the scratch memory needed by HwaModel_snr3dProcess, in bytes
+ *
+ *  @param[in]  cfg     Model configuration
+ *
+ *  @retval     Scratch size in bytes
+ */
+uint32_t HwaModel_snr3dScratchBytes(const HwaModel_Snr3dConfig *cfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the snr3dhmproc HWA chain on one detection matrix
+ *
+ *  @param[in]  cfg             Model configuration
+ *  @param[in]  detMatrix       Detection matrix [el][range][az]
+ *  @param[out] snrOutMatrix    SNR matrix [el][az][range], Q11
+ *  @param[in]  scratch         Scratch memory, 4-byte aligned
+ *  @param[in]  scratchBytes    Scratch size in bytes
+ *
+ *  @retval     0 on success, HWA_MODEL_EINVAL or HWA_MODEL_ENOMEM
+ */
+int32_t HwaModel_snr3dProcess(const HwaModel_Snr3dConfig *cfg,
+                              const uint32_t *detMatrix,
+                              int16_t *snrOutMatrix,
+                              void *scratch,
+                              uint32_t scratchBytes);
+
+/* Configuration from the DPU configurations, hwa_model_dpu.c (builds with the DPU headers) */
+struct DPU_Doa3dProc_Config_t;
+struct DPU_SNR3DHM_Config_t;
+
+/**
+ *  @b Description
+ *  @n
+ *      Fills the model configuration from the doa3dfftproc DPU configuration
+ *
+ *  @param[in]  dpuCfg  DPU configuration, as passed to DPU_Doa3dProc_config()
+ *  @param[out] cfg     Model configuration
+ */
+void HwaModel_doa3dConfigFromDpu(const struct DPU_Doa3dProc_Config_t *dpuCfg, HwaModel_Doa3dConfig *cfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Fills the model configuration from the snr3dhmproc DPU configuration
+ *
+ *  @param[in]  dpuCfg  DPU configuration, as passed to DPU_SNR3DHM_config()
+ *  @param[out] cfg     Model configuration
+ */
+void HwaModel_snr3dConfigFromDpu(const struct DPU_SNR3DHM_Config_t *dpuCfg, HwaModel_Snr3dConfig *cfg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
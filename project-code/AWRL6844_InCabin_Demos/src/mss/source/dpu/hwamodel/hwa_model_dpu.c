@@ -0,0 +1,119 @@
+/**
+ *   @file  hwa_model_dpu.c
+ *
+ *   @brief
+ *      HWA model configuration from the doa3dfftproc and snr3dhmproc DPU configurations.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <string.h>
+
+/* Data Path Include Files */
+#include <source/dpu/doa3dfftproc/doa3dfftproc.h>
+#include <source/dpu/snr3dhmproc/snr3dhmproc.h>
+#include <source/dpu/hwamodel/hwa_model.h>
+
+/**************************************************************************
+ ************************ External Functions ******************************
+ **************************************************************************/
+
+void HwaModel_doa3dConfigFromDpu(const struct DPU_Doa3dProc_Config_t *dpuCfg, HwaModel_Doa3dConfig *cfg)
+{
+    const DPU_Doa3dProc_StaticConfig *staticCfg = &dpuCfg->staticCfg;
+    const DPU_Doa3dProc_HWA_Option_Cfg *rngGateCfg = &dpuCfg->hwRes.hwaCfg.doaRngGateCfg;
+    uint32_t idx;
+
+    memset(cfg, 0, sizeof(HwaModel_Doa3dConfig));
+
+    cfg->numTxAntennas = staticCfg->numTxAntennas;
+    cfg->numRxAntennas = staticCfg->numRxAntennas;
+    cfg->numRangeBins = staticCfg->numRangeBins;
+    cfg->numDopplerChirps = staticCfg->numDopplerChirps;
+    cfg->numDopplerBins = staticCfg->numDopplerBins;
+    cfg->azimuthFftSize = staticCfg->azimuthFftSize;
+    cfg->elevationFftSize = staticCfg->elevationFftSize;
+    cfg->numAntRow = staticCfg->numAntRow;
+    cfg->numAntCol = staticCfg->numAntCol;
+    cfg->selectCoherentPeakInDopplerDim = staticCfg->selectCoherentPeakInDopplerDim;
+    cfg->isStaticClutterRemovalEnabled = staticCfg->isStaticClutterRemovalEnabled;
+
+    /* doa3dfftproc programs the Doppler butterfly scaling independently of hwaCfg.firstStageScaling */
+    cfg->firstStageScaling = HWA_MODEL_FIRST_SCALING_DPU;
+
+    cfg->rxChPhaseComp = (const HwaModel_cmplx32ReIm *) staticCfg->compRxChanCfg.rxChPhaseComp;
+    cfg->window = dpuCfg->hwRes.hwaCfg.window;
+
+    cfg->numDopFftParams = rngGateCfg->numDopFftParams;
+    for (idx = 0; (idx < rngGateCfg->numDopFftParams) && (idx < HWA_MODEL_MAX_NUM_DOP_FFT_PARAMS); idx++)
+    {
+        cfg->dopFftCfg[idx].srcBcnt = rngGateCfg->dopFftCfg[idx].srcBcnt;
+        cfg->dopFftCfg[idx].srcAddrOffset = rngGateCfg->dopFftCfg[idx].srcAddrOffset;
+        cfg->dopFftCfg[idx].srcBidx = rngGateCfg->dopFftCfg[idx].srcBidx;
+        cfg->dopFftCfg[idx].scale = rngGateCfg->dopFftCfg[idx].scale;
+        cfg->dopFftCfg[idx].dstAddrOffset = rngGateCfg->dopFftCfg[idx].dstAddrOffset;
+        cfg->dopFftCfg[idx].dstBidx = rngGateCfg->dopFftCfg[idx].dstBidx;
+    }
+}
+
+void HwaModel_snr3dConfigFromDpu(const struct DPU_SNR3DHM_Config_t *dpuCfg, HwaModel_Snr3dConfig *cfg)
+{
+    const DPU_SNR3DProc_CfarCfg *cfarCfg = dpuCfg->dynCfg.cfarCfg;
+    const DPU_SNR3DProc_CfarScndPassCfg *cfarScndPassCfg = dpuCfg->dynCfg.cfarScndPassCfg;
+
+    memset(cfg, 0, sizeof(HwaModel_Snr3dConfig));
+
+    cfg->numRangeBins = dpuCfg->staticCfg.numRangeBins;
+    cfg->azimuthFftSize = dpuCfg->staticCfg.azimuthFftSize;
+    cfg->elevationFftSize = dpuCfg->staticCfg.elevationFftSize;
+    cfg->divShiftBeforeLog = dpuCfg->staticCfg.divShiftBeforeLog;
+
+    cfg->cfarCfg.averageMode = cfarCfg->averageMode;
+    cfg->cfarCfg.winLen = cfarCfg->winLen;
+    cfg->cfarCfg.guardLen = cfarCfg->guardLen;
+    cfg->cfarCfg.noiseDivShift = cfarCfg->noiseDivShift;
+    cfg->cfarCfg.cyclicMode = cfarCfg->cyclicMode;
+
+    cfg->secondPassEnabled = (cfarScndPassCfg->enabled != 0);
+    cfg->cfarScndPassCfg.averageMode = cfarScndPassCfg->averageMode;
+    cfg->cfarScndPassCfg.winLen = cfarScndPassCfg->winLen;
+    cfg->cfarScndPassCfg.guardLen = cfarScndPassCfg->guardLen;
+    cfg->cfarScndPassCfg.noiseDivShift = cfarScndPassCfg->noiseDivShift;
+    cfg->cfarScndPassCfg.cyclicMode = cfarScndPassCfg->cyclicMode;
+}
@@ -0,0 +1,339 @@
+/**
+ *   @file  hwa_model_capture.c
+ *
+ *   @brief
+ *      Captures of the HWA intrusion detection chain: configuration text and raw buffers.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hwa_model_capture.h"
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+#define HWA_MODEL_CAPTURE_MAX_LINE      (16384U)
+#define HWA_MODEL_CAPTURE_MAX_PATH      (1024U)
+
+/**************************************************************************
+ ************************ Internal Functions ******************************
+ **************************************************************************/
+
+static void HwaModel_captureWriteCfar(FILE *fp, const char *name, const HwaModel_CfarCfg *cfar)
+{
+    fprintf(fp, "%s %u %u %u %u %u\n", name, cfar->averageMode, cfar->winLen, cfar->guardLen,
+            cfar->noiseDivShift, cfar->cyclicMode);
+}
+
+/* Parses up to maxValues integers, returns the number parsed, -1 on a malformed value */
+static int32_t HwaModel_captureParseList(char *str, long *values, int32_t maxValues)
+{
+    int32_t num = 0;
+    char *tok, *end;
+
+    for (tok = strtok(str, " \t\r\n"); tok != NULL; tok = strtok(NULL, " \t\r\n"))
+    {
+        if (num == maxValues)
+        {
+            return -1;
+        }
+        values[num] = strtol(tok, &end, 0);
+        if (*end != '\0')
+        {
+            return -1;
+        }
+        num++;
+    }
+    return num;
+}
+
+static void HwaModel_captureSetCfar(HwaModel_CfarCfg *cfar, const long *v)
+{
+    cfar->averageMode = (uint8_t) v[0];
+    cfar->winLen = (uint8_t) v[1];
+    cfar->guardLen = (uint8_t) v[2];
+    cfar->noiseDivShift = (uint8_t) v[3];
+    cfar->cyclicMode = (uint8_t) v[4];
+}
+
+/**************************************************************************
+ ************************ External Functions ******************************
+ **************************************************************************/
+
+void HwaModel_captureWriteConfig(FILE *fp, const HwaModel_Doa3dConfig *doa3d, const HwaModel_Snr3dConfig *snr3d)
+{
+    uint32_t numVirtAnt = doa3d->numTxAntennas * doa3d->numRxAntennas;
+    uint32_t numWindow = (doa3d->numAntRow > doa3d->numAntCol) ? doa3d->numAntRow : doa3d->numAntCol;
+    uint32_t idx;
+
+    fprintf(fp, "# HWA model capture configuration, see hwa_model_capture.h\n");
+    fprintf(fp, "numTxAntennas %u\n", doa3d->numTxAntennas);
+    fprintf(fp, "numRxAntennas %u\n", doa3d->numRxAntennas);
+    fprintf(fp, "numRangeBins %u\n", doa3d->numRangeBins);
+    fprintf(fp, "numDopplerChirps %u\n", doa3d->numDopplerChirps);
+    fprintf(fp, "numDopplerBins %u\n", doa3d->numDopplerBins);
+    fprintf(fp, "azimuthFftSize %u\n", doa3d->azimuthFftSize);
+    fprintf(fp, "elevationFftSize %u\n", doa3d->elevationFftSize);
+    fprintf(fp, "numAntRow %u\n", doa3d->numAntRow);
+    fprintf(fp, "numAntCol %u\n", doa3d->numAntCol);
+    fprintf(fp, "selectCoherentPeakInDopplerDim %u\n", doa3d->selectCoherentPeakInDopplerDim);
+    fprintf(fp, "isStaticClutterRemovalEnabled %u\n", doa3d->isStaticClutterRemovalEnabled ? 1U : 0U);
+    fprintf(fp, "firstStageScaling %u\n", doa3d->firstStageScaling);
+
+    fprintf(fp, "rxChPhaseComp");
+    for (idx = 0; idx < numVirtAnt; idx++)
+    {
+        fprintf(fp, " %d %d", doa3d->rxChPhaseComp[idx].real, doa3d->rxChPhaseComp[idx].imag);
+    }
+    fprintf(fp, "\nwindow");
+    for (idx = 0; idx < numWindow; idx++)
+    {
+        fprintf(fp, " %d", doa3d->window[idx]);
+    }
+    fprintf(fp, "\n");
+    for (idx = 0; idx < doa3d->numDopFftParams; idx++)
+    {
+        const HwaModel_DopFftCfg *dop = &doa3d->dopFftCfg[idx];
+
+        fprintf(fp, "dopFftCfg %u %d %d %d %d %d\n", dop->srcBcnt, dop->srcAddrOffset, dop->srcBidx,
+                dop->scale, dop->dstAddrOffset, dop->dstBidx);
+    }
+
+    fprintf(fp, "divShiftBeforeLog %u\n", snr3d->divShiftBeforeLog);
+    HwaModel_captureWriteCfar(fp, "cfarCfg", &snr3d->cfarCfg);
+    fprintf(fp, "secondPassEnabled %u\n", snr3d->secondPassEnabled ? 1U : 0U);
+    HwaModel_captureWriteCfar(fp, "cfarScndPassCfg", &snr3d->cfarScndPassCfg);
+}
+
+int32_t HwaModel_captureReadConfig(FILE *fp, HwaModel_CaptureConfig *cfg)
+{
+    static const struct
+    {
+        const char *name;
+        size_t offset;
+        uint8_t size;
+    } scalars[] =
+    {
+        {"numTxAntennas", offsetof(HwaModel_Doa3dConfig, numTxAntennas), 1},
+        {"numRxAntennas", offsetof(HwaModel_Doa3dConfig, numRxAntennas), 1},
+        {"numRangeBins", offsetof(HwaModel_Doa3dConfig, numRangeBins), 2},
+        {"numDopplerChirps", offsetof(HwaModel_Doa3dConfig, numDopplerChirps), 2},
+        {"numDopplerBins", offsetof(HwaModel_Doa3dConfig, numDopplerBins), 2},
+        {"azimuthFftSize", offsetof(HwaModel_Doa3dConfig, azimuthFftSize), 2},
+        {"elevationFftSize", offsetof(HwaModel_Doa3dConfig, elevationFftSize), 2},
+        {"numAntRow", offsetof(HwaModel_Doa3dConfig, numAntRow), 2},
+        {"numAntCol", offsetof(HwaModel_Doa3dConfig, numAntCol), 2},
+        {"selectCoherentPeakInDopplerDim", offsetof(HwaModel_Doa3dConfig, selectCoherentPeakInDopplerDim), 1},
+        {"firstStageScaling", offsetof(HwaModel_Doa3dConfig, firstStageScaling), 1},
+    };
+    static char line[HWA_MODEL_CAPTURE_MAX_LINE];
+    static long values[2U * HWA_MODEL_MAX_FFT_SIZE];
+    char *name, *rest;
+    int32_t num, lineNum = 0;
+    uint32_t idx, numRxComp = 0, numWindow = 0;
+
+    memset(cfg, 0, sizeof(HwaModel_CaptureConfig));
+    cfg->doa3d.firstStageScaling = HWA_MODEL_FIRST_SCALING_DPU;
+    cfg->doa3d.rxChPhaseComp = cfg->rxChPhaseComp;
+    cfg->doa3d.window = cfg->window;
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        lineNum++;
+        if (strchr(line, '#') != NULL)
+        {
+            *strchr(line, '#') = '\0';
+        }
+        name = strtok(line, " \t\r\n");
+        if (name == NULL)
+        {
+            continue;
+        }
+        rest = strtok(NULL, "");
+        num = HwaModel_captureParseList((rest != NULL) ? rest : "", values, 2 * (int32_t) HWA_MODEL_MAX_FFT_SIZE);
+        if (num < 0)
+        {
+            fprintf(stderr, "config line %d: malformed values\n", lineNum);
+            return HWA_MODEL_EINVAL;
+        }
+
+        for (idx = 0; idx < sizeof(scalars) / sizeof(scalars[0]); idx++)
+        {
+            if (strcmp(name, scalars[idx].name) == 0)
+            {
+                break;
+            }
+        }
+        if (idx < sizeof(scalars) / sizeof(scalars[0]))
+        {
+            uint8_t *field = (uint8_t *) &cfg->doa3d + scalars[idx].offset;
+
+            if (num != 1)
+            {
+                fprintf(stderr, "config line %d: %s takes one value\n", lineNum, name);
+                return HWA_MODEL_EINVAL;
+            }
+            if (scalars[idx].size == 1)
+            {
+                *field = (uint8_t) values[0];
+            }
+            else
+            {
+                *(uint16_t *) field = (uint16_t) values[0];
+            }
+        }
+        else if ((strcmp(name, "isStaticClutterRemovalEnabled") == 0) && (num == 1))
+        {
+            cfg->doa3d.isStaticClutterRemovalEnabled = (values[0] != 0);
+        }
+        else if ((strcmp(name, "rxChPhaseComp") == 0) && ((num & 1) == 0) &&
+                 (num <= 2 * (int32_t) HWA_MODEL_CAPTURE_MAX_VIRT_ANT))
+        {
+            numRxComp = (uint32_t) num / 2U;
+            for (idx = 0; idx < numRxComp; idx++)
+            {
+                cfg->rxChPhaseComp[idx].real = (int32_t) values[2U * idx];
+                cfg->rxChPhaseComp[idx].imag = (int32_t) values[2U * idx + 1U];
+            }
+        }
+        else if ((strcmp(name, "window") == 0) && (num <= (int32_t) HWA_MODEL_MAX_FFT_SIZE))
+        {
+            numWindow = (uint32_t) num;
+            for (idx = 0; idx < numWindow; idx++)
+            {
+                cfg->window[idx] = (int32_t) values[idx];
+            }
+        }
+        else if ((strcmp(name, "dopFftCfg") == 0) && (num == 6) &&
+                 (cfg->doa3d.numDopFftParams < HWA_MODEL_MAX_NUM_DOP_FFT_PARAMS))
+        {
+            HwaModel_DopFftCfg *dop = &cfg->doa3d.dopFftCfg[cfg->doa3d.numDopFftParams++];
+
+            dop->srcBcnt = (uint16_t) values[0];
+            dop->srcAddrOffset = (int16_t) values[1];
+            dop->srcBidx = (int16_t) values[2];
+            dop->scale = (int16_t) values[3];
+            dop->dstAddrOffset = (int16_t) values[4];
+            dop->dstBidx = (int16_t) values[5];
+        }
+        else if ((strcmp(name, "divShiftBeforeLog") == 0) && (num == 1))
+        {
+            cfg->snr3d.divShiftBeforeLog = (uint8_t) values[0];
+        }
+        else if ((strcmp(name, "secondPassEnabled") == 0) && (num == 1))
+        {
+            cfg->snr3d.secondPassEnabled = (values[0] != 0);
+        }
+        else if ((strcmp(name, "cfarCfg") == 0) && (num == 5))
+        {
+            HwaModel_captureSetCfar(&cfg->snr3d.cfarCfg, values);
+        }
+        else if ((strcmp(name, "cfarScndPassCfg") == 0) && (num == 5))
+        {
+            HwaModel_captureSetCfar(&cfg->snr3d.cfarScndPassCfg, values);
+        }
+        else
+        {
+            fprintf(stderr, "config line %d: unknown field %s, or wrong number of values\n", lineNum, name);
+            return HWA_MODEL_EINVAL;
+        }
+    }
+
+    if ((numRxComp != (uint32_t) cfg->doa3d.numTxAntennas * cfg->doa3d.numRxAntennas) || (numRxComp == 0))
+    {
+        fprintf(stderr, "config: rxChPhaseComp needs numTxAntennas x numRxAntennas coefficients\n");
+        return HWA_MODEL_EINVAL;
+    }
+    if ((numWindow < cfg->doa3d.numAntRow) || (numWindow < cfg->doa3d.numAntCol))
+    {
+        fprintf(stderr, "config: window needs max(numAntRow, numAntCol) coefficients\n");
+        return HWA_MODEL_EINVAL;
+    }
+
+    cfg->snr3d.numRangeBins = cfg->doa3d.numRangeBins;
+    cfg->snr3d.azimuthFftSize = cfg->doa3d.azimuthFftSize;
+    cfg->snr3d.elevationFftSize = cfg->doa3d.elevationFftSize;
+    return 0;
+}
+
+int32_t HwaModel_captureReadBuffer(const char *dir, const char *name, void *buf, size_t bytes)
+{
+    char path[HWA_MODEL_CAPTURE_MAX_PATH];
+    FILE *fp;
+    size_t numRead;
+    int32_t extra;
+
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        return HWA_MODEL_EINVAL;
+    }
+    numRead = fread(buf, 1, bytes, fp);
+    extra = fgetc(fp);
+    fclose(fp);
+    if ((numRead != bytes) || (extra != EOF))
+    {
+        fprintf(stderr, "%s: expected %zu bytes\n", path, bytes);
+        return HWA_MODEL_EINVAL;
+    }
+    return 0;
+}
+
+int32_t HwaModel_captureWriteBuffer(const char *dir, const char *name, const void *buf, size_t bytes)
+{
+    char path[HWA_MODEL_CAPTURE_MAX_PATH];
+    FILE *fp;
+    size_t numWritten;
+
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+    {
+        return HWA_MODEL_EINVAL;
+    }
+    numWritten = fwrite(buf, 1, bytes, fp);
+    fclose(fp);
+    return (numWritten == bytes) ? 0 : HWA_MODEL_EINVAL;
+}
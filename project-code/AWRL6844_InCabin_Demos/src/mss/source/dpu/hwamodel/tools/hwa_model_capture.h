@@ -0,0 +1,144 @@
+/**
+ *   @file  hwa_model_capture.h
+ *
+ *   @brief
+ *      Captures of the HWA intrusion detection chain: configuration text and raw buffers.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  A capture is a directory with the buffers of one frame, saved from the target memory (e.g. with the CCS
+ *  memory save, raw binary, little endian), and the model configuration in text form:
+ *  - config.txt            configuration, see below
+ *  - radarCube.bin         doa3dfftproc input, format 6: [chirp][tx][rx][range] cmplx16ImRe_t
+ *  - detMatrix.bin         doa3dfftproc output, [el][range][az] uint32
+ *  - dopplerIndexMatrix.bin doa3dfftproc output, [el][range][az] uint8, only with selectCoherentPeakInDopplerDim 2
+ *  - snrOutMatrix.bin      snr3dhmproc output, [el][az][range] int16
+ *
+ *  config.txt has one field per line, "name value...", '#' starts a comment. The names are the fields of
+ *  HwaModel_Doa3dConfig and HwaModel_Snr3dConfig:
+ *      numTxAntennas, numRxAntennas, numRangeBins, numDopplerChirps, numDopplerBins, azimuthFftSize,
+ *      elevationFftSize, numAntRow, numAntCol, selectCoherentPeakInDopplerDim, isStaticClutterRemovalEnabled,
+ *      firstStageScaling (255 for HWA_MODEL_FIRST_SCALING_DPU), divShiftBeforeLog, secondPassEnabled
+ *  and the lists
+ *      rxChPhaseComp re im re im ...           numTxAntennas x numRxAntennas Q20 coefficients
+ *      window w0 w1 ...                        Q17, at least max(numAntRow, numAntCol) coefficients
+ *      dopFftCfg srcBcnt srcAddrOffset srcBidx scale dstAddrOffset dstBidx    one line per param set
+ *      cfarCfg averageMode winLen guardLen noiseDivShift cyclicMode
+ *      cfarScndPassCfg averageMode winLen guardLen noiseDivShift cyclicMode
+ *  HwaModel_captureWriteConfig writes it from the model configurations, which the target code can fill with
+ *  HwaModel_doa3dConfigFromDpu / HwaModel_snr3dConfigFromDpu.
+ */
+
+#ifndef HWA_MODEL_CAPTURE_H
+#define HWA_MODEL_CAPTURE_H
+
+#include <stdio.h>
+
+#include "../hwa_model.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Maximum number of virtual antennas of a capture configuration */
+#define HWA_MODEL_CAPTURE_MAX_VIRT_ANT          (64U)
+
+/**
+ * @brief  Configuration read from a capture, with the storage of the lists the model configuration points to
+ */
+typedef struct HwaModel_CaptureConfig_t
+{
+    HwaModel_Doa3dConfig    doa3d;
+    HwaModel_Snr3dConfig    snr3d;
+    HwaModel_cmplx32ReIm    rxChPhaseComp[HWA_MODEL_CAPTURE_MAX_VIRT_ANT];
+    int32_t                 window[HWA_MODEL_MAX_FFT_SIZE];
+} HwaModel_CaptureConfig;
+
+/**
+ *  @b Description
+ *  @n
+ *      Writes the model configurations in the config.txt format
+ *
+ *  @param[in]  fp      Output file
+ *  @param[in]  doa3d   doa3dfftproc model configuration
+ *  @param[in]  snr3d   snr3dhmproc model configuration
+ */
+void HwaModel_captureWriteConfig(FILE *fp, const HwaModel_Doa3dConfig *doa3d, const HwaModel_Snr3dConfig *snr3d);
+
+/**
+ *  @b Description
+ *  @n
+ *      Reads a config.txt file. The snr3dhmproc dimensions default to the doa3dfftproc ones
+ *
+ *  @param[in]  fp      Input file
+ *  @param[out] cfg     Configuration
+ *
+ *  @retval     0 on success, HWA_MODEL_EINVAL with a message on stderr otherwise
+ */
+int32_t HwaModel_captureReadConfig(FILE *fp, HwaModel_CaptureConfig *cfg);
+
+/**
+ *  @b Description
+ *  @n
+ *      Reads a raw buffer of a capture
+ *
+ *  @param[in]  dir     Capture directory
+ *  @param[in]  name    File name
+ *  @param[out] buf     Buffer
+ *  @param[in]  bytes   Expected size in bytes
+ *
+ *  @retval     0 on success, HWA_MODEL_EINVAL if the file is missing or its size differs
+ */
+int32_t HwaModel_captureReadBuffer(const char *dir, const char *name, void *buf, size_t bytes);
+
+/**
+ *  @b Description
+ *  @n
+ *      Writes a raw buffer of a capture
+ *
+ *  @param[in]  dir     Capture directory
+ *  @param[in]  name    File name
+ *  @param[in]  buf     Buffer
+ *  @param[in]  bytes   Size in bytes
+ *
+ *  @retval     0 on success, HWA_MODEL_EINVAL otherwise
+ */
+int32_t HwaModel_captureWriteBuffer(const char *dir, const char *name, const void *buf, size_t bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,227 @@
+/**
+ *   @file  hwa_model_check.c
+ *
+ *   @brief
+ *      Bit-exactness check of the HWA model against a capture from the target.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: hwa_model_check <capture directory>
+ *
+ *  Runs the model on the captured radar cube and compares, bit for bit, its detection matrix and Doppler
+ *  index matrix with the captured ones. The SNR matrix is computed from the captured detection matrix, so
+ *  that the snr3dhmproc model is checked independently of the doa3dfftproc one. For each buffer it prints
+ *  the number of differing cells, the largest difference and the first differing cell.
+ *  The exit status is 0 if every buffer is bit-exact, 1 if one differs, 2 if the capture cannot be read.
+ *  See hwa_model_capture.h for the capture layout.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hwa_model_capture.h"
+
+/**************************************************************************
+ ************************ Internal Functions ******************************
+ **************************************************************************/
+
+/* Cell types of the compared buffers */
+#define HWA_MODEL_CHECK_UINT32          (0U)
+#define HWA_MODEL_CHECK_UINT8           (1U)
+#define HWA_MODEL_CHECK_INT16           (2U)
+
+static int64_t HwaModel_checkValue(const void *buf, uint32_t type, uint32_t idx)
+{
+    if (type == HWA_MODEL_CHECK_UINT32)
+    {
+        return ((const uint32_t *) buf)[idx];
+    }
+    else if (type == HWA_MODEL_CHECK_UINT8)
+    {
+        return ((const uint8_t *) buf)[idx];
+    }
+    return ((const int16_t *) buf)[idx];
+}
+
+/* Number of differing cells, largest difference and first differing cell */
+static uint32_t HwaModel_checkDiff(const void *model, const void *capture, uint32_t type, uint32_t num,
+                                   int64_t *maxDiff, uint32_t *firstInd)
+{
+    uint32_t idx, numDiff = 0;
+
+    *maxDiff = 0;
+    *firstInd = 0;
+    for (idx = 0; idx < num; idx++)
+    {
+        int64_t diff = HwaModel_checkValue(model, type, idx) - HwaModel_checkValue(capture, type, idx);
+
+        diff = (diff < 0) ? -diff : diff;
+        if (diff != 0)
+        {
+            *firstInd = (numDiff == 0) ? idx : *firstInd;
+            *maxDiff = (diff > *maxDiff) ? diff : *maxDiff;
+            numDiff++;
+        }
+    }
+    return numDiff;
+}
+
+/* Compares a buffer of dimA x dimB x dimC cells and prints the result, returns 1 if it differs */
+static int32_t HwaModel_checkCompare(const char *name, const void *model, const void *capture, uint32_t type,
+                                     uint32_t dimA, uint32_t dimB, uint32_t dimC, const char *labels[3])
+{
+    uint32_t num = dimA * dimB * dimC;
+    uint32_t numDiff, firstInd;
+    int64_t maxDiff;
+
+    numDiff = HwaModel_checkDiff(model, capture, type, num, &maxDiff, &firstInd);
+    if (numDiff == 0)
+    {
+        printf("%-20s bit-exact, %u cells\n", name, num);
+        return 0;
+    }
+    printf("%-20s %u of %u cells differ (%.3f%%), max |diff| %lld, first at %s %u %s %u %s %u\n",
+           name, numDiff, num, 100.0 * numDiff / num, (long long) maxDiff,
+           labels[0], firstInd / (dimB * dimC), labels[1], (firstInd / dimC) % dimB, labels[2], firstInd % dimC);
+    return 1;
+}
+
+/**************************************************************************
+ ************************** Main Function *********************************
+ **************************************************************************/
+
+int main(int argc, char **argv)
+{
+    static const char *detLabels[3] = {"el", "range", "az"};
+    static const char *snrLabels[3] = {"el", "az", "range"};
+    HwaModel_CaptureConfig cfg;
+    const char *dir;
+    FILE *fp;
+    uint32_t numVirtAnt, numDet, scratchBytes;
+    HwaModel_cmplx16ImRe *radarCube;
+    uint32_t *detMatrix, *capDetMatrix;
+    uint8_t *dopIndMatrix = NULL, *capDopIndMatrix = NULL;
+    int16_t *snrMatrix, *capSnrMatrix;
+    void *scratch;
+    int32_t retVal, status = 0;
+    char path[1024];
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <capture directory>\n", argv[0]);
+        return 2;
+    }
+    dir = argv[1];
+
+    snprintf(path, sizeof(path), "%s/config.txt", dir);
+    fp = fopen(path, "r");
+    if ((fp == NULL) || (HwaModel_captureReadConfig(fp, &cfg) != 0))
+    {
+        fprintf(stderr, "%s: cannot read the configuration\n", path);
+        return 2;
+    }
+    fclose(fp);
+
+    numVirtAnt = cfg.doa3d.numTxAntennas * cfg.doa3d.numRxAntennas;
+    numDet = cfg.doa3d.elevationFftSize * cfg.doa3d.numRangeBins * cfg.doa3d.azimuthFftSize;
+    radarCube = malloc(cfg.doa3d.numDopplerChirps * numVirtAnt * cfg.doa3d.numRangeBins * sizeof(HwaModel_cmplx16ImRe));
+    detMatrix = malloc(numDet * sizeof(uint32_t));
+    capDetMatrix = malloc(numDet * sizeof(uint32_t));
+    snrMatrix = malloc(numDet * sizeof(int16_t));
+    capSnrMatrix = malloc(numDet * sizeof(int16_t));
+    if (cfg.doa3d.selectCoherentPeakInDopplerDim == 2)
+    {
+        dopIndMatrix = malloc(numDet);
+        capDopIndMatrix = malloc(numDet);
+    }
+
+    if ((HwaModel_captureReadBuffer(dir, "radarCube.bin", radarCube,
+                                    cfg.doa3d.numDopplerChirps * numVirtAnt * cfg.doa3d.numRangeBins * sizeof(HwaModel_cmplx16ImRe)) != 0) ||
+        (HwaModel_captureReadBuffer(dir, "detMatrix.bin", capDetMatrix, numDet * sizeof(uint32_t)) != 0) ||
+        (HwaModel_captureReadBuffer(dir, "snrOutMatrix.bin", capSnrMatrix, numDet * sizeof(int16_t)) != 0) ||
+        ((capDopIndMatrix != NULL) && (HwaModel_captureReadBuffer(dir, "dopplerIndexMatrix.bin", capDopIndMatrix, numDet) != 0)))
+    {
+        fprintf(stderr, "%s: missing buffer, or buffer size not matching the configuration\n", dir);
+        return 2;
+    }
+
+    scratchBytes = HwaModel_doa3dScratchBytes(&cfg.doa3d);
+    scratch = malloc(scratchBytes);
+    retVal = HwaModel_doa3dProcess(&cfg.doa3d, radarCube, detMatrix, dopIndMatrix, scratch, scratchBytes);
+    free(scratch);
+    if (retVal != 0)
+    {
+        fprintf(stderr, "HwaModel_doa3dProcess: configuration not supported (%d)\n", retVal);
+        return 2;
+    }
+
+    scratchBytes = HwaModel_snr3dScratchBytes(&cfg.snr3d);
+    scratch = malloc(scratchBytes);
+    retVal = HwaModel_snr3dProcess(&cfg.snr3d, capDetMatrix, snrMatrix, scratch, scratchBytes);
+    free(scratch);
+    if (retVal != 0)
+    {
+        fprintf(stderr, "HwaModel_snr3dProcess: configuration not supported (%d)\n", retVal);
+        return 2;
+    }
+
+    status |= HwaModel_checkCompare("detMatrix", detMatrix, capDetMatrix, HWA_MODEL_CHECK_UINT32,
+                                    cfg.doa3d.elevationFftSize, cfg.doa3d.numRangeBins, cfg.doa3d.azimuthFftSize,
+                                    detLabels);
+    if (dopIndMatrix != NULL)
+    {
+        status |= HwaModel_checkCompare("dopplerIndexMatrix", dopIndMatrix, capDopIndMatrix, HWA_MODEL_CHECK_UINT8,
+                                        cfg.doa3d.elevationFftSize, cfg.doa3d.numRangeBins, cfg.doa3d.azimuthFftSize,
+                                        detLabels);
+    }
+    status |= HwaModel_checkCompare("snrOutMatrix", snrMatrix, capSnrMatrix, HWA_MODEL_CHECK_INT16,
+                                    cfg.doa3d.elevationFftSize, cfg.doa3d.azimuthFftSize, cfg.doa3d.numRangeBins,
+                                    snrLabels);
+
+    free(radarCube);
+    free(detMatrix);
+    free(capDetMatrix);
+    free(dopIndMatrix);
+    free(capDopIndMatrix);
+    free(snrMatrix);
+    free(capSnrMatrix);
+    return status;
+}
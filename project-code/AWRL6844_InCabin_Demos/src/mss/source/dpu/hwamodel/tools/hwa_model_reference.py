@@ -0,0 +1,400 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Independent reference of the HWA model arithmetic, written as captures for hwa_model_check
+
+Computes the detection matrix, Doppler index matrix and SNR matrix of random configurations and radar cubes from
+the arithmetic documented in hwa_model.h, without sharing code with hwa_model.c:
+  - the FFT is the textbook recursive decimation in frequency (sums to the even bins, twiddled differences to the
+    odd bins), natural order output, with the 24-bit rounding and saturation of every stage
+  - magnitudes use integer square roots, log2 in Q11 is rounded from the double precision log2 and decided exactly
+    (integer powers) when the double lands within 1e-6 of a rounding boundary
+  - CFAR windows are gathered with index arrays per cell
+Each case is written as a capture (see hwa_model_capture.h) that hwa_model_check must find bit-exact. The random
+configurations cover zero filled and strided antenna mappings, zero padded Doppler FFTs, the three scaling options,
+static clutter removal, both Doppler output modes, every CFAR averaging mode with and without cyclic windows, the
+second pass, and inputs large enough to saturate the Rx compensation, the FFT stages, the window and the log2 input.
+
+Usage
+  hwa_model_reference.py --out DIR [--cases N] [--seed S]
+writes DIR/case000, DIR/case001, ...
+"""
+
+import argparse
+import math
+import os
+
+import numpy as np
+
+INTERNAL_MAX = (1 << 23) - 1
+INTERNAL_MIN = -(1 << 23)
+INTERNAL_UMAX = (1 << 24) - 1
+TWIDDLE_SIZE = 1024
+
+FIRST_SCALING_DPU = 255
+FIRST_SCALING_DISABLED = 0
+FIRST_SCALING_ENABLED = 1
+
+CFAR_CA = 0
+CFAR_CAGO = 1
+CFAR_CASO = 2
+
+
+def lround(x):
+    """C lround: nearest integer, halves away from zero"""
+    return int(math.copysign(math.floor(abs(x) + 0.5), x))
+
+
+# Number of values saturated by sat24, reported per case to show the saturation paths are exercised
+num_saturated = 0
+
+
+def sat24(x):
+    global num_saturated
+    num_saturated += int(np.count_nonzero((x > INTERNAL_MAX) | (x < INTERNAL_MIN)))
+    return np.clip(x, INTERNAL_MIN, INTERNAL_MAX)
+
+
+def round_shift(x, shift):
+    return (x + (1 << (shift - 1))) >> shift
+
+
+TW_RE = np.array([lround(math.cos(-2.0 * math.pi * k / TWIDDLE_SIZE) * (1 << 20)) for k in range(TWIDDLE_SIZE // 2)],
+                 dtype=np.int64)
+TW_IM = np.array([lround(math.sin(-2.0 * math.pi * k / TWIDDLE_SIZE) * (1 << 20)) for k in range(TWIDDLE_SIZE // 2)],
+                 dtype=np.int64)
+
+
+def fft_dif(re, im, scaling, stage=0):
+    """FFT along axis 0 of int64 arrays, natural order output
+
+    First stage: a = x[n] + x[n + N/2] feeds the even bins, b = (x[n] - x[n + N/2]) * W_N^n the odd bins, each scaled
+    by 2^-1 with rounding when bit `stage` of `scaling` is set, every output saturated to 24 bits.
+    """
+    n = re.shape[0]
+    if n == 1:
+        return re, im
+    half = n // 2
+    shift = (scaling >> stage) & 1
+    a_re, b_re = re[:half], re[half:]
+    a_im, b_im = im[:half], im[half:]
+    s_re = (a_re + b_re + shift) >> shift
+    s_im = (a_im + b_im + shift) >> shift
+    d_re = (a_re - b_re + shift) >> shift
+    d_im = (a_im - b_im + shift) >> shift
+    k = np.arange(half) * (TWIDDLE_SIZE // n)
+    w_re = TW_RE[k].reshape((half,) + (1,) * (re.ndim - 1))
+    w_im = TW_IM[k].reshape((half,) + (1,) * (re.ndim - 1))
+    t_re = (d_re * w_re - d_im * w_im + (1 << 19)) >> 20
+    t_im = (d_re * w_im + d_im * w_re + (1 << 19)) >> 20
+    even_re, even_im = fft_dif(sat24(s_re), sat24(s_im), scaling, stage + 1)
+    odd_re, odd_im = fft_dif(sat24(t_re), sat24(t_im), scaling, stage + 1)
+    out_re = np.empty_like(re)
+    out_im = np.empty_like(im)
+    out_re[0::2], out_im[0::2] = even_re, even_im
+    out_re[1::2], out_im[1::2] = odd_re, odd_im
+    return out_re, out_im
+
+
+def butterfly_scaling(num_bins, first_stage_scaling):
+    all_stages = num_bins - 1
+    if first_stage_scaling == FIRST_SCALING_ENABLED:
+        return all_stages
+    if first_stage_scaling == FIRST_SCALING_DISABLED:
+        return all_stages & ~1
+    return (num_bins - 1) >> 5
+
+
+def rounded_sqrt(p):
+    """floor(sqrt(p) + 0.5) of int64 p >= 0, saturated to 24 bits"""
+    r = np.floor(np.sqrt(p.astype(np.float64))).astype(np.int64)
+    r -= (r * r > p)
+    r += ((r + 1) * (r + 1) <= p)
+    r += (p - r * r > r)
+    return np.minimum(r, INTERNAL_UMAX)
+
+
+def log2_q11(x):
+    """round(log2(x) * 2^11), log2(0) = 0"""
+    x = np.asarray(x, dtype=np.int64)
+    out = np.zeros(x.shape, dtype=np.int64)
+    nz = x > 0
+    y = np.log2(x[nz].astype(np.float64)) * 2048.0
+    c = np.floor(y + 0.5).astype(np.int64)
+    frac = y - np.floor(y)
+    # 2^((c - 0.5) / 2048) <= x < 2^((c + 0.5) / 2048)  <=>  2^(2c - 1) <= x^4096 < 2^(2c + 1)
+    for i in np.nonzero(np.abs(frac - 0.5) < 1e-6)[0]:
+        xv = int(x[nz][i]) ** 4096
+        cv = int(c[i])
+        while xv < (1 << (2 * cv - 1)):
+            cv -= 1
+        while xv >= (1 << (2 * cv + 1)):
+            cv += 1
+        c[i] = cv
+    out[nz] = c
+    return out
+
+
+def cfar_noise(line, cfar):
+    """CFAR noise of every cell of a 2D array along its last axis"""
+    num = line.shape[-1]
+    h = cfar['winLen'] >> 1
+    g = cfar['guardLen']
+    x = np.minimum(line.astype(np.int64), INTERNAL_UMAX)
+    noise = np.zeros(line.shape, dtype=np.int64)
+    for i in range(num):
+        left = [(i - g - k) % num for k in range(1, h + 1)]
+        right = [(i + g + k) % num for k in range(1, h + 1)]
+        if cfar['cyclicMode']:
+            valid_l = valid_r = True
+        else:
+            valid_l = i - g - h >= 0
+            valid_r = i + g + h < num
+        sum_l = x[..., left].sum(axis=-1)
+        sum_r = x[..., right].sum(axis=-1)
+        if valid_l and valid_r:
+            if cfar['averageMode'] == CFAR_CAGO:
+                n = np.maximum(sum_l, sum_r)
+            elif cfar['averageMode'] == CFAR_CASO:
+                n = np.minimum(sum_l, sum_r)
+            else:
+                n = sum_l + sum_r
+        else:
+            n = sum_l if valid_l else sum_r
+            if cfar['averageMode'] == CFAR_CA:
+                n = 2 * n
+        noise[..., i] = np.minimum(n >> cfar['noiseDivShift'], INTERNAL_UMAX)
+    return noise
+
+
+def doa3d(cfg, cube):
+    """detMatrix [el][range][az] and dopplerIndexMatrix of cube [chirp][ant][range] (real, imag int16)"""
+    num_ant = cfg['numTxAntennas'] * cfg['numRxAntennas']
+    num_chirps = cfg['numDopplerChirps']
+    num_bins = cfg['numDopplerBins']
+    num_row, num_col = cfg['numAntRow'], cfg['numAntCol']
+    num_az, num_el = cfg['azimuthFftSize'], cfg['elevationFftSize']
+    skip = 1 if cfg['isStaticClutterRemovalEnabled'] else 0
+    num_out = num_bins - skip
+    window = np.array(cfg['window'], dtype=np.int64)
+    comp = np.array(cfg['rxChPhaseComp'], dtype=np.int64).reshape(num_ant, 2)
+
+    # Rx compensation, [chirp][ant][range]
+    x_re = cube[..., 0].astype(np.int64) << 8
+    x_im = cube[..., 1].astype(np.int64) << 8
+    c_re = comp[:, 0][None, :, None]
+    c_im = comp[:, 1][None, :, None]
+    y_re = np.clip(round_shift(sat24(round_shift(x_re * c_re - x_im * c_im, 20)), 8), -32768, 32767)
+    y_im = np.clip(round_shift(sat24(round_shift(x_re * c_im + x_im * c_re, 20)), 8), -32768, 32767)
+
+    # Doppler FFT of each array position, zero padded, written to [row][doppler][col]
+    positions = []
+    for p in cfg['dopFftCfg']:
+        for k in range(p['srcBcnt']):
+            ant = p['srcAddrOffset'] + k * p['srcBidx'] if p['scale'] != 0 else -1
+            positions.append((ant, p['dstAddrOffset'] + k * p['dstBidx']))
+    num_range = cfg['numRangeBins']
+    bank_re = np.zeros((num_row * num_out * num_col, num_range), dtype=np.int64)
+    bank_im = np.zeros_like(bank_re)
+    dop_re = np.zeros((num_bins, len(positions), num_range), dtype=np.int64)
+    dop_im = np.zeros_like(dop_re)
+    for p, (ant, _) in enumerate(positions):
+        if ant >= 0:
+            dop_re[:num_chirps, p] = y_re[:, ant] << 8
+            dop_im[:num_chirps, p] = y_im[:, ant] << 8
+    dop_re, dop_im = fft_dif(dop_re, dop_im, butterfly_scaling(num_bins, cfg['firstStageScaling']))
+    for p, (_, dst) in enumerate(positions):
+        for d in range(num_out):
+            bank_re[dst + d * num_col] = dop_re[d + skip, p]
+            bank_im[dst + d * num_col] = dop_im[d + skip, p]
+    bank_re = bank_re.reshape(num_row, num_out, num_col, num_range)
+    bank_im = bank_im.reshape(num_row, num_out, num_col, num_range)
+
+    # Azimuth FFT over the columns, [az][row][doppler][range]
+    az_re = np.zeros((num_az, num_row, num_out, num_range), dtype=np.int64)
+    az_im = np.zeros_like(az_re)
+    for col in range(num_col):
+        az_re[col] = sat24(round_shift(bank_re[:, :, col] * window[col], 17))
+        az_im[col] = sat24(round_shift(bank_im[:, :, col] * window[col], 17))
+    az_re, az_im = fft_dif(az_re, az_im, 0)
+
+    # Elevation FFT over the rows, [el][az][doppler][range]
+    el_re = np.zeros((num_el, num_az, num_out, num_range), dtype=np.int64)
+    el_im = np.zeros_like(el_re)
+    for row in range(num_row):
+        el_re[row] = sat24(round_shift(az_re[:, row] * window[row], 17))
+        el_im[row] = sat24(round_shift(az_im[:, row] * window[row], 17))
+    el_re, el_im = fft_dif(el_re, el_im, 0)
+
+    # Magnitude, Doppler sum and first maximum
+    mag = rounded_sqrt(el_re * el_re + el_im * el_im)
+    det = np.minimum(mag.sum(axis=2) >> int(math.log2(num_bins)), 0xFFFFFFFF)
+    dop_ind = np.argmax(mag, axis=2)
+    return (det.transpose(0, 2, 1).astype(np.uint32), dop_ind.transpose(0, 2, 1).astype(np.uint8))
+
+
+def snr3d(cfg, det):
+    """snrOutMatrix [el][az][range] of detMatrix [el][range][az]"""
+    div = cfg['divShiftBeforeLog']
+    det_t = det.transpose(0, 2, 1).astype(np.int64)
+    noise_r = cfar_noise(det_t, cfg['cfarCfg'])
+    signal = log2_q11(np.minimum(det_t, INTERNAL_UMAX) >> div)
+    if cfg['secondPassEnabled']:
+        noise_a = cfar_noise(det.astype(np.int64), cfg['cfarScndPassCfg']).transpose(0, 2, 1)
+        noise = log2_q11(np.minimum(((noise_r >> div) + (noise_a >> div) + 1) >> 1, INTERNAL_UMAX))
+    else:
+        noise = log2_q11(noise_r >> div)
+    return np.clip(signal - noise, -32768, 32767).astype(np.int16)
+
+
+def random_cfar(rng, num):
+    while True:
+        cfar = {'averageMode': int(rng.integers(0, 3)), 'winLen': int(rng.choice([2, 4, 8, 16])),
+                'guardLen': int(rng.integers(0, 4)), 'noiseDivShift': int(rng.integers(0, 5)),
+                'cyclicMode': int(rng.integers(0, 2))}
+        if num > 2 * (cfar['guardLen'] + (cfar['winLen'] >> 1)):
+            return cfar
+
+
+def random_case(rng):
+    """Random configuration and radar cube, [chirp][ant][range][real, imag]"""
+    num_tx = int(rng.integers(2, 5))
+    num_rx = int(rng.integers(1, 5))
+    num_bins = int(rng.choice([8, 16, 32, 64]))
+    cfg = {
+        'numTxAntennas': num_tx, 'numRxAntennas': num_rx, 'numRangeBins': int(rng.integers(12, 40)),
+        'numDopplerChirps': int(rng.integers(num_bins // 2, num_bins + 1)), 'numDopplerBins': num_bins,
+        'numAntRow': num_tx, 'numAntCol': num_rx,
+        'selectCoherentPeakInDopplerDim': int(rng.choice([0, 2])),
+        'isStaticClutterRemovalEnabled': int(rng.integers(0, 2)),
+        'firstStageScaling': int(rng.choice([FIRST_SCALING_DPU, FIRST_SCALING_DISABLED, FIRST_SCALING_ENABLED])),
+    }
+    cfg['azimuthFftSize'] = int(rng.choice([s for s in (4, 8, 16, 32) if s >= num_rx]))
+    cfg['elevationFftSize'] = int(rng.choice([s for s in (4, 8, 16, 32) if s >= num_tx]))
+
+    # Gains above 1 (up to 2 in Q20, Q17) saturate the Rx compensation and the window products
+    gain = rng.uniform(0.5, 2.0, num_tx * num_rx)
+    phase = rng.uniform(-math.pi, math.pi, num_tx * num_rx)
+    cfg['rxChPhaseComp'] = [v for g, ph in zip(gain, phase)
+                            for v in (lround(g * math.cos(ph) * (1 << 20)), lround(g * math.sin(ph) * (1 << 20)))]
+    cfg['window'] = [int(v) for v in rng.integers(1 << 15, 1 << 18, max(num_tx, num_rx))]
+
+    # One param set per row, antennas in a shuffled column order; the last column of a random row is zero filled
+    num_out = num_bins - cfg['isStaticClutterRemovalEnabled']
+    zero_row = int(rng.integers(0, num_tx)) if rng.integers(0, 2) else -1
+    params = []
+    for row in range(num_tx):
+        reverse = bool(rng.integers(0, 2))
+        first = row * num_rx + (num_rx - 1 if reverse else 0)
+        count = num_rx - (1 if (row == zero_row and num_rx > 1) else 0)
+        params.append({'srcBcnt': count, 'srcAddrOffset': first, 'srcBidx': -1 if reverse else 1, 'scale': 1,
+                       'dstAddrOffset': row * num_out * num_rx, 'dstBidx': 1})
+        if count < num_rx:
+            params.append({'srcBcnt': 1, 'srcAddrOffset': 0, 'srcBidx': 0, 'scale': 0,
+                           'dstAddrOffset': row * num_out * num_rx + num_rx - 1, 'dstBidx': 1})
+    cfg['dopFftCfg'] = params
+
+    cfg['divShiftBeforeLog'] = int(rng.integers(0, 4))
+    cfg['cfarCfg'] = random_cfar(rng, cfg['numRangeBins'])
+    cfg['secondPassEnabled'] = int(rng.integers(0, 2))
+    cfg['cfarScndPassCfg'] = random_cfar(rng, cfg['azimuthFftSize'])
+
+    # Noise at a random level plus a few full scale tones, which saturate the unscaled FFT stages
+    shape = (cfg['numDopplerChirps'], num_tx * num_rx, cfg['numRangeBins'])
+    level = float(rng.choice([4.0, 300.0, 6000.0]))
+    cube = rng.normal(0.0, level, shape + (2,))
+    for _ in range(3):
+        r = int(rng.integers(0, shape[2]))
+        f = rng.uniform(-0.5, 0.5, 3)
+        amp = float(rng.choice([100.0, 3000.0, 20000.0]))
+        chirp = np.arange(shape[0])[:, None]
+        ant = np.arange(shape[1])[None, :]
+        ph = 2.0 * math.pi * (f[0] * chirp + f[1] * (ant % num_rx) + f[2] * (ant // num_rx))
+        cube[:, :, r, 0] += amp * np.cos(ph)
+        cube[:, :, r, 1] += amp * np.sin(ph)
+    cube = np.clip(np.rint(cube), -32768, 32767).astype(np.int16)
+    return cfg, cube
+
+
+def write_capture(path, cfg, cube, det, dop_ind, snr):
+    os.makedirs(path, exist_ok=True)
+    with open(os.path.join(path, 'config.txt'), 'w') as f:
+        f.write('# hwa_model_reference.py, see hwa_model_capture.h\n')
+        for name in ('numTxAntennas', 'numRxAntennas', 'numRangeBins', 'numDopplerChirps', 'numDopplerBins',
+                     'azimuthFftSize', 'elevationFftSize', 'numAntRow', 'numAntCol', 'selectCoherentPeakInDopplerDim',
+                     'isStaticClutterRemovalEnabled', 'firstStageScaling'):
+            f.write('%s %d\n' % (name, cfg[name]))
+        f.write('rxChPhaseComp %s\n' % ' '.join(str(v) for v in cfg['rxChPhaseComp']))
+        f.write('window %s\n' % ' '.join(str(v) for v in cfg['window']))
+        for p in cfg['dopFftCfg']:
+            f.write('dopFftCfg %d %d %d %d %d %d\n' % (p['srcBcnt'], p['srcAddrOffset'], p['srcBidx'], p['scale'],
+                                                       p['dstAddrOffset'], p['dstBidx']))
+        f.write('divShiftBeforeLog %d\n' % cfg['divShiftBeforeLog'])
+        for name in ('cfarCfg', 'cfarScndPassCfg'):
+            c = cfg[name]
+            f.write('%s %d %d %d %d %d\n' % (name, c['averageMode'], c['winLen'], c['guardLen'], c['noiseDivShift'],
+                                             c['cyclicMode']))
+        f.write('secondPassEnabled %d\n' % cfg['secondPassEnabled'])
+
+    # cmplx16ImRe_t: imag first
+    cube[..., ::-1].astype('<i2').tofile(os.path.join(path, 'radarCube.bin'))
+    det.astype('<u4').tofile(os.path.join(path, 'detMatrix.bin'))
+    if cfg['selectCoherentPeakInDopplerDim'] == 2:
+        dop_ind.tofile(os.path.join(path, 'dopplerIndexMatrix.bin'))
+    snr.astype('<i2').tofile(os.path.join(path, 'snrOutMatrix.bin'))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--out', required=True, help='output directory of the captures')
+    parser.add_argument('--cases', type=int, default=24, help='number of random cases')
+    parser.add_argument('--seed', type=int, default=1, help='random seed')
+    args = parser.parse_args()
+
+    global num_saturated
+    rng = np.random.default_rng(args.seed)
+    for case in range(args.cases):
+        cfg, cube = random_case(rng)
+        num_saturated = 0
+        det, dop_ind = doa3d(cfg, cube)
+        snr = snr3d(cfg, det)
+        write_capture(os.path.join(args.out, 'case%03d' % case), cfg, cube, det, dop_ind, snr)
+        print('case%03d: %dx%d antennas, %d range bins, %d/%d Doppler, %dx%d angle bins, scaling %d, clutter %d, '
+              '%d saturated values' % (case, cfg['numTxAntennas'], cfg['numRxAntennas'], cfg['numRangeBins'],
+                                      cfg['numDopplerChirps'], cfg['numDopplerBins'], cfg['azimuthFftSize'],
+                                      cfg['elevationFftSize'], cfg['firstStageScaling'],
+                                      cfg['isStaticClutterRemovalEnabled'], num_saturated))
+
+
+if __name__ == '__main__':
+    main()
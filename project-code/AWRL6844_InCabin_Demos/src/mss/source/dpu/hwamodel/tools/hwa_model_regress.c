@@ -0,0 +1,533 @@
+/**
+ *   @file  hwa_model_regress.c
+ *
+ *   @brief
+ *      Host regression test of the HWA model.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2024 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ *  Usage: hwa_model_regress [capture directory]
+ *
+ *  Runs the model on synthetic radar cubes, with point targets at known range, Doppler, azimuth and elevation
+ *  over a deterministic noise floor, for configurations covering the Doppler scaling options, static clutter
+ *  removal, zero padded Doppler FFT, both Doppler output modes and both CFAR modes. For each configuration:
+ *  - the detection matrix peak, its Doppler index and its SNR must be at the targets
+ *  - the detection matrix must match a double precision model of the same chain within the quantization error
+ *  - the output checksums must match the recorded ones: any change of the fixed-point behavior shows here,
+ *    update HWA_MODEL_REGRESS_CHECKSUMS only for an intended change (the new values are printed). The checksums
+ *    were recorded from the model itself, so they only detect changes; the bit-exact check against an independent
+ *    implementation is hwa_model_reference.py, run by hwa_model_regress.sh
+ *  It then measures the throughput. With a directory argument, the first configuration is also written as a
+ *  capture, which hwa_model_check must find bit-exact (see hwa_model_regress.sh).
+ *  The exit status is 0 if all checks pass.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "hwa_model_capture.h"
+
+/**************************************************************************
+ ************************** Local Definitions *****************************
+ **************************************************************************/
+
+#define HWA_MODEL_REGRESS_NUM_CFG           (3U)
+#define HWA_MODEL_REGRESS_NUM_TX            (4U)
+#define HWA_MODEL_REGRESS_NUM_RX            (4U)
+#define HWA_MODEL_REGRESS_NUM_VIRT_ANT      (HWA_MODEL_REGRESS_NUM_TX * HWA_MODEL_REGRESS_NUM_RX)
+#define HWA_MODEL_REGRESS_NUM_ROW           (4U)
+#define HWA_MODEL_REGRESS_NUM_COL           (4U)
+#define HWA_MODEL_REGRESS_NUM_RANGE         (64U)
+#define HWA_MODEL_REGRESS_ANGLE_FFT_SIZE    (32U)
+#define HWA_MODEL_REGRESS_NUM_TARGETS       (2U)
+#define HWA_MODEL_REGRESS_THROUGHPUT_FRAMES (20U)
+
+/* Double precision model tolerance: largest error over all the cells, relative to the peak */
+#define HWA_MODEL_REGRESS_REF_TOLERANCE     (0.01)
+
+/* Minimum SNR at a target, Q11 log2 (about 12 dB) */
+#define HWA_MODEL_REGRESS_MIN_SNR           (2 * 2048)
+
+/* FNV-1a checksums of detMatrix, dopplerIndexMatrix and snrOutMatrix per configuration */
+#define HWA_MODEL_REGRESS_CHECKSUMS \
+    { \
+        {0x169F9F29U, 0x2AB55261U, 0x736E65C1U}, \
+        {0xE0A95DE1U, 0x5E509DC5U, 0x53639989U}, \
+        {0xE096CEF4U, 0xCC7E33E9U, 0xA2966967U}, \
+    }
+
+/* Point target, angles in cycles per antenna (spatial frequency) */
+typedef struct HwaModel_RegressTarget_t
+{
+    uint32_t    range;
+    double      doppler;        /* Doppler frequency, cycles per chirp */
+    double      az;             /* Spatial frequency along the columns */
+    double      el;             /* Spatial frequency along the rows */
+    double      amplitude;
+} HwaModel_RegressTarget;
+
+/* Test configuration */
+typedef struct HwaModel_RegressCase_t
+{
+    const char *name;
+    uint16_t    numDopplerChirps;
+    uint16_t    numDopplerBins;
+    uint8_t     firstStageScaling;
+    bool        clutterRemoval;
+    uint8_t     selectCoherentPeakInDopplerDim;
+    bool        secondPassEnabled;
+    double      noise;          /* Noise amplitude, LSB */
+    HwaModel_RegressTarget targets[HWA_MODEL_REGRESS_NUM_TARGETS];
+} HwaModel_RegressCase;
+
+static const HwaModel_RegressCase gRegressCases[HWA_MODEL_REGRESS_NUM_CFG] =
+{
+    {"dpu scaling, clutter removal, Doppler max", 32, 32, HWA_MODEL_FIRST_SCALING_DPU, true, 2, false, 1.0,
+     {{20, 5.0 / 32.0, 0.1875, 0.0625, 40.0}, {45, -9.0 / 32.0, -0.25, -0.125, 25.0}}},
+    {"all stages scaled, zero padded Doppler", 24, 32, HWA_MODEL_FIRST_SCALING_ENABLED, false, 0, true, 6.0,
+     {{12, 3.0 / 32.0, -0.125, 0.1875, 800.0}, {50, 11.0 / 32.0, 0.3125, -0.0625, 500.0}}},
+    {"first stage unscaled, 64 Doppler bins", 64, 64, HWA_MODEL_FIRST_SCALING_DISABLED, true, 2, true, 4.0,
+     {{33, 17.0 / 64.0, 0.0625, 0.25, 400.0}, {8, -20.0 / 64.0, -0.375, 0.0, 250.0}}},
+};
+
+/**************************************************************************
+ ************************ Internal Functions ******************************
+ **************************************************************************/
+
+/* Deterministic uniform noise in [-1, 1) */
+static double HwaModel_regressNoise(uint32_t *state)
+{
+    *state = *state * 1664525U + 1013904223U;
+    return ((double) (*state >> 8) / (double) (1U << 23)) - 1.0;
+}
+
+static uint32_t HwaModel_regressFnv(uint32_t hash, const void *buf, size_t bytes)
+{
+    const uint8_t *p = (const uint8_t *) buf;
+    size_t idx;
+
+    for (idx = 0; idx < bytes; idx++)
+    {
+        hash = (hash ^ p[idx]) * 16777619U;
+    }
+    return hash;
+}
+
+/* FFT bin of a spatial or Doppler frequency, after the HWA output order (no FFT shift) */
+static uint32_t HwaModel_regressBin(double freq, uint32_t size)
+{
+    int32_t bin = (int32_t) lround(freq * size);
+
+    return (uint32_t) ((bin % (int32_t) size + (int32_t) size) % (int32_t) size);
+}
+
+/* Fills the model configurations of a test case. Antenna (tx, rx) is at row tx, column rx */
+static void HwaModel_regressConfig(const HwaModel_RegressCase *tc, HwaModel_CaptureConfig *cfg)
+{
+    uint32_t numOutDop, row, idx;
+
+    memset(cfg, 0, sizeof(HwaModel_CaptureConfig));
+    cfg->doa3d.numTxAntennas = HWA_MODEL_REGRESS_NUM_TX;
+    cfg->doa3d.numRxAntennas = HWA_MODEL_REGRESS_NUM_RX;
+    cfg->doa3d.numRangeBins = HWA_MODEL_REGRESS_NUM_RANGE;
+    cfg->doa3d.numDopplerChirps = tc->numDopplerChirps;
+    cfg->doa3d.numDopplerBins = tc->numDopplerBins;
+    cfg->doa3d.azimuthFftSize = HWA_MODEL_REGRESS_ANGLE_FFT_SIZE;
+    cfg->doa3d.elevationFftSize = HWA_MODEL_REGRESS_ANGLE_FFT_SIZE;
+    cfg->doa3d.numAntRow = HWA_MODEL_REGRESS_NUM_ROW;
+    cfg->doa3d.numAntCol = HWA_MODEL_REGRESS_NUM_COL;
+    cfg->doa3d.selectCoherentPeakInDopplerDim = tc->selectCoherentPeakInDopplerDim;
+    cfg->doa3d.isStaticClutterRemovalEnabled = tc->clutterRemoval;
+    cfg->doa3d.firstStageScaling = tc->firstStageScaling;
+
+    /* Rx compensation: unit gain with a small phase per antenna, removed again by the target model */
+    for (idx = 0; idx < HWA_MODEL_REGRESS_NUM_VIRT_ANT; idx++)
+    {
+        double phase = 0.05 * idx;
+
+        cfg->rxChPhaseComp[idx].real = (int32_t) lround(cos(phase) * (1 << 20));
+        cfg->rxChPhaseComp[idx].imag = (int32_t) lround(sin(phase) * (1 << 20));
+    }
+    cfg->doa3d.rxChPhaseComp = cfg->rxChPhaseComp;
+
+    /* Rectangular window just below unit gain */
+    for (idx = 0; idx < HWA_MODEL_REGRESS_NUM_COL; idx++)
+    {
+        cfg->window[idx] = (1 << 17) - 1;
+    }
+    cfg->doa3d.window = cfg->window;
+
+    /* One Doppler FFT param set per row */
+    numOutDop = tc->numDopplerBins - (tc->clutterRemoval ? 1U : 0U);
+    cfg->doa3d.numDopFftParams = HWA_MODEL_REGRESS_NUM_ROW;
+    for (row = 0; row < HWA_MODEL_REGRESS_NUM_ROW; row++)
+    {
+        cfg->doa3d.dopFftCfg[row].srcBcnt = HWA_MODEL_REGRESS_NUM_COL;
+        cfg->doa3d.dopFftCfg[row].srcAddrOffset = (int16_t) (row * HWA_MODEL_REGRESS_NUM_RX);
+        cfg->doa3d.dopFftCfg[row].srcBidx = 1;
+        cfg->doa3d.dopFftCfg[row].scale = 1;
+        cfg->doa3d.dopFftCfg[row].dstAddrOffset = (int16_t) (row * numOutDop * HWA_MODEL_REGRESS_NUM_COL);
+        cfg->doa3d.dopFftCfg[row].dstBidx = 1;
+    }
+
+    cfg->snr3d.numRangeBins = HWA_MODEL_REGRESS_NUM_RANGE;
+    cfg->snr3d.azimuthFftSize = HWA_MODEL_REGRESS_ANGLE_FFT_SIZE;
+    cfg->snr3d.elevationFftSize = HWA_MODEL_REGRESS_ANGLE_FFT_SIZE;
+    cfg->snr3d.divShiftBeforeLog = 2;
+    cfg->snr3d.cfarCfg.averageMode = HWA_MODEL_CFAR_CA;
+    cfg->snr3d.cfarCfg.winLen = 8;
+    cfg->snr3d.cfarCfg.guardLen = 2;
+    cfg->snr3d.cfarCfg.noiseDivShift = 3;
+    cfg->snr3d.secondPassEnabled = tc->secondPassEnabled;
+    cfg->snr3d.cfarScndPassCfg.averageMode = HWA_MODEL_CFAR_CAGO;
+    cfg->snr3d.cfarScndPassCfg.winLen = 8;
+    cfg->snr3d.cfarScndPassCfg.guardLen = 2;
+    cfg->snr3d.cfarScndPassCfg.noiseDivShift = 3;
+    cfg->snr3d.cfarScndPassCfg.cyclicMode = 1;
+}
+
+/* Radar cube, format 6, with the targets seen through the inverse of the Rx compensation */
+static void HwaModel_regressRadarCube(const HwaModel_RegressCase *tc, const HwaModel_CaptureConfig *cfg,
+                                      HwaModel_cmplx16ImRe *radarCube)
+{
+    uint32_t state = 1;
+    uint32_t chirp, ant, rng, t;
+
+    for (chirp = 0; chirp < tc->numDopplerChirps; chirp++)
+    {
+        for (ant = 0; ant < HWA_MODEL_REGRESS_NUM_VIRT_ANT; ant++)
+        {
+            double compPhase = atan2((double) cfg->rxChPhaseComp[ant].imag, (double) cfg->rxChPhaseComp[ant].real);
+
+            for (rng = 0; rng < HWA_MODEL_REGRESS_NUM_RANGE; rng++)
+            {
+                double re = tc->noise * HwaModel_regressNoise(&state);
+                double im = tc->noise * HwaModel_regressNoise(&state);
+                HwaModel_cmplx16ImRe *x = &radarCube[(chirp * HWA_MODEL_REGRESS_NUM_VIRT_ANT + ant) * HWA_MODEL_REGRESS_NUM_RANGE + rng];
+
+                for (t = 0; t < HWA_MODEL_REGRESS_NUM_TARGETS; t++)
+                {
+                    const HwaModel_RegressTarget *tg = &tc->targets[t];
+
+                    if (tg->range == rng)
+                    {
+                        double phase = 2.0 * M_PI * (tg->doppler * chirp + tg->el * (ant / HWA_MODEL_REGRESS_NUM_RX) +
+                                                     tg->az * (ant % HWA_MODEL_REGRESS_NUM_RX)) - compPhase;
+
+                        re += tg->amplitude * cos(phase);
+                        im += tg->amplitude * sin(phase);
+                    }
+                }
+                x->real = (int16_t) lround(re);
+                x->imag = (int16_t) lround(im);
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Double precision model of the doa3dfftproc chain, with the gains of the fixed-point one: 16-bit data
+ *      scaled by 2^8 in the Doppler FFT input, 2^-1 per scaled Doppler FFT stage, Q17 window, Doppler sum
+ *      divided by numDopplerBins. Direct DFTs, no rounding or saturation.
+ */
+static void HwaModel_regressReference(const HwaModel_CaptureConfig *cfg, const HwaModel_cmplx16ImRe *radarCube,
+                                      double *detRef)
+{
+    const HwaModel_Doa3dConfig *c = &cfg->doa3d;
+    uint32_t numOutDop = c->numDopplerBins - (c->isStaticClutterRemovalEnabled ? 1U : 0U);
+    uint16_t scaling = HwaModel_doa3dButterflyScaling(c->numDopplerBins, c->firstStageScaling);
+    double gain = 256.0;
+    double dopRe[HWA_MODEL_REGRESS_NUM_VIRT_ANT], dopIm[HWA_MODEL_REGRESS_NUM_VIRT_ANT];
+    double azRe[HWA_MODEL_REGRESS_NUM_ROW][HWA_MODEL_REGRESS_ANGLE_FFT_SIZE];
+    double azIm[HWA_MODEL_REGRESS_NUM_ROW][HWA_MODEL_REGRESS_ANGLE_FFT_SIZE];
+    uint32_t rng, d, ant, chirp, row, col, az, el;
+
+    for (; scaling != 0; scaling >>= 1)
+    {
+        gain *= ((scaling & 1U) != 0) ? 0.5 : 1.0;
+    }
+    memset(detRef, 0, c->elevationFftSize * c->numRangeBins * c->azimuthFftSize * sizeof(double));
+
+    for (rng = 0; rng < c->numRangeBins; rng++)
+    {
+        for (d = 0; d < numOutDop; d++)
+        {
+            uint32_t dop = d + (c->isStaticClutterRemovalEnabled ? 1U : 0U);
+
+            /* Rx compensation and Doppler DFT bin */
+            for (ant = 0; ant < HWA_MODEL_REGRESS_NUM_VIRT_ANT; ant++)
+            {
+                double cRe = c->rxChPhaseComp[ant].real / 1048576.0;
+                double cIm = c->rxChPhaseComp[ant].imag / 1048576.0;
+
+                dopRe[ant] = 0.0;
+                dopIm[ant] = 0.0;
+                for (chirp = 0; chirp < c->numDopplerChirps; chirp++)
+                {
+                    const HwaModel_cmplx16ImRe *x = &radarCube[(chirp * HWA_MODEL_REGRESS_NUM_VIRT_ANT + ant) * c->numRangeBins + rng];
+                    double yRe = x->real * cRe - x->imag * cIm;
+                    double yIm = x->real * cIm + x->imag * cRe;
+                    double ph = -2.0 * M_PI * (double) dop * chirp / c->numDopplerBins;
+
+                    dopRe[ant] += yRe * cos(ph) - yIm * sin(ph);
+                    dopIm[ant] += yRe * sin(ph) + yIm * cos(ph);
+                }
+            }
+
+            /* Azimuth DFT per row */
+            for (row = 0; row < c->numAntRow; row++)
+            {
+                for (az = 0; az < c->azimuthFftSize; az++)
+                {
+                    azRe[row][az] = 0.0;
+                    azIm[row][az] = 0.0;
+                    for (col = 0; col < c->numAntCol; col++)
+                    {
+                        double ph = -2.0 * M_PI * (double) az * col / c->azimuthFftSize;
+                        double w = c->window[col] / 131072.0;
+                        double xRe = dopRe[row * HWA_MODEL_REGRESS_NUM_RX + col] * w;
+                        double xIm = dopIm[row * HWA_MODEL_REGRESS_NUM_RX + col] * w;
+
+                        azRe[row][az] += xRe * cos(ph) - xIm * sin(ph);
+                        azIm[row][az] += xRe * sin(ph) + xIm * cos(ph);
+                    }
+                }
+            }
+
+            /* Elevation DFT, magnitude and Doppler sum */
+            for (el = 0; el < c->elevationFftSize; el++)
+            {
+                for (az = 0; az < c->azimuthFftSize; az++)
+                {
+                    double re = 0.0, im = 0.0;
+
+                    for (row = 0; row < c->numAntRow; row++)
+                    {
+                        double ph = -2.0 * M_PI * (double) el * row / c->elevationFftSize;
+                        double w = c->window[row] / 131072.0;
+
+                        re += w * (azRe[row][az] * cos(ph) - azIm[row][az] * sin(ph));
+                        im += w * (azRe[row][az] * sin(ph) + azIm[row][az] * cos(ph));
+                    }
+                    detRef[(el * c->numRangeBins + rng) * c->azimuthFftSize + az] +=
+                        gain * sqrt(re * re + im * im) / c->numDopplerBins;
+                }
+            }
+        }
+    }
+}
+
+/* Runs one test case, returns the number of failed checks */
+static uint32_t HwaModel_regressRun(uint32_t caseInd, const char *captureDir, double *framesPerSec)
+{
+    static const uint32_t checksums[HWA_MODEL_REGRESS_NUM_CFG][3] = HWA_MODEL_REGRESS_CHECKSUMS;
+    const HwaModel_RegressCase *tc = &gRegressCases[caseInd];
+    HwaModel_CaptureConfig cfg;
+    uint32_t numCube, numDet, doaScratchBytes, snrScratchBytes;
+    HwaModel_cmplx16ImRe *radarCube;
+    uint32_t *detMatrix;
+    uint8_t *dopIndMatrix;
+    int16_t *snrMatrix;
+    double *detRef;
+    void *doaScratch, *snrScratch;
+    uint32_t idx, t, frame, numFail = 0;
+    uint32_t sums[3];
+    double refPeak = 0.0, maxErr = 0.0;
+    struct timespec start, end;
+    FILE *fp;
+    char path[1024];
+
+    HwaModel_regressConfig(tc, &cfg);
+    numCube = tc->numDopplerChirps * HWA_MODEL_REGRESS_NUM_VIRT_ANT * HWA_MODEL_REGRESS_NUM_RANGE;
+    numDet = HWA_MODEL_REGRESS_ANGLE_FFT_SIZE * HWA_MODEL_REGRESS_NUM_RANGE * HWA_MODEL_REGRESS_ANGLE_FFT_SIZE;
+    radarCube = malloc(numCube * sizeof(HwaModel_cmplx16ImRe));
+    detMatrix = malloc(numDet * sizeof(uint32_t));
+    dopIndMatrix = calloc(numDet, 1);
+    snrMatrix = malloc(numDet * sizeof(int16_t));
+    detRef = malloc(numDet * sizeof(double));
+    doaScratchBytes = HwaModel_doa3dScratchBytes(&cfg.doa3d);
+    snrScratchBytes = HwaModel_snr3dScratchBytes(&cfg.snr3d);
+    doaScratch = malloc(doaScratchBytes);
+    snrScratch = malloc(snrScratchBytes);
+
+    printf("[%u] %s\n", caseInd, tc->name);
+    HwaModel_regressRadarCube(tc, &cfg, radarCube);
+    if ((HwaModel_doa3dProcess(&cfg.doa3d, radarCube, detMatrix, dopIndMatrix, doaScratch, doaScratchBytes) != 0) ||
+        (HwaModel_snr3dProcess(&cfg.snr3d, detMatrix, snrMatrix, snrScratch, snrScratchBytes) != 0))
+    {
+        printf("    FAIL: configuration rejected by the model\n");
+        numFail++;
+        goto exit;
+    }
+
+    /* Targets: local peak of the detection matrix, Doppler index and SNR */
+    for (t = 0; t < HWA_MODEL_REGRESS_NUM_TARGETS; t++)
+    {
+        const HwaModel_RegressTarget *tg = &tc->targets[t];
+        uint32_t az = HwaModel_regressBin(tg->az, HWA_MODEL_REGRESS_ANGLE_FFT_SIZE);
+        uint32_t el = HwaModel_regressBin(tg->el, HWA_MODEL_REGRESS_ANGLE_FFT_SIZE);
+        uint32_t dop = HwaModel_regressBin(tg->doppler, tc->numDopplerBins) - (tc->clutterRemoval ? 1U : 0U);
+        uint32_t cell = (el * HWA_MODEL_REGRESS_NUM_RANGE + tg->range) * HWA_MODEL_REGRESS_ANGLE_FFT_SIZE + az;
+        int16_t snr = snrMatrix[(el * HWA_MODEL_REGRESS_ANGLE_FFT_SIZE + az) * HWA_MODEL_REGRESS_NUM_RANGE + tg->range];
+        uint32_t peakCell = 0, e, a;
+
+        for (e = 0; e < HWA_MODEL_REGRESS_ANGLE_FFT_SIZE; e++)
+        {
+            for (a = 0; a < HWA_MODEL_REGRESS_ANGLE_FFT_SIZE; a++)
+            {
+                uint32_t c = (e * HWA_MODEL_REGRESS_NUM_RANGE + tg->range) * HWA_MODEL_REGRESS_ANGLE_FFT_SIZE + a;
+
+                peakCell = (detMatrix[c] > detMatrix[peakCell]) ? c : peakCell;
+            }
+        }
+        if ((peakCell != cell) || ((tc->selectCoherentPeakInDopplerDim == 2) && (dopIndMatrix[cell] != dop)) ||
+            (snr < HWA_MODEL_REGRESS_MIN_SNR))
+        {
+            printf("    FAIL: target %u expected at el %u az %u Doppler %u, peak at el %u az %u, Doppler index %u, SNR %d\n",
+                   t, el, az, dop, peakCell / (HWA_MODEL_REGRESS_NUM_RANGE * HWA_MODEL_REGRESS_ANGLE_FFT_SIZE),
+                   peakCell % HWA_MODEL_REGRESS_ANGLE_FFT_SIZE, dopIndMatrix[cell], snr);
+            numFail++;
+        }
+    }
+
+    /* Double precision model */
+    HwaModel_regressReference(&cfg, radarCube, detRef);
+    for (idx = 0; idx < numDet; idx++)
+    {
+        refPeak = (detRef[idx] > refPeak) ? detRef[idx] : refPeak;
+    }
+    for (idx = 0; idx < numDet; idx++)
+    {
+        double err = fabs((double) detMatrix[idx] - detRef[idx]);
+
+        maxErr = (err > maxErr) ? err : maxErr;
+    }
+    printf("    detMatrix vs double precision model: max error %.2e of the peak\n", maxErr / refPeak);
+    if (maxErr > HWA_MODEL_REGRESS_REF_TOLERANCE * refPeak)
+    {
+        printf("    FAIL: above the tolerance %.2e\n", HWA_MODEL_REGRESS_REF_TOLERANCE);
+        numFail++;
+    }
+
+    /* Checksums */
+    sums[0] = HwaModel_regressFnv(2166136261U, detMatrix, numDet * sizeof(uint32_t));
+    sums[1] = HwaModel_regressFnv(2166136261U, dopIndMatrix, numDet);
+    sums[2] = HwaModel_regressFnv(2166136261U, snrMatrix, numDet * sizeof(int16_t));
+    if (memcmp(sums, checksums[caseInd], sizeof(sums)) != 0)
+    {
+        printf("    FAIL: checksums {0x%08XU, 0x%08XU, 0x%08XU}, recorded {0x%08XU, 0x%08XU, 0x%08XU}\n",
+               sums[0], sums[1], sums[2], checksums[caseInd][0], checksums[caseInd][1], checksums[caseInd][2]);
+        numFail++;
+    }
+
+    /* Throughput of the whole chain */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (frame = 0; frame < HWA_MODEL_REGRESS_THROUGHPUT_FRAMES; frame++)
+    {
+        HwaModel_doa3dProcess(&cfg.doa3d, radarCube, detMatrix, dopIndMatrix, doaScratch, doaScratchBytes);
+        HwaModel_snr3dProcess(&cfg.snr3d, detMatrix, snrMatrix, snrScratch, snrScratchBytes);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *framesPerSec = HWA_MODEL_REGRESS_THROUGHPUT_FRAMES /
+                    ((double) (end.tv_sec - start.tv_sec) + 1e-9 * (double) (end.tv_nsec - start.tv_nsec));
+    printf("    %.1f frames/s (%u range bins, %u Doppler bins, %u virtual antennas, %ux%u angle bins)\n",
+           *framesPerSec, HWA_MODEL_REGRESS_NUM_RANGE, tc->numDopplerBins, HWA_MODEL_REGRESS_NUM_VIRT_ANT,
+           HWA_MODEL_REGRESS_ANGLE_FFT_SIZE, HWA_MODEL_REGRESS_ANGLE_FFT_SIZE);
+
+    /* Capture for hwa_model_check */
+    if (captureDir != NULL)
+    {
+        mkdir(captureDir, 0755);
+        snprintf(path, sizeof(path), "%s/config.txt", captureDir);
+        fp = fopen(path, "w");
+        if (fp == NULL)
+        {
+            printf("    FAIL: cannot write %s\n", path);
+            numFail++;
+            goto exit;
+        }
+        HwaModel_captureWriteConfig(fp, &cfg.doa3d, &cfg.snr3d);
+        fclose(fp);
+        if ((HwaModel_captureWriteBuffer(captureDir, "radarCube.bin", radarCube, numCube * sizeof(HwaModel_cmplx16ImRe)) != 0) ||
+            (HwaModel_captureWriteBuffer(captureDir, "detMatrix.bin", detMatrix, numDet * sizeof(uint32_t)) != 0) ||
+            (HwaModel_captureWriteBuffer(captureDir, "dopplerIndexMatrix.bin", dopIndMatrix, numDet) != 0) ||
+            (HwaModel_captureWriteBuffer(captureDir, "snrOutMatrix.bin", snrMatrix, numDet * sizeof(int16_t)) != 0))
+        {
+            printf("    FAIL: cannot write the capture in %s\n", captureDir);
+            numFail++;
+        }
+    }
+
+exit:
+    free(radarCube);
+    free(detMatrix);
+    free(dopIndMatrix);
+    free(snrMatrix);
+    free(detRef);
+    free(doaScratch);
+    free(snrScratch);
+    return numFail;
+}
+
+/**************************************************************************
+ ************************** Main Function *********************************
+ **************************************************************************/
+
+int main(int argc, char **argv)
+{
+    uint32_t caseInd, numFail = 0;
+    double framesPerSec, minFramesPerSec = 0.0;
+
+    for (caseInd = 0; caseInd < HWA_MODEL_REGRESS_NUM_CFG; caseInd++)
+    {
+        numFail += HwaModel_regressRun(caseInd, ((caseInd == 0) && (argc > 1)) ? argv[1] : NULL, &framesPerSec);
+        minFramesPerSec = ((caseInd == 0) || (framesPerSec < minFramesPerSec)) ? framesPerSec : minFramesPerSec;
+    }
+    printf("%s: %u failed checks, slowest configuration %.1f frames/s\n", (numFail == 0) ? "PASS" : "FAIL",
+           numFail, minFramesPerSec);
+    return (numFail == 0) ? 0 : 1;
+}
@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Build and run the HWA model regression on the host
+#
+#   hwa_model_regress.sh [capture directory]...
+#       runs hwa_model_regress (target, reference and checksum checks, throughput), checks the capture it writes
+#       with hwa_model_check, checks the captures of random configurations written by hwa_model_reference.py (an
+#       independent implementation of the arithmetic of hwa_model.h), then checks each capture directory given,
+#       e.g. captured on the target by the demo with doa3dfftproc and snr3dhmproc, against the model
+#
+# Needs a host C compiler (CC, default cc, CFLAGS default -O3 -march=native) and python3 with numpy.
+# BUILD_DIR defaults to ./hwa_model_regress_build, REFERENCE_CASES (default 48) sets the number of random configurations
+
+set -e
+
+TOOLS_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR="$TOOLS_DIR/.."
+BUILD_DIR=${BUILD_DIR:-./hwa_model_regress_build}
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O3 -march=native}
+REFERENCE_CASES=${REFERENCE_CASES:-48}
+
+mkdir -p "$BUILD_DIR"
+$CC $CFLAGS -fno-math-errno -Wall -I "$SRC_DIR" -I "$TOOLS_DIR" -o "$BUILD_DIR/hwa_model_regress" \
+    "$TOOLS_DIR/hwa_model_regress.c" "$TOOLS_DIR/hwa_model_capture.c" "$SRC_DIR/hwa_model.c" -lm
+$CC $CFLAGS -fno-math-errno -Wall -I "$SRC_DIR" -I "$TOOLS_DIR" -o "$BUILD_DIR/hwa_model_check" \
+    "$TOOLS_DIR/hwa_model_check.c" "$TOOLS_DIR/hwa_model_capture.c" "$SRC_DIR/hwa_model.c" -lm
+
+"$BUILD_DIR/hwa_model_regress" "$BUILD_DIR/capture"
+"$BUILD_DIR/hwa_model_check" "$BUILD_DIR/capture"
+
+rm -rf "$BUILD_DIR/reference"
+python3 "$TOOLS_DIR/hwa_model_reference.py" --out "$BUILD_DIR/reference" --cases "$REFERENCE_CASES"
+for CAPTURE in "$BUILD_DIR"/reference/case*; do
+    echo "$CAPTURE"
+    "$BUILD_DIR/hwa_model_check" "$CAPTURE"
+done
+for CAPTURE in "$@"; do
+    "$BUILD_DIR/hwa_model_check" "$CAPTURE"
+done
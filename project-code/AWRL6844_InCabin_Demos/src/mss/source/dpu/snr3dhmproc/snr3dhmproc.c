@@ -1318,6 +1318,54 @@ int32_t DPU_SNR3DHM_control
 )
 {
     int32_t    retVal = 0;
+    snr3dhmObj *obj;
+    DPIF_DetMatrix *snrOutMatrix;
+    EDMACCPaRAMEntry paramSet;
+    uint32_t baseAddr, paramId[2];
+    uint32_t pingPongInd, ind;
+    uint32_t addrOffset;
+
+    if (handle == NULL)
+    {
+        retVal = DPU_SNR3DHM_EINVAL;
+        goto exit;
+    }
+
+    obj = (snr3dhmObj *)handle;
+
+    switch (cmd)
+    {
+        case DPU_SNR3DHM_Cmd_SnrOutMatrixCfg:
+            snrOutMatrix = (DPIF_DetMatrix *)arg;
+            if ((snrOutMatrix == NULL) || (argSize != sizeof(DPIF_DetMatrix)) ||
+                (snrOutMatrix->data == NULL) || (snrOutMatrix->dataSize < obj->res.snrOutMatrix.dataSize))
+            {
+                retVal = DPU_SNR3DHM_EINVAL;
+                goto exit;
+            }
+
+            /* Move the destination of the output channels and of their reload param sets by the buffer offset */
+            addrOffset = (uint32_t) snrOutMatrix->data - (uint32_t) obj->res.snrOutMatrix.data;
+            baseAddr = EDMA_getBaseAddr(obj->res.edmaHandle);
+            for (pingPongInd = 0; pingPongInd < 2; pingPongInd++)
+            {
+                paramId[0] = obj->res.edmaHwaOut[pingPongInd].channel;
+                paramId[1] = obj->res.edmaHwaOut[pingPongInd].shadowPramId;
+                for (ind = 0; ind < 2; ind++)
+                {
+                    EDMAGetPaRAM(baseAddr, paramId[ind], &paramSet);
+                    paramSet.destAddr += addrOffset;
+                    EDMASetPaRAM(baseAddr, paramId[ind], &paramSet);
+                }
+            }
+            obj->res.snrOutMatrix.data = snrOutMatrix->data;
+            break;
+
+        default:
+            retVal = DPU_SNR3DHM_ENOTIMPL;
+            break;
+    }
+exit:
     return (retVal);
 }
 
@@ -361,7 +361,11 @@ typedef struct DPU_SNR3DHMProc_Stats_t
      DPU_SNR3DHM_Cmd_FovRangeCfg,
 
      /*! @brief Command to update field of view in angle domain, minimum and maximum angle limits (for azimuth and elevation) */
-     DPU_SNR3DHM_Cmd_FovAoaCfg
+     DPU_SNR3DHM_Cmd_FovAoaCfg,
+
+     /*! @brief Command to change the SNR output matrix buffer (argument DPIF_DetMatrix). The buffer must be at least
+                the size of the configured one. Issued between process calls, for example to ping-pong the output between frames */
+     DPU_SNR3DHM_Cmd_SnrOutMatrixCfg
  }DPU_SNR3DHM_Cmd;
 
 
@@ -288,6 +288,8 @@ static int32_t CLI_MMWaveFrameCfg (int32_t argc, char* argv[]);
 
 static int32_t CLI_MMWaveClutterRemoval (int32_t argc, char* argv[]);
 static int32_t CLI_MMWaveLowPwrModeEnable(int32_t argc, char* argv[]);
+static int32_t CLI_MMWaveDpcPipelineCfg(int32_t argc, char* argv[]);
+static int32_t CLI_MMWaveDpcTraceCfg(int32_t argc, char* argv[]);
 static int32_t CLI_MMWaveFactoryCalConfig (int32_t argc, char* argv[]);
 static int32_t CLI_MmwDemo_AntGeometryCfg (int32_t argc, char* argv[]);
 static int32_t MmwDemo_CLIMeasureRangeBiasAndRxChanPhaseCfg (int32_t argc, char* argv[]);
@@ -1210,6 +1212,88 @@ static int32_t CLI_MMWaveLowPwrModeEnable(int32_t argc, char* argv[])
     return 0;
  }
 
+static int32_t CLI_MMWaveDpcPipelineCfg(int32_t argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        CLI_write ("Error: Invalid usage of the CLI command\n");
+        return -1;
+    }
+
+    gMmwMssMCB.dpcPipelineEnabled = (uint8_t) atoi (argv[1]);
+
+    return 0;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the DPC latency trace configuration
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t CLI_MMWaveDpcTraceCfg(int32_t argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        CLI_write ("Error: Invalid usage of the CLI command\n");
+        return -1;
+    }
+
+    gMmwMssMCB.dpcTraceCfg.enabled   = (uint8_t) atoi (argv[1]);
+    gMmwMssMCB.dpcTraceCfg.exportTlv = (uint8_t) atoi (argv[2]);
+
+    return 0;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      This is the CLI Handler for the Capon heatmap delta export configuration,
+ *      used when dbgGuiMonitor exports the coarse heatmap in mode 2 (8-bit) or 3 (16-bit)
+ *
+ *  @param[in] argc
+ *      Number of arguments
+ *  @param[in] argv
+ *      Arguments
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t CLI_MMWaveHeatmapExportCfg(int32_t argc, char* argv[])
+{
+    if (argc != 6)
+    {
+        CLI_write ("Error: Invalid usage of the CLI command\n");
+        return -1;
+    }
+
+    gMmwMssMCB.heatmapExportCfg.floorDb          = (float) atof (argv[1]);
+    gMmwMssMCB.heatmapExportCfg.stepDb           = (float) atof (argv[2]);
+    gMmwMssMCB.heatmapExportCfg.deadband         = (uint8_t) atoi (argv[3]);
+    gMmwMssMCB.heatmapExportCfg.maxBytesPerFrame = (uint32_t) atoi (argv[4]);
+    gMmwMssMCB.heatmapExportCfg.keyFramePeriod   = (uint16_t) atoi (argv[5]);
+    gMmwMssMCB.heatmapExportCfg.configured       = 1;
+
+    if (gMmwMssMCB.heatmapExportCfg.stepDb < 0.0f)
+    {
+        CLI_write ("Error: Invalid quantization step\n");
+        return -1;
+    }
+
+    return 0;
+}
+
 static int32_t CLI_MMWaveFactoryCalConfig (int32_t argc, char* argv[])
 {
     if (argc != 6)
@@ -2220,7 +2304,7 @@ int32_t MmwDemo_CLIIntrusionSigProcChainCfg (int32_t argc, char* argv[])
 
     MmwDemo_IntrusionSigProcChainCfg   cfg;
 
-    if(argc != (3+1))
+    if ((argc != (3+1)) && (argc != (5+1)))
     {
         CLI_write ("Error: Invalid usage of the CLI command\n");
         return -1;
@@ -2234,6 +2318,13 @@ int32_t MmwDemo_CLIIntrusionSigProcChainCfg (int32_t argc, char* argv[])
     cfg.elevationFftSize                = (uint16_t) atoi (argv[2]);
     cfg.selectCoherentPeakInDopplerDim  = (uint8_t)  atoi (argv[3]);
 
+    /* Optional range gating */
+    if (argc >= (5+1))
+    {
+        cfg.rangeGateEnabled            = (uint8_t)  atoi (argv[4]);
+        cfg.rangeGateMargin             = (uint16_t) atoi (argv[5]);
+    }
+
     /* Save Configuration to use later */
     gMmwMssMCB.intrusionSigProcChainCfg = cfg;
 
@@ -2342,7 +2433,7 @@ static int32_t mmwLab_CLIStaticRACfarCfg(int32_t argc, char *argv[])
  */
 static int32_t mmwLab_CLIDynRngAngleCfg(int32_t argc, char *argv[])
 {
-    if (argc != (4 + 1))
+    if ((argc != (4 + 1)) && (argc != (5 + 1)))
     {
         CLI_write ("Error: Invalid usage of the CLI command\n");
         return -1;
@@ -2352,6 +2443,7 @@ static int32_t mmwLab_CLIDynRngAngleCfg(int32_t argc, char *argv[])
     gMmwMssMCB.dspPreStartCfgLocal.rangeAngleCfg.mvdr_alpha       = (float)atof(argv[2]);
     gMmwMssMCB.dspPreStartCfgLocal.rangeAngleCfg.detectionMethod  = (uint8_t)atoi(argv[3]);
     gMmwMssMCB.dspPreStartCfgLocal.rangeAngleCfg.dopplerEstMethod = (uint8_t)atoi(argv[4]);
+    gMmwMssMCB.dspPreStartCfgLocal.rangeAngleCfg.steerVecGenMode  = (argc > (4 + 1)) ? (uint8_t)atoi(argv[5]) : 0;
 
     return 0;
 }
@@ -2376,7 +2468,7 @@ static int32_t mmwLab_CLIDynAngleEstCfg(int32_t argc, char *argv[])
 
     if (gMmwMssMCB.dspPreStartCfgLocal.rangeAngleCfg.detectionMethod <= 1)
     {
-        if (argc != (8+1))
+        if ((argc != (8+1)) && (argc != (9+1)))
         {
             CLI_write ("Error: Invalid usage of the CLI command\n");
             return -1;
@@ -2389,10 +2481,12 @@ static int32_t mmwLab_CLIDynAngleEstCfg(int32_t argc, char *argv[])
         gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevAngleEstCfg.sideLobThr      = (float)atof(argv[6]);
         gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevAngleEstCfg.peakExpRelThr   = (float)atof(argv[7]);
         gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevAngleEstCfg.peakExpSNRThr   = (float)atof(argv[8]);
+        /* Optional: coarse grid step of the hierarchical search, dense search if not given */
+        gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevAngleEstCfg.coarseSearchStep = (argc > (8+1)) ? (uint8_t)atoi(argv[9]) : 0;
     }
     else
     {
-        if (argc != (6+1))
+        if ((argc != (6+1)) && (argc != (7+1)))
         {
             CLI_write ("Error: Invalid usage of the CLI command\n");
             return -1;
@@ -2403,6 +2497,8 @@ static int32_t mmwLab_CLIDynAngleEstCfg(int32_t argc, char *argv[])
         gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevZoominCfg.peakExpRelThr     = (float)atof(argv[4]);
         gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevZoominCfg.peakExpSNRThr     = (float)atof(argv[5]);
         gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevZoominCfg.localMaxCheckFlag = (uint8_t)atoi(argv[6]);
+        /* Optional: coarse grid step of the hierarchical search, dense search if not given */
+        gMmwMssMCB.dspPreStartCfgLocal.angle2DEst.azimElevZoominCfg.coarseSearchStep  = (argc > (6+1)) ? (uint8_t)atoi(argv[7]) : 0;
     }
     return 0;
 }
@@ -2491,7 +2587,7 @@ static int32_t mmwLab_CLIDopplerCFARCfg(int32_t argc, char *argv[])
  */
 static int32_t mmwLab_CLIStaticRngAngleCfg(int32_t argc, char *argv[])
 {
-    if (argc != (3 + 1))
+    if ((argc != (3 + 1)) && (argc != (5 + 1)))
     {
         CLI_write ("Error: Invalid usage of the CLI command\n");
         return -1;
@@ -2500,6 +2596,9 @@ static int32_t mmwLab_CLIStaticRngAngleCfg(int32_t argc, char *argv[])
     gMmwMssMCB.dspPreStartCfgLocal.staticEstCfg.staticProcEnabled        = (uint8_t)atoi(argv[1]);
     gMmwMssMCB.dspPreStartCfgLocal.staticEstCfg.staticAzimStepDeciFactor = (uint8_t)atoi(argv[2]);
     gMmwMssMCB.dspPreStartCfgLocal.staticEstCfg.staticElevStepDeciFactor = (uint8_t)atoi(argv[3]);
+    /* Optional: static heatmap cache, static heatmap computed every frame if not given */
+    gMmwMssMCB.dspPreStartCfgLocal.staticEstCfg.staticRefreshPeriod      = (argc > (3 + 1)) ? (uint16_t)atoi(argv[4]) : 0;
+    gMmwMssMCB.dspPreStartCfgLocal.staticEstCfg.staticChangeThr          = (argc > (3 + 1)) ? (float)atof(argv[5]) : 0.f;
 
     return 0;
 }
@@ -2713,8 +2812,12 @@ static int32_t mmwLab_CLICuboidCfg(int32_t argc, char *argv[])
  */
 static int32_t mmwLab_CLIFeatExtrCfg(int32_t argc, char *argv[])
 {
-    /* Sanity Check: */
+    /* Sanity Check: the multi-frame DBSCAN flag is optional, open implementation only */
+#ifdef FEXTRACT_OPEN
+    if ((argc != (1 + 6)) && (argc != (1 + 7)))
+#else
     if (argc != (1 + 6))
+#endif
     {
         CLI_write ("Error: Invalid usage of the CLI command\n");
         return -1;
@@ -2727,6 +2830,9 @@ static int32_t mmwLab_CLIFeatExtrCfg(int32_t argc, char *argv[])
     gMmwMssMCB.featureExtrModuleCfg.dbScanFiltering             = (uint8_t) atoi (argv[4]);
     gMmwMssMCB.featureExtrModuleCfg.dbScanEpsilon               = (float) atof (argv[5]);
     gMmwMssMCB.featureExtrModuleCfg.dbScanMinPts                = (uint16_t) atoi (argv[6]);
+#ifdef FEXTRACT_OPEN
+    gMmwMssMCB.featureExtrModuleCfg.dbScanMultiFrame            = (argc > 7) ? (uint8_t) atoi (argv[7]) : 0;
+#endif
 
     return 0;
 }
@@ -2987,7 +3093,7 @@ void CLI_init (uint8_t taskPriority)
     cnt++;
 
     cliCfg.tableEntry[cnt].cmd            = "sigProcChainCfg";
-    cliCfg.tableEntry[cnt].helpString     = "<azimuthFftSize> <elevationFftSize> <coherentDoppler>";
+    cliCfg.tableEntry[cnt].helpString     = "<azimuthFftSize> <elevationFftSize> <coherentDoppler> [<rangeGateEn> <rangeGateMargin>]";
     cliCfg.tableEntry[cnt].cmdHandlerFxn  = MmwDemo_CLIIntrusionSigProcChainCfg;
     cnt++;
 
@@ -3032,6 +3138,21 @@ void CLI_init (uint8_t taskPriority)
     cliCfg.tableEntry[cnt].cmdHandlerFxn  = CLI_MMWaveLowPwrModeEnable;
     cnt++;
 
+    cliCfg.tableEntry[cnt].cmd            = "dpcPipelineCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<0-disable, 1-enable> (applied at the next configuration)";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = CLI_MMWaveDpcPipelineCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "dpcTraceCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<0-disable, 1-enable> <exportTlv>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = CLI_MMWaveDpcTraceCfg;
+    cnt++;
+
+    cliCfg.tableEntry[cnt].cmd            = "heatmapExportCfg";
+    cliCfg.tableEntry[cnt].helpString     = "<floorDb> <stepDb> <deadband> <maxBytesPerFrame> <keyFramePeriod>";
+    cliCfg.tableEntry[cnt].cmdHandlerFxn  = CLI_MMWaveHeatmapExportCfg;
+    cnt++;
+
     cliCfg.tableEntry[cnt].cmd            = "factoryCalibCfg";
     cliCfg.tableEntry[cnt].helpString     = "<save enable> <restore enable> <rxGain> <backoff0> <Flash offset>";
     cliCfg.tableEntry[cnt].cmdHandlerFxn  = CLI_MMWaveFactoryCalConfig;
@@ -3057,12 +3178,12 @@ void CLI_init (uint8_t taskPriority)
     cnt++;
 
     cliCfg.tableEntry[cnt].cmd           = "dynamicRangeAngleCfg";
-    cliCfg.tableEntry[cnt].helpString    = "<subFrameIdx> <searchStep> <mvdr_alpha> <detectionMethod> <dopplerEstMethod>";
+    cliCfg.tableEntry[cnt].helpString    = "<subFrameIdx> <searchStep> <mvdr_alpha> <detectionMethod> <dopplerEstMethod> [steerVecGenMode]";
     cliCfg.tableEntry[cnt].cmdHandlerFxn = mmwLab_CLIDynRngAngleCfg;
     cnt++;
 
     cliCfg.tableEntry[cnt].cmd           = "dynamic2DAngleCfg";
-    cliCfg.tableEntry[cnt].helpString    = "<subFrameIdx> <elevSearchStep> <mvdr_alpha> <maxNpeak2Search> <peakExpSamples> <elevOnly> <sideLobThr> <peakExpRelThr> <peakExpSNRThr>";
+    cliCfg.tableEntry[cnt].helpString    = "<subFrameIdx> <elevSearchStep> <mvdr_alpha> <maxNpeak2Search> <peakExpSamples> <elevOnly> <sideLobThr> <peakExpRelThr> <peakExpSNRThr> [coarseSearchStep]";
     cliCfg.tableEntry[cnt].cmdHandlerFxn = mmwLab_CLIDynAngleEstCfg;
     cnt++;
 
@@ -3077,7 +3198,7 @@ void CLI_init (uint8_t taskPriority)
     cnt++;
 
     cliCfg.tableEntry[cnt].cmd           = "staticRangeAngleCfg";
-    cliCfg.tableEntry[cnt].helpString    = "<subFrameIdx> <staticProcEnabled> <staticAzimStepDeciFactor> <staticElevStepDeciFactor>";
+    cliCfg.tableEntry[cnt].helpString    = "<subFrameIdx> <staticProcEnabled> <staticAzimStepDeciFactor> <staticElevStepDeciFactor> [staticRefreshPeriod staticChangeThr]";
     cliCfg.tableEntry[cnt].cmdHandlerFxn = mmwLab_CLIStaticRngAngleCfg;
     cnt++;
 
@@ -3113,7 +3234,11 @@ void CLI_init (uint8_t taskPriority)
 
     /* Feature extraction params */
     cliCfg.tableEntry[cnt].cmd           = "featExtrCfg";
+#ifdef FEXTRACT_OPEN
+    cliCfg.tableEntry[cnt].helpString    = "<maxNumPtsPerZonePerFrm> <numFrmProc> <offsCorr> <dbScanFilt> <dbScanEps> <dbScanMinPts> [dbScanMultiFrm]";
+#else
     cliCfg.tableEntry[cnt].helpString    = "<maxNumPtsPerZonePerFrm> <numFrmProc> <offsCorr> <dbScanFilt> <dbScanEps> <dbScanMinPts>";
+#endif
     cliCfg.tableEntry[cnt].cmdHandlerFxn = mmwLab_CLIFeatExtrCfg;
     cnt++;
 
@@ -379,6 +379,9 @@ static void mmwDemoFrameStartISR(void *arg)
 
     mmwMssMCB->stats.frameStartIntCounter++;
 
+    DPC_TRACE_SET_FRAME(mmwMssMCB->stats.frameStartIntCounter);
+    DPC_Trace_write(gDpcTraceRing, DPC_TRACE_ID_FRAME_START, DPC_TRACE_TYPE_INSTANT, curCycle, mmwMssMCB->stats.frameStartIntCounter);
+
     if ((mmwMssMCB->runningMode == DPC_RUNNING_MODE_INDET) && (mmwMssMCB->lowPowerMode == LOW_PWR_MODE_ENABLE))
     {
         //Change to oscilator clock (40MHz)
@@ -189,6 +189,10 @@ TaskHandle_t                    gClassifierTask;
 StaticTask_t                    gClassifierTaskObj;
 StackType_t                     gClassifierTaskStack[CLASSIFIER_TASK_STACK_SIZE] __attribute__((aligned(32)));
 
+TaskHandle_t                    gMboxTask;
+StaticTask_t                    gMboxTaskObj;
+StackType_t                     gMboxTaskStack[MBOX_TASK_STACK_SIZE] __attribute__((aligned(32)));
+
 /*! LED configurations */
 uint32_t                        gGpioBaseAddrLed, gPinNumLed;
 
@@ -422,6 +426,9 @@ void MmwDemo_inaMeasNull(I2C_Handle i2cHandle, uint16_t *ptrPwrMeasured)
 *    8. If statsInfo flag is set, the stats information, timing, temperature and power
 */
 volatile uint32_t gDbgRangeOffset = 22;
+/* Trace events staged for the trace TLV */
+static DPC_Trace_Event gTraceTlvEvents[MMWDEMO_TRACE_TLV_MAX_EVENTS];
+
 void MmwDemo_transmitProcessedOutputTask()
 {
     UART_Handle uartHandle = gUartHandle[1];
@@ -437,6 +444,9 @@ void MmwDemo_transmitProcessedOutputTask()
     uint8_t padding[MMWDEMO_OUTPUT_MSG_SEGMENT_LEN];
     MmwDemo_output_message_tl   tl[MMWDEMO_OUTPUT_ALL_MSG_MAX];
     uint32_t numChirpsToSend;
+    uint32_t numTraceEvents;
+    uint32_t numTraceLost;
+    MmwDemo_uartFrameResult *pFrameResult;
 
     /* Save/restore FP registers during the context switching */
     vPortTaskUsesFPU();
@@ -451,8 +461,22 @@ void MmwDemo_transmitProcessedOutputTask()
     {
         SemaphoreP_pend(&gMmwMssMCB.tlvSemHandle, SystemP_WAIT_FOREVER);
 
+        /* Intrusion detection: buffers and result of the frame handed by the DPC task. The DPC pipeline waits for the
+           transmission before it reuses them, so the oldest result not sent yet is sent. Without the pipeline the DPC
+           does not wait, the last result is sent */
+        pFrameResult = NULL;
+        if (gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET)
+        {
+            if (!gMmwMssMCB.dpcPipelineActive)
+            {
+                gMmwMssMCB.uartFrameResultReadCount = gMmwMssMCB.uartFrameResultWriteCount - 1U;
+            }
+            pFrameResult = &gMmwMssMCB.uartFrameResult[gMmwMssMCB.uartFrameResultReadCount % MMWDEMO_UART_FRAME_RESULT_NUM];
+        }
+
         /* Begin of UART data transmission */
         DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.uartTransStart);
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_UART_TX, 0);
 
         tlvIdx = 0;
         objOut      = &(gMmwMssMCB.pointCloudToUart);
@@ -522,7 +546,7 @@ void MmwDemo_transmitProcessedOutputTask()
         /*********************************/
         if ((gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET) && gMmwMssMCB.guiMonSel.intrusionDetInfo)
         {
-            packetLen += sizeof(MmwDemo_output_message_tl) + gMmwMssMCB.intrusionDetInfoToUart.messageTL.length;
+            packetLen += sizeof(MmwDemo_output_message_tl) + pFrameResult->intrusionDetInfo.messageTL.length;
             tlvIdx++;
         }
 
@@ -603,7 +627,14 @@ void MmwDemo_transmitProcessedOutputTask()
         if ((gMmwMssMCB.runningMode == RUNNING_MODE_SBR) || (gMmwMssMCB.runningMode == RUNNING_MODE_CPD))
         {
             /*** Capon heatmap ***/
-            if (gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap)
+            if (gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap >= 2)
+            {
+                tl[tlvIdx].type = MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP_DELTA;
+                tl[tlvIdx].length = gMmwMssMCB.outputFromDSP->heatMapDeltaOut.length; //payload: HeatmapCodec_FrameHeader, tiles
+                packetLen += sizeof(MmwDemo_output_message_tl) + tl[tlvIdx].length;
+                tlvIdx++;
+            }
+            else if (gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap)
             {
                 tl[tlvIdx].type = MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP;
                 tl[tlvIdx].length = (gMmwMssMCB.outputFromDSP->heatMapOut.numRangeBins *
@@ -648,6 +679,30 @@ void MmwDemo_transmitProcessedOutputTask()
 
         }
 
+        /* Trace events of the MSS and DSS rings, drained here so the TLV covers the frame just processed */
+        numTraceEvents = 0;
+        numTraceLost = 0;
+        if (gMmwMssMCB.dpcTraceCfg.exportTlv && (gMmwMssMCB.traceRing[DPC_TRACE_CORE_MSS] != NULL))
+        {
+            uint32_t coreId;
+            uint32_t numLost;
+
+            for (coreId = 0; coreId < DPC_TRACE_NUM_CORES; coreId++)
+            {
+                numTraceEvents += DPC_Trace_read(gMmwMssMCB.traceRing[coreId],
+                                                 &gMmwMssMCB.traceReadCount[coreId],
+                                                 &gTraceTlvEvents[numTraceEvents],
+                                                 MMWDEMO_TRACE_TLV_MAX_EVENTS - numTraceEvents,
+                                                 &numLost);
+                numTraceLost += numLost;
+            }
+
+            tl[tlvIdx].type = MMWDEMO_OUTPUT_DEBUG_TRACE_EVENTS;
+            tl[tlvIdx].length = 2*sizeof(uint32_t) + numTraceEvents * sizeof(DPC_Trace_Event); //Payload: numEvents, numLost, event list
+            packetLen += sizeof(MmwDemo_output_message_tl) + tl[tlvIdx].length;
+            tlvIdx++;
+        }
+
         /* Fill header */
         headerID.numTLVs = tlvIdx;
         /* Round up packet length to multiple of MMWDEMO_OUTPUT_MSG_SEGMENT_LEN */
@@ -725,8 +780,8 @@ void MmwDemo_transmitProcessedOutputTask()
         if ((gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET) && gMmwMssMCB.guiMonSel.intrusionDetInfo)
         {
             MmwDemo_uartWrite (uartHandle,
-                            (uint8_t*)&gMmwMssMCB.intrusionDetInfoToUart,
-                            sizeof(MmwDemo_output_message_tl) + gMmwMssMCB.intrusionDetInfoToUart.messageTL.length);
+                            (uint8_t*)&pFrameResult->intrusionDetInfo,
+                            sizeof(MmwDemo_output_message_tl) + pFrameResult->intrusionDetInfo.messageTL.length);
             tlvIdx++;
         }
 
@@ -737,7 +792,7 @@ void MmwDemo_transmitProcessedOutputTask()
         {
             int32_t len, sendLen, startInd;
             MmwDemo_output_message_tl     messageTL;
-            uint8_t *dataPtr = (uint8_t*) gMmwMssMCB.detMatrix.data;
+            uint8_t *dataPtr = (uint8_t*) pFrameResult->detMatrix.data;
             messageTL.type = MMWDEMO_OUTPUT_MSG_INTRUSION_DET_3D_DET_MAT;
             messageTL.length = gMmwMssMCB.intrusionSigProcChainCfg.azimuthFftSize *
                                gMmwMssMCB.intrusionSigProcChainCfg.elevationFftSize *
@@ -764,13 +819,13 @@ void MmwDemo_transmitProcessedOutputTask()
         }
 
         /****************************************/
-        /* Send dbgDetMat3D                     */
+        /* Send dbgSnr3D                        */
         /****************************************/
         if ((gMmwMssMCB.runningMode == DPC_RUNNING_MODE_INDET) && gMmwMssMCB.dbgGuiMonSel.dbgSnr3D)
         {
             int32_t len, sendLen, startInd;
             MmwDemo_output_message_tl     messageTL;
-            uint8_t *dataPtr = (uint8_t*) gMmwMssMCB.snrOutMatrix.data;
+            uint8_t *dataPtr = (uint8_t*) pFrameResult->snrOutMatrix.data;
             messageTL.type = MMWDEMO_OUTPUT_MSG_INTRUSION_DET_3D_SNR;
             messageTL.length = gMmwMssMCB.intrusionSigProcChainCfg.azimuthFftSize *
                                gMmwMssMCB.intrusionSigProcChainCfg.elevationFftSize *
@@ -827,7 +882,7 @@ void MmwDemo_transmitProcessedOutputTask()
         {
             int32_t elInd;
             MmwDemo_output_message_tl     messageTL;
-            uint32_t *dataPtr = (uint32_t*) gMmwMssMCB.detMatrix.data;
+            uint32_t *dataPtr = (uint32_t*) pFrameResult->detMatrix.data;
             uint32_t numRngBins = gMmwMssMCB.numRangeBins;
             uint32_t azimFftSize = gMmwMssMCB.intrusionSigProcChainCfg.azimuthFftSize;
             uint32_t elevFftSize = gMmwMssMCB.intrusionSigProcChainCfg.elevationFftSize;
@@ -853,7 +908,7 @@ void MmwDemo_transmitProcessedOutputTask()
         {
             int32_t ind;
             MmwDemo_output_message_tl     messageTL;
-            uint16_t *dataPtr = (uint16_t*) gMmwMssMCB.snrOutMatrix.data;
+            uint16_t *dataPtr = (uint16_t*) pFrameResult->snrOutMatrix.data;
             uint32_t numRngBins = gMmwMssMCB.numRangeBins;
             uint32_t azimFftSize = gMmwMssMCB.intrusionSigProcChainCfg.azimuthFftSize;
             uint32_t elevFftSize = gMmwMssMCB.intrusionSigProcChainCfg.elevationFftSize;
@@ -922,7 +977,36 @@ void MmwDemo_transmitProcessedOutputTask()
         if ((gMmwMssMCB.runningMode == RUNNING_MODE_SBR) || (gMmwMssMCB.runningMode == RUNNING_MODE_CPD))
         {
             /*** Capon heatmap ***/
-            if (gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap)
+            if (gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap >= 2)
+            {
+                //Header
+                MmwDemo_uartWrite (uartHandle,
+                                (uint8_t*)&tl[tlvIdx],
+                                sizeof(MmwDemo_output_message_tl));
+
+                //Frame header and tiles
+                {
+                    uint8_t *data = gMmwMssMCB.outputFromDSP->heatMapDeltaOut.data;
+                    int32_t startInd, sendLen;
+                    int32_t chunkLen = 800;
+                    int32_t len = (int32_t) gMmwMssMCB.outputFromDSP->heatMapDeltaOut.length;
+
+                    for (startInd = 0; startInd < len; startInd += chunkLen)
+                    {
+                        if ((len - startInd) > chunkLen)
+                        {
+                            sendLen = chunkLen;
+                        }
+                        else
+                        {
+                            sendLen = len - startInd;
+                        }
+                        MmwDemo_uartWrite (uartHandle, &data[startInd], sendLen);
+                    }
+                }
+                tlvIdx++;
+            }
+            else if (gMmwMssMCB.dbgGuiMonSel.exportCoarseHeatmap)
             {
                 //Header
                 MmwDemo_uartWrite (uartHandle,
@@ -1053,6 +1137,25 @@ void MmwDemo_transmitProcessedOutputTask()
             }
         }
 
+        /********************************************/
+        /* Trace events */
+        if (gMmwMssMCB.dpcTraceCfg.exportTlv && (gMmwMssMCB.traceRing[DPC_TRACE_CORE_MSS] != NULL))
+        {
+            uint32_t count[2];
+            count[0] = numTraceEvents;
+            count[1] = numTraceLost;
+
+            MmwDemo_uartWrite (uartHandle,
+                            (uint8_t*)&tl[tlvIdx],
+                            sizeof(MmwDemo_output_message_tl));
+            MmwDemo_uartWrite (uartHandle, (uint8_t*)count, 2*sizeof(uint32_t));
+            if (numTraceEvents > 0)
+            {
+                MmwDemo_uartWrite (uartHandle, (uint8_t*)gTraceTlvEvents, numTraceEvents * sizeof(DPC_Trace_Event));
+            }
+            tlvIdx++;
+        }
+
         if(tlvIdx != 0)
         {
             /* Send padding bytes */
@@ -1073,9 +1176,25 @@ void MmwDemo_transmitProcessedOutputTask()
 
         /* End of UART data transmission */
         DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.uartTransCompletion);
+        DPC_TRACE_END(DPC_TRACE_ID_UART_TX, 0);
 
         gMmwMssMCB.outStats.transmitOutputTime = gMmwMssMCB.stats.uartTransCompletion.timeInUsec - gMmwMssMCB.stats.uartTransStart.timeInUsec;
 
+        if (pFrameResult != NULL)
+        {
+            gMmwMssMCB.uartFrameResultReadCount++;
+            if (gMmwMssMCB.dpcPipelineActive)
+            {
+                /* Buffers of the frame sent, the DPC may start the next frame */
+                SemaphoreP_post(&gMmwMssMCB.uartFrameResultFreeSemHandle);
+                if (gMmwMssMCB.uartFrameResultReadCount != gMmwMssMCB.uartFrameResultWriteCount)
+                {
+                    /* tlvSemHandle is binary, a result posted during this transmission may not be counted */
+                    SemaphoreP_post(&gMmwMssMCB.tlvSemHandle);
+                }
+            }
+        }
+
         //Interframe processing and UART data transmission completed
         gMmwMssMCB.interSubFrameProcToken--;
 
@@ -1162,6 +1281,7 @@ void MmwDemo_ClassifierTask()
         SemaphoreP_pend(&gMmwMssMCB.classifierTaskSemHandle, SystemP_WAIT_FOREVER);
 
         DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.pointCloudCompletion);
+        DPC_TRACE_BEGIN(DPC_TRACE_ID_CLASSIFIER_TASK, gMmwMssMCB.outputFromDSP->pointCloudOut.object_count);
 
         // copy to the format for output, and to future tracker
         outputFromDSP = gMmwMssMCB.outputFromDSP;
@@ -1278,6 +1398,7 @@ void MmwDemo_ClassifierTask()
         DPC_ObjectDetection_Profile(&gMmwMssMCB.stats.predictionsCompletion);
 
 #endif
+        DPC_TRACE_END(DPC_TRACE_ID_CLASSIFIER_TASK, 0);
     }
 }
 
@@ -1659,12 +1780,18 @@ void demo_in_cabin_sensing_6844_mss(void* args)
     errorCode = SemaphoreP_constructBinary(&gMmwMssMCB.tlvSemHandle, 0);
     DebugP_assert(SystemP_SUCCESS == errorCode);
 
+    errorCode = SemaphoreP_constructCounting(&gMmwMssMCB.uartFrameResultFreeSemHandle, 0, MMWDEMO_UART_FRAME_RESULT_NUM);
+    DebugP_assert(SystemP_SUCCESS == errorCode);
+
     errorCode = SemaphoreP_constructBinary(&gMmwMssMCB.adcFileTaskSemHandle, 0);
     DebugP_assert(SystemP_SUCCESS == errorCode);
 
     errorCode = SemaphoreP_constructBinary(&gMmwMssMCB.dpcTaskConfigDoneSemHandle, 0);
     DebugP_assert(SystemP_SUCCESS == errorCode);
 
+    errorCode = SemaphoreP_constructBinary(&gMmwMssMCB.dpcGraphSemHandle, 0);
+    DebugP_assert(SystemP_SUCCESS == errorCode);
+
     errorCode = SemaphoreP_constructBinary(&gMmwMssMCB.uartTaskConfigDoneSemHandle, 0);
     DebugP_assert(SystemP_SUCCESS == errorCode);
 
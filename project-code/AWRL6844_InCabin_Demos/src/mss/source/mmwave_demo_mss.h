@@ -49,6 +49,7 @@
 //#include <datapath/dpif/dpif_chcomp.h>
 
 #include <common_mss_dss/msg_ipc/msg_ipc.h>
+#include <common_mss_dss/dpc_trace/dpc_trace.h>
 #include <source/mmw_cli.h>
 #include <source/lvds_streaming/mmw_lvds_stream.h>
 #include <source/dpu/rangeproc/rangeproc.h>
@@ -82,6 +83,7 @@ extern "C" {
 
 /*! @brief Demo freeRTOS tasks priorities
  */
+#define MBOX_TASK_PRI (6U)
 #define DPC_TASK_PRI (5U)
 #define ADC_FILEREAD_TASK_PRI (4U)
 #define TLV_TASK_PRI (3U)
@@ -90,6 +92,7 @@ extern "C" {
 
 /*! @brief Demo freeRTOS tasks stack sizes
  */
+#define MBOX_TASK_STACK_SIZE 1024
 #define DPC_TASK_STACK_SIZE 8192
 #define ADC_FILEREAD_TASK_STACK_SIZE 1024
 #define TLV_TASK_STACK_SIZE 2048
@@ -573,6 +576,9 @@ typedef struct DPC_ObjectDetection_Stats_t
     uint32_t      uartTransferEndTimeStamp;
 
     DPC_ObjectDetectionRangeHWA_ProfileTimeStamp chirpingCompletion;
+    DPC_ObjectDetectionRangeHWA_ProfileTimeStamp doa3dCompletion;
+    DPC_ObjectDetectionRangeHWA_ProfileTimeStamp snr3dCompletion;
+    DPC_ObjectDetectionRangeHWA_ProfileTimeStamp nextFrameTrigger;
     DPC_ObjectDetectionRangeHWA_ProfileTimeStamp intrusionDetCompletion;
     DPC_ObjectDetectionRangeHWA_ProfileTimeStamp pointCloudCompletion;
     DPC_ObjectDetectionRangeHWA_ProfileTimeStamp featuresCompletion;
@@ -705,7 +711,7 @@ typedef struct MmwDemo_DbgGuiMonSel_t
     /*! @brief   For debugging: intrusion detection  */
     uint8_t       dbgSnrMatSlice;
 
-    /*! @brief   For debugging: SBR/CPD  */
+    /*! @brief   For debugging: SBR/CPD. Coarse heatmap: 1-float, 2-8-bit delta, 3-16-bit delta (heatmapExportCfg) */
     uint8_t     exportCoarseHeatmap;
     uint8_t     exportRawCfarDetList;
     uint8_t     exportZoomInHeatmap;
@@ -721,6 +727,49 @@ typedef struct MmwDemo_DbgGuiMonSel_t
 
 } MmwDemo_DbgGuiMonSel;
 
+/**
+ * @brief
+ *  DPC latency trace configuration
+ *
+ */
+typedef struct MmwDemo_DpcTraceCfg_t
+{
+    /*! @brief  1: MSS and DSS write trace events */
+    uint8_t     enabled;
+
+    /*! @brief  1: trace events are sent in the MMWDEMO_OUTPUT_DEBUG_TRACE_EVENTS TLV */
+    uint8_t     exportTlv;
+} MmwDemo_DpcTraceCfg;
+
+/**
+ * @brief
+ *  Capon heatmap delta export configuration, see heatmap_codec.h
+ *
+ */
+typedef struct MmwDemo_HeatmapExportCfg_t
+{
+    /*! @brief  1: set by the heatmapExportCfg command, otherwise the defaults of HeatmapCodec_getDefaultCfg are used */
+    uint8_t     configured;
+
+    /*! @brief  A tile is sent when a sample moved by more than deadband quantization steps */
+    uint8_t     deadband;
+
+    /*! @brief  Frames between two refreshes of the full heatmap, 0: first frame only */
+    uint16_t    keyFramePeriod;
+
+    /*! @brief  Log power of quantization level 0 */
+    float       floorDb;
+
+    /*! @brief  Quantization step, 0: default for the sample size */
+    float       stepDb;
+
+    /*! @brief  Heatmap bytes per frame, 0: default */
+    uint32_t    maxBytesPerFrame;
+} MmwDemo_HeatmapExportCfg;
+
+/*! @brief Maximum number of trace events per TLV */
+#define MMWDEMO_TRACE_TLV_MAX_EVENTS    256
+
 
 
 
@@ -1097,6 +1146,16 @@ typedef struct MmwDemo_IntrusionSigProcChainCfg_t
      */
     uint8_t selectCoherentPeakInDopplerDim;
 
+    /**
+     * @brief Range gating: 1 - 3D angle FFT computed only for range bins intersecting the occupancy boxes, 0 - all range bins
+     */
+    uint8_t rangeGateEnabled;
+
+    /**
+     * @brief Range gating margin in range bins, added on both sides of the occupancy box range extent
+     */
+    uint16_t rangeGateMargin;
+
 } MmwDemo_IntrusionSigProcChainCfg;
 
 /**
@@ -1117,6 +1176,29 @@ typedef struct MmwDemo_output_message_UARTintrusionDetInfo_t
     DPC_ObjectDetection_IntrusionDetResult intrusionDetResult;
 } MmwDemo_output_message_UARTintrusionDetInfo;
 
+/*! @brief Number of intrusion detection frame results the DPC task can hand to the UART task ahead of their transmission */
+#define MMWDEMO_UART_FRAME_RESULT_NUM      (2U)
+
+/**
+ * @brief
+ *  Intrusion detection frame result, handed by the DPC task to the UART task
+ *
+ * @details
+ *  With the DPC pipeline the next frame is processed while the UART task sends this one, so the UART task takes the
+ *  buffers of the frame from here and not from gMmwMssMCB.
+ */
+typedef struct MmwDemo_uartFrameResult_t
+{
+    /*! @brief SNR matrix of the frame, one of the ping-pong buffers with the DPC pipeline */
+    DPIF_DetMatrix  snrOutMatrix;
+
+    /*! @brief Detection matrix of the frame, single buffer */
+    DPIF_DetMatrix  detMatrix;
+
+    /*! @brief Intrusion detection result of the frame */
+    MmwDemo_output_message_UARTintrusionDetInfo intrusionDetInfo;
+} MmwDemo_uartFrameResult;
+
 /**
  * @brief
  *  Millimeter Wave Demo MCB
@@ -1174,6 +1256,10 @@ typedef struct MmwDemo_MSS_MCB_t
 
     /*! @brief   Semaphore Object  */
     SemaphoreP_Object            dpcTaskConfigDoneSemHandle;
+    /*! @brief   Semaphore Object to pend the DPC task on completion of an asynchronous DPC graph node */
+    SemaphoreP_Object            dpcGraphSemHandle;
+    /*! @brief   Semaphore Object to pend the mailbox task, posted by the DSS doorbell interrupt */
+    SemaphoreP_Object            mboxTaskSemHandle;
     /*! @brief   Semaphore Object  */
     SemaphoreP_Object            uartTaskConfigDoneSemHandle;
 
@@ -1306,6 +1392,39 @@ typedef struct MmwDemo_MSS_MCB_t
     /*! @brief Flag to control in low power mode some configuration parts to be executed only once, and not to be repeated from frame to frame */
     uint8_t                             oneTimeConfigDone;
 
+    /*! @brief Flag: 1-DPC pipeline enabled. In intrusion detection mode the next frame is triggered right after SNR3D,
+               the intrusion detection of the current frame overlaps the chirping and range processing of the next frame.
+               Not used in low power mode */
+    uint8_t                             dpcPipelineEnabled;
+
+    /*! @brief Flag: 1-DPC pipeline in use, latched from dpcPipelineEnabled, runningMode, lowPowerMode and the debug
+               outputs by DPC_Config */
+    uint8_t                             dpcPipelineActive;
+
+    /*! @brief Intrusion detection frame results handed to the UART task, indexed by the frame count modulo MMWDEMO_UART_FRAME_RESULT_NUM */
+    MmwDemo_uartFrameResult             uartFrameResult[MMWDEMO_UART_FRAME_RESULT_NUM];
+
+    /*! @brief Number of frame results written by the DPC task */
+    volatile uint32_t                   uartFrameResultWriteCount;
+
+    /*! @brief Number of frame results sent by the UART task */
+    volatile uint32_t                   uartFrameResultReadCount;
+
+    /*! @brief Counting semaphore of the frame results the DPC pipeline may start before the UART task sent the older ones */
+    SemaphoreP_Object                   uartFrameResultFreeSemHandle;
+
+    /*! @brief DPC latency trace configuration */
+    MmwDemo_DpcTraceCfg                 dpcTraceCfg;
+
+    /*! @brief Capon heatmap delta export configuration */
+    MmwDemo_HeatmapExportCfg            heatmapExportCfg;
+
+    /*! @brief Trace rings in L3, one per core, NULL if tracing is disabled */
+    DPC_Trace_Ring                      *traceRing[DPC_TRACE_NUM_CORES];
+
+    /*! @brief Trace ring reader positions, one per core */
+    uint32_t                            traceReadCount[DPC_TRACE_NUM_CORES];
+
     /*! @brief L3 ram memory pool object */
     MemPoolObj    L3RamObj;
 
@@ -1361,6 +1480,12 @@ typedef struct MmwDemo_MSS_MCB_t
     /*! @brief      SNR Matrix */
     DPIF_DetMatrix  snrOutMatrix;
 
+    /*! @brief      SNR Matrix ping-pong buffers, allocated when the DPC pipeline is enabled. snrOutMatrix points to the buffer of the last frame */
+    DPIF_DetMatrix  snrOutMatrixPingPong[2];
+
+    /*! @brief      Index of the SNR Matrix ping-pong buffer written by the current frame */
+    uint8_t         snrOutMatrixPingPongInd;
+
      /*! @brief      Doppler index matrix, type uint8, size = number range bins x number azimuth bins * number of elevation bins */
     DPIF_DetMatrix dopplerIndexMatrix;
 
@@ -1520,7 +1645,7 @@ typedef struct MmwDemo_MSS_MCB_t
 
 } MmwDemo_MSS_MCB;
 
-#define MMWDEMO_OUTPUT_ALL_MSG_MAX 11 //ToDo: rework this
+#define MMWDEMO_OUTPUT_ALL_MSG_MAX 12 //ToDo: rework this
 
 /*!
  * @brief
@@ -1568,10 +1693,16 @@ typedef enum mmwLab_output_message_type_e
     MMWDEMO_OUTPUT_DEBUG_MACRO_DOPPLER_FFT_VOXEL_HEATMAP = 2009,
     MMWDEMO_OUTPUT_DEBUG_PHASE_DOPPLER_FFT_VOXEL_HEATMAP = 2010,
 
+    /*! @brief   DPC trace events: numEvents, numLost, DPC_Trace_Event list */
+    MMWDEMO_OUTPUT_DEBUG_TRACE_EVENTS = 2011,
+
+    /*! @brief   Capon heatmap, quantized tiles changed since the previous frames, see heatmap_codec.h */
+    MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP_DELTA = 2012,
+
     MMWDEMO_OUTPUT_MSG_MAX = 13
 } mmwLab_output_message_type;
 
-#define MMWDEMO_OUTPUT_ALL_MSG_MAX 11 //ToDo: rework this
+#define MMWDEMO_OUTPUT_ALL_MSG_MAX 12 //ToDo: rework this
 
 /*!
  * @brief
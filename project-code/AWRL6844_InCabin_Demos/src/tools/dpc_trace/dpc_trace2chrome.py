@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Convert the DPC trace events of a UART capture into Chrome trace JSON
+
+The demo sends the events of the MSS and DSS trace rings in the MMWDEMO_OUTPUT_DEBUG_TRACE_EVENTS TLV when
+enabled with the CLI command "dpcTraceCfg 1 1". The output opens in chrome://tracing or https://ui.perfetto.dev,
+one process per core and one thread per activity, all on the frame reference timer time line.
+
+Usage
+  dpc_trace2chrome.py capture.bin trace.json
+
+capture.bin is the raw data port stream, as saved by a serial terminal or the visualizer.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = struct.pack('<4H', 0x0102, 0x0304, 0x0506, 0x0708)
+
+# MmwDemo_output_message_headerID
+HEADER_FMT = '<4HIIIII2HII'
+HEADER_LEN = struct.calcsize(HEADER_FMT)
+
+# MmwDemo_output_message_tl
+TL_FMT = '<II'
+TL_LEN = struct.calcsize(TL_FMT)
+
+TLV_TRACE_EVENTS = 2011
+
+# DPC_Trace_Event
+EVENT_FMT = '<IHBBII'
+EVENT_LEN = struct.calcsize(EVENT_FMT)
+
+TYPE_BEGIN = 0
+TYPE_END = 1
+TYPE_INSTANT = 2
+
+CORE_NAMES = {0: 'MSS (R5F)', 1: 'DSS (C66)'}
+
+# Threads of the MSS
+TID_GRAPH = 0
+TID_DSP = 1
+TID_CLASSIFIER = 2
+TID_UART = 3
+THREAD_NAMES = {
+    0: {TID_GRAPH: 'DPC graph', TID_DSP: 'DSP hand-off', TID_CLASSIFIER: 'Classifier task', TID_UART: 'UART task'},
+    1: {TID_GRAPH: 'Capon chain'},
+}
+
+# DPC_Trace_Id in common_mss_dss/dpc_trace/dpc_trace.h: id -> (name, thread)
+EVENT_NAMES = {
+    1: ('frameStart', TID_GRAPH),
+    2: ('rangeProc', TID_GRAPH),
+    3: ('doa3d', TID_GRAPH),
+    4: ('snr3d', TID_GRAPH),
+    5: ('rangeProfile', TID_GRAPH),
+    6: ('inDetect', TID_GRAPH),
+    7: ('dsp', TID_DSP),
+    8: ('macroDoppler', TID_GRAPH),
+    9: ('classifier', TID_GRAPH),
+    10: ('nextFrame', TID_GRAPH),
+    11: ('classifierTask', TID_CLASSIFIER),
+    12: ('uartTx', TID_UART),
+    32: ('dssFrame', TID_GRAPH),
+    33: ('dynHeatmap', TID_GRAPH),
+    34: ('dynCfar', TID_GRAPH),
+    35: ('dynAngle', TID_GRAPH),
+    36: ('staticHeatmap', TID_GRAPH),
+    37: ('staticCfar', TID_GRAPH),
+    38: ('staticAngle', TID_GRAPH),
+}
+
+TIMER_FREQ_HZ = 40000000
+
+
+def read_trace_tlvs(data):
+    """Yields (frameNumber, numLost, events) for every trace TLV of the capture"""
+    pos = data.find(MAGIC)
+    while pos >= 0 and pos + HEADER_LEN <= len(data):
+        header = struct.unpack_from(HEADER_FMT, data, pos)
+        total_len, frame_number, num_tlvs = header[5], header[7], header[11]
+        end = pos + total_len
+        tlv_pos = pos + HEADER_LEN
+        if end > len(data) or total_len < HEADER_LEN:
+            break
+        for _ in range(num_tlvs):
+            if tlv_pos + TL_LEN > end:
+                break
+            tlv_type, tlv_len = struct.unpack_from(TL_FMT, data, tlv_pos)
+            tlv_pos += TL_LEN
+            if tlv_pos + tlv_len > end:
+                break
+            if tlv_type == TLV_TRACE_EVENTS and tlv_len >= 8:
+                num_events, num_lost = struct.unpack_from('<II', data, tlv_pos)
+                num_events = min(num_events, (tlv_len - 8) // EVENT_LEN)
+                events = [struct.unpack_from(EVENT_FMT, data, tlv_pos + 8 + i * EVENT_LEN)
+                          for i in range(num_events)]
+                yield frame_number, num_lost, events
+            tlv_pos += tlv_len
+        pos = data.find(MAGIC, max(end, pos + 1))
+
+
+class Unwrapper:
+    """Extends the 32-bit timer to 64 bits. Events arrive nearly in time order, so small negative steps are
+    kept as such and only the forward steps move the reference"""
+
+    def __init__(self):
+        self.ref = None
+        self.ref_ext = 0
+
+    def __call__(self, ts):
+        if self.ref is None:
+            self.ref = ts
+            self.ref_ext = ts
+            return ts
+        delta = (ts - self.ref) & 0xFFFFFFFF
+        if delta >= 0x80000000:
+            delta -= 0x100000000
+        ext = self.ref_ext + delta
+        if delta > 0:
+            self.ref = ts
+            self.ref_ext = ext
+        return ext
+
+
+def convert(data):
+    unwrap = Unwrapper()
+    events = []
+    total_lost = 0
+    for _, num_lost, tlv_events in read_trace_tlvs(data):
+        total_lost += num_lost
+        for ts, ev_id, ev_type, core, frame, arg in tlv_events:
+            events.append((unwrap(ts), ev_type, ev_id, core, frame, arg))
+
+    if not events:
+        return {'traceEvents': []}, 0, 0
+
+    t0 = min(e[0] for e in events)
+    to_us = 1e6 / TIMER_FREQ_HZ
+
+    # Nodes traced after the fact, and events of different rings, are not in time order
+    events.sort(key=lambda e: (e[0], e[1] != TYPE_END))
+
+    out = []
+    for core, name in CORE_NAMES.items():
+        out.append({'ph': 'M', 'name': 'process_name', 'pid': core, 'tid': 0, 'args': {'name': name}})
+        for tid, tname in THREAD_NAMES[core].items():
+            out.append({'ph': 'M', 'name': 'thread_name', 'pid': core, 'tid': tid, 'args': {'name': tname}})
+
+    open_begin = {}
+    num_unmatched = 0
+    for t, ev_type, ev_id, core, frame, arg in events:
+        name, tid = EVENT_NAMES.get(ev_id, ('id%d' % ev_id, TID_GRAPH))
+        key = (core, ev_id)
+        if ev_type == TYPE_BEGIN:
+            if key in open_begin:
+                num_unmatched += 1
+            open_begin[key] = (t, frame, arg)
+        elif ev_type == TYPE_END:
+            begin = open_begin.pop(key, None)
+            if begin is None:
+                num_unmatched += 1
+                continue
+            out.append({'ph': 'X', 'name': name, 'pid': core, 'tid': tid,
+                        'ts': (begin[0] - t0) * to_us, 'dur': (t - begin[0]) * to_us,
+                        'args': {'frame': begin[1], 'beginArg': begin[2], 'endArg': arg}})
+        else:
+            out.append({'ph': 'i', 's': 't', 'name': name, 'pid': core, 'tid': tid,
+                        'ts': (t - t0) * to_us, 'args': {'frame': frame, 'arg': arg}})
+    num_unmatched += len(open_begin)
+
+    return {'traceEvents': out, 'displayTimeUnit': 'ms'}, total_lost, num_unmatched
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('capture', help='raw UART data port capture')
+    parser.add_argument('output', help='Chrome trace JSON')
+    args = parser.parse_args()
+
+    with open(args.capture, 'rb') as f:
+        data = f.read()
+
+    trace, num_lost, num_unmatched = convert(data)
+    with open(args.output, 'w') as f:
+        json.dump(trace, f)
+
+    print('%d trace events, %d lost on target, %d unmatched begin/end' %
+          (len(trace['traceEvents']), num_lost, num_unmatched))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
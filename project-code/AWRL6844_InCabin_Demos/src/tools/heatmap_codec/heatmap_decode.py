@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Decode the Capon heatmap delta export of a UART capture
+
+With "dbgGuiMonitor" exporting the coarse heatmap in mode 2 (8-bit) or 3 (16-bit), the demo sends the heatmap tiles
+that changed since the previous frames in the MMWDEMO_OUTPUT_DEBUG_CAPON_HEATMAP_DELTA TLV, see
+common_mss_dss/heatmap_codec/heatmap_codec.h. The decoder applies the tiles frame after frame and writes the
+reconstructed heatmaps in dB, NaN where the tile has not been received since the last loss or configuration change.
+
+Usage
+  heatmap_decode.py capture.bin heatmap.npz
+
+heatmap.npz holds
+  frame_number  frame number of the output packet, per frame
+  frame_seq     encoder frame sequence, per frame
+  heatmap_db    [frame][angle][range] when the samples fill the geometry, [frame][sample] otherwise
+  scan_complete 1 for the frames flagged HEATMAP_CODEC_FLAG_SCAN_COMPLETE, per frame: only those are within
+                (deadband + 0.5) * stepDb dB of the device heatmap, the others may hold tiles of earlier frames
+  num_lost      frames lost by the decoder
+
+capture.bin is the raw data port stream, as saved by a serial terminal or the visualizer.
+"""
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = struct.pack('<4H', 0x0102, 0x0304, 0x0506, 0x0708)
+
+# MmwDemo_output_message_headerID
+HEADER_FMT = '<4HIIIII2HII'
+HEADER_LEN = struct.calcsize(HEADER_FMT)
+
+# MmwDemo_output_message_tl
+TL_FMT = '<II'
+TL_LEN = struct.calcsize(TL_FMT)
+
+TLV_CAPON_HEATMAP_DELTA = 2012
+
+# HeatmapCodec_FrameHeader
+FRAME_HEADER_FMT = '<II3HBBffHHI'
+FRAME_HEADER_LEN = struct.calcsize(FRAME_HEADER_FMT)
+
+# HeatmapCodec_TileHeader
+TILE_HEADER_FMT = '<HH'
+TILE_HEADER_LEN = struct.calcsize(TILE_HEADER_FMT)
+
+TILE_SIZE = 64
+FLAG_REFRESH = 0x01
+FLAG_SCAN_COMPLETE = 0x02
+
+
+def read_delta_tlvs(data):
+    """Yields (frameNumber, payload) for every heatmap delta TLV of the capture"""
+    pos = data.find(MAGIC)
+    while pos >= 0 and pos + HEADER_LEN <= len(data):
+        header = struct.unpack_from(HEADER_FMT, data, pos)
+        total_len, frame_number, num_tlvs = header[5], header[7], header[11]
+        end = pos + total_len
+        tlv_pos = pos + HEADER_LEN
+        if end > len(data) or total_len < HEADER_LEN:
+            break
+        for _ in range(num_tlvs):
+            if tlv_pos + TL_LEN > end:
+                break
+            tlv_type, tlv_len = struct.unpack_from(TL_FMT, data, tlv_pos)
+            tlv_pos += TL_LEN
+            if tlv_pos + tlv_len > end:
+                break
+            if tlv_type == TLV_CAPON_HEATMAP_DELTA:
+                yield frame_number, data[tlv_pos:tlv_pos + tlv_len]
+            tlv_pos += tlv_len
+        pos = data.find(MAGIC, max(end, pos + 1))
+
+
+class Decoder:
+    """Same rules as HeatmapCodec_decode()"""
+
+    def __init__(self):
+        self.params = None
+        self.q = None
+        self.valid = None
+        self.last_seq = None
+        self.num_lost = 0
+
+    def decode(self, payload):
+        if len(payload) < FRAME_HEADER_LEN:
+            raise ValueError('truncated frame header')
+        (seq, num_samples, num_range, num_azim, num_elev, bits, flags, floor_db, step_db,
+         tile_size, num_tiles, payload_len) = struct.unpack_from(FRAME_HEADER_FMT, payload, 0)
+        if payload_len > len(payload) or tile_size != TILE_SIZE or bits not in (8, 16):
+            raise ValueError('inconsistent frame header')
+
+        params = (num_samples, bits, floor_db, step_db)
+        if params != self.params:
+            self.params = params
+            self.q = np.zeros(num_samples, dtype=np.uint16)
+            self.valid = np.zeros((num_samples + TILE_SIZE - 1) // TILE_SIZE, dtype=bool)
+        elif seq != (self.last_seq + 1) & 0xFFFFFFFF:
+            self.num_lost += (seq - self.last_seq - 1) & 0xFFFFFFFF
+            self.valid[:] = False
+        self.last_seq = seq
+
+        dtype = np.dtype('<u1') if bits == 8 else np.dtype('<u2')
+        pos = FRAME_HEADER_LEN
+        for _ in range(num_tiles):
+            tile_idx, n = struct.unpack_from(TILE_HEADER_FMT, payload, pos)
+            first = tile_idx * TILE_SIZE
+            record_len = TILE_HEADER_LEN + ((n * dtype.itemsize + 3) & ~3)
+            if n > TILE_SIZE or first + n > num_samples or pos + record_len > payload_len:
+                raise ValueError('inconsistent tile')
+            self.q[first:first + n] = np.frombuffer(payload, dtype=dtype, count=n, offset=pos + TILE_HEADER_LEN)
+            self.valid[tile_idx] = True
+            pos += record_len
+
+        db = floor_db + step_db * self.q.astype(np.float32)
+        db[~np.repeat(self.valid, TILE_SIZE)[:num_samples]] = np.nan
+        if num_samples == num_range * num_azim * num_elev:
+            db = db.reshape(num_azim * num_elev, num_range)
+        return seq, flags, db
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('capture', help='raw UART data port capture')
+    parser.add_argument('output', help='numpy .npz output')
+    args = parser.parse_args()
+
+    with open(args.capture, 'rb') as f:
+        data = f.read()
+
+    decoder = Decoder()
+    frame_numbers, frame_seqs, scan_complete, heatmaps = [], [], [], []
+    num_bytes = 0
+    num_refresh = 0
+    for frame_number, payload in read_delta_tlvs(data):
+        try:
+            seq, flags, db = decoder.decode(payload)
+        except ValueError as e:
+            print('frame %d: %s, skipped' % (frame_number, e))
+            continue
+        if heatmaps and db.shape != heatmaps[-1].shape:
+            print('frame %d: heatmap geometry changed, earlier frames dropped' % frame_number)
+            frame_numbers, frame_seqs, scan_complete, heatmaps = [], [], [], []
+        frame_numbers.append(frame_number)
+        frame_seqs.append(seq)
+        scan_complete.append((flags & FLAG_SCAN_COMPLETE) != 0)
+        heatmaps.append(db)
+        num_bytes += len(payload)
+        num_refresh += (flags & FLAG_REFRESH) != 0
+
+    np.savez_compressed(args.output, frame_number=np.array(frame_numbers, dtype=np.uint32),
+                        frame_seq=np.array(frame_seqs, dtype=np.uint32),
+                        scan_complete=np.array(scan_complete, dtype=np.uint8),
+                        heatmap_db=np.array(heatmaps, dtype=np.float32), num_lost=decoder.num_lost)
+
+    num_frames = len(heatmaps)
+    print('%d frames, %d complete scans, %d lost, %d refreshes, %.0f bytes per frame' %
+          (num_frames, sum(scan_complete), decoder.num_lost, num_refresh,
+           num_bytes / num_frames if num_frames else 0.0))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
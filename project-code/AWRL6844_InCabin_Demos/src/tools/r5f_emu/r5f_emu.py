@@ -0,0 +1,1315 @@
+#
+# Copyright (C) 2024 Texas Instruments Incorporated - http://www.ti.com/
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#
+#   Redistributions of source code must retain the above copyright
+#   notice, this list of conditions and the following disclaimer.
+#
+#   Redistributions in binary form must reproduce the above copyright
+#   notice, this list of conditions and the following disclaimer in the
+#   documentation and/or other materials provided with the
+#   distribution.
+#
+#   Neither the name of Texas Instruments Incorporated nor the names of
+#   its contributors may be used to endorse or promote products derived
+#   from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+
+"""Run functions of the prebuilt R5F algorithm libraries on the host
+
+The MSS algorithm libraries (alg/*/lib/*.r5f.ti-arm-clang.release.lib) are archives of ELF relocatable objects with
+Thumb-2 and VFPv3 code. This module links the objects of a library into a flat memory and interprets the
+instructions, so that the host checks of the open implementations can compare their outputs with the outputs of
+the library itself:
+
+    emu = R5F(['alg_cnnClassifier.xwrL684x.r5f.ti-arm-clang.release.lib'])
+    x = emu.alloc_array(np.float32, features)
+    emu.call('cnn_classifier_predict', handle, x, p)
+
+Only the user mode instructions emitted by the compiler for the libraries are implemented: ARMv7-R Thumb-2 integer
+instructions, including the hardware divide, and the VFPv3-D16 instructions. Anything else raises EmulatorError, so
+an unsupported instruction cannot go unnoticed. Single precision operations are computed in double precision and
+rounded once to single precision, which is exact for add, subtract, multiply, divide and square root. Denormals
+are not flushed.
+
+The undefined symbols of the objects are resolved to host functions: malloc, free, the memory allocation
+callbacks of the algorithms (<name>_malloc, <name>_free), the run-time memset/memcpy helpers, and the functions
+passed in hooks. malloc returns memory filled with 0xCD, so that a read of uninitialized memory shows up in the
+outputs.
+"""
+
+import struct
+
+import numpy as np
+
+RETURN_ADDRESS = 0xFFFFFFF0
+CODE_BASE = 0x00010000
+HEAP_BASE = 0x01000000
+STACK_TOP = 0x01F00000
+MEMORY_SIZE = 0x02000000
+
+R_ARM_ABS32 = 2
+R_ARM_THM_CALL = 10
+R_ARM_THM_JUMP24 = 30
+R_ARM_THM_MOVW_ABS_NC = 47
+R_ARM_THM_MOVT_ABS = 48
+R_ARM_NONE_TYPES = (0, 40, 42)   # R_ARM_NONE, R_ARM_V4BX, R_ARM_PREL31 (exception tables, not loaded)
+
+SHT_PROGBITS = 1
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHT_REL = 9
+SHF_ALLOC = 2
+
+_F32 = struct.Struct('<f')
+_U32 = struct.Struct('<I')
+_F64 = struct.Struct('<d')
+_U64 = struct.Struct('<Q')
+
+
+class EmulatorError(Exception):
+    pass
+
+
+def _u32(x):
+    return x & 0xFFFFFFFF
+
+
+def _s32(x):
+    x &= 0xFFFFFFFF
+    return x - 0x100000000 if x & 0x80000000 else x
+
+
+def _sext(x, n):
+    return x - (1 << n) if x & (1 << (n - 1)) else x
+
+
+def _ror(x, n):
+    n &= 31
+    return ((x >> n) | (x << (32 - n))) & 0xFFFFFFFF if n else x
+
+
+def f32_bits(v):
+    """Round a Python float to single precision, and return its bits"""
+    try:
+        return _U32.unpack(_F32.pack(v))[0]
+    except OverflowError:
+        return 0xFF800000 if v < 0 else 0x7F800000
+
+
+def bits_f32(u):
+    return _F32.unpack(_U32.pack(u))[0]
+
+
+def _f64_bits(v):
+    return _U64.unpack(_F64.pack(v))[0]
+
+
+def _bits_f64(u):
+    return _F64.unpack(_U64.pack(u))[0]
+
+
+def read_archive(path):
+    """Members of a System V / GNU ar archive, as (name, bytes)"""
+    data = open(path, 'rb').read()
+    if data[:8] != b'!<arch>\n':
+        raise EmulatorError('%s: not an ar archive' % path)
+    members = []
+    names = b''
+    pos = 8
+    while pos + 60 <= len(data):
+        name = data[pos:pos + 16].decode().strip()
+        size = int(data[pos + 48:pos + 58])
+        body = data[pos + 60:pos + 60 + size]
+        pos += 60 + size + (size & 1)
+        if name == '//':
+            names = body
+        elif name in ('/', '/SYM64/'):
+            continue
+        else:
+            if name.startswith('/') and name[1:].isdigit():
+                off = int(name[1:])
+                name = names[off:names.index(b'\n', off)].decode()
+            members.append((name.rstrip('/'), body))
+    return members
+
+
+class _Object:
+    """Sections, symbols and relocations of an ELF32 little endian relocatable object"""
+
+    def __init__(self, name, data):
+        if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+            raise EmulatorError('%s: not an ELF32 little endian object' % name)
+        self.name = name
+        shoff = _U32.unpack_from(data, 0x20)[0]
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            sh = struct.unpack_from('<10I', data, shoff + i * shentsize)
+            self.sections.append({'name_off': sh[0], 'type': sh[1], 'flags': sh[2], 'offset': sh[4], 'size': sh[5],
+                                  'link': sh[6], 'info': sh[7], 'align': max(sh[8], 1)})
+        strtab = self.sections[shstrndx]
+        for s in self.sections:
+            s['name'] = self._string(data, strtab, s['name_off'])
+            s['data'] = data[s['offset']:s['offset'] + s['size']] if s['type'] != SHT_NOBITS else bytes(s['size'])
+        self.symbols = []
+        for s in self.sections:
+            if s['type'] == SHT_SYMTAB:
+                names = self.sections[s['link']]
+                for j in range(s['size'] // 16):
+                    st_name, value, size, info, _, shndx = struct.unpack_from('<IIIBBH', data, s['offset'] + 16 * j)
+                    self.symbols.append({'name': self._string(data, names, st_name), 'value': value, 'size': size,
+                                         'bind': info >> 4, 'type': info & 15, 'shndx': shndx})
+        self.relocations = {}
+        for s in self.sections:
+            if s['type'] == SHT_REL:
+                self.relocations[s['info']] = [struct.unpack_from('<II', data, s['offset'] + 8 * j)
+                                               for j in range(s['size'] // 8)]
+
+    @staticmethod
+    def _string(data, table, off):
+        start = table['offset'] + off
+        return data[start:data.index(b'\0', start)].decode()
+
+
+class R5F:
+    """Flat memory with the linked library objects, and a Thumb-2/VFPv3 interpreter
+
+    libraries   paths of .lib archives or ELF objects
+    hooks       {symbol: function(emu)} implementing undefined symbols on the host. The function reads its
+                arguments from emu.r / emu.s and writes the result to emu.r[0] or emu.s[0]
+    """
+
+    def __init__(self, libraries, hooks=None):
+        self.mem = bytearray(MEMORY_SIZE)
+        self.r = [0] * 16
+        self.s = [0] * 64
+        self.n = self.z = self.c = self.v = 0
+        self.fpscr_nzcv = 0
+        self.it = 0
+        self.in_it = False
+        self.heap = HEAP_BASE
+        self.symbols = {}
+        self.local_symbols = {}
+        self.hooks = {}
+        self.instructions = 0
+        self._cache = {}
+        self._link(libraries, dict(hooks or {}))
+
+    # Linking
+
+    def _link(self, libraries, hooks):
+        objects = []
+        for path in libraries:
+            data = open(path, 'rb').read()
+            if data[:8] == b'!<arch>\n':
+                objects += [_Object(name, body) for name, body in read_archive(path)]
+            else:
+                objects.append(_Object(path, data))
+
+        addr = CODE_BASE
+        placed = []
+        for obj in objects:
+            base = {}
+            for i, s in enumerate(obj.sections):
+                if (s['flags'] & SHF_ALLOC) and s['type'] in (SHT_PROGBITS, SHT_NOBITS) and s['size'] > 0:
+                    addr = (addr + s['align'] - 1) & ~(s['align'] - 1)
+                    base[i] = addr
+                    self.mem[addr:addr + s['size']] = s['data']
+                    addr += s['size']
+            for sym in obj.symbols:
+                if sym['shndx'] in base and sym['name'] and not sym['name'].startswith('$'):
+                    a = base[sym['shndx']] + sym['value']
+                    if sym['bind'] == 0:
+                        self.local_symbols[(obj.name, sym['name'])] = a
+                    elif sym['name'] not in self.symbols:
+                        self.symbols[sym['name']] = a
+            placed.append((obj, base))
+
+        def host(name):
+            if name in hooks:
+                return hooks[name]
+            if name == 'malloc' or name.endswith('_malloc'):
+                return lambda emu: emu.r.__setitem__(0, emu.malloc(emu.r[0]))
+            if name == 'free' or name.endswith('_free'):
+                return lambda emu: None
+            if name.startswith('__aeabi_memclr'):
+                return lambda emu: emu.mem.__setitem__(slice(emu.r[0], emu.r[0] + emu.r[1]), bytes(emu.r[1]))
+            if name.startswith('__aeabi_memset'):
+                return lambda emu: emu.mem.__setitem__(slice(emu.r[0], emu.r[0] + emu.r[1]),
+                                                       bytes([emu.r[2] & 0xFF]) * emu.r[1])
+            if name == 'memset':
+                return lambda emu: emu.mem.__setitem__(slice(emu.r[0], emu.r[0] + emu.r[2]),
+                                                       bytes([emu.r[1] & 0xFF]) * emu.r[2])
+            if name.startswith('__aeabi_memcpy') or name.startswith('__aeabi_memmove') or name in ('memcpy', 'memmove'):
+                return lambda emu: emu.mem.__setitem__(slice(emu.r[0], emu.r[0] + emu.r[2]),
+                                                       bytes(emu.mem[emu.r[1]:emu.r[1] + emu.r[2]]))
+            return None
+
+        for obj, base in placed:
+            for sym in obj.symbols:
+                name = sym['name']
+                if sym['shndx'] == 0 and name and name not in self.symbols:
+                    fn = host(name)
+                    if fn is None:
+                        continue
+                    addr = (addr + 3) & ~3
+                    self.mem[addr:addr + 2] = b'\x70\x47'   # bx lr, never executed
+                    self.hooks[addr] = fn
+                    self.symbols[name] = addr | 1
+                    addr += 4
+        self.end = addr
+
+        for obj, base in placed:
+            for sec_index, relocations in obj.relocations.items():
+                if sec_index not in base:
+                    continue
+                for offset, info in relocations:
+                    rtype = info & 0xFF
+                    if rtype in R_ARM_NONE_TYPES:
+                        continue
+                    sym = obj.symbols[info >> 8]
+                    if sym['shndx'] in base:
+                        if sym['type'] == 3:    # STT_SECTION
+                            target = base[sym['shndx']]
+                        else:
+                            target = base[sym['shndx']] + sym['value']
+                    elif sym['name'] in self.symbols:
+                        target = self.symbols[sym['name']]
+                    else:
+                        raise EmulatorError('%s: undefined symbol %s' % (obj.name, sym['name']))
+                    self._relocate(base[sec_index] + offset, rtype, target)
+
+    def _relocate(self, p, rtype, s):
+        m = self.mem
+        if rtype == R_ARM_ABS32:
+            a = _U32.unpack_from(m, p)[0]
+            _U32.pack_into(m, p, _u32(s + a))
+        elif rtype in (R_ARM_THM_MOVW_ABS_NC, R_ARM_THM_MOVT_ABS):
+            h1, h2 = struct.unpack_from('<HH', m, p)
+            a = _sext(((h1 & 0xF) << 12) | (((h1 >> 10) & 1) << 11) | (((h2 >> 12) & 7) << 8) | (h2 & 0xFF), 16)
+            v = _u32(s + a)
+            v = (v & 0xFFFF) if rtype == R_ARM_THM_MOVW_ABS_NC else (v >> 16)
+            h1 = (h1 & 0xFBF0) | (v >> 12) | (((v >> 11) & 1) << 10)
+            h2 = (h2 & 0x8F00) | (((v >> 8) & 7) << 12) | (v & 0xFF)
+            struct.pack_into('<HH', m, p, h1, h2)
+        elif rtype in (R_ARM_THM_CALL, R_ARM_THM_JUMP24):
+            if not s & 1:
+                raise EmulatorError('branch to ARM state code at 0x%x' % p)
+            h1, h2 = struct.unpack_from('<HH', m, p)
+            off = (s & ~1) - (p + 4)
+            sign = (off >> 24) & 1
+            j1 = (~(((off >> 23) & 1) ^ sign)) & 1
+            j2 = (~(((off >> 22) & 1) ^ sign)) & 1
+            h1 = (h1 & 0xF800) | (sign << 10) | ((off >> 12) & 0x3FF)
+            h2 = (h2 & 0xD000) | (j1 << 13) | (j2 << 11) | ((off >> 1) & 0x7FF)
+            struct.pack_into('<HH', m, p, h1, h2)
+        else:
+            raise EmulatorError('unsupported relocation type %d at 0x%x' % (rtype, p))
+
+    # Memory
+
+    def symbol(self, name, obj=None):
+        """Address of a global symbol, or of a local symbol of the named object"""
+        if obj is not None:
+            return self.local_symbols[(obj, name)]
+        return self.symbols[name]
+
+    def malloc(self, size):
+        self.heap = (self.heap + 7) & ~7
+        a = self.heap
+        self.heap += size
+        if self.heap > STACK_TOP - 0x100000:
+            raise EmulatorError('heap exhausted')
+        self.mem[a:a + size] = b'\xCD' * size
+        return a
+
+    def alloc_array(self, dtype, values):
+        data = np.ascontiguousarray(values, dtype=dtype).tobytes()
+        a = self.malloc(len(data))
+        self.mem[a:a + len(data)] = data
+        return a
+
+    def write_array(self, addr, dtype, values):
+        data = np.ascontiguousarray(values, dtype=dtype).tobytes()
+        self.mem[addr:addr + len(data)] = data
+
+    def read_array(self, addr, dtype, count):
+        dtype = np.dtype(dtype)
+        return np.frombuffer(bytes(self.mem[addr:addr + count * dtype.itemsize]), dtype=dtype).copy()
+
+    def _rd(self, a, size):
+        if a + size > MEMORY_SIZE or a < 0x1000:
+            raise EmulatorError('read of 0x%08x at pc 0x%x' % (a, self.cur))
+        return int.from_bytes(self.mem[a:a + size], 'little')
+
+    def _wr(self, a, size, v):
+        if a + size > MEMORY_SIZE or a < CODE_BASE:
+            raise EmulatorError('write of 0x%08x at pc 0x%x' % (a, self.cur))
+        self.mem[a:a + size] = (v & ((1 << (8 * size)) - 1)).to_bytes(size, 'little')
+
+    # Calls
+
+    def call(self, name, *args, fargs=(), max_instructions=10 ** 9):
+        """Call a function with the AAPCS VFP calling convention: integer and pointer arguments in r0-r3 then on the
+        stack, single precision arguments in s0-s15. Returns r0, the single precision result is in bits_f32(emu.s[0])"""
+        self.r[13] = STACK_TOP
+        stack_args = [_u32(a) for a in args[4:]]
+        self.r[13] -= 4 * len(stack_args) + ((4 * len(stack_args)) & 4)
+        for i, a in enumerate(stack_args):
+            _U32.pack_into(self.mem, self.r[13] + 4 * i, a)
+        for i, a in enumerate(args[:4]):
+            self.r[i] = _u32(a)
+        for i, a in enumerate(fargs):
+            self.s[i] = f32_bits(a)
+        self.r[14] = RETURN_ADDRESS | 1
+        self.it = 0
+        self.pc = self.symbols[name] & ~1
+        self._run(max_instructions)
+        return self.r[0]
+
+    def _run(self, max_instructions):
+        cache = self._cache
+        count = 0
+        while self.pc != RETURN_ADDRESS:
+            pc = self.pc
+            hook = self.hooks.get(pc)
+            if hook is not None:
+                self.cur = pc
+                hook(self)
+                self.pc = self.r[14] & ~1
+                continue
+            entry = cache.get(pc)
+            if entry is None:
+                entry = cache[pc] = self._decode(pc)
+            size, fn = entry
+            if self.it:
+                cond = self.it >> 4
+                self.it = 0 if (self.it & 0xF) == 0x8 else (self.it & 0xE0) | ((self.it << 1) & 0x1F)
+                if not self._cond(cond):
+                    self.pc = pc + size
+                    continue
+                self.in_it = True
+            else:
+                self.in_it = False
+            self.cur = pc
+            self.next = pc + size
+            fn()
+            self.pc = self.next
+            count += 1
+            if count > max_instructions:
+                raise EmulatorError('more than %d instructions' % max_instructions)
+        self.instructions += count
+
+    # Helpers
+
+    def _cond(self, c):
+        n, z, cf, v = self.n, self.z, self.c, self.v
+        if c == 0: return z == 1
+        if c == 1: return z == 0
+        if c == 2: return cf == 1
+        if c == 3: return cf == 0
+        if c == 4: return n == 1
+        if c == 5: return n == 0
+        if c == 6: return v == 1
+        if c == 7: return v == 0
+        if c == 8: return cf == 1 and z == 0
+        if c == 9: return cf == 0 or z == 1
+        if c == 10: return n == v
+        if c == 11: return n != v
+        if c == 12: return z == 0 and n == v
+        if c == 13: return z == 1 or n != v
+        return True
+
+    def _nz(self, v):
+        self.n = v >> 31
+        self.z = 1 if v == 0 else 0
+
+    def _add_flags(self, a, b, carry):
+        us = a + b + carry
+        res = us & 0xFFFFFFFF
+        self.n = res >> 31
+        self.z = 1 if res == 0 else 0
+        self.c = 1 if us > 0xFFFFFFFF else 0
+        self.v = 1 if _s32(a) + _s32(b) + carry != _s32(res) else 0
+        return res
+
+    def _shift_c(self, v, stype, n, carry):
+        """Shift with carry out, stype 0..3 = LSL, LSR, ASR, ROR (ROR #0 = RRX), immediate shift amount n"""
+        if stype == 0:
+            if n == 0:
+                return v, carry
+            return (v << n) & 0xFFFFFFFF, (v >> (32 - n)) & 1
+        if stype == 1:
+            n = n or 32
+            return (v >> n) if n < 32 else 0, (v >> (n - 1)) & 1
+        if stype == 2:
+            n = n or 32
+            return _u32(_s32(v) >> min(n, 31)), (v >> (min(n, 32) - 1)) & 1
+        if n == 0:
+            return (v >> 1) | (carry << 31), v & 1
+        res = _ror(v, n)
+        return res, res >> 31
+
+    def _shift_reg(self, v, stype, n):
+        """Shift by a register amount (low byte), returns value and carry out"""
+        carry = self.c
+        if n == 0:
+            return v, carry
+        if stype == 0:
+            return ((v << n) & 0xFFFFFFFF if n < 32 else 0), ((v >> (32 - n)) & 1 if n <= 32 else 0)
+        if stype == 1:
+            return (v >> n if n < 32 else 0), ((v >> (n - 1)) & 1 if n <= 32 else 0)
+        if stype == 2:
+            return _u32(_s32(v) >> min(n, 31)), ((v >> (n - 1)) & 1 if n < 32 else v >> 31)
+        res = _ror(v, n)
+        return res, res >> 31
+
+    def _reg(self, i):
+        return (self.cur + 4) if i == 15 else self.r[i]
+
+    def _branch_to(self, target):
+        self.next = RETURN_ADDRESS if (target & ~1) == RETURN_ADDRESS else target & ~1
+
+    def _load(self, addr, size, signed):
+        v = self._rd(addr, size)
+        if signed:
+            v = _u32(_sext(v, 8 * size))
+        return v
+
+    def _set_rt(self, t, v):
+        if t == 15:
+            self._branch_to(v)
+        else:
+            self.r[t] = v
+
+    def _fget(self, i, dp):
+        if dp:
+            return _bits_f64(self.s[2 * i] | (self.s[2 * i + 1] << 32))
+        return _F32.unpack(_U32.pack(self.s[i]))[0]
+
+    def _fset(self, i, dp, v):
+        if dp:
+            u = _f64_bits(v)
+            self.s[2 * i] = u & 0xFFFFFFFF
+            self.s[2 * i + 1] = u >> 32
+        else:
+            self.s[i] = f32_bits(v)
+
+    def _undefined(self, h1, h2=None):
+        raise EmulatorError('unsupported instruction %04x%s at 0x%x'
+                            % (h1, '' if h2 is None else ' %04x' % h2, self.cur))
+
+    # Decoding: each instruction is decoded once into a closure
+
+    def _decode(self, pc):
+        h1 = _U32.unpack_from(self.mem, pc)[0] & 0xFFFF
+        if (h1 >> 11) in (0x1D, 0x1E, 0x1F):
+            h2 = struct.unpack_from('<H', self.mem, pc + 2)[0]
+            return 4, self._decode32(pc, h1, h2)
+        return 2, self._decode16(pc, h1)
+
+    def _decode16(self, pc, h):
+        r = self.r
+        emu = self
+        top5 = h >> 11
+
+        if top5 == 0b00011:
+            rd, rn, x = h & 7, (h >> 3) & 7, (h >> 6) & 7
+            imm, sub = (h >> 10) & 1, (h >> 9) & 1
+
+            def fn():
+                b = x if imm else r[x]
+                if emu.in_it:
+                    r[rd] = _u32(r[rn] - b) if sub else _u32(r[rn] + b)
+                else:
+                    r[rd] = emu._add_flags(r[rn], _u32(~b), 1) if sub else emu._add_flags(r[rn], b, 0)
+            return fn
+        if top5 <= 0b00010:
+            stype, imm, rm, rd = top5, (h >> 6) & 31, (h >> 3) & 7, h & 7
+
+            def fn():
+                v, c = emu._shift_c(r[rm], stype, imm, emu.c)
+                r[rd] = v
+                if not emu.in_it:
+                    emu._nz(v)
+                    emu.c = c
+            return fn
+        if (h >> 13) == 0b001:
+            op, rd, imm = (h >> 11) & 3, (h >> 8) & 7, h & 0xFF
+
+            def fn():
+                if op == 0:
+                    r[rd] = imm
+                    if not emu.in_it:
+                        emu._nz(imm)
+                elif op == 1:
+                    emu._add_flags(r[rd], _u32(~imm), 1)
+                elif op == 2:
+                    r[rd] = _u32(r[rd] + imm) if emu.in_it else emu._add_flags(r[rd], imm, 0)
+                else:
+                    r[rd] = _u32(r[rd] - imm) if emu.in_it else emu._add_flags(r[rd], _u32(~imm), 1)
+            return fn
+        if (h >> 10) == 0b010000:
+            op, rm, rd = (h >> 6) & 15, (h >> 3) & 7, h & 7
+
+            def fn():
+                a, b = r[rd], r[rm]
+                flags = not emu.in_it
+                if op == 0: v = a & b
+                elif op == 1: v = a ^ b
+                elif op in (2, 3, 4, 7):
+                    v, c = emu._shift_reg(a, {2: 0, 3: 1, 4: 2, 7: 3}[op], b & 0xFF)
+                    if flags:
+                        emu.c = c
+                elif op == 5:
+                    if flags:
+                        r[rd] = emu._add_flags(a, b, emu.c)
+                    else:
+                        r[rd] = _u32(a + b + emu.c)
+                    return
+                elif op == 6:
+                    if flags:
+                        r[rd] = emu._add_flags(a, _u32(~b), emu.c)
+                    else:
+                        r[rd] = _u32(a - b - 1 + emu.c)
+                    return
+                elif op == 8:
+                    emu._nz(a & b)
+                    return
+                elif op == 9:
+                    r[rd] = emu._add_flags(_u32(~b), 0, 1) if flags else _u32(-b)
+                    return
+                elif op == 10:
+                    emu._add_flags(a, _u32(~b), 1)
+                    return
+                elif op == 11:
+                    emu._add_flags(a, b, 0)
+                    return
+                elif op == 12: v = a | b
+                elif op == 13: v = _u32(a * b)
+                elif op == 14: v = a & ~b & 0xFFFFFFFF
+                else: v = ~b & 0xFFFFFFFF
+                r[rd] = v
+                if flags:
+                    emu._nz(v)
+            return fn
+        if (h >> 10) == 0b010001:
+            op, rm, rd = (h >> 8) & 3, (h >> 3) & 15, ((h >> 4) & 8) | (h & 7)
+            if op == 0:
+                def fn():
+                    v = _u32(emu._reg(rd) + emu._reg(rm))
+                    if rd == 15:
+                        emu._branch_to(v)
+                    else:
+                        r[rd] = v
+            elif op == 1:
+                def fn():
+                    emu._add_flags(emu._reg(rd), _u32(~emu._reg(rm)), 1)
+            elif op == 2:
+                def fn():
+                    v = emu._reg(rm)
+                    if rd == 15:
+                        emu._branch_to(v)
+                    else:
+                        r[rd] = v
+            else:
+                link = (h >> 7) & 1
+
+                def fn():
+                    t = r[rm]
+                    if link:
+                        r[14] = _u32(emu.cur + 2) | 1
+                    emu._branch_to(t)
+            return fn
+        if top5 == 0b01001:
+            t, addr = (h >> 8) & 7, ((pc + 4) & ~3) + (h & 0xFF) * 4
+
+            def fn():
+                r[t] = emu._rd(addr, 4)
+            return fn
+        if (h >> 12) == 0b0101:
+            op, rm, rn, t = (h >> 9) & 7, (h >> 6) & 7, (h >> 3) & 7, h & 7
+            size, load, signed = [(4, 0, 0), (2, 0, 0), (1, 0, 0), (1, 1, 1), (4, 1, 0), (2, 1, 0), (1, 1, 0), (2, 1, 1)][op]
+            return self._ldst_fn(load, size, signed, t, lambda: _u32(r[rn] + r[rm]))
+        if (h >> 13) == 0b011:
+            size = 1 if (h >> 12) & 1 else 4
+            load, imm, rn, t = (h >> 11) & 1, ((h >> 6) & 31) * size, (h >> 3) & 7, h & 7
+            return self._ldst_fn(load, size, 0, t, lambda: _u32(r[rn] + imm))
+        if (h >> 12) == 0b1000:
+            load, imm, rn, t = (h >> 11) & 1, ((h >> 6) & 31) * 2, (h >> 3) & 7, h & 7
+            return self._ldst_fn(load, 2, 0, t, lambda: _u32(r[rn] + imm))
+        if (h >> 12) == 0b1001:
+            load, t, imm = (h >> 11) & 1, (h >> 8) & 7, (h & 0xFF) * 4
+            return self._ldst_fn(load, 4, 0, t, lambda: _u32(r[13] + imm))
+        if top5 == 0b10100:
+            rd, v = (h >> 8) & 7, ((pc + 4) & ~3) + (h & 0xFF) * 4
+
+            def fn():
+                r[rd] = v
+            return fn
+        if top5 == 0b10101:
+            rd, imm = (h >> 8) & 7, (h & 0xFF) * 4
+
+            def fn():
+                r[rd] = _u32(r[13] + imm)
+            return fn
+        if (h >> 12) == 0b1011:
+            return self._decode16_misc(pc, h)
+        if (h >> 12) == 0b1100:
+            load, rn = (h >> 11) & 1, (h >> 8) & 7
+            regs = [i for i in range(8) if h & (1 << i)]
+
+            def fn():
+                a = r[rn]
+                for j, i in enumerate(regs):
+                    if load:
+                        r[i] = emu._rd(a + 4 * j, 4)
+                    else:
+                        emu._wr(a + 4 * j, 4, r[i])
+                if not (load and rn in regs):
+                    r[rn] = _u32(a + 4 * len(regs))
+            return fn
+        if (h >> 12) == 0b1101:
+            cond = (h >> 8) & 15
+            if cond >= 14:
+                return lambda: self._undefined(h)
+            target = pc + 4 + _sext(h & 0xFF, 8) * 2
+
+            def fn():
+                if emu._cond(cond):
+                    emu.next = target
+            return fn
+        if top5 == 0b11100:
+            target = pc + 4 + _sext(h & 0x7FF, 11) * 2
+
+            def fn():
+                emu.next = target
+            return fn
+        return lambda: self._undefined(h)
+
+    def _decode16_misc(self, pc, h):
+        r = self.r
+        emu = self
+        op = (h >> 8) & 15
+        if op == 0:
+            imm = (h & 0x7F) * 4
+            sub = (h >> 7) & 1
+
+            def fn():
+                r[13] = _u32(r[13] - imm if sub else r[13] + imm)
+            return fn
+        if op in (1, 3, 9, 11):
+            rn, nonzero = h & 7, (h >> 11) & 1
+            target = pc + 4 + ((((h >> 9) & 1) << 6) | (((h >> 3) & 31) << 1))
+
+            def fn():
+                if (r[rn] != 0) == bool(nonzero):
+                    emu.next = target
+            return fn
+        if op == 2:
+            kind, rm, rd = (h >> 6) & 3, (h >> 3) & 7, h & 7
+            ext = [lambda v: _u32(_sext(v & 0xFFFF, 16)), lambda v: _u32(_sext(v & 0xFF, 8)),
+                   lambda v: v & 0xFFFF, lambda v: v & 0xFF][kind]
+
+            def fn():
+                r[rd] = ext(r[rm])
+            return fn
+        if op in (4, 5):
+            regs = [i for i in range(8) if h & (1 << i)] + ([14] if (h >> 8) & 1 else [])
+
+            def fn():
+                a = r[13] - 4 * len(regs)
+                for j, i in enumerate(regs):
+                    emu._wr(a + 4 * j, 4, r[i])
+                r[13] = a
+            return fn
+        if op in (12, 13):
+            regs = [i for i in range(8) if h & (1 << i)] + ([15] if (h >> 8) & 1 else [])
+
+            def fn():
+                a = r[13]
+                for j, i in enumerate(regs):
+                    emu._set_rt(i, emu._rd(a + 4 * j, 4))
+                r[13] = _u32(a + 4 * len(regs))
+            return fn
+        if op == 15:
+            mask = h & 0xFF
+
+            def fn():
+                if mask & 0xF:
+                    emu.it = mask
+            return fn
+        if op == 10 and ((h >> 6) & 3) in (0, 1, 3):
+            kind, rm, rd = (h >> 6) & 3, (h >> 3) & 7, h & 7
+
+            def fn():
+                v = r[rm]
+                if kind == 0:
+                    r[rd] = int.from_bytes(v.to_bytes(4, 'little'), 'big')
+                elif kind == 1:
+                    r[rd] = ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF)
+                else:
+                    r[rd] = _u32(_sext(((v & 0xFF) << 8) | ((v >> 8) & 0xFF), 16))
+            return fn
+        return lambda: self._undefined(h)
+
+    def _ldst_fn(self, load, size, signed, t, address, writeback=None):
+        emu = self
+        r = self.r
+        if load:
+            def fn():
+                a = address()
+                emu._set_rt(t, emu._load(a, size, signed))
+                if writeback is not None:
+                    writeback()
+        else:
+            def fn():
+                a = address()
+                emu._wr(a, size, r[t])
+                if writeback is not None:
+                    writeback()
+        return fn
+
+    def _decode32(self, pc, h1, h2):
+        r = self.r
+        emu = self
+        op1 = (h1 >> 11) & 3
+        op2 = (h1 >> 4) & 0x7F
+
+        if op1 == 1:
+            if (op2 & 0x64) == 0:
+                # Load/store multiple
+                mode, wback, load, rn = (h1 >> 7) & 3, (h1 >> 5) & 1, (h1 >> 4) & 1, h1 & 15
+                regs = [i for i in range(16) if h2 & (1 << i)]
+
+                def fn():
+                    base = r[rn]
+                    a = _u32(base - 4 * len(regs)) if mode == 2 else base
+                    for j, i in enumerate(regs):
+                        if load:
+                            emu._set_rt(i, emu._rd(a + 4 * j, 4))
+                        else:
+                            emu._wr(a + 4 * j, 4, r[i])
+                    if wback and not (load and rn in regs):
+                        r[rn] = _u32(base + 4 * len(regs)) if mode == 1 else a
+                return fn
+            if (op2 & 0x64) == 0x04:
+                if ((h1 >> 4) & 0x1F) == 0b01101 and (h2 & 0xFFE0) == 0xF000:
+                    # TBB / TBH
+                    rn, rm, half = h1 & 15, h2 & 15, (h2 >> 4) & 1
+
+                    def fn():
+                        base = emu._reg(rn)
+                        off = emu._rd(_u32(base + 2 * r[rm]), 2) if half else emu._rd(_u32(base + r[rm]), 1)
+                        emu.next = emu.cur + 4 + 2 * off
+                    return fn
+                if ((h1 >> 7) & 3) == 0 and ((h1 >> 5) & 1) == 0:
+                    return lambda: self._undefined(h1, h2)
+                # LDRD / STRD
+                p, u, w, load, rn = (h1 >> 8) & 1, (h1 >> 7) & 1, (h1 >> 5) & 1, (h1 >> 4) & 1, h1 & 15
+                t, t2, imm = (h2 >> 12) & 15, (h2 >> 8) & 15, (h2 & 0xFF) * 4
+
+                def fn():
+                    base = ((emu.cur + 4) & ~3) if rn == 15 else r[rn]
+                    off = _u32(base + imm) if u else _u32(base - imm)
+                    a = off if p else base
+                    if load:
+                        r[t] = emu._rd(a, 4)
+                        r[t2] = emu._rd(a + 4, 4)
+                    else:
+                        emu._wr(a, 4, r[t])
+                        emu._wr(a + 4, 4, r[t2])
+                    if w:
+                        r[rn] = off
+                return fn
+            if (op2 & 0x60) == 0x20:
+                # Data processing, shifted register
+                op, setflags, rn, rd, rm = (h1 >> 5) & 15, (h1 >> 4) & 1, h1 & 15, (h2 >> 8) & 15, h2 & 15
+                imm, stype = (((h2 >> 12) & 7) << 2) | ((h2 >> 6) & 3), (h2 >> 4) & 3
+
+                def fn():
+                    b, c = emu._shift_c(r[rm], stype, imm, emu.c)
+                    emu._dp(op, setflags, rn, rd, emu._reg(rn), b, c)
+                return fn
+            return self._decode_vfp(pc, h1, h2)
+
+        if op1 == 2:
+            if not (h2 >> 15) & 1:
+                rn, rd = h1 & 15, (h2 >> 8) & 15
+                i12 = (((h1 >> 10) & 1) << 11) | (((h2 >> 12) & 7) << 8) | (h2 & 0xFF)
+                if not (h1 >> 9) & 1:
+                    # Data processing, modified immediate
+                    op, setflags = (h1 >> 5) & 15, (h1 >> 4) & 1
+                    if (i12 >> 10) == 0:
+                        b = h2 & 0xFF
+                        b = [b, (b << 16) | b, (b << 24) | (b << 8), (b << 24) | (b << 16) | (b << 8) | b][(i12 >> 8) & 3]
+                        carry = None
+                    else:
+                        b = _ror(0x80 | (i12 & 0x7F), (i12 >> 7) & 31)
+                        carry = b >> 31
+
+                    def fn():
+                        emu._dp(op, setflags, rn, rd, 0 if rn == 15 else r[rn], b, emu.c if carry is None else carry)
+                    return fn
+                op = (h1 >> 4) & 31
+                imm16 = ((h1 & 15) << 12) | i12
+                if op == 0:
+                    def fn():
+                        r[rd] = _u32((((emu.cur + 4) & ~3) if rn == 15 else r[rn]) + i12)
+                    return fn
+                if op == 0b01010:
+                    def fn():
+                        r[rd] = _u32((((emu.cur + 4) & ~3) if rn == 15 else r[rn]) - i12)
+                    return fn
+                if op == 0b00100:
+                    def fn():
+                        r[rd] = imm16
+                    return fn
+                if op == 0b01100:
+                    def fn():
+                        r[rd] = (r[rd] & 0xFFFF) | (imm16 << 16)
+                    return fn
+                lsb = (((h2 >> 12) & 7) << 2) | ((h2 >> 6) & 3)
+                if op in (0b10100, 0b11100):
+                    width = (h2 & 31) + 1
+                    signed = op == 0b10100
+
+                    def fn():
+                        v = (r[rn] >> lsb) & ((1 << width) - 1)
+                        r[rd] = _u32(_sext(v, width)) if signed else v
+                    return fn
+                if op == 0b10110:
+                    msb = h2 & 31
+                    mask = ((1 << (msb - lsb + 1)) - 1) << lsb
+
+                    def fn():
+                        src = 0 if rn == 15 else r[rn]
+                        r[rd] = (r[rd] & ~mask & 0xFFFFFFFF) | ((src << lsb) & mask)
+                    return fn
+                return lambda: self._undefined(h1, h2)
+            # Branches
+            kind = (h2 >> 12) & 5
+            sign, j1, j2 = (h1 >> 10) & 1, (h2 >> 13) & 1, (h2 >> 11) & 1
+            if kind == 0:
+                cond = (h1 >> 6) & 15
+                if cond >= 14:
+                    return lambda: self._undefined(h1, h2)
+                target = pc + 4 + _sext((sign << 20) | (j2 << 19) | (j1 << 18) | ((h1 & 0x3F) << 12) | ((h2 & 0x7FF) << 1), 21)
+
+                def fn():
+                    if emu._cond(cond):
+                        emu.next = target
+                return fn
+            i1, i2 = (~(j1 ^ sign)) & 1, (~(j2 ^ sign)) & 1
+            target = pc + 4 + _sext((sign << 24) | (i1 << 23) | (i2 << 22) | ((h1 & 0x3FF) << 12) | ((h2 & 0x7FF) << 1), 25)
+            if kind == 1:
+                def fn():
+                    emu.next = target
+                return fn
+            if kind == 5:
+                def fn():
+                    r[14] = _u32(emu.cur + 4) | 1
+                    emu.next = target
+                return fn
+            return lambda: self._undefined(h1, h2)
+
+        # op1 == 3
+        if op2 & 0x40:
+            return self._decode_vfp(pc, h1, h2)
+        if (op2 & 0x71) in (0x00, 0x01, 0x10, 0x11) and (op2 & 0x67) != 0x07:
+            # Load/store single
+            size = [1, 2, 4, 0][(h1 >> 5) & 3]
+            signed, load, rn, t = (h1 >> 8) & 1, (h1 >> 4) & 1, h1 & 15, (h2 >> 12) & 15
+            if size == 0:
+                return lambda: self._undefined(h1, h2)
+            if rn == 15:
+                imm = h2 & 0xFFF
+                a = ((pc + 4) & ~3) + (imm if (h1 >> 7) & 1 else -imm)
+                return self._ldst_fn(load, size, signed, t, lambda: a)
+            if (h1 >> 7) & 1:
+                imm = h2 & 0xFFF
+                return self._ldst_fn(load, size, signed, t, lambda: _u32(r[rn] + imm))
+            if ((h2 >> 6) & 63) == 0:
+                rm, sh = h2 & 15, (h2 >> 4) & 3
+                return self._ldst_fn(load, size, signed, t, lambda: _u32(r[rn] + (r[rm] << sh)))
+            if (h2 >> 11) & 1:
+                p, u, w, imm = (h2 >> 10) & 1, (h2 >> 9) & 1, (h2 >> 8) & 1, h2 & 0xFF
+                if not p and not w:
+                    return lambda: self._undefined(h1, h2)
+                state = {}
+
+                def address():
+                    off = _u32(r[rn] + imm) if u else _u32(r[rn] - imm)
+                    state['off'] = off
+                    return off if p else r[rn]
+
+                def writeback():
+                    r[rn] = state['off']
+                return self._ldst_fn(load, size, signed, t, address, writeback if w else None)
+            return lambda: self._undefined(h1, h2)
+        if (op2 & 0x70) == 0x20:
+            rn, rd, rm = h1 & 15, (h2 >> 8) & 15, h2 & 15
+            if ((h2 >> 4) & 15) == 0 and not (h1 >> 7) & 1:
+                stype, setflags = (h1 >> 5) & 3, (h1 >> 4) & 1
+
+                def fn():
+                    v, c = emu._shift_reg(r[rn], stype, r[rm] & 0xFF)
+                    r[rd] = v
+                    if setflags:
+                        emu._nz(v)
+                        emu.c = c
+                return fn
+            if not (h1 >> 7) & 1 and (h2 >> 7) & 1:
+                kind, rot = (h1 >> 4) & 7, ((h2 >> 4) & 3) * 8
+                ext = {0: lambda v: _u32(_sext(v & 0xFFFF, 16)), 1: lambda v: v & 0xFFFF,
+                       4: lambda v: _u32(_sext(v & 0xFF, 8)), 5: lambda v: v & 0xFF}.get(kind)
+                if ext is None:
+                    return lambda: self._undefined(h1, h2)
+
+                def fn():
+                    v = ext(_ror(r[rm], rot))
+                    r[rd] = v if rn == 15 else _u32(r[rn] + v)
+                return fn
+            if ((h1 >> 4) & 15) == 0b1011 and ((h2 >> 4) & 15) == 0b1000:
+                def fn():
+                    v = r[rm]
+                    r[rd] = 32 - v.bit_length()
+                return fn
+            if ((h1 >> 4) & 15) == 0b1001 and ((h2 >> 4) & 15) in (0b1000, 0b1010):
+                rbit = ((h2 >> 4) & 15) == 0b1010
+
+                def fn():
+                    v = r[rm]
+                    r[rd] = int('{:032b}'.format(v)[::-1], 2) if rbit else int.from_bytes(v.to_bytes(4, 'little'), 'big')
+                return fn
+            return lambda: self._undefined(h1, h2)
+        if (op2 & 0x78) == 0x30:
+            rn, ra, rd, rm, op = h1 & 15, (h2 >> 12) & 15, (h2 >> 8) & 15, h2 & 15, (h1 >> 4) & 7
+            if op == 0 and ((h2 >> 4) & 3) == 0:
+                def fn():
+                    r[rd] = _u32(r[rn] * r[rm] + (0 if ra == 15 else r[ra]))
+                return fn
+            if op == 0 and ((h2 >> 4) & 3) == 1:
+                def fn():
+                    r[rd] = _u32(r[ra] - r[rn] * r[rm])
+                return fn
+            return lambda: self._undefined(h1, h2)
+        if (op2 & 0x78) == 0x38:
+            rn, lo, hi, rm, op = h1 & 15, (h2 >> 12) & 15, (h2 >> 8) & 15, h2 & 15, (h1 >> 4) & 7
+            if op == 1 or op == 3:
+                signed = op == 1
+
+                def fn():
+                    if signed:
+                        a, b = _s32(r[rn]), _s32(r[rm])
+                        q = 0 if b == 0 else abs(a) // abs(b) * (1 if (a < 0) == (b < 0) else -1)
+                        r[hi] = _u32(q)
+                    else:
+                        r[hi] = 0 if r[rm] == 0 else r[rn] // r[rm]
+                return fn
+            if op in (0, 2, 4, 6):
+                signed, acc = op in (0, 4), op in (4, 6)
+
+                def fn():
+                    v = (_s32(r[rn]) * _s32(r[rm])) if signed else (r[rn] * r[rm])
+                    if acc:
+                        a = r[lo] | (r[hi] << 32)
+                        v += (a - (1 << 64) if signed and a >> 63 else a)
+                    r[lo] = v & 0xFFFFFFFF
+                    r[hi] = (v >> 32) & 0xFFFFFFFF
+                return fn
+            return lambda: self._undefined(h1, h2)
+        return lambda: self._undefined(h1, h2)
+
+    def _dp(self, op, setflags, rn, rd, a, b, carry):
+        r = self.r
+        write = True
+        if op == 0:
+            res = a & b
+            write = rd != 15
+        elif op == 1:
+            res = a & ~b & 0xFFFFFFFF
+        elif op == 2:
+            res = b if rn == 15 else a | b
+        elif op == 3:
+            res = (~b & 0xFFFFFFFF) if rn == 15 else (a | (~b & 0xFFFFFFFF))
+        elif op == 4:
+            res = a ^ b
+            write = rd != 15
+        elif op == 8:
+            res = self._add_flags(a, b, 0) if (setflags or rd == 15) else _u32(a + b)
+            if rd == 15:
+                return
+            r[rd] = res
+            return
+        elif op == 10:
+            res = self._add_flags(a, b, self.c) if setflags else _u32(a + b + self.c)
+            r[rd] = res
+            return
+        elif op == 11:
+            res = self._add_flags(a, _u32(~b), self.c) if setflags else _u32(a - b - 1 + self.c)
+            r[rd] = res
+            return
+        elif op == 13:
+            res = self._add_flags(a, _u32(~b), 1) if (setflags or rd == 15) else _u32(a - b)
+            if rd == 15:
+                return
+            r[rd] = res
+            return
+        elif op == 14:
+            res = self._add_flags(_u32(~a), b, 1) if setflags else _u32(b - a)
+            r[rd] = res
+            return
+        else:
+            self._undefined(op)
+        if write:
+            r[rd] = res
+        if setflags:
+            self._nz(res)
+            self.c = carry
+
+    def _decode_vfp(self, pc, h1, h2):
+        r = self.r
+        s = self.s
+        emu = self
+        coproc = (h2 >> 8) & 15
+        if coproc not in (10, 11):
+            return lambda: self._undefined(h1, h2)
+        dp = coproc == 11
+        D, Vd = (h1 >> 6) & 1, (h2 >> 12) & 15
+        d = ((D << 4) | Vd) if dp else ((Vd << 1) | D)
+
+        if ((h1 >> 9) & 7) == 0b110:
+            if ((h1 >> 5) & 15) == 0b0010:
+                # VMOV between two core registers and a double register or two single registers
+                load, t, t2, M, Vm = (h1 >> 4) & 1, (h2 >> 12) & 15, h1 & 15, (h2 >> 5) & 1, h2 & 15
+                m = 2 * ((M << 4) | Vm) if dp else ((Vm << 1) | M)
+
+                def fn():
+                    if load:
+                        r[t], r[t2] = s[m], s[m + 1]
+                    else:
+                        s[m], s[m + 1] = r[t], r[t2]
+                return fn
+            p, u, w, load, rn = (h1 >> 8) & 1, (h1 >> 7) & 1, (h1 >> 5) & 1, (h1 >> 4) & 1, h1 & 15
+            imm = (h2 & 0xFF) * 4
+            if p and not w:
+                # VLDR / VSTR
+                def fn():
+                    base = ((emu.cur + 4) & ~3) if rn == 15 else r[rn]
+                    a = _u32(base + imm) if u else _u32(base - imm)
+                    if dp:
+                        if load:
+                            s[2 * d], s[2 * d + 1] = emu._rd(a, 4), emu._rd(a + 4, 4)
+                        else:
+                            emu._wr(a, 4, s[2 * d])
+                            emu._wr(a + 4, 4, s[2 * d + 1])
+                    elif load:
+                        s[d] = emu._rd(a, 4)
+                    else:
+                        emu._wr(a, 4, s[d])
+                return fn
+            # VLDM / VSTM / VPUSH / VPOP
+            first = 2 * d if dp else d
+            count = (h2 & 0xFF) if dp else (h2 & 0xFF)
+
+            def fn():
+                base = r[rn]
+                a = base if u else _u32(base - imm)
+                for j in range(count):
+                    if load:
+                        s[first + j] = emu._rd(a + 4 * j, 4)
+                    else:
+                        emu._wr(a + 4 * j, 4, s[first + j])
+                if w:
+                    r[rn] = _u32(base + imm) if u else _u32(base - imm)
+            return fn
+
+        if ((h1 >> 8) & 15) == 0b1110 and (h2 >> 4) & 1:
+            op, load, t = (h1 >> 5) & 7, (h1 >> 4) & 1, (h2 >> 12) & 15
+            if op == 7 and load and (h1 & 15) == 1:
+                # VMRS
+                def fn():
+                    if t == 15:
+                        f = emu.fpscr_nzcv
+                        emu.n, emu.z, emu.c, emu.v = (f >> 3) & 1, (f >> 2) & 1, (f >> 1) & 1, f & 1
+                    else:
+                        r[t] = emu.fpscr_nzcv << 28
+                return fn
+            if op == 7 and not load:
+                return lambda: None     # VMSR, the rounding mode is not emulated
+            if op == 0 and not dp:
+                n = ((h1 & 15) << 1) | ((h2 >> 7) & 1)
+
+                def fn():
+                    if load:
+                        r[t] = s[n]
+                    else:
+                        s[n] = r[t]
+                return fn
+            if op in (0, 1) and dp and not (h2 >> 5) & 3:
+                n = 2 * ((((h2 >> 7) & 1) << 4) | (h1 & 15)) + ((h1 >> 5) & 1)
+
+                def fn():
+                    if load:
+                        r[t] = s[n]
+                    else:
+                        s[n] = r[t]
+                return fn
+            return lambda: self._undefined(h1, h2)
+
+        if ((h1 >> 8) & 15) != 0b1110 or (h2 >> 4) & 1:
+            return lambda: self._undefined(h1, h2)
+
+        N, M, Vn, Vm, opb = (h2 >> 7) & 1, (h2 >> 5) & 1, h1 & 15, h2 & 15, (h2 >> 6) & 1
+        n = ((N << 4) | Vn) if dp else ((Vn << 1) | N)
+        m = ((M << 4) | Vm) if dp else ((Vm << 1) | M)
+        opc1 = (((h1 >> 7) & 1) << 2) | ((h1 >> 4) & 3)
+        get, put = self._fget, self._fset
+
+        def rnd(v):
+            # Round through the destination precision
+            return v if dp else bits_f32(f32_bits(v))
+
+        if opc1 == 0:
+            def fn():
+                prod = rnd(get(n, dp) * get(m, dp))
+                put(d, dp, get(d, dp) - prod if opb else get(d, dp) + prod)
+            return fn
+        if opc1 == 1:
+            def fn():
+                prod = rnd(get(n, dp) * get(m, dp))
+                put(d, dp, -get(d, dp) - prod if opb else -get(d, dp) + prod)
+            return fn
+        if opc1 == 2:
+            def fn():
+                v = get(n, dp) * get(m, dp)
+                put(d, dp, -rnd(v) if opb else v)
+            return fn
+        if opc1 == 3:
+            def fn():
+                put(d, dp, get(n, dp) - get(m, dp) if opb else get(n, dp) + get(m, dp))
+            return fn
+        if opc1 == 4 and not opb:
+            def fn():
+                a, b = get(n, dp), get(m, dp)
+                if b == 0.0:
+                    put(d, dp, float('nan') if a == 0.0 or a != a else
+                        (float('inf') if (a > 0) == (str(b)[0] != '-') else float('-inf')))
+                else:
+                    put(d, dp, a / b)
+            return fn
+        if opc1 != 7:
+            return lambda: self._undefined(h1, h2)
+
+        opc2, opc3 = h1 & 15, (h2 >> 6) & 3
+        if not opb:
+            # VMOV immediate
+            imm8 = ((h1 & 15) << 4) | (h2 & 15)
+            b6 = (imm8 >> 6) & 1
+            if dp:
+                v = ((imm8 >> 7) << 63) | ((1 - b6) << 62) | ((0xFF if b6 else 0) << 54) | ((imm8 & 0x3F) << 48)
+
+                def fn():
+                    s[2 * d], s[2 * d + 1] = v & 0xFFFFFFFF, v >> 32
+            else:
+                v = ((imm8 >> 7) << 31) | ((1 - b6) << 30) | ((0x1F if b6 else 0) << 25) | ((imm8 & 0x3F) << 19)
+
+                def fn():
+                    s[d] = v
+            return fn
+        if opc2 == 0 and opc3 == 1:
+            def fn():
+                if dp:
+                    s[2 * d], s[2 * d + 1] = s[2 * m], s[2 * m + 1]
+                else:
+                    s[d] = s[m]
+            return fn
+        if opc2 == 0 and opc3 == 3:
+            def fn():
+                if dp:
+                    s[2 * d], s[2 * d + 1] = s[2 * m], s[2 * m + 1] & 0x7FFFFFFF
+                else:
+                    s[d] = s[m] & 0x7FFFFFFF
+            return fn
+        if opc2 == 1 and opc3 == 1:
+            def fn():
+                if dp:
+                    s[2 * d], s[2 * d + 1] = s[2 * m], s[2 * m + 1] ^ 0x80000000
+                else:
+                    s[d] = s[m] ^ 0x80000000
+            return fn
+        if opc2 == 1 and opc3 == 3:
+            def fn():
+                v = get(m, dp)
+                put(d, dp, v ** 0.5 if v >= 0 else float('nan'))
+            return fn
+        if opc2 in (4, 5):
+            zero = opc2 == 5
+
+            def fn():
+                a, b = get(d, dp), (0.0 if zero else get(m, dp))
+                if a != a or b != b:
+                    emu.fpscr_nzcv = 0b0011
+                elif a == b:
+                    emu.fpscr_nzcv = 0b0110
+                elif a < b:
+                    emu.fpscr_nzcv = 0b1000
+                else:
+                    emu.fpscr_nzcv = 0b0010
+            return fn
+        if opc2 == 7 and opc3 == 3:
+            # VCVT between double and single
+            if dp:
+                sd = (Vd << 1) | D
+
+                def fn():
+                    s[sd] = f32_bits(get(m, True))
+            else:
+                dd = (D << 4) | Vd
+
+                def fn():
+                    put(dd, True, get(m, False))
+            return fn
+        if opc2 == 8:
+            # VCVT from integer, the source is a single register
+            sm = (Vm << 1) | M
+            signed = (h2 >> 7) & 1
+
+            def fn():
+                v = s[sm]
+                put(d, dp, float(_s32(v) if signed else v))
+            return fn
+        if opc2 in (12, 13):
+            # VCVT to integer, the destination is a single register
+            sd = (Vd << 1) | D
+            signed, toward_zero = opc2 == 13, (h2 >> 7) & 1
+
+            def fn():
+                x = get(m, dp)
+                if x != x:
+                    v = 0
+                elif x in (float('inf'), float('-inf')):
+                    v = (1 << 40) if x > 0 else -(1 << 40)
+                else:
+                    v = int(x) if toward_zero else int(round(x))
+                lo, hi = (-(1 << 31), (1 << 31) - 1) if signed else (0, (1 << 32) - 1)
+                s[sd] = _u32(max(lo, min(hi, v)))
+            return fn
+        return lambda: self._undefined(h1, h2)